@@ -0,0 +1,48 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t, uint64_t
+#include <random>   // for mt19937, uniform_int_distribution
+#include <vector>   // for vector
+
+#include "../src/common/compressed_iterator.h"  // for CompressedBufferWriter, CompressedIterator
+
+namespace xgboost::common {
+namespace {
+// Measures the bit-unpacking decode used to read ELLPACK-style gradient index pages; the
+// symbol count controls the bit width and therefore the shift/mask work per element.
+void BM_CompressedIteratorDecode(benchmark::State& state) {
+  auto n = static_cast<std::size_t>(state.range(0));
+  auto num_symbols = static_cast<std::size_t>(state.range(1));
+
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<std::uint32_t> dist{
+      0, static_cast<std::uint32_t>(num_symbols - 1)};
+  std::vector<std::uint32_t> symbols(n);
+  for (auto& s : symbols) {
+    s = dist(rng);
+  }
+
+  CompressedBufferWriter writer{num_symbols};
+  std::vector<CompressedByteT> buffer(CompressedBufferWriter::CalculateBufferSize(n, num_symbols));
+  writer.Write(buffer.data(), symbols.begin(), symbols.end());
+
+  for (auto _ : state) {
+    CompressedIterator<std::uint32_t> it{buffer.data(), num_symbols};
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      sum += it[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(BM_CompressedIteratorDecode)
+    ->ArgNames({"values", "symbols"})
+    ->ArgsProduct({{1 << 16, 1 << 20}, {1 << 4, 1 << 10, 1 << 20}});
+}  // anonymous namespace
+}  // namespace xgboost::common
@@ -0,0 +1,81 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include <benchmark/benchmark.h>
+#include <xgboost/context.h>    // for Context
+#include <xgboost/learner.h>    // for LearnerModelParam
+#include <xgboost/predictor.h>  // for Predictor, PredictionCacheEntry
+#include <xgboost/tree_model.h> // for RegTree
+
+#include <cstddef>  // for size_t
+#include <memory>   // for unique_ptr
+#include <random>  // for mt19937, uniform_real_distribution, uniform_int_distribution
+#include <vector>  // for vector
+
+#include "../src/gbm/gbtree_model.h"  // for GBTreeModel, TreesOneGroup
+#include "bench_utils.h"
+
+namespace xgboost {
+namespace {
+/**
+ * \brief Grow a balanced tree of the given depth with random splits on [0, 1) features.
+ */
+std::unique_ptr<RegTree> MakeTree(bst_feature_t n_cols, bst_node_t depth, std::mt19937* rng) {
+  auto p_tree = std::make_unique<RegTree>();
+  auto& tree = *p_tree;
+  std::uniform_int_distribution<bst_feature_t> feat_dist{0, static_cast<bst_feature_t>(n_cols - 1)};
+  std::uniform_real_distribution<float> val_dist{0.0f, 1.0f};
+
+  std::vector<bst_node_t> frontier{RegTree::kRoot};
+  for (bst_node_t d = 0; d < depth; ++d) {
+    std::vector<bst_node_t> next;
+    for (auto nidx : frontier) {
+      auto w = val_dist(*rng);
+      tree.ExpandNode(nidx, feat_dist(*rng), val_dist(*rng), true, w, w - 0.1f, w + 0.1f, 1.0f,
+                      2.0f, 1.0f, 1.0f);
+      next.push_back(tree[nidx].LeftChild());
+      next.push_back(tree[nidx].RightChild());
+    }
+    frontier = std::move(next);
+  }
+  return p_tree;
+}
+
+// Scores a synthetic forest over a dense matrix; this hits the blocked traversal in
+// CPUPredictor::PredictBatch including the thread-local feature vector staging.
+void BM_CPUPredictorBatch(benchmark::State& state) {
+  auto n_rows = static_cast<bst_idx_t>(state.range(0));
+  auto n_trees = static_cast<bst_tree_t>(state.range(1));
+  auto depth = static_cast<bst_node_t>(state.range(2));
+  bst_feature_t constexpr kCols = 64;
+
+  Context ctx;
+  auto dmat = bench::MakeDenseDMatrix(n_rows, kCols, 0.0f);
+
+  std::size_t shape[1]{1};
+  LearnerModelParam mparam{kCols, linalg::Tensor<float, 1>{{0.5f}, shape, DeviceOrd::CPU()}, 1, 1,
+                           MultiStrategy::kOneOutputPerTree};
+  gbm::GBTreeModel model{&mparam, &ctx};
+  std::mt19937 rng(0);
+  gbm::TreesOneGroup trees;
+  for (bst_tree_t i = 0; i < n_trees; ++i) {
+    trees.push_back(MakeTree(kCols, depth, &rng));
+  }
+  model.CommitModelGroup(std::move(trees), 0);
+
+  auto predictor = std::unique_ptr<Predictor>(Predictor::Create("cpu_predictor", &ctx));
+  predictor->Configure({});
+  for (auto _ : state) {
+    PredictionCacheEntry out_predictions;
+    predictor->InitOutPredictions(dmat->Info(), &out_predictions.predictions, model);
+    predictor->PredictBatch(dmat.get(), &out_predictions, model, 0);
+    benchmark::DoNotOptimize(out_predictions.predictions.HostVector().data());
+  }
+  state.SetItemsProcessed(state.iterations() * n_rows * n_trees);
+}
+
+BENCHMARK(BM_CPUPredictorBatch)
+    ->ArgNames({"rows", "trees", "depth"})
+    ->ArgsProduct({{1 << 12, 1 << 16}, {64, 512}, {4, 8}});
+}  // anonymous namespace
+}  // namespace xgboost
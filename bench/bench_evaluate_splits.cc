@@ -0,0 +1,67 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include <benchmark/benchmark.h>
+#include <xgboost/context.h>     // for Context
+#include <xgboost/tree_model.h>  // for RegTree
+
+#include <memory>  // for make_shared
+#include <random>  // for mt19937, uniform_real_distribution
+#include <vector>  // for vector
+
+#include "../src/common/hist_util.h"             // for SketchOnDMatrix
+#include "../src/common/random.h"                // for ColumnSampler
+#include "../src/tree/hist/evaluate_splits.h"    // for HistEvaluator
+#include "../src/tree/hist/expand_entry.h"       // for CPUExpandEntry
+#include "../src/tree/hist/hist_cache.h"         // for BoundedHistCollection
+#include "../src/tree/param.h"                   // for TrainParam
+#include "bench_utils.h"
+
+namespace xgboost::tree {
+namespace {
+// Measures split enumeration over the root histogram: scan every bin of every feature,
+// accumulate the left/right statistics and evaluate the gain.
+void BM_EnumerateSplit(benchmark::State& state) {
+  auto n_cols = static_cast<bst_feature_t>(state.range(0));
+  auto max_bins = static_cast<bst_bin_t>(state.range(1));
+  bst_idx_t constexpr kRows = 4096;  // only sized to give every bin some mass
+
+  Context ctx;
+  auto dmat = bench::MakeDenseDMatrix(kRows, n_cols, 0.0f);
+  auto cut = common::SketchOnDMatrix(&ctx, dmat.get(), max_bins);
+  auto total_bins = cut.TotalBins();
+
+  TrainParam param;
+  param.UpdateAllowUnknown(Args{});
+  auto sampler = std::make_shared<common::ColumnSampler>(0);
+  HistEvaluator evaluator{&ctx, &param, dmat->Info(), sampler};
+
+  BoundedHistCollection hist;
+  hist.Reset(total_bins, 1);
+  hist.AllocateHistograms({0});
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<double> dist{0.0, 1.0};
+  GradStats root_sum;
+  for (auto& bin : hist[0]) {
+    bin = GradientPairPrecise{dist(rng) - 0.5, dist(rng)};
+    root_sum.Add(bin.GetGrad(), bin.GetHess());
+  }
+  // every feature sees the full root sum; divide it out so per-feature scans balance.
+  root_sum = GradStats{root_sum.GetGrad() / n_cols, root_sum.GetHess() / n_cols};
+  evaluator.InitRoot(root_sum);
+
+  RegTree tree{1, n_cols};
+  auto ft = dmat->Info().feature_types.ConstHostSpan();
+  for (auto _ : state) {
+    std::vector<CPUExpandEntry> entries{CPUExpandEntry{RegTree::kRoot, 0}};
+    evaluator.EvaluateSplits(hist, cut, ft, tree, &entries);
+    benchmark::DoNotOptimize(entries.front());
+  }
+  state.SetItemsProcessed(state.iterations() * total_bins);
+}
+
+BENCHMARK(BM_EnumerateSplit)
+    ->ArgNames({"cols", "bins"})
+    ->ArgsProduct({{16, 128, 1024}, {64, 256}});
+}  // anonymous namespace
+}  // namespace xgboost::tree
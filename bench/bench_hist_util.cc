@@ -0,0 +1,70 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include <benchmark/benchmark.h>
+#include <xgboost/context.h>  // for Context
+
+#include <algorithm>  // for fill
+#include <numeric>    // for iota
+#include <vector>     // for vector
+
+#include "../src/common/hist_util.h"     // for BuildHist, GHistRow, HistBackend
+#include "../src/data/gradient_index.h"  // for GHistIndexMatrix
+#include "bench_utils.h"
+
+namespace xgboost::common {
+namespace {
+void RunBuildHist(benchmark::State& state, float sparsity, HistBackend backend) {
+  auto n_rows = static_cast<bst_idx_t>(state.range(0));
+  auto max_bins = static_cast<bst_bin_t>(state.range(1));
+  bst_feature_t constexpr kCols = 64;
+
+  Context ctx;
+  auto dmat = bench::MakeDenseDMatrix(n_rows, kCols, sparsity);
+  GHistIndexMatrix gmat{&ctx, dmat.get(), max_bins, 0.2, false};
+  auto gpair = bench::MakeGradients(n_rows);
+  std::vector<RowIndexT> ridx(n_rows);
+  std::iota(ridx.begin(), ridx.end(), 0);
+  std::vector<GradientPairPrecise> hist(gmat.cut.TotalBins());
+
+  bool any_missing = !gmat.IsDense();
+  for (auto _ : state) {
+    std::fill(hist.begin(), hist.end(), GradientPairPrecise{});
+    if (any_missing) {
+      BuildHist<true>(gpair, ridx, gmat, GHistRow{hist}, false, backend);
+    } else {
+      BuildHist<false>(gpair, ridx, gmat, GHistRow{hist}, false, backend);
+    }
+    benchmark::DoNotOptimize(hist.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n_rows);
+}
+
+void BM_BuildHistDense(benchmark::State& state) {
+  RunBuildHist(state, 0.0f, HistBackend::kDefault);
+}
+
+void BM_BuildHistSparse(benchmark::State& state) {
+  RunBuildHist(state, 0.5f, HistBackend::kDefault);
+}
+
+void BM_BuildHistDenseSimd(benchmark::State& state) {
+  if (!SimdHistSupported()) {
+    state.SkipWithMessage("SIMD kernel not supported on this CPU.");
+    return;
+  }
+  RunBuildHist(state, 0.0f, HistBackend::kSimd);
+}
+
+BENCHMARK(BM_BuildHistDense)
+    ->ArgNames({"rows", "bins"})
+    ->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {64, 256}});
+BENCHMARK(BM_BuildHistSparse)
+    ->ArgNames({"rows", "bins"})
+    ->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {64, 256}});
+BENCHMARK(BM_BuildHistDenseSimd)
+    ->ArgNames({"rows", "bins"})
+    ->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {64, 256}});
+}  // anonymous namespace
+}  // namespace xgboost::common
@@ -0,0 +1,49 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstdint>  // for uint8_t
+#include <numeric>  // for iota
+#include <random>   // for mt19937, uniform_int_distribution
+#include <vector>   // for vector
+
+#include "../src/common/partition_builder.h"  // for PartitionBuilder
+
+namespace xgboost::common {
+namespace {
+constexpr std::size_t kBlockSize = 2048;  // same as tree::kPartitionBlockSize
+
+// Measures the branchy scatter loop at the heart of row partitioning: rows are visited
+// through an index indirection and routed left or right on a bin comparison.  The split
+// balance argument controls branch predictability (50 is the adversarial case).
+void BM_PartitionRangeKernel(benchmark::State& state) {
+  auto n_rows = static_cast<std::size_t>(state.range(0));
+  auto left_pct = static_cast<std::uint32_t>(state.range(1));
+
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<std::uint32_t> dist{0, 99};
+  std::vector<std::uint8_t> go_left(n_rows);
+  for (auto& v : go_left) {
+    v = dist(rng) < left_pct;
+  }
+  std::vector<RowIndexT> ridx(n_rows);
+  std::iota(ridx.begin(), ridx.end(), 0);
+  std::vector<RowIndexT> left(n_rows), right(n_rows);
+
+  PartitionBuilder<kBlockSize> builder;
+  for (auto _ : state) {
+    auto sizes = builder.PartitionRangeKernel(
+        Span<RowIndexT const>{ridx}, Span<RowIndexT>{left}, Span<RowIndexT>{right},
+        [&](RowIndexT rid) { return go_left[rid] != 0; });
+    benchmark::DoNotOptimize(sizes);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n_rows);
+}
+
+BENCHMARK(BM_PartitionRangeKernel)
+    ->ArgNames({"rows", "left_pct"})
+    ->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {10, 50, 90}});
+}  // anonymous namespace
+}  // namespace xgboost::common
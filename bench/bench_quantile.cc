@@ -0,0 +1,72 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstddef>  // for size_t
+#include <random>   // for mt19937, uniform_real_distribution
+#include <vector>   // for vector
+
+#include "../src/common/quantile.h"  // for WQuantileSketch
+
+namespace xgboost::common {
+namespace {
+using WQSketch = WQuantileSketch<float, float>;
+constexpr double kEps = 1.0 / 256;  // matches a 256-bin sketch
+
+// Measures the streaming push path: queue fill, MakeSummary, and the prune/merge
+// cascade through the levels.
+void BM_SketchPush(benchmark::State& state) {
+  auto n = static_cast<std::size_t>(state.range(0));
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+  std::vector<float> values(n);
+  for (auto& v : values) {
+    v = dist(rng);
+  }
+
+  for (auto _ : state) {
+    WQSketch sketch;
+    sketch.Init(n, kEps);
+    for (auto v : values) {
+      sketch.Push(v, 1.0f);
+    }
+    WQSketch::SummaryContainer out;
+    sketch.GetSummary(&out);
+    benchmark::DoNotOptimize(out.data);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Measures combining two pruned summaries, the kernel behind distributed allreduce and
+// the per-thread sketch reduction.
+void BM_SketchMerge(benchmark::State& state) {
+  auto n = static_cast<std::size_t>(state.range(0));
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+
+  auto make_summary = [&](WQSketch::SummaryContainer* out) {
+    WQSketch sketch;
+    sketch.Init(n, kEps);
+    for (std::size_t i = 0; i < n; ++i) {
+      sketch.Push(dist(rng), 1.0f);
+    }
+    sketch.GetSummary(out);
+  };
+  WQSketch::SummaryContainer lhs, rhs;
+  make_summary(&lhs);
+  make_summary(&rhs);
+
+  for (auto _ : state) {
+    WQSketch::SummaryContainer combined;
+    combined.Reserve(lhs.size + rhs.size);
+    combined.SetCombine(lhs, rhs);
+    benchmark::DoNotOptimize(combined.data);
+  }
+  state.SetItemsProcessed(state.iterations() * (lhs.size + rhs.size));
+}
+
+BENCHMARK(BM_SketchPush)->ArgNames({"values"})->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_SketchMerge)->ArgNames({"values"})->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+}  // anonymous namespace
+}  // namespace xgboost::common
@@ -0,0 +1,50 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ *
+ * \brief Synthetic data generators shared by the microbenchmarks.  Sizes are taken from
+ *        the benchmark arguments so a single binary covers small cache-resident inputs
+ *        and larger memory-bound ones.
+ */
+#pragma once
+
+#include <xgboost/base.h>  // for GradientPair, bst_idx_t, bst_feature_t
+#include <xgboost/data.h>  // for DMatrix
+
+#include <cstdint>  // for uint64_t
+#include <limits>   // for numeric_limits
+#include <memory>   // for shared_ptr
+#include <random>   // for mt19937, uniform_real_distribution
+#include <vector>   // for vector
+
+#include "../src/data/adapter.h"  // for DenseAdapter
+
+namespace xgboost::bench {
+/**
+ * \brief Generate an in-core dense DMatrix with the given fraction of missing values.
+ */
+inline std::shared_ptr<DMatrix> MakeDenseDMatrix(bst_idx_t n_rows, bst_feature_t n_cols,
+                                                 float sparsity, std::uint64_t seed = 0) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+  auto missing = std::numeric_limits<float>::quiet_NaN();
+  std::vector<float> data(n_rows * n_cols);
+  for (auto& v : data) {
+    v = dist(rng) < sparsity ? missing : dist(rng);
+  }
+  data::DenseAdapter adapter{data.data(), n_rows, n_cols};
+  return std::shared_ptr<DMatrix>{DMatrix::Create(&adapter, missing, 1)};
+}
+
+/**
+ * \brief Generate random gradient pairs, one per sample.
+ */
+inline std::vector<GradientPair> MakeGradients(bst_idx_t n, std::uint64_t seed = 1) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist{-1.0f, 1.0f};
+  std::vector<GradientPair> gpair(n);
+  for (auto& g : gpair) {
+    g = GradientPair{dist(rng), std::abs(dist(rng)) + 0.1f};
+  }
+  return gpair;
+}
+}  // namespace xgboost::bench
@@ -109,6 +109,41 @@ XGB_DLL int XGBSetGlobalConfig(char const *config);
  */
 XGB_DLL int XGBGetGlobalConfig(char const **out_config);
 
+/*!
+ * \brief Get a JSON breakdown of the memory currently held by the major components.
+ *
+ *   The returned JSON object maps component names like `"GHistIndexMatrix"`,
+ *   `"ColumnMatrix"`, `"Histogram"` and `"SparsePageCache"` to the number of bytes they
+ *   currently occupy.  The `"device"` entry reports the bytes allocated through the
+ *   tracked device allocators, which are only counted when verbosity is at least debug.
+ *
+ * \param out_usage pointer to the returned JSON string.
+ *
+ * \return 0 for success, -1 for failure
+ *
+ * @since 2.2.0
+ */
+XGB_DLL int XGBGetMemoryUsage(char const **out_usage);
+
+/*!
+ * \brief Get a JSON summary of the data transfers between host and device.
+ *
+ *   The returned JSON object reports the number of copies and bytes moved in each
+ *   direction by the lazily synchronized vectors (`"h2d_count"`, `"h2d_bytes"`,
+ *   `"d2h_count"`, `"d2h_bytes"`), along with `"round_trips"`, the number of copies
+ *   that reversed the direction of the previous copy of the same vector.  A round trip
+ *   count growing with every iteration indicates the data ping-pongs between a GPU
+ *   producer and a CPU consumer.  All entries are 0 when XGBoost is compiled without
+ *   CUDA.
+ *
+ * \param out_stats pointer to the returned JSON string.
+ *
+ * \return 0 for success, -1 for failure
+ *
+ * @since 2.2.0
+ */
+XGB_DLL int XGBGetTransferStats(char const **out_stats);
+
 /**@}*/
 
 /**
@@ -625,6 +660,71 @@ XGB_DLL int XGProxyDMatrixSetDataCSR(DMatrixHandle handle, char const *indptr,
                                      char const *indices, char const *data,
                                      bst_ulong ncol);
 
+/** @brief Handle to a push-style DMatrix builder. */
+typedef void *DMatrixBuilderHandle;  // NOLINT(*)
+
+/**
+ * @brief Create a push-style builder for a `QuantileDMatrix`.
+ *
+ *   Instead of pulling whole batches through a data iterator with array-interface JSON,
+ *   the caller appends typed column chunks that alias its own memory, commits them as
+ *   batches, then finalizes.  The appended memory must stay valid until
+ *   @ref XGDMatrixBuilderFinalize returns.  This is an experimental API.
+ *
+ * @param config JSON encoded configuration, accepting `missing`, `nthread` and
+ *               `max_bin`, see @ref XGQuantileDMatrixCreateFromCallback for details.
+ * @param out    The created builder.
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGDMatrixBuilderCreate(char const *config, DMatrixBuilderHandle *out);
+
+/**
+ * @brief Append the next column of the batch under assembly.  Columns are positional,
+ *        the first appended column after create or commit is feature 0.
+ *
+ * @param handle An instance of the builder.
+ * @param type   Type of the column, 1: float32, 2: float64, 3: uint32, 4: uint64.
+ * @param data   Pointer to the column values, aliased, not copied.
+ * @param n      Number of values in the column.
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGDMatrixBuilderPushColumn(DMatrixBuilderHandle handle, int type, void const *data,
+                                       bst_ulong n);
+
+/**
+ * @brief Seal the batch under assembly.  All batches must share the same schema.
+ *
+ * @param handle An instance of the builder.
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGDMatrixBuilderCommitBatch(DMatrixBuilderHandle handle);
+
+/**
+ * @brief Construct the `QuantileDMatrix` from the committed batches and free the
+ *        builder.  The handle must not be used afterwards.
+ *
+ * @param handle An instance of the builder.
+ * @param ref    Handle to a `QuantileDMatrix` providing the quantile information, used
+ *               for validation datasets, can be NULL.
+ * @param out    The created `QuantileDMatrix`.
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGDMatrixBuilderFinalize(DMatrixBuilderHandle handle, DMatrixHandle ref,
+                                     DMatrixHandle *out);
+
+/**
+ * @brief Free a builder without constructing a `DMatrix`.
+ *
+ * @param handle An instance of the builder.
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGDMatrixBuilderFree(DMatrixBuilderHandle handle);
+
 /** @} */  // End of Streaming
 
 /*!
@@ -720,8 +820,8 @@ XGB_DLL int XGDMatrixSetUIntInfo(DMatrixHandle handle, const char *field, const
  *   char const* feat_names [] {"feat_0", "feat_1"};
  *   XGDMatrixSetStrFeatureInfo(handle, "feature_name", feat_names, 2);
  *
- *   // i for integer, q for quantitive, c for categorical.  Similarly "int" and "float"
- *   // are also recognized.
+ *   // i for integer, q for quantitive, c for categorical, b for pre-binned integer.
+ *   // Similarly "int" and "float" are also recognized.
  *   char const* feat_types [] {"i", "q"};
  *   XGDMatrixSetStrFeatureInfo(handle, "feature_type", feat_types, 2);
  *
@@ -880,6 +980,67 @@ XGB_DLL int XGDMatrixGetDataAsCSR(DMatrixHandle const handle, char const *config
 XGB_DLL int XGDMatrixGetQuantileCut(DMatrixHandle const handle, char const *config,
                                      char const **out_indptr, char const **out_data);
 
+/**
+ * @brief Export the quantile cuts along with the feature types as a JSON document that
+ *        can be imported by \ref XGDMatrixCreateFromQuantileCut.
+ *
+ * @since 2.2.0
+ *
+ * @param handle the handle to the DMatrix
+ * @param config JSON configuration string. At the moment it should be an empty document,
+ *               preserved for future use.
+ * @param out    The exported cuts as a JSON encoded string.
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGDMatrixExportQuantileCut(DMatrixHandle const handle, char const *config,
+                                       char const **out);
+
+/**
+ * @brief Create a DMatrix carrying only pre-computed quantile cuts exported by \ref
+ *        XGDMatrixExportQuantileCut.
+ *
+ *   The result has no rows and cannot be used for training or prediction.  Its sole
+ *   purpose is to serve as the reference DMatrix of \ref
+ *   XGQuantileDMatrixCreateFromCallback or \ref XGExtMemQuantileDMatrixCreateFromCallback
+ *   so that construction reuses the imported cuts instead of running a new sketch.
+ *
+ * @since 2.2.0
+ *
+ * @param cuts   The JSON document produced by \ref XGDMatrixExportQuantileCut.
+ * @param config JSON encoded parameters for the DMatrix construction.  Accepted fields are:
+ *   - max_bin (optional): Maximum number of bins, must match the value used for
+ *     training.  Default to 256.
+ * @param out    The created DMatrix.
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGDMatrixCreateFromQuantileCut(char const *cuts, char const *config,
+                                           DMatrixHandle *out);
+
+/**
+ * @brief Reuse the quantile cuts of a reference DMatrix for \p handle.
+ *
+ *   Quantizes \p handle against the cuts of \p ref instead of running a new sketch when
+ *   the histogram index is first requested.  This makes swapping the training data on a
+ *   live booster cheap, e.g. when advancing through the stages of a data curriculum:
+ *   create the DMatrix of the next stage, reuse the cuts of the previous stage, and keep
+ *   calling \ref XGBoosterUpdateOneIter on the same booster with the new matrix.  If
+ *   \p handle already carries an index built from equal cuts, this is a no-op.
+ *
+ *   The reference must have its cuts generated already, either by being a
+ *   `QuantileDMatrix` or by having been used for training with the `hist` or `approx`
+ *   tree method on the CPU.
+ *
+ * @since 2.2.0
+ *
+ * @param handle the handle to the DMatrix to be quantized.
+ * @param ref    the handle to the DMatrix carrying the cuts.
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGDMatrixReuseQuantileCut(DMatrixHandle handle, DMatrixHandle ref);
+
 /** @} */  // End of DMatrix
 
 /**
@@ -951,6 +1112,24 @@ XGB_DLL int XGBoosterSetParam(BoosterHandle handle,
  * @example c-api-demo.c
  */
 
+/**
+ * @brief Set multiple parameters at once from a JSON object.
+ *
+ *   Equivalent to calling \ref XGBoosterSetParam for every name/value pair, but crosses
+ *   the C API boundary only once, which matters when a model is initialized with many
+ *   parameters.
+ *
+ * @since 2.2.0
+ *
+ * @param handle handle
+ * @param json_parameters JSON object mapping parameter names to values.  String values
+ *        are applied verbatim, other value types keep their JSON representation, and
+ *        null values are skipped.
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGBoosterSetParams(BoosterHandle handle, char const *json_parameters);
+
 /*!
  * \brief get number of features
  * \param handle Handle to booster.
@@ -974,6 +1153,41 @@ XGB_DLL int XGBoosterUpdateOneIter(BoosterHandle handle, int iter, DMatrixHandle
  * @example c-api-demo.c
  */
 
+/**
+ * @brief Request cooperative cancellation of training.
+ *
+ *   The flag is process-wide and can be set from any thread while another thread is
+ *   inside \ref XGBoosterUpdateOneIter.  Training checks it at phase boundaries --
+ *   before starting a boosting iteration and between the trees of a forest -- and
+ *   returns with the model in a valid state, so the caller can save a checkpoint and
+ *   exit instead of losing progress to a kill signal.  Pass 0 to clear the flag before
+ *   resuming training.
+ *
+ * \param cancel non-zero to request cancellation, 0 to clear the request
+ * \return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGBTrainingCancel(int cancel);
+
+/**
+ * @brief Transfer the booster's cached predictions from one DMatrix to another.
+ *
+ *   When a training matrix is rebuilt (same rows, new handle), the prediction cache keyed
+ *   by the old handle is lost and the next call to \ref XGBoosterUpdateOneIter re-predicts
+ *   the full ensemble before training resumes.  Calling this function transfers the cache
+ *   to the new handle, restoring the incremental fast path.
+ *
+ *   The caller promises that both matrices hold exactly the same rows in the same order;
+ *   this is verified only up to the row count.  Call it before freeing \p old_dtrain.
+ *
+ * @param handle     handle
+ * @param old_dtrain the training data being replaced
+ * @param new_dtrain the replacement training data
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGBoosterTransferPredictionCache(BoosterHandle handle, DMatrixHandle old_dtrain,
+                                             DMatrixHandle new_dtrain);
+
 /**
  * @deprecated since 2.1.0
  */
@@ -1149,6 +1363,32 @@ XGB_DLL int XGBoosterPredictFromDense(BoosterHandle handle, char const *values,
  * @example inference.c
  */
 
+/**
+ * \brief Inplace prediction from CPU dense matrix with multiple boosters.
+ *
+ * Scores the same input with each booster in turn while sharing a single proxy DMatrix,
+ * which keeps the feature block hot in cache between models.  Useful for serving
+ * champion/challenger ensembles where several boosters consume one feature batch.  All
+ * boosters must be trained on the same feature space and produce predictions of the same
+ * shape.
+ *
+ * \param handles       Array of booster handles.
+ * \param n_boosters    Number of boosters in \p handles.
+ * \param values        JSON encoded __array_interface__ to values.
+ * \param config        See \ref XGBoosterPredictFromDense for more info.  The same
+ *                      configuration is applied to every booster.
+ * \param out_shape     Shape of the per-booster prediction (copy before use).
+ * \param out_dim       Dimension of the per-booster prediction.
+ * \param out_result    Caller-allocated array of \p n_boosters pointers, filled with the
+ *                      prediction buffer of each booster (copy before use).
+ *
+ * \return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGBoosterPredictFromDenseMany(BoosterHandle handles[], bst_ulong n_boosters,
+                                          char const *values, char const *config,
+                                          bst_ulong const **out_shape, bst_ulong *out_dim,
+                                          const float **out_result);
+
 /**
  * @brief Inplace prediction from CPU columnar data. (Table)
  *
@@ -1202,6 +1442,114 @@ XGB_DLL int XGBoosterPredictFromCSR(BoosterHandle handle, char const *indptr, ch
                                     DMatrixHandle m, bst_ulong const **out_shape,
                                     bst_ulong *out_dim, const float **out_result);
 
+/*! \brief handle to a reusable inplace prediction session */
+typedef void *PredictSessionHandle;  // NOLINT(*)
+
+/**
+ * \brief Create a reusable session for repeated inplace predictions.
+ *
+ * A session keeps the proxy DMatrix, the parsed configuration and the output buffer
+ * alive across calls, so scoring many small batches through \ref
+ * XGBoosterPredictSessionFromDense does not pay the per-call setup of \ref
+ * XGBoosterPredictFromDense.  A session borrows the booster handle, which must outlive
+ * it, and must not be shared between threads; create one session per serving thread.
+ *
+ * \param handle Booster handle.
+ * \param config See \ref XGBoosterPredictFromDMatrix for more info.
+ *   Additional fields for inplace prediction are:
+ *     - "missing": float
+ * \param out    Created session handle.
+ *
+ * \return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGBoosterPredictSessionCreate(BoosterHandle handle, char const *config,
+                                          PredictSessionHandle *out);
+
+/*!
+ * \brief Free a prediction session created by \ref XGBoosterPredictSessionCreate.
+ *
+ * \param handle Session handle.
+ *
+ * \return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGBoosterPredictSessionFree(PredictSessionHandle handle);
+
+/**
+ * \brief Inplace prediction from CPU dense matrix through a session.
+ *
+ * \param handle        Session handle.
+ * \param values        JSON encoded __array_interface__ to values.
+ *
+ * \param out_shape     See \ref XGBoosterPredictFromDMatrix for more info.
+ * \param out_dim       See \ref XGBoosterPredictFromDMatrix for more info.
+ * \param out_result    Buffer storing prediction value, valid until the next call on
+ *                      this session (copy before use).
+ *
+ * \return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGBoosterPredictSessionFromDense(PredictSessionHandle handle, char const *values,
+                                             bst_ulong const **out_shape, bst_ulong *out_dim,
+                                             const float **out_result);
+
+/**
+ * \brief Inplace prediction from CPU columnar data through a session.
+ *
+ * \param handle        Session handle.
+ * \param values        An JSON array of __array_interface__ for each column.
+ *
+ * \param out_shape     See \ref XGBoosterPredictFromDMatrix for more info.
+ * \param out_dim       See \ref XGBoosterPredictFromDMatrix for more info.
+ * \param out_result    Buffer storing prediction value, valid until the next call on
+ *                      this session (copy before use).
+ *
+ * \return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGBoosterPredictSessionFromColumnar(PredictSessionHandle handle, char const *values,
+                                                bst_ulong const **out_shape, bst_ulong *out_dim,
+                                                const float **out_result);
+
+/*!
+ * \brief Callback for streaming prediction, called once per data page.
+ *
+ * \param offset    Row offset of the block within the full data.
+ * \param n_rows    Number of rows in the block.
+ * \param result    Prediction values for the block, valid only for the duration of the
+ *                  call (copy before returning).
+ * \param len       Length of \p result.
+ * \param user_data The pointer passed to \ref XGBoosterPredictFromDMatrixStreamed.
+ *
+ * \return 0 to continue, non-zero to stop the iteration early.
+ */
+typedef int XGBoosterPredictStreamCallback(bst_ulong offset, bst_ulong n_rows,  // NOLINT(*)
+                                           float const *result, bst_ulong len, void *user_data);
+
+/**
+ * \brief Run prediction over a DMatrix, delivering the output page by page.
+ *
+ * With an external-memory DMatrix each sparse page is scored as the prefetcher delivers
+ * it and the result is handed to \p callback before the next page is touched, so the
+ * peak memory is bounded by a single page and its predictions regardless of the total
+ * data size.  Useful for score-to-storage pipelines where the full output would not fit
+ * in memory.  An in-memory DMatrix works as well and produces a single callback.
+ *
+ * Only normal value and margin predictions can be streamed ("type" 0 and 1), and the
+ * base margin of the input is not supported.
+ *
+ * \param handle    Booster handle.
+ * \param dmat      DMatrix handle.
+ * \param config    See \ref XGBoosterPredictFromDMatrix for more info.
+ * \param callback  Called once per page with the predictions for its rows.
+ * \param user_data Opaque pointer forwarded to the callback.
+ *
+ * \return 0 when success, -1 when failure happens
+ *
+ * @since 2.2.0
+ */
+XGB_DLL int XGBoosterPredictFromDMatrixStreamed(BoosterHandle handle, DMatrixHandle dmat,
+                                                char const *config,
+                                                XGBoosterPredictStreamCallback *callback,
+                                                void *user_data);
+
 /**
  * \brief Inplace prediction from CUDA Dense matrix (cupy in Python).
  *
@@ -1298,6 +1646,37 @@ XGB_DLL int XGBoosterLoadModel(BoosterHandle handle,
  */
 XGB_DLL int XGBoosterSaveModel(BoosterHandle handle,
                                const char *fname);
+/**
+ * @brief Save model into a file on a background thread.
+ *
+ *   The tree model is snapshotted with a copy-on-write scheme before this function
+ *   returns, so the caller can keep training (e.g. \ref XGBoosterUpdateOneIter) while
+ *   serialization and the file write run in the background.  Only one save can be in
+ *   flight per booster; a new call waits for the previous write to finish first.  Use
+ *   \ref XGBoosterFinishSaveModelAsync to wait for the write and observe any error it
+ *   raised.  The old custom binary format (`deprecated` extension) is not supported.
+ *
+ * @since 2.2.0
+ *
+ * @param handle handle
+ * @param fname File URI or file name. The string must be UTF-8 encoded.
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGBoosterSaveModelAsync(BoosterHandle handle, const char *fname);
+/**
+ * @brief Wait for an in-flight \ref XGBoosterSaveModelAsync to finish.
+ *
+ *   Errors raised by the background write are reported here.  No-op if there's no
+ *   pending save.
+ *
+ * @since 2.2.0
+ *
+ * @param handle handle
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGBoosterFinishSaveModelAsync(BoosterHandle handle);
 /*!
  * \brief load model from in memory buffer
  *
@@ -1353,6 +1732,22 @@ XGB_DLL int XGBoosterSerializeToBuffer(BoosterHandle handle, bst_ulong *out_len,
 XGB_DLL int XGBoosterUnserializeFromBuffer(BoosterHandle handle,
                                            const void *buf, bst_ulong len);
 
+/*!
+ * \brief Replicate the booster state from one worker to all others.
+ *
+ *   Broadcasts the memory snapshot of the booster on `root` (see \ref
+ *   XGBoosterSerializeToBuffer) and loads it into every other worker.  Used to bring a
+ *   worker that re-joined the communicator group up to date without a checkpoint file:
+ *   after re-initializing the group with \ref XGCommunicatorInit, the surviving workers
+ *   and the re-joined worker call this collectively and training can resume.  A no-op
+ *   when XGBoost is not running in a distributed environment.
+ *
+ * \param handle handle
+ * \param root rank of the worker holding the authoritative state
+ * \return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGBoosterBroadcastModel(BoosterHandle handle, int root);
+
 /*!
  * \brief Save XGBoost's internal configuration into a JSON document.  Currently the
  *        support is experimental, function signature may change in the future without
@@ -1377,6 +1772,28 @@ XGB_DLL int XGBoosterSaveJsonConfig(BoosterHandle handle, bst_ulong *out_len,
  * \return 0 when success, -1 when failure happens
  */
 XGB_DLL int XGBoosterLoadJsonConfig(BoosterHandle handle, char const *config);
+
+/*!
+ * \brief Query the accumulated per-phase performance statistics as a JSON document.
+ *        Currently the support is experimental, function signature may change in the
+ *        future without notice.
+ *
+ *        Collection is disabled by default; pass `{"enable": true}` to turn it on, after
+ *        which internal monitors accumulate elapsed time and call counts per phase.  The
+ *        returned document is keyed by monitor label, then phase name, with `count` and
+ *        `elapsed_us` fields.  The statistics are process-wide.
+ *
+ * \param handle handle to Booster object, used to manage the returned string.
+ * \param config string representation of a JSON document accepting the optional boolean
+ *               fields `enable` and `reset`.
+ * \param out_len length of output string
+ * \param out_str A valid pointer to array of characters.  The characters array is
+ *                allocated and managed by XGBoost, while pointer to that array needs to
+ *                be managed by caller.
+ * \return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGBoosterGetPerfStats(BoosterHandle handle, char const *config, bst_ulong *out_len,
+                                  char const **out_str);
 /**@}*/  // End of Serialization
 
 /*!
@@ -1760,6 +2177,20 @@ XGB_DLL int XGCommunicatorPrint(char const *message);
  */
 XGB_DLL int XGCommunicatorGetProcessorName(const char** name_str);
 
+/**
+ * @brief Dump tracing statistics of the collective event loop as a JSON document.
+ *
+ * Each worker keeps a ring buffer of recently finished socket operations and reports per
+ * op type the count, the bytes moved, and p50/p99 of the queue wait and wire time in
+ * microseconds.  When the communicator is distributed this is a collective call: every
+ * worker must enter it, and rank 0 additionally receives the summaries of all workers
+ * under the "workers" key.
+ *
+ * @param json_str Pointer to the received JSON string, valid until the next C API call.
+ * @return 0 for success, -1 for failure.
+ */
+XGB_DLL int XGCommunicatorGetStats(char const **json_str);
+
 /**
  * @brief Broadcast a memory region to all others from root. This function is NOT
  *        thread-safe.
@@ -8,8 +8,9 @@
 
 #include <cstddef>            // for size_t
 #include <memory>             // for weak_ptr, shared_ptr, make_shared
-#include <mutex>              // for mutex, lock_guard
+#include <mutex>              // for unique_lock
 #include <queue>              // for queue
+#include <shared_mutex>       // for shared_mutex, shared_lock
 #include <thread>             // for thread
 #include <unordered_map>      // for unordered_map
 #include <utility>            // for move
@@ -20,6 +21,12 @@ class DMatrix;
 /**
  * \brief Thread-aware FIFO cache for DMatrix related data.
  *
+ * Lookups of live entries only take a shared lock, so concurrent predictions on cached
+ * data don't serialize on the cache bookkeeping.  Insertion and eviction are exclusive.
+ * Expired entries are reclaimed lazily: the FIFO head is trimmed on insertion and a
+ * full sweep runs once per generation (one generation being `cache_size` insertions),
+ * so a single lookup never walks the whole cache.
+ *
  * \tparam CacheT The type that needs to be cached.
  */
 template <typename CacheT>
@@ -40,7 +47,7 @@ class DMatrixCache {
   static constexpr std::size_t DefaultSize() { return 32; }
 
  private:
-  mutable std::mutex lock_;
+  mutable std::shared_mutex lock_;
 
  protected:
   struct Key {
@@ -65,6 +72,10 @@ class DMatrixCache {
   std::unordered_map<Key, Item, Hash> container_;
   std::queue<Key> queue_;
   std::size_t max_size_;
+  // Number of insertions so far and the insertion count at the last full sweep, used to
+  // amortize the reclamation of expired entries.
+  std::size_t gen_{0};
+  std::size_t last_sweep_{0};
 
   void CheckConsistent() const { CHECK_EQ(queue_.size(), container_.size()); }
 
@@ -125,6 +136,8 @@ class DMatrixCache {
     std::swap(this->container_, that.container_);
     std::swap(this->queue_, that.queue_);
     std::swap(this->max_size_, that.max_size_);
+    std::swap(this->gen_, that.gen_);
+    std::swap(this->last_sweep_, that.last_sweep_);
     return *this;
   }
 
@@ -144,23 +157,62 @@ class DMatrixCache {
   template <typename... Args>
   std::shared_ptr<CacheT> CacheItem(std::shared_ptr<DMatrix> m, Args const&... args) {
     CHECK(m);
-    std::lock_guard<std::mutex> guard{lock_};
+    auto key = Key{m.get(), std::this_thread::get_id()};
+    {
+      // Fast path for when the item is already cached, shared with other readers.
+      std::shared_lock<std::shared_mutex> guard{lock_};
+      auto it = container_.find(key);
+      if (it != container_.cend() && !it->second.ref.expired()) {
+        return it->second.value;
+      }
+    }
+    std::unique_lock<std::shared_mutex> guard{lock_};
 
-    this->ClearExpired();
+    // Amortized reclamation.  Trim the expired entries at the FIFO head, and walk the
+    // whole cache only once per generation or when it's at capacity, instead of on
+    // every miss.
+    while (!queue_.empty()) {
+      auto it = container_.find(queue_.front());
+      CHECK(it != container_.cend());
+      if (!it->second.ref.expired()) {
+        break;
+      }
+      container_.erase(it);
+      queue_.pop();
+    }
+    if (++gen_ - last_sweep_ >= max_size_ || container_.size() >= max_size_) {
+      this->ClearExpired();
+      last_sweep_ = gen_;
+    }
     if (container_.size() >= max_size_) {
       this->ClearExcess();
     }
     // after clear, cache size < max_size
     CHECK_LT(container_.size(), max_size_);
-    auto key = Key{m.get(), std::this_thread::get_id()};
     auto it = container_.find(key);
     if (it == container_.cend()) {
       // after the new DMatrix, cache size is at most max_size
       container_.emplace(key, Item{m, std::make_shared<CacheT>(args...)});
       queue_.emplace(key);
+    } else if (it->second.ref.expired()) {
+      // The address of an expired DMatrix was recycled by the allocator before any
+      // sweep dropped the stale entry.  Renew it in place, keeping the FIFO position.
+      it->second = Item{m, std::make_shared<CacheT>(args...)};
     }
     return container_.at(key).value;
   }
+  /**
+   * \brief Drop all expired entries.
+   *
+   *   Reclamation is otherwise amortized over insertions.  Long-lived processes that
+   *   churn through many short-lived DMatrix objects can call this periodically from a
+   *   maintenance thread to bound the memory held by expired entries.
+   */
+  void SweepExpired() {
+    std::unique_lock<std::shared_mutex> guard{lock_};
+    this->ClearExpired();
+    last_sweep_ = gen_;
+  }
   /**
    * \brief Re-initialize the item in cache.
    *
@@ -172,7 +224,7 @@ class DMatrixCache {
    */
   template <typename... Args>
   std::shared_ptr<CacheT> ResetItem(std::shared_ptr<DMatrix> m, Args const&... args) {
-    std::lock_guard<std::mutex> guard{lock_};
+    std::unique_lock<std::shared_mutex> guard{lock_};
     CheckConsistent();
     auto key = Key{m.get(), std::this_thread::get_id()};
     auto it = container_.find(key);
@@ -181,19 +233,54 @@ class DMatrixCache {
     CheckConsistent();
     return it->second.value;
   }
+  /**
+   * \brief Transfer the cached item of one DMatrix to another.
+   *
+   *   Used to warm-start a rebuilt DMatrix from the cache of the matrix it replaces.
+   *   The caller promises the two matrices hold identical rows; only the address of the
+   *   old matrix is inspected, so it may already be freed.  The old entry shares the
+   *   value with the new one and expires together with the old DMatrix.
+   *
+   * \param old_m Address of the matrix being replaced.
+   * \param new_m The replacement matrix.
+   *
+   * \return The transferred item, or nullptr when the old DMatrix has no cache entry.
+   */
+  std::shared_ptr<CacheT> TransferItem(DMatrix const* old_m, std::shared_ptr<DMatrix> new_m) {
+    CHECK(new_m);
+    std::unique_lock<std::shared_mutex> guard{lock_};
+    this->CheckConsistent();
+    auto old_key = Key{old_m, std::this_thread::get_id()};
+    auto it = container_.find(old_key);
+    if (it == container_.cend()) {
+      return nullptr;
+    }
+    auto value = it->second.value;
+    auto new_key = Key{new_m.get(), std::this_thread::get_id()};
+    auto new_it = container_.find(new_key);
+    if (new_it == container_.cend()) {
+      // May transiently exceed the capacity, the next insertion evicts.
+      container_.emplace(new_key, Item{new_m, value});
+      queue_.emplace(new_key);
+    } else {
+      new_it->second = Item{new_m, value};
+    }
+    this->CheckConsistent();
+    return value;
+  }
   /**
    * \brief Get a const reference to the underlying hash map.  Clear expired caches before
    *        returning.
    */
   decltype(container_) const& Container() {
-    std::lock_guard<std::mutex> guard{lock_};
+    std::unique_lock<std::shared_mutex> guard{lock_};
 
     this->ClearExpired();
     return container_;
   }
 
   std::shared_ptr<CacheT> Entry(DMatrix const* m) const {
-    std::lock_guard<std::mutex> guard{lock_};
+    std::shared_lock<std::shared_mutex> guard{lock_};
     auto key = Key{m, std::this_thread::get_id()};
     CHECK(container_.find(key) != container_.cend());
     CHECK(!container_.at(key).ref.expired());
@@ -18,6 +18,10 @@ namespace xgboost {
 
 struct CUDAContext;
 
+namespace common {
+class ScratchPool;
+}  // namespace common
+
 // symbolic names
 struct DeviceSym {
   static auto constexpr CPU() { return "cpu"; }
@@ -218,6 +222,10 @@ struct Context : public XGBoostParameter<Context> {
    * @brief Get a CUDA device context for allocator and stream.
    */
   [[nodiscard]] CUDAContext const* CUDACtx() const;
+  /**
+   * @brief Get the pool of reusable scratch buffers for short-lived temporaries.
+   */
+  [[nodiscard]] common::ScratchPool* Scratch() const;
 
   /**
    * @brief Make a CUDA context based on the current context.
@@ -307,6 +315,8 @@ struct Context : public XGBoostParameter<Context> {
   // shared_ptr is used instead of unique_ptr as with unique_ptr it's difficult to define
   // p_impl while trying to hide CUDA code from the host compiler.
   mutable std::shared_ptr<CUDAContext> cuctx_;
+  // Lazily created scratch-buffer pool, shared between copies made after the first use.
+  mutable std::shared_ptr<common::ScratchPool> scratch_;
   // cached value for CFS CPU limit. (used in containerized env)
   std::int32_t cfs_cpu_count_;  // NOLINT
 };
@@ -20,6 +20,7 @@
 #include <cstdint>  // for int32_t, uint8_t
 #include <limits>
 #include <memory>
+#include <set>  // for set
 #include <string>
 #include <utility>
 #include <vector>
@@ -29,6 +30,10 @@ namespace xgboost {
 class DMatrix;
 struct Context;
 
+namespace data {
+class CatDictionary;
+}  // namespace data
+
 /*! \brief data type accepted by xgboost interface */
 enum class DataType : uint8_t {
   kFloat32 = 1,
@@ -38,7 +43,14 @@ enum class DataType : uint8_t {
   kStr = 5
 };
 
-enum class FeatureType : uint8_t { kNumerical = 0, kCategorical = 1 };
+/**
+ * @brief Type of a feature.
+ *
+ * Pre-binned features hold small non-negative integers that are already discretized by
+ * the user (e.g. hour-of-day).  They are treated as numerical everywhere except during
+ * quantile sketching, where identity cuts are used instead of running a sketch.
+ */
+enum class FeatureType : uint8_t { kNumerical = 0, kCategorical = 1, kPreBinned = 2 };
 
 enum class DataSplitMode : int { kRow = 0, kCol = 1 };
 
@@ -99,6 +111,12 @@ class MetaInfo {
    *        selected when using column sampling.
    */
   HostDeviceVector<float> feature_weights;
+  /**
+   * \brief Optional dictionary mapping raw category keys to the ordinal codes stored in
+   *        the data.  Shared between batches and slices so every part of the matrix is
+   *        encoded with the same mapping.  Not serialized.
+   */
+  std::shared_ptr<data::CatDictionary> cat_dict;
 
   /*! \brief default constructor */
   MetaInfo()  = default;
@@ -133,6 +151,14 @@ class MetaInfo {
   inline bst_float GetWeight(size_t i) const {
     return weights_.Size() != 0 ?  weights_.HostVector()[i] : 1.0f;
   }
+  /**
+   * @brief Whether the sample weights are uniform, i.e. empty or one repeated value.
+   *
+   * Weights are constant across boosting iterations, so objectives use this to collapse
+   * the per-element weight gather into a single scalar.  The result is cached and
+   * dropped whenever the weights are modified.
+   */
+  [[nodiscard]] bool IsUniformWeights() const;
   /*! \brief get sorted indexes (argsort) of labels by absolute value (used by cox loss) */
   const std::vector<size_t>& LabelAbsSort(Context const* ctx) const;
   /*! \brief clear all the information */
@@ -209,6 +235,15 @@ class MetaInfo {
    * @brief Flag for whether the DMatrix has categorical features.
    */
   bool HasCategorical() const { return has_categorical_; }
+  /**
+   * @brief Check whether a named validation pass has already accepted the current labels.
+   *
+   * Objectives use this to skip re-scanning the labels on every boosting round.  The
+   * flags are dropped whenever the labels are modified.
+   */
+  bool LabelsValidatedBy(char const* name) const;
+  /** @brief Record that a named validation pass accepted the current labels. */
+  void SetLabelsValidatedBy(char const* name) const;
 
  private:
   void SetInfoFromHost(Context const* ctx, StringView key, Json arr);
@@ -216,6 +251,10 @@ class MetaInfo {
 
   /*! \brief argsort of labels */
   mutable std::vector<size_t> label_order_cache_;
+  /*! \brief whether the weights are a single repeated value, -1 when not yet checked */
+  mutable std::int8_t uniform_weight_cache_{-1};
+  /*! \brief names of the validation passes that accepted the current labels */
+  mutable std::set<std::string, std::less<>> label_validated_cache_;
   bool has_categorical_{false};
 };
 
@@ -394,6 +433,12 @@ class SparsePage {
   }
 
   [[nodiscard]] SparsePage GetTranspose(int num_columns, int32_t n_threads) const;
+  /**
+   * \brief Transpose only the selected columns.  The result still spans `num_columns`
+   *        columns so absolute feature indices stay valid; unselected columns are empty.
+   */
+  [[nodiscard]] SparsePage GetTranspose(int num_columns, int32_t n_threads,
+                                        common::Span<bst_feature_t const> selected) const;
 
   /**
    * \brief Sort the column index.
@@ -410,6 +455,15 @@ class SparsePage {
 
   void SortRows(int32_t n_threads);
 
+  /**
+   * \brief Randomly permute the rows within the page.
+   *
+   *   The permutation is by storage position, `base_rowid` is left untouched.  Callers
+   *   must not rely on the alignment between row positions and external meta info
+   *   afterwards.
+   */
+  void ShuffleRows(std::uint64_t seed, int32_t n_threads);
+
   /**
    * \brief Pushes external data batch onto this page
    *
@@ -532,16 +586,28 @@ struct ExtMemConfig {
   std::int64_t max_num_device_pages{0};
   // The number of CPU threads.
   std::int32_t n_threads{0};
+  // Number of pages to read ahead of the consumer, 0 for the default look-ahead.
+  std::int32_t n_prefetch_batches{0};
+  // Whether the on-disk cache should be kept and described by a manifest for reuse by a
+  // later process.
+  bool persist_cache{false};
+  // Seed for the page-level pseudo-shuffle of row pages, 0 keeps the deterministic
+  // order.
+  std::uint64_t shuffle_seed{0};
 
   ExtMemConfig() = default;
   ExtMemConfig(std::string cache, bool on_host, std::int64_t min_cache, float missing,
-               std::int64_t max_num_d, std::int32_t n_threads)
+               std::int64_t max_num_d, std::int32_t n_threads, std::int32_t n_prefetch_batches,
+               bool persist_cache, std::uint64_t shuffle_seed = 0)
       : cache{std::move(cache)},
         on_host{on_host},
         min_cache_page_bytes{min_cache},
         missing{missing},
         max_num_device_pages{max_num_d},
-        n_threads{n_threads} {}
+        n_threads{n_threads},
+        n_prefetch_batches{n_prefetch_batches},
+        persist_cache{persist_cache},
+        shuffle_seed{shuffle_seed} {}
 };
 
 /**
@@ -581,6 +647,12 @@ class DMatrix {
   BatchSet<T> GetBatches(Context const* ctx);
   template <typename T>
   BatchSet<T> GetBatches(Context const* ctx, const BatchParam& param);
+  /**
+   * @brief Gets batches restricted to a subset of features.  Implementations are free to
+   *        return all columns; callers must treat the subset as a hint.
+   */
+  template <typename T>
+  BatchSet<T> GetBatches(Context const* ctx, std::vector<bst_feature_t> const& selected);
   template <typename T>
   [[nodiscard]] bool PageExists() const;
 
@@ -702,6 +774,15 @@ class DMatrix {
   virtual BatchSet<SparsePage> GetRowBatches() = 0;
   virtual BatchSet<CSCPage> GetColumnBatches(Context const* ctx) = 0;
   virtual BatchSet<SortedCSCPage> GetSortedColumnBatches(Context const* ctx) = 0;
+  /**
+   * @brief Sorted column batches restricted to a subset of features, used by the exact
+   *        tree method where column sampling touches only a few features.  The default
+   *        ignores the subset and returns the full transpose.
+   */
+  virtual BatchSet<SortedCSCPage> GetSortedColumnBatches(Context const* ctx,
+                                                         std::vector<bst_feature_t> const&) {
+    return this->GetSortedColumnBatches(ctx);
+  }
   virtual BatchSet<EllpackPage> GetEllpackBatches(Context const* ctx, BatchParam const& param) = 0;
   virtual BatchSet<GHistIndexMatrix> GetGradientIndex(Context const* ctx,
                                                       BatchParam const& param) = 0;
@@ -747,6 +828,12 @@ inline BatchSet<SortedCSCPage> DMatrix::GetBatches(Context const* ctx) {
   return GetSortedColumnBatches(ctx);
 }
 
+template <>
+inline BatchSet<SortedCSCPage> DMatrix::GetBatches(Context const* ctx,
+                                                   std::vector<bst_feature_t> const& selected) {
+  return GetSortedColumnBatches(ctx, selected);
+}
+
 template <>
 inline BatchSet<EllpackPage> DMatrix::GetBatches(Context const* ctx, BatchParam const& param) {
   return GetEllpackBatches(ctx, param);
@@ -70,6 +70,15 @@ class GradientBooster : public Model, public Configurable {
                      GradientBooster* /*out*/, bool* /*out_of_bound*/) const {
     LOG(FATAL) << "Slice is not supported by the current booster.";
   }
+  /**
+   * \brief Create a snapshot functor that serializes the model into JSON when invoked.
+   *
+   *   The returned functor owns everything it needs, so it can run on a background
+   *   thread while training proceeds.  The default implementation serializes eagerly on
+   *   the calling thread; boosters with copy-on-write model storage override this to
+   *   defer the expensive part.
+   */
+  [[nodiscard]] virtual std::function<void(Json*)> SaveModelSnapshot() const;
   /**
    * @brief Return number of boosted rounds.
    */
@@ -104,6 +113,25 @@ class GradientBooster : public Model, public Configurable {
   virtual void PredictBatch(DMatrix* dmat, PredictionCacheEntry* out_preds, bool training,
                             bst_layer_t begin, bst_layer_t end) = 0;
 
+  /**
+   * \brief Predict the full model and compute the objective gradient in one fused pass
+   *        during training, when both the objective and the configured predictor support
+   *        it.
+   *
+   * \param dmat      The training matrix.
+   * \param out_preds The prediction cache entry for the training matrix.
+   * \param obj       The objective function used for boosting.
+   * \param out_gpair The output gradient.
+   *
+   * \return True if the fused path ran.  When false, the caller must fall back to
+   *         PredictBatch followed by ObjFunction::GetGradient.
+   */
+  [[nodiscard]] virtual bool FusedPredictGradient(DMatrix*, PredictionCacheEntry*,
+                                                  ObjFunction const&,
+                                                  linalg::Matrix<GradientPair>*) {
+    return false;
+  }
+
   /**
    * \brief Inplace prediction.
    *
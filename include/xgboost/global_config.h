@@ -16,6 +16,10 @@ namespace xgboost {
 struct GlobalConfiguration : public XGBoostParameter<GlobalConfiguration> {
   std::int32_t verbosity{1};
   bool use_rmm{false};
+  bool use_device_pool{false};
+  bool use_hugepage{false};
+  bool use_ellpack_tiles{false};
+  bool lazy_tree_load{false};
   DMLC_DECLARE_PARAMETER(GlobalConfiguration) {
     DMLC_DECLARE_FIELD(verbosity)
         .set_range(0, 3)
@@ -23,6 +27,30 @@ struct GlobalConfiguration : public XGBoostParameter<GlobalConfiguration> {
         .describe("Flag to print out detailed breakdown of runtime.");
     DMLC_DECLARE_FIELD(use_rmm).set_default(false).describe(
         "Whether to use RAPIDS Memory Manager to allocate GPU memory in XGBoost");
+    DMLC_DECLARE_FIELD(use_device_pool)
+        .set_default(false)
+        .describe(
+            "Whether to cache GPU memory allocations in a built-in pool when RMM is not "
+            "used.  Helps workloads that train many models back to back.  Ignored when "
+            "RMM is enabled.");
+    DMLC_DECLARE_FIELD(use_hugepage)
+        .set_default(false)
+        .describe(
+            "Whether to advise the kernel to back large host buffers like the gradient "
+            "index with transparent huge pages, reducing TLB misses during histogram "
+            "build.  Linux only, no-op elsewhere.");
+    DMLC_DECLARE_FIELD(use_ellpack_tiles)
+        .set_default(false)
+        .describe(
+            "Whether to store dense ELLPACK pages feature-major within row tiles so that "
+            "per-feature scans on the GPU read contiguous symbols.  Only affects pages "
+            "constructed while the flag is set.");
+    DMLC_DECLARE_FIELD(lazy_tree_load)
+        .set_default(false)
+        .describe(
+            "Whether loading a tree model defers per-tree deserialization until the "
+            "trees are first used, with a background thread completing the rest.  "
+            "Shortens the time to the first prediction for large models.");
   }
 };
 
@@ -9,6 +9,7 @@
 #include <xgboost/parameter.h>
 #include <xgboost/string_view.h>
 
+#include <cstddef>  // std::size_t
 #include <functional>
 #include <map>
 #include <string>
@@ -63,6 +64,18 @@ class Value {
 
   std::string TypeStr() const;
 
+  /**
+   * @brief Slab-pooled allocation for JSON value nodes.
+   *
+   *   Parsing a document creates a huge number of small value nodes.  They are carved
+   *   out of shared slab blocks by bumping a thread-local cursor instead of being
+   *   allocated individually.  A slab is reference counted and released once every
+   *   node inside it is destroyed, so nodes can outlive the document and be freed from
+   *   any thread in any order.
+   */
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr) noexcept;
+
  private:
   ValueKind kind_;
 };
@@ -8,6 +8,7 @@
 #include <xgboost/json.h>
 
 #include <cstdint>  // for int8_t
+#include <cstring>  // for memcpy
 #include <limits>
 #include <string>
 #include <utility>
@@ -89,6 +90,10 @@ class JsonReader {
     Error(msg);
   }
 
+  // Read a JSON string literal into an owned buffer.  Used for both string values and
+  // object keys, so that keys don't get wrapped in a temporary value node.
+  std::string ReadString();
+
   virtual Json ParseString();
   virtual Json ParseObject();
   virtual Json ParseArray();
@@ -195,6 +200,15 @@ inline T ToBigEndian(T v) {
   return v;
 }
 
+/**
+ * \brief In-place conversion between host and big endian byte order for numeric
+ *        buffers.  Large buffers are chunked across threads.
+ */
+void ToBigEndian(float* data, std::size_t n);
+void ToBigEndian(double* data, std::size_t n);
+void ToBigEndian(std::int32_t* data, std::size_t n);
+void ToBigEndian(std::int64_t* data, std::size_t n);
+
 /**
  * \brief Reader for UBJSON https://ubjson.org/
  */
@@ -219,10 +233,19 @@ class UBJReader : public JsonReader {
 
   template <typename TypedArray>
   auto ParseTypedArray(int64_t n) {
+    using T = typename TypedArray::Type;
     TypedArray results{static_cast<size_t>(n)};
-    for (int64_t i = 0; i < n; ++i) {
-      auto v = this->ReadPrimitive<typename TypedArray::Type>();
-      results.Set(i, v);
+    auto& vec = results.GetArray();
+    auto n_bytes = sizeof(T) * static_cast<std::size_t>(n);
+    if (XGBOOST_EXPECT(n_bytes > raw_str_.size() - cursor_.Pos(), false)) {
+      Error("Invalid typed array.");
+    }
+    // Decode the payload in bulk instead of streaming one primitive at a time; the
+    // byte order is then fixed up in place, chunked across threads for large arrays.
+    std::memcpy(vec.data(), raw_str_.c_str() + cursor_.Pos(), n_bytes);
+    cursor_.Forward(n_bytes);
+    if constexpr (sizeof(T) != 1) {
+      ToBigEndian(vec.data(), vec.size());
     }
     return Json{std::move(results)};
   }
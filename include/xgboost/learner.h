@@ -77,6 +77,20 @@ class Learner : public Model, public Configurable, public dmlc::Serializable {
    * \param train reference to the data matrix.
    */
   virtual void UpdateOneIter(std::int32_t iter, std::shared_ptr<DMatrix> train) = 0;
+  /**
+   * @brief Transfer cached predictions from an old DMatrix to its replacement.
+   *
+   *  When a training matrix is rebuilt with identical rows, the prediction cache keyed
+   *  by the old handle is lost and the next `UpdateOneIter` re-predicts the full
+   *  ensemble from the first tree.  Transferring the cache restores the incremental
+   *  fast path where only trees added since the last iteration are predicted.
+   *
+   * @param old    Address of the matrix being replaced.  Only the address is inspected,
+   *               the matrix may already be freed.
+   * @param p_fmat The replacement matrix.  The caller promises it holds the same rows in
+   *               the same order; this is verified only up to the row count.
+   */
+  virtual void TransferPredictionCache(DMatrix const* old, std::shared_ptr<DMatrix> p_fmat) = 0;
   /**
    * @brief Do customized gradient boosting with in_gpair.
    *
@@ -153,6 +167,25 @@ class Learner : public Model, public Configurable, public dmlc::Serializable {
 
   virtual void LoadModel(dmlc::Stream* fi) = 0;
   virtual void SaveModel(dmlc::Stream* fo) const = 0;
+  /**
+   * \brief Save the model to a file on a background thread.
+   *
+   *   The tree model is snapshotted on the calling thread with a copy-on-write scheme,
+   *   then serialization and the file write run in the background so training can
+   *   proceed immediately.  Only one snapshot can be in flight; a new call waits for
+   *   the previous write to finish first.  The format is chosen from the file
+   *   extension: JSON text for `json`, UBJSON otherwise.
+   *
+   * \param fname Output file name.
+   */
+  virtual void SaveModelAsync(std::string const& fname) = 0;
+  /**
+   * \brief Wait for an in-flight \ref SaveModelAsync to finish.
+   *
+   *   Errors raised by the background write are re-thrown here.  No-op if there's no
+   *   pending save.
+   */
+  virtual void FinishSaveModelAsync() = 0;
 
   /*!
    * \brief Set multiple parameters at once.
@@ -165,6 +198,11 @@ class Learner : public Model, public Configurable, public dmlc::Serializable {
    *
    *  The property will NOT be saved along with booster
    *
+   *  Setting a parameter to the value it already has is a no-op and does not trigger a
+   *  reconfiguration on the next call into the booster.  As a result, a booster that
+   *  only receives such no-op updates stays read-only and its prediction methods can be
+   *  called concurrently from multiple threads.
+   *
    * \param key   The key of parameter
    * \param value The value of parameter
    */
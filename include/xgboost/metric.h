@@ -21,6 +21,7 @@
 
 namespace xgboost {
 struct Context;
+struct FusedGradientOp;
 
 /*!
  * \brief interface of evaluation metric used to evaluate model performance.
@@ -64,6 +65,18 @@ class Metric : public Configurable {
   virtual double Evaluate(HostDeviceVector<bst_float> const& preds,
                           std::shared_ptr<DMatrix> p_fmat) = 0;
 
+  /**
+   * \brief Evaluate on the raw margin, fusing the objective's prediction transform
+   *        described by \p op into the metric reduction.
+   *
+   *  Returns false when the metric cannot consume the margin for the given transform,
+   *  in which case the caller applies the transform and calls \ref Evaluate as usual.
+   */
+  virtual bool EvaluateMargin(HostDeviceVector<bst_float> const&, std::shared_ptr<DMatrix>,
+                              FusedGradientOp const&, double*) {
+    return false;
+  }
+
   /*! \return name of metric */
   virtual const char* Name() const = 0;
   /*! \brief virtual destructor */
@@ -25,6 +25,27 @@ namespace xgboost {
 class RegTree;
 struct Context;
 
+/**
+ * @brief Description of an element-wise gradient that a predictor can compute inline
+ *        with its prediction epilogue.
+ *
+ *  Objectives whose gradient depends only on the margin, the label and the sample
+ *  weight can hand the computation over to the predictor, which fuses it into the
+ *  kernel that accumulates tree leaf values.  This saves one full pass over the
+ *  prediction vector per boosting iteration.
+ */
+struct FusedGradientOp {
+  enum Kind : std::uint8_t {
+    kNone = 0,          // gradient cannot be fused
+    kSquaredError = 1,  // grad = predt - label, hess = 1
+    kLogistic = 2,      // grad = sigmoid(predt) - label
+  } kind{kNone};
+  /** @brief Weight multiplier for positive (label == 1) samples. */
+  float scale_pos_weight{1.0f};
+  /** @brief Use the approximated transcendental functions for the prediction transform. */
+  bool fast_exp{false};
+};
+
 /*! \brief interface of objective function */
 class ObjFunction : public Configurable {
  protected:
@@ -74,6 +95,13 @@ class ObjFunction : public Configurable {
   virtual void EvalTransform(HostDeviceVector<bst_float> *io_preds) {
     this->PredTransform(io_preds);
   }
+  /*!
+   * \brief whether `EvalTransform` leaves the prediction unchanged.  When true, the
+   *  learner feeds the raw prediction directly to metrics instead of caching a
+   *  transformed copy first, which avoids allocating and copying a second prediction
+   *  vector on the configured device for every evaluation round.
+   */
+  [[nodiscard]] virtual bool IdentityEvalTransform() const { return false; }
   /*!
    * \brief transform probability value back to margin
    * this is used to transform user-set base_score back to margin
@@ -103,6 +131,14 @@ class ObjFunction : public Configurable {
     return 1;
   }
 
+  /**
+   * @brief Describe the gradient for predictors that fuse gradient computation into the
+   *        prediction epilogue.  Objectives without a fusable element-wise gradient
+   *        return the default `kNone`, in which case the learner falls back to
+   *        prediction followed by `GetGradient`.
+   */
+  [[nodiscard]] virtual FusedGradientOp FusedGradient() const { return {}; }
+
   /**
    * \brief Update the leaf values after a tree is built. Needed for objectives with 0
    *        hessian.
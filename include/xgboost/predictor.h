@@ -23,6 +23,8 @@ struct GBTreeModel;
 }  // namespace xgboost::gbm
 
 namespace xgboost {
+struct FusedGradientOp;
+
 /**
  * \brief Contains pointer to input matrix and associated cached predictions.
  */
@@ -108,6 +110,30 @@ class Predictor {
                             const gbm::GBTreeModel& model, uint32_t tree_begin,
                             uint32_t tree_end = 0) const = 0;
 
+  /**
+   * \brief Generate batch predictions and compute the objective gradient in a single
+   *        fused pass.  The gradient is evaluated inline while the accumulated margin is
+   *        still in registers, saving one read of the prediction vector.
+   *
+   * \param [in,out]  dmat       Feature matrix.
+   * \param [in,out]  out_preds  The output preds, updated the same way as PredictBatch.
+   * \param           model      The model to predict from.
+   * \param           tree_begin The tree begin index.
+   * \param           tree_end   The tree end index.
+   * \param           op         Description of the fused gradient from the objective.
+   * \param [out]     out_gpair  The output gradient, reshaped by the predictor.
+   *
+   * \return True if the predictor ran the fused path.  When false, no output is touched
+   *         and the caller must fall back to PredictBatch followed by
+   *         ObjFunction::GetGradient.
+   */
+  [[nodiscard]] virtual bool PredictBatchWithFusedGradient(
+      DMatrix* /*dmat*/, PredictionCacheEntry* /*out_preds*/, const gbm::GBTreeModel& /*model*/,
+      uint32_t /*tree_begin*/, uint32_t /*tree_end*/, FusedGradientOp const& /*op*/,
+      linalg::Matrix<GradientPair>* /*out_gpair*/) const {
+    return false;
+  }
+
   /**
    * \brief Inplace prediction.
    *
@@ -18,6 +18,7 @@
 #include <xgboost/multi_target_tree_model.h>  // for MultiTargetTree
 
 #include <algorithm>
+#include <cstdint>  // for uint8_t
 #include <cstring>
 #include <limits>
 #include <memory>  // for make_unique
@@ -562,12 +563,25 @@ class RegTree : public Model {
      * \param inst The sparse instance to fill.
      */
     void Fill(const SparsePage::Inst& inst);
+    /*!
+     * \brief fill only the features marked in the mask, the rest stay missing.
+     * \param inst The sparse instance to fill.
+     * \param used_mask Byte mask over all features, non-zero for the used ones.
+     * \param n_used The number of non-zero entries in the mask.
+     */
+    void Fill(const SparsePage::Inst& inst, const std::vector<std::uint8_t>& used_mask,
+              size_t n_used);
 
     /*!
      * \brief drop the trace after fill, must be called after fill.
      * \param inst The sparse instance to drop.
      */
     void Drop();
+    /*!
+     * \brief drop only the given features, counterpart of the masked fill.
+     * \param used The features that may have been filled.
+     */
+    void Drop(const std::vector<bst_feature_t>& used);
     /*!
      * \brief returns the size of the feature vector
      * \return the size of the feature vector
@@ -810,6 +824,19 @@ inline void RegTree::FVec::Fill(const SparsePage::Inst& inst) {
   has_missing_ = data_.size() != feature_count;
 }
 
+inline void RegTree::FVec::Fill(const SparsePage::Inst& inst,
+                                const std::vector<std::uint8_t>& used_mask, size_t n_used) {
+  size_t feature_count = 0;
+  for (auto const& entry : inst) {
+    if (entry.index >= data_.size() || !used_mask[entry.index]) {
+      continue;
+    }
+    data_[entry.index].fvalue = entry.fvalue;
+    ++feature_count;
+  }
+  has_missing_ = n_used != feature_count;
+}
+
 inline void RegTree::FVec::Drop() {
   Entry e{};
   e.flag = -1;
@@ -817,6 +844,15 @@ inline void RegTree::FVec::Drop() {
   has_missing_ = true;
 }
 
+inline void RegTree::FVec::Drop(const std::vector<bst_feature_t>& used) {
+  Entry e{};
+  e.flag = -1;
+  for (auto fidx : used) {
+    data_[fidx] = e;
+  }
+  has_missing_ = true;
+}
+
 inline size_t RegTree::FVec::Size() const {
   return data_.size();
 }
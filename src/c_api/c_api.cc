@@ -15,14 +15,21 @@
 #include <utility>       // for pair
 #include <vector>        // for vector
 
+#include "../collective/broadcast.h"     // for Broadcast
+#include "../collective/communicator-inl.h"  // for GetRank, IsDistributed
 #include "../common/api_entry.h"         // for XGBAPIThreadLocalEntry
+#include "../common/cancellation.h"      // for TrainingCancellation
 #include "../common/charconv.h"          // for from_chars, to_chars, NumericLimits, from_ch...
 #include "../common/error_msg.h"         // for NoFederated
 #include "../common/hist_util.h"         // for HistogramCuts
 #include "../common/io.h"                // for FileExtension, LoadSequentialFile, MemoryBuf...
+#include "../common/memory_stats.h"      // for MemoryUsageRegistry, CurrentDeviceMemoryBytes
 #include "../common/threading_utils.h"   // for OmpGetNumThreads, ParallelFor
+#include "../common/timer.h"             // for PerfStats
+#include "../common/transfer_stats.h"    // for TransferStats
 #include "../data/adapter.h"             // for ArrayAdapter, DenseAdapter, RecordBatchesIte...
 #include "../data/batch_utils.h"         // for MatchingPageBytes, CachePageRatio
+#include "../data/dmatrix_builder.h"     // for DMatrixBuilder
 #include "../data/ellpack_page.h"        // for EllpackPage
 #include "../data/proxy_dmatrix.h"       // for DMatrixProxy
 #include "../data/simple_dmatrix.h"      // for SimpleDMatrix
@@ -224,6 +231,40 @@ XGB_DLL int XGBGetGlobalConfig(const char** json_str) {
   API_END();
 }
 
+XGB_DLL int XGBGetMemoryUsage(char const **out_usage) {
+  API_BEGIN();
+  Json breakdown{Object{}};
+  for (auto const &[component, n_bytes] : common::MemoryUsageRegistry::Instance().Snapshot()) {
+    breakdown[component] = Integer{static_cast<std::int64_t>(n_bytes)};
+  }
+  breakdown["device"] = Integer{static_cast<std::int64_t>(common::CurrentDeviceMemoryBytes())};
+
+  auto &local = *GlobalConfigAPIThreadLocalStore::Get();
+  Json::Dump(breakdown, &local.ret_str);
+
+  xgboost_CHECK_C_ARG_PTR(out_usage);
+  *out_usage = local.ret_str.c_str();
+  API_END();
+}
+
+XGB_DLL int XGBGetTransferStats(char const **out_stats) {
+  API_BEGIN();
+  auto counters = common::TransferStats::Instance().Snapshot();
+  Json stats{Object{}};
+  stats["h2d_count"] = Integer{static_cast<std::int64_t>(counters.h2d_count)};
+  stats["h2d_bytes"] = Integer{static_cast<std::int64_t>(counters.h2d_bytes)};
+  stats["d2h_count"] = Integer{static_cast<std::int64_t>(counters.d2h_count)};
+  stats["d2h_bytes"] = Integer{static_cast<std::int64_t>(counters.d2h_bytes)};
+  stats["round_trips"] = Integer{static_cast<std::int64_t>(counters.round_trips)};
+
+  auto &local = *GlobalConfigAPIThreadLocalStore::Get();
+  Json::Dump(stats, &local.ret_str);
+
+  xgboost_CHECK_C_ARG_PTR(out_stats);
+  *out_stats = local.ret_str.c_str();
+  API_END();
+}
+
 XGB_DLL int XGDMatrixCreateFromFile(const char *fname, int silent, DMatrixHandle *out) {
   xgboost_CHECK_C_ARG_PTR(fname);
   xgboost_CHECK_C_ARG_PTR(out);
@@ -303,13 +344,23 @@ XGB_DLL int XGDMatrixCreateFromCallback(DataIterHandle iter, DMatrixHandle proxy
                                                                  cuda_impl::MatchingPageBytes());
   CHECK_EQ(min_cache_page_bytes, cuda_impl::MatchingPageBytes())
       << "Page concatenation is not supported by the DMatrix yet.";
+  auto n_prefetch_batches =
+      OptionalArg<Integer, std::int64_t>(jconfig, "n_prefetch_batches", 0);
+  auto shuffle_seed = OptionalArg<Integer, std::int64_t>(jconfig, "shuffle_seed", 0);
 
   xgboost_CHECK_C_ARG_PTR(next);
   xgboost_CHECK_C_ARG_PTR(reset);
   xgboost_CHECK_C_ARG_PTR(out);
 
-  auto config = ExtMemConfig{
-      cache, on_host, min_cache_page_bytes, missing, /*max_num_device_pages=*/0, n_threads};
+  auto config = ExtMemConfig{cache,
+                             on_host,
+                             min_cache_page_bytes,
+                             missing,
+                             /*max_num_device_pages=*/0,
+                             n_threads,
+                             static_cast<std::int32_t>(n_prefetch_batches),
+                             /*persist_cache=*/false,
+                             static_cast<std::uint64_t>(shuffle_seed)};
   *out = new std::shared_ptr<xgboost::DMatrix>{
       xgboost::DMatrix::Create(iter, proxy, reset, next, config)};
   API_END();
@@ -388,18 +439,88 @@ XGB_DLL int XGExtMemQuantileDMatrixCreateFromCallback(DataIterHandle iter, DMatr
                                                                  cuda_impl::MaxNumDevicePages());
   auto max_quantile_blocks = OptionalArg<Integer, std::int64_t>(
       jconfig, "max_quantile_blocks", std::numeric_limits<std::int64_t>::max());
+  auto n_prefetch_batches =
+      OptionalArg<Integer, std::int64_t>(jconfig, "n_prefetch_batches", 0);
+  auto persist_cache = OptionalArg<Boolean>(jconfig, "persist_cache", false);
 
   xgboost_CHECK_C_ARG_PTR(next);
   xgboost_CHECK_C_ARG_PTR(reset);
   xgboost_CHECK_C_ARG_PTR(out);
 
-  auto config =
-      ExtMemConfig{cache, on_host, min_cache_page_bytes, missing, max_num_device_pages, n_threads};
+  auto config = ExtMemConfig{cache,
+                             on_host,
+                             min_cache_page_bytes,
+                             missing,
+                             max_num_device_pages,
+                             n_threads,
+                             static_cast<std::int32_t>(n_prefetch_batches),
+                             persist_cache};
   *out = new std::shared_ptr<xgboost::DMatrix>{xgboost::DMatrix::Create(
       iter, proxy, p_ref, reset, next, max_bin, max_quantile_blocks, config)};
   API_END();
 }
 
+namespace {
+// The builder along with the configuration needed once it's finalized.
+struct DMatrixBuilderImpl {
+  data::DMatrixBuilder builder;
+  float missing;
+  std::int32_t n_threads;
+  bst_bin_t max_bin;
+};
+}  // namespace
+
+XGB_DLL int XGDMatrixBuilderCreate(char const *config, DMatrixBuilderHandle *out) {
+  API_BEGIN();
+  xgboost_CHECK_C_ARG_PTR(config);
+  xgboost_CHECK_C_ARG_PTR(out);
+  auto jconfig = Json::Load(StringView{config});
+  auto impl = std::make_unique<DMatrixBuilderImpl>();
+  impl->missing = GetMissing(jconfig);
+  impl->n_threads = OptionalArg<Integer, std::int64_t>(jconfig, "nthread", 0);
+  impl->max_bin = OptionalArg<Integer, std::int64_t>(jconfig, "max_bin", 256);
+  *out = impl.release();
+  API_END();
+}
+
+XGB_DLL int XGDMatrixBuilderPushColumn(DMatrixBuilderHandle handle, int type, void const *data,
+                                       bst_ulong n) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  xgboost_CHECK_C_ARG_PTR(data);
+  auto impl = static_cast<DMatrixBuilderImpl *>(handle);
+  impl->builder.PushColumn(static_cast<DataType>(type), data, n);
+  API_END();
+}
+
+XGB_DLL int XGDMatrixBuilderCommitBatch(DMatrixBuilderHandle handle) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  static_cast<DMatrixBuilderImpl *>(handle)->builder.CommitBatch();
+  API_END();
+}
+
+XGB_DLL int XGDMatrixBuilderFinalize(DMatrixBuilderHandle handle, DMatrixHandle ref,
+                                     DMatrixHandle *out) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  xgboost_CHECK_C_ARG_PTR(out);
+  std::unique_ptr<DMatrixBuilderImpl> impl{static_cast<DMatrixBuilderImpl *>(handle)};
+  std::shared_ptr<DMatrix> p_ref{GetRefDMatrix(ref)};
+  *out = new std::shared_ptr<xgboost::DMatrix>{xgboost::DMatrix::Create(
+      &impl->builder, impl->builder.Proxy(), p_ref, data::builderiter::Reset,
+      data::builderiter::Next, impl->missing, impl->n_threads, impl->max_bin,
+      std::numeric_limits<std::int64_t>::max())};
+  API_END();
+}
+
+XGB_DLL int XGDMatrixBuilderFree(DMatrixBuilderHandle handle) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  delete static_cast<DMatrixBuilderImpl *>(handle);
+  API_END();
+}
+
 XGB_DLL int XGProxyDMatrixCreate(DMatrixHandle *out) {
   API_BEGIN();
   xgboost_CHECK_C_ARG_PTR(out);
@@ -971,6 +1092,104 @@ XGB_DLL int XGDMatrixGetQuantileCut(DMatrixHandle const handle, char const *conf
   API_END();
 }
 
+XGB_DLL int XGDMatrixExportQuantileCut(DMatrixHandle const handle, char const *config,
+                                       char const **out) {
+  API_BEGIN();
+  CHECK_HANDLE();
+
+  auto p_m = CastDMatrixHandle(handle);
+
+  xgboost_CHECK_C_ARG_PTR(config);
+  xgboost_CHECK_C_ARG_PTR(out);
+
+  auto jconfig = Json::Load(StringView{config});
+
+  if (!p_m->PageExists<GHistIndexMatrix>() && !p_m->PageExists<EllpackPage>()) {
+    LOG(FATAL) << "The quantile cut hasn't been generated yet. Unless this is a `QuantileDMatrix`, "
+                  "quantile cut is generated during training.";
+  }
+
+  common::HistogramCuts cuts;
+  if (p_m->PageExists<GHistIndexMatrix>()) {
+    auto ctx = p_m->Ctx()->IsCPU() ? *p_m->Ctx() : p_m->Ctx()->MakeCPU();
+    for (auto const &page : p_m->GetBatches<GHistIndexMatrix>(&ctx, {})) {
+      cuts = page.Cuts();
+      break;
+    }
+  } else {
+    auto ctx = p_m->Ctx()->IsCUDA() ? *p_m->Ctx() : p_m->Ctx()->MakeCUDA(0);
+    for (auto const &page : p_m->GetBatches<EllpackPage>(&ctx, {})) {
+      cuts = page.Cuts();
+      break;
+    }
+  }
+
+  Json doc{Object{}};
+  doc["cuts"] = Object{};
+  cuts.SaveJson(&doc["cuts"]);
+
+  auto ft = p_m->Info().feature_types.ConstHostSpan();
+  std::vector<Json> jft(ft.size());
+  std::transform(ft.cbegin(), ft.cend(), jft.begin(), [](FeatureType t) {
+    return Json{String{t == FeatureType::kCategorical ? "c" : "q"}};
+  });
+  doc["feature_types"] = Array{std::move(jft)};
+
+  auto &ret_str = p_m->GetThreadLocal().ret_str;
+  Json::Dump(doc, &ret_str);
+  *out = ret_str.c_str();
+  API_END();
+}
+
+XGB_DLL int XGDMatrixCreateFromQuantileCut(char const *cuts, char const *config,
+                                           DMatrixHandle *out) {
+  API_BEGIN();
+
+  xgboost_CHECK_C_ARG_PTR(cuts);
+  xgboost_CHECK_C_ARG_PTR(config);
+  xgboost_CHECK_C_ARG_PTR(out);
+
+  auto jconfig = Json::Load(StringView{config});
+  auto max_bin = OptionalArg<Integer, int64_t>(jconfig, "max_bin", 256);
+
+  auto doc = Json::Load(StringView{cuts});
+  common::HistogramCuts hcuts;
+  hcuts.LoadJson(doc["cuts"]);
+
+  std::vector<FeatureType> ft;
+  auto const &jft = get<Array const>(doc["feature_types"]);
+  ft.reserve(jft.size());
+  for (auto const &v : jft) {
+    ft.emplace_back(get<String const>(v) == "c" ? FeatureType::kCategorical
+                                                : FeatureType::kNumerical);
+  }
+
+  *out = new std::shared_ptr<DMatrix>{
+      data::SimpleDMatrix::FromQuantileCut(std::move(hcuts), max_bin, ft)};
+  API_END();
+}
+
+XGB_DLL int XGDMatrixReuseQuantileCut(DMatrixHandle handle, DMatrixHandle ref) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  auto p_m = CastDMatrixHandle(handle);
+  xgboost_CHECK_C_ARG_PTR(ref);
+  auto p_ref = CastDMatrixHandle(ref);
+
+  CHECK(p_ref->PageExists<GHistIndexMatrix>())
+      << "The reference DMatrix doesn't have quantile cuts yet. Unless it is a "
+         "`QuantileDMatrix`, the cuts are generated during training.";
+  auto p_simple = dynamic_cast<data::SimpleDMatrix *>(p_m.get());
+  CHECK(p_simple) << "Reusing quantile cuts is only supported for in-memory DMatrix.";
+
+  auto ctx = p_ref->Ctx()->IsCPU() ? *p_ref->Ctx() : p_ref->Ctx()->MakeCPU();
+  for (auto const &page : p_ref->GetBatches<GHistIndexMatrix>(&ctx, {})) {
+    p_simple->ReuseQuantileCuts(page.Cuts(), page.max_numeric_bins_per_feat);
+    break;
+  }
+  API_END();
+}
+
 // xgboost implementation
 XGB_DLL int XGBoosterCreate(const DMatrixHandle dmats[],
                             xgboost::bst_ulong len,
@@ -1002,6 +1221,31 @@ XGB_DLL int XGBoosterSetParam(BoosterHandle handle,
   API_END();
 }
 
+XGB_DLL int XGBoosterSetParams(BoosterHandle handle, char const *json_parameters) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  xgboost_CHECK_C_ARG_PTR(json_parameters);
+  Json config{Json::Load(StringView{json_parameters})};
+  CHECK(IsA<Object>(config)) << "Expecting a JSON object of parameter name/value pairs.";
+  Args args;
+  for (auto const &kv : get<Object const>(config)) {
+    if (IsA<Null>(kv.second)) {
+      continue;
+    }
+    if (IsA<String>(kv.second)) {
+      args.emplace_back(kv.first, get<String const>(kv.second));
+    } else {
+      // Numbers, booleans and structured values like interaction_constraints keep their
+      // JSON representation.
+      std::string str;
+      Json::Dump(kv.second, &str);
+      args.emplace_back(kv.first, std::move(str));
+    }
+  }
+  static_cast<Learner *>(handle)->SetParams(args);
+  API_END();
+}
+
 XGB_DLL int XGBoosterGetNumFeature(BoosterHandle handle,
                                    xgboost::bst_ulong *out) {
   API_BEGIN();
@@ -1050,6 +1294,32 @@ XGB_DLL int XGBoosterSaveJsonConfig(BoosterHandle handle,
   API_END();
 }
 
+XGB_DLL int XGBoosterGetPerfStats(BoosterHandle handle, char const *config,
+                                  xgboost::bst_ulong *out_len, char const **out_str) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  xgboost_CHECK_C_ARG_PTR(config);
+  Json jconfig{Json::Load(StringView{config})};
+  auto &stats = common::PerfStats::Instance();
+  auto enable = OptionalArg<Boolean>(jconfig, "enable", stats.Enabled());
+  auto reset = OptionalArg<Boolean>(jconfig, "reset", false);
+  stats.Enable(enable);
+
+  auto *learner = static_cast<Learner *>(handle);
+  std::string &raw_str = learner->GetThreadLocal().ret_str;
+  Json::Dump(stats.ToJson(), &raw_str);
+  if (reset) {
+    stats.Reset();
+  }
+
+  xgboost_CHECK_C_ARG_PTR(out_str);
+  xgboost_CHECK_C_ARG_PTR(out_len);
+
+  *out_str = raw_str.c_str();
+  *out_len = static_cast<xgboost::bst_ulong>(raw_str.length());
+  API_END();
+}
+
 XGB_DLL int XGBoosterUpdateOneIter(BoosterHandle handle,
                                    int iter,
                                    DMatrixHandle dtrain) {
@@ -1063,6 +1333,27 @@ XGB_DLL int XGBoosterUpdateOneIter(BoosterHandle handle,
   API_END();
 }
 
+XGB_DLL int XGBTrainingCancel(int cancel) {
+  API_BEGIN();
+  common::TrainingCancellation::Instance().Request(cancel != 0);
+  API_END();
+}
+
+XGB_DLL int XGBoosterTransferPredictionCache(BoosterHandle handle, DMatrixHandle old_dtrain,
+                                             DMatrixHandle new_dtrain) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  auto* bst = static_cast<Learner*>(handle);
+  xgboost_CHECK_C_ARG_PTR(old_dtrain);
+  xgboost_CHECK_C_ARG_PTR(new_dtrain);
+  auto* p_old = static_cast<std::shared_ptr<DMatrix>*>(old_dtrain);
+  auto* p_new = static_cast<std::shared_ptr<DMatrix>*>(new_dtrain);
+  CHECK(p_old);
+  CHECK(p_new);
+  bst->TransferPredictionCache(p_old->get(), *p_new);
+  API_END();
+}
+
 XGB_DLL int XGBoosterBoostOneIter(BoosterHandle handle, DMatrixHandle dtrain, bst_float *grad,
                                   bst_float *hess, xgboost::bst_ulong len) {
   API_BEGIN();
@@ -1302,6 +1593,42 @@ XGB_DLL int XGBoosterPredictFromDense(BoosterHandle handle, char const *array_in
   API_END();
 }
 
+XGB_DLL int XGBoosterPredictFromDenseMany(BoosterHandle handles[], xgboost::bst_ulong n_boosters,
+                                          char const *array_interface, char const *c_json_config,
+                                          xgboost::bst_ulong const **out_shape,
+                                          xgboost::bst_ulong *out_dim, const float **out_result) {
+  API_BEGIN();
+  xgboost_CHECK_C_ARG_PTR(handles);
+  CHECK_GE(n_boosters, 1) << "At least one booster is required.";
+  // One proxy is shared by all boosters, the array interface is parsed and validated once
+  // and the feature block stays hot in cache between models.
+  std::shared_ptr<DMatrix> p_m{new data::DMatrixProxy};
+  auto proxy = dynamic_cast<data::DMatrixProxy *>(p_m.get());
+  xgboost_CHECK_C_ARG_PTR(array_interface);
+  proxy->SetArrayData(array_interface);
+  xgboost_CHECK_C_ARG_PTR(out_shape);
+  xgboost_CHECK_C_ARG_PTR(out_dim);
+  xgboost_CHECK_C_ARG_PTR(out_result);
+  for (xgboost::bst_ulong i = 0; i < n_boosters; ++i) {
+    CHECK(handles[i]) << "Booster has not been initialized or has already been disposed.";
+    auto *learner = static_cast<xgboost::Learner *>(handles[i]);
+    xgboost::bst_ulong const *shape{nullptr};
+    xgboost::bst_ulong dim{0};
+    InplacePredictImpl(p_m, c_json_config, learner, &shape, &dim, &out_result[i]);
+    if (i == 0) {
+      *out_shape = shape;
+      *out_dim = dim;
+    } else {
+      CHECK_EQ(dim, *out_dim) << "All boosters must produce predictions of the same shape.";
+      for (xgboost::bst_ulong d = 0; d < dim; ++d) {
+        CHECK_EQ(shape[d], (*out_shape)[d])
+            << "All boosters must produce predictions of the same shape.";
+      }
+    }
+  }
+  API_END();
+}
+
 XGB_DLL int XGBoosterPredictFromColumnar(BoosterHandle handle, char const *array_interface,
                                          char const *c_json_config, DMatrixHandle m,
                                          xgboost::bst_ulong const **out_shape,
@@ -1345,6 +1672,168 @@ XGB_DLL int XGBoosterPredictFromCSR(BoosterHandle handle, char const *indptr, ch
   API_END();
 }
 
+namespace {
+// Reusable state for repeated inplace predictions, see XGBoosterPredictSessionCreate.
+// Keeping the proxy DMatrix alive across calls lets the learner reuse its cached output
+// vector, so the steady state allocates nothing.
+struct PredictSession {
+  Learner *learner{nullptr};  // borrowed from the booster handle
+  std::shared_ptr<DMatrix> proxy{std::make_shared<xgboost::data::DMatrixProxy>()};
+  // Configuration, parsed once at creation.
+  PredictionType type;
+  float missing;
+  bool strict_shape;
+  std::uint32_t iteration_begin;
+  std::uint32_t iteration_end;
+
+  [[nodiscard]] xgboost::data::DMatrixProxy *Proxy() const {
+    return dynamic_cast<xgboost::data::DMatrixProxy *>(proxy.get());
+  }
+};
+
+void PredictSessionImpl(PredictSession *session, xgboost::bst_ulong const **out_shape,
+                        xgboost::bst_ulong *out_dim, const float **out_result) {
+  auto *learner = session->learner;
+  HostDeviceVector<float> *p_predt{nullptr};
+  learner->InplacePredict(session->proxy, session->type, session->missing, &p_predt,
+                          session->iteration_begin, session->iteration_end);
+  CHECK(p_predt);
+  auto &shape = learner->GetThreadLocal().prediction_shape;
+  auto const &info = session->proxy->Info();
+  auto n_samples = info.num_row_;
+  auto n_features = info.num_col_;
+  auto chunksize = n_samples == 0 ? 0 : p_predt->Size() / n_samples;
+
+  xgboost_CHECK_C_ARG_PTR(out_dim);
+  CalcPredictShape(session->strict_shape, session->type, n_samples, n_features, chunksize,
+                   learner->Groups(), learner->BoostedRounds(), &shape, out_dim);
+  CHECK_GE(p_predt->Size(), n_samples);
+
+  xgboost_CHECK_C_ARG_PTR(out_result);
+  xgboost_CHECK_C_ARG_PTR(out_shape);
+
+  *out_result = dmlc::BeginPtr(p_predt->HostVector());
+  *out_shape = dmlc::BeginPtr(shape);
+}
+}  // anonymous namespace
+
+XGB_DLL int XGBoosterPredictSessionCreate(BoosterHandle handle, char const *c_json_config,
+                                          PredictSessionHandle *out) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  xgboost_CHECK_C_ARG_PTR(c_json_config);
+  xgboost_CHECK_C_ARG_PTR(out);
+  auto config = Json::Load(StringView{c_json_config});
+
+  auto session = std::make_unique<PredictSession>();
+  session->learner = static_cast<xgboost::Learner *>(handle);
+  session->type = PredictionType(RequiredArg<Integer>(config, "type", __func__));
+  session->missing = GetMissing(config);
+  session->strict_shape = RequiredArg<Boolean>(config, "strict_shape", __func__);
+  session->iteration_begin = RequiredArg<Integer>(config, "iteration_begin", __func__);
+  session->iteration_end = RequiredArg<Integer>(config, "iteration_end", __func__);
+  *out = session.release();
+  API_END();
+}
+
+XGB_DLL int XGBoosterPredictSessionFree(PredictSessionHandle handle) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  delete static_cast<PredictSession *>(handle);
+  API_END();
+}
+
+XGB_DLL int XGBoosterPredictSessionFromDense(PredictSessionHandle handle,
+                                             char const *array_interface,
+                                             xgboost::bst_ulong const **out_shape,
+                                             xgboost::bst_ulong *out_dim,
+                                             const float **out_result) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  auto *session = static_cast<PredictSession *>(handle);
+  xgboost_CHECK_C_ARG_PTR(array_interface);
+  session->Proxy()->SetArrayData(array_interface);
+  PredictSessionImpl(session, out_shape, out_dim, out_result);
+  API_END();
+}
+
+XGB_DLL int XGBoosterPredictSessionFromColumnar(PredictSessionHandle handle,
+                                                char const *array_interface,
+                                                xgboost::bst_ulong const **out_shape,
+                                                xgboost::bst_ulong *out_dim,
+                                                const float **out_result) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  auto *session = static_cast<PredictSession *>(handle);
+  xgboost_CHECK_C_ARG_PTR(array_interface);
+  session->Proxy()->SetColumnarData(array_interface);
+  PredictSessionImpl(session, out_shape, out_dim, out_result);
+  API_END();
+}
+
+XGB_DLL int XGBoosterPredictFromDMatrixStreamed(BoosterHandle handle, DMatrixHandle dmat,
+                                                char const *c_json_config,
+                                                XGBoosterPredictStreamCallback *callback,
+                                                void *user_data) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  xgboost_CHECK_C_ARG_PTR(c_json_config);
+  xgboost_CHECK_C_ARG_PTR(callback);
+  auto config = Json::Load(StringView{c_json_config});
+  auto p_m = CastDMatrixHandle(dmat);
+
+  auto type = PredictionType(RequiredArg<Integer>(config, "type", __func__));
+  CHECK(type == PredictionType::kValue || type == PredictionType::kMargin)
+      << "Only value and margin predictions can be streamed.";
+  auto iteration_begin = RequiredArg<Integer>(config, "iteration_begin", __func__);
+  auto iteration_end = RequiredArg<Integer>(config, "iteration_end", __func__);
+  CHECK_EQ(p_m->Info().base_margin_.Size(), 0)
+      << "Streaming prediction does not support base margin.";
+
+  auto *learner = static_cast<Learner *>(handle);
+
+  // One proxy and one output buffer are reused for every page, so the peak memory is
+  // bounded by the page size regardless of the total number of rows.  Iterating over the
+  // sparse pages drives the regular prefetcher, the next page is read from disk while
+  // the current one is being scored.
+  std::shared_ptr<DMatrix> p_proxy{std::make_shared<data::DMatrixProxy>()};
+  auto *proxy = dynamic_cast<data::DMatrixProxy *>(p_proxy.get());
+  std::vector<bst_feature_t> indices;
+  std::vector<float> values;
+
+  xgboost::bst_ulong offset{0};
+  for (auto const &page : p_m->GetBatches<SparsePage>()) {
+    auto view = page.GetView();
+    // Split the interleaved entries into the two arrays the CSR adapter expects.
+    indices.resize(view.data.size());
+    values.resize(view.data.size());
+    common::ParallelFor(view.data.size(), learner->Ctx()->Threads(), [&](auto i) {
+      indices[i] = view.data[i].index;
+      values[i] = view.data[i].fvalue;
+    });
+    auto s_indptr =
+        linalg::ArrayInterfaceStr(linalg::MakeVec(view.offset.data(), view.offset.size()));
+    auto s_indices = linalg::ArrayInterfaceStr(linalg::MakeVec(indices.data(), indices.size()));
+    auto s_values = linalg::ArrayInterfaceStr(linalg::MakeVec(values.data(), values.size()));
+    proxy->SetCSRData(s_indptr.c_str(), s_indices.c_str(), s_values.c_str(),
+                      p_m->Info().num_col_, true);
+
+    HostDeviceVector<float> *p_predt{nullptr};
+    learner->InplacePredict(p_proxy, type, std::numeric_limits<float>::quiet_NaN(), &p_predt,
+                            iteration_begin, iteration_end);
+    CHECK(p_predt);
+    auto const &h_predt = p_predt->ConstHostVector();
+    auto n_rows = static_cast<xgboost::bst_ulong>(page.Size());
+    auto ret = callback(offset, n_rows, dmlc::BeginPtr(h_predt),
+                        static_cast<xgboost::bst_ulong>(h_predt.size()), user_data);
+    if (ret != 0) {
+      break;
+    }
+    offset += n_rows;
+  }
+  API_END();
+}
+
 #if !defined(XGBOOST_USE_CUDA)
 XGB_DLL int XGBoosterPredictFromCUDAArray(BoosterHandle handle, char const *, char const *,
                                           DMatrixHandle, xgboost::bst_ulong const **,
@@ -1376,12 +1865,20 @@ XGB_DLL int XGBoosterLoadModel(BoosterHandle handle, const char* fname) {
     return str;
   };
   if (common::FileExtension(fname) == "json") {
-    auto buffer = read_file();
-    Json in{Json::Load(StringView{buffer.data(), buffer.size()})};
+    Json in;
+    {
+      // Release the raw buffer before materializing the model to lower the transient
+      // memory usage.
+      auto buffer = read_file();
+      in = Json::Load(StringView{buffer.data(), buffer.size()});
+    }
     static_cast<Learner*>(handle)->LoadModel(in);
   } else if (common::FileExtension(fname) == "ubj") {
-    auto buffer = read_file();
-    Json in = Json::Load(StringView{buffer.data(), buffer.size()}, std::ios::binary);
+    Json in;
+    {
+      auto buffer = read_file();
+      in = Json::Load(StringView{buffer.data(), buffer.size()}, std::ios::binary);
+    }
     static_cast<Learner *>(handle)->LoadModel(in);
   } else {
     std::unique_ptr<dmlc::Stream> fi(dmlc::Stream::Create(fname, "r"));
@@ -1428,6 +1925,32 @@ XGB_DLL int XGBoosterSaveModel(BoosterHandle handle, const char *fname) {
   API_END();
 }
 
+XGB_DLL int XGBoosterSaveModelAsync(BoosterHandle handle, const char *fname) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  xgboost_CHECK_C_ARG_PTR(fname);
+
+  auto *learner = static_cast<Learner *>(handle);
+  learner->Configure();
+  auto ext = common::FileExtension(fname);
+  if (ext == "deprecated") {
+    LOG(FATAL) << "Saving into deprecated binary model format is not supported by the background "
+                  "model saving, use `json` or `ubj` instead.";
+  } else if (ext != "json" && ext != "ubj") {
+    LOG(WARNING) << "Saving model in the UBJSON format as default.  You can use file extension:"
+                    " `json` or `ubj` to choose between formats.";
+  }
+  learner->SaveModelAsync(fname);
+  API_END();
+}
+
+XGB_DLL int XGBoosterFinishSaveModelAsync(BoosterHandle handle) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  static_cast<Learner *>(handle)->FinishSaveModelAsync();
+  API_END();
+}
+
 XGB_DLL int XGBoosterLoadModelFromBuffer(BoosterHandle handle, const void *buf,
                                          xgboost::bst_ulong len) {
   API_BEGIN();
@@ -1518,6 +2041,38 @@ XGB_DLL int XGBoosterUnserializeFromBuffer(BoosterHandle handle,
   API_END();
 }
 
+XGB_DLL int XGBoosterBroadcastModel(BoosterHandle handle, int root) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  if (!collective::IsDistributed()) {
+    return 0;
+  }
+
+  auto *learner = static_cast<Learner *>(handle);
+  auto const *ctx = learner->Ctx();
+  std::string buf;
+  if (collective::GetRank() == root) {
+    common::MemoryBufferStream fo(&buf);
+    learner->Configure();
+    learner->Save(&fo);
+  }
+
+  auto n_bytes = static_cast<std::int64_t>(buf.size());
+  auto rc = collective::Success() << [&] {
+    return collective::Broadcast(ctx, linalg::MakeVec(&n_bytes, 1), root);
+  } << [&] {
+    buf.resize(n_bytes);
+    return collective::Broadcast(ctx, linalg::MakeVec(buf.data(), buf.size()), root);
+  };
+  collective::SafeColl(rc);
+
+  if (collective::GetRank() != root) {
+    common::MemoryFixSizeBuffer fs(buf.data(), buf.size());
+    learner->Load(&fs);
+  }
+  API_END();
+}
+
 XGB_DLL int XGBoosterSlice(BoosterHandle handle, int begin_layer, int end_layer, int step,
                            BoosterHandle *out) {
   API_BEGIN();
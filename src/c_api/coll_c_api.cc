@@ -238,6 +238,35 @@ XGB_DLL int XGCommunicatorGetProcessorName(char const **name_str) {
   API_END();
 }
 
+XGB_DLL int XGCommunicatorGetStats(char const **json_str) {
+  API_BEGIN();
+  auto const &comm = collective::GlobalCommGroup();
+  Json stats{Object{}};
+  stats["rank"] = Integer{comm->Rank()};
+  stats["loop"] = comm->LoopStats();
+
+  auto &local = *CollAPIThreadLocalStore::Get();
+  if (comm->IsDistributed()) {
+    // Collective call: rank 0 receives the summaries of all the workers so the tail op
+    // can be found without correlating per-worker logs by hand.
+    std::vector<std::string> all;
+    auto rc = collective::AllgatherStrings({Json::Dump(stats)}, &all);
+    collective::SafeColl(rc);
+    if (comm->Rank() == 0) {
+      std::vector<Json> workers(all.size());
+      for (std::size_t i = 0; i < all.size(); ++i) {
+        workers[i] = Json::Load(StringView{all[i]});
+      }
+      stats["workers"] = Array{std::move(workers)};
+    }
+  }
+  local.ret_str = Json::Dump(stats);
+
+  xgboost_CHECK_C_ARG_PTR(json_str);
+  *json_str = local.ret_str.c_str();
+  API_END();
+}
+
 XGB_DLL int XGCommunicatorBroadcast(void *send_receive_buffer, size_t size, int root) {
   API_BEGIN();
   collective::Broadcast(send_receive_buffer, size, root);
@@ -12,10 +12,13 @@
 #include <xgboost/logging.h>
 #include <xgboost/parameter.h>
 
+#include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <ctime>
 #include <iomanip>
+#include <limits>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -23,13 +26,16 @@
 #include "common/common.h"
 #include "common/config.h"
 #include "common/io.h"
+#include "common/timer.h"
 #include "common/version.h"
+#include "data/adapter.h"
 
 namespace xgboost {
 enum CLITask {
   kTrain = 0,
   kDumpModel = 1,
-  kPredict = 2
+  kPredict = 2,
+  kBenchmark = 3
 };
 
 struct CLIParam : public XGBoostParameter<CLIParam> {
@@ -69,6 +75,16 @@ struct CLIParam : public XGBoostParameter<CLIParam> {
   std::string name_fmap;
   /*! \brief name of dump file */
   std::string name_dump;
+  /*! \brief number of synthetic rows for the benchmark task */
+  int bench_rows;
+  /*! \brief number of synthetic features for the benchmark task */
+  int bench_cols;
+  /*! \brief fraction of missing values in the synthetic data */
+  float bench_sparsity;
+  /*! \brief when non-zero, synthetic features are categorical with this many categories */
+  int bench_categories;
+  /*! \brief warm-up boosting iterations excluded from the timing */
+  int bench_warmup;
   /*! \brief the paths of validation data sets */
   std::vector<std::string> eval_data_paths;
   /*! \brief the names of the evaluation data used in output log */
@@ -85,6 +101,7 @@ struct CLIParam : public XGBoostParameter<CLIParam> {
         .add_enum("train", kTrain)
         .add_enum("dump", kDumpModel)
         .add_enum("pred", kPredict)
+        .add_enum("benchmark", kBenchmark)
         .describe("Task to be performed by the CLI program.");
     DMLC_DECLARE_FIELD(eval_train).set_default(false)
         .describe("Whether evaluate on training data during training.");
@@ -124,6 +141,16 @@ struct CLIParam : public XGBoostParameter<CLIParam> {
         .describe("Name of the feature map file.");
     DMLC_DECLARE_FIELD(name_dump).set_default("dump.txt")
         .describe("Name of the output dump text file.");
+    DMLC_DECLARE_FIELD(bench_rows).set_default(65536).set_lower_bound(1)
+        .describe("Number of synthetic rows generated for the benchmark task.");
+    DMLC_DECLARE_FIELD(bench_cols).set_default(64).set_lower_bound(1)
+        .describe("Number of synthetic features generated for the benchmark task.");
+    DMLC_DECLARE_FIELD(bench_sparsity).set_default(0.0f).set_range(0.0f, 1.0f)
+        .describe("Fraction of missing values in the synthetic benchmark data.");
+    DMLC_DECLARE_FIELD(bench_categories).set_default(0).set_lower_bound(0)
+        .describe("When non-zero, benchmark features are categorical with this many categories.");
+    DMLC_DECLARE_FIELD(bench_warmup).set_default(1).set_lower_bound(0)
+        .describe("Warm-up boosting iterations excluded from the benchmark timing.");
     // alias
     DMLC_DECLARE_ALIAS(train_path, data);
     DMLC_DECLARE_ALIAS(test_path, test:data);
@@ -328,6 +355,71 @@ class CLI {
     os.set_stream(nullptr);
   }
 
+  // Train on deterministic synthetic data and report throughput together with the
+  // per-phase breakdown collected by the monitors, so instance types can be compared
+  // without sharing any data.
+  void CLIBenchmark() {
+    auto n_rows = static_cast<std::size_t>(param_.bench_rows);
+    auto n_cols = static_cast<std::size_t>(param_.bench_cols);
+    // Deterministic generation, the numbers are comparable across runs and machines.
+    std::mt19937_64 rng{0};
+    std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+    std::vector<float> values(n_rows * n_cols);
+    for (auto& v : values) {
+      if (param_.bench_sparsity > 0.0f && dist(rng) < param_.bench_sparsity) {
+        v = std::numeric_limits<float>::quiet_NaN();
+      } else if (param_.bench_categories > 0) {
+        v = std::floor(dist(rng) * static_cast<float>(param_.bench_categories));
+      } else {
+        v = dist(rng);
+      }
+    }
+    data::DenseAdapter adapter{values.data(), n_rows, n_cols};
+    std::shared_ptr<DMatrix> dtrain{
+        DMatrix::Create(&adapter, std::numeric_limits<float>::quiet_NaN(), 0)};
+    dtrain->Info().labels.Reshape(n_rows, 1);
+    for (auto& y : dtrain->Info().labels.Data()->HostVector()) {
+      y = dist(rng);
+    }
+    if (param_.bench_categories > 0) {
+      dtrain->Info().feature_types.HostVector().assign(n_cols, FeatureType::kCategorical);
+    }
+
+    // Warm up on a throwaway booster so one-time costs like building the histogram
+    // index are excluded from the measurement.
+    this->ResetLearner({dtrain});
+    for (int i = 0; i < param_.bench_warmup; ++i) {
+      learner_->UpdateOneIter(i, dtrain);
+    }
+
+    this->ResetLearner({dtrain});
+    auto& registry = common::PerfStats::Instance();
+    registry.Enable(true);
+    registry.Reset();
+    common::Timer timer;
+    timer.Start();
+    for (int i = 0; i < param_.num_round; ++i) {
+      learner_->UpdateOneIter(i, dtrain);
+    }
+    timer.Stop();
+    registry.Enable(false);
+
+    Json out{Object{}};
+    out["rows"] = Integer{static_cast<Integer::Int>(param_.bench_rows)};
+    out["cols"] = Integer{static_cast<Integer::Int>(param_.bench_cols)};
+    out["sparsity"] = Number{param_.bench_sparsity};
+    out["categories"] = Integer{static_cast<Integer::Int>(param_.bench_categories)};
+    out["warmup"] = Integer{static_cast<Integer::Int>(param_.bench_warmup)};
+    out["rounds"] = Integer{static_cast<Integer::Int>(param_.num_round)};
+    out["total_sec"] = Number{static_cast<float>(timer.ElapsedSeconds())};
+    out["sec_per_round"] =
+        Number{static_cast<float>(timer.ElapsedSeconds() / param_.num_round)};
+    out["phases"] = registry.ToJson();
+    std::string str;
+    Json::Dump(out, &str);
+    std::cout << str << std::endl;
+  }
+
   void LoadModel(std::string const& path, Learner* learner) const {
     if (common::FileExtension(path) == "json") {
       auto buffer = common::LoadSequentialFile(path);
@@ -478,6 +570,9 @@ class CLI {
       case kPredict:
         CLIPredict();
         break;
+      case kBenchmark:
+        CLIBenchmark();
+        break;
       }
     } catch (dmlc::Error const& e) {
       xgboost::CLIError(e);
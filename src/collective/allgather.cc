@@ -44,7 +44,10 @@ Result RingAllgather(Comm const& comm, common::Span<std::int8_t> data, std::size
       CHECK_NE(recv_seg.size(), 0);
       return prev_ch->RecvAll(recv_seg.data(), recv_seg.size_bytes());
     } << [&] {
-      return comm.Block();
+      // Block through the sending channel: during the bootstrap it is not registered
+      // with the communicator, so Comm::Block alone would not flush its coalescing
+      // window and the peer would never receive the segment.
+      return next_ch->Block();
     };
     if (!rc.OK()) {
       return Fail("Ring allgather failed, current iteration:" + std::to_string(r), std::move(rc));
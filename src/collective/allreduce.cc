@@ -6,6 +6,8 @@
 #include <algorithm>  // for min
 #include <cstddef>    // for size_t
 #include <cstdint>    // for int32_t, int8_t
+#include <memory>     // for shared_ptr
+#include <string>     // for string, to_string
 #include <utility>    // for move
 #include <vector>     // for vector
 
@@ -110,6 +112,36 @@ Result RingScatterReduceTyped(Comm const& comm, common::Span<std::int8_t> data,
   return Success();
 }
 
+namespace {
+/**
+ * @brief View of the group leaders as a smaller communicator for the inter-node ring.
+ *
+ * The i^th leader is the rank `i * stride` of the parent communicator.  Channels are
+ * borrowed from the parent, so the view must not outlive it.
+ */
+class LeaderRing : public Comm {
+  Comm const& parent_;
+  std::int32_t stride_;
+
+ public:
+  LeaderRing(Comm const& parent, std::int32_t stride) : parent_{parent}, stride_{stride} {
+    CHECK_EQ(parent.Rank() % stride, 0);
+    CHECK_EQ(parent.World() % stride, 0);
+    this->world_ = parent.World() / stride;
+    this->rank_ = parent.Rank() / stride;
+  }
+  [[nodiscard]] std::shared_ptr<Channel> Chan(std::int32_t rank) const override {
+    return parent_.Chan(rank * stride_);
+  }
+  [[nodiscard]] Result Block() const override { return parent_.Block(); }
+  [[nodiscard]] bool IsFederated() const override { return parent_.IsFederated(); }
+  [[nodiscard]] Result LogTracker(std::string msg) const override {
+    return parent_.LogTracker(std::move(msg));
+  }
+  [[nodiscard]] Result Shutdown() override { return Success(); }
+};
+}  // namespace
+
 Result RingAllreduce(Comm const& comm, common::Span<std::int8_t> data, Func const& op,
                      ArrayInterfaceHandler::Type type) {
   if (comm.World() == 1) {
@@ -147,4 +179,66 @@ Result RingAllreduce(Comm const& comm, common::Span<std::int8_t> data, Func cons
     };
   });
 }
+
+Result HierarchicalAllreduce(Comm const& comm, std::int32_t group_size,
+                             common::Span<std::int8_t> data, Func const& op,
+                             ArrayInterfaceHandler::Type type) {
+  auto world = comm.World();
+  if (group_size <= 1 || group_size >= world || world % group_size != 0) {
+    return RingAllreduce(comm, data, op, type);
+  }
+  if (data.size_bytes() == 0) {
+    return Success();
+  }
+
+  auto rank = comm.Rank();
+  auto leader = rank - rank % group_size;
+
+  if (rank != leader) {
+    // Reduce into the leader, then wait for the broadcast of the final result.
+    auto ch = comm.Chan(leader);
+    auto rc = Success() << [&] {
+      return ch->SendAll(data);
+    } << [&] {
+      return comm.Block();
+    } << [&] {
+      return ch->RecvAll(data);
+    } << [&] {
+      return comm.Block();
+    };
+    if (!rc.OK()) {
+      return Fail("Hierarchical allreduce failed on rank " + std::to_string(rank), std::move(rc));
+    }
+    return rc;
+  }
+
+  // Accumulate the members of this group.
+  std::vector<std::int8_t> buffer(data.size_bytes());
+  auto s_buf = common::Span{buffer.data(), buffer.size()};
+  for (std::int32_t r = rank + 1; r < rank + group_size; ++r) {
+    auto rc = Success() << [&] {
+      return comm.Chan(r)->RecvAll(s_buf);
+    } << [&] {
+      return comm.Block();
+    };
+    if (!rc.OK()) {
+      return Fail("Hierarchical allreduce failed to gather from rank " + std::to_string(r),
+                  std::move(rc));
+    }
+    op(s_buf, data);
+  }
+
+  // Ring allreduce between the leaders only.
+  LeaderRing leaders{comm, group_size};
+  auto rc = RingAllreduce(leaders, data, op, type);
+  if (!rc.OK()) {
+    return Fail("Hierarchical allreduce failed in the leader ring.", std::move(rc));
+  }
+
+  // Broadcast the result back to the members.
+  for (std::int32_t r = rank + 1; r < rank + group_size; ++r) {
+    rc = std::move(rc) << [&] { return comm.Chan(r)->SendAll(data); };
+  }
+  return std::move(rc) << [&] { return comm.Block(); };
+}
 }  // namespace xgboost::collective::cpu_impl
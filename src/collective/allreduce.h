@@ -4,6 +4,7 @@
 #pragma once
 #include <cstdint>      // for int8_t
 #include <functional>   // for function
+#include <future>       // for async, launch
 #include <type_traits>  // for is_invocable_v, enable_if_t
 #include <vector>       // for vector
 
@@ -22,6 +23,21 @@ using Func =
 
 Result RingAllreduce(Comm const& comm, common::Span<std::int8_t> data, Func const& op,
                      ArrayInterfaceHandler::Type type);
+
+/**
+ * @brief Two-level allreduce for workers grouped into nodes.
+ *
+ * Ranks are partitioned into consecutive groups of `group_size`, which matches how most
+ * launchers assign ranks to machines.  Each group first reduces into its leader, the
+ * leaders then run a ring allreduce among themselves, and finally the result is
+ * broadcast back within each group.  This keeps the long-haul traffic on a ring of one
+ * rank per node instead of a flat ring over all workers.
+ *
+ * Falls back to @ref RingAllreduce when the group size doesn't partition the world.
+ */
+Result HierarchicalAllreduce(Comm const& comm, std::int32_t group_size,
+                             common::Span<std::int8_t> data, Func const& op,
+                             ArrayInterfaceHandler::Type type);
 }  // namespace cpu_impl
 
 template <typename T, typename Fn>
@@ -59,6 +75,22 @@ template <typename T, std::int32_t kDim>
   return Allreduce(ctx, *GlobalCommGroup(), data, op);
 }
 
+/**
+ * @brief Launch an allreduce on a background thread so the caller can overlap the
+ *        communication with local compute.  See @ref PendingCollective for the
+ *        restrictions on the buffer and on concurrent collectives.
+ *
+ * The communicator group is resolved on the calling thread since the global group is
+ * thread-local; it must not be finalized while the collective is in flight.
+ */
+template <typename T, std::int32_t kDim>
+[[nodiscard]] PendingCollective AllreduceAsync(Context const* ctx,
+                                               linalg::TensorView<T, kDim> data, Op op) {
+  CommGroup const* pcomm = GlobalCommGroup().get();
+  return PendingCollective{std::async(
+      std::launch::async, [ctx, pcomm, data, op] { return Allreduce(ctx, *pcomm, data, op); })};
+}
+
 /**
  * @brief Specialization for std::vector.
  */
@@ -31,10 +31,75 @@ bool constexpr IsFloatingPointV() {
 #endif  // defined(XGBOOST_USE_CUDA)
 }
 
+template <typename T>
+[[nodiscard]] Result Coll::CompressedAllreduceSum(Comm const& comm, common::Span<T> values) {
+  auto run = [&](auto encode, auto decode) -> Result {
+    if (residual_.size() != values.size()) {
+      residual_.assign(values.size(), 0.0);
+    }
+    std::vector<std::uint16_t> wire(values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      // Fold the quantization error of the previous round back in before encoding, so
+      // the error stays bounded instead of accumulating across rounds.
+      double compensated = static_cast<double>(values[i]) + residual_[i];
+      auto q = encode(static_cast<float>(compensated));
+      wire[i] = q;
+      residual_[i] = compensated - static_cast<double>(decode(q));
+    }
+
+    auto erased = common::EraseType(common::Span{wire.data(), wire.size()});
+    auto erased_fn = [&](common::Span<std::int8_t const> lhs, common::Span<std::int8_t> out) {
+      auto l = common::RestoreType<std::uint16_t const>(lhs);
+      auto o = common::RestoreType<std::uint16_t>(out);
+      for (std::size_t i = 0; i < l.size(); ++i) {
+        o[i] = encode(decode(l[i]) + decode(o[i]));
+      }
+    };
+    Result rc;
+    if (allreduce_group_ > 1) {
+      rc = cpu_impl::HierarchicalAllreduce(comm, allreduce_group_, erased, erased_fn,
+                                           ArrayInterfaceHandler::kU2);
+    } else {
+      rc = cpu_impl::RingAllreduce(comm, erased, erased_fn, ArrayInterfaceHandler::kU2);
+    }
+    if (!rc.OK()) {
+      return rc;
+    }
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      values[i] = static_cast<T>(decode(wire[i]));
+    }
+    return rc;
+  };
+
+  switch (codec_) {
+    case ReduceCodec::kFp16:
+      return run([](float v) { return EncodeFp16(v); },
+                 [](std::uint16_t q) { return DecodeFp16(q); });
+    case ReduceCodec::kBf16:
+      return run([](float v) { return EncodeBf16(v); },
+                 [](std::uint16_t q) { return DecodeBf16(q); });
+    case ReduceCodec::kNone:
+      break;
+  }
+  return Fail("No codec configured for the compressed allreduce.");
+}
+
 [[nodiscard]] Result Coll::Allreduce(Comm const& comm, common::Span<std::int8_t> data,
                                      ArrayInterfaceHandler::Type type, Op op) {
   namespace coll = ::xgboost::collective;
 
+  if (codec_ != ReduceCodec::kNone && op == Op::kSum) {
+    // Compress only floating point sums, everything else stays bit-exact.
+    if (type == ArrayInterfaceHandler::kF4) {
+      auto rc = this->CompressedAllreduceSum(comm, common::RestoreType<float>(data));
+      return std::move(rc) << [&] { return comm.Block(); };
+    }
+    if (type == ArrayInterfaceHandler::kF8) {
+      auto rc = this->CompressedAllreduceSum(comm, common::RestoreType<double>(data));
+      return std::move(rc) << [&] { return comm.Block(); };
+    }
+  }
+
   auto redop_fn = [](auto lhs, auto out, auto elem_op) {
     auto p_lhs = lhs.data();
     auto p_out = out.data();
@@ -58,6 +123,9 @@ bool constexpr IsFloatingPointV() {
       redop_fn(lhs_t, rhs_t, elem_op);
     };
 
+    if (allreduce_group_ > 1) {
+      return cpu_impl::HierarchicalAllreduce(comm, allreduce_group_, data, erased_fn, type);
+    }
     return cpu_impl::RingAllreduce(comm, data, erased_fn, type);
   };
 
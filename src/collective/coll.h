@@ -4,8 +4,10 @@
 #pragma once
 #include <cstdint>  // for int8_t, int64_t
 #include <memory>   // for enable_shared_from_this
+#include <vector>   // for vector
 
 #include "../data/array_interface.h"    // for ArrayInterfaceHandler
+#include "codec.h"                      // for ReduceCodec
 #include "comm.h"                       // for Comm
 #include "xgboost/collective/result.h"  // for Result
 #include "xgboost/span.h"               // for Span
@@ -20,8 +22,32 @@ enum class AllgatherVAlgo {
  * @brief Interface and base implementation for collective.
  */
 class Coll : public std::enable_shared_from_this<Coll> {
+  // Number of consecutive ranks per node for hierarchical allreduce, 0 or 1 for the flat
+  // ring.
+  std::int32_t allreduce_group_{0};
+  // Optional 16-bit wire codec for floating point sum allreduce.
+  ReduceCodec codec_{ReduceCodec::kNone};
+  // Local quantization error carried into the next round.  Sized for the last payload;
+  // feedback is only effective when consecutive rounds reduce same-sized payloads, which
+  // holds for the histogram sums the codec targets.
+  std::vector<double> residual_;
+
+  /**
+   * @brief Sum allreduce through the 16-bit wire format with error-feedback
+   *        accumulation.
+   */
+  template <typename T>
+  [[nodiscard]] Result CompressedAllreduceSum(Comm const& comm, common::Span<T> values);
+
  public:
   Coll() = default;
+  /**
+   * @param allreduce_group Workers per node, enables the two-level allreduce when the
+   *        world size is a multiple of it.
+   * @param codec Wire codec for floating point sums, must match on all workers.
+   */
+  explicit Coll(std::int32_t allreduce_group, ReduceCodec codec = ReduceCodec::kNone)
+      : allreduce_group_{allreduce_group}, codec_{codec} {}
   virtual ~Coll() noexcept(false) {}  // NOLINT
 
   virtual Coll* MakeCUDAVar();
@@ -16,6 +16,7 @@
 #endif                                  // !defined(XGBOOST_USE_NCCL)
 #include "allgather.h"                  // for RingAllgather
 #include "protocol.h"                   // for kMagic
+#include "transport.h"                  // for MakeTransportChannel
 #include "xgboost/base.h"               // for XGBOOST_STRICT_R_MODE
 #include "xgboost/collective/socket.h"  // for TCPSocket
 #include "xgboost/json.h"               // for Json, Object
@@ -26,6 +27,30 @@ Comm::Comm(std::string const& host, std::int32_t port, std::chrono::seconds time
            std::int32_t retry, std::string task_id)
     : timeout_{timeout}, retry_{retry}, tracker_{host, port, -1}, task_id_{std::move(task_id)} {}
 
+[[nodiscard]] Result Comm::Block() const {
+  // Flush the coalescing window of every channel before waiting.  Flushing only the
+  // channel being waited on is not enough: a worker may block on its ring prev while its
+  // peer blocks on a small write coalesced on the ring next.
+  auto rc = Success();
+  for (auto const& ch : channels_) {
+    if (ch && ch->Socket()) {
+      rc = ch->FlushSend();
+      if (!rc.OK()) {
+        return rc;
+      }
+    }
+  }
+  rc = loop_->Block();
+  if (rc.OK()) {
+    for (auto const& ch : channels_) {
+      if (ch) {
+        ch->ReleaseSent();
+      }
+    }
+  }
+  return rc;
+}
+
 Result ConnectTrackerImpl(proto::PeerInfo info, std::chrono::seconds timeout, std::int32_t retry,
                           std::string const& task_id, TCPSocket* out, std::int32_t rank,
                           std::int32_t world) {
@@ -203,9 +228,12 @@ std::string InitLog(std::string task_id, std::int32_t rank) {
 
 RabitComm::RabitComm(std::string const& tracker_host, std::int32_t tracker_port,
                      std::chrono::seconds timeout, std::int32_t retry, std::string task_id,
-                     StringView nccl_path)
+                     StringView nccl_path, StringView transport, bool elastic, StringView zone)
     : HostComm{tracker_host, tracker_port, timeout, retry, std::move(task_id)},
-      nccl_path_{std::move(nccl_path)} {
+      nccl_path_{std::move(nccl_path)},
+      transport_{std::move(transport)},
+      elastic_{elastic},
+      zone_{std::move(zone)} {
   if (this->TrackerInfo().host.empty()) {
     // Not in a distributed environment.
     LOG(CONSOLE) << InitLog(task_id_, rank_);
@@ -266,7 +294,7 @@ Comm* RabitComm::MakeCUDAVar(Context const*, std::shared_ptr<Coll>) const {
   }
   error_port_ = eport;
 
-  error_worker_ = std::thread{[error_sock = std::move(error_sock)] {
+  error_worker_ = std::thread{[error_sock = std::move(error_sock), elastic = this->elastic_] {
     TCPSocket conn;
     SockAddress addr;
     auto rc = error_sock->Accept(&conn, &addr);
@@ -290,6 +318,15 @@ Comm* RabitComm::MakeCUDAVar(Context const*, std::shared_ptr<Coll>) const {
       return;  // shutdown
     }
 
+    if (elastic) {
+      // Keep the process alive: pending collectives fail when the dead peer's sockets
+      // close, the caller catches the error and re-initializes the group in-process.
+      // The DMatrix and the model survive, only the communicator is rebuilt.
+      LOG(WARNING) << "Another worker is running into error. The communicator group must "
+                      "be re-initialized before training can continue.";
+      return;
+    }
+
     LOG(WARNING) << "Another worker is running into error.";
 #if !defined(XGBOOST_STRICT_R_MODE) || XGBOOST_STRICT_R_MODE == 0
     // exit is nicer than abort as the former performs cleanups.
@@ -304,7 +341,7 @@ Comm* RabitComm::MakeCUDAVar(Context const*, std::shared_ptr<Coll>) const {
   error_worker_.detach();
 
   proto::Start start;
-  rc = std::move(rc) << [&] { return start.WorkerSend(lport, &tracker, eport); }
+  rc = std::move(rc) << [&] { return start.WorkerSend(lport, &tracker, eport, zone_); }
                      << [&] { return start.WorkerRecv(&tracker, &world); };
   if (!rc.OK()) {
     return rc;
@@ -344,7 +381,12 @@ Comm* RabitComm::MakeCUDAVar(Context const*, std::shared_ptr<Coll>) const {
     if (!rc.OK()) {
       return rc;
     }
-    this->channels_.emplace_back(std::make_shared<Channel>(*this, w));
+    std::shared_ptr<Channel> ch;
+    rc = MakeTransportChannel(*this, w, transport_, &ch);
+    if (!rc.OK()) {
+      return Fail("Failed to create the worker channel.", std::move(rc));
+    }
+    this->channels_.emplace_back(std::move(ch));
   }
 
   LOG(CONSOLE) << InitLog(task_id_, rank_);
@@ -5,6 +5,7 @@
 #include <chrono>   // for seconds
 #include <cstddef>  // for size_t
 #include <cstdint>  // for int32_t, int64_t
+#include <future>   // for future
 #include <memory>   // for shared_ptr
 #include <string>   // for string
 #include <thread>   // for thread
@@ -96,7 +97,11 @@ class Comm : public std::enable_shared_from_this<Comm> {
     CHECK(loop_);
     loop_->Submit(std::move(op));
   }
-  [[nodiscard]] virtual Result Block() const { return loop_->Block(); }
+  /**
+   * @brief Tracing statistics of the event loop, see Loop::Stats.
+   */
+  [[nodiscard]] Json LoopStats() const { return loop_ ? loop_->Stats() : Json{Object{}}; }
+  [[nodiscard]] virtual Result Block() const;
 
   [[nodiscard]] virtual std::shared_ptr<Channel> Chan(std::int32_t rank) const {
     return channels_.at(rank);
@@ -127,6 +132,14 @@ class HostComm : public Comm {
 
 class RabitComm : public HostComm {
   std::string nccl_path_ = std::string{DefaultNcclName()};
+  // Data transport for the worker channels, `tcp` or `verbs`.
+  std::string transport_{"tcp"};
+  // In elastic mode a worker survives the error signal from the tracker so the caller
+  // can re-initialize the group in-process instead of restarting the job.
+  bool elastic_{false};
+  // Locality hint (rack or availability zone) reported to the tracker for
+  // topology-aware rank assignment.
+  std::string zone_;
 
   [[nodiscard]] Result Bootstrap(std::chrono::seconds timeout, std::int32_t retry,
                                  std::string task_id);
@@ -136,7 +149,8 @@ class RabitComm : public HostComm {
   RabitComm() = default;
   RabitComm(std::string const& tracker_host, std::int32_t tracker_port,
             std::chrono::seconds timeout, std::int32_t retry, std::string task_id,
-            StringView nccl_path);
+            StringView nccl_path, StringView transport = "tcp", bool elastic = false,
+            StringView zone = {});
   ~RabitComm() noexcept(false) override;
 
   [[nodiscard]] bool IsFederated() const override { return false; }
@@ -155,14 +169,58 @@ class Channel {
   std::shared_ptr<TCPSocket> sock_{nullptr};
   Result rc_;
   Comm const& comm_;
+  // Nagle-style coalescing window: writes smaller than the window are appended here and
+  // submitted as a single op once the window fills or the caller synchronizes, instead
+  // of one loop op (and eventually one syscall) each.
+  std::vector<std::int8_t> pending_;
+  // Buffers referenced by in-flight coalesced ops; released after the next block.
+  std::vector<std::unique_ptr<std::vector<std::int8_t>>> in_flight_;
 
  public:
+  // Coalescing window for small writes.
+  static constexpr std::size_t kCoalesceBytes = 4096;
+
   explicit Channel(Comm const& comm, std::shared_ptr<TCPSocket> sock)
       : sock_{std::move(sock)}, comm_{comm} {}
 
+  /**
+   * @brief Submit the coalesced small writes to the event loop.
+   *
+   * Called by @ref Comm::Block for every channel before waiting: a peer might be blocked
+   * on one of the pending writes.
+   */
+  [[nodiscard]] Result FlushSend() {
+    if (pending_.empty()) {
+      return Success();
+    }
+    auto buf = std::make_unique<std::vector<std::int8_t>>(std::move(pending_));
+    pending_.clear();
+    Loop::Op op{Loop::Op::kWrite, comm_.Rank(), buf->data(), buf->size(), sock_.get(), 0};
+    CHECK(sock_.get());
+    comm_.Submit(std::move(op));
+    in_flight_.push_back(std::move(buf));
+    return Success();
+  }
+  /** @brief Release the coalescing buffers once their ops have finished. */
+  void ReleaseSent() { in_flight_.clear(); }
+
   [[nodiscard]] virtual Result SendAll(std::int8_t const* ptr, std::size_t n) {
-    Loop::Op op{Loop::Op::kWrite, comm_.Rank(), const_cast<std::int8_t*>(ptr), n, sock_.get(), 0};
     CHECK(sock_.get());
+    if (n < kCoalesceBytes) {
+      // The caller's buffer may be reused right away, the coalescing window owns a copy.
+      pending_.insert(pending_.end(), ptr, ptr + n);
+      if (pending_.size() >= kCoalesceBytes) {
+        return this->FlushSend();
+      }
+      return Success();
+    }
+    // Large writes go out directly, after the pending small ones to preserve the stream
+    // order.
+    auto rc = this->FlushSend();
+    if (!rc.OK()) {
+      return rc;
+    }
+    Loop::Op op{Loop::Op::kWrite, comm_.Rank(), const_cast<std::int8_t*>(ptr), n, sock_.get(), 0};
     comm_.Submit(std::move(op));
     return Success();
   }
@@ -181,8 +239,43 @@ class Channel {
   }
 
   [[nodiscard]] auto Socket() const { return sock_; }
-  [[nodiscard]] virtual Result Block() { return comm_.Block(); }
+  [[nodiscard]] virtual Result Block() {
+    // The channel may not be registered with the communicator (the bootstrap ring
+    // channels are not), so @ref Comm::Block does not see its coalescing window.  Flush
+    // it here before waiting, a peer might be blocked on one of the pending writes.
+    auto rc = this->FlushSend();
+    if (!rc.OK()) {
+      return rc;
+    }
+    rc = comm_.Block();
+    if (rc.OK()) {
+      this->ReleaseSent();
+    }
+    return rc;
+  }
 };
 
 enum class Op { kMax = 0, kMin = 1, kSum = 2, kBitwiseAND = 3, kBitwiseOR = 4, kBitwiseXOR = 5 };
+
+/**
+ * @brief Handle to a collective operation running on a background thread.
+ *
+ * Lets the caller overlap communication with local compute.  The data buffer must stay
+ * alive and untouched until @ref Get returns, and no other collective may be issued on
+ * the same communicator while one is in flight -- the socket loop processes a single
+ * collective at a time.
+ */
+class PendingCollective {
+  std::future<Result> fut_;
+
+ public:
+  PendingCollective() = default;
+  explicit PendingCollective(std::future<Result>&& fut) : fut_{std::move(fut)} {}
+
+  [[nodiscard]] bool Valid() const { return fut_.valid(); }
+  /**
+   * @brief Block until the collective finishes.  Can only be called once.
+   */
+  [[nodiscard]] Result Get() { return fut_.get(); }
+};
 }  // namespace xgboost::collective
@@ -83,11 +83,29 @@ CommGroup::CommGroup()
     auto tracker_host = get_param("dmlc_tracker_uri", std::string{}, String{});
     auto tracker_port = get_param("dmlc_tracker_port", static_cast<std::int64_t>(0), Integer{});
     auto nccl = get_param("dmlc_nccl_path", std::string{DefaultNcclName()}, String{});
+    // Number of consecutive ranks running on the same node. When set, the CPU allreduce
+    // reduces within each node first and only the node leaders join the cross-node ring.
+    // The NCCL backend is unaffected as NCCL picks its own topology.
+    auto group = get_param("dmlc_allreduce_group_size", static_cast<std::int64_t>(0), Integer{});
+    // Optional 16-bit wire codec (`fp16` or `bf16`) for floating point sum allreduce,
+    // must be configured identically on all workers.  The NCCL backend is unaffected.
+    auto codec = get_param("dmlc_allreduce_codec", std::string{}, String{});
+    // Data transport for the worker channels, `tcp` (default) or `verbs` for RDMA.
+    auto transport = get_param("dmlc_transport", std::string{"tcp"}, String{});
+    // Elastic membership: on a peer failure the worker survives the error signal so the
+    // caller can re-initialize the group (and rebroadcast the model) without restarting
+    // the process.
+    auto elastic = get_param("dmlc_elastic", static_cast<std::int64_t>(0), Integer{});
+    // Locality hint (rack or availability zone).  Workers sharing a zone are placed on
+    // adjacent ring ranks to minimize cross-zone hops.
+    auto zone = get_param("dmlc_zone", std::string{}, String{});
     auto ptr = new CommGroup{
         std::shared_ptr<RabitComm>{new RabitComm{  // NOLINT
             tracker_host, static_cast<std::int32_t>(tracker_port), std::chrono::seconds{timeout},
-            static_cast<std::int32_t>(retry), task_id, nccl}},
-        std::shared_ptr<Coll>(new Coll{})};  // NOLINT
+            static_cast<std::int32_t>(retry), task_id, nccl, transport,
+            static_cast<bool>(elastic), zone}},
+        std::shared_ptr<Coll>(new Coll{static_cast<std::int32_t>(group),  // NOLINT
+                                       ParseReduceCodec(codec)})};
     return ptr;
   } else if (type == "federated") {
 #if defined(XGBOOST_USE_FEDERATED)
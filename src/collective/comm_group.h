@@ -60,6 +60,7 @@ class CommGroup {
   [[nodiscard]] Result ProcessorName(std::string* out) const {
     return this->comm_->ProcessorName(out);
   }
+  [[nodiscard]] Json LoopStats() const { return this->comm_->LoopStats(); }
 };
 
 std::unique_ptr<collective::CommGroup>& GlobalCommGroup();
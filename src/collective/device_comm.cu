@@ -0,0 +1,50 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#if defined(XGBOOST_USE_NCCL)
+#include <cstddef>  // for size_t
+#include <memory>   // for make_shared
+#include <utility>  // for move
+
+#include "device_comm.cuh"
+#include "xgboost/logging.h"
+
+namespace xgboost::collective {
+DeviceCommGroup::DeviceCommGroup(std::string const& path, std::vector<std::int32_t> ordinals)
+    : stub_{std::make_shared<NcclStub>(path)}, ordinals_{std::move(ordinals)} {
+  CHECK(!ordinals_.empty());
+  comms_.resize(ordinals_.size(), nullptr);
+  auto rc = stub_->CommInitAll(comms_.data(), static_cast<int>(ordinals_.size()),
+                               ordinals_.data());
+  SafeColl(rc);
+}
+
+DeviceCommGroup::~DeviceCommGroup() {
+  for (auto comm : comms_) {
+    if (comm) {
+      auto rc = stub_->CommDestroy(comm);
+      if (!rc.OK()) {
+        LOG(WARNING) << rc.Report();
+      }
+    }
+  }
+}
+
+[[nodiscard]] Result DeviceCommGroup::AllreduceSum(
+    std::vector<common::Span<std::int64_t>> const& data,
+    std::vector<cudaStream_t> const& streams) const {
+  CHECK_EQ(data.size(), comms_.size());
+  CHECK_EQ(streams.size(), comms_.size());
+  auto rc = stub_->GroupStart();
+  for (std::size_t r = 0; r < comms_.size() && rc.OK(); ++r) {
+    rc = std::move(rc) << [&] {
+      return stub_->Allreduce(data[r].data(), data[r].data(), data[r].size(), ncclInt64, ncclSum,
+                              comms_[r], streams[r]);
+    };
+  }
+  // Close the group even if one of the ranks failed, otherwise the communicators are
+  // left in a corrupted state.
+  return std::move(rc) << [&] { return stub_->GroupEnd(); };
+}
+}  // namespace xgboost::collective
+#endif  // defined(XGBOOST_USE_NCCL)
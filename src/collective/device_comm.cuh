@@ -0,0 +1,58 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#pragma once
+#if defined(XGBOOST_USE_NCCL)
+#include <cstdint>  // for int32_t, int64_t
+#include <memory>   // for shared_ptr
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "nccl_stub.h"                  // for NcclStub
+#include "xgboost/collective/result.h"  // for Result
+#include "xgboost/span.h"               // for Span
+
+namespace xgboost::collective {
+/**
+ * @brief NCCL communicators for every device owned by a single process.
+ *
+ * Unlike @ref NCCLComm, which joins a distributed group bootstrapped through the
+ * tracker, this initializes all ranks at once with `ncclCommInitAll`: one driver thread
+ * owns every local device and issues grouped peer-to-peer calls.  There is no tracker,
+ * no rank-to-process mapping, and no interaction with the global communicator group.
+ *
+ * This is the communication layer for in-process data-parallel training, where a single
+ * `Learner` shards rows across the local devices and reduces histograms directly.
+ */
+class DeviceCommGroup {
+  std::shared_ptr<NcclStub> stub_;
+  std::vector<std::int32_t> ordinals_;
+  std::vector<ncclComm_t> comms_;
+
+ public:
+  /**
+   * @param path Path to the NCCL shared object, used when XGBoost is built to load NCCL
+   *             at runtime.
+   * @param ordinals Device ordinals to include, one rank per device.
+   */
+  DeviceCommGroup(std::string const& path, std::vector<std::int32_t> ordinals);
+  ~DeviceCommGroup();
+
+  DeviceCommGroup(DeviceCommGroup const&) = delete;
+  DeviceCommGroup& operator=(DeviceCommGroup const&) = delete;
+
+  [[nodiscard]] std::int32_t World() const { return static_cast<std::int32_t>(comms_.size()); }
+  [[nodiscard]] ncclComm_t Handle(std::int32_t r) const { return comms_.at(r); }
+  [[nodiscard]] std::int32_t Ordinal(std::int32_t r) const { return ordinals_.at(r); }
+
+  /**
+   * @brief Sum the per-device buffers in place, one buffer and stream per device.
+   *
+   * All calls are issued inside a single NCCL group so the ranks progress together even
+   * though they share one driver thread.
+   */
+  [[nodiscard]] Result AllreduceSum(std::vector<common::Span<std::int64_t>> const& data,
+                                    std::vector<cudaStream_t> const& streams) const;
+};
+}  // namespace xgboost::collective
+#endif  // defined(XGBOOST_USE_NCCL)
@@ -3,21 +3,30 @@
  */
 #include "loop.h"
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>  // for readv, writev, iovec
+#endif  // defined(__unix__) || defined(__APPLE__)
+
+#include <algorithm>  // for min
 #include <cstddef>    // for size_t
-#include <cstdint>    // for int32_t
+#include <cstdint>    // for int32_t, int64_t
 #include <exception>  // for exception, current_exception, rethrow_exception
 #include <future>     // for promise
+#include <map>        // for map
 #include <memory>     // for make_shared
 #include <mutex>      // for lock_guard, unique_lock
 #include <queue>      // for queue
 #include <string>     // for string
 #include <thread>     // for thread
-#include <utility>    // for move
+#include <utility>    // for move, pair
+#include <vector>     // for vector
 
+#include "../common/stats.h"                // for Quantile
 #include "../common/threading_utils.h"      // for NameThread
 #include "xgboost/collective/poll_utils.h"  // for PollHelper
 #include "xgboost/collective/result.h"      // for Fail, Success
 #include "xgboost/collective/socket.h"      // for FailWithCode
+#include "xgboost/context.h"                // for Context
 #include "xgboost/logging.h"                // for CHECK
 
 namespace xgboost::collective {
@@ -44,6 +53,9 @@ Result Loop::ProcessQueue(std::queue<Op>* p_queue) const {
     for (std::size_t i = 0; i < n_ops; ++i) {
       auto op = std::move(qcopy.front());
       qcopy.pop();
+      if (op.begin == std::chrono::steady_clock::time_point{}) {
+        op.begin = std::chrono::steady_clock::now();
+      }
 
       switch (op.code) {
         case Op::kRead: {
@@ -80,61 +92,122 @@ Result Loop::ProcessQueue(std::queue<Op>* p_queue) const {
     // We wonldn't be here if the queue is empty.
     CHECK(!qcopy.empty());
 
-    // Iterate through all the ops for performing the operations
+    // Execute the ready ops.  Ops on the same socket and direction are coalesced into a
+    // single scatter-gather syscall: fine-grained collective calls can queue thousands
+    // of small reads and writes per round, and one readv/writev per channel replaces one
+    // syscall per op.
+    std::vector<Op> ops;
+    ops.reserve(n_ops);
     for (std::size_t i = 0; i < n_ops; ++i) {
-      auto op = std::move(qcopy.front());
+      ops.push_back(std::move(qcopy.front()));
       qcopy.pop();
+    }
+    std::vector<std::int64_t> n_done(n_ops, 0);
 
-      std::int32_t n_bytes_done{0};
-      if (!op.sock) {
-        CHECK(op.code == Op::kSleep);
-      } else {
-        CHECK(op.sock->NonBlocking());
+    // Group the op indices by socket and direction.  The relative order of ops within a
+    // socket is preserved, which is all the TCP stream requires.
+    std::map<std::pair<TCPSocket*, std::int32_t>, std::vector<std::size_t>> groups;
+    for (std::size_t i = 0; i < n_ops; ++i) {
+      auto const& op = ops[i];
+      if (op.code == Op::kSleep) {
+        // For testing only.
+        CHECK(!op.sock);
+        std::this_thread::sleep_for(std::chrono::seconds{op.n});
+        n_done[i] = op.n;
+        continue;
       }
+      if (op.code != Op::kRead && op.code != Op::kWrite) {
+        error(op);
+        return Fail("Invalid socket operation.");
+      }
+      CHECK(op.sock->NonBlocking());
+      groups[std::make_pair(op.sock, static_cast<std::int32_t>(op.code))].push_back(i);
+    }
 
-      switch (op.code) {
-        case Op::kRead: {
-          if (poll.CheckRead(*op.sock)) {
-            n_bytes_done = op.sock->Recv(op.ptr + op.off, op.n - op.off);
-            if (n_bytes_done == 0) {
-              error(op);
-              return Fail("Encountered EOF. The other end is likely closed.",
-                          op.sock->GetSockError());
-            }
-          }
-          break;
+    for (auto const& [key, idx] : groups) {
+      auto* sock = key.first;
+      auto code = static_cast<Op::Code>(key.second);
+      bool ready = code == Op::kRead ? poll.CheckRead(*sock) : poll.CheckWrite(*sock);
+      if (!ready) {
+        continue;  // no progress, the whole group is pushed back for the next round.
+      }
+
+#if defined(__unix__) || defined(__APPLE__)
+      constexpr std::size_t kMaxIov = 64;
+      std::size_t k = 0;
+      bool more = true;
+      while (k < idx.size() && more) {
+        std::size_t cnt = std::min(kMaxIov, idx.size() - k);
+        struct iovec iov[kMaxIov];
+        std::size_t expected = 0;
+        for (std::size_t j = 0; j < cnt; ++j) {
+          auto const& op = ops[idx[k + j]];
+          iov[j].iov_base = op.ptr + op.off;
+          iov[j].iov_len = op.n - op.off;
+          expected += iov[j].iov_len;
         }
-        case Op::kWrite: {
-          if (poll.CheckWrite(*op.sock)) {
-            n_bytes_done = op.sock->Send(op.ptr + op.off, op.n - op.off);
+        ssize_t ret = code == Op::kRead ? readv(sock->Handle(), iov, static_cast<int>(cnt))
+                                        : writev(sock->Handle(), iov, static_cast<int>(cnt));
+        if (ret == 0 && code == Op::kRead && expected != 0) {
+          error(ops[idx[k]]);
+          return Fail("Encountered EOF. The other end is likely closed.", sock->GetSockError());
+        }
+        if (ret == -1) {
+          if (!system::LastErrorWouldBlock()) {
+            auto rc = system::FailWithCode("Invalid socket output.");
+            error(ops[idx[k]]);
+            return rc;
           }
-          break;
+          break;  // would block, no progress this round.
         }
-        case Op::kSleep: {
-          // For testing only.
-          std::this_thread::sleep_for(std::chrono::seconds{op.n});
-          n_bytes_done = op.n;
-          break;
+        // Distribute the transferred bytes over the batched ops in order.
+        auto remain = static_cast<std::size_t>(ret);
+        for (std::size_t j = 0; j < cnt; ++j) {
+          auto take = std::min(remain, static_cast<std::size_t>(iov[j].iov_len));
+          n_done[idx[k + j]] = static_cast<std::int64_t>(take);
+          remain -= take;
         }
-        default: {
+        // A short transfer means the socket buffer is drained or full, stop here.
+        more = static_cast<std::size_t>(ret) == expected;
+        k += cnt;
+      }
+#else
+      // No vectored I/O, one syscall per op.
+      for (auto i : idx) {
+        auto const& op = ops[i];
+        std::int64_t ret = code == Op::kRead ? op.sock->Recv(op.ptr + op.off, op.n - op.off)
+                                             : op.sock->Send(op.ptr + op.off, op.n - op.off);
+        if (ret == 0 && code == Op::kRead) {
           error(op);
-          return Fail("Invalid socket operation.");
+          return Fail("Encountered EOF. The other end is likely closed.", sock->GetSockError());
+        }
+        if (ret == -1) {
+          if (!system::LastErrorWouldBlock()) {
+            auto rc = system::FailWithCode("Invalid socket output.");
+            error(op);
+            return rc;
+          }
+          break;  // would block, no progress this round.
+        }
+        n_done[i] = ret;
+        if (static_cast<std::size_t>(ret) != op.n - op.off) {
+          break;
         }
       }
+#endif  // defined(__unix__) || defined(__APPLE__)
+    }
 
-      if (n_bytes_done == -1 && !system::LastErrorWouldBlock()) {
-        auto rc = system::FailWithCode("Invalid socket output.");
-        error(op);
-        return rc;
-      }
-
-      op.off += n_bytes_done;
+    // Advance the offsets in submission order and push back the unfinished ops.
+    for (std::size_t i = 0; i < n_ops; ++i) {
+      auto op = ops[i];
+      op.off += n_done[i];
       CHECK_LE(op.off, op.n);
 
       if (op.off != op.n) {
         // not yet finished, push back to queue for the next round.
         qcopy.push(op);
       } else {
+        this->RecordTrace(op);
         op.pr->set_value();
       }
     }
@@ -144,6 +217,62 @@ Result Loop::ProcessQueue(std::queue<Op>* p_queue) const {
   return Success();
 }
 
+void Loop::RecordTrace(Op const& op) const {
+  if (op.code != Op::kRead && op.code != Op::kWrite) {
+    return;
+  }
+  auto now = std::chrono::steady_clock::now();
+  using Us = std::chrono::duration<float, std::micro>;
+  TraceEvent e{op.code, op.n, Us{op.begin - op.submit}.count(), Us{now - op.begin}.count()};
+
+  std::lock_guard<std::mutex> guard{trace_mu_};
+  if (trace_.size() < kTraceSize) {
+    trace_.push_back(e);
+  } else {
+    trace_[trace_next_] = e;
+  }
+  trace_next_ = (trace_next_ + 1) % kTraceSize;
+}
+
+[[nodiscard]] Json Loop::Stats() const {
+  std::vector<TraceEvent> events;
+  {
+    std::lock_guard<std::mutex> guard{trace_mu_};
+    events = trace_;
+  }
+
+  Context ctx;
+  Json stats{Object{}};
+  for (auto [code, name] : {std::pair{Op::kRead, "read"}, std::pair{Op::kWrite, "write"}}) {
+    std::size_t n_bytes{0};
+    std::vector<float> queue_us, wire_us;
+    for (auto const& e : events) {
+      if (e.code != code) {
+        continue;
+      }
+      n_bytes += e.n_bytes;
+      queue_us.push_back(e.queue_us);
+      wire_us.push_back(e.wire_us);
+    }
+
+    Json summary{Object{}};
+    summary["count"] = Integer{static_cast<Integer::Int>(queue_us.size())};
+    summary["bytes"] = Integer{static_cast<Integer::Int>(n_bytes)};
+    auto q = [&](std::vector<float> const& values, double alpha) {
+      return values.empty() ? 0.0f : common::Quantile(&ctx, alpha, values.cbegin(), values.cend());
+    };
+    for (auto [values, metric] :
+         {std::pair{&queue_us, "queue_us"}, std::pair{&wire_us, "wire_us"}}) {
+      Json percentiles{Object{}};
+      percentiles["p50"] = Number{q(*values, 0.5)};
+      percentiles["p99"] = Number{q(*values, 0.99)};
+      summary[metric] = std::move(percentiles);
+    }
+    stats[name] = std::move(summary);
+  }
+  return stats;
+}
+
 void Loop::Process() {
   auto set_rc = [this](Result&& rc) {
     std::lock_guard lock{rc_lock_};
@@ -260,6 +389,7 @@ Result Loop::Stop() {
 void Loop::Submit(Op op) {
   auto p = std::make_shared<std::promise<void>>();
   op.pr = std::move(p);
+  op.submit = std::chrono::steady_clock::now();
   futures_.emplace_back(op.pr->get_future());
   CHECK_NE(op.n, 0);
 
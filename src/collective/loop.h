@@ -17,6 +17,7 @@
 #include "../common/timer.h"            // for Monitor
 #include "xgboost/collective/result.h"  // for Result
 #include "xgboost/collective/socket.h"  // for TCPSocket
+#include "xgboost/json.h"               // for Json
 
 namespace xgboost::collective {
 class Loop {
@@ -30,6 +31,9 @@ class Loop {
     TCPSocket* sock{nullptr};
     std::size_t off{0};
     std::shared_ptr<std::promise<void>> pr;
+    // Tracing timestamps: when the op was submitted, and when the worker first picked it
+    // up.  The gap between them is the queue wait, the rest is time on the wire.
+    std::chrono::steady_clock::time_point submit, begin;
 
     explicit Op(Code c) : code{c} { CHECK(c == kSleep); }
     Op(Code c, std::int32_t rank, std::int8_t* ptr, std::size_t n, TCPSocket* sock, std::size_t off)
@@ -64,6 +68,27 @@ class Loop {
   std::exception_ptr curr_exce_{nullptr};
   common::Monitor mutable timer_;
 
+  /**
+   * @brief Trace record of one finished read or write.
+   *
+   * The worker stores the most recent records in a fixed-size ring so tracing is cheap
+   * enough to stay always on.  A distributed iteration can issue hundreds of collective
+   * calls, the trace tells which of them waited in the queue and which were slow on the
+   * wire.
+   */
+  struct TraceEvent {
+    Op::Code code;
+    std::size_t n_bytes;
+    float queue_us;
+    float wire_us;
+  };
+  constexpr static std::size_t kTraceSize = 2048;
+  std::vector<TraceEvent> mutable trace_;
+  std::size_t mutable trace_next_{0};
+  std::mutex mutable trace_mu_;  // the trace is read by Stats outside the worker.
+
+  void RecordTrace(Op const& op) const;
+
   Result ProcessQueue(std::queue<Op>* p_queue) const;
   // The cunsumer function that runs inside a worker thread.
   void Process();
@@ -82,6 +107,12 @@ class Loop {
    */
   [[nodiscard]] Result Block();
 
+  /**
+   * @brief Summarize the traced ops as JSON, one entry per op type with the count, the
+   *        bytes moved, and p50/p99 of the queue wait and the wire time in microseconds.
+   */
+  [[nodiscard]] Json Stats() const;
+
   explicit Loop(std::chrono::seconds timeout);
 
   ~Loop() noexcept(false) {
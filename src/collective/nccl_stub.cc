@@ -83,6 +83,7 @@ no long bundles NCCL in the binary wheel.
   broadcast_ = safe_load(broadcast_, "ncclBroadcast");
   allgather_ = safe_load(allgather_, "ncclAllGather");
   comm_init_rank_ = safe_load(comm_init_rank_, "ncclCommInitRank");
+  comm_init_all_ = safe_load(comm_init_all_, "ncclCommInitAll");
   comm_destroy_ = safe_load(comm_destroy_, "ncclCommDestroy");
   get_uniqueid_ = safe_load(get_uniqueid_, "ncclGetUniqueId");
   send_ = safe_load(send_, "ncclSend");
@@ -105,6 +106,7 @@ no long bundles NCCL in the binary wheel.
   broadcast_ = ncclBroadcast;
   allgather_ = ncclAllGather;
   comm_init_rank_ = ncclCommInitRank;
+  comm_init_all_ = ncclCommInitAll;
   comm_destroy_ = ncclCommDestroy;
   get_uniqueid_ = ncclGetUniqueId;
   send_ = ncclSend;
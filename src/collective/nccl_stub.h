@@ -25,6 +25,7 @@ class NcclStub {
   decltype(ncclBroadcast)* broadcast_{nullptr};
   decltype(ncclAllGather)* allgather_{nullptr};
   decltype(ncclCommInitRank)* comm_init_rank_{nullptr};
+  decltype(ncclCommInitAll)* comm_init_all_{nullptr};
   decltype(ncclCommDestroy)* comm_destroy_{nullptr};
   decltype(ncclGetUniqueId)* get_uniqueid_{nullptr};
   decltype(ncclSend)* send_{nullptr};
@@ -60,6 +61,9 @@ class NcclStub {
                                     int rank) const {
     return this->GetNcclResult(this->comm_init_rank_(comm, nranks, commId, rank));
   }
+  [[nodiscard]] Result CommInitAll(ncclComm_t* comms, int ndev, int const* devlist) const {
+    return this->GetNcclResult(this->comm_init_all_(comms, ndev, devlist));
+  }
   [[nodiscard]] Result CommDestroy(ncclComm_t comm) const {
     return this->GetNcclResult(comm_destroy_(comm));
   }
@@ -117,12 +117,15 @@ class Start {
   }
 
  public:
-  [[nodiscard]] Result WorkerSend(std::int32_t lport, TCPSocket* tracker,
-                                  std::int32_t eport) const {
+  [[nodiscard]] Result WorkerSend(std::int32_t lport, TCPSocket* tracker, std::int32_t eport,
+                                  std::string const& zone = {}) const {
     Json jcmd{Object{}};
     jcmd["cmd"] = Integer{static_cast<std::int32_t>(CMD::kStart)};
     jcmd["port"] = Integer{lport};
     jcmd["error_port"] = Integer{eport};
+    // Optional locality hint (rack or availability zone) for topology-aware rank
+    // assignment on the tracker.
+    jcmd["zone"] = String{zone};
     auto scmd = Json::Dump(jcmd);
     auto n_bytes = tracker->Send(scmd);
     if (n_bytes != scmd.size()) {
@@ -145,8 +148,8 @@ class Start {
     return rc;
   }
   [[nodiscard]] Result TrackerHandle(Json jcmd, std::int32_t* recv_world, std::int32_t world,
-                                     std::int32_t* p_port, TCPSocket* p_sock,
-                                     std::int32_t* eport) const {
+                                     std::int32_t* p_port, TCPSocket* p_sock, std::int32_t* eport,
+                                     std::string* p_zone) const {
     *p_port = get<Integer const>(jcmd["port"]);
     if (*p_port <= 0) {
       return Fail("Invalid port.");
@@ -156,6 +159,12 @@ class Start {
     }
     *recv_world = world;
     *eport = get<Integer const>(jcmd["error_port"]);
+    // The zone hint is absent when an older worker connects.
+    auto const& obj = get<Object const>(jcmd);
+    auto it = obj.find("zone");
+    if (it != obj.cend()) {
+      *p_zone = get<String const>(it->second);
+    }
     return TrackerSend(world, p_sock);
   }
 };
@@ -15,10 +15,11 @@
 #include <ws2tcpip.h>
 #endif  // defined(_WIN32)
 
-#include <algorithm>  // for sort
+#include <algorithm>  // for sort, any_of
 #include <chrono>     // for seconds, ms
 #include <cstdint>    // for int32_t
 #include <memory>     // for unique_ptr
+#include <sstream>    // for stringstream
 #include <string>     // for string
 #include <utility>    // for move, forward
 
@@ -91,7 +92,7 @@ RabitTracker::WorkerProxy::WorkerProxy(std::int32_t world, TCPSocket sock, SockA
   } << [&] {
     if (cmd_ == proto::CMD::kStart) {
       proto::Start start;
-      return start.TrackerHandle(jcmd, &world_, world, &port, &sock_, &eport_);
+      return start.TrackerHandle(jcmd, &world_, world, &port, &sock_, &eport_, &zone_);
     } else if (cmd_ == proto::CMD::kPrint) {
       proto::Print print;
       return print.TrackerHandle(jcmd, &msg_);
@@ -136,6 +137,28 @@ Result RabitTracker::Bootstrap(std::vector<WorkerProxy>* p_workers) {
 
   std::sort(workers.begin(), workers.end(), WorkerCmp{this->sortby_});
 
+  // Print the resulting ring.  Promoted to console output when zone hints are in use so
+  // the cross-zone hops can be audited.
+  bool has_zone = std::any_of(workers.cbegin(), workers.cend(),
+                              [](WorkerProxy const& w) { return !w.Zone().empty(); });
+  std::stringstream ss;
+  ss << "[tracker] Ring topology: ";
+  for (std::int32_t r = 0; r < n_workers_; ++r) {
+    auto const& w = workers[r];
+    ss << w.Host();
+    if (!w.Zone().empty()) {
+      ss << "[" << w.Zone() << "]";
+    }
+    if (r + 1 != n_workers_) {
+      ss << " -> ";
+    }
+  }
+  if (has_zone) {
+    LOG(CONSOLE) << ss.str();
+  } else {
+    LOG(DEBUG) << ss.str();
+  }
+
   std::vector<std::thread> bootstrap_threads;
   for (std::int32_t r = 0; r < n_workers_; ++r) {
     auto& worker = workers[r];
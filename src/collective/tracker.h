@@ -85,6 +85,8 @@ class RabitTracker : public Tracker {
     std::int32_t eport_{0};
     std::int32_t world_{-1};
     std::string task_id_;
+    // Optional locality hint (rack or availability zone) from the worker.
+    std::string zone_;
 
     proto::CMD cmd_{proto::CMD::kInvalid};
     std::string msg_;
@@ -100,6 +102,7 @@ class RabitTracker : public Tracker {
 
     [[nodiscard]] auto Host() const { return info_.host; }
     [[nodiscard]] auto TaskID() const { return task_id_; }
+    [[nodiscard]] auto const& Zone() const { return zone_; }
     [[nodiscard]] auto Port() const { return info_.port; }
     [[nodiscard]] auto Rank() const { return info_.rank; }
     [[nodiscard]] auto ErrorPort() const { return eport_; }
@@ -112,12 +115,18 @@ class RabitTracker : public Tracker {
 
     void Send(StringView value) { this->sock_.Send(value); }
   };
-  // Provide an ordering for workers, this helps us get deterministic topology.
+  // Provide an ordering for workers, this helps us get deterministic topology.  The
+  // zone hint is the primary key: ranks follow the ring order, so keeping each zone
+  // contiguous gives exactly one ring hop per zone boundary, which is the minimum
+  // number of cross-zone hops a ring visiting every zone can have.
   struct WorkerCmp {
     SortBy sortby;
     explicit WorkerCmp(SortBy sortby) : sortby{sortby} {}
 
     [[nodiscard]] bool operator()(WorkerProxy const& lhs, WorkerProxy const& rhs) {
+      if (lhs.Zone() != rhs.Zone()) {
+        return lhs.Zone() < rhs.Zone();
+      }
       auto const& lh = sortby == Tracker::SortBy::kHost ? lhs.Host() : lhs.TaskID();
       auto const& rh = sortby == Tracker::SortBy::kHost ? rhs.Host() : rhs.TaskID();
 
@@ -0,0 +1,380 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include "transport.h"
+
+#include <memory>   // for shared_ptr, make_shared
+#include <string>   // for string
+#include <utility>  // for move
+
+#if defined(XGBOOST_USE_IBVERBS)
+#include <infiniband/verbs.h>
+
+#include <algorithm>  // for min
+#include <cstdint>    // for uint8_t, uint16_t, uint32_t
+#include <cstring>    // for memcpy, memset
+#include <queue>    // for queue
+#include <vector>   // for vector
+#endif  // defined(XGBOOST_USE_IBVERBS)
+
+#include "xgboost/collective/result.h"  // for Result, Fail, Success
+#include "xgboost/logging.h"            // for CHECK
+
+namespace xgboost::collective {
+#if defined(XGBOOST_USE_IBVERBS)
+namespace {
+// Connection parameters exchanged over the bootstrap socket.
+struct VerbsEndpoint {
+  std::uint32_t qpn;
+  std::uint32_t psn;
+  std::uint16_t lid;
+  std::uint8_t gid[16];
+};
+
+/**
+ * @brief Channel backed by an RDMA reliable-connection queue pair.
+ *
+ * Each direction owns a ring of registered memory slots that is allocated once during
+ * bootstrap and reused across iterations, so the NIC never waits on memory registration
+ * in the training loop.  Sends copy into a free slot and post immediately; receives are
+ * recorded and satisfied from pre-posted slots when the caller blocks.  Deferring the
+ * receive is required for correctness: collectives post both directions before blocking,
+ * and a synchronous receive would deadlock two peers that both receive first.
+ *
+ * Flow control is credit-based: a sender stalls only when all its slots are in flight,
+ * and resumes once the receiver consumes and reposts, which it is guaranteed to do when
+ * it reaches @ref Block.
+ */
+class VerbsChannel : public Channel {
+  static constexpr std::uint32_t kSlotSize = 1u << 16;  // 64KiB
+  static constexpr std::uint32_t kNSlots = 64;          // 4MiB rings per direction
+
+  ibv_context* verbs_{nullptr};
+  ibv_pd* pd_{nullptr};
+  ibv_cq* cq_{nullptr};
+  ibv_qp* qp_{nullptr};
+  ibv_mr* send_mr_{nullptr};
+  ibv_mr* recv_mr_{nullptr};
+  std::vector<std::uint8_t> send_ring_;
+  std::vector<std::uint8_t> recv_ring_;
+
+  std::uint32_t send_head_{0};      // next send slot
+  std::uint32_t send_inflight_{0};  // posted sends without a completion yet
+  // Completed receive slots in arrival order, with the transferred length.
+  std::queue<std::pair<std::uint32_t, std::uint32_t>> ready_;
+  std::uint32_t ready_off_{0};  // consumed bytes of the front ready slot
+  // Outstanding RecvAll requests, serviced in submission order.
+  struct PendingRecv {
+    std::int8_t* ptr;
+    std::size_t n;
+    std::size_t off{0};
+  };
+  std::queue<PendingRecv> pending_recv_;
+
+  [[nodiscard]] Result PostRecv(std::uint32_t slot) {
+    ibv_sge sge;
+    std::memset(&sge, 0, sizeof(sge));
+    sge.addr = reinterpret_cast<std::uintptr_t>(recv_ring_.data() + slot * kSlotSize);
+    sge.length = kSlotSize;
+    sge.lkey = recv_mr_->lkey;
+    ibv_recv_wr wr;
+    std::memset(&wr, 0, sizeof(wr));
+    wr.wr_id = slot;
+    wr.sg_list = &sge;
+    wr.num_sge = 1;
+    ibv_recv_wr* bad{nullptr};
+    if (ibv_post_recv(qp_, &wr, &bad) != 0) {
+      return Fail("Failed to post a receive request.");
+    }
+    return Success();
+  }
+
+  // Reap completions without blocking.
+  [[nodiscard]] Result Drain() {
+    ibv_wc wcs[16];
+    std::int32_t n{0};
+    do {
+      n = ibv_poll_cq(cq_, 16, wcs);
+      if (n < 0) {
+        return Fail("Failed to poll the completion queue.");
+      }
+      for (std::int32_t i = 0; i < n; ++i) {
+        auto const& wc = wcs[i];
+        if (wc.status != IBV_WC_SUCCESS) {
+          return Fail(std::string{"Verbs work completion failed: "} +
+                      ibv_wc_status_str(wc.status));
+        }
+        if (wc.opcode & IBV_WC_RECV) {
+          ready_.emplace(static_cast<std::uint32_t>(wc.wr_id), wc.byte_len);
+        } else {
+          CHECK_GT(send_inflight_, 0);
+          --send_inflight_;
+        }
+      }
+    } while (n > 0);
+    return Success();
+  }
+
+  // Copy completed slots into the outstanding receives and repost consumed slots.
+  [[nodiscard]] Result FillRecvs() {
+    while (!pending_recv_.empty() && !ready_.empty()) {
+      auto& req = pending_recv_.front();
+      auto [slot, len] = ready_.front();
+      auto take = std::min<std::size_t>(req.n - req.off, len - ready_off_);
+      std::memcpy(req.ptr + req.off, recv_ring_.data() + slot * kSlotSize + ready_off_, take);
+      req.off += take;
+      ready_off_ += take;
+      if (req.off == req.n) {
+        pending_recv_.pop();
+      }
+      if (ready_off_ == len) {
+        ready_.pop();
+        ready_off_ = 0;
+        auto rc = this->PostRecv(slot);
+        if (!rc.OK()) {
+          return rc;
+        }
+      }
+    }
+    return Success();
+  }
+
+ public:
+  using Channel::Channel;
+
+  ~VerbsChannel() {
+    if (qp_) {
+      ibv_destroy_qp(qp_);
+    }
+    if (cq_) {
+      ibv_destroy_cq(cq_);
+    }
+    if (send_mr_) {
+      ibv_dereg_mr(send_mr_);
+    }
+    if (recv_mr_) {
+      ibv_dereg_mr(recv_mr_);
+    }
+    if (pd_) {
+      ibv_dealloc_pd(pd_);
+    }
+    if (verbs_) {
+      ibv_close_device(verbs_);
+    }
+  }
+
+  /**
+   * @brief Bring up the queue pair, exchanging endpoints over the bootstrap socket.
+   */
+  [[nodiscard]] Result Init() {
+    std::int32_t n_devices{0};
+    ibv_device** devices = ibv_get_device_list(&n_devices);
+    if (!devices || n_devices == 0) {
+      return Fail("No RDMA device found.");
+    }
+    verbs_ = ibv_open_device(devices[0]);
+    ibv_free_device_list(devices);
+    if (!verbs_) {
+      return Fail("Failed to open the RDMA device.");
+    }
+    pd_ = ibv_alloc_pd(verbs_);
+    if (!pd_) {
+      return Fail("Failed to allocate a protection domain.");
+    }
+    cq_ = ibv_create_cq(verbs_, 2 * kNSlots, nullptr, nullptr, 0);
+    if (!cq_) {
+      return Fail("Failed to create a completion queue.");
+    }
+
+    send_ring_.resize(static_cast<std::size_t>(kNSlots) * kSlotSize);
+    recv_ring_.resize(static_cast<std::size_t>(kNSlots) * kSlotSize);
+    send_mr_ = ibv_reg_mr(pd_, send_ring_.data(), send_ring_.size(), 0);
+    recv_mr_ = ibv_reg_mr(pd_, recv_ring_.data(), recv_ring_.size(), IBV_ACCESS_LOCAL_WRITE);
+    if (!send_mr_ || !recv_mr_) {
+      return Fail("Failed to register the memory rings.");
+    }
+
+    ibv_qp_init_attr qp_init;
+    std::memset(&qp_init, 0, sizeof(qp_init));
+    qp_init.send_cq = cq_;
+    qp_init.recv_cq = cq_;
+    qp_init.qp_type = IBV_QPT_RC;
+    qp_init.cap.max_send_wr = kNSlots;
+    qp_init.cap.max_recv_wr = kNSlots;
+    qp_init.cap.max_send_sge = 1;
+    qp_init.cap.max_recv_sge = 1;
+    qp_ = ibv_create_qp(pd_, &qp_init);
+    if (!qp_) {
+      return Fail("Failed to create the queue pair.");
+    }
+
+    ibv_qp_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.qp_state = IBV_QPS_INIT;
+    attr.pkey_index = 0;
+    attr.port_num = 1;
+    attr.qp_access_flags = 0;
+    if (ibv_modify_qp(qp_, &attr,
+                      IBV_QP_STATE | IBV_QP_PKEY_INDEX | IBV_QP_PORT | IBV_QP_ACCESS_FLAGS) != 0) {
+      return Fail("Failed to transition the queue pair to INIT.");
+    }
+
+    // The ring must be posted before the peer can send.
+    for (std::uint32_t slot = 0; slot < kNSlots; ++slot) {
+      auto rc = this->PostRecv(slot);
+      if (!rc.OK()) {
+        return rc;
+      }
+    }
+
+    ibv_port_attr port;
+    if (ibv_query_port(verbs_, 1, &port) != 0) {
+      return Fail("Failed to query the RDMA port.");
+    }
+    VerbsEndpoint local;
+    std::memset(&local, 0, sizeof(local));
+    local.qpn = qp_->qp_num;
+    local.psn = 0;
+    local.lid = port.lid;
+    ibv_gid gid;
+    if (ibv_query_gid(verbs_, 1, 0, &gid) != 0) {
+      return Fail("Failed to query the RDMA device GID.");
+    }
+    std::memcpy(local.gid, &gid, sizeof(gid));
+
+    // Exchange endpoints over the bootstrap socket.  Both sides write first: the
+    // payload is far below the kernel buffer, so neither blocks.
+    auto sock = this->Socket();
+    CHECK(sock);
+    VerbsEndpoint remote;
+    std::size_t n_bytes{0};
+    auto rc = Success() << [&] {
+      return sock->NonBlocking(false);
+    } << [&] {
+      return sock->SendAll(&local, sizeof(local), &n_bytes);
+    } << [&] {
+      return sock->RecvAll(&remote, sizeof(remote), &n_bytes);
+    } << [&] {
+      return sock->NonBlocking(true);
+    };
+    if (!rc.OK()) {
+      return Fail("Failed to exchange the queue pair endpoints.", std::move(rc));
+    }
+
+    std::memset(&attr, 0, sizeof(attr));
+    attr.qp_state = IBV_QPS_RTR;
+    attr.path_mtu = IBV_MTU_1024;
+    attr.dest_qp_num = remote.qpn;
+    attr.rq_psn = remote.psn;
+    attr.max_dest_rd_atomic = 1;
+    attr.min_rnr_timer = 12;
+    attr.ah_attr.port_num = 1;
+    if (remote.lid != 0) {
+      attr.ah_attr.dlid = remote.lid;
+    } else {
+      // RoCE addresses the peer by GID.
+      attr.ah_attr.is_global = 1;
+      std::memcpy(&attr.ah_attr.grh.dgid, remote.gid, sizeof(remote.gid));
+      attr.ah_attr.grh.sgid_index = 0;
+      attr.ah_attr.grh.hop_limit = 1;
+    }
+    if (ibv_modify_qp(qp_, &attr,
+                      IBV_QP_STATE | IBV_QP_AV | IBV_QP_PATH_MTU | IBV_QP_DEST_QPN |
+                          IBV_QP_RQ_PSN | IBV_QP_MAX_DEST_RD_ATOMIC | IBV_QP_MIN_RNR_TIMER) != 0) {
+      return Fail("Failed to transition the queue pair to RTR.");
+    }
+
+    std::memset(&attr, 0, sizeof(attr));
+    attr.qp_state = IBV_QPS_RTS;
+    attr.timeout = 14;
+    attr.retry_cnt = 7;
+    attr.rnr_retry = 7;
+    attr.sq_psn = local.psn;
+    attr.max_rd_atomic = 1;
+    if (ibv_modify_qp(qp_, &attr,
+                      IBV_QP_STATE | IBV_QP_TIMEOUT | IBV_QP_RETRY_CNT | IBV_QP_RNR_RETRY |
+                          IBV_QP_SQ_PSN | IBV_QP_MAX_QP_RD_ATOMIC) != 0) {
+      return Fail("Failed to transition the queue pair to RTS.");
+    }
+    return Success();
+  }
+
+  [[nodiscard]] Result SendAll(std::int8_t const* ptr, std::size_t n) override {
+    std::size_t off{0};
+    while (off < n) {
+      // Wait for a free slot; the peer frees them as it consumes.
+      while (send_inflight_ == kNSlots) {
+        auto rc = this->Drain();
+        if (!rc.OK()) {
+          return rc;
+        }
+      }
+      auto len = static_cast<std::uint32_t>(std::min<std::size_t>(kSlotSize, n - off));
+      auto slot = send_head_ % kNSlots;
+      std::memcpy(send_ring_.data() + slot * kSlotSize, ptr + off, len);
+
+      ibv_sge sge;
+      std::memset(&sge, 0, sizeof(sge));
+      sge.addr = reinterpret_cast<std::uintptr_t>(send_ring_.data() + slot * kSlotSize);
+      sge.length = len;
+      sge.lkey = send_mr_->lkey;
+      ibv_send_wr wr;
+      std::memset(&wr, 0, sizeof(wr));
+      wr.wr_id = slot;
+      wr.sg_list = &sge;
+      wr.num_sge = 1;
+      wr.opcode = IBV_WR_SEND;
+      wr.send_flags = IBV_SEND_SIGNALED;
+      ibv_send_wr* bad{nullptr};
+      if (ibv_post_send(qp_, &wr, &bad) != 0) {
+        return Fail("Failed to post a send request.");
+      }
+      ++send_head_;
+      ++send_inflight_;
+      off += len;
+    }
+    return Success();
+  }
+
+  [[nodiscard]] Result RecvAll(std::int8_t* ptr, std::size_t n) override {
+    pending_recv_.push(PendingRecv{ptr, n});
+    return Success();
+  }
+
+  [[nodiscard]] Result Block() override {
+    while (!pending_recv_.empty() || send_inflight_ != 0) {
+      auto rc = Success() << [&] { return this->Drain(); } << [&] { return this->FillRecvs(); };
+      if (!rc.OK()) {
+        return rc;
+      }
+    }
+    return Success();
+  }
+};
+}  // namespace
+#endif  // defined(XGBOOST_USE_IBVERBS)
+
+[[nodiscard]] Result MakeTransportChannel(Comm const& comm, std::shared_ptr<TCPSocket> sock,
+                                          std::string const& transport,
+                                          std::shared_ptr<Channel>* out) {
+  // The self rank has no socket and never moves data, a plain channel suffices.
+  if (!sock || transport.empty() || transport == "tcp") {
+    *out = std::make_shared<Channel>(comm, std::move(sock));
+    return Success();
+  }
+  if (transport == "verbs") {
+#if defined(XGBOOST_USE_IBVERBS)
+    auto ch = std::make_shared<VerbsChannel>(comm, std::move(sock));
+    auto rc = ch->Init();
+    if (!rc.OK()) {
+      return Fail("Failed to initialise the verbs transport.", std::move(rc));
+    }
+    *out = std::move(ch);
+    return Success();
+#else
+    return Fail("XGBoost is not compiled with RDMA support (USE_IBVERBS=ON).");
+#endif  // defined(XGBOOST_USE_IBVERBS)
+  }
+  return Fail("Unknown collective transport: `" + transport + "`.");
+}
+}  // namespace xgboost::collective
@@ -0,0 +1,31 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#pragma once
+#include <memory>  // for shared_ptr
+#include <string>  // for string
+
+#include "comm.h"                       // for Comm, Channel
+#include "xgboost/collective/result.h"  // for Result
+#include "xgboost/collective/socket.h"  // for TCPSocket
+
+namespace xgboost::collective {
+/**
+ * @brief Create a worker channel for the configured transport.
+ *
+ * The bootstrap is always TCP: the tracker handshake and ring discovery run over
+ * sockets, and the resulting socket is handed to the channel.  The `tcp` transport (the
+ * default) moves data over that socket through the event loop.  The `verbs` transport
+ * keeps the socket for connection setup only and moves data over an RDMA RC queue pair
+ * with registered memory rings that are reused across iterations; it requires building
+ * with `USE_IBVERBS=ON`.
+ *
+ * @param comm      The communicator owning the channel.
+ * @param sock      Bootstrap socket connected to the peer, nullptr for the self rank.
+ * @param transport Transport name, `tcp` or `verbs`.
+ * @param out       Created channel.
+ */
+[[nodiscard]] Result MakeTransportChannel(Comm const& comm, std::shared_ptr<TCPSocket> sock,
+                                          std::string const& transport,
+                                          std::shared_ptr<Channel>* out);
+}  // namespace xgboost::collective
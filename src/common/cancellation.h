@@ -0,0 +1,34 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ * \file cancellation.h
+ * \brief Process-wide cooperative cancellation for training.
+ */
+#ifndef XGBOOST_COMMON_CANCELLATION_H_
+#define XGBOOST_COMMON_CANCELLATION_H_
+#include <atomic>  // for atomic
+
+namespace xgboost::common {
+/**
+ * \brief Process-wide cooperative cancellation flag for training.
+ *
+ * A scheduler that wants to preempt a training job sets the flag through the C API, from
+ * any thread.  The training loop checks it at phase boundaries -- before starting a
+ * boosting iteration and between the trees of a forest -- so the job stops after the
+ * current tree with the model in a valid state, and the caller can save a checkpoint and
+ * exit instead of losing progress to a kill signal.
+ */
+class TrainingCancellation {
+ public:
+  static TrainingCancellation& Instance() {
+    static TrainingCancellation instance;
+    return instance;
+  }
+
+  void Request(bool cancel) { requested_.store(cancel, std::memory_order_release); }
+  [[nodiscard]] bool Requested() const { return requested_.load(std::memory_order_acquire); }
+
+ private:
+  std::atomic<bool> requested_{false};
+};
+}  // namespace xgboost::common
+#endif  // XGBOOST_COMMON_CANCELLATION_H_
@@ -31,6 +31,13 @@ inline XGBOOST_DEVICE bool IsCat(Span<FeatureType const> ft, bst_feature_t fidx)
   return !ft.empty() && ft[fidx] == FeatureType::kCategorical;
 }
 
+/* \brief Whether fidx is a pre-binned feature, i.e. one holding small non-negative
+ *        integers that need no quantile sketch.
+ */
+inline XGBOOST_DEVICE bool IsPreBinned(Span<FeatureType const> ft, bst_feature_t fidx) {
+  return !ft.empty() && ft[fidx] == FeatureType::kPreBinned;
+}
+
 constexpr inline bst_cat_t OutOfRangeCat() {
   // See the round trip assert in `InvalidCat`.
   return static_cast<bst_cat_t>(16777217) - static_cast<bst_cat_t>(1);
@@ -102,6 +102,7 @@ bool ColumnMatrix::Read(AlignedResourceReadStream* fi, uint32_t const* index_bas
   if (!fi->Read(&any_missing_)) {
     return false;
   }
+  this->ReportMemUsage();
   return true;
 }
 
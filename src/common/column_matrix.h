@@ -19,6 +19,8 @@
 #include "../data/gradient_index.h"
 #include "bitfield.h"  // for RBitField8
 #include "hist_util.h"
+#include "memory_stats.h"  // for MemoryUsageReporter
+#include "prefetch.h"  // for PrefetchReadT0
 #include "ref_resource_view.h"  // for RefResourceView
 #include "xgboost/base.h"       // for bst_bin_t
 #include "xgboost/span.h"       // for Span
@@ -48,6 +50,9 @@ class Column {
     return index_base_ + static_cast<bst_bin_t>(index_[idx]);
   }
 
+  /* prefetch the cache line holding the bin index for idx */
+  void PrefetchBinIdx(size_t idx) const { PrefetchReadT0(index_.data() + idx); }
+
   /* returns number of elements in column */
   [[nodiscard]] size_t Size() const { return index_.size(); }
 
@@ -60,6 +65,10 @@ class Column {
 
 template <typename BinIdxT>
 class SparseColumnIter : public Column<BinIdxT> {
+ public:
+  // bin indices are reached through a row-index search, not addressable by row id.
+  static constexpr bool kDirectIndex = false;
+
  private:
   using Base = Column<BinIdxT>;
   /* indexes of rows */
@@ -110,6 +119,10 @@ class SparseColumnIter : public Column<BinIdxT> {
  */
 template <typename BinIdxT, bool any_missing>
 class DenseColumnIter : public Column<BinIdxT> {
+ public:
+  // bin indices are directly addressable by (partition-local) row id.
+  static constexpr bool kDirectIndex = true;
+
  private:
   using Base = Column<BinIdxT>;
   /* flags for missing values in dense columns */
@@ -235,6 +248,7 @@ class ColumnMatrix {
     this->InitStorage(gmat, sparse_threshold);
     // ignore base row id here as we always has one column matrix for each sparse page.
     this->PushBatch(n_threads, batch, std::numeric_limits<float>::quiet_NaN(), gmat, 0);
+    this->ReportMemUsage();
   }
 
   /**
@@ -257,6 +271,7 @@ class ColumnMatrix {
     } else {
       SetIndexMixedColumns(gmat);
     }
+    this->ReportMemUsage();
   }
 
   [[nodiscard]] bool IsInitialized() const { return !type_.empty(); }
@@ -353,7 +368,6 @@ class ColumnMatrix {
     auto n_features = gmat.Features();
 
     missing_.GrowTo(feature_offsets_[n_features], true);
-    auto const* row_index = gmat.index.data<std::uint32_t>() + gmat.row_ptr[base_rowid];
     if (num_nonzeros_.empty()) {
       num_nonzeros_ = common::MakeFixedVecWithMalloc(n_features, std::size_t{0});
     } else {
@@ -362,23 +376,28 @@ class ColumnMatrix {
 
     auto is_valid = data::IsValidFunctor{missing};
 
-    DispatchBinType(bins_type_size_, [&](auto t) {
-      using ColumnBinT = decltype(t);
-      ColumnBinT* local_index = reinterpret_cast<ColumnBinT*>(index_.data());
-      size_t const batch_size = batch.Size();
-      size_t k{0};
-      for (size_t rid = 0; rid < batch_size; ++rid) {
-        auto line = batch.GetLine(rid);
-        for (size_t i = 0; i < line.Size(); ++i) {
-          auto coo = line.GetElement(i);
-          if (is_valid(coo)) {
-            auto fid = coo.column_idx;
-            const uint32_t bin_id = row_index[k];
-            SetBinSparse(bin_id, rid + base_rowid, fid, local_index);
-            ++k;
+    // The sparse gradient index might be compressed, dispatch on its type as well.
+    DispatchBinType(gmat.index.GetBinTypeSize(), [&](auto rt) {
+      using RowBinT = decltype(rt);
+      auto const* row_index = gmat.index.data<RowBinT>() + gmat.row_ptr[base_rowid];
+      DispatchBinType(bins_type_size_, [&](auto t) {
+        using ColumnBinT = decltype(t);
+        ColumnBinT* local_index = reinterpret_cast<ColumnBinT*>(index_.data());
+        size_t const batch_size = batch.Size();
+        size_t k{0};
+        for (size_t rid = 0; rid < batch_size; ++rid) {
+          auto line = batch.GetLine(rid);
+          for (size_t i = 0; i < line.Size(); ++i) {
+            auto coo = line.GetElement(i);
+            if (is_valid(coo)) {
+              auto fid = coo.column_idx;
+              const uint32_t bin_id = row_index[k];
+              SetBinSparse(bin_id, rid + base_rowid, fid, local_index);
+              ++k;
+            }
           }
         }
-      }
+      });
     });
   }
 
@@ -414,6 +433,14 @@ class ColumnMatrix {
   [[nodiscard]] std::size_t Write(AlignedFileWriteStream* fo) const;
   [[nodiscard]] MissingIndicator const& Missing() const { return missing_; }
 
+  [[nodiscard]] std::size_t MemCostBytes() const {
+    return index_.size_bytes() + type_.size_bytes() + row_ind_.size_bytes() +
+           feature_offsets_.size_bytes() + num_nonzeros_.size_bytes() +
+           missing_.storage.size_bytes();
+  }
+  /** @brief Report the current footprint to the memory usage registry. */
+  void ReportMemUsage() { mem_usage_.Update(this->MemCostBytes()); }
+
  private:
   RefResourceView<std::uint8_t> index_;
 
@@ -432,6 +459,7 @@ class ColumnMatrix {
 
   BinTypeSize bins_type_size_;
   bool any_missing_;
+  MemoryUsageReporter mem_usage_{"ColumnMatrix"};
 };
 }  // namespace xgboost::common
 #endif  // XGBOOST_COMMON_COLUMN_MATRIX_H_
@@ -11,6 +11,10 @@
 #include <string>   // for string
 #include <utility>  // for pair
 
+#if !defined(_MSC_VER)
+#include <unistd.h>  // for sysconf
+#endif  // !defined(_MSC_VER)
+
 #include "./random.h"  // for GlobalRandomEngine, GlobalRandom
 
 namespace xgboost::common {
@@ -72,4 +76,19 @@ std::string HumanMemUnit(std::size_t n_bytes) {
   ss << n_bytes_f64 << "B";
   return ss.str();
 }
+
+std::size_t L2CacheBytes() {
+  static std::size_t const n_bytes = [] {
+    long n{-1};  // NOLINT
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+    n = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif  // defined(_SC_LEVEL2_CACHE_SIZE)
+    if (n <= 0) {
+      // The OS doesn't expose the cache topology, fall back to a common size.
+      return static_cast<std::size_t>(1024 * 1024);
+    }
+    return static_cast<std::size_t>(n);
+  }();
+  return n_bytes;
+}
 }  // namespace xgboost::common
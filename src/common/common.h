@@ -191,5 +191,13 @@ XGBOOST_DEVICE size_t LastOf(size_t group, Indexable const &indptr) {
 
 // Convert the number of bytes to a human readable unit.
 std::string HumanMemUnit(std::size_t n_bytes);
+
+/**
+ * @brief Size in bytes of the per-core L2 data cache.
+ *
+ *   Queried from the OS on first use, with a 1MB guess when the platform doesn't expose
+ *   the cache topology.  Used for sizing the working set of cache-sensitive kernels.
+ */
+[[nodiscard]] std::size_t L2CacheBytes();
 }  // namespace xgboost::common
 #endif  // XGBOOST_COMMON_COMMON_H_
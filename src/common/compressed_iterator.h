@@ -7,6 +7,7 @@
 
 #include <cmath>    // for ceil, log2
 #include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t, uint64_t
 
 #include "common.h"
 
@@ -211,5 +212,39 @@ class CompressedIterator {
     offset.offset_ += idx;
     return *offset;
   }
+
+  /**
+   * @brief Decode a contiguous run of symbols into an output buffer.
+   *
+   * `operator[]` gathers 5 bytes and re-derives the bit position per element, which
+   * defeats hardware prefetching in host loops.  This reads the buffer sequentially
+   * with a rolling 64-bit window instead, decoding each byte exactly once.
+   *
+   * @param begin The index of the first symbol to decode, relative to this iterator.
+   * @param n     The number of symbols to decode.
+   * @param out   Output buffer holding at least @p n elements.
+   */
+  void DecodeBlock(std::size_t begin, std::size_t n, T *out) const {
+    std::size_t const w = symbol_bits_;
+    std::uint64_t const mask = (static_cast<std::uint64_t>(1) << w) - 1;
+    std::size_t bit = (offset_ + begin) * w;
+    std::size_t byte_idx = detail::kPadding + bit / 8;
+    std::uint64_t acc = 0;
+    std::uint32_t acc_bits = 0;
+    // Load the partial leading byte.
+    std::uint32_t lead = bit % 8;
+    if (lead != 0) {
+      acc = buffer_[byte_idx++] & ((1u << (8 - lead)) - 1);
+      acc_bits = 8 - lead;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      while (acc_bits < w) {
+        acc = (acc << 8) | buffer_[byte_idx++];
+        acc_bits += 8;
+      }
+      acc_bits -= w;
+      out[i] = static_cast<T>((acc >> acc_bits) & mask);
+    }
+  }
 };
 }  // namespace xgboost::common
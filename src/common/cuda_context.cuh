@@ -12,6 +12,7 @@ struct CUDAContext {
  private:
   dh::XGBCachingDeviceAllocator<char> caching_alloc_;
   dh::XGBDeviceAllocator<char> alloc_;
+  dh::CUDAStream aux_stream_;
 
  public:
   /**
@@ -35,6 +36,12 @@ struct CUDAContext {
 #endif  // THRUST_MAJOR_VERSION >= 2
   }
   auto Stream() const { return dh::DefaultStream(); }
+  /**
+   * \brief Secondary stream for overlapping independent kernels with work on the
+   *        default stream.  Synchronization with \ref Stream via events is the caller's
+   *        responsibility.
+   */
+  auto AuxStream() const { return aux_stream_.View(); }
 };
 }  // namespace xgboost
 #endif  // XGBOOST_COMMON_CUDA_CONTEXT_CUH_
@@ -0,0 +1,129 @@
+/**
+ * Copyright 2024, XGBoost Contributors
+ */
+#include <algorithm>  // for min
+#include <cstring>    // for memcpy
+
+#include "common.h"  // for DivRoundUp
+#include "cuda_staging.cuh"
+
+namespace xgboost::common::cuda_impl {
+StagingBufferPool& StagingBufferPool::Instance() {
+  static StagingBufferPool pool;
+  return pool;
+}
+
+StagingBufferPool::~StagingBufferPool() {
+  // The pool is destroyed at program exit, possibly after the CUDA context is torn down.
+  // Freeing is best-effort, errors are ignored on purpose.
+  for (auto* ptr : free_chunks_) {
+    cudaFreeHost(ptr);
+  }
+}
+
+void* StagingBufferPool::AcquireChunk() {
+  {
+    std::lock_guard<std::mutex> lock{mu_};
+    if (!free_chunks_.empty()) {
+      auto* ptr = free_chunks_.back();
+      free_chunks_.pop_back();
+      return ptr;
+    }
+  }
+  void* ptr{nullptr};
+  dh::safe_cuda(cudaMallocHost(&ptr, kChunkBytes));
+  return ptr;
+}
+
+void StagingBufferPool::ReleaseChunk(void* ptr) {
+  std::lock_guard<std::mutex> lock{mu_};
+  free_chunks_.push_back(ptr);
+}
+
+void StagingBufferPool::CopyH2D(void* dst, void const* src, std::size_t n_bytes,
+                                dh::CUDAStreamView consumer) {
+  if (n_bytes < kMinStagedBytes) {
+    dh::safe_cuda(cudaMemcpyAsync(dst, src, n_bytes, cudaMemcpyHostToDevice, consumer));
+    return;
+  }
+
+  // Order after pending work on the consumer stream that might touch the destination.
+  dh::CUDAEvent ready;
+  ready.Record(consumer);
+  stream_.Wait(ready);
+
+  void* chunks[2] = {this->AcquireChunk(), this->AcquireChunk()};
+  dh::CUDAEvent drained[2];  // the DMA out of the corresponding chunk has finished
+  auto const* h_src = static_cast<char const*>(src);
+  auto* d_dst = static_cast<char*>(dst);
+
+  for (std::size_t offset = 0, i = 0; offset < n_bytes; offset += kChunkBytes, ++i) {
+    auto idx = i % 2;
+    std::size_t n = std::min(kChunkBytes, n_bytes - offset);
+    if (i >= 2) {
+      // Don't overwrite the chunk while the previous DMA is still reading it.
+      dh::safe_cuda(cudaEventSynchronize(drained[idx]));
+    }
+    std::memcpy(chunks[idx], h_src + offset, n);
+    dh::safe_cuda(
+        cudaMemcpyAsync(d_dst + offset, chunks[idx], n, cudaMemcpyHostToDevice, stream_.View()));
+    drained[idx].Record(stream_.View());
+  }
+
+  // Work submitted to the consumer stream after this call observes the finished copy
+  // without blocking the host.
+  dh::CUDAEvent done;
+  done.Record(stream_.View());
+  consumer.Wait(done);
+
+  // The chunks can only be reused once the last DMA out of each has finished.
+  dh::safe_cuda(cudaEventSynchronize(drained[0]));
+  dh::safe_cuda(cudaEventSynchronize(drained[1]));
+  this->ReleaseChunk(chunks[0]);
+  this->ReleaseChunk(chunks[1]);
+}
+
+void StagingBufferPool::CopyD2H(void* dst, void const* src, std::size_t n_bytes,
+                                dh::CUDAStreamView producer) {
+  if (n_bytes < kMinStagedBytes) {
+    dh::safe_cuda(cudaMemcpy(dst, src, n_bytes, cudaMemcpyDeviceToHost));
+    return;
+  }
+
+  // Observe pending writes to the source on the producer stream.
+  dh::CUDAEvent ready;
+  ready.Record(producer);
+  stream_.Wait(ready);
+
+  void* chunks[2] = {this->AcquireChunk(), this->AcquireChunk()};
+  dh::CUDAEvent filled[2];  // the DMA into the corresponding chunk has finished
+  auto const* d_src = static_cast<char const*>(src);
+  auto* h_dst = static_cast<char*>(dst);
+
+  // Unpack chunk i - 1 to its destination while the DMA for chunk i runs.
+  std::size_t n_chunks = DivRoundUp(n_bytes, kChunkBytes);
+  for (std::size_t i = 0; i < n_chunks; ++i) {
+    auto idx = i % 2;
+    std::size_t offset = i * kChunkBytes;
+    std::size_t n = std::min(kChunkBytes, n_bytes - offset);
+    dh::safe_cuda(
+        cudaMemcpyAsync(chunks[idx], d_src + offset, n, cudaMemcpyDeviceToHost, stream_.View()));
+    filled[idx].Record(stream_.View());
+
+    if (i >= 1) {
+      auto prev = (i - 1) % 2;
+      std::size_t prev_offset = (i - 1) * kChunkBytes;
+      dh::safe_cuda(cudaEventSynchronize(filled[prev]));
+      std::memcpy(h_dst + prev_offset, chunks[prev], kChunkBytes);
+    }
+  }
+
+  auto last = (n_chunks - 1) % 2;
+  std::size_t last_offset = (n_chunks - 1) * kChunkBytes;
+  dh::safe_cuda(cudaEventSynchronize(filled[last]));
+  std::memcpy(h_dst + last_offset, chunks[last], n_bytes - last_offset);
+
+  this->ReleaseChunk(chunks[0]);
+  this->ReleaseChunk(chunks[1]);
+}
+}  // namespace xgboost::common::cuda_impl
@@ -0,0 +1,62 @@
+/**
+ * Copyright 2024, XGBoost Contributors
+ *
+ * @brief Pinned-memory staging pool for host <-> device copies.
+ */
+#pragma once
+
+#include <cstddef>  // for size_t
+#include <mutex>    // for mutex
+#include <vector>   // for vector
+
+#include "device_helpers.cuh"  // for CUDAStream, CUDAStreamView
+
+namespace xgboost::common::cuda_impl {
+/**
+ * @brief Global pool of pinned staging buffers with a dedicated copy stream.
+ *
+ *   Pageable-memory copies are staged synchronously through the driver's internal
+ *   buffer.  Routing large @ref HostDeviceVector migrations through reusable pinned
+ *   chunks with double-buffered async copies keeps the DMA engine busy while the host
+ *   packs the next chunk, and the dedicated stream lets migrations overlap compute on
+ *   other streams.
+ */
+class StagingBufferPool {
+ public:
+  /** @brief Size of one pinned staging chunk. */
+  constexpr static std::size_t kChunkBytes = 1ul << 22;
+  /** @brief Copies smaller than this don't amortize the staging overhead. */
+  constexpr static std::size_t kMinStagedBytes = 1ul << 20;
+
+  static StagingBufferPool& Instance();
+
+  /**
+   * @brief Copy host memory to device, staging through pinned chunks.
+   *
+   *   The copy is ordered with respect to @p consumer: work submitted to that stream
+   *   after this call observes the destination fully written.
+   */
+  void CopyH2D(void* dst, void const* src, std::size_t n_bytes, dh::CUDAStreamView consumer);
+  /**
+   * @brief Copy device memory to host, staging through pinned chunks.  Blocks until the
+   *        copy completes.
+   *
+   * @param producer The stream whose pending writes to @p src must be observed.
+   */
+  void CopyD2H(void* dst, void const* src, std::size_t n_bytes, dh::CUDAStreamView producer);
+
+  ~StagingBufferPool();
+  StagingBufferPool(StagingBufferPool const&) = delete;
+  StagingBufferPool& operator=(StagingBufferPool const&) = delete;
+
+ private:
+  StagingBufferPool() = default;
+
+  [[nodiscard]] void* AcquireChunk();
+  void ReleaseChunk(void* ptr);
+
+  std::mutex mu_;
+  std::vector<void*> free_chunks_;
+  dh::CUDAStream stream_;
+};
+}  // namespace xgboost::common::cuda_impl
@@ -34,8 +34,9 @@
 #include <cub/util_device.cuh>     // for CurrentDevice
 #include <memory>                  // for unique_ptr
 
-#include "common.h"         // for safe_cuda, HumanMemUnit
-#include "cuda_dr_utils.h"  // for CuDriverApi
+#include "common.h"                 // for safe_cuda, HumanMemUnit
+#include "cuda_dr_utils.h"          // for CuDriverApi
+#include "xgboost/global_config.h"  // for GlobalConfigThreadLocalStore
 #include "xgboost/logging.h"
 #include "xgboost/span.h"  // for Span
 
@@ -271,8 +272,27 @@ template <typename T>
 using XGBBaseDeviceAllocator = thrust::device_malloc_allocator<T>;
 #endif  // defined(XGBOOST_USE_RMM) && XGBOOST_USE_RMM == 1
 
+/**
+ * \brief Process-wide caching allocator for the opt-in device memory pool.
+ *
+ *     Shared between threads since containers routed through it (notably the
+ *     HostDeviceVector storage) are commonly allocated and freed on different threads.
+ *     cub::CachingDeviceAllocator synchronizes internally and reuses blocks in
+ *     stream-order.
+ */
+inline cub::CachingDeviceAllocator &GetGlobalDevicePool() {
+  // Power-of-two bins with maximum cached bin size of ~1GB and no limit on maximum
+  // cached bytes.
+  static cub::CachingDeviceAllocator allocator{2, 9, 29};
+  return allocator;
+}
+
 /**
  * \brief Default memory allocator, uses cudaMalloc/Free and logs allocations if verbose.
+ *
+ *     When the global `use_device_pool` configuration is set (and RMM is not in use),
+ *     allocations are served from a process-wide caching pool instead, so repeated
+ *     train/free cycles stop paying cudaMalloc latency.
  */
 template <class T>
 struct XGBDefaultDeviceAllocatorImpl : XGBBaseDeviceAllocator<T> {
@@ -285,22 +305,46 @@ struct XGBDefaultDeviceAllocatorImpl : XGBBaseDeviceAllocator<T> {
   };
   pointer allocate(size_t n) {  // NOLINT
     pointer ptr;
-    try {
-      ptr = SuperT::allocate(n);
-      dh::safe_cuda(cudaGetLastError());
-    } catch (const std::exception &e) {
-      detail::ThrowOOMError(e.what(), n * sizeof(T));
+    if (use_pool_) {
+      T *raw_ptr{nullptr};
+      auto errc = GetGlobalDevicePool().DeviceAllocate(reinterpret_cast<void **>(&raw_ptr),
+                                                       n * sizeof(T));
+      if (errc != cudaSuccess) {
+        detail::ThrowOOMError("Device pool", n * sizeof(T));
+      }
+      ptr = pointer(raw_ptr);
+    } else {
+      try {
+        ptr = SuperT::allocate(n);
+        dh::safe_cuda(cudaGetLastError());
+      } catch (const std::exception &e) {
+        detail::ThrowOOMError(e.what(), n * sizeof(T));
+      }
     }
     GlobalMemoryLogger().RegisterAllocation(n * sizeof(T));
     return ptr;
   }
   void deallocate(pointer ptr, size_t n) {  // NOLINT
     GlobalMemoryLogger().RegisterDeallocation(n * sizeof(T));
-    SuperT::deallocate(ptr, n);
+    if (use_pool_) {
+      GetGlobalDevicePool().DeviceFree(thrust::raw_pointer_cast(ptr));
+    } else {
+      SuperT::deallocate(ptr, n);
+    }
   }
 #if defined(XGBOOST_USE_RMM) && XGBOOST_USE_RMM == 1
   XGBDefaultDeviceAllocatorImpl()
       : SuperT(rmm::cuda_stream_per_thread, rmm::mr::get_current_device_resource()) {}
+
+ private:
+  // RMM provides its own pool.
+  bool use_pool_{false};
+#else
+
+ private:
+  // Latched at construction so that deallocation stays consistent if the flag flips
+  // during the container's lifetime.
+  bool use_pool_{xgboost::GlobalConfigThreadLocalStore::Get()->use_device_pool};
 #endif  // defined(XGBOOST_USE_RMM) && XGBOOST_USE_RMM == 1
 };
 
@@ -0,0 +1,108 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include "feature_bundling.h"
+
+#include <algorithm>  // for stable_sort, min
+#include <cstddef>    // for size_t
+#include <limits>     // for numeric_limits
+#include <numeric>    // for iota
+#include <vector>     // for vector
+
+#include "xgboost/logging.h"
+
+namespace xgboost::common {
+FeatureBundling MakeFeatureBundles(SparsePage const& page, bst_feature_t n_features,
+                                   double max_conflict_rate, std::int32_t n_threads) {
+  CHECK_GE(max_conflict_rate, 0.0);
+  auto n_rows = page.Size();
+  auto csc = page.GetTranspose(n_features, n_threads);
+  auto columns = csc.GetView();
+
+  // Densest features first, so that near-full columns claim their own bundle early
+  // instead of blocking sparse ones later.
+  std::vector<bst_feature_t> order(n_features);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&](auto l, auto r) { return columns[l].size() > columns[r].size(); });
+
+  auto budget = static_cast<std::size_t>(max_conflict_rate * static_cast<double>(n_rows));
+
+  FeatureBundling plan;
+  plan.feature_to_bundle.resize(n_features);
+  // Row occupancy and accumulated conflicts for each bundle built so far.
+  std::vector<std::vector<bool>> occupied;
+  std::vector<std::size_t> used_budget;
+
+  for (auto fidx : order) {
+    auto column = columns[fidx];
+    bool placed{false};
+    for (std::size_t b = 0; b < plan.bundles.size() && !placed; ++b) {
+      std::size_t conflicts{0};
+      for (auto const& e : column) {
+        conflicts += occupied[b][e.index];
+        if (used_budget[b] + conflicts > budget) {
+          break;
+        }
+      }
+      if (used_budget[b] + conflicts <= budget) {
+        for (auto const& e : column) {
+          occupied[b][e.index] = true;
+        }
+        used_budget[b] += conflicts;
+        plan.bundles[b].push_back(fidx);
+        plan.feature_to_bundle[fidx] = static_cast<bst_feature_t>(b);
+        placed = true;
+      }
+    }
+    if (!placed) {
+      plan.feature_to_bundle[fidx] = plan.NumBundles();
+      plan.bundles.emplace_back(1, fidx);
+      occupied.emplace_back(n_rows, false);
+      auto& rows = occupied.back();
+      for (auto const& e : column) {
+        rows[e.index] = true;
+      }
+      used_budget.push_back(0);
+    }
+  }
+  return plan;
+}
+
+HistogramCuts MakeBundledCuts(HistogramCuts const& cuts, FeatureBundling const& plan,
+                              std::vector<std::uint32_t>* p_bin_mapping) {
+  CHECK(!cuts.HasCategorical()) << "Feature bundling doesn't support categorical features.";
+  CHECK_EQ(cuts.NumFeatures(), plan.feature_to_bundle.size());
+
+  auto const& ptrs = cuts.Ptrs();
+  auto const& values = cuts.Values();
+  auto const& mins = cuts.MinValues();
+
+  auto& bin_mapping = *p_bin_mapping;
+  bin_mapping.resize(cuts.TotalBins());
+
+  HistogramCuts out;
+  auto& out_ptrs = out.cut_ptrs_.HostVector();
+  auto& out_values = out.cut_values_.HostVector();
+  auto& out_mins = out.min_vals_.HostVector();
+
+  for (auto const& bundle : plan.bundles) {
+    if (bundle.size() > 1) {
+      // Leading bin shared by all rows where every member is zero or missing.  The cut
+      // value is a placeholder, bundled cuts are never searched by raw value.
+      out_values.push_back(0.0f);
+    }
+    float min_value{std::numeric_limits<float>::max()};
+    for (auto fidx : bundle) {
+      for (auto i = ptrs[fidx]; i < ptrs[fidx + 1]; ++i) {
+        bin_mapping[i] = static_cast<std::uint32_t>(out_values.size());
+        out_values.push_back(values[i]);
+      }
+      min_value = std::min(min_value, mins[fidx]);
+    }
+    out_ptrs.push_back(static_cast<std::uint32_t>(out_values.size()));
+    out_mins.push_back(min_value);
+  }
+  return out;
+}
+}  // namespace xgboost::common
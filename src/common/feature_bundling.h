@@ -0,0 +1,71 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ *
+ * @brief Exclusive feature bundling (EFB) for sparse data.
+ *
+ * One-hot encoded and other sparse features are often mutually exclusive: no row has a
+ * non-zero value in more than one of them.  Such features can share a single histogram
+ * column with offset bin ranges, which shrinks the number of features the split
+ * evaluator has to enumerate and makes the bundled column nearly dense.  This file
+ * implements the bundling plan and the corresponding cut transformation; rewriting the
+ * gradient index and un-bundling tree split records are up to the caller.
+ */
+#ifndef XGBOOST_COMMON_FEATURE_BUNDLING_H_
+#define XGBOOST_COMMON_FEATURE_BUNDLING_H_
+
+#include <cstdint>  // for int32_t, uint32_t
+#include <vector>   // for vector
+
+#include "hist_util.h"     // for HistogramCuts
+#include "xgboost/base.h"  // for bst_feature_t
+#include "xgboost/data.h"  // for SparsePage
+
+namespace xgboost::common {
+/**
+ * @brief A plan that assigns each feature to a bundle of (almost) mutually exclusive
+ *        features.
+ */
+struct FeatureBundling {
+  /** @brief Member features of each bundle, in the order of their bin offsets. */
+  std::vector<std::vector<bst_feature_t>> bundles;
+  /** @brief Mapping from the original feature index to its bundle index. */
+  std::vector<bst_feature_t> feature_to_bundle;
+
+  [[nodiscard]] bst_feature_t NumBundles() const {
+    return static_cast<bst_feature_t>(bundles.size());
+  }
+  /** @brief Whether no features were merged and the plan is a no-op. */
+  [[nodiscard]] bool Trivial() const { return bundles.size() == feature_to_bundle.size(); }
+};
+
+/**
+ * @brief Greedily group features that (almost) never co-occur into bundles.
+ *
+ *   Features are visited from the densest to the sparsest and placed into the first
+ *   bundle whose accumulated conflicts stay within budget, mirroring the greedy graph
+ *   coloring used by the original EFB proposal.
+ *
+ * @param page              Row batch used to detect conflicts.
+ * @param n_features        Number of columns in the batch.
+ * @param max_conflict_rate Fraction of rows in which members of a bundle may overlap.
+ *                          0 requires exact mutual exclusion.
+ * @param n_threads         Number of threads used for the column transpose.
+ */
+FeatureBundling MakeFeatureBundles(SparsePage const& page, bst_feature_t n_features,
+                                   double max_conflict_rate, std::int32_t n_threads);
+
+/**
+ * @brief Build histogram cuts over bundles, where each member feature keeps its cut
+ *        values at an offset inside the bundle's bin range.
+ *
+ *   Every bundle with more than one member gets an extra leading bin that represents
+ *   "all members zero".  @p p_bin_mapping receives, for each original bin, its index in
+ *   the bundled cuts so that an existing gradient index can be rewritten in place.  The
+ *   result is only valid for such rewrites; `SearchBin` on raw values is not supported
+ *   for multi-member bundles since their concatenated cut values are not monotone.
+ *   Categorical features are not supported.
+ */
+HistogramCuts MakeBundledCuts(HistogramCuts const& cuts, FeatureBundling const& plan,
+                              std::vector<std::uint32_t>* p_bin_mapping);
+}  // namespace xgboost::common
+#endif  // XGBOOST_COMMON_FEATURE_BUNDLING_H_
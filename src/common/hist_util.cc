@@ -10,25 +10,88 @@
 
 #include "../data/adapter.h"         // for SparsePageAdapterBatch
 #include "../data/gradient_index.h"  // for GHistIndexMatrix
+#include "column_matrix.h"           // for ColumnMatrix, ColumnType
+#include "common.h"                  // for L2CacheBytes
+#include "prefetch.h"                // for Prefetch, PrefetchReadT0
 #include "quantile.h"
 #include "xgboost/base.h"
 #include "xgboost/context.h"  // for Context
 #include "xgboost/data.h"     // for SparsePage, SortedCSCPage
+#include "xgboost/json.h"     // for Json, F32Array, I64Array
 
-#if defined(XGBOOST_MM_PREFETCH_PRESENT)
-  #include <xmmintrin.h>
-  #define PREFETCH_READ_T0(addr) _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0)
-#elif defined(XGBOOST_BUILTIN_PREFETCH_PRESENT)
-  #define PREFETCH_READ_T0(addr) __builtin_prefetch(reinterpret_cast<const char*>(addr), 0, 3)
-#else  // no SW pre-fetching available; PREFETCH_READ_T0 is no-op
-  #define PREFETCH_READ_T0(addr) do {} while (0)
-#endif  // defined(XGBOOST_MM_PREFETCH_PRESENT)
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+  #include <immintrin.h>
+  #define XGBOOST_HIST_SIMD_PRESENT 1
+#endif  // x86-64 && (GCC || Clang)
 
 namespace xgboost::common {
 HistogramCuts::HistogramCuts() {
   cut_ptrs_.HostVector().emplace_back(0);
 }
 
+void HistogramCuts::SaveJson(Json* p_out) const {
+  auto& out = *p_out;
+
+  auto save_f32 = [](std::vector<float> const& in, Json out) {
+    auto& out_array = get<F32Array>(out);
+    out_array.resize(in.size());
+    std::copy(in.cbegin(), in.cend(), out_array.begin());
+  };
+  out["cut_values"] = F32Array();
+  save_f32(cut_values_.ConstHostVector(), out["cut_values"]);
+  out["min_values"] = F32Array();
+  save_f32(min_vals_.ConstHostVector(), out["min_values"]);
+
+  auto const& ptrs = cut_ptrs_.ConstHostVector();
+  out["cut_ptrs"] = I64Array(ptrs.size());
+  auto& jptrs = get<I64Array>(out["cut_ptrs"]);
+  std::copy(ptrs.cbegin(), ptrs.cend(), jptrs.begin());
+
+  out["has_categorical"] = Boolean{has_categorical_};
+  out["max_category"] = Number{max_cat_};
+}
+
+void HistogramCuts::LoadJson(Json const& in) {
+  // The typed arrays degrade to plain arrays of numbers after a round trip through text
+  // JSON, accept both representations.
+  auto load_f32 = [](Json const& in, HostDeviceVector<float>* p_out) {
+    auto& out = p_out->HostVector();
+    if (IsA<F32Array>(in)) {
+      auto const& array = get<F32Array const>(in);
+      out.resize(array.size());
+      std::copy(array.cbegin(), array.cend(), out.begin());
+    } else {
+      auto const& array = get<Array const>(in);
+      out.resize(array.size());
+      std::transform(array.cbegin(), array.cend(), out.begin(),
+                     [](Json const& v) { return static_cast<float>(get<Number const>(v)); });
+    }
+  };
+  load_f32(in["cut_values"], &cut_values_);
+  load_f32(in["min_values"], &min_vals_);
+
+  auto& ptrs = cut_ptrs_.HostVector();
+  if (IsA<I64Array>(in["cut_ptrs"])) {
+    auto const& array = get<I64Array const>(in["cut_ptrs"]);
+    ptrs.resize(array.size());
+    std::copy(array.cbegin(), array.cend(), ptrs.begin());
+  } else {
+    auto const& array = get<Array const>(in["cut_ptrs"]);
+    ptrs.resize(array.size());
+    std::transform(array.cbegin(), array.cend(), ptrs.begin(), [](Json const& v) {
+      return static_cast<std::uint32_t>(get<Integer const>(v));
+    });
+  }
+
+  has_categorical_ = get<Boolean const>(in["has_categorical"]);
+  max_cat_ = get<Number const>(in["max_category"]);
+
+  CHECK_GE(ptrs.size(), 2) << "Invalid histogram cuts.";
+  CHECK_EQ(ptrs.front(), 0) << "Invalid histogram cuts.";
+  CHECK_EQ(ptrs.back(), cut_values_.Size()) << "Invalid histogram cuts.";
+  CHECK_EQ(min_vals_.Size(), ptrs.size() - 1) << "Invalid histogram cuts.";
+}
+
 HistogramCuts SketchOnDMatrix(Context const *ctx, DMatrix *m, bst_bin_t max_bins, bool use_sorted,
                               Span<float const> hessian) {
   HistogramCuts out;
@@ -79,6 +142,18 @@ void IncrementHist(GHistRow dst, ConstGHistRow add, std::size_t begin, std::size
   }
 }
 
+/*!
+ * \brief Merge a single precision partial into a double precision hist in range [begin, end)
+ */
+void IncrementHist(GHistRow dst, ConstGHistRowF32 add, std::size_t begin, std::size_t end) {
+  double *pdst = reinterpret_cast<double *>(dst.data());
+  const float *padd = reinterpret_cast<const float *>(add.data());
+
+  for (std::size_t i = 2 * begin; i < 2 * end; ++i) {
+    pdst[i] += padd[i];
+  }
+}
+
 /*!
  * \brief Copy hist from src to dst in range [begin, end)
  */
@@ -105,29 +180,6 @@ void SubtractionHist(GHistRow dst, const GHistRow src1, const GHistRow src2, siz
   }
 }
 
-struct Prefetch {
- public:
-  static constexpr size_t kCacheLineSize = 64;
-  static constexpr size_t kPrefetchOffset = 10;
-
- private:
-  static constexpr size_t kNoPrefetchSize =
-      kPrefetchOffset + kCacheLineSize /
-      sizeof(decltype(GHistIndexMatrix::row_ptr)::value_type);
-
- public:
-  static size_t NoPrefetchSize(size_t rows) {
-    return std::min(rows, kNoPrefetchSize);
-  }
-
-  template <typename T>
-  static constexpr size_t GetPrefetchStep() {
-    return Prefetch::kCacheLineSize / sizeof(T);
-  }
-};
-
-constexpr size_t Prefetch::kNoPrefetchSize;
-
 struct RuntimeFlags {
   const bool first_page;
   const bool read_by_column;
@@ -186,15 +238,17 @@ class GHistBuildingManager {
   }
 };
 
-template <bool do_prefetch, class BuildingManager>
-void RowsWiseBuildHistKernel(Span<GradientPair const> gpair, Span<bst_idx_t const> row_indices,
-                             const GHistIndexMatrix &gmat, GHistRow hist) {
+// HistRow selects the accumulation precision, GHistRow (double) for the regular build
+// and GHistRowF32 for float_hist partials.
+template <bool do_prefetch, class BuildingManager, typename HistRow = GHistRow>
+void RowsWiseBuildHistKernel(Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
+                             const GHistIndexMatrix &gmat, HistRow hist) {
   constexpr bool kAnyMissing = BuildingManager::kAnyMissing;
   constexpr bool kFirstPage = BuildingManager::kFirstPage;
   using BinIdxType = typename BuildingManager::BinIdxType;
 
   const size_t size = row_indices.size();
-  bst_idx_t const *rid = row_indices.data();
+  RowIndexT const *rid = row_indices.data();
   auto const *p_gpair = reinterpret_cast<const float *>(gpair.data());
   const BinIdxType *gradient_index = gmat.index.data<BinIdxType>();
 
@@ -218,7 +272,8 @@ void RowsWiseBuildHistKernel(Span<GradientPair const> gpair, Span<bst_idx_t cons
   CHECK_NE(row_indices.size(), 0);
   const size_t n_features =
       get_row_ptr(row_indices.data()[0] + 1) - get_row_ptr(row_indices.data()[0]);
-  auto hist_data = reinterpret_cast<double *>(hist.data());
+  using HistValueT = typename HistRow::value_type::ValueT;
+  auto hist_data = reinterpret_cast<HistValueT *>(hist.data());
   const uint32_t two{2};  // Each element from 'gpair' and 'hist' contains
                           // 2 FP values: gradient and hessian.
                           // So we need to multiply each row-index/bin-index by 2
@@ -242,10 +297,10 @@ void RowsWiseBuildHistKernel(Span<GradientPair const> gpair, Span<bst_idx_t cons
           kAnyMissing ? get_row_ptr(rid[i + Prefetch::kPrefetchOffset] + 1)
                       : icol_start_prefetch + n_features;
 
-      PREFETCH_READ_T0(p_gpair + two * rid[i + Prefetch::kPrefetchOffset]);
+      PrefetchReadT0(p_gpair + two * rid[i + Prefetch::kPrefetchOffset]);
       for (size_t j = icol_start_prefetch; j < icol_end_prefetch;
            j += Prefetch::GetPrefetchStep<uint32_t>()) {
-        PREFETCH_READ_T0(gradient_index + j);
+        PrefetchReadT0(gradient_index + j);
       }
     }
     const BinIdxType *gr_index_local = gradient_index + icol_start;
@@ -262,14 +317,151 @@ void RowsWiseBuildHistKernel(Span<GradientPair const> gpair, Span<bst_idx_t cons
   }
 }
 
+bool SimdHistSupported() {
+#if defined(XGBOOST_HIST_SIMD_PRESENT)
+  static bool const support = __builtin_cpu_supports("avx2") || __builtin_cpu_supports("avx512f");
+  return support;
+#else
+  return false;
+#endif  // defined(XGBOOST_HIST_SIMD_PRESENT)
+}
+
+#if defined(XGBOOST_HIST_SIMD_PRESENT)
+/* Explicitly vectorized variants of the row-wise kernel, dispatched at run time based on
+ * CPU support.  Bin indices within a single row are guaranteed to be distinct since each
+ * element belongs to a different feature and per-feature bin ranges are disjoint, hence
+ * lanes gathered/scattered from one row never alias each other.
+ */
+template <class BuildingManager>
+__attribute__((target("avx512f"))) void RowsWiseBuildHistKernelAvx512(
+    Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
+    const GHistIndexMatrix &gmat, GHistRow hist) {
+  constexpr bool kAnyMissing = BuildingManager::kAnyMissing;
+  constexpr bool kFirstPage = BuildingManager::kFirstPage;
+  using BinIdxType = typename BuildingManager::BinIdxType;
+
+  const size_t size = row_indices.size();
+  RowIndexT const *rid = row_indices.data();
+  auto const *p_gpair = reinterpret_cast<const float *>(gpair.data());
+  const BinIdxType *gradient_index = gmat.index.data<BinIdxType>();
+
+  auto const &row_ptr = gmat.row_ptr.data();
+  auto base_rowid = gmat.base_rowid;
+  std::uint32_t const *offsets = gmat.index.Offset();
+  auto get_row_ptr = [&](bst_idx_t ridx) {
+    return kFirstPage ? row_ptr[ridx] : row_ptr[ridx - base_rowid];
+  };
+  auto get_rid = [&](bst_idx_t ridx) { return kFirstPage ? ridx : (ridx - base_rowid); };
+
+  const size_t n_features =
+      get_row_ptr(row_indices.data()[0] + 1) - get_row_ptr(row_indices.data()[0]);
+  auto hist_data = reinterpret_cast<double *>(hist.data());
+
+  for (std::size_t i = 0; i < size; ++i) {
+    const size_t icol_start = kAnyMissing ? get_row_ptr(rid[i]) : get_rid(rid[i]) * n_features;
+    const size_t icol_end = kAnyMissing ? get_row_ptr(rid[i] + 1) : icol_start + n_features;
+    const size_t row_size = icol_end - icol_start;
+    const BinIdxType *gr_index_local = gradient_index + icol_start;
+
+    const size_t idx_gh = static_cast<size_t>(rid[i]) * 2;
+    __m512d const vgrad = _mm512_set1_pd(static_cast<double>(p_gpair[idx_gh]));
+    __m512d const vhess = _mm512_set1_pd(static_cast<double>(p_gpair[idx_gh + 1]));
+
+    size_t j = 0;
+    for (; j + 8 <= row_size; j += 8) {
+      alignas(32) std::int32_t idx[8];
+      for (int k = 0; k < 8; ++k) {
+        idx[k] = 2 * (static_cast<std::int32_t>(gr_index_local[j + k]) +
+                      (kAnyMissing ? 0 : offsets[j + k]));
+      }
+      __m256i const vidx = _mm256_load_si256(reinterpret_cast<__m256i const *>(idx));
+      __m512d const grad = _mm512_i32gather_pd(vidx, hist_data, 8);
+      __m512d const hess = _mm512_i32gather_pd(vidx, hist_data + 1, 8);
+      _mm512_i32scatter_pd(hist_data, vidx, _mm512_add_pd(grad, vgrad), 8);
+      _mm512_i32scatter_pd(hist_data + 1, vidx, _mm512_add_pd(hess, vhess), 8);
+    }
+    for (; j < row_size; ++j) {
+      const uint32_t idx_bin =
+          2 * (static_cast<uint32_t>(gr_index_local[j]) + (kAnyMissing ? 0 : offsets[j]));
+      hist_data[idx_bin] += p_gpair[idx_gh];
+      hist_data[idx_bin + 1] += p_gpair[idx_gh + 1];
+    }
+  }
+}
+
+template <class BuildingManager>
+__attribute__((target("avx2"))) void RowsWiseBuildHistKernelAvx2(
+    Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
+    const GHistIndexMatrix &gmat, GHistRow hist) {
+  constexpr bool kAnyMissing = BuildingManager::kAnyMissing;
+  constexpr bool kFirstPage = BuildingManager::kFirstPage;
+  using BinIdxType = typename BuildingManager::BinIdxType;
+
+  const size_t size = row_indices.size();
+  RowIndexT const *rid = row_indices.data();
+  auto const *p_gpair = reinterpret_cast<const float *>(gpair.data());
+  const BinIdxType *gradient_index = gmat.index.data<BinIdxType>();
+
+  auto const &row_ptr = gmat.row_ptr.data();
+  auto base_rowid = gmat.base_rowid;
+  std::uint32_t const *offsets = gmat.index.Offset();
+  auto get_row_ptr = [&](bst_idx_t ridx) {
+    return kFirstPage ? row_ptr[ridx] : row_ptr[ridx - base_rowid];
+  };
+  auto get_rid = [&](bst_idx_t ridx) { return kFirstPage ? ridx : (ridx - base_rowid); };
+
+  const size_t n_features =
+      get_row_ptr(row_indices.data()[0] + 1) - get_row_ptr(row_indices.data()[0]);
+  auto hist_data = reinterpret_cast<double *>(hist.data());
+
+  for (std::size_t i = 0; i < size; ++i) {
+    const size_t icol_start = kAnyMissing ? get_row_ptr(rid[i]) : get_rid(rid[i]) * n_features;
+    const size_t icol_end = kAnyMissing ? get_row_ptr(rid[i] + 1) : icol_start + n_features;
+    const size_t row_size = icol_end - icol_start;
+    const BinIdxType *gr_index_local = gradient_index + icol_start;
+
+    const size_t idx_gh = static_cast<size_t>(rid[i]) * 2;
+    __m256d const vgrad = _mm256_set1_pd(static_cast<double>(p_gpair[idx_gh]));
+    __m256d const vhess = _mm256_set1_pd(static_cast<double>(p_gpair[idx_gh + 1]));
+
+    size_t j = 0;
+    for (; j + 4 <= row_size; j += 4) {
+      alignas(16) std::int32_t idx[4];
+      for (int k = 0; k < 4; ++k) {
+        idx[k] = 2 * (static_cast<std::int32_t>(gr_index_local[j + k]) +
+                      (kAnyMissing ? 0 : offsets[j + k]));
+      }
+      __m128i const vidx = _mm_load_si128(reinterpret_cast<__m128i const *>(idx));
+      __m256d const grad = _mm256_add_pd(_mm256_i32gather_pd(hist_data, vidx, 8), vgrad);
+      __m256d const hess = _mm256_add_pd(_mm256_i32gather_pd(hist_data + 1, vidx, 8), vhess);
+      // AVX2 has no scatter, store lanes through a staging buffer instead.
+      alignas(32) double grad_out[4];
+      alignas(32) double hess_out[4];
+      _mm256_store_pd(grad_out, grad);
+      _mm256_store_pd(hess_out, hess);
+      for (int k = 0; k < 4; ++k) {
+        hist_data[idx[k]] = grad_out[k];
+        hist_data[idx[k] + 1] = hess_out[k];
+      }
+    }
+    for (; j < row_size; ++j) {
+      const uint32_t idx_bin =
+          2 * (static_cast<uint32_t>(gr_index_local[j]) + (kAnyMissing ? 0 : offsets[j]));
+      hist_data[idx_bin] += p_gpair[idx_gh];
+      hist_data[idx_bin + 1] += p_gpair[idx_gh + 1];
+    }
+  }
+}
+#endif  // defined(XGBOOST_HIST_SIMD_PRESENT)
+
 template <class BuildingManager>
-void ColsWiseBuildHistKernel(Span<GradientPair const> gpair, Span<bst_idx_t const> row_indices,
+void ColsWiseBuildHistKernel(Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
                              const GHistIndexMatrix &gmat, GHistRow hist) {
   constexpr bool kAnyMissing = BuildingManager::kAnyMissing;
   constexpr bool kFirstPage = BuildingManager::kFirstPage;
   using BinIdxType = typename BuildingManager::BinIdxType;
   const size_t size = row_indices.size();
-  bst_idx_t const *rid = row_indices.data();
+  RowIndexT const *rid = row_indices.data();
   auto const *pgh = reinterpret_cast<const float *>(gpair.data());
   const BinIdxType *gradient_index = gmat.index.data<BinIdxType>();
 
@@ -312,12 +504,169 @@ void ColsWiseBuildHistKernel(Span<GradientPair const> gpair, Span<bst_idx_t cons
   }
 }
 
+/**
+ * @brief CSC-driven build for sparse pages.
+ *
+ *   Iterates the nonzero entries of each column instead of chasing per-row offsets, so
+ *   the work is proportional to the nonzero count and consecutive accumulations land in
+ *   the same per-column slice of the histogram.  Sparse columns are not addressable by
+ *   row id, hence this kernel handles only contiguous row ranges; the root node build,
+ *   where the histogram cost matters the most, partitions rows into exactly such ranges.
+ */
+void SparseColsWiseBuildHistKernel(Span<GradientPair const> gpair,
+                                   Span<RowIndexT const> row_indices,
+                                   const GHistIndexMatrix &gmat, GHistRow hist) {
+  auto const &columns = gmat.Transpose();
+  auto const first = static_cast<std::size_t>(row_indices.front());
+  auto const last = static_cast<std::size_t>(row_indices.back()) + 1;
+  auto const *pgh = reinterpret_cast<const float *>(gpair.data());
+  auto hist_data = reinterpret_cast<double *>(hist.data());
+  const uint32_t two{2};  // See ColsWiseBuildHistKernel.
+
+  DispatchBinType(columns.GetTypeSize(), [&](auto dtype) {
+    using BinIdxType = decltype(dtype);
+    for (bst_feature_t fidx = 0; fidx < columns.GetNumFeature(); ++fidx) {
+      if (columns.GetColumnType(fidx) == ColumnType::kSparseColumn) {
+        auto column = columns.SparseColumn<BinIdxType>(fidx, first);
+        // Entries are sorted by row index, binary search for the start of the range.
+        std::size_t lo = 0, hi = column.Size();
+        while (lo < hi) {
+          auto mid = lo + (hi - lo) / 2;
+          if (column.GetRowIdx(mid) < first) {
+            lo = mid + 1;
+          } else {
+            hi = mid;
+          }
+        }
+        for (std::size_t k = lo; k < column.Size() && column.GetRowIdx(k) < last; ++k) {
+          const uint32_t idx_bin = two * static_cast<uint32_t>(column.GetGlobalBinIdx(k));
+          const size_t idx_gh = two * column.GetRowIdx(k);
+          const float pgh_t[] = {pgh[idx_gh], pgh[idx_gh + 1]};
+          hist_data[idx_bin] += pgh_t[0];
+          hist_data[idx_bin + 1] += pgh_t[1];
+        }
+      } else {
+        auto column = columns.DenseColumn<BinIdxType, true>(fidx);
+        for (std::size_t ridx = first; ridx < last; ++ridx) {
+          if (column.IsMissing(ridx)) {
+            continue;
+          }
+          const uint32_t idx_bin = two * static_cast<uint32_t>(column.GetGlobalBinIdx(ridx));
+          const size_t idx_gh = two * ridx;
+          const float pgh_t[] = {pgh[idx_gh], pgh[idx_gh + 1]};
+          hist_data[idx_bin] += pgh_t[0];
+          hist_data[idx_bin + 1] += pgh_t[1];
+        }
+      }
+    }
+  });
+}
+
+// Whether the CSC-driven kernel applies: a contiguous row range on the first page with
+// an initialized transpose, and sparse enough that per-row offset chasing dominates the
+// row-major walk.
+bool UseSparseColsWiseBuild(const GHistIndexMatrix &gmat, Span<RowIndexT const> row_indices) {
+  constexpr double kSparseColsWiseThresh = 0.2;
+  if (row_indices.empty() || gmat.base_rowid != 0) {
+    return false;
+  }
+  const size_t nrows = row_indices.size();
+  const bool contiguous =
+      (row_indices.begin()[nrows - 1] - row_indices.begin()[0]) == (nrows - 1);
+  if (!contiguous) {
+    return false;
+  }
+  auto const &columns = gmat.Transpose();
+  if (columns.GetNumFeature() != gmat.Features()) {
+    return false;  // transpose not built for this page
+  }
+  auto n_nnz = gmat.row_ptr[row_indices.back() + 1] - gmat.row_ptr[row_indices.front()];
+  auto density = static_cast<double>(n_nnz) /
+                 (static_cast<double>(nrows) * static_cast<double>(gmat.Features()));
+  return density < kSparseColsWiseThresh;
+}
+
+template <bool do_prefetch, class BuildingManager>
+void RowsWiseBuildHistKernelSoA(Span<float const> grad, Span<float const> hess,
+                                Span<RowIndexT const> row_indices, const GHistIndexMatrix &gmat,
+                                GHistRow hist) {
+  constexpr bool kAnyMissing = BuildingManager::kAnyMissing;
+  constexpr bool kFirstPage = BuildingManager::kFirstPage;
+  using BinIdxType = typename BuildingManager::BinIdxType;
+
+  const size_t size = row_indices.size();
+  RowIndexT const *rid = row_indices.data();
+  float const *p_grad = grad.data();
+  float const *p_hess = hess.data();
+  const BinIdxType *gradient_index = gmat.index.data<BinIdxType>();
+
+  auto const &row_ptr = gmat.row_ptr.data();
+  auto base_rowid = gmat.base_rowid;
+  std::uint32_t const *offsets = gmat.index.Offset();
+  auto get_row_ptr = [&](bst_idx_t ridx) {
+    return kFirstPage ? row_ptr[ridx] : row_ptr[ridx - base_rowid];
+  };
+  auto get_rid = [&](bst_idx_t ridx) { return kFirstPage ? ridx : (ridx - base_rowid); };
+
+  CHECK_NE(row_indices.size(), 0);
+  const size_t n_features =
+      get_row_ptr(row_indices.data()[0] + 1) - get_row_ptr(row_indices.data()[0]);
+  auto hist_data = reinterpret_cast<double *>(hist.data());
+
+  for (std::size_t i = 0; i < size; ++i) {
+    const size_t icol_start = kAnyMissing ? get_row_ptr(rid[i]) : get_rid(rid[i]) * n_features;
+    const size_t icol_end = kAnyMissing ? get_row_ptr(rid[i] + 1) : icol_start + n_features;
+    const size_t row_size = icol_end - icol_start;
+
+    if (do_prefetch) {
+      const size_t icol_start_prefetch =
+          kAnyMissing ? get_row_ptr(rid[i + Prefetch::kPrefetchOffset])
+                      : get_rid(rid[i + Prefetch::kPrefetchOffset]) * n_features;
+      const size_t icol_end_prefetch =
+          kAnyMissing ? get_row_ptr(rid[i + Prefetch::kPrefetchOffset] + 1)
+                      : icol_start_prefetch + n_features;
+
+      PrefetchReadT0(p_grad + rid[i + Prefetch::kPrefetchOffset]);
+      PrefetchReadT0(p_hess + rid[i + Prefetch::kPrefetchOffset]);
+      for (size_t j = icol_start_prefetch; j < icol_end_prefetch;
+           j += Prefetch::GetPrefetchStep<uint32_t>()) {
+        PrefetchReadT0(gradient_index + j);
+      }
+    }
+    const BinIdxType *gr_index_local = gradient_index + icol_start;
+
+    // The trick with pgh_t buffer helps the compiler to generate faster binary.
+    const float pgh_t[] = {p_grad[rid[i]], p_hess[rid[i]]};
+    for (size_t j = 0; j < row_size; ++j) {
+      const uint32_t idx_bin =
+          2 * (static_cast<uint32_t>(gr_index_local[j]) + (kAnyMissing ? 0 : offsets[j]));
+      auto hist_local = hist_data + idx_bin;
+      *(hist_local) += pgh_t[0];
+      *(hist_local + 1) += pgh_t[1];
+    }
+  }
+}
+
 template <class BuildingManager>
-void BuildHistDispatch(Span<GradientPair const> gpair, Span<bst_idx_t const> row_indices,
-                       const GHistIndexMatrix &gmat, GHistRow hist) {
+void BuildHistDispatch(Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
+                       const GHistIndexMatrix &gmat, GHistRow hist, HistBackend backend) {
   if (BuildingManager::kReadByColumn) {
     ColsWiseBuildHistKernel<BuildingManager>(gpair, row_indices, gmat, hist);
+#if defined(XGBOOST_HIST_SIMD_PRESENT)
+  } else if (backend == HistBackend::kSimd && SimdHistSupported()) {
+    if (row_indices.empty()) {
+      return;
+    }
+    // The gather-based kernels don't need software prefetching, the index buffer is
+    // walked linearly within each row.
+    if (__builtin_cpu_supports("avx512f")) {
+      RowsWiseBuildHistKernelAvx512<BuildingManager>(gpair, row_indices, gmat, hist);
+    } else {
+      RowsWiseBuildHistKernelAvx2<BuildingManager>(gpair, row_indices, gmat, hist);
+    }
+#endif  // defined(XGBOOST_HIST_SIMD_PRESENT)
   } else {
+    (void)backend;
     const size_t nrows = row_indices.size();
     const size_t no_prefetch_size = Prefetch::NoPrefetchSize(nrows);
     // if need to work with all rows from bin-matrix (e.g. root node)
@@ -345,29 +694,282 @@ void BuildHistDispatch(Span<GradientPair const> gpair, Span<bst_idx_t const> row
 }
 
 template <bool any_missing>
-void BuildHist(Span<GradientPair const> gpair, Span<bst_idx_t const> row_indices,
-               const GHistIndexMatrix &gmat, GHistRow hist, bool force_read_by_column) {
+void BuildHist(Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
+               const GHistIndexMatrix &gmat, GHistRow hist, bool force_read_by_column,
+               HistBackend backend) {
   /* force_read_by_column is used for testing the columnwise building of histograms.
    * default force_read_by_column = false
    */
-  constexpr double kAdhocL2Size = 1024 * 1024 * 0.8;
-  const bool hist_fit_to_l2 = kAdhocL2Size > 2 * sizeof(float) * gmat.cut.Ptrs().back();
+  // Keep ~80% of the measured L2 for the histogram so the gradient pairs and the index
+  // stream retain their share.  The remaining selection between the row-wise kernels is
+  // made per CPU at dispatch time.
+  static const double l2_size = common::L2CacheBytes() * 0.8;
+  const bool hist_fit_to_l2 = l2_size > 2 * sizeof(float) * gmat.cut.Ptrs().back();
   bool first_page = gmat.base_rowid == 0;
   bool read_by_column = !hist_fit_to_l2 && !any_missing;
+
+  if (any_missing && !force_read_by_column && UseSparseColsWiseBuild(gmat, row_indices)) {
+    SparseColsWiseBuildHistKernel(gpair, row_indices, gmat, hist);
+    return;
+  }
   auto bin_type_size = gmat.index.GetBinTypeSize();
 
   GHistBuildingManager<any_missing>::DispatchAndExecute(
       {first_page, read_by_column || force_read_by_column, bin_type_size}, [&](auto t) {
         using BuildingManager = decltype(t);
-        BuildHistDispatch<BuildingManager>(gpair, row_indices, gmat, hist);
+        BuildHistDispatch<BuildingManager>(gpair, row_indices, gmat, hist, backend);
       });
 }
 
-template void BuildHist<true>(Span<GradientPair const> gpair, Span<bst_idx_t const> row_indices,
+template void BuildHist<true>(Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
                               const GHistIndexMatrix &gmat, GHistRow hist,
-                              bool force_read_by_column);
+                              bool force_read_by_column, HistBackend backend);
 
-template void BuildHist<false>(Span<GradientPair const> gpair, Span<bst_idx_t const> row_indices,
+template void BuildHist<false>(Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
                                const GHistIndexMatrix &gmat, GHistRow hist,
-                               bool force_read_by_column);
+                               bool force_read_by_column, HistBackend backend);
+
+void BuildHistByFeature(Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
+                        const GHistIndexMatrix &gmat, GHistRow hist, bst_feature_t fbeg,
+                        bst_feature_t fend) {
+  auto const &columns = gmat.Transpose();
+  auto const *pgh = reinterpret_cast<const float *>(gpair.data());
+  auto hist_data = reinterpret_cast<double *>(hist.data());
+  auto base_rowid = gmat.base_rowid;
+  const uint32_t two{2};  // See ColsWiseBuildHistKernel.
+
+  DispatchBinType(columns.GetTypeSize(), [&](auto dtype) {
+    using BinIdxType = decltype(dtype);
+    for (bst_feature_t fidx = fbeg; fidx < fend; ++fidx) {
+      if (columns.GetColumnType(fidx) == ColumnType::kSparseColumn) {
+        // The iterator advances through the column as the sorted rows are consumed, so
+        // the column is walked at most once per node.
+        auto column = columns.SparseColumn<BinIdxType>(fidx, row_indices.front() - base_rowid);
+        for (auto ridx : row_indices) {
+          auto bin_idx = column[ridx - base_rowid];
+          if (bin_idx == Column<BinIdxType>::kMissingId) {
+            continue;
+          }
+          const uint32_t idx_bin = two * static_cast<uint32_t>(bin_idx);
+          const size_t idx_gh = two * ridx;
+          const float pgh_t[] = {pgh[idx_gh], pgh[idx_gh + 1]};
+          hist_data[idx_bin] += pgh_t[0];
+          hist_data[idx_bin + 1] += pgh_t[1];
+        }
+      } else {
+        auto column = columns.DenseColumn<BinIdxType, true>(fidx);
+        for (auto ridx : row_indices) {
+          auto in_page = ridx - base_rowid;
+          if (column.IsMissing(in_page)) {
+            continue;
+          }
+          const uint32_t idx_bin = two * static_cast<uint32_t>(column.GetGlobalBinIdx(in_page));
+          const size_t idx_gh = two * ridx;
+          const float pgh_t[] = {pgh[idx_gh], pgh[idx_gh + 1]};
+          hist_data[idx_bin] += pgh_t[0];
+          hist_data[idx_bin + 1] += pgh_t[1];
+        }
+      }
+    }
+  });
+}
+
+template <bool any_missing>
+void BuildHistSoA(Span<float const> grad, Span<float const> hess,
+                  Span<RowIndexT const> row_indices, const GHistIndexMatrix &gmat, GHistRow hist) {
+  CHECK_EQ(grad.size(), hess.size());
+  /* The SoA layout targets the streaming row-wise kernel, the column-wise kernel keeps
+   * using the interleaved layout as it's bound by histogram access instead of gradient
+   * loads.
+   */
+  bool first_page = gmat.base_rowid == 0;
+  auto bin_type_size = gmat.index.GetBinTypeSize();
+
+  GHistBuildingManager<any_missing>::DispatchAndExecute(
+      {first_page, false, bin_type_size}, [&](auto t) {
+        using BuildingManager = decltype(t);
+        const size_t nrows = row_indices.size();
+        if (nrows == 0) {
+          return;
+        }
+        const size_t no_prefetch_size = Prefetch::NoPrefetchSize(nrows);
+        const bool contiguous_block =
+            (row_indices.begin()[nrows - 1] - row_indices.begin()[0]) == (nrows - 1);
+        if (contiguous_block) {
+          RowsWiseBuildHistKernelSoA<false, BuildingManager>(grad, hess, row_indices, gmat, hist);
+        } else {
+          auto span1 = row_indices.subspan(0, nrows - no_prefetch_size);
+          if (!span1.empty()) {
+            RowsWiseBuildHistKernelSoA<true, BuildingManager>(grad, hess, span1, gmat, hist);
+          }
+          auto span2 = row_indices.subspan(nrows - no_prefetch_size);
+          if (!span2.empty()) {
+            RowsWiseBuildHistKernelSoA<false, BuildingManager>(grad, hess, span2, gmat, hist);
+          }
+        }
+      });
+}
+
+template void BuildHistSoA<true>(Span<float const> grad, Span<float const> hess,
+                                 Span<RowIndexT const> row_indices, const GHistIndexMatrix &gmat,
+                                 GHistRow hist);
+
+template void BuildHistSoA<false>(Span<float const> grad, Span<float const> hess,
+                                  Span<RowIndexT const> row_indices, const GHistIndexMatrix &gmat,
+                                  GHistRow hist);
+
+template <bool any_missing>
+void BuildHistF32(Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
+                  const GHistIndexMatrix &gmat, GHistRowF32 hist) {
+  /* Single precision rows exist to keep the per-thread partials small, so only the
+   * streaming row-wise kernel is provided; the column-wise kernels target histograms
+   * that overflow the cache, which the final double precision rows handle.
+   */
+  bool first_page = gmat.base_rowid == 0;
+  auto bin_type_size = gmat.index.GetBinTypeSize();
+
+  GHistBuildingManager<any_missing>::DispatchAndExecute(
+      {first_page, false, bin_type_size}, [&](auto t) {
+        using BuildingManager = decltype(t);
+        const size_t nrows = row_indices.size();
+        if (nrows == 0) {
+          return;
+        }
+        const size_t no_prefetch_size = Prefetch::NoPrefetchSize(nrows);
+        const bool contiguous_block =
+            (row_indices.begin()[nrows - 1] - row_indices.begin()[0]) == (nrows - 1);
+        if (contiguous_block) {
+          RowsWiseBuildHistKernel<false, BuildingManager>(gpair, row_indices, gmat, hist);
+        } else {
+          auto span1 = row_indices.subspan(0, nrows - no_prefetch_size);
+          if (!span1.empty()) {
+            RowsWiseBuildHistKernel<true, BuildingManager>(gpair, span1, gmat, hist);
+          }
+          auto span2 = row_indices.subspan(nrows - no_prefetch_size);
+          if (!span2.empty()) {
+            RowsWiseBuildHistKernel<false, BuildingManager>(gpair, span2, gmat, hist);
+          }
+        }
+      });
+}
+
+template void BuildHistF32<true>(Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
+                                 const GHistIndexMatrix &gmat, GHistRowF32 hist);
+
+template void BuildHistF32<false>(Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
+                                  const GHistIndexMatrix &gmat, GHistRowF32 hist);
+
+template <bool do_prefetch, class BuildingManager>
+void RowsWiseBuildHistKernelMulti(linalg::MatrixView<GradientPair const> gpair,
+                                  Span<RowIndexT const> row_indices, const GHistIndexMatrix &gmat,
+                                  Span<GHistRow const> hists) {
+  constexpr bool kAnyMissing = BuildingManager::kAnyMissing;
+  constexpr bool kFirstPage = BuildingManager::kFirstPage;
+  using BinIdxType = typename BuildingManager::BinIdxType;
+
+  const size_t size = row_indices.size();
+  RowIndexT const *rid = row_indices.data();
+  const size_t n_targets = hists.size();
+  auto const *p_gpair = reinterpret_cast<const float *>(gpair.Values().data());
+  const BinIdxType *gradient_index = gmat.index.data<BinIdxType>();
+
+  auto const &row_ptr = gmat.row_ptr.data();
+  auto base_rowid = gmat.base_rowid;
+  std::uint32_t const *offsets = gmat.index.Offset();
+  auto get_row_ptr = [&](bst_idx_t ridx) {
+    return kFirstPage ? row_ptr[ridx] : row_ptr[ridx - base_rowid];
+  };
+  auto get_rid = [&](bst_idx_t ridx) { return kFirstPage ? ridx : (ridx - base_rowid); };
+
+  CHECK_NE(row_indices.size(), 0);
+  const size_t n_features =
+      get_row_ptr(row_indices.data()[0] + 1) - get_row_ptr(row_indices.data()[0]);
+  std::vector<double *> hist_data(n_targets);
+  for (size_t t = 0; t < n_targets; ++t) {
+    hist_data[t] = reinterpret_cast<double *>(hists[t].data());
+  }
+  // A row of 'gpair' spans 2 * n_targets FP values, gradient and hessian for each
+  // target packed contiguously.
+  const size_t two_t = 2 * n_targets;
+
+  for (std::size_t i = 0; i < size; ++i) {
+    const size_t icol_start = kAnyMissing ? get_row_ptr(rid[i]) : get_rid(rid[i]) * n_features;
+    const size_t icol_end = kAnyMissing ? get_row_ptr(rid[i] + 1) : icol_start + n_features;
+    const size_t row_size = icol_end - icol_start;
+
+    if (do_prefetch) {
+      const size_t icol_start_prefetch =
+          kAnyMissing ? get_row_ptr(rid[i + Prefetch::kPrefetchOffset])
+                      : get_rid(rid[i + Prefetch::kPrefetchOffset]) * n_features;
+      const size_t icol_end_prefetch =
+          kAnyMissing ? get_row_ptr(rid[i + Prefetch::kPrefetchOffset] + 1)
+                      : icol_start_prefetch + n_features;
+
+      PrefetchReadT0(p_gpair + two_t * rid[i + Prefetch::kPrefetchOffset]);
+      for (size_t j = icol_start_prefetch; j < icol_end_prefetch;
+           j += Prefetch::GetPrefetchStep<uint32_t>()) {
+        PrefetchReadT0(gradient_index + j);
+      }
+    }
+    const BinIdxType *gr_index_local = gradient_index + icol_start;
+    const float *pgh_row = p_gpair + two_t * rid[i];
+
+    for (size_t j = 0; j < row_size; ++j) {
+      // The bin index is computed once per element, all targets scatter to the same
+      // offset of their own histogram.
+      const uint32_t idx_bin =
+          2 * (static_cast<uint32_t>(gr_index_local[j]) + (kAnyMissing ? 0 : offsets[j]));
+      for (size_t t = 0; t < n_targets; ++t) {
+        auto hist_local = hist_data[t] + idx_bin;
+        *(hist_local) += pgh_row[2 * t];
+        *(hist_local + 1) += pgh_row[2 * t + 1];
+      }
+    }
+  }
+}
+
+template <bool any_missing>
+void BuildHistMulti(linalg::MatrixView<GradientPair const> gpair,
+                    Span<RowIndexT const> row_indices, const GHistIndexMatrix &gmat,
+                    Span<GHistRow const> hists) {
+  CHECK(gpair.CContiguous());
+  CHECK_EQ(gpair.Shape(1), hists.size());
+  /* The fused kernel is row-wise only, the column-wise layout would recompute the
+   * column traversal once per target and lose the amortization.
+   */
+  bool first_page = gmat.base_rowid == 0;
+  auto bin_type_size = gmat.index.GetBinTypeSize();
+
+  GHistBuildingManager<any_missing>::DispatchAndExecute(
+      {first_page, false, bin_type_size}, [&](auto t) {
+        using BuildingManager = decltype(t);
+        const size_t nrows = row_indices.size();
+        if (nrows == 0) {
+          return;
+        }
+        const size_t no_prefetch_size = Prefetch::NoPrefetchSize(nrows);
+        const bool contiguous_block =
+            (row_indices.begin()[nrows - 1] - row_indices.begin()[0]) == (nrows - 1);
+        if (contiguous_block) {
+          RowsWiseBuildHistKernelMulti<false, BuildingManager>(gpair, row_indices, gmat, hists);
+        } else {
+          auto span1 = row_indices.subspan(0, nrows - no_prefetch_size);
+          if (!span1.empty()) {
+            RowsWiseBuildHistKernelMulti<true, BuildingManager>(gpair, span1, gmat, hists);
+          }
+          auto span2 = row_indices.subspan(nrows - no_prefetch_size);
+          if (!span2.empty()) {
+            RowsWiseBuildHistKernelMulti<false, BuildingManager>(gpair, span2, gmat, hists);
+          }
+        }
+      });
+}
+
+template void BuildHistMulti<true>(linalg::MatrixView<GradientPair const> gpair,
+                                   Span<RowIndexT const> row_indices, const GHistIndexMatrix &gmat,
+                                   Span<GHistRow const> hists);
+
+template void BuildHistMulti<false>(linalg::MatrixView<GradientPair const> gpair,
+                                    Span<RowIndexT const> row_indices, const GHistIndexMatrix &gmat,
+                                    Span<GHistRow const> hists);
 }  // namespace xgboost::common
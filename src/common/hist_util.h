@@ -11,17 +11,22 @@
 #include <cstdint>  // for uint32_t
 #include <limits>
 #include <map>
+#include <memory>  // for unique_ptr
 #include <utility>
 #include <vector>
 
 #include "categorical.h"
 #include "quantile.h"
+#include "ref_resource_view.h"  // for ReallocVector
+#include "row_set.h"            // for RowIndexT
 #include "threading_utils.h"
 #include "xgboost/base.h"  // for bst_feature_t, bst_bin_t
 #include "xgboost/data.h"
+#include "xgboost/linalg.h"  // for MatrixView
 
 namespace xgboost {
 class GHistIndexMatrix;
+class Json;
 
 namespace common {
 /*!
@@ -109,6 +114,24 @@ class HistogramCuts {
    */
   [[nodiscard]] bst_bin_t TotalBins() const { return this->cut_values_.Size(); }
 
+  /**
+   * @brief Whether two sets of cuts define the same binning.  Gradient indices built
+   *        from equal cuts are interchangeable.
+   */
+  [[nodiscard]] bool operator==(HistogramCuts const& that) const {
+    return has_categorical_ == that.has_categorical_ && max_cat_ == that.max_cat_ &&
+           this->Ptrs() == that.Ptrs() && this->MinValues() == that.MinValues() &&
+           this->Values() == that.Values();
+  }
+  /**
+   * @brief Save the cuts to JSON so that they can be shared across DMatrix instances.
+   */
+  void SaveJson(Json* p_out) const;
+  /**
+   * @brief Load cuts from the output of SaveJson.
+   */
+  void LoadJson(Json const& in);
+
   // Return the index of a cut point that is strictly greater than the input
   // value, or the last available index if none exists
   [[nodiscard]] bst_bin_t SearchBin(float value, bst_feature_t column_id,
@@ -347,6 +370,48 @@ class Index {
   Func func_;
 };
 
+/**
+ * @brief Compile-time typed view over a dense, compressed `Index`.
+ *
+ *   `Index::operator[]` decodes each element through a function pointer and recovers the
+ *   feature offset with a modulo, which is pure overhead in loops where the bin width is
+ *   fixed and the feature index is already known.  The view reads raw index bytes of the
+ *   given width instead.  Valid only for dense data where the feature-offset compression
+ *   is in use.
+ */
+template <typename BinIdxType>
+class DenseIndexView {
+  BinIdxType const* data_;
+  std::uint32_t const* offsets_;
+  std::size_t n_features_;
+
+ public:
+  explicit DenseIndexView(Index const& index, std::size_t n_features)
+      : data_{index.data<BinIdxType>()}, offsets_{index.Offset()}, n_features_{n_features} {
+    CHECK(offsets_);
+    CHECK_EQ(sizeof(BinIdxType), static_cast<std::size_t>(index.GetBinTypeSize()));
+  }
+  /** @brief Global bin index for the i-th element of the row-major bin storage. */
+  std::uint32_t operator[](std::size_t i) const {
+    return static_cast<std::uint32_t>(data_[i]) + offsets_[i % n_features_];
+  }
+  /** @brief Same as operator[], but with a known feature index to avoid the modulo. */
+  [[nodiscard]] std::uint32_t Value(std::size_t i, bst_feature_t fidx) const {
+    return static_cast<std::uint32_t>(data_[i]) + offsets_[fidx];
+  }
+};
+
+/**
+ * @brief Dispatch a dense `Index` to a `DenseIndexView` with compile-time bin width.
+ */
+template <typename Fn>
+auto DispatchDenseIndexView(Index const& index, std::size_t n_features, Fn&& fn) {
+  return DispatchBinType(index.GetBinTypeSize(), [&](auto t) {
+    using BinIdxType = decltype(t);
+    return fn(DenseIndexView<BinIdxType>{index, n_features});
+  });
+}
+
 template <typename GradientIndex>
 bst_bin_t XGBOOST_HOST_DEV_INLINE BinarySearchBin(std::size_t begin, std::size_t end,
                                                   GradientIndex const& data,
@@ -378,12 +443,23 @@ bst_bin_t XGBOOST_HOST_DEV_INLINE BinarySearchBin(std::size_t begin, std::size_t
 
 using GHistRow = Span<xgboost::GradientPairPrecise>;
 using ConstGHistRow = Span<xgboost::GradientPairPrecise const>;
+// Single precision rows, used for the per-thread partial histograms when
+// HistMakerTrainParam::float_hist is set.
+using GHistRowF32 = Span<xgboost::GradientPair>;
+using ConstGHistRowF32 = Span<xgboost::GradientPair const>;
 
 /*!
  * \brief Increment hist as dst += add in range [begin, end)
  */
 void IncrementHist(GHistRow dst, ConstGHistRow add, std::size_t begin, std::size_t end);
 
+/*!
+ * \brief Merge a single precision partial into a double precision hist in range
+ * [begin, end).  Each float term is widened before the add, so the accumulation itself
+ * is exact.
+ */
+void IncrementHist(GHistRow dst, ConstGHistRowF32 add, std::size_t begin, std::size_t end);
+
 /*!
  * \brief Copy hist from src to dst in range [begin, end)
  */
@@ -397,15 +473,25 @@ void SubtractionHist(GHistRow dst, const GHistRow src1, const GHistRow src2, siz
 
 /*!
  * \brief histogram of gradient statistics for multiple nodes
+ *
+ *  All rows live in a single arena that is retained for the lifetime of the collection
+ *  (and across `Init` calls with the same number of bins), so adding nodes is a pointer
+ *  bump instead of a per-node allocation.  Zero-filling is performed lazily by the
+ *  thread that first uses a row, which under a first-touch policy also places the
+ *  per-thread buffers on the local NUMA node.
+ *
+ *  Templated on the gradient pair type, double precision for the per-node results and
+ *  single precision for the per-thread partials in float_hist mode.
  */
-class HistCollection {
+template <typename GradientPairT>
+class HistCollectionImpl {
  public:
   // access histogram for i-th node
-  GHistRow operator[](bst_uint nid) const {
+  Span<GradientPairT> operator[](bst_uint nid) const {
     constexpr uint32_t kMax = std::numeric_limits<uint32_t>::max();
     const size_t id = row_ptr_.at(nid);
     CHECK_NE(id, kMax);
-    GradientPairPrecise* ptr = const_cast<GradientPairPrecise*>(data_[id].data());
+    GradientPairT* ptr = const_cast<GradientPairT*>(arena_->data() + id * nbins_);
     return {ptr, nbins_};
   }
 
@@ -414,6 +500,10 @@ class HistCollection {
     const uint32_t k_max = std::numeric_limits<uint32_t>::max();
     return (nid < row_ptr_.size() && row_ptr_[nid] != k_max);
   }
+  // has the row been zero-initialized already?
+  [[nodiscard]] bool RowAllocated(bst_uint nid) const {
+    return static_cast<bool>(row_allocated_.at(row_ptr_.at(nid)));
+  }
   /**
    * \brief Initialize histogram collection.
    *
@@ -423,9 +513,10 @@ class HistCollection {
     if (nbins_ != n_total_bins) {
       nbins_ = n_total_bins;
       // quite expensive operation, so let's do this only once
-      data_.clear();
+      arena_->Resize(0);
     }
     row_ptr_.clear();
+    row_allocated_.clear();
     n_nodes_added_ = 0;
   }
 
@@ -437,17 +528,23 @@ class HistCollection {
     }
     CHECK_EQ(row_ptr_[nid], kMax);
 
-    if (data_.size() < (nid + 1)) {
-      data_.resize((nid + 1));
-    }
-
     row_ptr_[nid] = n_nodes_added_;
     n_nodes_added_++;
+    row_allocated_.resize(n_nodes_added_, static_cast<int>(false));
+    // Grow the arena up-front: rows are handed out by offset to concurrent threads, the
+    // storage must not move once workers are running.
+    std::size_t required = static_cast<std::size_t>(n_nodes_added_) * nbins_;
+    if (required > arena_->size()) {
+      arena_->Resize(std::max<std::size_t>(required, arena_->size() * 2));
+    }
   }
-  // allocate thread local memory i-th node
+  // Lazily zero-initialize the row for i-th node.  The first call materializes the
+  // pages on the calling thread.
   void AllocateData(bst_uint nid) {
-    if (data_[row_ptr_[nid]].size() == 0) {
-      data_[row_ptr_[nid]].resize(nbins_, {0, 0});
+    auto id = row_ptr_[nid];
+    if (!row_allocated_[id]) {
+      std::fill_n(arena_->data() + id * nbins_, nbins_, GradientPairT{});
+      row_allocated_[id] = static_cast<int>(true);
     }
   }
 
@@ -456,12 +553,22 @@ class HistCollection {
   uint32_t nbins_ = 0;
   /*! \brief amount of active nodes in hist collection */
   uint32_t n_nodes_added_ = 0;
-  std::vector<std::vector<GradientPairPrecise>> data_;
+  /*! \brief contiguous storage for all rows, realloc-backed to avoid copies on growth */
+  using Vec = ReallocVector<GradientPairT>;
+  std::unique_ptr<Vec> arena_{new Vec{}};  // nvcc 12.1 trips over std::make_unique
+  /*!
+   * \brief dirty map marking rows that have been zero-initialized; 'int' is used
+   * instead of 'bool' because std::vector<bool> isn't thread safe
+   */
+  std::vector<int> row_allocated_;
 
   /*! \brief row_ptr_[nid] locates bin for histogram of node nid */
   std::vector<size_t> row_ptr_;
 };
 
+using HistCollection = HistCollectionImpl<GradientPairPrecise>;
+using HistCollectionF32 = HistCollectionImpl<GradientPair>;
+
 /*!
  * \brief Stores temporary histograms to compute them in parallel
  * Supports processing multiple tree-nodes for nested parallelism
@@ -478,9 +585,13 @@ class ParallelGHistBuilder {
 
   // Add new elements if needed, mark all hists as unused
   // targeted_hists - already allocated hists which should contain final results after Reduce() call
+  // float_partials - accumulate the per-thread partials in single precision, halving
+  //                  their footprint.  The targeted hists stay double precision.
   void Reset(size_t nthreads, size_t nodes, const BlockedSpace2d& space,
-             const std::vector<GHistRow>& targeted_hists) {
+             const std::vector<GHistRow>& targeted_hists, bool float_partials = false) {
+    float_partials_ = float_partials;
     hist_buffer_.Init(nbins_);
+    hist_buffer_f32_.Init(nbins_);
     tid_nid_to_hist_.clear();
     threads_to_nids_map_.clear();
 
@@ -501,23 +612,43 @@ class ParallelGHistBuilder {
 
   // Get specified hist, initialize hist by zeros if it wasn't used before
   GHistRow GetInitializedHist(size_t tid, size_t nid) {
+    CHECK(!float_partials_);
     CHECK_LT(nid, nodes_);
     CHECK_LT(tid, nthreads_);
 
     int idx = tid_nid_to_hist_.at({tid, nid});
     if (idx >= 0) {
+      // Lazily zero-initializes the row on this thread, each idx belongs to exactly
+      // one {tid, nid} pair so there's no concurrent initialization.
       hist_buffer_.AllocateData(idx);
     }
     GHistRow hist = idx == -1 ? targeted_hists_[nid] : hist_buffer_[idx];
 
     if (!hist_was_used_[tid * nodes_ + nid]) {
-      std::fill_n(hist.data(), hist.size(), GradientPairPrecise{});
+      if (idx == -1) {
+        // Externally owned target hist, the buffer rows are already zeroed above.
+        std::fill_n(hist.data(), hist.size(), GradientPairPrecise{});
+      }
       hist_was_used_[tid * nodes_ + nid] = static_cast<int>(true);
     }
 
     return hist;
   }
 
+  // Single precision counterpart of GetInitializedHist.  Every thread gets a buffer row
+  // here, the double precision target cannot serve as a partial.
+  GHistRowF32 GetInitializedHistF32(size_t tid, size_t nid) {
+    CHECK(float_partials_);
+    CHECK_LT(nid, nodes_);
+    CHECK_LT(tid, nthreads_);
+
+    int idx = tid_nid_to_hist_.at({tid, nid});
+    CHECK_GE(idx, 0);
+    hist_buffer_f32_.AllocateData(idx);
+    hist_was_used_[tid * nodes_ + nid] = static_cast<int>(true);
+    return hist_buffer_f32_[idx];
+  }
+
   // Reduce following bins (begin, end] for nid-node in dst across threads
   void ReduceHist(size_t nid, size_t begin, size_t end) const {
     CHECK_GT(end, begin);
@@ -528,9 +659,20 @@ class ParallelGHistBuilder {
     bool is_updated = false;
     for (size_t tid = 0; tid < nthreads_; ++tid) {
       if (hist_was_used_[tid * nodes_ + nid]) {
+        int idx = tid_nid_to_hist_.at({tid, nid});
+        if (float_partials_) {
+          if (!is_updated) {
+            // No thread wrote into the double precision target in this mode, reset it
+            // before the first merge.
+            std::fill(dst.data() + begin, dst.data() + end, GradientPairPrecise{});
+          }
+          is_updated = true;
+          // The merge accumulates in double, widening each float term is exact.
+          IncrementHist(dst, hist_buffer_f32_[idx], begin, end);
+          continue;
+        }
         is_updated = true;
 
-        int idx = tid_nid_to_hist_.at({tid, nid});
         GHistRow src = idx == -1 ? targeted_hists_[nid] : hist_buffer_[idx];
 
         if (dst.data() != src.data()) {
@@ -583,11 +725,21 @@ class ParallelGHistBuilder {
       // set nthreads_for_nid to 0 in this case.
       // In another case - allocate additional (nthreads_for_nid - 1) histograms,
       // because one is already allocated externally (will store final result for the node).
-      hist_allocated_additionally += std::max<int>(0, nthreads_for_nid - 1);
+      // With single precision partials the external hist cannot be used as a partial,
+      // every thread needs its own buffer row.
+      if (float_partials_) {
+        hist_allocated_additionally += nthreads_for_nid;
+      } else {
+        hist_allocated_additionally += std::max<int>(0, nthreads_for_nid - 1);
+      }
     }
 
     for (size_t i = 0; i < hist_allocated_additionally; ++i) {
-      hist_buffer_.AddHistRow(i);
+      if (float_partials_) {
+        hist_buffer_f32_.AddHistRow(i);
+      } else {
+        hist_buffer_.AddHistRow(i);
+      }
     }
   }
 
@@ -601,7 +753,7 @@ class ParallelGHistBuilder {
       bool first_hist = true;
       for (size_t tid = 0; tid < nthreads_; ++tid) {
         if (threads_to_nids_map_[tid * nodes_ + nid]) {
-          if (first_hist) {
+          if (first_hist && !float_partials_) {
             tid_nid_to_hist_[{tid, nid}] = -1;
             first_hist = false;
           } else {
@@ -620,6 +772,10 @@ class ParallelGHistBuilder {
   size_t nodes_ = 0;
   /*! \brief Buffer for additional histograms for Parallel processing  */
   HistCollection hist_buffer_;
+  /*! \brief Single precision buffer used instead of hist_buffer_ when float_partials_ */
+  HistCollectionF32 hist_buffer_f32_;
+  /*! \brief whether the per-thread partials are accumulated in single precision */
+  bool float_partials_ = false;
   /*!
    * \brief Marks which hists were used, it means that they should be merged.
    * Contains only {true or false} values
@@ -638,10 +794,71 @@ class ParallelGHistBuilder {
   std::map<std::pair<size_t, size_t>, int> tid_nid_to_hist_;
 };
 
+/**
+ * \brief Kernel used for accumulating gradient pairs into histogram bins.
+ *
+ * kDefault is the scalar kernel. kSimd selects an explicitly vectorized
+ * (AVX2/AVX-512) row-wise kernel when the CPU supports it, falling back to the
+ * scalar kernel otherwise.  Exposed mostly for testing and benchmarking, same
+ * as force_read_by_column.
+ */
+enum class HistBackend : std::uint8_t { kDefault = 0, kSimd = 1 };
+
+/**
+ * \brief Whether a vectorized histogram kernel is available on this CPU.
+ */
+bool SimdHistSupported();
+
 // construct a histogram via histogram aggregation
 template <bool any_missing>
-void BuildHist(Span<GradientPair const> gpair, Span<bst_idx_t const> row_indices,
-               const GHistIndexMatrix& gmat, GHistRow hist, bool force_read_by_column = false);
+void BuildHist(Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
+               const GHistIndexMatrix& gmat, GHistRow hist, bool force_read_by_column = false,
+               HistBackend backend = HistBackend::kDefault);
+
+/**
+ * \brief Build only the bins of the feature range [fbeg, fend) into the shared node
+ *        histogram.
+ *
+ *   Complements the row-parallel kernels for short-wide data: threads own disjoint
+ *   feature groups of the transposed (CSC) page and the bins of a feature form a
+ *   contiguous histogram slice, so the writes never overlap and no per-thread partials
+ *   or reduction are needed.  The caller must zero the target range and the row set
+ *   must be sorted, which `RowSetCollection` guarantees.
+ */
+void BuildHistByFeature(Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
+                        const GHistIndexMatrix& gmat, GHistRow hist, bst_feature_t fbeg,
+                        bst_feature_t fend);
+
+/**
+ * \brief Same as BuildHist, but consumes gradients in a structure-of-arrays layout where
+ *        grad and hess are two separate contiguous arrays.  Avoids the strided loads
+ *        caused by the interleaved GradientPair layout in the hot loop.
+ */
+template <bool any_missing>
+void BuildHistSoA(Span<float const> grad, Span<float const> hess,
+                  Span<RowIndexT const> row_indices, const GHistIndexMatrix& gmat, GHistRow hist);
+
+/**
+ * \brief Same as BuildHist, but accumulates into a single precision histogram.  Halves
+ *        the per-thread row footprint so large histograms stay cache resident, see
+ *        HistMakerTrainParam::float_hist.  Only the row-wise kernel is provided.
+ */
+template <bool any_missing>
+void BuildHistF32(Span<GradientPair const> gpair, Span<RowIndexT const> row_indices,
+                  const GHistIndexMatrix& gmat, GHistRowF32 hist);
+
+/**
+ * \brief Fused multi-target build.  The bin index of each element is computed once and
+ *        the gradient pairs of all targets are scattered to the same offset of their
+ *        respective histograms, instead of sweeping the index matrix once per target.
+ *
+ * \param gpair Row-major [n_samples, n_targets] gradient matrix, must be contiguous.
+ * \param hists One histogram per target, all covering the same bins.
+ */
+template <bool any_missing>
+void BuildHistMulti(linalg::MatrixView<GradientPair const> gpair,
+                    Span<RowIndexT const> row_indices, const GHistIndexMatrix& gmat,
+                    Span<GHistRow const> hists);
 }  // namespace common
 }  // namespace xgboost
 #endif  // XGBOOST_COMMON_HIST_UTIL_H_
@@ -7,8 +7,10 @@
 #include <cstddef>  // for size_t
 #include <cstdint>
 
+#include "cuda_staging.cuh"   // for StagingBufferPool
 #include "device_helpers.cuh"
 #include "device_vector.cuh"  // for DeviceUVector
+#include "transfer_stats.h"   // for TransferStats
 #include "xgboost/data.h"
 #include "xgboost/host_device_vector.h"
 #include "xgboost/tree_model.h"  // for RegTree
@@ -51,7 +53,9 @@ class HostDeviceVectorImpl {
     device_{that.device_},
     data_h_{std::move(that.data_h_)},
     data_d_{std::move(that.data_d_)},
-    gpu_access_{that.gpu_access_} {}
+    gpu_access_{that.gpu_access_},
+    last_transfer_{that.last_transfer_},
+    n_round_trips_{that.n_round_trips_} {}
 
   ~HostDeviceVectorImpl() {
     if (device_.IsCUDA()) {
@@ -200,8 +204,9 @@ class HostDeviceVectorImpl {
     gpu_access_ = access;
     if (data_h_.size() != data_d_->size()) { data_h_.resize(data_d_->size()); }
     SetDevice();
-    dh::safe_cuda(cudaMemcpy(data_h_.data(), data_d_->data(), data_d_->size() * sizeof(T),
-                             cudaMemcpyDeviceToHost));
+    common::cuda_impl::StagingBufferPool::Instance().CopyD2H(
+        data_h_.data(), data_d_->data(), data_d_->size() * sizeof(T), dh::DefaultStream());
+    this->RecordTransfer(Transfer::kD2H, data_d_->size() * sizeof(T));
   }
 
   void LazySyncDevice(GPUAccess access) {
@@ -214,9 +219,10 @@ class HostDeviceVectorImpl {
     // data is on the host
     LazyResizeDevice(data_h_.size());
     SetDevice();
-    dh::safe_cuda(cudaMemcpyAsync(data_d_->data(), data_h_.data(), data_d_->size() * sizeof(T),
-                                  cudaMemcpyHostToDevice, dh::DefaultStream()));
+    common::cuda_impl::StagingBufferPool::Instance().CopyH2D(
+        data_d_->data(), data_h_.data(), data_d_->size() * sizeof(T), dh::DefaultStream());
     gpu_access_ = access;
+    this->RecordTransfer(Transfer::kH2D, data_d_->size() * sizeof(T));
   }
 
   [[nodiscard]] bool HostCanAccess(GPUAccess access) const { return gpu_access_ <= access; }
@@ -228,10 +234,38 @@ class HostDeviceVectorImpl {
   [[nodiscard]] GPUAccess Access() const { return gpu_access_; }
 
  private:
+  enum class Transfer : std::uint8_t { kNone, kH2D, kD2H };
+
   DeviceOrd device_{DeviceOrd::CPU()};
   std::vector<T> data_h_{};
   std::unique_ptr<dh::DeviceUVector<T>> data_d_{};
   GPUAccess gpu_access_{GPUAccess::kNone};
+  // Direction of the last lazy synchronization, used to detect vectors that ping-pong
+  // between host and device.
+  Transfer last_transfer_{Transfer::kNone};
+  std::uint32_t n_round_trips_{0};
+
+  void RecordTransfer(Transfer dir, std::size_t n_bytes) {
+    auto& stats = common::TransferStats::Instance();
+    if (dir == Transfer::kH2D) {
+      stats.RecordH2D(n_bytes);
+    } else {
+      stats.RecordD2H(n_bytes);
+    }
+    if (last_transfer_ != Transfer::kNone && last_transfer_ != dir) {
+      ++n_round_trips_;
+      stats.RecordRoundTrip();
+      if (n_round_trips_ == common::TransferStats::ThrashThreshold()) {
+        // Logged once per vector, a ping-pong of this length usually means a CPU
+        // consumer runs after every GPU iteration on the same data.
+        LOG(DEBUG) << "HostDeviceVector with " << n_bytes
+                   << " bytes crossed the host/device boundary " << n_round_trips_
+                   << " times in alternating directions, check for code that forces a "
+                      "synchronization every iteration.  See `XGBGetTransferStats`.";
+      }
+    }
+    last_transfer_ = dir;
+  }
 
   void CopyToDevice(HostDeviceVectorImpl* other) {
     if (other->HostCanWrite()) {
@@ -34,6 +34,7 @@
 
 #include "io.h"
 #include "xgboost/collective/socket.h"  // for LastError
+#include "xgboost/global_config.h"      // for GlobalConfigThreadLocalStore
 #include "xgboost/logging.h"            // for CHECK_LE
 #include "xgboost/string_view.h"        // for StringView
 
@@ -255,6 +256,30 @@ void detail::CloseMmap(MMAPFile* handle) {
   delete handle;
 }
 
+void detail::AdviseHugePage(void* ptr, std::size_t n_bytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (!ptr || !GlobalConfigThreadLocalStore::Get()->use_hugepage) {
+    return;
+  }
+  // madvise requires page-aligned addresses while malloc gives no such guarantee, so
+  // advise the aligned interior of the allocation.  THP is applied by the kernel at
+  // 2MiB granularity within the advised range.
+  auto page = static_cast<std::uintptr_t>(getpagesize());
+  auto beg = (reinterpret_cast<std::uintptr_t>(ptr) + page - 1) & ~(page - 1);
+  auto end = (reinterpret_cast<std::uintptr_t>(ptr) + n_bytes) & ~(page - 1);
+  if (end <= beg) {
+    return;
+  }
+  // Best-effort, THP might be disabled system-wide.
+  if (madvise(reinterpret_cast<void*>(beg), end - beg, MADV_HUGEPAGE) != 0) {
+    LOG(DEBUG) << "madvise(MADV_HUGEPAGE) failed: " << SystemErrorMsg();
+  }
+#else
+  (void)ptr;
+  (void)n_bytes;
+#endif  // defined(__linux__) && defined(MADV_HUGEPAGE)
+}
+
 MmapResource::MmapResource(StringView path, std::size_t offset, std::size_t length)
     : ResourceHandler{kMmap},
       handle_{detail::OpenMmap(std::string{path}, offset, length), detail::CloseMmap},
@@ -271,6 +271,16 @@ namespace detail {
 [[nodiscard]] MMAPFile* OpenMmap(std::string path, std::size_t offset, std::size_t length);
 // close the mapped file handle.
 void CloseMmap(MMAPFile* handle);
+/**
+ * @brief Advise the kernel to back an allocation with transparent huge pages.
+ *
+ *   Honored only on Linux when the `use_hugepage` global config flag is set; the advice
+ *   covers the page-aligned interior of the allocation and failures are ignored, so the
+ *   call never affects correctness.
+ */
+void AdviseHugePage(void* ptr, std::size_t n_bytes);
+// Allocations below this are too small to hold an aligned 2MiB huge page.
+constexpr std::size_t HugePageThresholdBytes() { return std::size_t{4} << 20; }
 }  // namespace detail
 
 /**
@@ -398,6 +408,12 @@ class MallocResource : public ResourceHandler {
 
     ptr_ = new_ptr;
     n_ = n_bytes;
+    // Multi-GB buffers like the gradient index and the histogram arenas are built on top
+    // of this resource; huge pages cut the dTLB pressure of the random accesses into
+    // them.
+    if (n_bytes >= detail::HugePageThresholdBytes()) {
+      detail::AdviseHugePage(ptr_, n_bytes);
+    }
   }
 };
 
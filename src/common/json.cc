@@ -3,7 +3,9 @@
  */
 #include "xgboost/json.h"
 
+#include <algorithm>         // for copy, min
 #include <array>             // for array
+#include <atomic>            // for atomic
 #include <cctype>            // for isdigit
 #include <cmath>             // for isinf, isnan
 #include <cstdint>           // for uint8_t, uint16_t, uint32_t
@@ -14,12 +16,15 @@
 #include <iterator>          // for distance
 #include <limits>            // for numeric_limits
 #include <memory>            // for allocator
+#include <new>               // for operator new, placement new
 #include <sstream>           // for operator<<, basic_ostream, operator&, ios, stringstream
 #include <system_error>      // for errc
+#include <type_traits>       // for conditional_t, is_floating_point_v
 
 #include "./math.h"                 // for CheckNAN
 #include "charconv.h"               // for to_chars, NumericLimits, from_chars, to_chars_result
 #include "common.h"                 // for EscapeU8
+#include "threading_utils.h"        // for ParallelFor, OmpGetNumThreads, Sched
 #include "xgboost/base.h"           // for XGBOOST_EXPECT
 #include "xgboost/intrusive_ptr.h"  // for IntrusivePtr
 #include "xgboost/json_io.h"        // for JsonReader, UBJReader, UBJWriter, JsonWriter, ToBigEn...
@@ -33,15 +38,36 @@ void JsonWriter::Save(Json json) { json.Ptr()->Save(this); }
 void JsonWriter::Visit(JsonArray const* arr) {
   this->WriteArray(arr, [](auto const& v) { return v; });
 }
-void JsonWriter::Visit(F32Array const* arr) {
-  this->WriteArray(arr, [](float v) { return Json{v}; });
-}
 namespace {
-auto to_i64 = [](auto v) { return Json{static_cast<int64_t>(v)}; };
+// Bulk formatter for typed arrays.  The output is preallocated with the worst-case
+// width per element and the values are written with charconv directly, skipping the
+// per-element Json wrapper, virtual dispatch, and buffer growth of the generic path.
+template <typename T, Value::ValueKind kind>
+void WriteNumericArray(JsonTypedArray<T, kind> const* arr, std::vector<char>* stream) {
+  auto const& vec = arr->GetArray();
+  std::size_t n = vec.size();
+  using U = std::conditional_t<std::is_floating_point_v<T>, float, std::int64_t>;
+  auto constexpr kEntrySize = NumericLimits<U>::kToCharsSize + 1;  // +1 for the comma
+  auto s = stream->size();
+  stream->resize(s + n * kEntrySize + 2);
+  auto ptr = stream->data() + s;
+  *ptr++ = '[';
+  for (std::size_t i = 0; i < n; ++i) {
+    auto ret = to_chars(ptr, ptr + NumericLimits<U>::kToCharsSize, static_cast<U>(vec[i]));
+    ptr = ret.ptr;
+    if (i != n - 1) {
+      *ptr++ = ',';
+    }
+  }
+  *ptr++ = ']';
+  stream->resize(ptr - stream->data());
+}
 }  // anonymous namespace
-void JsonWriter::Visit(U8Array const* arr) { this->WriteArray(arr, to_i64); }
-void JsonWriter::Visit(I32Array const* arr) { this->WriteArray(arr, to_i64); }
-void JsonWriter::Visit(I64Array const* arr) { this->WriteArray(arr, to_i64); }
+
+void JsonWriter::Visit(F32Array const* arr) { WriteNumericArray(arr, stream_); }
+void JsonWriter::Visit(U8Array const* arr) { WriteNumericArray(arr, stream_); }
+void JsonWriter::Visit(I32Array const* arr) { WriteNumericArray(arr, stream_); }
+void JsonWriter::Visit(I64Array const* arr) { WriteNumericArray(arr, stream_); }
 
 void JsonWriter::Visit(JsonObject const* obj) {
   stream_->emplace_back('{');
@@ -128,6 +154,89 @@ void JsonWriter::Visit(JsonBoolean const* boolean) {
   }
 }
 
+namespace {
+/**
+ * Slab-pooled allocator for JSON value nodes.  Each node is prefixed with a pointer to
+ * its owning slab (null for nodes that fall back to the global allocator).  Slabs are
+ * bump-allocated from a thread-local cursor and reference counted: the allocating
+ * thread holds one reference while a slab is being filled, each live node holds one,
+ * and the memory goes back to the system once the count drops to zero.  A node can
+ * therefore outlive the document it was parsed for and be destroyed on any thread.
+ */
+struct alignas(alignof(std::max_align_t)) Slab {
+  std::atomic<std::int64_t> refs{1};  // the reference held by the allocating thread
+  std::size_t cursor{0};
+
+  static constexpr std::size_t kSlabBytes = 64u << 10;
+  // Nodes small enough to come out of a slab.  All value types fit at the time of
+  // writing; the global allocator fallback keeps this future-proof.
+  static constexpr std::size_t kMaxNodeBytes = 256;
+
+  char* Data() { return reinterpret_cast<char*>(this + 1); }
+
+  static Slab* Create() {
+    auto ptr = ::operator new(sizeof(Slab) + kSlabBytes);
+    return new (ptr) Slab{};
+  }
+  static void Release(Slab* slab) {
+    if (slab->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      slab->~Slab();
+      ::operator delete(slab);
+    }
+  }
+};
+
+constexpr std::size_t kNodeAlign = alignof(std::max_align_t);
+// The header storing the owning slab, padded so that the payload stays aligned.
+constexpr std::size_t kNodeHeaderBytes = kNodeAlign;
+
+// Owns the slab this thread is currently filling, retiring it on thread exit.
+struct SlabOwner {
+  Slab* current{nullptr};
+
+  ~SlabOwner() {
+    if (current != nullptr) {
+      Slab::Release(current);
+    }
+  }
+};
+thread_local SlabOwner slab_owner;  // NOLINT
+}  // anonymous namespace
+
+void* Value::operator new(std::size_t size) {
+  auto bytes = kNodeHeaderBytes + ((size + kNodeAlign - 1) / kNodeAlign) * kNodeAlign;
+  void* ptr{nullptr};
+  Slab* slab{nullptr};
+  if (bytes <= Slab::kMaxNodeBytes) {
+    auto& owner = slab_owner;
+    if (owner.current == nullptr || owner.current->cursor + bytes > Slab::kSlabBytes) {
+      if (owner.current != nullptr) {
+        // Retire the full slab, live nodes keep it alive.
+        Slab::Release(owner.current);
+      }
+      owner.current = Slab::Create();
+    }
+    slab = owner.current;
+    ptr = slab->Data() + slab->cursor;
+    slab->cursor += bytes;
+    slab->refs.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    ptr = ::operator new(bytes);
+  }
+  *static_cast<Slab**>(ptr) = slab;
+  return static_cast<char*>(ptr) + kNodeHeaderBytes;
+}
+
+void Value::operator delete(void* ptr) noexcept {
+  auto base = static_cast<char*>(ptr) - kNodeHeaderBytes;
+  auto slab = *reinterpret_cast<Slab**>(base);
+  if (slab != nullptr) {
+    Slab::Release(slab);
+  } else {
+    ::operator delete(base);
+  }
+}
+
 // Value
 std::string Value::TypeStr() const {
   switch (kind_) {
@@ -418,8 +527,23 @@ void ParseStr(std::string const& str) {
   result.resize(end);
 }
 
-Json JsonReader::ParseString() {
+std::string JsonReader::ReadString() {
   Char ch { GetConsecutiveChar('\"') };  // NOLINT
+  // Fast path: bulk-copy the literal when it contains no escape sequence.  Object keys
+  // almost always take this branch, and short ones land in the small string buffer of
+  // std::string without touching the heap.
+  auto beg = cursor_.Pos();
+  auto pos = beg;
+  while (pos < raw_str_.size() && raw_str_[pos] != '\"' && raw_str_[pos] != '\\' &&
+         raw_str_[pos] != '\r' && raw_str_[pos] != '\n') {
+    ++pos;
+  }
+  if (pos < raw_str_.size() && raw_str_[pos] == '\"') {
+    std::string str{raw_str_.c_str() + beg, pos - beg};
+    cursor_.Forward(static_cast<uint32_t>(pos - beg + 1));
+    return str;
+  }
+
   std::string str;
   while (true) {
     ch = GetNextChar();
@@ -445,9 +569,11 @@ Json JsonReader::ParseString() {
       Expect('\"', ch);
     }
   }
-  return Json(std::move(str));
+  return str;
 }
 
+Json JsonReader::ParseString() { return Json{this->ReadString()}; }
+
 Json JsonReader::ParseNull() {
   Char ch = GetNextNonSpaceChar();
   std::string buffer{static_cast<char>(ch)};
@@ -501,7 +627,7 @@ Json JsonReader::ParseObject() {
     if (ch != '"') {
       Expect('"', ch);
     }
-    Json key = ParseString();
+    auto key = ReadString();
 
     ch = GetNextNonSpaceChar();
 
@@ -511,7 +637,7 @@ Json JsonReader::ParseObject() {
 
     Json value { Parse() };
 
-    data[get<String>(key)] = std::move(value);
+    data.insert_or_assign(std::move(key), std::move(value));
 
     ch = GetNextNonSpaceChar();
 
@@ -847,6 +973,38 @@ Json UBJReader::Parse() {
   return {};
 }
 
+namespace {
+// Number of elements processed per task when byte-swapping in parallel.
+constexpr std::int64_t kSwapChunkSize = 1 << 16;
+
+template <typename T>
+void SwapEndianness(T* data, std::size_t n) {
+  if (DMLC_LITTLE_ENDIAN == 0) {
+    return;  // already big endian
+  }
+  auto swap_range = [&](std::size_t beg, std::size_t end) {
+    for (auto i = beg; i < end; ++i) {
+      data[i] = ToBigEndian(data[i]);
+    }
+  };
+  auto n_threads = common::OmpGetNumThreads(0);
+  if (static_cast<std::int64_t>(n) >= kSwapChunkSize * 2 && n_threads > 1) {
+    auto n_chunks = common::DivRoundUp(static_cast<std::int64_t>(n), kSwapChunkSize);
+    common::ParallelFor(n_chunks, n_threads, [&](auto c) {
+      swap_range(c * kSwapChunkSize,
+                 std::min(static_cast<std::size_t>((c + 1) * kSwapChunkSize), n));
+    });
+  } else {
+    swap_range(0, n);
+  }
+}
+}  // anonymous namespace
+
+void ToBigEndian(float* data, std::size_t n) { SwapEndianness(data, n); }
+void ToBigEndian(double* data, std::size_t n) { SwapEndianness(data, n); }
+void ToBigEndian(std::int32_t* data, std::size_t n) { SwapEndianness(data, n); }
+void ToBigEndian(std::int64_t* data, std::size_t n) { SwapEndianness(data, n); }
+
 namespace {
 template <typename T>
 void WritePrimitive(T v, std::vector<char>* stream) {
@@ -878,6 +1036,29 @@ void UBJWriter::Visit(JsonArray const* arr) {
   stream_->push_back('#');
   stream_->push_back('L');
   WritePrimitive(n, stream_);
+  // Elements of a length-prefixed array occupy independent byte ranges, so a large
+  // array like the trees of a boosted model can be serialized in parallel and spliced.
+  // The output is identical to the sequential visit.
+  std::int64_t constexpr kParThreshold = 128;
+  auto n_threads = common::OmpGetNumThreads(0);
+  if (n >= kParThreshold && n_threads > 1) {
+    std::vector<std::vector<char>> buffers(n);
+    common::ParallelFor(n, n_threads, common::Sched::Dyn(), [&](auto i) {
+      UBJWriter writer{&buffers[i]};
+      writer.Save(vec[i]);
+    });
+    std::size_t total{0};
+    for (auto const& buf : buffers) {
+      total += buf.size();
+    }
+    auto s = stream_->size();
+    stream_->resize(s + total);
+    for (auto const& buf : buffers) {
+      std::memcpy(stream_->data() + s, buf.data(), buf.size());
+      s += buf.size();
+    }
+    return;
+  }
   for (auto const& v : vec) {
     this->Save(v);
   }
@@ -911,10 +1092,29 @@ void WriteTypedArray(JsonTypedArray<T, kind> const* arr, std::vector<char>* stre
   auto s = stream->size();
   stream->resize(s + arr->Size() * sizeof(T));
   auto const& vec = arr->GetArray();
-  for (int64_t i = 0; i < n; ++i) {
-    auto v = ToBigEndian(vec[i]);
-    std::memcpy(stream->data() + s, &v, sizeof(v));
-    s += sizeof(v);
+  auto data = stream->data() + s;
+  if constexpr (sizeof(T) == 1) {
+    std::memcpy(data, vec.data(), vec.size());
+  } else {
+    // The output buffer isn't necessarily aligned for T, so the big endian elements go
+    // through a fixed-size memcpy, which compiles down to a load/bswap/store.  Large
+    // arrays are chunked across threads, each element has an independent byte range.
+    auto swap_range = [&](std::int64_t beg, std::int64_t end) {
+      auto ptr = data + beg * static_cast<std::int64_t>(sizeof(T));
+      for (auto i = beg; i < end; ++i, ptr += sizeof(T)) {
+        auto v = ToBigEndian(vec[i]);
+        std::memcpy(ptr, &v, sizeof(v));
+      }
+    };
+    auto n_threads = common::OmpGetNumThreads(0);
+    if (n >= kSwapChunkSize * 2 && n_threads > 1) {
+      auto n_chunks = common::DivRoundUp(n, kSwapChunkSize);
+      common::ParallelFor(n_chunks, n_threads, [&](auto c) {
+        swap_range(c * kSwapChunkSize, std::min((c + 1) * kSwapChunkSize, n));
+      });
+    } else {
+      swap_range(0, n);
+    }
   }
 }
 
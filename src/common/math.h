@@ -11,6 +11,8 @@
 
 #include <algorithm>    // for max
 #include <cmath>        // for exp, abs, log, lgamma
+#include <cstdint>      // for int32_t
+#include <cstring>      // for memcpy
 #include <limits>       // for numeric_limits
 #include <type_traits>  // for is_floating_point_v, conditional, is_signed, is_same, declval
 #include <utility>      // for pair
@@ -38,6 +40,111 @@ XGBOOST_DEVICE inline double Sigmoid(double x) {
   auto y = 1.0 / denom;
   return y;
 }
+
+/*!
+ * \brief Fast polynomial approximation of expf.
+ *
+ * Splits x into an integral power of two and a residual on [-ln2/2, ln2/2], evaluates a
+ * degree-6 minimax polynomial for the residual and assembles the exponent with bit
+ * arithmetic.  Branch-free, so compilers can vectorize loops calling it.  Maximum
+ * relative error is about 2 ulp; the input is clamped to [-87, 88] where expf is finite.
+ */
+XGBOOST_DEVICE inline float ApproxExp(float x) {
+  x = fminf(fmaxf(x, -87.0f), 88.0f);
+  float z = floorf(1.44269504088896341f * x + 0.5f);  // round(x / ln2)
+  // Cody-Waite style two-part ln2 to keep the residual accurate.
+  float r = x - z * 0.693359375f;
+  r = r - z * -2.12194440e-4f;
+  float p = 1.9875691500e-4f;
+  p = p * r + 1.3981999507e-3f;
+  p = p * r + 8.3334519073e-3f;
+  p = p * r + 4.1665795894e-2f;
+  p = p * r + 1.6666665459e-1f;
+  p = p * r + 5.0000001201e-1f;
+  p = p * r * r + r + 1.0f;
+  // 2^z through the exponent bits.
+  std::int32_t bits = (static_cast<std::int32_t>(z) + 127) << 23;
+  float scale;
+  std::memcpy(&scale, &bits, sizeof(scale));
+  return p * scale;
+}
+
+/*!
+ * \brief Sigmoid built on \ref ApproxExp, same guards as \ref Sigmoid.
+ */
+XGBOOST_DEVICE inline float ApproxSigmoid(float x) {
+  float constexpr kEps = 1e-16;  // avoid 0 div
+  auto denom = ApproxExp(-x) + 1.0f + kEps;
+  return 1.0f / denom;
+}
+/*!
+ * \brief Convert a float to IEEE 754 binary16 bits with round-to-nearest-even.
+ *
+ * Storage-only quantization; arithmetic stays in binary32.  Values beyond the half range
+ * become infinity and tiny values go through the subnormal path, matching hardware
+ * conversion semantics.
+ */
+inline std::uint16_t ToHalf(float f) {
+  std::uint32_t bits;
+  std::memcpy(&bits, &f, sizeof(bits));
+  std::uint32_t const sign = (bits >> 16) & 0x8000u;
+  bits &= 0x7FFFFFFFu;
+  if (bits >= 0x47800000u) {  // beyond the half range, or inf/nan
+    if (bits > 0x7F800000u) {
+      return static_cast<std::uint16_t>(sign | 0x7E00u);  // quiet nan
+    }
+    return static_cast<std::uint16_t>(sign | 0x7C00u);  // inf
+  }
+  if (bits < 0x38800000u) {  // subnormal half, or zero
+    std::uint32_t const shift = 113u - (bits >> 23);
+    if (shift > 24u) {
+      return static_cast<std::uint16_t>(sign);
+    }
+    std::uint32_t const mant = (bits & 0x7FFFFFu) | 0x800000u;
+    std::uint32_t half = mant >> (shift + 13u);
+    std::uint32_t const rem = mant & ((1u << (shift + 13u)) - 1u);
+    std::uint32_t const mid = 1u << (shift + 12u);
+    half += (rem > mid) || (rem == mid && (half & 1u));
+    return static_cast<std::uint16_t>(sign | half);
+  }
+  // The exponent re-bias (127 to 15) and the mantissa truncation in one shift.
+  std::uint32_t half = (bits - 0x38000000u) >> 13;
+  std::uint32_t const rem = bits & 0x1FFFu;
+  half += (rem > 0x1000u) || (rem == 0x1000u && (half & 1u));
+  return static_cast<std::uint16_t>(sign | half);
+}
+
+/*!
+ * \brief Widen IEEE 754 binary16 bits back to a float, the exact inverse of \ref ToHalf
+ *        for values that survived the narrowing.
+ */
+inline float FromHalf(std::uint16_t h) {
+  std::uint32_t const sign = static_cast<std::uint32_t>(h & 0x8000u) << 16;
+  std::uint32_t const exp = (h >> 10) & 0x1Fu;
+  std::uint32_t mant = h & 0x3FFu;
+  std::uint32_t bits;
+  if (exp == 0) {
+    if (mant == 0) {
+      bits = sign;
+    } else {
+      // Normalize the subnormal into the regular float representation.
+      std::uint32_t e = 113;
+      while ((mant & 0x400u) == 0) {
+        mant <<= 1;
+        --e;
+      }
+      bits = sign | (e << 23) | ((mant & 0x3FFu) << 13);
+    }
+  } else if (exp == 0x1Fu) {
+    bits = sign | 0x7F800000u | (mant << 13);
+  } else {
+    bits = sign | ((exp + 112u) << 23) | (mant << 13);
+  }
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
 /*!
  * \brief Equality test for both integer and floating point.
  */
@@ -79,6 +186,29 @@ XGBOOST_DEVICE inline void Softmax(Iterator start, Iterator end) {
   }
 }
 
+/*!
+ * \brief Inplace softmax using \ref ApproxExp, see \ref Softmax.
+ */
+template <typename Iterator>
+XGBOOST_DEVICE inline void ApproxSoftmax(Iterator start, Iterator end) {
+  static_assert(
+      std::is_same_v<
+          float, typename std::remove_reference_t<decltype(std::declval<Iterator>().operator*())>>,
+      "Values should be of type bst_float");
+  bst_float wmax = *start;
+  for (Iterator i = start + 1; i != end; ++i) {
+    wmax = fmaxf(*i, wmax);
+  }
+  double wsum = 0.0f;
+  for (Iterator i = start; i != end; ++i) {
+    *i = ApproxExp(*i - wmax);
+    wsum += *i;
+  }
+  for (Iterator i = start; i != end; ++i) {
+    *i /= static_cast<float>(wsum);
+  }
+}
+
 /*!
  * \brief Find the maximum iterator within the iterators
  * \param begin The beginning iterator.
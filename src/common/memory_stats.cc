@@ -0,0 +1,17 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include "memory_stats.h"
+
+#include <cstddef>  // for size_t
+
+namespace xgboost::common {
+MemoryUsageRegistry& MemoryUsageRegistry::Instance() {
+  static MemoryUsageRegistry registry;
+  return registry;
+}
+
+#if !defined(XGBOOST_USE_CUDA)
+std::size_t CurrentDeviceMemoryBytes() { return 0; }
+#endif  // !defined(XGBOOST_USE_CUDA)
+}  // namespace xgboost::common
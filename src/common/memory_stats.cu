@@ -0,0 +1,16 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include <cstddef>  // for size_t
+
+#include "device_vector.cuh"  // for GlobalMemoryLogger
+#include "memory_stats.h"
+
+namespace xgboost::common {
+std::size_t CurrentDeviceMemoryBytes() {
+  // The logger only tracks allocations when verbosity is at least debug, same as the
+  // peak usage report.
+  auto n_bytes = dh::GlobalMemoryLogger().CurrentlyAllocatedBytes();
+  return n_bytes < 0 ? 0 : static_cast<std::size_t>(n_bytes);
+}
+}  // namespace xgboost::common
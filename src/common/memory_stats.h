@@ -0,0 +1,103 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ *
+ * @brief Process-wide accounting of memory by the major owners, exposed through the
+ *        `XGBGetMemoryUsage` C API.
+ */
+#ifndef XGBOOST_COMMON_MEMORY_STATS_H_
+#define XGBOOST_COMMON_MEMORY_STATS_H_
+
+#include <algorithm>  // for min
+#include <cstddef>    // for size_t
+#include <map>        // for map
+#include <mutex>    // for mutex, lock_guard
+#include <string>   // for string
+#include <utility>  // for exchange
+
+namespace xgboost::common {
+/**
+ * @brief Registry of currently allocated bytes per component.
+ *
+ *   Major memory owners report their footprint through an embedded
+ *   @ref MemoryUsageReporter, so an OOM can be attributed to the component that holds
+ *   the memory instead of guessing from the dataset shape.  Device allocations are
+ *   tracked by the allocators themselves, see `dh::GlobalMemoryLogger`.
+ */
+class MemoryUsageRegistry {
+  mutable std::mutex mu_;
+  std::map<std::string, std::size_t> components_;
+
+ public:
+  static MemoryUsageRegistry& Instance();
+
+  void Add(char const* component, std::size_t n_bytes) {
+    std::lock_guard guard{mu_};
+    components_[component] += n_bytes;
+  }
+  void Remove(char const* component, std::size_t n_bytes) {
+    std::lock_guard guard{mu_};
+    auto it = components_.find(component);
+    if (it == components_.cend()) {
+      return;
+    }
+    it->second -= std::min(it->second, n_bytes);
+  }
+  [[nodiscard]] std::map<std::string, std::size_t> Snapshot() const {
+    std::lock_guard guard{mu_};
+    return components_;
+  }
+};
+
+/**
+ * @brief RAII handle a memory owner embeds to keep the registry in sync.
+ *
+ *   The owner calls @ref Update with its current footprint whenever the storage
+ *   changes; the destructor withdraws whatever is still reported.
+ */
+class MemoryUsageReporter {
+  char const* component_;
+  std::size_t current_{0};
+
+ public:
+  explicit MemoryUsageReporter(char const* component) : component_{component} {}
+  // A copy starts with nothing reported, the owner reports again once its storage is in
+  // place.  Transferring the bytes would double count them.
+  MemoryUsageReporter(MemoryUsageReporter const& that) : component_{that.component_} {}
+  MemoryUsageReporter& operator=(MemoryUsageReporter const& that) {
+    this->Update(0);
+    component_ = that.component_;
+    return *this;
+  }
+  MemoryUsageReporter(MemoryUsageReporter&& that) noexcept
+      : component_{that.component_}, current_{std::exchange(that.current_, 0)} {}
+  MemoryUsageReporter& operator=(MemoryUsageReporter&& that) noexcept {
+    this->Update(0);
+    component_ = that.component_;
+    current_ = std::exchange(that.current_, 0);
+    return *this;
+  }
+  ~MemoryUsageReporter() { this->Update(0); }
+
+  /** @brief Set the owner's current footprint, adjusting the registry by the delta. */
+  void Update(std::size_t n_bytes) {
+    if (n_bytes == current_) {
+      return;
+    }
+    auto& registry = MemoryUsageRegistry::Instance();
+    if (n_bytes > current_) {
+      registry.Add(component_, n_bytes - current_);
+    } else {
+      registry.Remove(component_, current_ - n_bytes);
+    }
+    current_ = n_bytes;
+  }
+  [[nodiscard]] std::size_t Current() const { return current_; }
+};
+
+/**
+ * @brief Bytes currently allocated on the device by the tracked allocators, 0 when
+ *        XGBoost is compiled without CUDA.
+ */
+[[nodiscard]] std::size_t CurrentDeviceMemoryBytes();
+}  // namespace xgboost::common
+#endif  // XGBOOST_COMMON_MEMORY_STATS_H_
@@ -6,11 +6,10 @@
 
 #include <dmlc/common.h>  // OMPException
 
-#include <algorithm>    // for max
+#include <algorithm>    // for max, min
 #include <cstddef>      // for size_t
 #include <cstdint>      // for int32_t
 #include <iterator>     // for iterator_traits
-#include <numeric>      // for accumulate
 #include <type_traits>  // for is_same_v
 #include <vector>       // for vector
 
@@ -108,18 +107,50 @@ inline double Reduce(Context const*, HostDeviceVector<float> const&) {
 #endif  // !defined(XGBOOST_USE_CUDA)
 }  // namespace cuda_impl
 
+namespace cpu_impl {
+/**
+ * \brief Pairwise (cascade) summation over [begin, end). init must be additive identity.
+ *
+ *   The reduction tree is a function of the range only, so the result does not depend on
+ *   evaluation order, and the error grows logarithmically instead of linearly with n.
+ */
+template <typename It, typename V = typename It::value_type>
+V PairwiseSum(It first, std::size_t begin, std::size_t end, V const& init) {
+  std::size_t n = end - begin;
+  std::size_t constexpr kLeafSize = 64;
+  if (n <= kLeafSize) {
+    V result = init;
+    for (std::size_t i = begin; i < end; ++i) {
+      result += first[i];
+    }
+    return result;
+  }
+  auto mid = begin + n / 2;
+  return PairwiseSum(first, begin, mid, init) + PairwiseSum(first, mid, end, init);
+}
+
 /**
  * \brief Reduction with iterator. init must be additive identity. (0 for primitive types)
+ *
+ *   The input is cut into fixed-size blocks regardless of the number of threads and both
+ *   the blocks and the per-block results are combined with pairwise summation.  The
+ *   result is therefore reproducible across different values of nthread, unlike
+ *   accumulating into thread-local slots in scheduling order.
  */
-namespace cpu_impl {
 template <typename It, typename V = typename It::value_type>
 V Reduce(Context const* ctx, It first, It second, V const& init) {
   std::size_t n = std::distance(first, second);
-  auto n_threads = static_cast<std::size_t>(std::min(n, static_cast<std::size_t>(ctx->Threads())));
-  common::MemStackAllocator<V, common::DefaultMaxThreads()> result_tloc(n_threads, init);
-  common::ParallelFor(n, n_threads, [&](auto i) { result_tloc[omp_get_thread_num()] += first[i]; });
-  auto result = std::accumulate(result_tloc.cbegin(), result_tloc.cbegin() + n_threads, init);
-  return result;
+  std::size_t constexpr kBlockSize = 1024;
+  std::size_t n_blocks = n / kBlockSize + !!(n % kBlockSize);
+  if (n_blocks <= 1) {
+    return PairwiseSum(first, 0, n, init);
+  }
+  std::vector<V> block_sums(n_blocks, init);
+  common::ParallelFor(n_blocks, ctx->Threads(), [&](auto b) {
+    block_sums[b] =
+        PairwiseSum(first, b * kBlockSize, std::min(n, (b + 1) * kBlockSize), init);
+  });
+  return PairwiseSum(block_sums.cbegin(), 0, n_blocks, init);
 }
 }  // namespace cpu_impl
 
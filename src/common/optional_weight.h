@@ -5,6 +5,7 @@
 #define XGBOOST_COMMON_OPTIONAL_WEIGHT_H_
 #include "xgboost/base.h"                // XGBOOST_DEVICE
 #include "xgboost/context.h"             // Context
+#include "xgboost/data.h"                // MetaInfo
 #include "xgboost/host_device_vector.h"  // HostDeviceVector
 #include "xgboost/span.h"                // Span
 
@@ -28,5 +29,16 @@ inline OptionalWeights MakeOptionalWeights(Context const* ctx,
   }
   return OptionalWeights{ctx->IsCUDA() ? weights.ConstDeviceSpan() : weights.ConstHostSpan()};
 }
+
+/**
+ * @brief Make sample weights from the meta info, collapsing uniform weights into the
+ *        scalar path so the per-element gather is skipped.
+ */
+inline OptionalWeights MakeOptionalWeights(Context const* ctx, MetaInfo const& info) {
+  if (!info.weights_.Empty() && info.IsUniformWeights()) {
+    return OptionalWeights{info.weights_.ConstHostVector().front()};
+  }
+  return MakeOptionalWeights(ctx, info.weights_);
+}
 }  // namespace xgboost::common
 #endif  // XGBOOST_COMMON_OPTIONAL_WEIGHT_H_
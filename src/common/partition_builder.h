@@ -18,6 +18,7 @@
 #include "../tree/sample_position.h"  // for SamplePosition
 #include "categorical.h"
 #include "column_matrix.h"
+#include "prefetch.h"  // for Prefetch, PrefetchReadT0
 #include "row_set.h"  // for RowSetCollection
 #include "xgboost/context.h"
 #include "xgboost/tree_model.h"
@@ -55,20 +56,31 @@ class PartitionBuilder {
   // Analog of std::stable_partition, but in no-inplace manner
   template <bool default_left, bool any_missing, typename ColumnType, typename Predicate>
   std::pair<size_t, size_t> PartitionKernel(ColumnType* p_column,
-                                            common::Span<bst_idx_t const> row_indices,
-                                            common::Span<bst_idx_t> left_part,
-                                            common::Span<bst_idx_t> right_part,
+                                            common::Span<RowIndexT const> row_indices,
+                                            common::Span<RowIndexT> left_part,
+                                            common::Span<RowIndexT> right_part,
                                             bst_idx_t base_rowid, Predicate&& pred) {
     auto& column = *p_column;
-    bst_idx_t* p_left_part = left_part.data();
-    bst_idx_t* p_right_part = right_part.data();
-    bst_idx_t nleft_elems = 0;
-    bst_idx_t nright_elems = 0;
+    RowIndexT* p_left_part = left_part.data();
+    RowIndexT* p_right_part = right_part.data();
+    RowIndexT nleft_elems = 0;
+    RowIndexT nright_elems = 0;
 
     auto p_row_indices = row_indices.data();
     auto n_samples = row_indices.size();
 
+    // The node's rows are visited through an index indirection, which the hardware
+    // prefetcher cannot follow once the partition becomes scattered.  Prefetch the bin
+    // index a fixed distance ahead for columns with direct row addressing.
+    std::size_t const prefetch_end =
+        n_samples > Prefetch::kPrefetchOffset ? n_samples - Prefetch::kPrefetchOffset : 0;
+
     for (size_t i = 0; i < n_samples; ++i) {
+      if constexpr (ColumnType::kDirectIndex) {
+        if (i < prefetch_end) {
+          column.PrefetchBinIdx(p_row_indices[i + Prefetch::kPrefetchOffset] - base_rowid);
+        }
+      }
       auto rid = p_row_indices[i];
       bst_bin_t const bin_id = column[rid - base_rowid];
       if (any_missing && bin_id == ColumnType::kMissingId) {
@@ -90,14 +102,14 @@ class PartitionBuilder {
   }
 
   template <typename Pred>
-  inline std::pair<size_t, size_t> PartitionRangeKernel(common::Span<const bst_idx_t> ridx,
-                                                        common::Span<bst_idx_t> left_part,
-                                                        common::Span<bst_idx_t> right_part,
+  inline std::pair<size_t, size_t> PartitionRangeKernel(common::Span<RowIndexT const> ridx,
+                                                        common::Span<RowIndexT> left_part,
+                                                        common::Span<RowIndexT> right_part,
                                                         Pred pred) {
-    bst_idx_t* p_left_part = left_part.data();
-    bst_idx_t* p_right_part = right_part.data();
-    bst_idx_t nleft_elems = 0;
-    bst_idx_t nright_elems = 0;
+    RowIndexT* p_left_part = left_part.data();
+    RowIndexT* p_right_part = right_part.data();
+    RowIndexT nleft_elems = 0;
+    RowIndexT nright_elems = 0;
     for (auto row_id : ridx) {
       if (pred(row_id)) {
         p_left_part[nleft_elems++] = row_id;
@@ -112,10 +124,10 @@ class PartitionBuilder {
   void Partition(const size_t node_in_set, std::vector<ExpandEntry> const& nodes,
                  const common::Range1d range, const bst_bin_t split_cond,
                  GHistIndexMatrix const& gmat, const common::ColumnMatrix& column_matrix,
-                 const RegTree& tree, bst_idx_t const* rid) {
-    common::Span<bst_idx_t const> rid_span{rid + range.begin(), rid + range.end()};
-    common::Span<bst_idx_t> left = GetLeftBuffer(node_in_set, range.begin(), range.end());
-    common::Span<bst_idx_t> right = GetRightBuffer(node_in_set, range.begin(), range.end());
+                 const RegTree& tree, RowIndexT const* rid) {
+    common::Span<RowIndexT const> rid_span{rid + range.begin(), rid + range.end()};
+    common::Span<RowIndexT> left = GetLeftBuffer(node_in_set, range.begin(), range.end());
+    common::Span<RowIndexT> right = GetRightBuffer(node_in_set, range.begin(), range.end());
     std::size_t nid = nodes[node_in_set].nid;
     bst_feature_t fid = tree.SplitIndex(nid);
     bool default_left = tree.DefaultLeft(nid);
@@ -184,7 +196,7 @@ class PartitionBuilder {
   }
 
   template <bool any_missing, typename ColumnType, typename Predicate>
-  void MaskKernel(ColumnType* p_column, common::Span<bst_idx_t const> row_indices,
+  void MaskKernel(ColumnType* p_column, common::Span<RowIndexT const> row_indices,
                   bst_idx_t base_rowid, BitVector* decision_bits, BitVector* missing_bits,
                   Predicate&& pred) {
     auto& column = *p_column;
@@ -207,8 +219,8 @@ class PartitionBuilder {
   void MaskRows(const size_t node_in_set, std::vector<ExpandEntry> const& nodes,
                 const common::Range1d range, bst_bin_t split_cond, GHistIndexMatrix const& gmat,
                 const common::ColumnMatrix& column_matrix, const RegTree& tree,
-                bst_idx_t const* rid, BitVector* decision_bits, BitVector* missing_bits) {
-    common::Span<bst_idx_t const> rid_span{rid + range.begin(), rid + range.end()};
+                RowIndexT const* rid, BitVector* decision_bits, BitVector* missing_bits) {
+    common::Span<RowIndexT const> rid_span{rid + range.begin(), rid + range.end()};
     std::size_t nid = nodes[node_in_set].nid;
     bst_feature_t fid = tree.SplitIndex(nid);
     bool is_cat = tree.GetSplitTypes()[nid] == FeatureType::kCategorical;
@@ -264,11 +276,11 @@ class PartitionBuilder {
   template <typename ExpandEntry>
   void PartitionByMask(const size_t node_in_set, std::vector<ExpandEntry> const& nodes,
                        const common::Range1d range, GHistIndexMatrix const& gmat,
-                       const RegTree& tree, bst_idx_t const* rid, BitVector const& decision_bits,
+                       const RegTree& tree, RowIndexT const* rid, BitVector const& decision_bits,
                        BitVector const& missing_bits) {
-    common::Span<bst_idx_t const> rid_span(rid + range.begin(), rid + range.end());
-    common::Span<bst_idx_t> left = GetLeftBuffer(node_in_set, range.begin(), range.end());
-    common::Span<bst_idx_t> right = GetRightBuffer(node_in_set, range.begin(), range.end());
+    common::Span<RowIndexT const> rid_span(rid + range.begin(), rid + range.end());
+    common::Span<RowIndexT> left = GetLeftBuffer(node_in_set, range.begin(), range.end());
+    common::Span<RowIndexT> right = GetRightBuffer(node_in_set, range.begin(), range.end());
     std::size_t nid = nodes[node_in_set].nid;
     bool default_left = tree.DefaultLeft(nid);
 
@@ -300,12 +312,12 @@ class PartitionBuilder {
     }
   }
 
-  common::Span<bst_idx_t> GetLeftBuffer(int nid, size_t begin, size_t end) {
+  common::Span<RowIndexT> GetLeftBuffer(int nid, size_t begin, size_t end) {
     const size_t task_idx = GetTaskIdx(nid, begin);
     return { mem_blocks_.at(task_idx)->Left(), end - begin };
   }
 
-  common::Span<bst_idx_t> GetRightBuffer(int nid, size_t begin, size_t end) {
+  common::Span<RowIndexT> GetRightBuffer(int nid, size_t begin, size_t end) {
     const size_t task_idx = GetTaskIdx(nid, begin);
     return { mem_blocks_.at(task_idx)->Right(), end - begin };
   }
@@ -347,14 +359,14 @@ class PartitionBuilder {
     }
   }
 
-  void MergeToArray(bst_node_t nid, size_t begin, bst_idx_t* rows_indexes) {
+  void MergeToArray(bst_node_t nid, size_t begin, RowIndexT* rows_indexes) {
     size_t task_idx = GetTaskIdx(nid, begin);
 
-    bst_idx_t* left_result = rows_indexes + mem_blocks_[task_idx]->n_offset_left;
-    bst_idx_t* right_result = rows_indexes + mem_blocks_[task_idx]->n_offset_right;
+    RowIndexT* left_result = rows_indexes + mem_blocks_[task_idx]->n_offset_left;
+    RowIndexT* right_result = rows_indexes + mem_blocks_[task_idx]->n_offset_right;
 
-    bst_idx_t const* left = mem_blocks_[task_idx]->Left();
-    bst_idx_t const* right = mem_blocks_[task_idx]->Right();
+    RowIndexT const* left = mem_blocks_[task_idx]->Left();
+    RowIndexT const* right = mem_blocks_[task_idx]->Right();
 
     std::copy_n(left, mem_blocks_[task_idx]->n_left, left_result);
     std::copy_n(right, mem_blocks_[task_idx]->n_right, right_result);
@@ -395,16 +407,16 @@ class PartitionBuilder {
     size_t n_offset_left;
     size_t n_offset_right;
 
-    bst_idx_t* Left() {
+    RowIndexT* Left() {
       return &left_data_[0];
     }
 
-    bst_idx_t* Right() {
+    RowIndexT* Right() {
       return &right_data_[0];
     }
    private:
-    bst_idx_t left_data_[BlockSize];
-    bst_idx_t right_data_[BlockSize];
+    RowIndexT left_data_[BlockSize];
+    RowIndexT right_data_[BlockSize];
   };
   std::vector<std::pair<size_t, size_t>> left_right_nodes_sizes_;
   std::vector<size_t> blocks_offsets_;
@@ -0,0 +1,52 @@
+/**
+ * Copyright 2017-2024, XGBoost Contributors
+ * \file prefetch.h
+ * \brief Software prefetch helpers shared by the CPU hot loops.
+ */
+#ifndef XGBOOST_COMMON_PREFETCH_H_
+#define XGBOOST_COMMON_PREFETCH_H_
+
+#include <algorithm>  // for min
+#include <cstddef>    // for size_t
+
+#if defined(XGBOOST_MM_PREFETCH_PRESENT)
+#include <xmmintrin.h>
+#endif  // defined(XGBOOST_MM_PREFETCH_PRESENT)
+
+namespace xgboost::common {
+/**
+ * \brief Prefetch a cache line for reading into all cache levels.  No-op when no
+ *        prefetch intrinsic is available.
+ */
+inline void PrefetchReadT0(void const* addr) {
+#if defined(XGBOOST_MM_PREFETCH_PRESENT)
+  _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0);
+#elif defined(XGBOOST_BUILTIN_PREFETCH_PRESENT)
+  __builtin_prefetch(addr, 0, 3);
+#else
+  (void)addr;
+#endif  // defined(XGBOOST_MM_PREFETCH_PRESENT)
+}
+
+/**
+ * \brief Constants used for software prefetching in loops that access memory through an
+ *        index indirection.
+ */
+struct Prefetch {
+ public:
+  static constexpr size_t kCacheLineSize = 64;
+  static constexpr size_t kPrefetchOffset = 10;
+
+ private:
+  static constexpr size_t kNoPrefetchSize = kPrefetchOffset + kCacheLineSize / sizeof(size_t);
+
+ public:
+  static size_t NoPrefetchSize(size_t rows) { return std::min(rows, kNoPrefetchSize); }
+
+  template <typename T>
+  static constexpr size_t GetPrefetchStep() {
+    return Prefetch::kCacheLineSize / sizeof(T);
+  }
+};
+}  // namespace xgboost::common
+#endif  // XGBOOST_COMMON_PREFETCH_H_
@@ -8,10 +8,13 @@
 #include <utility>
 
 #include "../collective/aggregator.h"
+#include "../collective/comm.h"       // for Channel
+#include "../collective/comm_group.h"  // for GlobalCommGroup
 #include "../common/error_msg.h"  // for InvalidMaxBin
 #include "../data/adapter.h"
 #include "categorical.h"
 #include "hist_util.h"
+#include "type.h"  // for EraseType
 
 namespace xgboost::common {
 template <typename WQSketch>
@@ -31,6 +34,7 @@ SketchContainerImpl<WQSketch>::SketchContainerImpl(Context const *ctx,
   sketches_.resize(columns_size_.size());
   CHECK_GE(n_threads_, 1);
   categories_.resize(columns_size_.size());
+  prebinned_max_.resize(columns_size_.size(), -1.0f);
   has_categorical_ = std::any_of(feature_types_.cbegin(), feature_types_.cend(), IsCatOp{});
 }
 
@@ -216,6 +220,74 @@ void SketchContainerImpl<WQSketch>::GatherSketchInfo(
   }
 }
 
+template <typename WQSketch>
+void SketchContainerImpl<WQSketch>::ButterflyMerge(
+    Context const *ctx, std::vector<typename WQSketch::SummaryContainer> *p_reduced,
+    std::vector<int32_t> const &num_cuts) {
+  auto &reduced = *p_reduced;
+  auto world = collective::GetWorldSize();
+  auto rank = collective::GetRank();
+  auto const &comm = collective::GlobalCommGroup()->Ctx(ctx, DeviceOrd::CPU());
+  bst_feature_t n_columns = reduced.size();
+
+  // log2(world) rounds, pairing with rank ^ 2^k in round k.  Summaries are pruned back
+  // to the intermediate number of cuts after every merge, so each round moves at most
+  // `num_cuts` entries per feature regardless of the raw data size.
+  for (std::int32_t dist = 1; dist < world; dist *= 2) {
+    auto peer = rank ^ dist;
+
+    // Per-feature CSC indptr into the flattened entries.
+    std::vector<std::uint64_t> self_scan(n_columns + 1, 0);
+    for (bst_feature_t fidx = 0; fidx < n_columns; ++fidx) {
+      self_scan[fidx + 1] = IsCat(feature_types_, fidx) ? 0 : reduced[fidx].size;
+    }
+    std::partial_sum(self_scan.cbegin(), self_scan.cend(), self_scan.begin());
+    std::vector<typename WQSketch::Entry> self_entries(self_scan.back());
+    for (bst_feature_t fidx = 0; fidx < n_columns; ++fidx) {
+      auto const &summary = reduced[fidx];
+      if (!IsCat(feature_types_, fidx)) {
+        std::copy(summary.data, summary.data + summary.size,
+                  self_entries.begin() + self_scan[fidx]);
+      }
+    }
+
+    auto ch = comm.Chan(peer);
+    std::vector<std::uint64_t> peer_scan(n_columns + 1, 0);
+    auto rc = collective::Success() << [&] {
+      return ch->SendAll(common::EraseType(common::Span{self_scan.data(), self_scan.size()}));
+    } << [&] {
+      return ch->RecvAll(common::EraseType(common::Span{peer_scan.data(), peer_scan.size()}));
+    } << [&] { return comm.Block(); };
+    if (!rc.OK()) {
+      collective::SafeColl(collective::Fail("Failed to exchange sketch sizes.", std::move(rc)));
+    }
+
+    std::vector<typename WQSketch::Entry> peer_entries(peer_scan.back());
+    rc = collective::Success() << [&] {
+      return ch->SendAll(common::EraseType(common::Span{self_entries.data(), self_entries.size()}));
+    } << [&] {
+      return ch->RecvAll(common::EraseType(common::Span{peer_entries.data(), peer_entries.size()}));
+    } << [&] { return comm.Block(); };
+    if (!rc.OK()) {
+      collective::SafeColl(collective::Fail("Failed to exchange sketches.", std::move(rc)));
+    }
+
+    ParallelFor(n_columns, n_threads_, [&](auto fidx) {
+      if (IsCat(feature_types_, fidx) || num_cuts[fidx] == 0) {
+        return;
+      }
+      typename WQSketch::Summary theirs{peer_entries.data() + peer_scan[fidx],
+                                        peer_scan[fidx + 1] - peer_scan[fidx]};
+      typename WQSketch::SummaryContainer combined;
+      combined.Reserve(reduced[fidx].size + theirs.size);
+      combined.SetCombine(reduced[fidx], theirs);
+      // Prune back down so the next round stays bounded; the reserved space from the
+      // local prune is large enough since `SetPrune` emits at most `num_cuts` entries.
+      reduced[fidx].SetPrune(combined, num_cuts[fidx]);
+    });
+  }
+}
+
 template <typename WQSketch>
 void SketchContainerImpl<WQSketch>::AllreduceCategories(Context const* ctx, MetaInfo const& info) {
   auto world_size = collective::GetWorldSize();
@@ -320,6 +392,9 @@ void SketchContainerImpl<WQSketch>::AllReduce(
     }
     if (IsCat(feature_types_, i)) {
       intermediate_num_cuts = categories_[i].size();
+    } else if (IsPreBinned(feature_types_, i)) {
+      // Identity cuts are derived from the observed maximum, there is no sketch to prune.
+      return;
     } else {
       typename WQSketch::SummaryContainer out;
       sketches_[i].GetSummary(&out);
@@ -336,35 +411,78 @@ void SketchContainerImpl<WQSketch>::AllReduce(
     return;
   }
 
+  // Power-of-two worlds can merge with a butterfly exchange where every round moves only
+  // pruned summaries, so the traffic scales with the number of bins instead of gathering
+  // every worker's sketch onto every worker.  Federated workers have no direct channels
+  // and keep the gather-based path.
+  if (((world & (world - 1)) == 0) &&
+      !collective::GlobalCommGroup()->Ctx(ctx, DeviceOrd::CPU()).IsFederated()) {
+    this->ButterflyMerge(ctx, p_reduced, num_cuts);
+    monitor_.Stop(__func__);
+    return;
+  }
+
   std::vector<bst_idx_t> worker_segments(1, 0);  // CSC pointer to sketches.
   std::vector<bst_idx_t> sketches_scan((n_columns + 1) * world, 0);
 
   std::vector<typename WQSketch::Entry> global_sketches;
   this->GatherSketchInfo(ctx, info, reduced, &worker_segments, &sketches_scan, &global_sketches);
 
-  std::vector<typename WQSketch::SummaryContainer> final_sketches(n_columns);
-
   ParallelFor(n_columns, n_threads_, [&](auto fidx) {
     // gcc raises subobject-linkage warning if we put allreduce_result as lambda capture
     QuantileAllreduce<typename WQSketch::Entry> allreduce_result{global_sketches, worker_segments,
                                                                  sketches_scan, n_columns};
     int32_t intermediate_num_cuts = num_cuts[fidx];
-    auto nbytes = WQSketch::SummaryContainer::CalcMemCost(intermediate_num_cuts);
     if (IsCat(feature_types_, fidx)) {
       return;
     }
 
+    // Merge the per-worker summaries with a pairwise tree instead of a sequential fold.
+    // Combining is exact, so intermediate levels are not pruned; a single prune at the
+    // end both bounds the output size and avoids accumulating pruning error once per
+    // worker.  Two ping-pong buffers sized for the whole level are reused across levels
+    // instead of allocating fresh scratch for every merge.
+    std::vector<typename WQSketch::Summary> level;
+    std::size_t total = 0;
     for (int32_t r = 0; r < world; ++r) {
       // 1 feature of 1 worker
       auto worker_feature = allreduce_result.Values(r, fidx);
       CHECK(worker_feature.data());
-      typename WQSketch::Summary summary(worker_feature.data(), worker_feature.size());
-      auto &out = final_sketches.at(fidx);
-      out.Reduce(summary, nbytes);
+      level.emplace_back(worker_feature.data(), worker_feature.size());
+      total += worker_feature.size();
+    }
+
+    typename WQSketch::SummaryContainer front, back;
+    front.Reserve(total);
+    back.Reserve(total);
+    auto *p_dst = &front;
+    std::vector<typename WQSketch::Summary> next;
+    while (level.size() > 1) {
+      next.clear();
+      std::size_t offset = 0;
+      for (std::size_t i = 0; i + 1 < level.size(); i += 2) {
+        // The combined size never exceeds the sum of the inputs, so packing the outputs
+        // consecutively stays within the reserved buffer.
+        typename WQSketch::Summary out{p_dst->space.data() + offset,
+                                       level[i].size + level[i + 1].size};
+        out.SetCombine(level[i], level[i + 1]);
+        offset += out.size;
+        next.push_back(out);
+      }
+      if (level.size() % 2 == 1) {
+        // Carry the odd one out into the current buffer, its storage is recycled in the
+        // next round.
+        auto const &rest = level.back();
+        typename WQSketch::Summary out{p_dst->space.data() + offset, rest.size};
+        out.CopyFrom(rest);
+        next.push_back(out);
+      }
+      level.swap(next);
+      p_dst = (p_dst == &front) ? &back : &front;
     }
 
     reduced.at(fidx).Reserve(intermediate_num_cuts);
-    reduced.at(fidx).SetPrune(final_sketches.at(fidx), intermediate_num_cuts);
+    reduced.at(fidx).SetPrune(level.front(), intermediate_num_cuts);
   });
   monitor_.Stop(__func__);
 }
@@ -383,6 +501,21 @@ void AddCutPoint(typename SketchType::SummaryContainer const &summary, int max_b
   }
 }
 
+// Identity cuts for a pre-binned feature: value v falls into bin floor(v), so the cut
+// values are 1, 2, ..., max + 1 and no sketch is involved.
+void AddPreBinned(float max_value, HistogramCuts *cuts) {
+  // An empty column (or one not present on this worker) has no observed value.
+  max_value = std::max(max_value, 0.0f);
+  if (std::floor(max_value) != max_value || InvalidCat(max_value)) {
+    LOG(FATAL) << "Pre-binned features must hold non-negative integers less than "
+               << OutOfRangeCat();
+  }
+  auto &cut_values = cuts->cut_values_.HostVector();
+  for (float v = 1.0f; v <= max_value + 1.0f; ++v) {
+    cut_values.push_back(v);
+  }
+}
+
 auto AddCategories(std::set<float> const &categories, HistogramCuts *cuts) {
   if (std::any_of(categories.cbegin(), categories.cend(), InvalidCat)) {
     InvalidCategory();
@@ -409,8 +542,18 @@ void SketchContainerImpl<WQSketch>::MakeCuts(Context const *ctx, MetaInfo const
   p_cuts->min_vals_.HostVector().resize(sketches_.size(), 0.0f);
   std::vector<typename WQSketch::SummaryContainer> final_summaries(reduced.size());
 
+  // Synchronize the observed maximum of pre-binned features so all workers produce the
+  // same identity cuts.  Not needed under column split where features are disjoint.
+  if (collective::GetWorldSize() > 1 && !info.IsColumnSplit() &&
+      std::any_of(feature_types_.cbegin(), feature_types_.cend(),
+                  [](FeatureType t) { return t == FeatureType::kPreBinned; })) {
+    auto rc = collective::Allreduce(
+        ctx, linalg::MakeVec(prebinned_max_.data(), prebinned_max_.size()), collective::Op::kMax);
+    collective::SafeColl(rc);
+  }
+
   ParallelFor(reduced.size(), n_threads_, Sched::Guided(), [&](size_t fidx) {
-    if (IsCat(feature_types_, fidx)) {
+    if (IsCat(feature_types_, fidx) || IsPreBinned(feature_types_, fidx)) {
       return;
     }
     typename WQSketch::SummaryContainer &a = final_summaries[fidx];
@@ -435,6 +578,8 @@ void SketchContainerImpl<WQSketch>::MakeCuts(Context const *ctx, MetaInfo const
     typename WQSketch::SummaryContainer const &a = final_summaries[fid];
     if (IsCat(feature_types_, fid)) {
       max_cat = std::max(max_cat, AddCategories(categories_.at(fid), p_cuts));
+    } else if (IsPreBinned(feature_types_, fid)) {
+      AddPreBinned(prebinned_max_.at(fid), p_cuts);
     } else {
       AddCutPoint<WQSketch>(a, max_num_bins, p_cuts);
       // push a value that is greater than anything
@@ -461,15 +606,20 @@ template class SketchContainerImpl<WXQuantileSketch<float, float>>;
 
 HostSketchContainer::HostSketchContainer(Context const *ctx, bst_bin_t max_bins,
                                          common::Span<FeatureType const> ft,
-                                         std::vector<bst_idx_t> columns_size, bool use_group)
+                                         std::vector<bst_idx_t> columns_size, bool use_group,
+                                         std::size_t max_sketch_entries)
     : SketchContainerImpl{ctx, columns_size, max_bins, ft, use_group} {
   monitor_.Init(__func__);
   ParallelFor(sketches_.size(), n_threads_, Sched::Auto(), [&](auto i) {
     auto n_bins = std::min(static_cast<bst_idx_t>(max_bins_), columns_size_[i]);
     n_bins = std::max(n_bins, static_cast<decltype(n_bins)>(1));
     auto eps = 1.0 / (static_cast<float>(n_bins) * WQSketch::kFactor);
-    if (!IsCat(this->feature_types_, i)) {
-      sketches_[i].Init(columns_size_[i], eps);
+    if (!IsCat(this->feature_types_, i) && !IsPreBinned(this->feature_types_, i)) {
+      if (max_sketch_entries != 0) {
+        sketches_[i].InitBounded(columns_size_[i], eps, max_sketch_entries);
+      } else {
+        sketches_[i].Init(columns_size_[i], eps);
+      }
       sketches_[i].inqueue.queue.resize(sketches_[i].limit_size * 2);
     }
   });
@@ -501,13 +651,17 @@ void SortedSketchContainer::PushColPage(SparsePage const &page, MetaInfo const &
       for (auto c : column) {
         categories_[fidx].emplace(c.fvalue);
       }
+    } else if (IsPreBinned(feature_types_, fidx)) {
+      for (auto c : column) {
+        prebinned_max_[fidx] = std::max(prebinned_max_[fidx], c.fvalue);
+      }
     } else {
       for (auto c : column) {
         sketch.Push(c.fvalue, weights[c.index], max_bins_);
       }
     }
 
-    if (!IsCat(feature_types_, fidx) && !column.empty()) {
+    if (!IsCat(feature_types_, fidx) && !IsPreBinned(feature_types_, fidx) && !column.empty()) {
       sketch.Finalize(max_bins_);
     }
   });
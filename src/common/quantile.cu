@@ -12,6 +12,7 @@
 #include <numeric>      // for partial_sum
 #include <type_traits>  // for is_same_v
 #include <utility>
+#include <vector>       // for vector
 
 #include "../collective/allgather.h"
 #include "../collective/allreduce.h"
@@ -506,6 +507,23 @@ void SketchContainer::FixError() {
   });
 }
 
+HostSketchSummary::HostSketchSummary(Context const* ctx, SketchContainer const& that) {
+  curt::SetDevice(ctx->Ordinal());
+  dh::CopyTo(that.Data(), &entries_, ctx->CUDACtx()->Stream());
+  dh::CopyTo(that.ColumnsPtr(), &columns_ptr_, ctx->CUDACtx()->Stream());
+  // The source buffers may be released right after the spill.
+  ctx->CUDACtx()->Stream().Sync();
+}
+
+void HostSketchSummary::MergeInto(Context const* ctx, SketchContainer* p_out) const {
+  curt::SetDevice(ctx->Ordinal());
+  dh::device_vector<SketchEntry> entries;
+  dh::device_vector<SketchContainer::OffsetT> columns_ptr;
+  dh::CopyTo(entries_, &entries, ctx->CUDACtx()->Stream());
+  dh::CopyTo(columns_ptr_, &columns_ptr, ctx->CUDACtx()->Stream());
+  p_out->Merge(ctx, dh::ToSpan(columns_ptr), dh::ToSpan(entries));
+}
+
 void SketchContainer::AllReduce(Context const* ctx, bool is_column_split) {
   curt::SetDevice(ctx->Ordinal());
   auto world = collective::GetWorldSize();
@@ -514,20 +532,23 @@ void SketchContainer::AllReduce(Context const* ctx, bool is_column_split) {
   }
 
   timer_.Start(__func__);
-  // Reduce the overhead on syncing.
-  bst_idx_t global_sum_rows = num_rows_;
-  auto rc = collective::Allreduce(ctx, linalg::MakeVec(&global_sum_rows, 1), collective::Op::kSum);
+  // Reduce the overhead on syncing, the row count reduction and the column count check
+  // share one allreduce.
+  bst_idx_t sums[2]{num_rows_, static_cast<bst_idx_t>(num_columns_) + 1};
+  auto rc = collective::Allreduce(ctx, linalg::MakeVec(sums, 2), collective::Op::kSum);
   SafeColl(rc);
+  bst_idx_t global_sum_rows = sums[0];
+  // Each worker compares the sum against its own column count, a mismatch trips the
+  // check on at least one of them.
+  CHECK_EQ(sums[1], (static_cast<bst_idx_t>(num_columns_) + 1) * world)
+      << "Number of columns differs across workers";
+
   bst_idx_t intermediate_num_cuts =
       std::min(global_sum_rows, static_cast<size_t>(num_bins_ * kFactor));
   this->Prune(ctx, intermediate_num_cuts);
 
   auto d_columns_ptr = this->columns_ptr_.ConstDeviceSpan();
   CHECK_EQ(d_columns_ptr.size(), num_columns_ + 1);
-  size_t n = d_columns_ptr.size();
-  rc = collective::Allreduce(ctx, linalg::MakeVec(&n, 1), collective::Op::kMax);
-  SafeColl(rc);
-  CHECK_EQ(n, d_columns_ptr.size()) << "Number of columns differs across workers";
 
   // Get the columns ptr from all workers
   dh::device_vector<SketchContainer::OffsetT> gathered_ptrs;
@@ -566,18 +587,36 @@ void SketchContainer::AllReduce(Context const* ctx, bool is_column_split) {
     offset += length_as_bytes;
   }
 
-  // Merge them into a new sketch.
-  SketchContainer new_sketch(this->feature_types_, num_bins_, this->num_columns_, global_sum_rows,
-                             ctx->Device());
+  // Merge them into a new sketch.  Reduce pairwise so that each entry is passed over
+  // O(log world) times, appending every worker to one growing sketch passes over the
+  // accumulated entries once per worker.
+  std::vector<SketchContainer> stage;
+  stage.reserve(allworkers.size());
   for (size_t i = 0; i < allworkers.size(); ++i) {
     auto worker = allworkers[i];
     auto worker_ptr =
         dh::ToSpan(gathered_ptrs).subspan(i * d_columns_ptr.size(), d_columns_ptr.size());
-    new_sketch.Merge(ctx, worker_ptr, worker);
-    new_sketch.FixError();
+    SketchContainer container(this->feature_types_, num_bins_, this->num_columns_, global_sum_rows,
+                              ctx->Device());
+    container.Merge(ctx, worker_ptr, worker);
+    container.FixError();
+    stage.emplace_back(std::move(container));
+  }
+  while (stage.size() > 1) {
+    std::vector<SketchContainer> next;
+    next.reserve((stage.size() + 1) / 2);
+    for (std::size_t i = 0; i + 1 < stage.size(); i += 2) {
+      stage[i].Merge(ctx, stage[i + 1].ColumnsPtr(), stage[i + 1].Data());
+      stage[i].FixError();
+      next.emplace_back(std::move(stage[i]));
+    }
+    if (stage.size() % 2 == 1) {
+      next.emplace_back(std::move(stage.back()));
+    }
+    stage = std::move(next);
   }
 
-  *this = std::move(new_sketch);
+  *this = std::move(stage.front());
   timer_.Stop(__func__);
 }
 
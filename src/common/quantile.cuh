@@ -6,9 +6,12 @@
 
 #include <thrust/logical.h>  // for any_of
 
+#include <vector>  // for vector
+
 #include "categorical.h"
-#include "cuda_context.cuh"  // for CUDAContext
-#include "cuda_rt_utils.h"   // for SetDevice
+#include "cuda_context.cuh"          // for CUDAContext
+#include "cuda_pinned_allocator.h"   // for PinnedAllocator
+#include "cuda_rt_utils.h"           // for SetDevice
 #include "device_helpers.cuh"
 #include "error_msg.h"  // for InvalidMaxBin
 #include "quantile.h"
@@ -228,6 +231,43 @@ class SketchContainer {
     return n_uniques;
   }
 };
+
+/**
+ * @brief A pruned sketch summary spilled to pinned host memory.
+ *
+ *   The external-memory sketching path accumulates one `SketchContainer` per
+ *   sub-stream level.  Once a level is pruned it no longer receives input, but
+ *   keeping it on the device holds memory hostage until the final merge, and the
+ *   merge itself peaks at roughly thrice the final size.  This container stages a
+ *   frozen summary on the host so that only the active sketch stays device
+ *   resident; summaries are streamed back one at a time for the final merge.
+ */
+class HostSketchSummary {
+  template <typename T>
+  using PinnedVector = std::vector<T, cuda_impl::PinnedAllocator<T>>;
+
+  PinnedVector<SketchEntry> entries_;
+  PinnedVector<SketchContainer::OffsetT> columns_ptr_;
+
+ public:
+  /**
+   * @brief Spill a pruned sketch to the host.  Blocks until the copy finishes so the
+   *        caller is free to release the device buffers of `that`.
+   */
+  HostSketchSummary(Context const* ctx, SketchContainer const& that);
+  /**
+   * @brief Stream the summary back to the device and merge it into `p_out`.  The
+   *        device staging buffer lives only for the duration of the call.
+   */
+  void MergeInto(Context const* ctx, SketchContainer* p_out) const;
+  /**
+   * @brief Host memory used by this summary.
+   */
+  [[nodiscard]] std::size_t MemCostBytes() const {
+    return entries_.size() * sizeof(SketchEntry) +
+           columns_ptr_.size() * sizeof(SketchContainer::OffsetT);
+  }
+};
 }  // namespace xgboost::common
 
 #endif  // XGBOOST_COMMON_QUANTILE_CUH_
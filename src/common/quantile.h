@@ -534,6 +534,7 @@ class QuantileSketchTemplate {
    */
   inline void Init(size_t maxn, double eps) {
     LimitSizeLevel(maxn, eps, &nlevel, &limit_size);
+    bounded_ = false;
     // lazy reserve the space, if there is only one value, no need to allocate space
     inqueue.queue.resize(1);
     inqueue.qtail = 0;
@@ -541,6 +542,31 @@ class QuantileSketchTemplate {
     level.clear();
   }
 
+  /*!
+   * \brief initialize the sketch with a strict bound on the number of summary entries
+   * \param maxn maximum number of data points can be feed into sketch
+   * \param eps accuracy level of summary
+   * \param max_entries budget for the total number of summary entries
+   *
+   *  The standard initialization sizes the merge structure for the requested accuracy,
+   *  which grows with log(maxn)^2 / eps entries and is used whenever it fits the budget.
+   *  Otherwise the structure is sized to the budget and growth past the top level is
+   *  replaced by pruning in place, so the memory stays constant while the guaranteed
+   *  error degrades gradually: every collapse doubles the number of elements the top
+   *  level summarizes.
+   */
+  inline void InitBounded(size_t maxn, double eps, size_t max_entries) {
+    this->Init(maxn, eps);
+    // + 2 accounts for the input queue, which holds limit_size * 2 entries.
+    if ((nlevel + 2) * limit_size <= max_entries) {
+      return;
+    }
+    bounded_ = true;
+    nlevel = kBoundedLevels;
+    limit_size = max_entries / (nlevel + 2);
+    CHECK_GE(limit_size, 2) << "invalid sketch memory bound";
+  }
+
   inline static void LimitSizeLevel
     (size_t maxn, double eps, size_t* out_nlevel, size_t* out_limit_size) {
     size_t& nlevel = *out_nlevel;
@@ -602,6 +628,12 @@ class QuantileSketchTemplate {
         level[0].SetPrune(temp, limit_size);
         temp.SetCombine(level[0], level[l]);
         if (temp.size > limit_size) {
+          if (bounded_ && l + 1 >= nlevel) {
+            // Strict memory bound reached, prune the merged summary back into the top
+            // level instead of opening a new one.
+            level[l].SetPrune(temp, limit_size);
+            break;
+          }
           // try next level
           level[l].size = 0;
         } else {
@@ -654,12 +686,16 @@ class QuantileSketchTemplate {
       level[l].data = dmlc::BeginPtr(data) + l * limit_size;
     }
   }
+  // number of levels used by the memory bounded mode
+  constexpr static size_t kBoundedLevels = 8;
   // input data queue
   typename Summary::Queue inqueue;
   // number of levels
   size_t nlevel;
   // size of summary in each level
   size_t limit_size;
+  // whether the merge structure is capped at nlevel levels
+  bool bounded_{false};
   // the level of each summaries
   std::vector<Summary> level;
   // content of the summary
@@ -789,6 +825,9 @@ class SketchContainerImpl {
  protected:
   std::vector<WQSketch> sketches_;
   std::vector<std::set<float>> categories_;
+  // Maximum observed value of each pre-binned feature, -1 when no value was seen.  Each
+  // column is owned by a single thread during the push, so plain updates suffice.
+  std::vector<float> prebinned_max_;
   std::vector<FeatureType> const feature_types_;
 
   std::vector<bst_idx_t> columns_size_;
@@ -826,6 +865,12 @@ class SketchContainerImpl {
         group_ptr.cbegin() - 1;
     return group_ind;
   }
+  // Merge pruned summaries with a butterfly exchange, used when the world size is a
+  // power of two.  Each round exchanges at most `num_cuts` entries per feature, so the
+  // traffic is bounded by the number of intermediate cuts instead of the raw data size.
+  void ButterflyMerge(Context const *ctx,
+                      std::vector<typename WQSketch::SummaryContainer> *p_reduced,
+                      std::vector<int32_t> const &num_cuts);
   // Gather sketches from all workers.
   void GatherSketchInfo(Context const *ctx, MetaInfo const &info,
                         std::vector<typename WQSketch::SummaryContainer> const &reduced,
@@ -861,6 +906,8 @@ class SketchContainerImpl {
                 if (is_valid(elem)) {
                   if (IsCat(feature_types_, ii)) {
                     categories_[ii].emplace(elem.value);
+                  } else if (IsPreBinned(feature_types_, ii)) {
+                    prebinned_max_[ii] = std::max(prebinned_max_[ii], elem.value);
                   } else {
                     sketches_[ii].Push(elem.value, w);
                   }
@@ -872,6 +919,9 @@ class SketchContainerImpl {
                 if (is_valid(elem) && elem.column_idx >= begin && elem.column_idx < end) {
                   if (IsCat(feature_types_, elem.column_idx)) {
                     categories_[elem.column_idx].emplace(elem.value);
+                  } else if (IsPreBinned(feature_types_, elem.column_idx)) {
+                    prebinned_max_[elem.column_idx] =
+                        std::max(prebinned_max_[elem.column_idx], elem.value);
                   } else {
                     sketches_[elem.column_idx].Push(elem.value, w);
                   }
@@ -900,8 +950,13 @@ class HostSketchContainer : public SketchContainerImpl<WQuantileSketch<float, fl
   using WQSketch = WQuantileSketch<float, float>;
 
  public:
+  /*
+   * \param max_sketch_entries When non-zero, bound the summary memory of each sketch to
+   *                           this many entries, see WQSketch::InitBounded.
+   */
   HostSketchContainer(Context const *ctx, bst_bin_t max_bins, common::Span<FeatureType const> ft,
-                      std::vector<bst_idx_t> columns_size, bool use_group);
+                      std::vector<bst_idx_t> columns_size, bool use_group,
+                      std::size_t max_sketch_entries = 0);
 
   template <typename Batch>
   void PushAdapterBatch(Batch const &batch, size_t base_rowid, MetaInfo const &info, float missing);
@@ -34,8 +34,15 @@ std::istream& operator>>(std::istream& is, ParamFloatArray& t);
 
 struct QuantileLossParam : public XGBoostParameter<QuantileLossParam> {
   ParamFloatArray quantile_alpha;
+  bool quantile_approx_leaf{false};
   DMLC_DECLARE_PARAMETER(QuantileLossParam) {
     DMLC_DECLARE_FIELD(quantile_alpha).describe("List of quantiles for quantile loss.");
+    DMLC_DECLARE_FIELD(quantile_approx_leaf)
+        .set_default(false)
+        .describe(
+            "Estimate the per-leaf quantile with a single-pass streaming algorithm (P^2) "
+            "instead of an exact sort.  Uses constant memory per leaf.  Only effective "
+            "for unweighted data on the CPU.");
   }
   void Validate() const {
     CHECK(GetInitialised());
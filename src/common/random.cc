@@ -3,8 +3,10 @@
  */
 #include "random.h"
 
-#include <algorithm>  // for sort, max, copy
+#include <algorithm>  // for sort, max, copy, nth_element, set_intersection
+#include <iterator>   // for back_inserter
 #include <memory>     // for shared_ptr
+#include <vector>     // for vector
 
 #include "xgboost/host_device_vector.h"  // for HostDeviceVector
 
@@ -54,4 +56,50 @@ std::shared_ptr<HostDeviceVector<bst_feature_t>> ColumnSampler::ColSample(
   std::sort(new_features.HostVector().begin(), new_features.HostVector().end());
   return p_new_features;
 }
+
+std::shared_ptr<HostDeviceVector<bst_feature_t>> ColumnSampler::TopKFilter(
+    std::shared_ptr<HostDeviceVector<bst_feature_t>> p_features, int depth) {
+  if (top_k_ == 0 || depth < TopKMinDepth()) {
+    return p_features;
+  }
+  if (sweep_interval_ > 0 && (n_trees_ % sweep_interval_) == 0) {
+    // Periodic exact sweep, let dormant features re-enter the ranking.
+    return p_features;
+  }
+
+  if (!top_k_ready_) {
+    top_k_ready_ = true;
+    std::vector<bst_feature_t> ranked;
+    for (std::size_t fidx = 0; fidx < feature_gains_.size(); ++fidx) {
+      if (feature_gains_[fidx] > 0.0) {
+        ranked.push_back(static_cast<bst_feature_t>(fidx));
+      }
+    }
+    if (ranked.size() > top_k_) {
+      std::nth_element(ranked.begin(), ranked.begin() + top_k_, ranked.end(),
+                       [&](bst_feature_t l, bst_feature_t r) {
+                         return feature_gains_[l] > feature_gains_[r];
+                       });
+      ranked.resize(top_k_);
+    }
+    std::sort(ranked.begin(), ranked.end());
+    top_k_set_ = std::move(ranked);
+  }
+  if (top_k_set_.size() < top_k_) {
+    // Not enough gain history yet, stay exact.
+    return p_features;
+  }
+
+  auto const& features = p_features->ConstHostVector();
+  auto p_filtered = std::make_shared<HostDeviceVector<bst_feature_t>>();
+  auto& filtered = p_filtered->HostVector();
+  std::set_intersection(features.cbegin(), features.cend(), top_k_set_.cbegin(),
+                        top_k_set_.cend(), std::back_inserter(filtered));
+  if (filtered.empty()) {
+    // Column sampling can be disjoint with the top-k set, fall back to the exact set.
+    return p_features;
+  }
+  p_filtered->SetDevice(p_features->Device());
+  return p_filtered;
+}
 }  // namespace xgboost::common
@@ -114,6 +114,59 @@ std::vector<T> WeightedSamplingWithoutReplacement(Context const* ctx, std::vecto
   return results;
 }
 
+/**
+ * @brief Stateless predicate for per-node column sampling.
+ *
+ * Hashing (feature, node) against a per-tree seed replaces the per-node `ColSample`
+ * shuffle: no index vector is materialized and no engine state is consumed, so the
+ * predicate can be evaluated inline from any thread of the split evaluator.  Each
+ * feature is kept independently with probability `colsample_bynode`; one position of the
+ * sampled-from set is always kept so that no node ends up without candidates.
+ */
+class FeatureSamplePredicate {
+  std::uint64_t seed_{0};
+  std::uint64_t threshold_{0};
+
+  // splitmix64 finalizer, mixes the combined key into uniform bits.
+  static std::uint64_t Mix(std::uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+  }
+
+ public:
+  FeatureSamplePredicate() = default;
+  FeatureSamplePredicate(std::uint64_t seed, float colsample)
+      : seed_{seed},
+        threshold_{static_cast<std::uint64_t>(
+            static_cast<double>(colsample) *
+            static_cast<double>(std::numeric_limits<std::uint64_t>::max()))} {}
+
+  /** @brief Whether per-node sampling is delegated to this predicate. */
+  explicit operator bool() const { return threshold_ != 0; }
+
+  /**
+   * @brief Whether @p fidx participates in the evaluation of node @p nidx.
+   *
+   * @param fidx       The feature index.
+   * @param pos_in_set Position of the feature in the sampled-from set.
+   * @param n_in_set   Size of the sampled-from set.
+   * @param nidx       The node index.
+   */
+  [[nodiscard]] bool operator()(bst_feature_t fidx, std::size_t pos_in_set,
+                                std::size_t n_in_set, bst_node_t nidx) const {
+    auto node_key = Mix(seed_ ^ static_cast<std::uint32_t>(nidx));
+    if (pos_in_set == node_key % n_in_set) {
+      // Every node keeps at least one feature.
+      return true;
+    }
+    return Mix(node_key ^ fidx) < threshold_;
+  }
+};
+
 namespace cuda_impl {
 void SampleFeature(Context const* ctx, bst_feature_t n_features,
                    std::shared_ptr<HostDeviceVector<bst_feature_t>> p_features,
@@ -147,6 +200,19 @@ class ColumnSampler {
   HostDeviceVector<bst_feature_t> idx_buffer_;
   HostDeviceVector<float> weight_buffer_;
 
+  // State for the approximate top-k feature pre-filter.  Accumulated split gain per
+  // feature, the gain-ranked feature subset for the current tree, and a tree counter for
+  // the periodic full sweeps.
+  std::vector<double> feature_gains_;
+  std::vector<bst_feature_t> top_k_set_;
+  bool top_k_ready_{false};
+  bst_feature_t top_k_{0};
+  std::int32_t sweep_interval_{0};
+  std::int32_t n_trees_{0};
+
+  // Per-tree seed for the hash-based per-node sampling predicate.
+  std::uint64_t predicate_seed_{0};
+
  public:
   std::shared_ptr<HostDeviceVector<bst_feature_t>> ColSample(
       std::shared_ptr<HostDeviceVector<bst_feature_t>> p_features, float colsample);
@@ -193,6 +259,17 @@ class ColumnSampler {
     }
 
     feature_set_tree_ = ColSample(feature_set_tree_, colsample_bytree_);
+
+    if (colsample_bynode_ != 1.0f) {
+      // Drawn whether or not the predicate ends up being used, so the engine state stays
+      // in lockstep across processes and code paths.
+      predicate_seed_ = static_cast<std::uint64_t>(rng_()) << 32 | rng_();
+    }
+
+    // One Init per tree build; re-rank the top-k subset from the gains seen so far.
+    ++n_trees_;
+    top_k_set_.clear();
+    top_k_ready_ = false;
   }
 
   /**
@@ -203,6 +280,47 @@ class ColumnSampler {
     feature_set_level_.clear();
   }
 
+  /**
+   * @brief Depth from which the gain-ranked pre-filter applies.  Shallower nodes are
+   *        always evaluated exactly; that is also where most gain history is seeded.
+   */
+  constexpr static std::int32_t TopKMinDepth() { return 4; }
+
+  /**
+   * @brief Enable the approximate top-k feature pre-filter.
+   *
+   *   When enabled, @ref GetFeatureSet restricts deep nodes to the @p top_k features
+   *   with the highest accumulated split gain, recorded via @ref RecordSplitGain.  Every
+   *   @p sweep_interval -th tree evaluates the full feature set so that dormant features
+   *   can re-enter the ranking.  This trades exactness for evaluation time and is
+   *   disabled under distributed training, where all workers must see identical feature
+   *   sets.
+   *
+   * @param top_k          Number of features to keep at deep nodes, 0 disables.
+   * @param sweep_interval Period (in trees) of the exact full sweeps, 0 disables them.
+   */
+  void ConfigureTopK(bst_feature_t top_k, std::int32_t sweep_interval) {
+    if (top_k != 0 && collective::IsDistributed()) {
+      LOG(WARNING) << "Top-k feature filtering is not supported for distributed training.";
+      top_k = 0;
+    }
+    top_k_ = top_k;
+    sweep_interval_ = sweep_interval;
+  }
+
+  /**
+   * @brief Record the gain of an applied split for the top-k pre-filter.
+   */
+  void RecordSplitGain(bst_feature_t fidx, double gain) {
+    if (top_k_ == 0) {
+      return;
+    }
+    if (feature_gains_.size() <= fidx) {
+      feature_gains_.resize(fidx + 1, 0.0);
+    }
+    feature_gains_[fidx] += gain;
+  }
+
   /**
    * \brief Samples a feature set.
    *
@@ -216,7 +334,7 @@ class ColumnSampler {
    */
   std::shared_ptr<HostDeviceVector<bst_feature_t>> GetFeatureSet(int depth) {
     if (colsample_bylevel_ == 1.0f && colsample_bynode_ == 1.0f) {
-      return feature_set_tree_;
+      return this->TopKFilter(feature_set_tree_, depth);
     }
 
     if (feature_set_level_.count(depth) == 0) {
@@ -225,11 +343,49 @@ class ColumnSampler {
     }
     if (colsample_bynode_ == 1.0f) {
       // Level sampling
-      return feature_set_level_[depth];
+      return this->TopKFilter(feature_set_level_[depth], depth);
     }
     // Need to sample for the node individually
-    return ColSample(feature_set_level_[depth], colsample_bynode_);
+    return this->TopKFilter(ColSample(feature_set_level_[depth], colsample_bynode_), depth);
   }
+
+  /**
+   * @brief Hash-based predicate replacing the per-node `ColSample`.
+   *
+   *   Invalid (and per-node sampling falls back to @ref GetFeatureSet) when a
+   *   materialized per-node set is required: weighted sampling, or sampling on device.
+   *   A consumer evaluating the predicate inline must obtain the feature sets through
+   *   @ref GetFeatureSetByPredicate so the per-node shuffle is not performed as well.
+   */
+  [[nodiscard]] FeatureSamplePredicate NodePredicate() const {
+    if (colsample_bynode_ == 1.0f || !feature_weights_.Empty() || ctx_->IsCUDA()) {
+      return {};
+    }
+    return {predicate_seed_, colsample_bynode_};
+  }
+
+  /**
+   * @brief The feature set for a node whose bynode sampling is handled by the predicate
+   *        from @ref NodePredicate: bytree/bylevel sampling still applies, the per-node
+   *        shuffle is skipped.
+   */
+  std::shared_ptr<HostDeviceVector<bst_feature_t>> GetFeatureSetByPredicate(int depth) {
+    if (colsample_bylevel_ == 1.0f) {
+      return this->TopKFilter(feature_set_tree_, depth);
+    }
+    if (feature_set_level_.count(depth) == 0) {
+      feature_set_level_[depth] = ColSample(feature_set_tree_, colsample_bylevel_);
+    }
+    return this->TopKFilter(feature_set_level_[depth], depth);
+  }
+
+ private:
+  /**
+   * @brief Restrict a sampled feature set to the gain-ranked top-k, if the filter is
+   *        active for the given depth.  Returns the input set unchanged otherwise.
+   */
+  std::shared_ptr<HostDeviceVector<bst_feature_t>> TopKFilter(
+      std::shared_ptr<HostDeviceVector<bst_feature_t>> p_features, int depth);
 };
 
 inline auto MakeColumnSampler(Context const* ctx) {
@@ -41,6 +41,8 @@ void RankingCache::InitOnCPU(Context const* ctx, MetaInfo const& info) {
     sum_weights += weight[k];
   }
   weight_norm_ = static_cast<double>(n_groups) / sum_weights;
+
+  y_sorted_idx_threads_.resize(ctx->Threads());
 }
 
 common::Span<std::size_t const> RankingCache::MakeRankOnCPU(Context const* ctx,
@@ -49,15 +51,42 @@ common::Span<std::size_t const> RankingCache::MakeRankOnCPU(Context const* ctx,
   auto rank = this->sorted_idx_cache_.HostSpan();
   CHECK_EQ(rank.size(), predt.size());
 
+  bool const warm = sorted_idx_warm_;
   common::ParallelFor(this->Groups(), ctx->Threads(), [&](auto g) {
     auto cnt = gptr[g + 1] - gptr[g];
     auto g_predt = predt.subspan(gptr[g], cnt);
     auto g_rank = rank.subspan(gptr[g], cnt);
-    auto sorted_idx = common::ArgSort<std::size_t>(
-        ctx, g_predt.data(), g_predt.data() + g_predt.size(), std::greater<>{});
-    CHECK_EQ(g_rank.size(), sorted_idx.size());
-    std::copy_n(sorted_idx.data(), sorted_idx.size(), g_rank.data());
+    if (!warm) {
+      auto sorted_idx = common::ArgSort<std::size_t>(
+          ctx, g_predt.data(), g_predt.data() + g_predt.size(), std::greater<>{});
+      CHECK_EQ(g_rank.size(), sorted_idx.size());
+      std::copy_n(sorted_idx.data(), sorted_idx.size(), g_rank.data());
+      return;
+    }
+    // Repair the order from the previous iteration instead of re-sorting.  A boosting
+    // step only perturbs the scores, leaving the list nearly sorted, so a stable
+    // insertion repair runs in O(n + inversions).  If the list turns out to be heavily
+    // shuffled, fall back to a full sort to avoid the quadratic worst case.
+    std::size_t budget = cnt * 16;
+    for (std::size_t i = 1; i < cnt; ++i) {
+      auto idx = g_rank[i];
+      auto v = g_predt[idx];
+      std::size_t j = i;
+      while (j > 0 && g_predt[g_rank[j - 1]] < v) {
+        g_rank[j] = g_rank[j - 1];
+        --j;
+      }
+      g_rank[j] = idx;
+      auto moved = i - j;
+      if (moved >= budget) {
+        std::stable_sort(g_rank.data(), g_rank.data() + cnt,
+                         [&](auto l, auto r) { return g_predt[l] > g_predt[r]; });
+        break;
+      }
+      budget -= moved;
+    }
   });
+  sorted_idx_warm_ = true;
 
   return rank;
 }
@@ -11,6 +11,7 @@
 #include <string>                        // for char_traits, string
 #include <vector>                        // for vector
 
+#include "dmlc/omp.h"                    // for omp_get_thread_num
 #include "dmlc/parameter.h"              // for FieldEntry, DMLC_DECLARE_FIELD
 #include "error_msg.h"                   // for GroupWeight, GroupSize, InvalidCUDAOrdinal
 #include "xgboost/base.h"                // for XGBOOST_DEVICE, bst_group_t
@@ -162,6 +163,12 @@ class RankingCache {
   HostDeviceVector<bst_group_t> group_ptr_;
   // store the sorted index of prediction.
   HostDeviceVector<std::size_t> sorted_idx_cache_;
+  // Whether sorted_idx_cache_ holds the order from a previous iteration, which can be
+  // repaired incrementally instead of re-sorted (CPU only).
+  bool sorted_idx_warm_{false};
+  // Per-thread scratch for sorting labels when the objective constructs pairs (CPU
+  // only).  The buffers themselves grow on demand.
+  std::vector<std::vector<std::size_t>> y_sorted_idx_threads_;
   // Maximum size of group
   std::size_t max_group_size_{0};
   // Normalization for weight
@@ -242,6 +249,13 @@ class RankingCache {
       return this->MakeRankOnCPU(ctx, predt);
     }
   }
+  // Scratch buffer owned by the calling thread, used by the objective for creating
+  // pairs.  Keeps the allocation out of the parallel loop over query groups.
+  std::vector<std::size_t>& MakePairsBuffer(Context const* ctx) {
+    CHECK(ctx->IsCPU());
+    CHECK(!y_sorted_idx_threads_.empty());
+    return y_sorted_idx_threads_[omp_get_thread_num()];
+  }
   // The function simply returns a uninitialized buffer as this is only used by the
   // objective for creating pairs.
   common::Span<std::size_t> SortedIdxY(Context const* ctx, std::size_t n_samples) {
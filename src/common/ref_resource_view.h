@@ -11,7 +11,9 @@
 #include <type_traits>  // for is_reference_v, remove_reference_t, is_same_v
 #include <utility>      // for swap, move
 
-#include "io.h"  // for ResourceHandler, AlignedResourceReadStream, MallocResource
+#include "common.h"           // for DivRoundUp
+#include "io.h"               // for ResourceHandler, AlignedResourceReadStream, MallocResource
+#include "threading_utils.h"  // for ParallelFor
 #include "xgboost/logging.h"
 #include "xgboost/span.h"  // for Span
 
@@ -156,6 +158,32 @@ template <typename T>
   return ref;
 }
 
+/**
+ * @brief Make a fixed size `RefResourceView` with malloc resource, initialized in
+ *        parallel.
+ *
+ *    With a first-touch NUMA policy, the thread that writes a page first determines its
+ *    placement. Splitting the initial fill into contiguous per-thread ranges distributes
+ *    the storage across the nodes the worker threads run on instead of concentrating it
+ *    on the node of the allocating thread.
+ */
+template <typename T>
+[[nodiscard]] RefResourceView<T> MakeFixedVecWithMalloc(std::size_t n_elements, T const& init,
+                                                        std::int32_t n_threads) {
+  auto resource = std::make_shared<common::MallocResource>(n_elements * sizeof(T));
+  auto ref = RefResourceView{resource->DataAs<T>(), n_elements, resource};
+  auto n_workers = static_cast<std::size_t>(std::max(n_threads, 1));
+  std::size_t const chunk_size = DivRoundUp(n_elements, n_workers);
+  ParallelFor(n_workers, static_cast<std::int32_t>(n_workers), [&](std::size_t tid) {
+    std::size_t begin = tid * chunk_size;
+    std::size_t end = std::min(begin + chunk_size, n_elements);
+    if (begin < end) {
+      std::fill(ref.data() + begin, ref.data() + end, init);
+    }
+  });
+  return ref;
+}
+
 template <typename T>
 class ReallocVector : public RefResourceView<T> {
   static_assert(!std::is_reference_v<T>);
@@ -0,0 +1,126 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ * \file scratch_pool.h
+ * \brief Pool of reusable buffers for short-lived scratch memory in hot paths.
+ */
+#ifndef XGBOOST_COMMON_SCRATCH_POOL_H_
+#define XGBOOST_COMMON_SCRATCH_POOL_H_
+
+#include <algorithm>    // for fill_n
+#include <cstddef>      // for byte, size_t, max_align_t
+#include <mutex>        // for mutex, lock_guard
+#include <type_traits>  // for is_trivially_copyable_v
+#include <utility>      // for move, swap
+#include <vector>       // for vector
+
+namespace xgboost::common {
+/**
+ * @brief A pool of reusable byte blocks for short-lived, typed scratch buffers.
+ *
+ * Hot functions that would otherwise construct a `std::vector` temporary on every call
+ * can check a buffer out of the pool instead; the returned RAII handle views the block
+ * as an array of `T` and hands the block back on destruction, so after warm-up repeated
+ * calls stop touching the allocator entirely.  Checkout and return take a lock, but only
+ * around the free-list bookkeeping, so concurrent tasks can share one pool as long as
+ * each checks out once per task rather than once per element.
+ *
+ * Blocks are recycled without regard to their previous element type, hence only
+ * trivially copyable types are allowed and a fresh checkout has unspecified contents
+ * unless an initial value is supplied.
+ */
+class ScratchPool {
+ public:
+  /** @brief RAII handle over a pooled block, viewed as an array of `T`. */
+  template <typename T>
+  class Buffer {
+    static_assert(std::is_trivially_copyable_v<T>);
+    static_assert(alignof(T) <= alignof(std::max_align_t));
+
+    ScratchPool* pool_{nullptr};
+    std::vector<std::byte> storage_;
+    std::size_t size_{0};
+
+   public:
+    Buffer(ScratchPool* pool, std::vector<std::byte>&& storage, std::size_t n)
+        : pool_{pool}, storage_{std::move(storage)}, size_{n} {}
+    Buffer(Buffer const&) = delete;
+    Buffer& operator=(Buffer const&) = delete;
+    Buffer(Buffer&& that) : pool_{that.pool_}, storage_{std::move(that.storage_)},
+                            size_{that.size_} {
+      that.pool_ = nullptr;
+      that.size_ = 0;
+    }
+    Buffer& operator=(Buffer&& that) {
+      std::swap(pool_, that.pool_);
+      std::swap(storage_, that.storage_);
+      std::swap(size_, that.size_);
+      return *this;
+    }
+    ~Buffer() {
+      if (pool_) {
+        pool_->Return(std::move(storage_));
+      }
+    }
+
+    [[nodiscard]] T* data() { return reinterpret_cast<T*>(storage_.data()); }  // NOLINT
+    [[nodiscard]] T const* data() const {  // NOLINT
+      return reinterpret_cast<T const*>(storage_.data());
+    }
+    [[nodiscard]] std::size_t size() const { return size_; }  // NOLINT
+    [[nodiscard]] T* begin() { return data(); }               // NOLINT
+    [[nodiscard]] T* end() { return data() + size_; }         // NOLINT
+    T& operator[](std::size_t i) { return data()[i]; }
+    T const& operator[](std::size_t i) const { return data()[i]; }
+  };
+
+  /** @brief Check out a buffer of `n` elements with unspecified contents. */
+  template <typename T>
+  [[nodiscard]] Buffer<T> Checkout(std::size_t n) {
+    return Buffer<T>{this, this->Acquire(n * sizeof(T)), n};
+  }
+  /** @brief Check out a buffer of `n` elements, each set to `init`. */
+  template <typename T>
+  [[nodiscard]] Buffer<T> Checkout(std::size_t n, T const& init) {
+    auto buf = this->Checkout<T>(n);
+    std::fill_n(buf.data(), n, init);
+    return buf;
+  }
+
+ private:
+  // Blocks retained beyond this count are simply freed; the cap bounds the memory held
+  // by an idle pool after a burst of concurrent checkouts.
+  static constexpr std::size_t kMaxRetained = 128;
+
+  std::vector<std::byte> Acquire(std::size_t n_bytes) {
+    std::vector<std::byte> block;
+    {
+      std::lock_guard<std::mutex> guard{mu_};
+      // Prefer a block that already fits so recycled capacity is not wasted on a
+      // request it cannot serve.
+      for (auto it = free_.begin(); it != free_.end(); ++it) {
+        if (it->capacity() >= n_bytes) {
+          block = std::move(*it);
+          free_.erase(it);
+          break;
+        }
+      }
+      if (block.capacity() < n_bytes && !free_.empty()) {
+        block = std::move(free_.back());
+        free_.pop_back();
+      }
+    }
+    block.resize(n_bytes);
+    return block;
+  }
+  void Return(std::vector<std::byte>&& block) {
+    std::lock_guard<std::mutex> guard{mu_};
+    if (free_.size() < kMaxRetained) {
+      free_.push_back(std::move(block));
+    }
+  }
+
+  std::vector<std::vector<std::byte>> free_;
+  std::mutex mu_;
+};
+}  // namespace xgboost::common
+#endif  // XGBOOST_COMMON_SCRATCH_POOL_H_
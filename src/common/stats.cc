@@ -4,11 +4,10 @@
 #include "stats.h"
 
 #include <cstddef>                       // std::size_t
-#include <numeric>                       // std::accumulate
 
 #include "common.h"                      // OptionalWeights
 #include "linalg_op.h"
-#include "threading_utils.h"             // ParallelFor, MemStackAllocator
+#include "numeric.h"                     // cpu_impl::Reduce
 #include "transform_iterator.h"          // MakeIndexTransformIter
 #include "xgboost/context.h"             // Context
 #include "xgboost/host_device_vector.h"  // HostDeviceVector
@@ -54,11 +53,9 @@ void Mean(Context const* ctx, linalg::Vector<float> const& v, linalg::Vector<flo
   } else {
     auto h_v = v.HostView();
     float n = v.Size();
-    MemStackAllocator<float, DefaultMaxThreads()> tloc(ctx->Threads(), 0.0f);
-    ParallelFor(v.Size(), ctx->Threads(),
-                [&](auto i) { tloc[omp_get_thread_num()] += h_v(i) / n; });
-    auto ret = std::accumulate(tloc.cbegin(), tloc.cend(), .0f);
-    out->HostView()(0) = ret;
+    // Deterministic reduction, the result doesn't change with the number of threads.
+    auto it = MakeIndexTransformIter([&](std::size_t i) { return h_v(i) / n; });
+    out->HostView()(0) = cpu_impl::Reduce(ctx, it, it + v.Size(), 0.0f);
   }
 }
 }  // namespace xgboost::common
@@ -4,6 +4,10 @@
 #ifndef XGBOOST_COMMON_STATS_H_
 #define XGBOOST_COMMON_STATS_H_
 #include <algorithm>
+#include <array>     // for array
+#include <cmath>     // for floor
+#include <cstddef>   // for size_t
+#include <cstdint>   // for int32_t
 #include <iterator>  // for distance
 #include <limits>
 #include <vector>
@@ -106,6 +110,116 @@ float WeightedQuantile(Context const* ctx, double alpha, Iter begin, Iter end, W
   return val(idx);
 }
 
+/**
+ * @brief Streaming quantile estimation using the P^2 algorithm.
+ *
+ *   Jain & Chlamtac (1985), "The P^2 algorithm for dynamic calculation of quantiles and
+ *   histograms without storing observations".  Five markers are maintained in constant
+ *   memory and adjusted with a piecewise-parabolic fit as observations stream in.  The
+ *   estimate is exact for fewer than five observations and approximate afterward.
+ */
+class P2Quantile {
+  double alpha_;
+  // Marker heights, positions, desired positions, and the position increments.
+  std::array<double, 5> q_{};
+  std::array<double, 5> n_{};
+  std::array<double, 5> np_{};
+  std::array<double, 5> dn_{};
+  std::size_t cnt_{0};
+
+  [[nodiscard]] double Parabolic(std::size_t i, double d) const {
+    return q_[i] + d / (n_[i + 1] - n_[i - 1]) *
+                       ((n_[i] - n_[i - 1] + d) * (q_[i + 1] - q_[i]) / (n_[i + 1] - n_[i]) +
+                        (n_[i + 1] - n_[i] - d) * (q_[i] - q_[i - 1]) / (n_[i] - n_[i - 1]));
+  }
+  [[nodiscard]] double Linear(std::size_t i, std::int32_t d) const {
+    return q_[i] + d * (q_[i + d] - q_[i]) / (n_[i + d] - n_[i]);
+  }
+
+ public:
+  explicit P2Quantile(double alpha) : alpha_{alpha} {
+    CHECK(alpha >= 0 && alpha <= 1);
+    dn_ = {0.0, alpha / 2.0, alpha, (1.0 + alpha) / 2.0, 1.0};
+  }
+
+  void Push(double x) {
+    if (cnt_ < 5) {
+      q_[cnt_++] = x;
+      if (cnt_ == 5) {
+        std::sort(q_.begin(), q_.end());
+        for (std::size_t i = 0; i < 5; ++i) {
+          n_[i] = static_cast<double>(i) + 1.0;
+          np_[i] = 1.0 + 4.0 * dn_[i];
+        }
+      }
+      return;
+    }
+
+    // Find the cell of the new observation, adjusting the extreme markers.
+    std::size_t k{0};
+    if (x < q_[0]) {
+      q_[0] = x;
+    } else if (x >= q_[4]) {
+      q_[4] = x;
+      k = 3;
+    } else {
+      while (k < 3 && x >= q_[k + 1]) {
+        ++k;
+      }
+    }
+    for (std::size_t i = k + 1; i < 5; ++i) {
+      n_[i] += 1.0;
+    }
+    for (std::size_t i = 0; i < 5; ++i) {
+      np_[i] += dn_[i];
+    }
+    ++cnt_;
+
+    // Move the middle markers toward their desired positions.
+    for (std::size_t i = 1; i <= 3; ++i) {
+      double d = np_[i] - n_[i];
+      if ((d >= 1.0 && n_[i + 1] - n_[i] > 1.0) || (d <= -1.0 && n_[i - 1] - n_[i] < -1.0)) {
+        std::int32_t sign = d >= 0.0 ? 1 : -1;
+        auto qp = this->Parabolic(i, sign);
+        if (q_[i - 1] < qp && qp < q_[i + 1]) {
+          q_[i] = qp;
+        } else {
+          q_[i] = this->Linear(i, sign);
+        }
+        n_[i] += sign;
+      }
+    }
+  }
+
+  /**
+   * @brief The current estimate.  Matches the interpolation of Quantile when fewer than
+   *        five observations have been pushed.
+   */
+  [[nodiscard]] float Value() const {
+    if (cnt_ == 0) {
+      return std::numeric_limits<float>::quiet_NaN();
+    }
+    if (cnt_ >= 5) {
+      return static_cast<float>(q_[2]);
+    }
+    auto buf = q_;
+    std::sort(buf.begin(), buf.begin() + cnt_);
+    auto n = static_cast<double>(cnt_);
+    if (alpha_ <= (1 / (n + 1))) {
+      return static_cast<float>(buf[0]);
+    }
+    if (alpha_ >= (n / (n + 1))) {
+      return static_cast<float>(buf[cnt_ - 1]);
+    }
+    double x = alpha_ * (n + 1);
+    double k = std::floor(x) - 1;
+    double d = (x - 1) - k;
+    auto v0 = buf[static_cast<std::size_t>(k)];
+    auto v1 = buf[static_cast<std::size_t>(k) + 1];
+    return static_cast<float>(v0 + d * (v1 - v0));
+  }
+};
+
 namespace cuda_impl {
 void Median(Context const* ctx, linalg::TensorView<float const, 2> t, OptionalWeights weights,
             linalg::Tensor<float, 1>* out);
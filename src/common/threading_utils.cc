@@ -3,11 +3,15 @@
  */
 #include "threading_utils.h"
 
-#include <algorithm>   // for max, min
+#include <algorithm>   // for max, min, minmax_element
+#include <atomic>      // for atomic
+#include <cmath>       // for sqrt
 #include <exception>   // for exception
 #include <filesystem>  // for path, exists
 #include <fstream>     // for ifstream
+#include <numeric>     // for accumulate
 #include <string>      // for string
+#include <vector>      // for vector
 
 #include "common.h"  // for DivRoundUp
 
@@ -121,6 +125,29 @@ std::int32_t OmpGetNumThreads(std::int32_t n_threads) noexcept(true) {
   return n_threads;
 }
 
+void PublishThreadImbalance(StringView region, std::vector<double> const& busy_sec) {
+  auto& registry = PerfStats::Instance();
+  if (!registry.Enabled() || busy_sec.empty()) {
+    return;
+  }
+
+  auto n = static_cast<double>(busy_sec.size());
+  auto [min_it, max_it] = std::minmax_element(busy_sec.cbegin(), busy_sec.cend());
+  double mean = std::accumulate(busy_sec.cbegin(), busy_sec.cend(), 0.0) / n;
+  double var = 0.0;
+  for (auto b : busy_sec) {
+    var += (b - mean) * (b - mean);
+  }
+  var /= n;
+
+  auto us = [](double sec) { return static_cast<std::int64_t>(sec * 1e6); };
+  std::string name{region.c_str(), region.size()};
+  registry.Add("ParallelFor2d", name + ".busy_min", us(*min_it));
+  registry.Add("ParallelFor2d", name + ".busy_max", us(*max_it));
+  registry.Add("ParallelFor2d", name + ".busy_mean", us(mean));
+  registry.Add("ParallelFor2d", name + ".busy_stddev", us(std::sqrt(var)));
+}
+
 [[nodiscard]] bool GetCpuNuma(unsigned int* cpu, unsigned int* numa) {
 #ifdef SYS_getcpu
   return syscall(SYS_getcpu, cpu, numa, NULL) == 0;
@@ -150,4 +177,38 @@ void NameThread(std::thread* t, StringView name) {
   (void)t;
 #endif
 }
+
+OmpHotTeamGuard::OmpHotTeamGuard(std::int32_t n_threads) {
+#if defined(_OPENMP)
+  dynamic_ = omp_get_dynamic();
+  omp_set_dynamic(0);
+#endif  // defined(_OPENMP)
+  // Spawn the workers up-front so the first timed region doesn't pay the fork cost.
+  std::atomic<std::int32_t> n_alive{0};
+  ParallelFor(n_threads, n_threads,
+              [&](auto) { n_alive.fetch_add(1, std::memory_order_relaxed); });
+  CHECK_EQ(n_alive.load(), n_threads);
+}
+
+OmpHotTeamGuard::~OmpHotTeamGuard() {
+#if defined(_OPENMP)
+  omp_set_dynamic(dynamic_);
+#endif  // defined(_OPENMP)
+}
+
+ThreadGovernor& ThreadGovernor::Instance() {
+  static ThreadGovernor governor;
+  return governor;
+}
+
+std::int32_t ThreadGovernor::Share() const {
+  auto budget = std::min({omp_get_num_procs(), omp_get_max_threads(), OmpGetThreadLimit()});
+  // Reading the cgroup quota has non-trivial overhead, probe it once per process.
+  static std::int32_t const cfs_cpu_count = GetCfsCPUCount();
+  if (cfs_cpu_count > 0) {
+    budget = std::min(budget, cfs_cpu_count);
+  }
+  auto n = std::max(this->Participants(), 1);
+  return std::max(budget / n, 1);
+}
 }  // namespace xgboost::common
@@ -8,14 +8,17 @@
 #include <dmlc/omp.h>
 
 #include <algorithm>    // for min
+#include <atomic>       // for atomic
 #include <cstddef>      // for size_t
 #include <cstdint>      // for int32_t
 #include <cstdlib>      // for malloc, free
 #include <new>          // for bad_alloc
 #include <thread>       // for thread
 #include <type_traits>  // for is_signed, conditional_t, is_integral_v, invoke_result_t
+#include <utility>      // for forward
 #include <vector>       // for vector
 
+#include "timer.h"                // for Timer, PerfStats
 #include "xgboost/logging.h"
 #include "xgboost/string_view.h"  // for StringView
 
@@ -137,6 +140,22 @@ class BlockedSpace2d {
   std::vector<std::size_t> first_dimension_;
 };
 
+/**
+ * @brief Pick a grain size for splitting `n` units of work into parallel blocks.
+ *
+ * A fixed grain under-splits on many-core machines, where threads sit idle while a
+ * handful of large blocks finish, and over-splits on small ones, where the scheduling
+ * overhead dominates.  Target a few blocks per thread so uneven rows can still be
+ * balanced dynamically, but never go below `min_grain`, which guards the per-block
+ * fixed cost of the kernel.
+ */
+inline std::size_t GrainSize(std::size_t n, std::int32_t n_threads, std::size_t min_grain) {
+  // Enough blocks per thread for load balancing without drowning in scheduling.
+  std::size_t constexpr kBlocksPerThread = 4;
+  std::size_t n_blocks = std::max(n_threads, 1) * kBlocksPerThread;
+  std::size_t grain = n / n_blocks + !!(n % n_blocks);
+  return std::max(grain, min_grain);
+}
 
 // Wrapper to implement nested parallelism with simple omp parallel for
 template <typename Func>
@@ -162,6 +181,55 @@ void ParallelFor2d(const BlockedSpace2d& space, int n_threads, Func&& func) {
   exc.Rethrow();
 }
 
+/**
+ * @brief Aggregate the per-thread busy times of one instrumented parallel region into
+ *        the @ref PerfStats registry.
+ *
+ * Publishes the min/max/mean/stddev across threads in microseconds under the
+ * `ParallelFor2d` label, e.g. `BuildHist.busy_stddev`.  A thread's idle time is the
+ * maximum busy time minus its own, so these four numbers fully describe the imbalance.
+ */
+void PublishThreadImbalance(StringView region, std::vector<double> const& busy_sec);
+
+/**
+ * @brief Same as @ref ParallelFor2d, but when the performance counters are enabled
+ *        (see @ref PerfStats) each thread measures its busy time and the cross-thread
+ *        spread is published under the given region name, quantifying load imbalance
+ *        per phase without attaching a profiler.  Free when the counters are off.
+ */
+template <typename Func>
+void ParallelFor2d(StringView region, const BlockedSpace2d& space, int n_threads, Func&& func) {
+  if (!PerfStats::Instance().Enabled()) {
+    ParallelFor2d(space, n_threads, std::forward<Func>(func));
+    return;
+  }
+
+  std::size_t n_blocks_in_space = space.Size();
+  CHECK_GE(n_threads, 1);
+  std::vector<double> busy(n_threads, 0.0);
+
+  dmlc::OMPException exc;
+#pragma omp parallel num_threads(n_threads)
+  {
+    exc.Run([&]() {
+      std::size_t tid = omp_get_thread_num();
+      std::size_t chunck_size = n_blocks_in_space / n_threads + !!(n_blocks_in_space % n_threads);
+
+      std::size_t begin = chunck_size * tid;
+      std::size_t end = std::min(begin + chunck_size, n_blocks_in_space);
+      Timer timer;
+      for (auto i = begin; i < end; i++) {
+        func(space.GetFirstDimension(i), space.GetRange(i));
+      }
+      timer.Stop();
+      busy[tid] = timer.ElapsedSeconds();
+    });
+  }
+  exc.Rethrow();
+
+  PublishThreadImbalance(region, busy);
+}
+
 /**
  * OpenMP schedule
  */
@@ -320,6 +388,66 @@ std::int32_t constexpr DefaultMaxThreads() { return 128; }
  * @brief Give the thread a name. Supports only pthread on linux.
  */
 void NameThread(std::thread* t, StringView name);
+
+/**
+ * @brief RAII guard that keeps the OpenMP worker team hot across a sequence of parallel
+ *        regions.
+ *
+ *   Training runs dozens of small parallel regions per boosting iteration (gradient,
+ *   partitioning, evaluation); re-forking the team for each of them is measurable
+ *   overhead.  The guard disables dynamic thread adjustment so the runtime keeps the
+ *   team at a fixed size, then warms the team once so consecutive regions launched with
+ *   the same thread count reuse the already-running workers.  Thread placement is left
+ *   to the runtime (OMP_PROC_BIND/OMP_PLACES); a library pinning threads itself would
+ *   fight user and container affinity settings.
+ */
+class OmpHotTeamGuard {
+ public:
+  explicit OmpHotTeamGuard(std::int32_t n_threads);
+  ~OmpHotTeamGuard();
+
+  OmpHotTeamGuard(OmpHotTeamGuard const&) = delete;
+  OmpHotTeamGuard& operator=(OmpHotTeamGuard const&) = delete;
+
+ private:
+  std::int32_t dynamic_{0};
+};
+
+/**
+ * @brief Process-wide governor that splits the CPU budget between concurrent learners.
+ *
+ *   When several learners train in one process (one model per tenant in a serving stack,
+ *   or one per fold during cross validation), each of them sizing its team to the full
+ *   machine oversubscribes the CPUs and the throughput is lost to context switching.
+ *   Every learner registers itself as a participant for its lifetime.  A learner that
+ *   leaves `nthread` unspecified is capped by `Context::Threads()` to an equal share of
+ *   the process budget, which is the number of processors further limited by the cgroup
+ *   quota.  An explicit `nthread` is honored unchanged.
+ */
+class ThreadGovernor {
+ public:
+  /** @brief RAII registration of one participant. */
+  class Participant {
+   public:
+    Participant() { Instance().n_participants_.fetch_add(1, std::memory_order_relaxed); }
+    ~Participant() { Instance().n_participants_.fetch_sub(1, std::memory_order_relaxed); }
+
+    Participant(Participant const&) = delete;
+    Participant& operator=(Participant const&) = delete;
+  };
+
+  static ThreadGovernor& Instance();
+
+  /** @brief Number of currently registered participants. */
+  [[nodiscard]] std::int32_t Participants() const {
+    return n_participants_.load(std::memory_order_relaxed);
+  }
+  /** @brief Fair share of the process CPU budget for a single participant, at least 1. */
+  [[nodiscard]] std::int32_t Share() const;
+
+ private:
+  std::atomic<std::int32_t> n_participants_{0};
+};
 }  // namespace xgboost::common
 
 #endif  // XGBOOST_COMMON_THREADING_UTILS_H_
@@ -13,8 +13,47 @@
 #endif  // defined(XGBOOST_USE_NVTX)
 
 namespace xgboost::common {
+PerfStats& PerfStats::Instance() {
+  static PerfStats instance;
+  return instance;
+}
+
+void PerfStats::Add(std::string const& label, std::string const& name, std::int64_t elapsed_us) {
+  std::lock_guard<std::mutex> guard{mu_};
+  auto& entry = stats_[label][name];
+  entry.count++;
+  entry.elapsed_us += elapsed_us;
+}
+
+void PerfStats::Reset() {
+  std::lock_guard<std::mutex> guard{mu_};
+  stats_.clear();
+}
+
+Json PerfStats::ToJson() const {
+  std::lock_guard<std::mutex> guard{mu_};
+  Json out{Object{}};
+  for (auto const& [label, phases] : stats_) {
+    Json jphases{Object{}};
+    for (auto const& [name, entry] : phases) {
+      Json jentry{Object{}};
+      jentry["count"] = Integer{static_cast<Integer::Int>(entry.count)};
+      jentry["elapsed_us"] = Integer{static_cast<Integer::Int>(entry.elapsed_us)};
+      jphases[name] = std::move(jentry);
+    }
+    out[label] = std::move(jphases);
+  }
+  return out;
+}
+
+namespace {
+bool MonitorEnabled() {
+  return ConsoleLogger::ShouldLog(ConsoleLogger::LV::kDebug) || PerfStats::Instance().Enabled();
+}
+}  // anonymous namespace
+
 void Monitor::Start(std::string const &name) {
-  if (ConsoleLogger::ShouldLog(ConsoleLogger::LV::kDebug)) {
+  if (MonitorEnabled()) {
     auto &stats = statistics_map_[name];
     stats.timer.Start();
 #if defined(XGBOOST_USE_NVTX)
@@ -25,13 +64,19 @@ void Monitor::Start(std::string const &name) {
 }
 
 void Monitor::Stop(const std::string &name) {
-  if (ConsoleLogger::ShouldLog(ConsoleLogger::LV::kDebug)) {
+  if (MonitorEnabled()) {
     auto &stats = statistics_map_[name];
+    auto prev = stats.timer.elapsed;
     stats.timer.Stop();
     stats.count++;
 #if defined(XGBOOST_USE_NVTX)
     nvtx3::end_range_in<curt::NvtxDomain>(nvtx3::range_handle{stats.nvtx_id});
 #endif  // defined(XGBOOST_USE_NVTX)
+    auto& registry = PerfStats::Instance();
+    if (registry.Enabled()) {
+      auto delta = std::chrono::duration_cast<std::chrono::microseconds>(stats.timer.elapsed - prev);
+      registry.Add(label_, name, delta.count());
+    }
   }
 }
 
@@ -2,10 +2,14 @@
  * Copyright 2017-2024, XGBoost Contributors
  */
 #pragma once
+#include <xgboost/json.h>
 #include <xgboost/logging.h>
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -36,6 +40,37 @@ struct Timer {
   }
 };
 
+/**
+ * \brief Process-wide registry aggregating `Monitor` statistics for programmatic access.
+ *
+ *  Disabled by default; when enabled every monitor publishes its per-phase elapsed time
+ *  and call count here on `Stop`, keyed by the monitor label and the phase name.  Unlike
+ *  the console output of `Monitor` this survives the monitors themselves and can be
+ *  queried through the C API for telemetry.
+ */
+class PerfStats {
+ public:
+  struct Entry {
+    std::size_t count{0};
+    std::int64_t elapsed_us{0};
+  };
+
+  static PerfStats& Instance();
+
+  void Enable(bool on) { enabled_ = on; }
+  [[nodiscard]] bool Enabled() const { return enabled_; }
+
+  void Add(std::string const& label, std::string const& name, std::int64_t elapsed_us);
+  void Reset();
+  [[nodiscard]] Json ToJson() const;
+
+ private:
+  mutable std::mutex mu_;
+  std::atomic<bool> enabled_{false};
+  // <monitor label, <phase name, entry>>
+  std::map<std::string, std::map<std::string, Entry>> stats_;
+};
+
 /**
  * \struct  Monitor
  *
@@ -0,0 +1,11 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include "transfer_stats.h"
+
+namespace xgboost::common {
+TransferStats& TransferStats::Instance() {
+  static TransferStats stats;
+  return stats;
+}
+}  // namespace xgboost::common
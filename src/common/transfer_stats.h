@@ -0,0 +1,66 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ *
+ * @brief Process-wide accounting of implicit host/device transfers performed by
+ *        `HostDeviceVector`, exposed through the `XGBGetTransferStats` C API.
+ */
+#ifndef XGBOOST_COMMON_TRANSFER_STATS_H_
+#define XGBOOST_COMMON_TRANSFER_STATS_H_
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <mutex>    // for mutex, lock_guard
+
+namespace xgboost::common {
+/**
+ * @brief Counters for the lazy synchronization in `HostDeviceVector`.
+ *
+ *   The vector migrates data on demand, so a CPU consumer following GPU training can
+ *   silently ping-pong the same buffer between host and device every iteration.  The
+ *   counters make such thrash visible without a profiler: each vector reports its
+ *   copies here, and a round trip is recorded whenever a copy reverses the direction of
+ *   the previous copy of the same vector.
+ */
+class TransferStats {
+ public:
+  struct Counters {
+    std::size_t h2d_count{0};
+    std::size_t h2d_bytes{0};
+    std::size_t d2h_count{0};
+    std::size_t d2h_bytes{0};
+    // Number of times a vector reversed the direction of its previous transfer.
+    std::size_t round_trips{0};
+  };
+
+ private:
+  mutable std::mutex mu_;
+  Counters counters_;
+
+ public:
+  static TransferStats& Instance();
+  /**
+   * @brief Round trips of a single vector before it's reported as thrashing.
+   */
+  static constexpr std::uint32_t ThrashThreshold() { return 8; }
+
+  void RecordH2D(std::size_t n_bytes) {
+    std::lock_guard guard{mu_};
+    ++counters_.h2d_count;
+    counters_.h2d_bytes += n_bytes;
+  }
+  void RecordD2H(std::size_t n_bytes) {
+    std::lock_guard guard{mu_};
+    ++counters_.d2h_count;
+    counters_.d2h_bytes += n_bytes;
+  }
+  void RecordRoundTrip() {
+    std::lock_guard guard{mu_};
+    ++counters_.round_trips;
+  }
+  [[nodiscard]] Counters Snapshot() const {
+    std::lock_guard guard{mu_};
+    return counters_;
+  }
+};
+}  // namespace xgboost::common
+#endif  // XGBOOST_COMMON_TRANSFER_STATS_H_
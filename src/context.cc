@@ -14,6 +14,7 @@
 #include "common/common.h"         // AssertGPUSupport
 #include "common/cuda_rt_utils.h"  // for AllVisibleGPUs
 #include "common/error_msg.h"      // WarnDeprecatedGPUId
+#include "common/scratch_pool.h"   // for ScratchPool
 #include "common/threading_utils.h"
 #include "xgboost/string_view.h"
 
@@ -272,9 +273,21 @@ std::int32_t Context::Threads() const {
   if (cfs_cpu_count_ > 0) {
     n_threads = std::min(n_threads, cfs_cpu_count_);
   }
+  if (nthread <= 0) {
+    // An unspecified `nthread` takes a fair share of the process budget so that
+    // concurrent learners don't each spawn a full team and oversubscribe the machine.
+    n_threads = std::min(n_threads, common::ThreadGovernor::Instance().Share());
+  }
   return n_threads;
 }
 
+common::ScratchPool* Context::Scratch() const {
+  if (!scratch_) {
+    scratch_ = std::make_shared<common::ScratchPool>();
+  }
+  return scratch_.get();
+}
+
 #if !defined(XGBOOST_USE_CUDA)
 CUDAContext const* Context::CUDACtx() const {
   common::AssertGPUSupport();
@@ -273,6 +273,9 @@ class ArrayAdapterBatch : public detail::NoMetaInfo {
   [[nodiscard]] std::size_t NumCols() const { return array_interface_.Shape(1); }
   [[nodiscard]] std::size_t Size() const { return this->NumRows(); }
 
+  // Accessor for the specialized dense conversion in SparsePage::Push.
+  [[nodiscard]] ArrayInterface<2> const& Array() const { return array_interface_; }
+
   explicit ArrayAdapterBatch(ArrayInterface<2> array_interface)
       : array_interface_{std::move(array_interface)} {}
 };
@@ -346,6 +349,11 @@ class CSRArrayAdapterBatch : public detail::NoMetaInfo {
   size_t NumCols() const { return n_features_; }
   size_t Size() const { return this->NumRows(); }
 
+  // Accessors for the specialized CSR conversion in SparsePage::Push.
+  ArrayInterface<1> const& Indptr() const { return indptr_; }
+  ArrayInterface<1> const& Indices() const { return indices_; }
+  ArrayInterface<1> const& Values() const { return values_; }
+
   Line const GetLine(size_t idx) const {
     auto begin_no_stride = TypedIndex<size_t, 1>{indptr_}(idx);
     auto end_no_stride = TypedIndex<size_t, 1>{indptr_}(idx + 1);
@@ -4,6 +4,8 @@
 #ifndef XGBOOST_DATA_BATCH_UTILS_H_
 #define XGBOOST_DATA_BATCH_UTILS_H_
 
+#include <cstdint>  // for int32_t
+
 #include "xgboost/data.h"  // for BatchParam
 
 namespace xgboost::data::detail {
@@ -34,6 +36,19 @@ inline bool RegenGHist(BatchParam old, BatchParam p) {
  * @brief Validate the batch parameter from the caller
  */
 void CheckParam(BatchParam const& init, BatchParam const& param);
+
+/**
+ * @brief Apply the user-configured external memory prefetch depth.
+ *
+ * @param param The batch parameter passed in by the caller.
+ * @param depth Configured number of look-ahead pages, 0 to keep the caller's value.
+ */
+inline BatchParam ApplyPrefetchDepth(BatchParam param, std::int32_t depth) {
+  if (depth > 0) {
+    param.n_prefetch_batches = depth;
+  }
+  return param;
+}
 }  // namespace xgboost::data::detail
 
 namespace xgboost::cuda_impl {
@@ -0,0 +1,199 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include "cache_manifest.h"
+
+#include <dmlc/io.h>  // for Stream
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>   // for open, fcntl, flock, F_SETLKW
+#include <unistd.h>  // for close
+#include <cstring>   // for memset
+#endif  // defined(__unix__) || defined(__APPLE__)
+
+#include <cstdint>     // for int64_t, uint64_t
+#include <filesystem>  // for exists, file_size
+#include <fstream>     // for ifstream, ofstream
+#include <iterator>    // for istreambuf_iterator
+#include <memory>      // for make_shared, unique_ptr
+#include <string>      // for string, to_string
+#include <vector>      // for vector
+
+#include "xgboost/json.h"     // for Json, Object, F32Array, I64Array
+#include "xgboost/logging.h"  // for CHECK
+
+namespace xgboost::data {
+namespace {
+constexpr std::int64_t kManifestVersion = 1;
+
+[[nodiscard]] std::string InfoPath(std::string const& cache_prefix) {
+  return cache_prefix + ".info.bin";
+}
+
+template <typename JArray, typename T>
+Json MakeArray(std::vector<T> const& in) {
+  JArray out(in.size());
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    out.Set(i, static_cast<typename JArray::Type>(in[i]));
+  }
+  return Json{std::move(out)};
+}
+
+template <typename JArray, typename T>
+void ReadArray(Json const& in, std::vector<T>* p_out) {
+  auto const& array = get<JArray const>(in);
+  p_out->resize(array.size());
+  for (std::size_t i = 0; i < array.size(); ++i) {
+    (*p_out)[i] = static_cast<T>(array[i]);
+  }
+}
+}  // namespace
+
+std::string ManifestPath(std::string const& cache_prefix) {
+  // UBJSON, so the cuts and offsets round-trip through typed arrays.
+  return cache_prefix + ".manifest.ubj";
+}
+
+CacheLockGuard::CacheLockGuard(std::string const& cache_prefix)
+    : path_{cache_prefix + ".lock"} {
+#if defined(__unix__) || defined(__APPLE__)
+  fd_ = open(path_.c_str(), O_CREAT | O_RDWR, 0644);
+  CHECK_GE(fd_, 0) << "Failed to open the cache lock file: " << path_;
+  struct flock fl;
+  std::memset(&fl, 0, sizeof(fl));
+  fl.l_type = F_WRLCK;
+  fl.l_whence = SEEK_SET;
+  // Blocks until the process holding the lock commits (or abandons) the cache.
+  CHECK_NE(fcntl(fd_, F_SETLKW, &fl), -1) << "Failed to lock the cache: " << path_;
+#else
+  LOG(WARNING) << "Cache locking is not supported on this platform, concurrent trainers "
+                  "sharing the cache prefix `"
+               << cache_prefix << "` are not protected against racing cache builds.";
+#endif  // defined(__unix__) || defined(__APPLE__)
+}
+
+CacheLockGuard::~CacheLockGuard() {
+#if defined(__unix__) || defined(__APPLE__)
+  if (fd_ >= 0) {
+    struct flock fl;
+    std::memset(&fl, 0, sizeof(fl));
+    fl.l_type = F_UNLCK;
+    fl.l_whence = SEEK_SET;
+    fcntl(fd_, F_SETLK, &fl);
+    close(fd_);
+  }
+#endif  // defined(__unix__) || defined(__APPLE__)
+}
+
+std::uint64_t HashFile(std::string const& path) {
+  // FNV-1a, cheap and dependency-free; this is a validity check, not a security measure.
+  std::uint64_t h = 0xcbf29ce484222325ULL;
+  std::ifstream fin{path, std::ios::binary};
+  std::vector<char> buffer(1 << 20);
+  while (fin) {
+    fin.read(buffer.data(), buffer.size());
+    auto n = fin.gcount();
+    for (std::streamsize i = 0; i < n; ++i) {
+      h ^= static_cast<std::uint8_t>(buffer[i]);
+      h *= 0x100000001b3ULL;
+    }
+  }
+  return h;
+}
+
+void SaveCacheManifest(std::string const& cache_prefix, bst_bin_t max_bin, MetaInfo const& info,
+                       common::HistogramCuts const& cuts, std::vector<bst_idx_t> const& base_rowids,
+                       Cache const& cache) {
+  CHECK(cache.written);
+  auto shard = cache.ShardName();
+
+  Json manifest{Object{}};
+  manifest["version"] = Integer{kManifestVersion};
+  manifest["max_bin"] = Integer{max_bin};
+  manifest["base_rowids"] = MakeArray<I64Array>(base_rowids);
+
+  Json jshard{Object{}};
+  jshard["name"] = String{cache.name};
+  jshard["format"] = String{cache.format};
+  jshard["offset"] = MakeArray<I64Array>(cache.offset);
+  jshard["bytes"] = Integer{static_cast<std::int64_t>(std::filesystem::file_size(shard))};
+  jshard["hash"] = String{std::to_string(HashFile(shard))};
+  manifest["shard"] = jshard;
+
+  Json jcuts{Object{}};
+  jcuts["cut_ptrs"] = MakeArray<I64Array>(cuts.Ptrs());
+  jcuts["cut_values"] = MakeArray<F32Array>(cuts.Values());
+  jcuts["min_values"] = MakeArray<F32Array>(cuts.MinValues());
+  jcuts["has_categorical"] = Boolean{cuts.HasCategorical()};
+  jcuts["max_category"] = Number{cuts.MaxCategory()};
+  manifest["cuts"] = jcuts;
+
+  std::vector<char> buffer;
+  Json::Dump(manifest, &buffer, std::ios::binary);
+  std::ofstream fout{ManifestPath(cache_prefix), std::ios::binary};
+  CHECK(fout) << "Failed to write the cache manifest: " << ManifestPath(cache_prefix);
+  fout.write(buffer.data(), buffer.size());
+
+  std::unique_ptr<dmlc::Stream> fo{dmlc::Stream::Create(InfoPath(cache_prefix).c_str(), "w")};
+  info.SaveBinary(fo.get());
+}
+
+bool LoadCacheManifest(std::string const& cache_prefix, bst_bin_t max_bin, MetaInfo* info,
+                       CacheManifest* out) {
+  auto path = ManifestPath(cache_prefix);
+  if (!std::filesystem::exists(path) || !std::filesystem::exists(InfoPath(cache_prefix))) {
+    return false;
+  }
+  std::ifstream fin{path, std::ios::binary};
+  std::string str{std::istreambuf_iterator<char>{fin}, std::istreambuf_iterator<char>{}};
+  auto manifest = Json::Load(StringView{str}, std::ios::binary);
+
+  if (get<Integer const>(manifest["version"]) != kManifestVersion) {
+    LOG(WARNING) << "Unknown cache manifest version, rebuilding the cache.";
+    return false;
+  }
+  if (get<Integer const>(manifest["max_bin"]) != max_bin) {
+    LOG(WARNING) << "`max_bin` doesn't match the cache manifest, rebuilding the cache.";
+    return false;
+  }
+
+  auto const& jshard = manifest["shard"];
+  auto name = get<String const>(jshard["name"]);
+  auto format = get<String const>(jshard["format"]);
+  std::vector<bst_idx_t> offset;
+  ReadArray<I64Array>(jshard["offset"], &offset);
+  auto shard = Cache::ShardName(name, format);
+  if (!std::filesystem::exists(shard)) {
+    LOG(WARNING) << "External memory cache file " << shard
+                 << " is missing, rebuilding the cache.";
+    return false;
+  }
+  auto n_bytes = static_cast<std::uint64_t>(get<Integer const>(jshard["bytes"]));
+  if (std::filesystem::file_size(shard) != n_bytes || offset.empty() || offset.back() > n_bytes) {
+    LOG(WARNING) << "External memory cache file " << shard
+                 << " has changed size, rebuilding the cache.";
+    return false;
+  }
+  if (std::to_string(HashFile(shard)) != get<String const>(jshard["hash"])) {
+    LOG(WARNING) << "External memory cache file " << shard
+                 << " doesn't match its content hash, rebuilding the cache.";
+    return false;
+  }
+
+  auto const& jcuts = manifest["cuts"];
+  ReadArray<I64Array>(jcuts["cut_ptrs"], &out->cuts.cut_ptrs_.HostVector());
+  ReadArray<F32Array>(jcuts["cut_values"], &out->cuts.cut_values_.HostVector());
+  ReadArray<F32Array>(jcuts["min_values"], &out->cuts.min_vals_.HostVector());
+  out->cuts.SetCategorical(get<Boolean const>(jcuts["has_categorical"]),
+                           get<Number const>(jcuts["max_category"]));
+
+  out->max_bin = static_cast<bst_bin_t>(get<Integer const>(manifest["max_bin"]));
+  ReadArray<I64Array>(manifest["base_rowids"], &out->base_rowids);
+  out->cache = std::make_shared<Cache>(true, std::move(name), std::move(format), /*on_host=*/false);
+  out->cache->offset = std::move(offset);
+
+  std::unique_ptr<dmlc::Stream> fi{dmlc::Stream::Create(InfoPath(cache_prefix).c_str(), "r")};
+  info->LoadBinary(fi.get());
+  return true;
+}
+}  // namespace xgboost::data
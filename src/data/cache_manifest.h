@@ -0,0 +1,78 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ * \file cache_manifest.h
+ * \brief Persist external memory caches across process restarts.
+ */
+#ifndef XGBOOST_DATA_CACHE_MANIFEST_H_
+#define XGBOOST_DATA_CACHE_MANIFEST_H_
+
+#include <cstdint>  // for uint64_t
+#include <memory>   // for shared_ptr
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "../common/hist_util.h"  // for HistogramCuts
+#include "sparse_page_source.h"   // for Cache
+#include "xgboost/base.h"         // for bst_bin_t, bst_idx_t
+#include "xgboost/data.h"         // for MetaInfo
+
+namespace xgboost::data {
+/** @brief Path of the cache manifest for a cache prefix. */
+[[nodiscard]] std::string ManifestPath(std::string const& cache_prefix);
+
+/**
+ * @brief Cross-process exclusive lock over a cache prefix.
+ *
+ * Serializes cache construction between concurrent trainers sharing a persisted cache:
+ * the first process builds and commits the cache under the lock while the others block
+ * on it, then restore the finished cache from its manifest instead of building their own
+ * copy.  Reading a committed cache is lock-free since the shards are mapped read-only.
+ *
+ * The lock file (`<cache_prefix>.lock`) carries no data and is left behind on purpose,
+ * removing it would race against processes still blocked on it.
+ */
+class CacheLockGuard {
+  std::string path_;
+  int fd_{-1};
+
+ public:
+  explicit CacheLockGuard(std::string const& cache_prefix);
+  ~CacheLockGuard();
+
+  CacheLockGuard(CacheLockGuard const&) = delete;
+  CacheLockGuard& operator=(CacheLockGuard const&) = delete;
+};
+
+/** @brief FNV-1a hash over the content of a file. */
+[[nodiscard]] std::uint64_t HashFile(std::string const& path);
+
+/** @brief In-memory image of a cache manifest. */
+struct CacheManifest {
+  bst_bin_t max_bin{0};
+  common::HistogramCuts cuts;
+  std::vector<bst_idx_t> base_rowids;
+  std::shared_ptr<Cache> cache;
+};
+
+/**
+ * @brief Describe a committed gradient index cache on disk so a later process can map it
+ *        without re-sketching.
+ *
+ * Writes `<cache_prefix>.manifest.ubj` with the histogram cuts, the page offsets, and a
+ * content hash of the shard, plus the `MetaInfo` as a side binary file.
+ */
+void SaveCacheManifest(std::string const& cache_prefix, bst_bin_t max_bin, MetaInfo const& info,
+                       common::HistogramCuts const& cuts, std::vector<bst_idx_t> const& base_rowids,
+                       Cache const& cache);
+
+/**
+ * @brief Try to restore a cache from its manifest.
+ *
+ * The shard referenced by the manifest is validated against the recorded size and
+ * content hash.  Any mismatch (missing files, different `max_bin`, stale shard) makes
+ * this return false, in which case the caller should rebuild the cache from the data.
+ */
+[[nodiscard]] bool LoadCacheManifest(std::string const& cache_prefix, bst_bin_t max_bin,
+                                     MetaInfo* info, CacheManifest* out);
+}  // namespace xgboost::data
+#endif  // XGBOOST_DATA_CACHE_MANIFEST_H_
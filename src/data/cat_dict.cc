@@ -0,0 +1,47 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include "cat_dict.h"
+
+#include <algorithm>  // for sort, unique, lower_bound
+
+#include "../common/threading_utils.h"  // for ParallelFor
+#include "xgboost/logging.h"            // for CHECK
+
+namespace xgboost::data {
+void CatDictionary::BuildFeature(Context const* ctx, bst_feature_t fidx,
+                                 common::Span<std::int64_t const> keys) {
+  if (fidx >= dicts_.size()) {
+    dicts_.resize(fidx + 1);
+  }
+  auto& dict = dicts_[fidx];
+  if (ctx->IsCUDA()) {
+    cuda_impl::BuildDict(ctx, keys, &dict);
+    return;
+  }
+  auto& h_dict = dict.HostVector();
+  h_dict.assign(keys.cbegin(), keys.cend());
+  std::sort(h_dict.begin(), h_dict.end());
+  h_dict.erase(std::unique(h_dict.begin(), h_dict.end()), h_dict.end());
+}
+
+void CatDictionary::Encode(Context const* ctx, bst_feature_t fidx,
+                           common::Span<std::int64_t const> keys,
+                           common::Span<bst_cat_t> out_codes) const {
+  CHECK_EQ(keys.size(), out_codes.size());
+  CHECK_LT(fidx, dicts_.size()) << "No dictionary was built for feature:" << fidx;
+  auto const& dict = dicts_[fidx];
+  if (ctx->IsCUDA()) {
+    dict.SetDevice(ctx->Device());
+    cuda_impl::EncodeKeys(ctx, dict.ConstDeviceSpan(), keys, out_codes);
+    return;
+  }
+  auto const& h_dict = dict.ConstHostVector();
+  common::ParallelFor(keys.size(), ctx->Threads(), [&](std::size_t i) {
+    auto it = std::lower_bound(h_dict.cbegin(), h_dict.cend(), keys[i]);
+    out_codes[i] = (it != h_dict.cend() && *it == keys[i])
+                       ? static_cast<bst_cat_t>(it - h_dict.cbegin())
+                       : static_cast<bst_cat_t>(-1);
+  });
+}
+}  // namespace xgboost::data
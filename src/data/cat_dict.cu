@@ -0,0 +1,40 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include <thrust/binary_search.h>  // for lower_bound
+#include <thrust/sort.h>           // for sort
+#include <thrust/unique.h>         // for unique
+
+#include <cstdint>  // for int64_t
+
+#include "../common/device_helpers.cuh"  // for device_vector, CachingThrustPolicy
+#include "cat_dict.h"
+
+namespace xgboost::data::cuda_impl {
+void BuildDict(Context const* ctx, common::Span<std::int64_t const> keys,
+               HostDeviceVector<std::int64_t>* p_dict) {
+  dh::device_vector<std::int64_t> sorted(keys.size());
+  thrust::copy(ctx->CUDACtx()->CTP(), dh::tcbegin(keys), dh::tcend(keys), sorted.begin());
+  thrust::sort(ctx->CUDACtx()->CTP(), sorted.begin(), sorted.end());
+  auto uniq_end = thrust::unique(ctx->CUDACtx()->CTP(), sorted.begin(), sorted.end());
+  auto n_uniq = static_cast<std::size_t>(thrust::distance(sorted.begin(), uniq_end));
+
+  p_dict->SetDevice(ctx->Device());
+  p_dict->Resize(n_uniq);
+  auto d_dict = p_dict->DeviceSpan();
+  thrust::copy(ctx->CUDACtx()->CTP(), sorted.begin(), uniq_end, dh::tbegin(d_dict));
+}
+
+void EncodeKeys(Context const* ctx, common::Span<std::int64_t const> dict,
+                common::Span<std::int64_t const> keys, common::Span<bst_cat_t> out_codes) {
+  // Vectorized binary search followed by a membership check, unseen keys map to -1.
+  thrust::lower_bound(ctx->CUDACtx()->CTP(), dh::tcbegin(dict), dh::tcend(dict),
+                      dh::tcbegin(keys), dh::tcend(keys), dh::tbegin(out_codes));
+  dh::LaunchN(keys.size(), ctx->CUDACtx()->Stream(), [=] XGBOOST_DEVICE(std::size_t i) {
+    auto pos = out_codes[i];
+    if (static_cast<std::size_t>(pos) >= dict.size() || dict[pos] != keys[i]) {
+      out_codes[i] = -1;
+    }
+  });
+}
+}  // namespace xgboost::data::cuda_impl
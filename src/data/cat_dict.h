@@ -0,0 +1,78 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ * \file cat_dict.h
+ * \brief Per-feature dictionary mapping raw category keys to dense ordinal codes.
+ */
+#ifndef XGBOOST_DATA_CAT_DICT_H_
+#define XGBOOST_DATA_CAT_DICT_H_
+
+#include <cstdint>  // for int64_t
+#include <vector>   // for vector
+
+#include "../common/common.h"            // for AssertGPUSupport
+#include "xgboost/base.h"                // for bst_cat_t, bst_feature_t
+#include "xgboost/context.h"             // for Context
+#include "xgboost/host_device_vector.h"  // for HostDeviceVector
+#include "xgboost/span.h"                // for Span
+
+namespace xgboost::data {
+/**
+ * \brief Dictionary encoder for categorical features.
+ *
+ * XGBoost consumes categorical values as dense ordinal codes `[0, n_categories)`, which
+ * usually forces the ETL pipeline to pre-encode raw category keys (string hashes or
+ * integer ids) on the host before ingestion.  This class builds the per-feature
+ * dictionary and encodes raw `int64` keys into codes, on the device when the context is
+ * CUDA, so the whole encode step stays on the GPU.
+ *
+ * The dictionary is the sorted set of distinct keys and a key's code is its rank, so
+ * encoding is a vectorized binary search and the mapping is deterministic regardless of
+ * the order the keys arrive in.  An instance attached to `MetaInfo::cat_dict` follows
+ * the `DMatrix` around, so every batch of a streamed construction and later inference
+ * data are encoded with the same mapping.
+ */
+class CatDictionary {
+ public:
+  /**
+   * \brief Build (or rebuild) the dictionary of one feature from its raw keys.
+   */
+  void BuildFeature(Context const* ctx, bst_feature_t fidx,
+                    common::Span<std::int64_t const> keys);
+  /**
+   * \brief Encode raw keys of a feature into dense codes, -1 for keys not in the
+   *        dictionary.
+   */
+  void Encode(Context const* ctx, bst_feature_t fidx, common::Span<std::int64_t const> keys,
+              common::Span<bst_cat_t> out_codes) const;
+
+  [[nodiscard]] bst_feature_t NumFeatures() const {
+    return static_cast<bst_feature_t>(dicts_.size());
+  }
+  [[nodiscard]] bst_cat_t NumCategories(bst_feature_t fidx) const {
+    return static_cast<bst_cat_t>(dicts_.at(fidx).Size());
+  }
+
+ private:
+  // Sorted distinct keys per feature, a key's code is its position.
+  std::vector<HostDeviceVector<std::int64_t>> dicts_;
+};
+
+namespace cuda_impl {
+void BuildDict(Context const* ctx, common::Span<std::int64_t const> keys,
+               HostDeviceVector<std::int64_t>* p_dict);
+void EncodeKeys(Context const* ctx, common::Span<std::int64_t const> dict,
+                common::Span<std::int64_t const> keys, common::Span<bst_cat_t> out_codes);
+
+#if !defined(XGBOOST_USE_CUDA)
+inline void BuildDict(Context const*, common::Span<std::int64_t const>,
+                      HostDeviceVector<std::int64_t>*) {
+  common::AssertGPUSupport();
+}
+inline void EncodeKeys(Context const*, common::Span<std::int64_t const>,
+                       common::Span<std::int64_t const>, common::Span<bst_cat_t>) {
+  common::AssertGPUSupport();
+}
+#endif  // !defined(XGBOOST_USE_CUDA)
+}  // namespace cuda_impl
+}  // namespace xgboost::data
+#endif  // XGBOOST_DATA_CAT_DICT_H_
@@ -0,0 +1,202 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#include "csv_parser.h"
+
+#include <algorithm>   // for copy, min, max
+#include <cmath>       // for isnan
+#include <cstring>     // for memchr
+#include <filesystem>  // for file_size, u8path
+#include <memory>      // for make_unique
+#include <string>      // for string, stoi
+#include <vector>      // for vector
+
+#include "../common/charconv.h"         // for from_chars
+#include "../common/common.h"           // for Split
+#include "../common/threading_utils.h"  // for ParallelFor, OmpGetNumThreads
+#include "xgboost/logging.h"            // for CHECK_LT
+#include "xgboost/string_view.h"        // for StringView
+
+namespace xgboost::data {
+namespace {
+// Position right after the first newline at or past `pos`, so that a range starting
+// there begins on a line boundary.  Returns `n` when there is no further newline.
+std::size_t AlignToLine(char const* base, std::size_t pos, std::size_t n) {
+  if (pos == 0 || pos >= n) {
+    return std::min(pos, n);
+  }
+  auto eol = static_cast<char const*>(std::memchr(base + pos - 1, '\n', n - (pos - 1)));
+  return eol ? static_cast<std::size_t>(eol - base) + 1 : n;
+}
+}  // namespace
+
+CSVParser::CSVParser(std::string const& path, std::int32_t label_column, std::uint32_t part_idx,
+                     std::uint32_t n_parts, std::size_t chunk_bytes)
+    : chunk_bytes_{chunk_bytes},
+      label_column_{label_column},
+      n_threads_{common::OmpGetNumThreads(0)} {
+  CHECK_LT(part_idx, n_parts);
+  auto n_total = static_cast<std::size_t>(std::filesystem::file_size(std::filesystem::u8path(path)));
+  if (n_total == 0) {
+    return;
+  }
+  data_ = std::make_unique<common::MmapResource>(StringView{path}, 0, n_total);
+  // A partition owns the lines that start within its nominal byte range.
+  auto base = data_->DataAs<char>();
+  begin_ = cur_ = AlignToLine(base, n_total * part_idx / n_parts, n_total);
+  end_ = AlignToLine(base, n_total * (part_idx + 1) / n_parts, n_total);
+}
+
+void CSVParser::ParseRange(char const* begin, char const* end, Arena* p_arena) const {
+  auto& arena = *p_arena;
+  char const* p = begin;
+  while (p < end) {
+    auto eol = static_cast<char const*>(std::memchr(p, '\n', end - p));
+    if (!eol) {
+      eol = end;
+    }
+    auto line_end = (eol > p && eol[-1] == '\r') ? eol - 1 : eol;
+    if (p == line_end) {
+      // Blank line.
+      p = eol + 1;
+      continue;
+    }
+
+    std::size_t n_in_row{0};
+    std::int32_t column{0};
+    std::uint32_t out_idx{0};
+    char const* q = p;
+    while (true) {
+      auto comma = static_cast<char const*>(std::memchr(q, ',', line_end - q));
+      char const* field_end = comma ? comma : line_end;
+      while (q < field_end && (*q == ' ' || *q == '\t')) {
+        ++q;
+      }
+      float v;
+      auto ret = from_chars(q, field_end, v);
+      bool valid = ret.ec == std::errc{} && !std::isnan(v);
+      if (column == label_column_) {
+        arena.label.push_back(valid ? v : 0.0f);
+      } else {
+        if (valid) {
+          arena.index.push_back(out_idx);
+          arena.value.push_back(v);
+          ++n_in_row;
+        }
+        ++out_idx;
+      }
+      ++column;
+      if (!comma) {
+        break;
+      }
+      q = comma + 1;
+    }
+    if (label_column_ >= column) {
+      // Short row without the label column.
+      arena.label.push_back(0.0f);
+    }
+    arena.row_size.push_back(n_in_row);
+    p = eol + 1;
+  }
+}
+
+bool CSVParser::Next() {
+  if (cur_ >= end_) {
+    return false;
+  }
+  auto base = data_->DataAs<char>();
+  auto chunk_end = std::min(cur_ + chunk_bytes_, end_);
+  // Finish the line crossing the chunk boundary.
+  chunk_end = AlignToLine(base, chunk_end, end_);
+
+  // Split the chunk at line boundaries, one range per thread.
+  std::vector<std::size_t> bounds{cur_};
+  for (std::int32_t t = 1; t < n_threads_; ++t) {
+    auto nominal = std::max(cur_ + (chunk_end - cur_) / n_threads_ * t, bounds.back());
+    bounds.push_back(AlignToLine(base, nominal, chunk_end));
+  }
+  bounds.push_back(chunk_end);
+
+  arenas_.resize(n_threads_);
+  common::ParallelFor(static_cast<std::size_t>(n_threads_), n_threads_, [&](auto t) {
+    arenas_[t].Clear();
+    this->ParseRange(base + bounds[t], base + bounds[t + 1], &arenas_[t]);
+  });
+
+  // Stitch the arenas into one batch.
+  std::size_t n_rows{0}, nnz{0};
+  for (auto const& a : arenas_) {
+    n_rows += a.row_size.size();
+    nnz += a.index.size();
+  }
+  offset_.resize(n_rows + 1);
+  index_.resize(nnz);
+  value_.resize(nnz);
+  label_.resize(label_column_ >= 0 ? n_rows : 0);
+
+  offset_[0] = 0;
+  std::size_t row{0}, ent{0};
+  for (auto const& a : arenas_) {
+    if (label_column_ >= 0) {
+      std::copy(a.label.cbegin(), a.label.cend(), label_.begin() + row);
+    }
+    for (auto sz : a.row_size) {
+      offset_[row + 1] = offset_[row] + sz;
+      ++row;
+    }
+    std::copy(a.index.cbegin(), a.index.cend(), index_.begin() + ent);
+    std::copy(a.value.cbegin(), a.value.cend(), value_.begin() + ent);
+    ent += a.index.size();
+  }
+
+  block_.size = n_rows;
+  block_.offset = offset_.data();
+  block_.label = label_column_ >= 0 ? label_.data() : nullptr;
+  block_.weight = nullptr;
+  block_.qid = nullptr;
+  block_.field = nullptr;
+  block_.index = index_.data();
+  block_.value = value_.data();
+
+  bytes_read_ += chunk_end - cur_;
+  cur_ = chunk_end;
+  return true;
+}
+
+std::unique_ptr<dmlc::Parser<std::uint32_t>> CreateTextParser(std::string const& uri,
+                                                              std::uint32_t part_idx,
+                                                              std::uint32_t n_parts) {
+  // The URI has been through `ValidateFileFormat`: path?key=value[&...][#cache].
+  auto no_cache = common::Split(uri, '#')[0];
+  auto name_args = common::Split(no_cache, '?');
+  auto const& path = name_args[0];
+
+  std::string format;
+  std::int32_t label_column{-1};
+  bool known_args = true;
+  if (name_args.size() == 2) {
+    for (auto const& kv : common::Split(name_args[1], '&')) {
+      auto arg = common::Split(kv, '=');
+      if (arg.size() != 2) {
+        continue;
+      }
+      if (arg[0] == "format") {
+        format = arg[1];
+      } else if (arg[0] == "label_column") {
+        label_column = std::stoi(arg[1]);
+      } else {
+        // Argument only the dmlc parsers understand, e.g. weight_column.
+        known_args = false;
+      }
+    }
+  }
+
+  bool local = path.find("://") == std::string::npos;
+  bool compressed = path.size() >= 3 && path.compare(path.size() - 3, 3, ".gz") == 0;
+  if (format == "csv" && known_args && local && !compressed) {
+    return std::make_unique<CSVParser>(path, label_column, part_idx, n_parts);
+  }
+  return std::unique_ptr<dmlc::Parser<std::uint32_t>>{
+      dmlc::Parser<std::uint32_t>::Create(uri.c_str(), part_idx, n_parts, "auto")};
+}
+}  // namespace xgboost::data
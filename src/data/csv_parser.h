@@ -0,0 +1,98 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ *
+ * @brief Parallel CSV parser for local files, a drop-in replacement for the
+ *        single-threaded dmlc text parser.
+ */
+#ifndef XGBOOST_DATA_CSV_PARSER_H_
+#define XGBOOST_DATA_CSV_PARSER_H_
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int32_t, uint32_t
+#include <memory>   // for unique_ptr
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "../common/io.h"  // for MmapResource
+#include "dmlc/data.h"     // for Parser, RowBlock
+
+namespace xgboost::data {
+/**
+ * @brief Parser for plain CSV files implementing the `dmlc::Parser` interface.
+ *
+ * The file is memory-mapped and consumed in fixed-size chunks.  Each chunk is split at
+ * line boundaries into one range per thread, parsed into per-thread arenas that are
+ * reused across chunks, then stitched into a single `dmlc::RowBlock`.  Delimiter
+ * scanning goes through `memchr`, which the C library vectorizes.
+ *
+ * Only numeric fields are supported.  Fields that fail to parse, including empty ones
+ * and explicit `nan`, are treated as missing values and dropped from the row.
+ */
+class CSVParser : public dmlc::Parser<std::uint32_t> {
+  // Storage for one thread's share of a chunk.
+  struct Arena {
+    std::vector<std::size_t> row_size;
+    std::vector<std::uint32_t> index;
+    std::vector<float> value;
+    std::vector<float> label;
+
+    void Clear() {
+      row_size.clear();
+      index.clear();
+      value.clear();
+      label.clear();
+    }
+  };
+
+  std::unique_ptr<common::MmapResource> data_;
+  // Line-aligned boundaries of this worker's partition, and the read cursor.
+  std::size_t begin_{0};
+  std::size_t end_{0};
+  std::size_t cur_{0};
+  std::size_t bytes_read_{0};
+  std::size_t chunk_bytes_;
+  std::int32_t label_column_;
+  std::int32_t n_threads_;
+
+  std::vector<Arena> arenas_;
+  // The stitched batch, referenced by the row block.
+  std::vector<std::size_t> offset_;
+  std::vector<std::uint32_t> index_;
+  std::vector<float> value_;
+  std::vector<float> label_;
+  dmlc::RowBlock<std::uint32_t> block_;
+
+  void ParseRange(char const* begin, char const* end, Arena* p_arena) const;
+
+ public:
+  // Bytes consumed by one call to Next, before extending to the line boundary.
+  constexpr static std::size_t DefaultChunkBytes() { return 32UL << 20; }
+
+  /**
+   * @param path         Path to the file, without URI arguments.
+   * @param label_column Column to use as the label, -1 for none.
+   * @param part_idx     Partition assigned to this worker, as with the dmlc parsers.
+   * @param n_parts      Total number of partitions.
+   * @param chunk_bytes  Batch granularity, exposed for testing.
+   */
+  CSVParser(std::string const& path, std::int32_t label_column, std::uint32_t part_idx,
+            std::uint32_t n_parts, std::size_t chunk_bytes = DefaultChunkBytes());
+
+  bool Next() override;
+  void BeforeFirst() override { cur_ = begin_; }
+  [[nodiscard]] dmlc::RowBlock<std::uint32_t> const& Value() const override { return block_; }
+  [[nodiscard]] std::size_t BytesRead() const override { return bytes_read_; }
+};
+
+/**
+ * @brief Create a parser for a validated text file URI.
+ *
+ *   Dispatches to @ref CSVParser for plain local CSV files and falls back to
+ *   `dmlc::Parser::Create` otherwise (libsvm, compressed input, remote filesystems, or
+ *   URI arguments the built-in parser does not know about).
+ */
+std::unique_ptr<dmlc::Parser<std::uint32_t>> CreateTextParser(std::string const& uri,
+                                                              std::uint32_t part_idx,
+                                                              std::uint32_t n_parts);
+}  // namespace xgboost::data
+#endif  // XGBOOST_DATA_CSV_PARSER_H_
@@ -14,6 +14,7 @@
 #include <iostream>     // for operator<<, basic_ostream, basic_ostream::op...
 #include <map>          // for map, operator!=
 #include <numeric>      // for accumulate, partial_sum
+#include <random>       // for mt19937_64, shuffle
 #include <tuple>        // for get, apply
 #include <type_traits>  // for remove_pointer_t, remove_reference
 
@@ -36,6 +37,7 @@
 #include "./sparse_page_dmatrix.h"            // for SparsePageDMatrix
 #include "array_interface.h"                  // for ArrayInterfaceHandler, ArrayInterface, Dispa...
 #include "batch_utils.h"                      // for MatchingPageBytes
+#include "csv_parser.h"                       // for CreateTextParser
 #include "dmlc/base.h"                        // for BeginPtr
 #include "dmlc/common.h"                      // for OMPException
 #include "dmlc/data.h"                        // for Parser
@@ -206,6 +208,8 @@ void MetaInfo::Clear() {
   group_ptr_.clear();
   weights_.HostVector().clear();
   base_margin_ = decltype(base_margin_){};
+  label_validated_cache_.clear();
+  uniform_weight_cache_ = -1;
 }
 
 /*
@@ -280,8 +284,10 @@ void MetaInfo::SaveBinary(dmlc::Stream *fo) const {
     } else if (elem == "c") {
       types->emplace_back(FeatureType::kCategorical);
       has_cat = true;
+    } else if (elem == "b") {
+      types->emplace_back(FeatureType::kPreBinned);
     } else {
-      LOG(FATAL) << "All feature_types must be one of {int, float, i, q, c}.";
+      LOG(FATAL) << "All feature_types must be one of {int, float, i, q, c, b}.";
     }
   }
   return has_cat;
@@ -300,6 +306,24 @@ const std::vector<size_t>& MetaInfo::LabelAbsSort(Context const* ctx) const {
   return label_order_cache_;
 }
 
+bool MetaInfo::LabelsValidatedBy(char const* name) const {
+  return label_validated_cache_.find(name) != label_validated_cache_.cend();
+}
+
+void MetaInfo::SetLabelsValidatedBy(char const* name) const {
+  label_validated_cache_.emplace(name);
+}
+
+bool MetaInfo::IsUniformWeights() const {
+  if (uniform_weight_cache_ < 0) {
+    auto const& h_weights = this->weights_.ConstHostVector();
+    uniform_weight_cache_ =
+        h_weights.empty() || std::all_of(h_weights.cbegin(), h_weights.cend(),
+                                         [&](float w) { return w == h_weights.front(); });
+  }
+  return uniform_weight_cache_ == 1;
+}
+
 void MetaInfo::LoadBinary(dmlc::Stream *fi) {
   auto version = Version::Load(fi);
   auto major = std::get<0>(version);
@@ -341,6 +365,7 @@ void MetaInfo::LoadBinary(dmlc::Stream *fi) {
   LoadTensorField(fi, u8"labels", DataType::kFloat32, &labels);
   LoadVectorField(fi, u8"group_ptr", DataType::kUInt32, &group_ptr_);
   LoadVectorField(fi, u8"weights", DataType::kFloat32, &weights_);
+  uniform_weight_cache_ = -1;
   LoadTensorField(fi, u8"base_margin", DataType::kFloat32, &base_margin_);
   LoadVectorField(fi, u8"labels_lower_bound", DataType::kFloat32, &labels_lower_bound_);
   LoadVectorField(fi, u8"labels_upper_bound", DataType::kFloat32, &labels_upper_bound_);
@@ -350,6 +375,7 @@ void MetaInfo::LoadBinary(dmlc::Stream *fi) {
   LoadVectorField(fi, u8"feature_weights", DataType::kFloat32, &feature_weights);
 
   this->has_categorical_ = LoadFeatureType(feature_type_names, &feature_types.HostVector());
+  label_validated_cache_.clear();
 }
 
 namespace {
@@ -406,6 +432,9 @@ MetaInfo MetaInfo::Slice(Context const* ctx, common::Span<bst_idx_t const> ridxs
 
   out.feature_type_names = this->feature_type_names;
 
+  // The categorical dictionary is row-independent, share it with the slice.
+  out.cat_dict = this->cat_dict;
+
   /**
    * Sample Info
    */
@@ -513,6 +542,14 @@ void MetaInfo::SetInfo(Context const& ctx, StringView key, StringView interface_
     is_cuda = first.find("stream") != first.cend() || ArrayInterfaceHandler::IsCudaPtr(ptr);
   }
 
+  if (key == "label") {
+    // The new labels have not been seen by any validation pass yet.
+    label_validated_cache_.clear();
+  }
+  if (key == "weight") {
+    // The cached uniformity check does not cover the new weights.
+    uniform_weight_cache_ = -1;
+  }
   if (is_cuda) {
     this->SetInfoFromCUDA(&ctx, key, j_interface);
   } else {
@@ -711,9 +748,11 @@ void MetaInfo::Extend(MetaInfo const& that, bool accumulate_rows, bool check_col
    * info with n_samples
    */
   linalg::Stack(&this->labels, that.labels);
+  label_validated_cache_.clear();
 
   this->weights_.SetDevice(that.weights_.Device());
   this->weights_.Extend(that.weights_);
+  uniform_weight_cache_ = -1;
 
   this->labels_lower_bound_.SetDevice(that.labels_lower_bound_.Device());
   this->labels_lower_bound_.Extend(that.labels_lower_bound_);
@@ -766,6 +805,11 @@ void MetaInfo::Extend(MetaInfo const& that, bool accumulate_rows, bool check_col
     this->feature_weights.SetDevice(that.feature_weights.Device());
     this->feature_weights.Copy(that.feature_weights);
   }
+
+  if (!this->cat_dict && that.cat_dict) {
+    // The dictionary is shared so every batch is encoded with the same mapping.
+    this->cat_dict = that.cat_dict;
+  }
 }
 
 void MetaInfo::SynchronizeNumberOfColumns(Context const* ctx) {
@@ -910,8 +954,7 @@ DMatrix* DMatrix::Load(const std::string& uri, bool silent, DataSplitMode data_s
 
   if (cache_file.empty()) {
     fname = data::ValidateFileFormat(fname);
-    std::unique_ptr<dmlc::Parser<std::uint32_t>> parser(
-        dmlc::Parser<std::uint32_t>::Create(fname.c_str(), partid, npart, "auto"));
+    auto parser = data::CreateTextParser(fname, partid, npart);
     data::FileAdapter adapter(parser.get());
     dmat = DMatrix::Create(&adapter, std::numeric_limits<float>::quiet_NaN(), Context{}.Threads(),
                            cache_file, data_split_mode);
@@ -924,7 +967,9 @@ DMatrix* DMatrix::Load(const std::string& uri, bool silent, DataSplitMode data_s
                                cuda_impl::MatchingPageBytes(),
                                std::numeric_limits<float>::quiet_NaN(),
                                cuda_impl::MaxNumDevicePages(),
-                               1};
+                               1,
+                               /*n_prefetch_batches=*/0,
+                               /*persist_cache=*/false};
     dmat = new data::SparsePageDMatrix{&iter, iter.Proxy(), data::fileiter::Reset,
                                        data::fileiter::Next, config};
   }
@@ -1004,6 +1049,65 @@ template DMatrix* DMatrix::Create(
     float missing, int nthread, const std::string& cache_prefix, DataSplitMode data_split_mode);
 
 SparsePage SparsePage::GetTranspose(int num_columns, int32_t n_threads) const {
+  SparsePage transpose;
+  auto& offset_vec = transpose.offset.HostVector();
+  auto& data_vec = transpose.data.HostVector();
+  long batch_size = static_cast<long>(this->Size());  // NOLINT(*)
+  auto page = this->GetView();
+
+  // Two-pass parallel counting sort.  Both passes rely on the deterministic static
+  // partition of `ParallelFor` so each thread revisits the rows it counted.
+  std::vector<std::vector<bst_idx_t>> counts_tloc(n_threads);
+  for (auto& counts : counts_tloc) {
+    counts.assign(num_columns, 0);
+  }
+  common::ParallelFor(batch_size, n_threads, [&](long i) {  // NOLINT(*)
+    auto& counts = counts_tloc[omp_get_thread_num()];
+    for (auto const& entry : page[i]) {
+      ++counts[entry.index];
+    }
+  });
+
+  // Column pointers from the combined histogram, then per-thread write cursors so the
+  // scatter needs no synchronization.
+  offset_vec.resize(num_columns + 1, 0);
+  common::ParallelFor(num_columns, n_threads, [&](auto cidx) {
+    bst_idx_t n{0};
+    for (auto const& counts : counts_tloc) {
+      n += counts[cidx];
+    }
+    offset_vec[cidx + 1] = n;
+  });
+  std::partial_sum(offset_vec.cbegin(), offset_vec.cend(), offset_vec.begin());
+  common::ParallelFor(num_columns, n_threads, [&](auto cidx) {
+    auto cursor = offset_vec[cidx];
+    for (auto& counts : counts_tloc) {
+      auto n = counts[cidx];
+      counts[cidx] = cursor;
+      cursor += n;
+    }
+  });
+
+  data_vec.resize(offset_vec.back());
+  common::ParallelFor(batch_size, n_threads, [&](long i) {  // NOLINT(*)
+    auto& cursor = counts_tloc[omp_get_thread_num()];
+    for (auto const& entry : page[i]) {
+      data_vec[cursor[entry.index]++] =
+          Entry(static_cast<bst_uint>(this->base_rowid + i), entry.fvalue);
+    }
+  });
+
+  CHECK_EQ(transpose.offset.Size(), num_columns + 1);
+  return transpose;
+}
+
+SparsePage SparsePage::GetTranspose(int num_columns, int32_t n_threads,
+                                    common::Span<bst_feature_t const> selected) const {
+  std::vector<bool> is_selected(num_columns, false);
+  for (auto fidx : selected) {
+    is_selected.at(fidx) = true;
+  }
+
   SparsePage transpose;
   common::ParallelGroupBuilder<Entry, bst_idx_t> builder(&transpose.offset.HostVector(),
                                                          &transpose.data.HostVector());
@@ -1014,7 +1118,9 @@ SparsePage SparsePage::GetTranspose(int num_columns, int32_t n_threads) const {
     int tid = omp_get_thread_num();
     auto inst = page[i];
     for (const auto& entry : inst) {
-      builder.AddBudget(entry.index, tid);
+      if (is_selected[entry.index]) {
+        builder.AddBudget(entry.index, tid);
+      }
     }
   });
   builder.InitStorage();
@@ -1022,10 +1128,10 @@ SparsePage SparsePage::GetTranspose(int num_columns, int32_t n_threads) const {
     int tid = omp_get_thread_num();
     auto inst = page[i];
     for (const auto& entry : inst) {
-      builder.Push(
-          entry.index,
-          Entry(static_cast<bst_uint>(this->base_rowid + i), entry.fvalue),
-          tid);
+      if (is_selected[entry.index]) {
+        builder.Push(entry.index, Entry(static_cast<bst_uint>(this->base_rowid + i), entry.fvalue),
+                     tid);
+      }
     }
   });
 
@@ -1075,13 +1181,40 @@ void SparsePage::Reindex(uint64_t feature_offset, int32_t n_threads) {
 void SparsePage::SortRows(int32_t n_threads) {
   auto& h_offset = this->offset.HostVector();
   auto& h_data = this->data.HostVector();
-  common::ParallelFor(this->Size(), n_threads, [&](auto i) {
+  // Guided scheduling, the segment sizes are heavily skewed when sorting the columns of
+  // a transposed page (dense columns next to nearly empty ones).
+  common::ParallelFor(this->Size(), n_threads, common::Sched::Guided(), [&](auto i) {
     if (h_offset[i] < h_offset[i + 1]) {
       std::sort(h_data.begin() + h_offset[i], h_data.begin() + h_offset[i + 1], Entry::CmpValue);
     }
   });
 }
 
+void SparsePage::ShuffleRows(std::uint64_t seed, int32_t n_threads) {
+  auto& h_offset = this->offset.HostVector();
+  auto& h_data = this->data.HostVector();
+  auto n_rows = this->Size();
+
+  std::vector<bst_idx_t> order(n_rows);
+  std::iota(order.begin(), order.end(), 0);
+  std::mt19937_64 rng{seed};
+  std::shuffle(order.begin(), order.end(), rng);
+
+  std::vector<bst_idx_t> new_offset(h_offset.size());
+  new_offset[0] = 0;
+  for (std::size_t i = 0; i < n_rows; ++i) {
+    new_offset[i + 1] = new_offset[i] + (h_offset[order[i] + 1] - h_offset[order[i]]);
+  }
+  std::vector<Entry> new_data(h_data.size());
+  common::ParallelFor(n_rows, n_threads, [&](auto i) {
+    std::copy(h_data.cbegin() + h_offset[order[i]], h_data.cbegin() + h_offset[order[i] + 1],
+              new_data.begin() + new_offset[i]);
+  });
+
+  h_offset = std::move(new_offset);
+  h_data = std::move(new_data);
+}
+
 void SparsePage::Push(const SparsePage &batch) {
   auto& data_vec = data.HostVector();
   auto& offset_vec = offset.HostVector();
@@ -1100,6 +1233,147 @@ void SparsePage::Push(const SparsePage &batch) {
   }
 }
 
+namespace {
+/**
+ * \brief Specialized conversion for CSR inputs.
+ *
+ *  Row lengths are known from the row pointer and the index/value dtypes are dispatched
+ *  once per batch, so the page is filled with tight typed loops instead of the
+ *  element-wise type dispatch of the generic adapter path.
+ */
+std::uint64_t PushCSRBatch(data::CSRArrayAdapterBatch const& batch, float missing, int nthread,
+                           SparsePage* page) {
+  auto& offset_vec = page->offset.HostVector();
+  auto& data_vec = page->data.HostVector();
+  std::size_t n_rows = batch.Size();
+  std::uint64_t max_columns = 0;
+  if (n_rows == 0) {
+    return max_columns;
+  }
+
+  common::ParallelGroupBuilder<Entry, std::remove_reference<decltype(offset_vec)>::type::value_type,
+                               true>
+      builder(&offset_vec, &data_vec, page->Size());
+  builder.InitBudget(n_rows, nthread);
+
+  auto indptr = TypedIndex<std::size_t, 1>{batch.Indptr()};
+  auto is_valid = data::IsValidFunctor{missing};
+  std::size_t const thread_size = n_rows / nthread;
+  std::vector<std::uint64_t> max_columns_vector(nthread, 0);
+  std::atomic<bool> valid{true};
+  dmlc::OMPException exec;
+
+  DispatchDType(batch.Indices(), DeviceOrd::CPU(), [&](auto&& indices) {
+    DispatchDType(batch.Values(), DeviceOrd::CPU(), [&](auto&& values) {
+      // First pass over the batch, count the valid elements in each row.
+#pragma omp parallel num_threads(nthread)
+      {
+        exec.Run([&] {
+          int tid = omp_get_thread_num();
+          std::size_t begin = tid * thread_size;
+          std::size_t end = tid != (nthread - 1) ? (tid + 1) * thread_size : n_rows;
+          auto& max_columns_local = max_columns_vector[tid];
+          for (std::size_t i = begin; i < end; ++i) {
+            std::size_t n_valid = 0;
+            for (std::size_t j = indptr(i), last = indptr(i + 1); j < last; ++j) {
+              auto fvalue = static_cast<float>(values(j));
+              if (!std::isinf(missing) && std::isinf(fvalue)) {
+                valid = false;
+              }
+              max_columns_local =
+                  std::max(max_columns_local, static_cast<std::uint64_t>(indices(j)) + 1);
+              if (is_valid(fvalue)) {
+                ++n_valid;
+              }
+            }
+            builder.AddBudget(i, tid, n_valid);
+          }
+        });
+      }
+      exec.Rethrow();
+      CHECK(valid) << error::InfInData();
+
+      builder.InitStorage();
+      // Second pass over the batch, place the elements.
+#pragma omp parallel num_threads(nthread)
+      {
+        exec.Run([&] {
+          int tid = omp_get_thread_num();
+          std::size_t begin = tid * thread_size;
+          std::size_t end = tid != (nthread - 1) ? (tid + 1) * thread_size : n_rows;
+          for (std::size_t i = begin; i < end; ++i) {
+            for (std::size_t j = indptr(i), last = indptr(i + 1); j < last; ++j) {
+              auto fvalue = static_cast<float>(values(j));
+              if (is_valid(fvalue)) {
+                builder.Push(i, Entry(static_cast<bst_feature_t>(indices(j)), fvalue), tid);
+              }
+            }
+          }
+        });
+      }
+      exec.Rethrow();
+    });
+  });
+
+  for (auto m : max_columns_vector) {
+    max_columns = std::max(max_columns, m);
+  }
+  return max_columns;
+}
+
+/**
+ * \brief Specialized conversion for dense array inputs.
+ *
+ *  The dtype is dispatched once per batch, after which each row is read through a typed
+ *  strided view.  Since the number of columns bounds every row, the valid counts can go
+ *  straight into the page offsets and the group builder is not needed.
+ */
+std::uint64_t PushArrayBatch(data::ArrayAdapterBatch const& batch, float missing, int nthread,
+                             SparsePage* page) {
+  auto& offset_vec = page->offset.HostVector();
+  auto& data_vec = page->data.HostVector();
+  std::size_t n_rows = batch.NumRows();
+  std::size_t n_cols = batch.NumCols();
+  if (n_rows == 0) {
+    return 0;
+  }
+
+  auto is_valid = data::IsValidFunctor{missing};
+  std::atomic<bool> valid{true};
+
+  DispatchDType(batch.Array(), DeviceOrd::CPU(), [&](auto&& values) {
+    // First pass over the batch, count the valid elements of each row.
+    offset_vec.resize(n_rows + 1, 0);
+    common::ParallelFor(n_rows, nthread, [&](auto i) {
+      std::size_t n_valid = 0;
+      for (std::size_t j = 0; j < n_cols; ++j) {
+        auto fvalue = static_cast<float>(values(i, j));
+        if (!std::isinf(missing) && std::isinf(fvalue)) {
+          valid = false;
+        }
+        n_valid += is_valid(fvalue);
+      }
+      offset_vec[i + 1] = n_valid;
+    });
+    CHECK(valid) << error::InfInData();
+    std::partial_sum(offset_vec.cbegin(), offset_vec.cend(), offset_vec.begin());
+
+    // Second pass over the batch, place the elements.
+    data_vec.resize(offset_vec.back());
+    common::ParallelFor(n_rows, nthread, [&](auto i) {
+      auto* out = data_vec.data() + offset_vec[i];
+      for (std::size_t j = 0; j < n_cols; ++j) {
+        auto fvalue = static_cast<float>(values(i, j));
+        if (is_valid(fvalue)) {
+          *out++ = Entry{static_cast<bst_feature_t>(j), fvalue};
+        }
+      }
+    });
+  });
+  return n_cols;
+}
+}  // anonymous namespace
+
 template <typename AdapterBatchT>
 uint64_t SparsePage::Push(const AdapterBatchT& batch, float missing, int nthread) {
   constexpr bool kIsRowMajor = AdapterBatchT::kIsRowMajor;
@@ -1108,6 +1382,18 @@ uint64_t SparsePage::Push(const AdapterBatchT& batch, float missing, int nthread
   if (!kIsRowMajor) {
     CHECK_EQ(nthread, 1);
   }
+  if constexpr (std::is_same_v<AdapterBatchT, data::CSRArrayAdapterBatch>) {
+    // The masked and appending cases fall through to the generic path.
+    if (this->Size() == 0 && this->base_rowid == 0 && batch.Indices().valid.Capacity() == 0 &&
+        batch.Values().valid.Capacity() == 0) {
+      return PushCSRBatch(batch, missing, nthread, this);
+    }
+  }
+  if constexpr (std::is_same_v<AdapterBatchT, data::ArrayAdapterBatch>) {
+    if (this->Size() == 0 && this->base_rowid == 0 && batch.Array().valid.Capacity() == 0) {
+      return PushArrayBatch(batch, missing, nthread, this);
+    }
+  }
   auto& offset_vec = offset.HostVector();
   auto& data_vec = data.HostVector();
 
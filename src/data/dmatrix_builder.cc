@@ -0,0 +1,77 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#include "dmatrix_builder.h"
+
+#include <cstdint>  // for uint32_t, uint64_t
+#include <utility>  // for move
+
+#include "xgboost/linalg.h"   // for ArrayInterfaceStr, MakeVec
+#include "xgboost/logging.h"  // for CHECK, CHECK_EQ
+
+namespace xgboost::data {
+void DMatrixBuilder::PushColumn(DataType type, void const* data, bst_idx_t n) {
+  CHECK(data);
+  CHECK(type == DataType::kFloat32 || type == DataType::kDouble || type == DataType::kUInt32 ||
+        type == DataType::kUInt64)
+      << "Invalid column type.";
+  if (!staging_.empty()) {
+    CHECK_EQ(n, staging_.front().size) << "Columns of a batch must have the same length.";
+  }
+  staging_.push_back(Column{type, data, n});
+}
+
+void DMatrixBuilder::CommitBatch() {
+  CHECK(!staging_.empty()) << "Empty batch.";
+  if (!batches_.empty()) {
+    auto const& first = batches_.front();
+    CHECK_EQ(staging_.size(), first.size()) << "Batches must have the same number of columns.";
+    for (std::size_t i = 0; i < staging_.size(); ++i) {
+      CHECK(staging_[i].type == first[i].type) << "Batches must have the same column types.";
+    }
+  }
+  batches_.push_back(std::move(staging_));
+  staging_.clear();
+}
+
+int DMatrixBuilder::Next() {
+  if (it_ == batches_.size()) {
+    return false;
+  }
+  auto const& batch = batches_[it_++];
+
+  // The data itself aliases the caller's chunks, only the metadata is re-encoded for the
+  // columnar adapter.
+  columns_interface_ = "[";
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    auto const& col = batch[i];
+    switch (col.type) {
+      case DataType::kFloat32:
+        columns_interface_ += linalg::ArrayInterfaceStr(
+            linalg::MakeVec(static_cast<float const*>(col.data), col.size));
+        break;
+      case DataType::kDouble:
+        columns_interface_ += linalg::ArrayInterfaceStr(
+            linalg::MakeVec(static_cast<double const*>(col.data), col.size));
+        break;
+      case DataType::kUInt32:
+        columns_interface_ += linalg::ArrayInterfaceStr(
+            linalg::MakeVec(static_cast<std::uint32_t const*>(col.data), col.size));
+        break;
+      case DataType::kUInt64:
+        columns_interface_ += linalg::ArrayInterfaceStr(
+            linalg::MakeVec(static_cast<std::uint64_t const*>(col.data), col.size));
+        break;
+      default:
+        LOG(FATAL) << "Invalid column type.";
+    }
+    if (i + 1 != batch.size()) {
+      columns_interface_ += ",";
+    }
+  }
+  columns_interface_ += "]";
+
+  XGProxyDMatrixSetDataColumnar(proxy_, columns_interface_.c_str());
+  return true;
+}
+}  // namespace xgboost::data
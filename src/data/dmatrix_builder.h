@@ -0,0 +1,69 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#ifndef XGBOOST_DATA_DMATRIX_BUILDER_H_
+#define XGBOOST_DATA_DMATRIX_BUILDER_H_
+
+#include <cstddef>  // for size_t
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "xgboost/base.h"   // for bst_idx_t
+#include "xgboost/c_api.h"  // for XGDMatrixFree, XGProxyDMatrixCreate
+#include "xgboost/data.h"   // for DataType
+
+namespace xgboost::data {
+/**
+ * @brief Staging area for the push-style `QuantileDMatrix` construction.
+ *
+ * The caller appends typed column chunks that alias its own memory and commits them as
+ * batches; the builder then drives the usual data iterator interface over the recorded
+ * batches so that the quantile sketching consumes them without an intermediate copy.
+ * The appended memory must stay valid until the `DMatrix` has been constructed.
+ */
+class DMatrixBuilder {
+  struct Column {
+    DataType type;
+    void const* data;
+    bst_idx_t size;
+  };
+
+  // Columns of the batch currently being assembled, and the committed batches.
+  std::vector<Column> staging_;
+  std::vector<std::vector<Column>> batches_;
+  std::size_t it_{0};
+
+  DMatrixHandle proxy_;
+  // Storage for the array interface strings of the staged batch.
+  std::string columns_interface_;
+
+ public:
+  DMatrixBuilder() { XGProxyDMatrixCreate(&proxy_); }
+  ~DMatrixBuilder() { XGDMatrixFree(proxy_); }
+
+  DMatrixBuilder(DMatrixBuilder const&) = delete;
+  DMatrixBuilder& operator=(DMatrixBuilder const&) = delete;
+
+  /**
+   * @brief Append the next column of the batch under assembly.  Columns are positional,
+   *        the first appended column is feature 0.
+   */
+  void PushColumn(DataType type, void const* data, bst_idx_t n);
+  /**
+   * @brief Seal the batch under assembly.  All batches must share the same schema.
+   */
+  void CommitBatch();
+
+  auto Proxy() -> decltype(proxy_) { return proxy_; }
+
+  int Next();
+  void Reset() { it_ = 0; }
+};
+
+namespace builderiter {
+inline void Reset(DataIterHandle self) { static_cast<DMatrixBuilder*>(self)->Reset(); }
+
+inline int Next(DataIterHandle self) { return static_cast<DMatrixBuilder*>(self)->Next(); }
+}  // namespace builderiter
+}  // namespace xgboost::data
+#endif  // XGBOOST_DATA_DMATRIX_BUILDER_H_
@@ -53,6 +53,12 @@ bst_idx_t EllpackPage::Size() const {
                 "EllpackPage is required";
   return 0;
 }
+
+[[nodiscard]] std::size_t EllpackPage::MemCostBytes() const {
+  LOG(FATAL) << "Internal Error: XGBoost is not compiled with CUDA but "
+                "EllpackPage is required";
+  return 0;
+}
 }  // namespace xgboost
 
 #endif  // XGBOOST_USE_CUDA
@@ -24,6 +24,7 @@
 #include "gradient_index.h"                 // for GHistIndexMatrix
 #include "xgboost/context.h"                // for Context
 #include "xgboost/data.h"                   // for DMatrix
+#include "xgboost/global_config.h"          // for GlobalConfigThreadLocalStore
 
 namespace xgboost {
 EllpackPage::EllpackPage() : impl_{new EllpackPageImpl{}} {}
@@ -46,6 +47,8 @@ void EllpackPage::SetBaseRowId(std::size_t row_id) { impl_->SetBaseRowId(row_id)
 
 [[nodiscard]] bst_idx_t EllpackPage::BaseRowId() const { return this->Impl()->base_rowid; }
 
+[[nodiscard]] std::size_t EllpackPage::MemCostBytes() const { return this->Impl()->MemCostBytes(); }
+
 // Bin each input data entry, store the bin indices in compressed form.
 template <bool HasNoMissing, bool kDenseCompressed>
 __global__ void CompressBinEllpackKernel(
@@ -57,7 +60,7 @@ __global__ void CompressBinEllpackKernel(
     const uint32_t* __restrict__ cut_ptrs,         // HistogramCuts::cut_ptrs_
     common::Span<FeatureType const> feature_types,
     size_t base_row,  // batch_row_begin
-    size_t n_rows, size_t row_stride, std::uint32_t null_gidx_value) {
+    size_t n_rows, size_t row_stride, bst_idx_t tile_rows, std::uint32_t null_gidx_value) {
   auto irow = threadIdx.x + blockIdx.x * blockDim.x;
   auto cpr_fidx = threadIdx.y + blockIdx.y * blockDim.y;  // compressed fidx
   if (irow >= n_rows || cpr_fidx >= row_stride) {
@@ -77,7 +80,8 @@ __global__ void CompressBinEllpackKernel(
     auto it_end = it + thrust::distance(row_beg, row_end);
     auto res_it = thrust::lower_bound(thrust::seq, it, it_end, cpr_fidx);
     if (res_it == it_end || cpr_fidx != *res_it) {
-      wr.AtomicWriteSymbol(buffer, bin, (irow + base_row) * row_stride + cpr_fidx);
+      wr.AtomicWriteSymbol(buffer, bin,
+                           EllpackEntryIdx(irow + base_row, cpr_fidx, row_stride, tile_rows));
       return;
     }
     cpr_fidx = thrust::distance(it, res_it);
@@ -124,13 +128,23 @@ __global__ void CompressBinEllpackKernel(
     }
   }
   // Write to the gidx buffer for non-missing values.
-  wr.AtomicWriteSymbol(buffer, bin, (irow + base_row) * row_stride + cpr_fidx);
+  wr.AtomicWriteSymbol(buffer, bin, EllpackEntryIdx(irow + base_row, cpr_fidx, row_stride,
+                                                    tile_rows));
 }
 
 // Calculate the number of symbols for the compressed ellpack. Similar to what the CPU
 // implementation does, we compress the dense data by subtracting the bin values with the
 // starting bin of its feature if it's dense. In addition, we treat the data as dense if
 // there's no compression to be made by using ellpack.
+//
+// The symbol width is uniform across features, sized by the feature with the most bins.
+// Per-feature widths would shrink the buffer further when a few high-cardinality
+// features dominate, but they break the property that element (ridx, fidx) lives at bit
+// `(ridx * row_stride + fidx) * symbol_bits`: every consumer of `gidx_iter` (histogram
+// kernels, the gradient index conversion, page copy/compaction and the external memory
+// splice) indexes the buffer linearly, and a variable-width row would need a per-feature
+// bit-offset table on the hot decode path. Until profiling shows the extra indirection
+// pays for itself, widths stay uniform.
 [[nodiscard]] EllpackPageImpl::Info CalcNumSymbols(
     Context const* ctx, bst_idx_t row_stride, bool is_dense,
     std::shared_ptr<common::HistogramCuts const> cuts) {
@@ -160,16 +174,21 @@ __global__ void CompressBinEllpackKernel(
   dh::safe_cuda(cudaMemcpyAsync(&n_symbols_dense, d_me, sizeof(PtrT), cudaMemcpyDeviceToHost,
                                 cuctx->Stream()));
   cuctx->Stream().Sync();
-  // Decide the type of the data.
+  // Decide the type of the data.  The tiled layout only applies to dense compressed
+  // pages; the sparse format needs the row-major order for its binary search.
+  bst_idx_t tile_rows = GlobalConfigThreadLocalStore::Get()->use_ellpack_tiles
+                            ? EllpackDeviceAccessor::kTileRows
+                            : 0;
   CHECK_LE(row_stride, n_features);
   if (is_dense) {
     // No missing, hence no null value, hence no + 1 symbol.
     LOG(INFO) << "Ellpack is dense.";
-    return {n_features, n_symbols_dense};
+    return {n_features, n_symbols_dense, tile_rows};
   } else if (n_features == row_stride) {
     // Treat the ellpack as dense if we can save memory.
     LOG(INFO) << "Ellpack is relatively dense.";
-    return {n_features, n_symbols_dense + 1};  // +1 for missing value (null in ellpack)
+    // +1 for missing value (null in ellpack)
+    return {n_features, n_symbols_dense + 1, tile_rows};
   } else {
     LOG(INFO) << "Ellpack is sparse.";
     return {row_stride, n_symbols};
@@ -235,13 +254,14 @@ struct WriteCompressedEllpackFunctor {
                                 const common::CompressedBufferWriter& writer, AdapterBatchT batch,
                                 EllpackDeviceAccessor accessor,
                                 common::Span<FeatureType const> feature_types,
-                                const data::IsValidFunctor& is_valid)
+                                const data::IsValidFunctor& is_valid, bst_idx_t base_rowid)
       : d_buffer(buffer),
         writer(writer),
         batch(std::move(batch)),
         accessor(std::move(accessor)),
         feature_types(std::move(feature_types)),
-        is_valid(is_valid) {}
+        is_valid(is_valid),
+        base_rowid(base_rowid) {}
 
   common::CompressedByteT* d_buffer;
   common::CompressedBufferWriter writer;
@@ -249,6 +269,9 @@ struct WriteCompressedEllpackFunctor {
   EllpackDeviceAccessor accessor;
   common::Span<FeatureType const> feature_types;
   data::IsValidFunctor is_valid;
+  // Row in the destination page where the batch begins, non-zero when the batch is
+  // written directly into a concatenated page.
+  bst_idx_t base_rowid;
 
   // Tuple[0] = The row index of the input, used as a key to define segments
   // Tuple[1] = Scanned flags of valid elements for each row
@@ -271,10 +294,11 @@ struct WriteCompressedEllpackFunctor {
   // Used for dense or as dense data.
   __device__ void operator()(bst_idx_t i) {
     auto e = batch.GetElement(i);
+    auto out_position = accessor.EntryIdx(e.row_idx + base_rowid, e.column_idx);
     if (is_valid(e)) {
-      this->Write<true>(e, i);
+      this->Write<true>(e, out_position);
     } else {
-      writer.AtomicWriteSymbol(d_buffer, accessor.NullValue(), i);
+      writer.AtomicWriteSymbol(d_buffer, accessor.NullValue(), out_position);
     }
   }
   // Used for sparse data.
@@ -282,7 +306,7 @@ struct WriteCompressedEllpackFunctor {
     auto e = batch.GetElement(thrust::get<2>(out));
     if (is_valid(e)) {
       // -1 because the scan is inclusive
-      size_t output_position = accessor.row_stride * e.row_idx + thrust::get<1>(out) - 1;
+      size_t output_position = accessor.EntryIdx(e.row_idx + base_rowid, thrust::get<1>(out) - 1);
       this->Write<false>(e, output_position);
     }
     return 0;
@@ -307,7 +331,7 @@ struct TupleScanOp {
 template <bool kIsDenseCompressed, typename AdapterBatchT>
 void CopyDataToEllpack(Context const* ctx, const AdapterBatchT& batch,
                        common::Span<FeatureType const> feature_types, EllpackPageImpl* dst,
-                       float missing) {
+                       float missing, bst_idx_t base_rowid) {
   data::IsValidFunctor is_valid(missing);
   bool valid = data::NoInfInData(ctx, batch, is_valid);
   CHECK(valid) << error::InfInData();
@@ -322,12 +346,12 @@ void CopyDataToEllpack(Context const* ctx, const AdapterBatchT& batch,
   dh::TypedDiscard<Tuple> discard;
   auto device_accessor = dst->GetDeviceAccessor(ctx);
   WriteCompressedEllpackFunctor<AdapterBatchT> functor{
-      d_compressed_buffer, writer, batch, device_accessor, feature_types, is_valid};
+      d_compressed_buffer, writer, batch, device_accessor, feature_types, is_valid, base_rowid};
 
   // For dense compressed data, we can simply copy the data with the input position.
   if (kIsDenseCompressed) {
     CHECK(batch.NumRows() == 0 || batch.NumCols() == dst->info.row_stride);
-    thrust::for_each_n(ctx->CUDACtx()->CTP(), cnt, dst->Size() * dst->info.row_stride, functor);
+    thrust::for_each_n(ctx->CUDACtx()->CTP(), cnt, batch.NumRows() * dst->info.row_stride, functor);
     return;
   }
 
@@ -350,18 +374,22 @@ void CopyDataToEllpack(Context const* ctx, const AdapterBatchT& batch,
 }
 
 void WriteNullValues(Context const* ctx, EllpackPageImpl* dst,
-                     common::Span<size_t const> row_counts) {
+                     common::Span<size_t const> row_counts, bst_idx_t base_rowid,
+                     bst_idx_t n_rows) {
   // Write the null values
   auto null = dst->GetDeviceAccessor(ctx).NullValue();
   common::CompressedBufferWriter writer(dst->NumSymbols());
   auto d_compressed_buffer = dst->gidx_buffer.data();
   auto row_stride = dst->info.row_stride;
-  auto n = row_stride * dst->n_rows;
+  auto tile_rows = dst->info.tile_rows;
+  auto n = row_stride * n_rows;
   dh::LaunchN(n, ctx->CUDACtx()->Stream(), [=] __device__(bst_idx_t idx) mutable {
     size_t row_idx = idx / row_stride;
     size_t row_offset = idx % row_stride;
     if (row_offset >= row_counts[row_idx]) {
-      writer.AtomicWriteSymbol(d_compressed_buffer, null, idx);
+      writer.AtomicWriteSymbol(
+          d_compressed_buffer, null,
+          EllpackEntryIdx(base_rowid + row_idx, row_offset, row_stride, tile_rows));
     }
   });
 }
@@ -373,13 +401,22 @@ EllpackPageImpl::EllpackPageImpl(Context const* ctx, AdapterBatch batch, float m
                                  bst_idx_t row_stride, bst_idx_t n_rows,
                                  std::shared_ptr<common::HistogramCuts const> cuts)
     : EllpackPageImpl{ctx, cuts, is_dense, row_stride, n_rows} {
+  this->PushAdapterBatch(ctx, batch, missing, row_counts, feature_types, 0);
+}
+
+template <typename AdapterBatch>
+void EllpackPageImpl::PushAdapterBatch(Context const* ctx, AdapterBatch batch, float missing,
+                                       common::Span<bst_idx_t const> row_counts_span,
+                                       common::Span<FeatureType const> feature_types,
+                                       bst_idx_t base_rowid) {
   curt::SetDevice(ctx->Ordinal());
+  CHECK_LE(base_rowid + batch.NumRows(), this->n_rows);
 
   if (this->IsDenseCompressed()) {
-    CopyDataToEllpack<true>(ctx, batch, feature_types, this, missing);
+    CopyDataToEllpack<true>(ctx, batch, feature_types, this, missing, base_rowid);
   } else {
-    CopyDataToEllpack<false>(ctx, batch, feature_types, this, missing);
-    WriteNullValues(ctx, this, row_counts);
+    CopyDataToEllpack<false>(ctx, batch, feature_types, this, missing, base_rowid);
+    WriteNullValues(ctx, this, row_counts_span, base_rowid, batch.NumRows());
   }
 }
 
@@ -388,7 +425,11 @@ EllpackPageImpl::EllpackPageImpl(Context const* ctx, AdapterBatch batch, float m
       Context const* ctx, __BATCH_T batch, float missing, bool is_dense,                     \
       common::Span<bst_idx_t const> row_counts_span,                                         \
       common::Span<FeatureType const> feature_types, bst_idx_t row_stride, bst_idx_t n_rows, \
-      std::shared_ptr<common::HistogramCuts const> cuts);
+      std::shared_ptr<common::HistogramCuts const> cuts);                                    \
+  template void EllpackPageImpl::PushAdapterBatch(                                           \
+      Context const* ctx, __BATCH_T batch, float missing,                                    \
+      common::Span<bst_idx_t const> row_counts_span,                                         \
+      common::Span<FeatureType const> feature_types, bst_idx_t base_rowid);
 
 ELLPACK_BATCH_SPECIALIZE(data::CudfAdapterBatch)
 ELLPACK_BATCH_SPECIALIZE(data::CupyAdapterBatch)
@@ -399,7 +440,7 @@ namespace {
 template <typename T>
 void CopyGHistToEllpack(Context const* ctx, GHistIndexMatrix const& page,
                         common::Span<bst_idx_t const> d_row_ptr, bst_idx_t row_stride,
-                        bst_bin_t null, bst_idx_t n_symbols,
+                        bst_idx_t tile_rows, bst_bin_t null, bst_idx_t n_symbols,
                         common::Span<bst_feature_t const> d_cut_ptrs,
                         common::CompressedByteT* d_compressed_buffer) {
   dh::device_vector<uint8_t> data(page.index.begin(), page.index.end());
@@ -437,7 +478,8 @@ void CopyGHistToEllpack(Context const* ctx, GHistIndexMatrix const& page,
       bin_idx = ptr[r_begin + fidx];
     }
 
-    writer.AtomicWriteSymbol(d_compressed_buffer, bin_idx, i);
+    writer.AtomicWriteSymbol(d_compressed_buffer, bin_idx,
+                             EllpackEntryIdx(ridx, fidx, row_stride, tile_rows));
   };
   thrust::for_each_n(cuctx->CTP(), cnt, row_stride * page.Size(), fn);
 }
@@ -476,9 +518,9 @@ EllpackPageImpl::EllpackPageImpl(Context const* ctx, GHistIndexMatrix const& pag
   this->monitor_.Start("CopyGHistToEllpack");
   common::DispatchBinType(page.index.GetBinTypeSize(), [&](auto t) {
     using T = decltype(t);
-    CopyGHistToEllpack<T>(ctx, page, d_row_ptr, this->info.row_stride, accessor.NullValue(),
-                          this->NumSymbols(), this->cuts_->cut_ptrs_.ConstDeviceSpan(),
-                          d_compressed_buffer);
+    CopyGHistToEllpack<T>(ctx, page, d_row_ptr, this->info.row_stride, this->info.tile_rows,
+                          accessor.NullValue(), this->NumSymbols(),
+                          this->cuts_->cut_ptrs_.ConstDeviceSpan(), d_compressed_buffer);
   });
   this->monitor_.Stop("CopyGHistToEllpack");
 }
@@ -500,17 +542,29 @@ struct CopyPage {
   common::CompressedBufferWriter cbw;
   common::CompressedByteT* dst_data_d;
   common::CompressedIterator<uint32_t> src_iterator_d;
-  // The number of elements to skip.
-  size_t offset;
+  size_t row_stride;
+  bst_idx_t dst_tile_rows;
+  bst_idx_t src_tile_rows;
+  // The number of rows to skip in the destination.
+  size_t base_row;
 
   CopyPage(EllpackPageImpl* dst, EllpackPageImpl const* src, size_t offset)
       : cbw{dst->NumSymbols()},
         dst_data_d{dst->gidx_buffer.data()},
         src_iterator_d{src->gidx_buffer.data(), src->NumSymbols()},
-        offset{offset} {}
+        row_stride{dst->info.row_stride},
+        dst_tile_rows{dst->info.tile_rows},
+        src_tile_rows{src->info.tile_rows},
+        base_row{row_stride == 0 ? 0 : offset / row_stride} {}
 
+  // The element id is a logical row-major position, mapped to the physical layout of
+  // each page.
   __device__ void operator()(std::size_t element_id) {
-    cbw.AtomicWriteSymbol(dst_data_d, src_iterator_d[element_id], element_id + offset);
+    auto ridx = element_id / row_stride;
+    auto fidx = element_id % row_stride;
+    cbw.AtomicWriteSymbol(dst_data_d,
+                          src_iterator_d[EllpackEntryIdx(ridx, fidx, row_stride, src_tile_rows)],
+                          EllpackEntryIdx(base_row + ridx, fidx, row_stride, dst_tile_rows));
   }
 };
 
@@ -522,6 +576,10 @@ bst_idx_t EllpackPageImpl::Copy(Context const* ctx, EllpackPageImpl const* page,
   CHECK_EQ(this->info.row_stride, page->info.row_stride);
   CHECK_EQ(this->NumSymbols(), page->NumSymbols());
   CHECK_GE(this->n_rows * this->info.row_stride, offset + n_elements);
+  if (this->info.row_stride != 0) {
+    // Pages are appended whole, hence row aligned.
+    CHECK_EQ(offset % this->info.row_stride, 0);
+  }
   thrust::for_each_n(ctx->CUDACtx()->CTP(), thrust::make_counting_iterator(0ul), n_elements,
                      CopyPage{this, page, offset});
   monitor_.Stop(__func__);
@@ -547,6 +605,8 @@ struct CompactPage {
   common::Span<size_t> row_indexes;
   size_t base_rowid;
   size_t row_stride;
+  bst_idx_t dst_tile_rows;
+  bst_idx_t src_tile_rows;
 
   CompactPage(EllpackPageImpl* dst, EllpackPageImpl const* src, common::Span<size_t> row_indexes)
       : cbw{dst->NumSymbols()},
@@ -554,7 +614,9 @@ struct CompactPage {
         src_iterator_d{src->gidx_buffer.data(), src->NumSymbols()},
         row_indexes(row_indexes),
         base_rowid{src->base_rowid},
-        row_stride{src->info.row_stride} {}
+        row_stride{src->info.row_stride},
+        dst_tile_rows{dst->info.tile_rows},
+        src_tile_rows{src->info.tile_rows} {}
 
   __device__ void operator()(bst_idx_t row_id) {
     size_t src_row = base_rowid + row_id;
@@ -562,10 +624,10 @@ struct CompactPage {
     if (dst_row == SIZE_MAX) {
       return;
     }
-    size_t dst_offset = dst_row * row_stride;
-    size_t src_offset = row_id * row_stride;
     for (size_t j = 0; j < row_stride; j++) {
-      cbw.AtomicWriteSymbol(dst_data_d, src_iterator_d[src_offset + j], dst_offset + j);
+      cbw.AtomicWriteSymbol(dst_data_d,
+                            src_iterator_d[EllpackEntryIdx(row_id, j, row_stride, src_tile_rows)],
+                            EllpackEntryIdx(dst_row, j, row_stride, dst_tile_rows));
     }
   }
 };
@@ -590,9 +652,10 @@ void EllpackPageImpl::SetCuts(std::shared_ptr<common::HistogramCuts const> cuts)
 void EllpackPageImpl::InitCompressedData(Context const* ctx) {
   monitor_.Start(__func__);
   auto num_symbols = this->NumSymbols();
-  // Required buffer size for storing data matrix in ELLPack format.
+  // Required buffer size for storing data matrix in ELLPack format.  The tiled layout
+  // pads the trailing tile; unused symbols there are never read.
   std::size_t compressed_size_bytes = common::CompressedBufferWriter::CalculateBufferSize(
-      this->info.row_stride * this->n_rows, num_symbols);
+      this->info.PaddedElems(this->n_rows), num_symbols);
   auto init = static_cast<common::CompressedByteT>(0);
   gidx_buffer = common::MakeFixedVecWithCudaMalloc(ctx, compressed_size_bytes, init);
   monitor_.Stop(__func__);
@@ -660,7 +723,8 @@ void EllpackPageImpl::CreateHistIndices(Context const* ctx, const SparsePage& ro
       dh::LaunchKernel{grid3, block3, 0, ctx->CUDACtx()->Stream()}(  // NOLINT
           kernel, writer, gidx_buffer_data, row_ptrs.data(), entries_d.data(),
           device_accessor.gidx_fvalue_map.data(), device_accessor.feature_segments, feature_types,
-          batch_row_begin, batch_nrows, this->info.row_stride, null_gidx_value);
+          batch_row_begin, batch_nrows, this->info.row_stride, this->info.tile_rows,
+          null_gidx_value);
     };
     if (this->IsDense()) {
       launcher(CompressBinEllpackKernel<true, true>);
@@ -693,7 +757,8 @@ EllpackDeviceAccessor EllpackPageImpl::GetDeviceAccessor(
           this->n_rows,
           common::CompressedIterator<uint32_t>{gidx_buffer.data(), this->NumSymbols()},
           null,
-          feature_types};
+          feature_types,
+          this->info.tile_rows};
 }
 
 EllpackDeviceAccessor EllpackPageImpl::GetHostAccessor(
@@ -713,7 +778,8 @@ EllpackDeviceAccessor EllpackPageImpl::GetHostAccessor(
           this->n_rows,
           common::CompressedIterator<uint32_t>{h_gidx_buffer->data(), this->NumSymbols()},
           null,
-          feature_types};
+          feature_types,
+          this->info.tile_rows};
 }
 
 [[nodiscard]] bst_idx_t EllpackPageImpl::NumNonMissing(
@@ -723,9 +789,11 @@ EllpackDeviceAccessor EllpackPageImpl::GetHostAccessor(
   }
   auto d_acc = this->GetDeviceAccessor(ctx, feature_types);
   using T = typename decltype(d_acc.gidx_iter)::value_type;
+  // Iterate logical positions so the tile padding is never counted.
   auto it = thrust::make_transform_iterator(
-      thrust::make_counting_iterator(0ull),
-      [=] XGBOOST_DEVICE(std::size_t i) { return d_acc.gidx_iter[i]; });
+      thrust::make_counting_iterator(0ull), [=] XGBOOST_DEVICE(std::size_t i) {
+        return d_acc.gidx_iter[d_acc.EntryIdx(i / d_acc.row_stride, i % d_acc.row_stride)];
+      });
   return thrust::count_if(ctx->CUDACtx()->CTP(), it, it + d_acc.row_stride * d_acc.n_rows,
                           [=] XGBOOST_DEVICE(T gidx) -> bool { return gidx != d_acc.NullValue(); });
 }
@@ -17,16 +17,39 @@
 #include "xgboost/data.h"
 
 namespace xgboost {
+/**
+ * @brief Map a (row, feature) pair to its element index within the compressed buffer.
+ *
+ * The default layout is row-major.  When @p tile_rows is non-zero, elements are stored
+ * feature-major within tiles of @p tile_rows rows each, so that threads scanning a single
+ * feature over consecutive rows read consecutive symbols.  Only dense compressed pages
+ * use the tiled layout; the trailing tile is padded to keep the mapping uniform.
+ */
+XGBOOST_HOST_DEV_INLINE bst_idx_t EllpackEntryIdx(bst_idx_t ridx, bst_idx_t fidx,
+                                                  bst_idx_t row_stride, bst_idx_t tile_rows) {
+  if (tile_rows == 0) {
+    return ridx * row_stride + fidx;
+  }
+  auto tile = ridx / tile_rows;
+  auto row_in_tile = ridx - tile * tile_rows;
+  return (tile * row_stride + fidx) * tile_rows + row_in_tile;
+}
+
 /**
  * @brief Struct for accessing and manipulating an ELLPACK matrix on the device.
  *
  * Does not own underlying memory and may be trivially copied into kernels.
  */
 struct EllpackDeviceAccessor {
+  /** @brief Number of rows per feature-major tile when the tiled layout is in use. */
+  static constexpr bst_idx_t kTileRows = 256;
+
   /** @brief Whether or not if the matrix is dense. */
   bst_idx_t null_value;
   /** @brief Row length for ELLPACK, equal to number of features when the data is dense. */
   bst_idx_t row_stride;
+  /** @brief Rows per feature-major tile, 0 for the row-major layout. */
+  bst_idx_t tile_rows;
   /** @brief Starting index of the rows. Used for external memory. */
   bst_idx_t base_rowid;
   /** @brief Number of rows in this batch. */
@@ -46,9 +69,10 @@ struct EllpackDeviceAccessor {
   EllpackDeviceAccessor(Context const* ctx, std::shared_ptr<const common::HistogramCuts> cuts,
                         bst_idx_t row_stride, bst_idx_t base_rowid, bst_idx_t n_rows,
                         common::CompressedIterator<uint32_t> gidx_iter, bst_idx_t null_value,
-                        common::Span<FeatureType const> feature_types)
+                        common::Span<FeatureType const> feature_types, bst_idx_t tile_rows = 0)
       : null_value{null_value},
         row_stride{row_stride},
+        tile_rows{tile_rows},
         base_rowid{base_rowid},
         n_rows{n_rows},
         gidx_iter{gidx_iter},
@@ -70,6 +94,13 @@ struct EllpackDeviceAccessor {
   [[nodiscard]] XGBOOST_HOST_DEV_INLINE bool IsDenseCompressed() const {
     return this->row_stride == this->NumFeatures();
   }
+  /**
+   * @brief Element index of a (local row, feature) pair within the compressed buffer.
+   */
+  [[nodiscard]] XGBOOST_HOST_DEV_INLINE bst_idx_t EntryIdx(bst_idx_t local_ridx,
+                                                           bst_idx_t fidx) const {
+    return EllpackEntryIdx(local_ridx, fidx, row_stride, tile_rows);
+  }
   /**
    * @brief Given a row index and a feature index, returns the corresponding bin index.
    *
@@ -85,15 +116,15 @@ struct EllpackDeviceAccessor {
     if (global_ridx) {
       ridx -= base_rowid;
     }
-    auto row_begin = row_stride * ridx;
     if (!this->IsDenseCompressed()) {
       // binary search returns -1 if it's missing
+      auto row_begin = row_stride * ridx;
       auto row_end = row_begin + row_stride;
       bst_bin_t gidx = common::BinarySearchBin(row_begin, row_end, gidx_iter,
                                                feature_segments[fidx], feature_segments[fidx + 1]);
       return gidx;
     }
-    bst_bin_t gidx = gidx_iter[row_begin + fidx];
+    bst_bin_t gidx = gidx_iter[this->EntryIdx(ridx, fidx)];
     if (gidx == this->NullValue()) {
       // Missing value in a dense ellpack
       return -1;
@@ -211,6 +242,25 @@ class EllpackPageImpl {
    * @returns The number of elements copied.
    */
   bst_idx_t Copy(Context const* ctx, EllpackPageImpl const* page, bst_idx_t offset);
+  /**
+   * @brief Write an adapter batch into this page starting at the given row.
+   *
+   * The page must have been constructed with enough empty rows.  Compared with
+   * materializing a temporary page per batch and copying it over, this writes the
+   * compressed bins directly into their final position, so batch concatenation does not
+   * hold a transient second copy of the batch.
+   *
+   * @param ctx The GPU context.
+   * @param batch The adapter batch to write.
+   * @param missing Value representing missing elements.
+   * @param row_counts_span The number of valid elements per row of the batch.
+   * @param feature_types The feature types of the batch.
+   * @param base_rowid The row in this page where the batch begins.
+   */
+  template <typename AdapterBatch>
+  void PushAdapterBatch(Context const* ctx, AdapterBatch batch, float missing,
+                        common::Span<bst_idx_t const> row_counts_span,
+                        common::Span<FeatureType const> feature_types, bst_idx_t base_rowid);
   /**
    * @brief Compact the given ELLPACK page into the current page.
    *
@@ -259,6 +309,7 @@ class EllpackPageImpl {
     this->n_rows = page->Size();
     this->is_dense = page->IsDense();
     this->info.row_stride = page->info.row_stride;
+    this->info.tile_rows = page->info.tile_rows;
     this->SetBaseRowId(page->base_rowid);
     this->SetNumSymbols(page->NumSymbols());
   }
@@ -313,6 +364,18 @@ class EllpackPageImpl {
     bst_idx_t row_stride{0};
     /** @brief The number of unique bins including missing. */
     bst_idx_t n_symbols{0};
+    /** @brief Rows per feature-major tile, 0 for the row-major layout. */
+    bst_idx_t tile_rows{0};
+
+    /**
+     * @brief Number of buffer elements, including the padding of the trailing tile.
+     */
+    [[nodiscard]] bst_idx_t PaddedElems(bst_idx_t n_rows) const {
+      if (tile_rows == 0) {
+        return n_rows * row_stride;
+      }
+      return common::DivRoundUp(n_rows, tile_rows) * tile_rows * row_stride;
+    }
   } info;
 
  private:
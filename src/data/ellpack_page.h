@@ -4,7 +4,8 @@
 #ifndef XGBOOST_DATA_ELLPACK_PAGE_H_
 #define XGBOOST_DATA_ELLPACK_PAGE_H_
 
-#include <memory>  // for unique_ptr
+#include <cstddef>  // for size_t
+#include <memory>   // for unique_ptr
 
 #include "../common/hist_util.h"  // for HistogramCuts
 #include "xgboost/context.h"      // for Context
@@ -52,6 +53,8 @@ class EllpackPage {
 
   [[nodiscard]] common::HistogramCuts const& Cuts() const;
   [[nodiscard]] bst_idx_t BaseRowId() const;
+  /*! \return Device memory cost of the page in bytes. */
+  [[nodiscard]] std::size_t MemCostBytes() const;
 
  private:
   std::unique_ptr<EllpackPageImpl> impl_;
@@ -5,6 +5,7 @@
 #include <cstddef>    // for size_t
 #include <cstdint>    // for int8_t, uint64_t, uint32_t
 #include <memory>     // for shared_ptr, make_unique, make_shared
+#include <mutex>      // for lock_guard
 #include <numeric>    // for accumulate
 #include <utility>    // for move
 
@@ -127,7 +128,8 @@ class EllpackHostCacheStreamImpl {
       new_impl->gidx_buffer = common::MakeFixedVecWithPinnedMalloc<common::CompressedByteT>(
           old_impl->gidx_buffer.size());
       dh::safe_cuda(cudaMemcpyAsync(new_impl->gidx_buffer.data(), old_impl->gidx_buffer.data(),
-                                    old_impl->gidx_buffer.size_bytes(), cudaMemcpyDefault));
+                                    old_impl->gidx_buffer.size_bytes(), cudaMemcpyDefault,
+                                    dh::DefaultStream()));
       LOG(INFO) << "Create cache page with size:" << common::HumanMemUnit(new_impl->MemCostBytes());
       return new_impl;
     };
@@ -147,10 +149,12 @@ class EllpackHostCacheStreamImpl {
             page.Impl()->gidx_buffer.size());
       }
       dh::safe_cuda(cudaMemcpyAsync(new_impl->gidx_buffer.data(), page.Impl()->gidx_buffer.data(),
-                                    page.Impl()->gidx_buffer.size_bytes(), cudaMemcpyDefault));
+                                    page.Impl()->gidx_buffer.size_bytes(), cudaMemcpyDefault,
+                                    dh::DefaultStream()));
 
       this->cache_->offsets.push_back(new_impl->n_rows * new_impl->info.row_stride);
       this->cache_->pages.push_back(std::move(new_impl));
+      this->cache_->n_accesses.push_back(0);
       return new_page;
     }
 
@@ -175,6 +179,7 @@ class EllpackHostCacheStreamImpl {
 
       this->cache_->offsets.push_back(offset);
       this->cache_->pages.push_back(std::move(new_impl));
+      this->cache_->n_accesses.push_back(0);
     } else {
       CHECK(!this->cache_->pages.empty());
       CHECK_EQ(cache_idx, this->cache_->pages.size() - 1);
@@ -191,18 +196,58 @@ class EllpackHostCacheStreamImpl {
     return new_page;
   }
 
+  /**
+   * @brief Promote a frequently read host-resident page to the device cache.
+   *
+   * The batch loop of the GPU updater reads every page once per iteration, so a repeated
+   * read means the page is part of the training loop rather than the initial
+   * construction pass.  Promotion is bounded by the device page budget and backs off
+   * when the device is short on memory, keeping the overflow pages in pinned host
+   * memory.
+   */
+  EllpackPageImpl const* MaybePromote(std::int32_t k) const {
+    std::lock_guard<std::mutex> guard{this->cache_->lock};
+    auto& page = this->cache_->pages.at(k);
+    auto n_reads = ++this->cache_->n_accesses.at(k);
+    if (IsDevicePage(page.get()) || n_reads < 2 ||
+        this->cache_->NumDevicePages() >= this->cache_->max_num_device_pages) {
+      return page.get();
+    }
+    // Keep enough headroom for the prefetch buffers and the training workspace.
+    auto n_bytes = page->gidx_buffer.size_bytes();
+    if (dh::AvailableMemory(dh::CurrentDevice()) < n_bytes * 4) {
+      return page.get();
+    }
+    auto new_impl = std::make_unique<EllpackPageImpl>();
+    new_impl->CopyInfo(page.get());
+    new_impl->gidx_buffer =
+        common::MakeFixedVecWithCudaMalloc<common::CompressedByteT>(page->gidx_buffer.size());
+    dh::safe_cuda(cudaMemcpyAsync(new_impl->gidx_buffer.data(), page->gidx_buffer.data(), n_bytes,
+                                  cudaMemcpyDefault, dh::DefaultStream()));
+    // The host page is freed on replacement, wait for the copy.
+    dh::DefaultStream().Sync();
+    LOG(INFO) << "Promote cache page " << k
+              << " to device, size:" << common::HumanMemUnit(new_impl->MemCostBytes());
+    page = std::move(new_impl);
+    return page.get();
+  }
+
   void Read(EllpackPage* out, bool prefetch_copy) const {
-    auto page = this->cache_->At(this->ptr_);
+    auto page = this->MaybePromote(this->ptr_);
     if (IsDevicePage(page)) {
       // Page is already in the device memory, no need to copy.
       prefetch_copy = false;
     }
     auto out_impl = out->Impl();
     if (prefetch_copy) {
+      // Stage the copy on the per-thread stream.  This method is called by the prefetch
+      // workers, the legacy default stream would serialize the copy with compute on the
+      // main thread and leave the device idle while the next page is being staged.
       out_impl->gidx_buffer =
           common::MakeFixedVecWithCudaMalloc<common::CompressedByteT>(page->gidx_buffer.size());
       dh::safe_cuda(cudaMemcpyAsync(out_impl->gidx_buffer.data(), page->gidx_buffer.data(),
-                                    page->gidx_buffer.size_bytes(), cudaMemcpyDefault));
+                                    page->gidx_buffer.size_bytes(), cudaMemcpyDefault,
+                                    dh::DefaultStream()));
     } else {
       auto res = page->gidx_buffer.Resource();
       out_impl->gidx_buffer = common::RefResourceView<common::CompressedByteT>{
@@ -307,8 +352,10 @@ void CalcCacheMapping(Context const* ctx, bool is_dense,
 
   for (std::size_t i = 0; i < ext_info.n_batches; ++i) {
     auto n_samples = ext_info.base_rowids.at(i + 1) - ext_info.base_rowids[i];
+    // Padded element count to account for the tiled layout, an upper bound for
+    // concatenated pages since the padding is only needed once per page.
     auto n_bytes = common::CompressedBufferWriter::CalculateBufferSize(
-        ext_info.row_stride * n_samples, ell_info.n_symbols);
+        ell_info.PaddedElems(n_samples), ell_info.n_symbols);
     if (cache_bytes.empty()) {
       // Push the first page
       cache_bytes.push_back(n_bytes);
@@ -8,6 +8,7 @@
 #include <cstdint>  // for int32_t
 #include <limits>   // for numeric_limits
 #include <memory>   // for shared_ptr
+#include <mutex>    // for mutex
 #include <utility>  // for move
 #include <vector>   // for vector
 
@@ -57,6 +58,11 @@ struct EllpackMemCache {
   std::vector<bst_idx_t> const buffer_rows;
   bool const prefer_device;
   std::int64_t const max_num_device_pages;
+  // Number of times each cached page has been read, used to promote hot pages into the
+  // device page budget.
+  std::vector<std::int64_t> n_accesses;
+  // Guards residency changes against concurrent prefetch workers.
+  mutable std::mutex lock;
 
   explicit EllpackMemCache(EllpackCacheInfo cinfo);
   ~EllpackMemCache();
@@ -9,6 +9,7 @@
 
 #include "../tree/param.h"          // FIXME(jiamingy): Find a better way to share this parameter.
 #include "batch_utils.h"            // for CheckParam, RegenGHist
+#include "cache_manifest.h"         // for CacheManifest, CacheLockGuard, LoadCacheManifest
 #include "proxy_dmatrix.h"          // for DataIterProxy, HostAdapterDispatch
 #include "quantile_dmatrix.h"       // for GetDataShape, MakeSketches
 #include "simple_batch_iterator.h"  // for SimpleBatchIteratorImpl
@@ -25,10 +26,37 @@ ExtMemQuantileDMatrix::ExtMemQuantileDMatrix(DataIterHandle iter_handle, DMatrix
                                              XGDMatrixCallbackNext *next, bst_bin_t max_bin,
                                              std::int64_t max_quantile_blocks,
                                              ExtMemConfig const &config)
-    : cache_prefix_{config.cache}, on_host_{config.on_host} {
+    : cache_prefix_{config.cache},
+      on_host_{config.on_host},
+      n_prefetch_batches_{config.n_prefetch_batches},
+      persist_cache_{config.persist_cache} {
   cache_prefix_ = MakeCachePrefix(cache_prefix_);
   auto iter = std::make_shared<DataIterProxy<DataIterResetCallback, XGDMatrixCallbackNext>>(
       iter_handle, reset, next);
+
+  // Serialize cache construction across concurrent trainers sharing the prefix: the
+  // first process builds and commits the cache while the rest block here, then restore
+  // it from the manifest.  Held until the end of the constructor; reads afterwards map
+  // the shard read-only and need no lock.
+  std::unique_ptr<CacheLockGuard> cache_lock;
+  if (persist_cache_ && !on_host_) {
+    cache_lock = std::make_unique<CacheLockGuard>(cache_prefix_);
+  }
+
+  if (persist_cache_ && !on_host_) {
+    // Warm start from a manifest left by an earlier process, without touching the
+    // iterator.  Only the CPU gradient index path writes a manifest.
+    Context ctx;
+    ctx.Init(Args{{"nthread", std::to_string(config.n_threads)}});
+    BatchParam p{max_bin, tree::TrainParam::DftSparseThreshold()};
+    p = detail::ApplyPrefetchDepth(p, config.n_prefetch_batches);
+    if (this->InitFromManifest(&ctx, p, config.missing)) {
+      this->batch_ = p;
+      this->fmat_ctx_ = ctx;
+      return;
+    }
+  }
+
   iter->Reset();
   // Fetch the first iter
   bool valid = iter->Next();
@@ -39,10 +67,13 @@ ExtMemQuantileDMatrix::ExtMemQuantileDMatrix(DataIterHandle iter_handle, DMatrix
   ctx.Init(Args{{"nthread", std::to_string(config.n_threads)}, {"device", pctx->DeviceName()}});
 
   BatchParam p{max_bin, tree::TrainParam::DftSparseThreshold()};
+  if (!ctx.IsCPU()) {
+    p.n_prefetch_batches = ::xgboost::cuda_impl::DftPrefetchBatches();
+  }
+  p = detail::ApplyPrefetchDepth(p, config.n_prefetch_batches);
   if (ctx.IsCPU()) {
     this->InitFromCPU(&ctx, iter, proxy, p, config.missing, ref);
   } else {
-    p.n_prefetch_batches = ::xgboost::cuda_impl::DftPrefetchBatches();
     this->InitFromCUDA(&ctx, iter, proxy, p, ref, max_quantile_blocks, config);
   }
   this->batch_ = p;
@@ -54,9 +85,31 @@ ExtMemQuantileDMatrix::~ExtMemQuantileDMatrix() {
   ghist_index_source_.reset();
   std::visit([](auto &&ptr) { ptr.reset(); }, ellpack_page_source_);
 
+  if (cache_persisted_) {
+    // Keep the shards on disk for the next warm start.
+    return;
+  }
   DeleteCacheFiles(cache_info_);
 }
 
+bool ExtMemQuantileDMatrix::InitFromManifest(Context const *ctx, BatchParam const &p,
+                                             float missing) {
+  CacheManifest manifest;
+  if (!LoadCacheManifest(cache_prefix_, p.max_bin, &this->info_, &manifest)) {
+    return false;
+  }
+  LOG(INFO) << "Restored external memory cache from " << ManifestPath(cache_prefix_);
+
+  auto id = manifest.cache->ShardName();
+  cache_info_[id] = manifest.cache;
+  this->n_batches_ = manifest.cache->Size();
+  this->ghist_index_source_ = std::make_shared<ExtGradientIndexPageSource>(
+      ctx, missing, &this->info_, manifest.cache, p, std::move(manifest.cuts),
+      std::move(manifest.base_rowids));
+  this->cache_persisted_ = true;
+  return true;
+}
+
 BatchSet<ExtSparsePage> ExtMemQuantileDMatrix::GetExtBatches(Context const *, BatchParam const &) {
   LOG(FATAL) << "Not implemented for `ExtMemQuantileDMatrix`.";
   auto begin_iter =
@@ -111,6 +164,12 @@ void ExtMemQuantileDMatrix::InitFromCPU(
     CHECK(!this->Info().feature_types.Empty());
   }
   CHECK_EQ(cuts.HasCategorical(), this->Info().HasCategorical());
+
+  if (persist_cache_ && !on_host_) {
+    SaveCacheManifest(cache_prefix_, p.max_bin, this->Info(), cuts, ext_info.base_rowids,
+                      *cache_info_.at(id));
+    cache_persisted_ = true;
+  }
 }
 
 [[nodiscard]] BatchSet<GHistIndexMatrix> ExtMemQuantileDMatrix::GetGradientIndexImpl() {
@@ -126,7 +185,7 @@ BatchSet<GHistIndexMatrix> ExtMemQuantileDMatrix::GetGradientIndex(Context const
 
   CHECK(this->ghist_index_source_)
       << "The `ExtMemQuantileDMatrix` is initialized using GPU data, cannot be used for CPU.";
-  this->ghist_index_source_->Reset(param);
+  this->ghist_index_source_->Reset(detail::ApplyPrefetchDepth(param, n_prefetch_batches_));
 
   if (!std::isnan(param.sparse_thresh) &&
       param.sparse_thresh != tree::TrainParam::DftSparseThreshold()) {
@@ -128,7 +128,7 @@ BatchSet<EllpackPage> ExtMemQuantileDMatrix::GetEllpackBatches(Context const *,
       [this, param](auto &&ptr) {
         CHECK(ptr)
             << "The `ExtMemQuantileDMatrix` is initialized using CPU data, cannot be used for GPU.";
-        ptr->Reset(param);
+        ptr->Reset(detail::ApplyPrefetchDepth(param, n_prefetch_batches_));
       },
       this->ellpack_page_source_);
 
@@ -47,6 +47,12 @@ class ExtMemQuantileDMatrix : public QuantileDMatrix {
       std::int64_t max_quantile_blocks,
       ExtMemConfig const &config);
 
+  /**
+   * @brief Try to restore the gradient index cache from a manifest left by an earlier
+   *        process, skipping the sketching pass entirely.  CPU-only.
+   */
+  [[nodiscard]] bool InitFromManifest(Context const* ctx, BatchParam const& p, float missing);
+
   [[nodiscard]] BatchSet<GHistIndexMatrix> GetGradientIndexImpl();
   BatchSet<GHistIndexMatrix> GetGradientIndex(Context const *ctx, BatchParam const &param) override;
 
@@ -66,6 +72,13 @@ class ExtMemQuantileDMatrix : public QuantileDMatrix {
   std::map<std::string, std::shared_ptr<Cache>> cache_info_;
   std::string cache_prefix_;
   bool const on_host_;
+  // User-configured number of look-ahead pages, 0 for the default.
+  std::int32_t const n_prefetch_batches_;
+  // Whether the disk cache should outlive this process.
+  bool const persist_cache_;
+  // Set once a manifest has been written or restored; keeps the dtor from deleting the
+  // cache files.
+  bool cache_persisted_{false};
   BatchParam batch_;
   bst_idx_t n_batches_{0};
 
@@ -9,6 +9,7 @@
 #include <string>     // for string
 #include <utility>    // for move
 
+#include "csv_parser.h"       // for CreateTextParser
 #include "dmlc/data.h"        // for RowBlock, Parser
 #include "xgboost/c_api.h"    // for XGDMatrixFree, XGProxyDMatrixCreate
 
@@ -53,9 +54,7 @@ class FileIterator {
 
   auto Proxy() -> decltype(proxy_) { return proxy_; }
 
-  void Reset() {
-    parser_.reset(dmlc::Parser<uint32_t>::Create(uri_.c_str(), part_idx_, n_parts_, "auto"));
-  }
+  void Reset() { parser_ = CreateTextParser(uri_, part_idx_, n_parts_); }
 };
 
 namespace fileiter {
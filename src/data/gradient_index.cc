@@ -54,6 +54,7 @@ GHistIndexMatrix::GHistIndexMatrix(Context const *ctx, DMatrix *p_fmat, bst_bin_
       this->columns_->InitFromSparse(page, *this, sparse_thresh, ctx->Threads());
     }
   }
+  this->ReportMemUsage();
 }
 
 GHistIndexMatrix::GHistIndexMatrix(MetaInfo const &info, common::HistogramCuts &&cuts,
@@ -62,7 +63,9 @@ GHistIndexMatrix::GHistIndexMatrix(MetaInfo const &info, common::HistogramCuts &
       hit_count{common::MakeFixedVecWithMalloc(cuts.TotalBins(), std::size_t{0})},
       cut{std::forward<common::HistogramCuts>(cuts)},
       max_numeric_bins_per_feat(max_bin_per_feat),
-      isDense_{info.IsDense()} {}
+      isDense_{info.IsDense()} {
+  this->ReportMemUsage();
+}
 
 GHistIndexMatrix::GHistIndexMatrix(bst_idx_t n_samples, bst_idx_t base_rowid,
                                    common::HistogramCuts &&cuts, bst_bin_t max_bin_per_feat,
@@ -72,7 +75,9 @@ GHistIndexMatrix::GHistIndexMatrix(bst_idx_t n_samples, bst_idx_t base_rowid,
       cut{std::forward<common::HistogramCuts>(cuts)},
       max_numeric_bins_per_feat(max_bin_per_feat),
       base_rowid{base_rowid},
-      isDense_{is_dense} {}
+      isDense_{is_dense} {
+  this->ReportMemUsage();
+}
 
 #if !defined(XGBOOST_USE_CUDA)
 GHistIndexMatrix::GHistIndexMatrix(Context const *, MetaInfo const &, EllpackPage const &,
@@ -88,9 +93,64 @@ void GHistIndexMatrix::PushBatch(SparsePage const &batch, common::Span<FeatureTy
   auto page = batch.GetView();
   auto it = common::MakeIndexTransformIter([&](std::size_t ridx) { return page[ridx].size(); });
   common::PartialSum(n_threads, it, it + page.Size(), static_cast<size_t>(0), row_ptr.begin());
-  data::SparsePageAdapterBatch adapter_batch{page};
-  auto is_valid = [](auto) { return true; };  // SparsePage always contains valid entries
-  PushBatchImpl(n_threads, adapter_batch, 0, is_valid, ft);
+  PushBatchImpl(n_threads, page, 0, ft);
+}
+
+void GHistIndexMatrix::PushBatchImpl(std::int32_t n_threads, HostSparsePageView const &page,
+                                     std::size_t rbegin, common::Span<FeatureType const> ft) {
+  // The number of threads is pegged to the batch size. If the OMP block is parallelized
+  // on anything other than the batch/block size, it should be reassigned
+  std::size_t batch_threads =
+      std::max(static_cast<std::size_t>(1), std::min(page.Size(), static_cast<std::size_t>(n_threads)));
+
+  auto n_bins_total = cut.TotalBins();
+  const std::size_t n_index = row_ptr[rbegin + page.Size()];  // number of entries in this page
+  ResizeIndex(n_index, isDense_, static_cast<std::int32_t>(batch_threads));
+  if (isDense_) {
+    index.SetBinOffset(cut.Ptrs());
+    common::DispatchBinType(index.GetBinTypeSize(), [&](auto dtype) {
+      using T = decltype(dtype);
+      common::Span<T> index_data_span = {index.data<T>(), index.Size()};
+      SetIndexData(index_data_span, rbegin, ft, batch_threads, page, n_bins_total,
+                   index.MakeCompressor<T>());
+    });
+  } else {
+    // No feature-based compression, the global bin index is stored with the narrowest
+    // type that fits the total number of bins.
+    common::DispatchBinType(index.GetBinTypeSize(), [&](auto dtype) {
+      using T = decltype(dtype);
+      common::Span<T> index_data_span = {index.data<T>(), n_index};
+      SetIndexData(index_data_span, rbegin, ft, batch_threads, page, n_bins_total,
+                   [](auto idx, auto) { return static_cast<T>(idx); });
+    });
+  }
+  this->GatherHitCount(n_threads, n_bins_total);
+}
+
+void GHistIndexMatrix::Extend(SparsePage const &batch, common::Span<FeatureType const> ft,
+                              double sparse_thresh, std::int32_t n_threads) {
+  CHECK_EQ(base_rowid, 0) << "Cannot extend an external-memory page.";
+  auto const n_old = this->Size();
+  auto const prev_sum = row_ptr.empty() ? std::size_t{0} : row_ptr[n_old];
+
+  // Grow the row pointer, the prefix sum stays continuous across the old rows.
+  auto new_row_ptr = common::MakeFixedVecWithMalloc(n_old + batch.Size() + 1, std::size_t{0});
+  std::copy_n(row_ptr.cbegin(), row_ptr.size(), new_row_ptr.begin());
+  row_ptr = std::move(new_row_ptr);
+
+  hit_count_tloc_.clear();
+  hit_count_tloc_.resize(n_threads * cut.TotalBins(), 0);
+
+  auto page = batch.GetView();
+  auto it = common::MakeIndexTransformIter([&](std::size_t ridx) { return page[ridx].size(); });
+  common::PartialSum(n_threads, it, it + page.Size(), prev_sum, row_ptr.begin() + n_old);
+  PushBatchImpl(n_threads, page, n_old, ft);
+
+  // The column matrix is rebuilt from the grown index, no second sweep over the input.
+  if (columns_ && !std::isnan(sparse_thresh)) {
+    this->ResizeColumns(sparse_thresh);
+  }
+  this->ReportMemUsage();
 }
 
 GHistIndexMatrix::GHistIndexMatrix(SparsePage const &batch, common::Span<FeatureType const> ft,
@@ -113,6 +173,7 @@ GHistIndexMatrix::GHistIndexMatrix(SparsePage const &batch, common::Span<Feature
   if (!std::isnan(sparse_thresh)) {
     this->columns_->InitFromSparse(batch, *this, sparse_thresh, n_threads);
   }
+  this->ReportMemUsage();
 }
 
 template <typename Batch>
@@ -132,13 +193,19 @@ INSTANTIATION_PUSH(data::SparsePageAdapterBatch)
 INSTANTIATION_PUSH(data::ColumnarAdapterBatch)
 #undef INSTANTIATION_PUSH
 
+void GHistIndexMatrix::BuildColumns(Context const *ctx) {
+  CHECK(columns_);
+  this->columns_->InitFromGHist(ctx, *this);
+}
+
 void GHistIndexMatrix::ResizeColumns(double sparse_thresh) {
   CHECK(!std::isnan(sparse_thresh));
   this->columns_ = std::make_unique<common::ColumnMatrix>(*this, sparse_thresh);
 }
 
-void GHistIndexMatrix::ResizeIndex(const size_t n_index, const bool isDense) {
-  auto make_index = [this, n_index](auto t, common::BinTypeSize t_size) {
+void GHistIndexMatrix::ResizeIndex(const size_t n_index, const bool isDense,
+                                   std::int32_t n_threads) {
+  auto make_index = [this, n_index, n_threads](auto t, common::BinTypeSize t_size) {
     // Must resize instead of allocating a new one. This function is called everytime a
     // new batch is pushed, and we grow the size accordingly without loosing the data in
     // the previous batches.
@@ -150,7 +217,9 @@ void GHistIndexMatrix::ResizeIndex(const size_t n_index, const bool isDense) {
     decltype(this->data) new_vec;
     if (!resource) {
       CHECK(this->data.empty());
-      new_vec = common::MakeFixedVecWithMalloc(n_bytes, std::uint8_t{0});
+      // First-touch the storage with the same static thread partition that later fills
+      // and reads the index, so that pages land on the NUMA nodes of their readers.
+      new_vec = common::MakeFixedVecWithMalloc(n_bytes, std::uint8_t{0}, n_threads);
     } else {
       CHECK(resource->Type() == common::ResourceHandler::kMalloc);
       auto malloc_resource = std::dynamic_pointer_cast<common::MallocResource>(resource);
@@ -175,6 +244,14 @@ void GHistIndexMatrix::ResizeIndex(const size_t n_index, const bool isDense) {
              isDense) {
     // compress dense index to uint16
     make_index(std::uint16_t{}, common::kUint16BinsTypeSize);
+  } else if (!isDense &&
+             cut.TotalBins() - 1 <= static_cast<bst_bin_t>(std::numeric_limits<uint8_t>::max())) {
+    // The sparse index stores the global bin index, compress it when the total number of
+    // bins fits into a narrower type.
+    make_index(std::uint8_t{}, common::kUint8BinsTypeSize);
+  } else if (!isDense &&
+             cut.TotalBins() - 1 <= static_cast<bst_bin_t>(std::numeric_limits<uint16_t>::max())) {
+    make_index(std::uint16_t{}, common::kUint16BinsTypeSize);
   } else {
     // no compression
     make_index(std::uint32_t{}, common::kUint32BinsTypeSize);
@@ -189,7 +266,9 @@ common::ColumnMatrix const &GHistIndexMatrix::Transpose() const {
 bst_bin_t GHistIndexMatrix::GetGindex(size_t ridx, size_t fidx) const {
   auto begin = RowIdx(ridx);
   if (IsDense()) {
-    return static_cast<bst_bin_t>(this->index[begin + fidx]);
+    return common::DispatchDenseIndexView(this->index, this->index.OffsetSize(), [&](auto view) {
+      return static_cast<bst_bin_t>(view.Value(begin + fidx, fidx));
+    });
   }
   auto end = RowIdx(ridx + 1);
   auto const& cut_ptrs = cut.Ptrs();
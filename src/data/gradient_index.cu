@@ -2,6 +2,7 @@
  * Copyright 2022-2024, XGBoost Contributors
  */
 #include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
 #include <memory>   // for unique_ptr
 #include <vector>   // for vector
 
@@ -29,13 +30,28 @@ void SetIndexData(Context const* ctx, EllpackPageImpl const* page,
   hit_count_tloc.clear();
   hit_count_tloc.resize(ctx->Threads() * n_bins_total, 0);
   bool dense_compressed = page->IsDenseCompressed() && !page->IsDense();
+  auto stride = page->info.row_stride;
+  std::vector<std::vector<std::uint32_t>> decoded_tloc(ctx->Threads());
   common::ParallelFor(page->Size(), ctx->Threads(), [&](auto ridx) {
     auto tid = omp_get_thread_num();
-    size_t in_rbegin = page->info.row_stride * ridx;
     size_t out_rbegin = out->row_ptr[ridx];
+    // Expand the compressed row in one pass, per-element decoding defeats hardware
+    // prefetch.  Rows are only contiguous in the row-major layout.
+    auto& decoded = decoded_tloc[tid];
+    auto load_row = [&](std::size_t n) {
+      decoded.resize(n);
+      if (accessor.tile_rows == 0) {
+        accessor.gidx_iter.DecodeBlock(ridx * stride, n, decoded.data());
+      } else {
+        for (std::size_t j = 0; j < n; ++j) {
+          decoded[j] = accessor.gidx_iter[accessor.EntryIdx(ridx, j)];
+        }
+      }
+    };
     if (dense_compressed) {
-      for (std::size_t j = 0, k = 0; j < page->info.row_stride; ++j) {
-        bst_bin_t bin_idx = accessor.gidx_iter[in_rbegin + j];
+      load_row(stride);
+      for (std::size_t j = 0, k = 0; j < stride; ++j) {
+        auto bin_idx = static_cast<bst_bin_t>(decoded[j]);
         if (XGBOOST_EXPECT((bin_idx != kNull), true)) {  // relatively dense
           bin_idx = get_offset(bin_idx, j);
           index_data_span[out_rbegin + k++] = bin_idx;
@@ -44,8 +60,9 @@ void SetIndexData(Context const* ctx, EllpackPageImpl const* page,
       }
     } else {
       auto r_size = out->row_ptr[ridx + 1] - out->row_ptr[ridx];
+      load_row(r_size);
       for (size_t j = 0; j < r_size; ++j) {
-        bst_bin_t bin_idx = accessor.gidx_iter[in_rbegin + j];
+        auto bin_idx = static_cast<bst_bin_t>(decoded[j]);
         assert(bin_idx != kNull);
         index_data_span[out_rbegin + j] = bin_idx;
         ++hit_count_tloc[tid * n_bins_total + get_offset(bin_idx, j)];
@@ -65,11 +82,20 @@ void GetRowPtrFromEllpack(Context const* ctx, EllpackPageImpl const* page,
     auto accessor = page->GetHostAccessor(ctx, &h_gidx_buffer);
     auto const kNull = static_cast<bst_bin_t>(accessor.NullValue());
 
+    auto stride = page->info.row_stride;
+    std::vector<std::vector<std::uint32_t>> decoded_tloc(ctx->Threads());
     common::ParallelFor(page->Size(), ctx->Threads(), [&](auto i) {
-      size_t ibegin = page->info.row_stride * i;
-      for (size_t j = 0; j < page->info.row_stride; ++j) {
-        bst_bin_t bin_idx = accessor.gidx_iter[ibegin + j];
-        if (bin_idx != kNull) {
+      auto& decoded = decoded_tloc[omp_get_thread_num()];
+      decoded.resize(stride);
+      if (accessor.tile_rows == 0) {
+        accessor.gidx_iter.DecodeBlock(i * stride, stride, decoded.data());
+      } else {
+        for (std::size_t j = 0; j < stride; ++j) {
+          decoded[j] = accessor.gidx_iter[accessor.EntryIdx(i, j)];
+        }
+      }
+      for (size_t j = 0; j < stride; ++j) {
+        if (static_cast<bst_bin_t>(decoded[j]) != kNull) {
           row_ptr[i + 1]++;
         }
       }
@@ -108,9 +134,13 @@ GHistIndexMatrix::GHistIndexMatrix(Context const* ctx, MetaInfo const& info,
           [offset](bst_bin_t bin_idx, bst_feature_t fidx) { return bin_idx + offset[fidx]; }, this);
     });
   } else {
-    // no compression
-    ::xgboost::SetIndexData<uint32_t>(
-        ctx, page, &hit_count_tloc_, [&](auto bin_idx, auto) { return bin_idx; }, this);
+    // No feature-based compression, though the global bin index can still be stored with
+    // a narrower type.
+    common::DispatchBinType(this->index.GetBinTypeSize(), [&](auto dtype) {
+      using T = decltype(dtype);
+      ::xgboost::SetIndexData<T>(
+          ctx, page, &hit_count_tloc_, [&](auto bin_idx, auto) { return bin_idx; }, this);
+    });
   }
 
   this->hit_count = common::MakeFixedVecWithMalloc(n_bins_total, std::size_t{0});
@@ -125,5 +155,6 @@ GHistIndexMatrix::GHistIndexMatrix(Context const* ctx, MetaInfo const& info,
 
   this->columns_ = std::make_unique<common::ColumnMatrix>(*this, p.sparse_thresh);
   this->columns_->InitFromGHist(ctx, *this);
+  this->ReportMemUsage();
 }
 }  // namespace xgboost
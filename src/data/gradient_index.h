@@ -15,6 +15,7 @@
 #include "../common/categorical.h"
 #include "../common/error_msg.h"  // for InfInData
 #include "../common/hist_util.h"
+#include "../common/memory_stats.h"  // for MemoryUsageReporter
 #include "../common/numeric.h"
 #include "../common/ref_resource_view.h"  // for RefResourceView
 #include "../common/threading_utils.h"
@@ -95,6 +96,58 @@ class GHistIndexMatrix {
     CHECK(valid) << error::InfInData();
   }
 
+  /**
+   * @brief Fast path of SetIndexData for sparse pages.
+   *
+   * Entries are read straight from the raw CSR arrays of the page in row blocks
+   * instead of constructing a line object per row, which dominates the binning time
+   * when rows are short.  A sparse page only contains valid entries, so the validity
+   * predicate is dropped as well.
+   */
+  template <typename BinIdxType, typename GetOffset>
+  void SetIndexData(common::Span<BinIdxType> index_data_span, std::size_t rbegin,
+                    common::Span<FeatureType const> ft, std::size_t batch_threads,
+                    HostSparsePageView const& page, bst_bin_t n_bins_total,
+                    GetOffset&& get_offset) {
+    BinIdxType* index_data = index_data_span.data();
+    auto const& ptrs = cut.Ptrs();
+    auto const& values = cut.Values();
+    auto const* offset = page.offset.data();
+    auto const* entries = page.data.data();
+    bool const has_cat = cut.HasCategorical();
+    auto const n_rows = page.Size();
+    // Many short rows per task amortize the scheduling overhead.
+    std::size_t const n_blocks = batch_threads * 8;
+    std::size_t const block_size = (n_rows + n_blocks - 1) / n_blocks;
+    std::atomic<bool> valid{true};
+    common::ParallelFor(n_blocks, batch_threads, common::Sched::Guided(), [&](std::size_t blk) {
+      auto* hits = hit_count_tloc_.data() + omp_get_thread_num() * n_bins_total;
+      std::size_t const r_end = std::min(n_rows, (blk + 1) * block_size);
+      for (std::size_t i = blk * block_size; i < r_end; ++i) {
+        std::size_t const ibegin = row_ptr[rbegin + i];
+        auto const e_begin = offset[i];
+        auto const e_end = offset[i + 1];
+        for (auto e = e_begin; e < e_end; ++e) {
+          Entry const& elem = entries[e];
+          if (XGBOOST_EXPECT((std::isinf(elem.fvalue)), false)) {
+            valid = false;
+          }
+          bst_bin_t bin_idx{-1};
+          if (has_cat && common::IsCat(ft, elem.index)) {
+            bin_idx = cut.SearchCatBin(elem.fvalue, elem.index, ptrs, values);
+          } else {
+            bin_idx = cut.SearchBin(elem.fvalue, elem.index, ptrs, values);
+          }
+          auto const k = static_cast<std::size_t>(e - e_begin);
+          index_data[ibegin + k] = get_offset(bin_idx, k);
+          ++hits[bin_idx];
+        }
+      }
+    });
+
+    CHECK(valid) << error::InfInData();
+  }
+
   // Gather hit_count from all threads
   void GatherHitCount(int32_t n_threads, bst_bin_t n_bins_total) {
     CHECK_EQ(hit_count.size(), n_bins_total);
@@ -116,7 +169,7 @@ class GHistIndexMatrix {
 
     auto n_bins_total = cut.TotalBins();
     const size_t n_index = row_ptr[rbegin + batch.Size()];  // number of entries in this page
-    ResizeIndex(n_index, isDense_);
+    ResizeIndex(n_index, isDense_, static_cast<std::int32_t>(batch_threads));
     if (isDense_) {
       index.SetBinOffset(cut.Ptrs());
     }
@@ -128,14 +181,25 @@ class GHistIndexMatrix {
                      index.MakeCompressor<T>());
       });
     } else {
-      common::Span<uint32_t> index_data_span = {index.data<uint32_t>(), n_index};
-      // no compression
-      SetIndexData(index_data_span, rbegin, ft, batch_threads, batch, is_valid, n_bins_total,
-                   [](auto idx, auto) { return idx; });
+      // No feature-based compression, the global bin index is stored with the narrowest
+      // type that fits the total number of bins.
+      common::DispatchBinType(index.GetBinTypeSize(), [&](auto dtype) {
+        using T = decltype(dtype);
+        common::Span<T> index_data_span = {index.data<T>(), n_index};
+        SetIndexData(index_data_span, rbegin, ft, batch_threads, batch, is_valid, n_bins_total,
+                     [](auto idx, auto) { return static_cast<T>(idx); });
+      });
     }
     this->GatherHitCount(n_threads, n_bins_total);
   }
 
+  /**
+   * @brief Specialization of PushBatchImpl for sparse pages, dispatching to the raw
+   *        CSR fast path.
+   */
+  void PushBatchImpl(std::int32_t n_threads, HostSparsePageView const& page, std::size_t rbegin,
+                     common::Span<FeatureType const> ft);
+
   // The function is only created to avoid using the column matrix in the header.
   void ResizeColumns(double sparse_thresh);
 
@@ -221,14 +285,29 @@ class GHistIndexMatrix {
       // finished
       this->ResizeColumns(sparse_thresh);
     }
+    this->ReportMemUsage();
   }
 
   // Call ColumnMatrix::PushBatch
   template <typename Batch>
   void PushAdapterBatchColumns(Context const* ctx, Batch const& batch, float missing,
                                size_t rbegin);
+  /**
+   * @brief Fill the column matrix from the gradient index itself instead of pushing
+   *        adapter batches, so construction needs no second sweep over the input data.
+   */
+  void BuildColumns(Context const* ctx);
+  /**
+   * @brief Append rows to an in-core gradient index using the existing cuts.
+   *
+   * Only the new rows are quantized, no sketching is involved.  \p batch holds just the
+   * appended rows.  The column matrix is rebuilt from the grown index when \p
+   * sparse_thresh is valid.
+   */
+  void Extend(SparsePage const& batch, common::Span<FeatureType const> ft, double sparse_thresh,
+              std::int32_t n_threads);
 
-  void ResizeIndex(const size_t n_index, const bool isDense);
+  void ResizeIndex(const size_t n_index, const bool isDense, std::int32_t n_threads = 1);
 
   void GetFeatureCounts(size_t* counts) const {
     auto nfeature = cut.Ptrs().size() - 1;
@@ -252,6 +331,13 @@ class GHistIndexMatrix {
   [[nodiscard]] bst_idx_t Size() const { return row_ptr.empty() ? 0 : row_ptr.size() - 1; }
   [[nodiscard]] bst_feature_t Features() const { return cut.Ptrs().size() - 1; }
 
+  /** @brief Bytes held by the index storage, the column matrix reports separately. */
+  [[nodiscard]] std::size_t MemCostBytes() const {
+    return row_ptr.size_bytes() + data.size_bytes() + hit_count.size_bytes();
+  }
+  /** @brief Report the current footprint to the memory usage registry. */
+  void ReportMemUsage() { mem_usage_.Update(this->MemCostBytes()); }
+
   [[nodiscard]] bool ReadColumnPage(common::AlignedResourceReadStream* fi);
   [[nodiscard]] std::size_t WriteColumnPage(common::AlignedFileWriteStream* fo) const;
 
@@ -271,6 +357,7 @@ class GHistIndexMatrix {
   std::unique_ptr<common::ColumnMatrix> columns_;
   std::vector<size_t> hit_count_tloc_;
   bool isDense_;
+  common::MemoryUsageReporter mem_usage_{"GHistIndexMatrix"};
 };
 
 /**
@@ -291,21 +378,26 @@ void AssignColumnBinIndex(GHistIndexMatrix const& page, Fn&& assign) {
   common::DispatchBinType(page.index.GetBinTypeSize(), [&](auto t) {
     using BinT = decltype(t);
     auto const& index = page.index;
-    for (std::size_t ridx = 0; ridx < batch_size; ++ridx) {
-      auto r_beg = page.row_ptr[ridx];
-      auto r_end = page.row_ptr[ridx + 1];
-      bst_feature_t fidx{0};
-      if (dense) {
-        // compressed, use the operator to obtain the true value.
+    if (dense) {
+      // compressed, decode with a fixed-width view since the feature index is known.
+      common::DenseIndexView<BinT> view{index, ptrs.size() - 1};
+      for (std::size_t ridx = 0; ridx < batch_size; ++ridx) {
+        auto r_beg = page.row_ptr[ridx];
+        auto r_end = page.row_ptr[ridx + 1];
         for (std::size_t j = r_beg; j < r_end; ++j) {
           bst_feature_t fidx = j - r_beg;
-          std::uint32_t bin_idx = index[k];
+          std::uint32_t bin_idx = view.Value(k, fidx);
           assign(bin_idx, k, ridx, fidx);
           ++k;
         }
-      } else {
-        // not compressed
-        auto const* row_index = index.data<BinT>() + page.row_ptr[page.base_rowid];
+      }
+    } else {
+      // not compressed
+      auto const* row_index = index.data<BinT>() + page.row_ptr[page.base_rowid];
+      for (std::size_t ridx = 0; ridx < batch_size; ++ridx) {
+        auto r_beg = page.row_ptr[ridx];
+        auto r_end = page.row_ptr[ridx + 1];
+        bst_feature_t fidx{0};
         for (std::size_t j = r_beg; j < r_end; ++j) {
           std::uint32_t bin_idx = row_index[k];
           // find the feature index for current bin.
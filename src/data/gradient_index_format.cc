@@ -62,6 +62,7 @@ namespace xgboost::data {
   if (!page->ReadColumnPage(fi)) {
     return false;
   }
+  page->ReportMemUsage();
   return true;
 }
 
@@ -100,6 +100,24 @@ class ExtGradientIndexPageSource
     this->SetCuts(std::move(cuts));
     this->Fetch();
   }
+  /**
+   * @brief Construct from a cache restored from a manifest.  Only reads the written
+   *        pages, the user iterator is never consumed.
+   */
+  ExtGradientIndexPageSource(Context const* ctx, float missing, MetaInfo* info,
+                             std::shared_ptr<Cache> cache, BatchParam param,
+                             common::HistogramCuts cuts, std::vector<bst_idx_t> base_rows)
+      : ExtQantileSourceMixin{missing, ctx->Threads(), static_cast<bst_feature_t>(info->num_col_),
+                              nullptr, std::move(cache)},
+        p_{std::move(param)},
+        ctx_{ctx},
+        proxy_{nullptr},
+        info_{info},
+        base_rows_{std::move(base_rows)} {
+    CHECK(this->cache_info_->written);
+    this->SetCuts(std::move(cuts));
+    this->Fetch();
+  }
 
   void Fetch() final;
 };
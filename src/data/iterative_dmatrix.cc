@@ -5,12 +5,14 @@
 
 #include <algorithm>  // for copy
 #include <cstddef>    // for size_t
+#include <future>     // for future
 #include <memory>     // for shared_ptr
 #include <utility>    // for move
 #include <vector>     // for vector
 
 #include "../common/categorical.h"  // common::IsCat
 #include "../common/hist_util.h"    // for HistogramCuts
+#include "../common/threadpool.h"   // for ThreadPool
 #include "../tree/param.h"          // FIXME(jiamingy): Find a better way to share this parameter.
 #include "batch_utils.h"            // for RegenGHist
 #include "gradient_index.h"         // for GHistIndexMatrix
@@ -81,20 +83,45 @@ void IterativeDMatrix::InitFromCPU(Context const* ctx, BatchParam const& p,
   std::size_t rbegin = 0;
   std::size_t prev_sum = 0;
   std::size_t i = 0;
+  auto ft = common::Span<FeatureType const>{h_ft};
+  // Pipeline the iterator with the binning.  The adapter batch references proxy-owned
+  // memory that the next call to the iterator invalidates, so each batch is staged into
+  // an owned page first (dropping the invalid entries), then binned on a background
+  // worker while the iterator produces the next batch.  The bin search against the
+  // fixed cuts dominates the staging copy, and the producer I/O overlaps with it.
+  common::ThreadPool binner{StringView{"gidx-bin"}, 1, [] {}};
+  std::future<void> pending;
   while (iter.Next()) {
+    // Wait out the previous batch, only one staged page is alive at a time.
+    if (pending.valid()) {
+      pending.get();
+    }
+    auto page = std::make_shared<SparsePage>();
     HostAdapterDispatch(proxy, [&](auto const& batch) {
       proxy->Info().num_nonzero_ = ext_info.batch_nnz[i];
-      this->ghist_->PushAdapterBatch(ctx, rbegin, prev_sum, batch, missing, h_ft, p.sparse_thresh,
-                                     Info().num_row_);
+      page->Push(batch, missing, ctx->Threads());
     });
     if (ext_info.n_batches != 1) {
       this->info_.Extend(std::move(proxy->Info()), false, true);
     }
-    auto batch_size = BatchSamples(proxy);
-    prev_sum = this->ghist_->row_ptr[rbegin + batch_size];
+    // The staged page holds only valid entries, so the shape of the next batch is known
+    // without waiting for its bin indices.
+    auto batch_size = page->Size();
+    auto batch_nnz = page->data.Size();
+    pending = binner.Submit([this, ctx, page, rbegin, prev_sum, missing, ft,
+                             sparse_thresh = p.sparse_thresh, n_samples = Info().num_row_] {
+      auto view = page->GetView();
+      data::SparsePageAdapterBatch adapter_batch{view};
+      this->ghist_->PushAdapterBatch(ctx, rbegin, prev_sum, adapter_batch, missing, ft,
+                                     sparse_thresh, n_samples);
+    });
+    prev_sum += batch_nnz;
     rbegin += batch_size;
     ++i;
   }
+  if (pending.valid()) {
+    pending.get();
+  }
   iter.Reset();
   CHECK_EQ(rbegin, Info().num_row_);
   CHECK_EQ(this->ghist_->Features(), Info().num_col_);
@@ -102,15 +129,13 @@ void IterativeDMatrix::InitFromCPU(Context const* ctx, BatchParam const& p,
   /**
    * Generate column matrix
    */
-  bst_idx_t accumulated_rows = 0;
-  while (iter.Next()) {
-    HostAdapterDispatch(proxy, [&](auto const& batch) {
-      this->ghist_->PushAdapterBatchColumns(ctx, batch, missing, accumulated_rows);
-    });
-    accumulated_rows += BatchSamples(proxy);
+  if (Info().num_row_ != 0) {
+    // Fill the column matrix from the gradient index instead of sweeping the external
+    // iterator a second time; re-running the iterator forces the caller to materialize
+    // every batch again, which drives the peak construction memory.  Same approach as
+    // the GPU path, which builds columns from the ellpack index.
+    this->ghist_->BuildColumns(ctx);
   }
-  iter.Reset();
-  CHECK_EQ(accumulated_rows, Info().num_row_);
 
   if (ext_info.n_batches == 1) {
     this->info_ = std::move(proxy->Info());
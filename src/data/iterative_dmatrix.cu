@@ -59,7 +59,7 @@ void IterativeDMatrix::InitFromCUDA(Context const* ctx, BatchParam const& p,
   /**
    * Generate gradient index.
    */
-  bst_idx_t offset = 0;
+  bst_idx_t base_rowid = 0;
   iter.Reset();
   bst_idx_t n_batches_for_verification = 0;
   while (iter.Next()) {
@@ -71,17 +71,16 @@ void IterativeDMatrix::InitFromCUDA(Context const* ctx, BatchParam const& p,
     cuda_impl::Dispatch(proxy, [=](auto const& value) {
       return GetRowCounts(ctx, value, row_counts_span, dh::GetDevice(ctx), missing);
     });
-    auto is_dense = this->IsDense();
 
     proxy->Info().feature_types.SetDevice(dh::GetDevice(ctx));
     auto d_feature_types = proxy->Info().feature_types.ConstDeviceSpan();
-    auto new_impl = cuda_impl::Dispatch(proxy, [&](auto const& value) {
-      return EllpackPageImpl{
-          &fmat_ctx_,          value, missing, is_dense, row_counts_span, d_feature_types,
-          ext_info.row_stride, rows,  cuts};
+    // Write the batch directly into its final position instead of staging a temporary
+    // page, the construction would otherwise hold the batch's gradient index twice.
+    cuda_impl::Dispatch(proxy, [&](auto const& value) {
+      ellpack_->Impl()->PushAdapterBatch(&fmat_ctx_, value, missing, row_counts_span,
+                                         d_feature_types, base_rowid);
     });
-    bst_idx_t num_elements = ellpack_->Impl()->Copy(&fmat_ctx_, &new_impl, offset);
-    offset += num_elements;
+    base_rowid += rows;
 
     proxy->Info().num_row_ = BatchSamples(proxy);
     proxy->Info().num_col_ = ext_info.n_features;
@@ -4,7 +4,7 @@
 #include <algorithm>  // for max
 #include <limits>     // for numeric_limits
 #include <numeric>    // for partial_sum
-#include <utility>    // for pair
+#include <memory>     // for unique_ptr, make_unique
 #include <vector>     // for vector
 
 #include "../collective/allreduce.h"    // for Allreduce
@@ -38,21 +38,28 @@ void MakeSketches(Context const* ctx,
    * elements. For GPU, we process the data in batches. As a result, the implementation
    * here simply uses the user input batch as the basic unit of sketching blocks. The
    * number of blocks per-level grows exponentially.
+   *
+   * Device memory is bounded by spilling: once a level is pruned it's frozen and staged
+   * in pinned host memory, so only the active (unpruned) sketch stays device resident.
+   * Frozen summaries are streamed back one at a time for the final merge.
    */
-  std::vector<std::pair<std::unique_ptr<common::SketchContainer>, bst_idx_t>> sketches;
+  std::vector<common::HostSketchSummary> frozen;  // pruned levels, oldest first
+  std::unique_ptr<common::SketchContainer> sketch;  // the active level
+  bst_idx_t n_blocks = 0;  // number of blocks pushed into the active level
   auto& ext_info = *p_ext_info;
 
   auto lazy_init_sketch = [&] {
     // Lazy because we need the `n_features`.
-    sketches.emplace_back(std::make_unique<common::SketchContainer>(
-                              proxy->Info().feature_types, p.max_bin, ext_info.n_features,
-                              data::BatchSamples(proxy), dh::GetDevice(ctx)),
-                          0);
+    sketch = std::make_unique<common::SketchContainer>(proxy->Info().feature_types, p.max_bin,
+                                                       ext_info.n_features,
+                                                       data::BatchSamples(proxy),
+                                                       dh::GetDevice(ctx));
+    n_blocks = 0;
   };
   auto total_capacity = [&] {
-    bst_idx_t n_bytes = 0;
-    for (auto const& sk : sketches) {
-      n_bytes += sk.first->MemCapacityBytes();
+    bst_idx_t n_bytes = sketch ? sketch->MemCapacityBytes() : 0;
+    for (auto const& s : frozen) {
+      n_bytes += s.MemCostBytes();
     }
     return n_bytes;
   };
@@ -93,26 +100,25 @@ void MakeSketches(Context const* ctx,
     if (!ref) {
       CHECK_LE(max_quantile_blocks, std::numeric_limits<bst_idx_t>::max());
       CHECK_GT(max_quantile_blocks, 0) << "`max_quantile_blocks` must be greater than 0.";
-      if (sketches.empty()) {
+      if (!sketch) {
         lazy_init_sketch();
       }
-      if (sketches.back().second > (1ul << (sketches.size() - 1)) ||
-          sketches.back().second == static_cast<bst_idx_t>(max_quantile_blocks)) {
+      if (n_blocks > (1ul << frozen.size()) ||
+          n_blocks == static_cast<bst_idx_t>(max_quantile_blocks)) {
         // Cut the sub-stream.
         auto n_cuts_per_feat =
             common::detail::RequiredSampleCutsPerColumn(p.max_bin, ext_info.accumulated_rows);
-        // Prune to a single block
-        sketches.back().first->Prune(p_ctx, n_cuts_per_feat);
-        sketches.back().first->ShrinkToFit();
+        // Prune to a single block, then spill the frozen level to the host.
+        sketch->Prune(p_ctx, n_cuts_per_feat);
+        sketch->ShrinkToFit();
+        frozen.emplace_back(p_ctx, *sketch);
 
-        sketches.back().second = 1;
-        lazy_init_sketch();  // Add a new level.
+        lazy_init_sketch();  // Add a new level, releases the spilled device buffers.
       }
       proxy->Info().weights_.SetDevice(dh::GetDevice(ctx));
       Dispatch(proxy, [&](auto const& value) {
-        common::AdapterDeviceSketch(p_ctx, value, p.max_bin, proxy->Info(), missing,
-                                    sketches.back().first.get());
-        sketches.back().second++;
+        common::AdapterDeviceSketch(p_ctx, value, p.max_bin, proxy->Info(), missing, sketch.get());
+        n_blocks++;
       });
       LOG(DEBUG) << "Total capacity:" << common::HumanMemUnit(total_capacity());
     }
@@ -140,25 +146,30 @@ void MakeSketches(Context const* ctx,
   curt::SetDevice(dh::GetDevice(ctx).ordinal);
   if (!ref) {
     HostDeviceVector<FeatureType> ft;
-    common::SketchContainer final_sketch(
-        sketches.empty() ? ft : sketches.front().first->FeatureTypes(), p.max_bin,
-        ext_info.n_features, ext_info.accumulated_rows, dh::GetDevice(ctx));
-    // Reverse order since the last container might contain summary that's not yet pruned.
-    for (auto it = sketches.crbegin(); it != sketches.crend(); ++it) {
-      auto& sketch = *it;
-
-      CHECK_GE(sketch.second, 1);
-      if (sketch.second > 1) {
-        sketch.first->Prune(p_ctx, common::detail::RequiredSampleCutsPerColumn(
-                                       p.max_bin, ext_info.accumulated_rows));
-        sketch.first->ShrinkToFit();
+    common::SketchContainer final_sketch(sketch ? sketch->FeatureTypes() : ft, p.max_bin,
+                                         ext_info.n_features, ext_info.accumulated_rows,
+                                         dh::GetDevice(ctx));
+    // The active level first since it might contain summary that's not yet pruned.
+    if (sketch) {
+      CHECK_GE(n_blocks, 1);
+      if (n_blocks > 1) {
+        sketch->Prune(p_ctx, common::detail::RequiredSampleCutsPerColumn(
+                                 p.max_bin, ext_info.accumulated_rows));
+        sketch->ShrinkToFit();
       }
-      final_sketch.Merge(p_ctx, sketch.first->ColumnsPtr(), sketch.first->Data());
+      final_sketch.Merge(p_ctx, sketch->ColumnsPtr(), sketch->Data());
+      final_sketch.FixError();
+      sketch.reset();
+    }
+    // Stream the frozen summaries back one at a time, newest level first to keep the
+    // original reverse merge order.
+    for (auto it = frozen.crbegin(); it != frozen.crend(); ++it) {
+      it->MergeInto(p_ctx, &final_sketch);
       final_sketch.FixError();
     }
 
-    sketches.clear();
-    sketches.shrink_to_fit();
+    frozen.clear();
+    frozen.shrink_to_fit();
 
     final_sketch.MakeCuts(ctx, cuts.get(), info.IsColumnSplit());
   } else {
@@ -7,6 +7,7 @@
 #include "simple_dmatrix.h"
 
 #include <algorithm>
+#include <cmath>    // for isnan
 #include <limits>
 #include <numeric>  // for accumulate
 #include <type_traits>
@@ -15,6 +16,7 @@
 #include "../collective/communicator-inl.h"  // for GetWorldSize, GetRank, Allgather
 #include "../collective/allgather.h"
 #include "../common/error_msg.h"             // for InconsistentMaxBin
+#include "../tree/param.h"                   // FIXME(jiamingy): Find a better way to share this parameter.
 #include "./simple_batch_iterator.h"
 #include "adapter.h"
 #include "batch_utils.h"   // for CheckEmpty, RegenGHist
@@ -128,6 +130,37 @@ BatchSet<SortedCSCPage> SimpleDMatrix::GetSortedColumnBatches(Context const* ctx
   return BatchSet<SortedCSCPage>(begin_iter);
 }
 
+BatchSet<SortedCSCPage> SimpleDMatrix::GetSortedColumnBatches(
+    Context const* ctx, std::vector<bst_feature_t> const& selected) {
+  // The full transpose subsumes any subset.
+  if (sorted_column_page_) {
+    return this->GetSortedColumnBatches(ctx);
+  }
+  auto is_covered = [&] {
+    if (!sorted_column_subset_page_) {
+      return false;
+    }
+    return std::all_of(selected.cbegin(), selected.cend(), [&](bst_feature_t fidx) {
+      return std::binary_search(sorted_column_subset_.cbegin(), sorted_column_subset_.cend(), fidx);
+    });
+  };
+  if (!is_covered()) {
+    auto n = std::numeric_limits<decltype(Entry::index)>::max();
+    if (this->sparse_page_->Size() > n) {
+      error::MaxSampleSize(n);
+    }
+    sorted_column_subset_page_.reset(new SortedCSCPage(
+        sparse_page_->GetTranspose(info_.num_col_, ctx->Threads(),
+                                   common::Span<bst_feature_t const>{selected})));
+    sorted_column_subset_page_->SortRows(ctx->Threads());
+    sorted_column_subset_ = selected;
+    std::sort(sorted_column_subset_.begin(), sorted_column_subset_.end());
+  }
+  auto begin_iter = BatchIterator<SortedCSCPage>(
+      new SimpleBatchIteratorImpl<SortedCSCPage>(sorted_column_subset_page_));
+  return BatchSet<SortedCSCPage>(begin_iter);
+}
+
 BatchSet<EllpackPage> SimpleDMatrix::GetEllpackBatches(Context const* ctx,
                                                        const BatchParam& param) {
   detail::CheckEmpty(batch_param_, param);
@@ -327,6 +360,110 @@ SimpleDMatrix::SimpleDMatrix(AdapterT* adapter, float missing, int nthread,
   this->fmat_ctx_ = ctx;
 }
 
+template <typename AdapterT>
+void SimpleDMatrix::Extend(AdapterT* adapter, float missing, int nthread) {
+  CHECK(info_.data_split_mode != DataSplitMode::kCol)
+      << "Cannot extend a DMatrix under column-wise data split.";
+  Context ctx;
+  ctx.Init(Args{{"nthread", std::to_string(nthread)}});
+
+  auto& offset_vec = sparse_page_->offset.HostVector();
+  auto& data_vec = sparse_page_->data.HostVector();
+  bst_idx_t const n_old_rows = info_.num_row_;
+  std::size_t const n_old_entries = data_vec.size();
+
+  uint64_t inferred_num_columns = 0;
+  uint64_t total_batch_size = 0;
+  adapter->BeforeFirst();
+  while (adapter->Next()) {
+    auto& batch = adapter->Value();
+    auto batch_max_columns = sparse_page_->Push(batch, missing, ctx.Threads());
+    inferred_num_columns = std::max(batch_max_columns, inferred_num_columns);
+    total_batch_size += batch.Size();
+    // Append meta information if available
+    if (batch.Labels() != nullptr) {
+      info_.labels.ModifyInplace([&](auto* data, common::Span<size_t, 2> shape) {
+        shape[1] = 1;
+        auto& labels = data->HostVector();
+        labels.insert(labels.end(), batch.Labels(), batch.Labels() + batch.Size());
+        shape[0] += batch.Size();
+      });
+    }
+    if (batch.Weights() != nullptr) {
+      auto& weights = info_.weights_.HostVector();
+      weights.insert(weights.end(), batch.Weights(), batch.Weights() + batch.Size());
+    }
+    CHECK(batch.Qid() == nullptr) << "Cannot append rows with query IDs.";
+    CHECK(batch.BaseMargin() == nullptr) << "Cannot append rows with a base margin.";
+  }
+
+  uint64_t const n_new_columns = adapter->NumColumns() == kAdapterUnknownSize
+                                     ? inferred_num_columns
+                                     : adapter->NumColumns();
+  if (gradient_index_) {
+    CHECK_LE(n_new_columns, info_.num_col_)
+        << "Cannot add new features to a DMatrix with a gradient index, the cuts are "
+           "per-feature.";
+  }
+  info_.num_col_ = std::max(info_.num_col_, n_new_columns);
+
+  bst_idx_t const n_new_rows =
+      adapter->NumRows() == kAdapterUnknownSize ? total_batch_size : adapter->NumRows();
+  if (offset_vec.empty()) {
+    offset_vec.emplace_back(0);
+  }
+  while (offset_vec.size() - 1 < n_old_rows + n_new_rows) {
+    offset_vec.emplace_back(offset_vec.back());
+  }
+  info_.num_row_ = n_old_rows + n_new_rows;
+  info_.num_nonzero_ = data_vec.size();
+
+  if (!sparse_page_->IsIndicesSorted(ctx.Threads())) {
+    sparse_page_->SortIndices(ctx.Threads());
+  }
+
+  // Transposed views and the ellpack are rebuilt lazily on the next request.
+  column_page_.reset();
+  sorted_column_page_.reset();
+  sorted_column_subset_page_.reset();
+  sorted_column_subset_.clear();
+  ellpack_page_.reset();
+
+  if (gradient_index_) {
+    bool const appended_dense =
+        data_vec.size() - n_old_entries == n_new_rows * info_.num_col_;
+    bool const can_extend = !std::isnan(batch_param_.sparse_thresh) && !batch_param_.regen &&
+                            (!gradient_index_->IsDense() || appended_dense);
+    if (can_extend) {
+      // Quantize only the appended rows with the existing cuts.
+      SparsePage delta;
+      auto& delta_offset = delta.offset.HostVector();
+      auto& delta_data = delta.data.HostVector();
+      delta_offset.resize(n_new_rows + 1);
+      for (bst_idx_t i = 0; i <= n_new_rows; ++i) {
+        delta_offset[i] = offset_vec[n_old_rows + i] - offset_vec[n_old_rows];
+      }
+      delta_data.assign(data_vec.begin() + offset_vec[n_old_rows], data_vec.end());
+      gradient_index_->Extend(delta, info_.feature_types.ConstHostSpan(),
+                              batch_param_.sparse_thresh, ctx.Threads());
+    } else {
+      // Fall back to a lazy rebuild on the next request.
+      gradient_index_.reset();
+    }
+  }
+}
+
+template void SimpleDMatrix::Extend(DenseAdapter* adapter, float missing, int nthread);
+template void SimpleDMatrix::Extend(ArrayAdapter* adapter, float missing, int nthread);
+template void SimpleDMatrix::Extend(CSRAdapter* adapter, float missing, int nthread);
+template void SimpleDMatrix::Extend(CSRArrayAdapter* adapter, float missing, int nthread);
+template void SimpleDMatrix::Extend(DataTableAdapter* adapter, float missing, int nthread);
+template void SimpleDMatrix::Extend(FileAdapter* adapter, float missing, int nthread);
+template void SimpleDMatrix::Extend(ColumnarAdapter* adapter, float missing, int nthread);
+template void SimpleDMatrix::Extend(
+    IteratorAdapter<DataIterHandle, XGBCallbackDataIterNext, XGBoostBatchCSR>* adapter,
+    float missing, int nthread);
+
 SimpleDMatrix::SimpleDMatrix(dmlc::Stream* in_stream) {
   int tmagic;
   CHECK(in_stream->Read(&tmagic)) << "invalid input file format";
@@ -336,6 +473,42 @@ SimpleDMatrix::SimpleDMatrix(dmlc::Stream* in_stream) {
   in_stream->Read(&sparse_page_->data.HostVector());
 }
 
+SimpleDMatrix* SimpleDMatrix::FromQuantileCut(common::HistogramCuts&& cuts, bst_bin_t max_bin,
+                                              std::vector<FeatureType> const& feature_types) {
+  auto n_features = cuts.NumFeatures();
+  CHECK_GE(n_features, 1) << "Invalid histogram cuts.";
+
+  auto out = std::make_unique<SimpleDMatrix>();
+  out->info_.num_col_ = n_features;
+  if (!feature_types.empty()) {
+    CHECK_EQ(feature_types.size(), n_features)
+        << "Invalid feature types, different number of features.";
+    out->info_.feature_types.HostVector() = feature_types;
+  }
+  out->gradient_index_ = std::make_shared<GHistIndexMatrix>(
+      /*n_samples=*/0, /*base_rowid=*/0, std::move(cuts), max_bin, /*is_dense=*/false);
+  // Match the hardcoded sketch parameter of `QuantileDMatrix` so that the forbid_regen
+  // check in GetGradientIndex accepts this matrix as a reference.
+  out->batch_param_ = BatchParam{max_bin, tree::TrainParam::DftSparseThreshold()};
+  return out.release();
+}
+
+void SimpleDMatrix::ReuseQuantileCuts(common::HistogramCuts const& cuts, bst_bin_t max_bin) {
+  CHECK_EQ(cuts.NumFeatures(), info_.num_col_)
+      << "Quantile cuts can only be reused between data with the same features.";
+  CHECK_GE(max_bin, 2);
+  if (gradient_index_ && gradient_index_->cut == cuts) {
+    // Already binned the same way, nothing to rebuild.
+    return;
+  }
+  auto ctx = fmat_ctx_.IsCPU() ? fmat_ctx_ : fmat_ctx_.MakeCPU();
+  auto sparse_thresh = tree::TrainParam::DftSparseThreshold();
+  gradient_index_ = std::make_shared<GHistIndexMatrix>(
+      *sparse_page_, info_.feature_types.ConstHostSpan(), cuts, max_bin, this->IsDense(),
+      sparse_thresh, ctx.Threads());
+  batch_param_ = BatchParam{max_bin, sparse_thresh};
+}
+
 void SimpleDMatrix::SaveToLocalFile(const std::string& fname) {
   std::unique_ptr<dmlc::Stream> fo(dmlc::Stream::Create(fname.c_str(), "w"));
   int tmagic = kMagic;
@@ -27,8 +27,40 @@ class SimpleDMatrix : public DMatrix {
   explicit SimpleDMatrix(dmlc::Stream* in_stream);
   ~SimpleDMatrix() override = default;
 
+  /**
+   * \brief Append rows from an adapter without rebuilding the existing data.
+   *
+   * The sparse page is extended in place and the meta info is updated incrementally.
+   * Cached transposed views are dropped and rebuilt lazily on the next request.  An
+   * existing gradient index is grown using its cuts, so no new sketch is run; when the
+   * appended rows are incompatible with the cached index (e.g. density changed under a
+   * dense index) it is dropped instead and regenerated on the next request.
+   */
+  template <typename AdapterT>
+  void Extend(AdapterT* adapter, float missing, int nthread);
+
   void SaveToLocalFile(const std::string& fname);
 
+  /**
+   * \brief Create a DMatrix that carries only pre-computed histogram cuts.
+   *
+   * The result has no rows, it exists solely to be used as the reference of a
+   * `QuantileDMatrix` so that construction can reuse the cuts instead of running a new
+   * sketch.  \p max_bin must match the `max_bin` used for training.
+   */
+  static SimpleDMatrix* FromQuantileCut(common::HistogramCuts&& cuts, bst_bin_t max_bin,
+                                        std::vector<FeatureType> const& feature_types);
+
+  /**
+   * \brief Build the gradient index from existing histogram cuts, skipping the sketch.
+   *
+   * Used when the training data is swapped on a live booster (e.g. curriculum stages):
+   * the new stage is quantized against the cuts of the previous stage so that only the
+   * index itself has to be rebuilt.  A cached index whose cuts are already equal is
+   * kept as is.  \p max_bin must match the `max_bin` used for training.
+   */
+  void ReuseQuantileCuts(common::HistogramCuts const& cuts, bst_bin_t max_bin);
+
   MetaInfo& Info() override;
   const MetaInfo& Info() const override;
   Context const* Ctx() const override { return &fmat_ctx_; }
@@ -43,6 +75,8 @@ class SimpleDMatrix : public DMatrix {
   BatchSet<SparsePage> GetRowBatches() override;
   BatchSet<CSCPage> GetColumnBatches(Context const* ctx) override;
   BatchSet<SortedCSCPage> GetSortedColumnBatches(Context const* ctx) override;
+  BatchSet<SortedCSCPage> GetSortedColumnBatches(
+      Context const* ctx, std::vector<bst_feature_t> const& selected) override;
   BatchSet<EllpackPage> GetEllpackBatches(Context const* ctx, const BatchParam& param) override;
   BatchSet<GHistIndexMatrix> GetGradientIndex(Context const* ctx, const BatchParam& param) override;
   BatchSet<ExtSparsePage> GetExtBatches(Context const* ctx, BatchParam const& param) override;
@@ -52,6 +86,10 @@ class SimpleDMatrix : public DMatrix {
   std::shared_ptr<SparsePage> sparse_page_ = std::make_shared<SparsePage>();
   std::shared_ptr<CSCPage> column_page_{nullptr};
   std::shared_ptr<SortedCSCPage> sorted_column_page_{nullptr};
+  // Transpose restricted to the last requested feature subset.  Rebuilt whenever a
+  // request is not covered by the cached subset, so only one subset is alive at a time.
+  std::shared_ptr<SortedCSCPage> sorted_column_subset_page_{nullptr};
+  std::vector<bst_feature_t> sorted_column_subset_;
   std::shared_ptr<EllpackPage> ellpack_page_{nullptr};
   std::shared_ptr<GHistIndexMatrix> gradient_index_{nullptr};
   BatchParam batch_param_;
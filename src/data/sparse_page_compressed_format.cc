@@ -0,0 +1,248 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ * \file sparse_page_compressed_format.cc
+ *  Bit-packed binary format of sparse page for external memory.
+ */
+#include <algorithm>  // for max, min
+#include <cmath>      // for lround
+#include <cstdint>    // for uint8_t, uint16_t, uint32_t, uint64_t
+#include <limits>     // for numeric_limits
+#include <vector>     // for vector
+
+#include <dmlc/registry.h>
+
+#include "../common/compressed_iterator.h"  // for CompressedBufferWriter, CompressedIterator
+#include "../common/io.h"                 // for AlignedResourceReadStream, AlignedFileWriteStream
+#include "../common/ref_resource_view.h"  // for ReadVec, WriteVec
+#include "./sparse_page_writer.h"
+#include "xgboost/data.h"
+#include "xgboost/logging.h"
+
+namespace xgboost::data {
+DMLC_REGISTRY_FILE_TAG(sparse_page_compressed_format);
+
+namespace {
+// How `Entry::index` is stored on disk.
+enum IndexEncoding : std::uint8_t {
+  kRawIndex = 0,     // plain 32-bit indices
+  kPacked = 1,       // bit-packed indices
+  kPackedDelta = 2,  // bit-packed deltas between consecutive indices of a segment
+};
+// How `Entry::fvalue` is stored on disk.
+enum ValueEncoding : std::uint8_t {
+  kF32 = 0,       // plain 32-bit floats
+  kQuantU16 = 1,  // 16-bit linear quantization with a per-page range
+};
+// The `CompressedBufferWriter` is limited to 28-bit symbols.
+constexpr std::uint64_t kMaxSymbols = 1ULL << 28;
+}  // namespace
+
+/**
+ * @brief Compressed counterpart of the raw format, trading CPU decode for less I/O.
+ *
+ * Indices within a row (or a column for the CSC pages) are non-decreasing, so they are
+ * delta-encoded per segment and bit-packed with the width of the largest symbol.  Values
+ * are stored as plain floats by default; the quantized variant rounds them to a 16-bit
+ * linear grid over the page's value range and must be requested explicitly since it's
+ * lossy.
+ */
+template <typename T>
+class SparsePageCompressedFormat : public SparsePageFormat<T> {
+ public:
+  explicit SparsePageCompressedFormat(bool quantize_values) : quantize_values_{quantize_values} {}
+
+  bool Read(T* page, common::AlignedResourceReadStream* fi) override {
+    auto& offset_vec = page->offset.HostVector();
+    if (!common::ReadVec(fi, &offset_vec)) {
+      return false;
+    }
+    CHECK_NE(page->offset.Size(), 0U) << "Invalid SparsePage file";
+    auto& data_vec = page->data.HostVector();
+    data_vec.resize(offset_vec.back());
+    auto n = data_vec.size();
+
+    std::uint8_t index_enc{kRawIndex};
+    if (!fi->Read(&index_enc, sizeof(index_enc))) {
+      return false;
+    }
+    if (index_enc == kRawIndex) {
+      std::vector<bst_feature_t> indices;
+      if (!common::ReadVec(fi, &indices) || indices.size() != n) {
+        return false;
+      }
+      for (std::size_t i = 0; i < n; ++i) {
+        data_vec[i].index = indices[i];
+      }
+    } else {
+      std::uint64_t n_symbols{0};
+      if (!fi->Read(&n_symbols)) {
+        return false;
+      }
+      std::vector<common::CompressedByteT> buffer;
+      if (!common::ReadVec(fi, &buffer)) {
+        return false;
+      }
+      if (n != 0) {
+        common::CompressedIterator<std::uint32_t> it{buffer.data(), n_symbols};
+        // Expand a block of symbols at a time, per-element decoding is too slow for the
+        // read path.
+        constexpr std::size_t kBlockSize = 256;
+        std::uint32_t block[kBlockSize];
+        for (std::size_t i = 0; i < n; i += kBlockSize) {
+          auto m = std::min(kBlockSize, n - i);
+          it.DecodeBlock(i, m, block);
+          for (std::size_t j = 0; j < m; ++j) {
+            data_vec[i + j].index = block[j];
+          }
+        }
+        if (index_enc == kPackedDelta) {
+          for (std::size_t i = 0; i + 1 < offset_vec.size(); ++i) {
+            bst_feature_t prev{0};
+            for (auto j = offset_vec[i]; j < offset_vec[i + 1]; ++j) {
+              prev += data_vec[j].index;
+              data_vec[j].index = prev;
+            }
+          }
+        }
+      }
+    }
+
+    std::uint8_t value_enc{kF32};
+    if (!fi->Read(&value_enc, sizeof(value_enc))) {
+      return false;
+    }
+    if (value_enc == kQuantU16) {
+      float lo{0}, scale{0};
+      if (!fi->Read(&lo, sizeof(lo)) || !fi->Read(&scale, sizeof(scale))) {
+        return false;
+      }
+      std::vector<std::uint16_t> codes;
+      if (!common::ReadVec(fi, &codes) || codes.size() != n) {
+        return false;
+      }
+      for (std::size_t i = 0; i < n; ++i) {
+        data_vec[i].fvalue = lo + scale * codes[i];
+      }
+    } else {
+      std::vector<float> values;
+      if (!common::ReadVec(fi, &values) || values.size() != n) {
+        return false;
+      }
+      for (std::size_t i = 0; i < n; ++i) {
+        data_vec[i].fvalue = values[i];
+      }
+    }
+
+    return fi->Read(&page->base_rowid, sizeof(page->base_rowid));
+  }
+
+  std::size_t Write(const T& page, common::AlignedFileWriteStream* fo) override {
+    auto const& offset_vec = page.offset.HostVector();
+    auto const& data_vec = page.data.HostVector();
+    CHECK(page.offset.Size() != 0 && offset_vec[0] == 0);
+    CHECK_EQ(offset_vec.back(), page.data.Size());
+    auto n = data_vec.size();
+
+    std::size_t bytes{0};
+    bytes += common::WriteVec(fo, offset_vec);
+
+    // Delta-encode the indices per segment, falling back to the plain indices when a
+    // segment is not sorted.
+    std::vector<std::uint32_t> symbols(n);
+    std::uint32_t max_symbol{0};
+    std::uint8_t index_enc{kPackedDelta};
+    for (std::size_t i = 0; index_enc == kPackedDelta && i + 1 < offset_vec.size(); ++i) {
+      for (auto j = offset_vec[i]; j < offset_vec[i + 1]; ++j) {
+        if (j != offset_vec[i] && data_vec[j].index < data_vec[j - 1].index) {
+          index_enc = kPacked;
+          break;
+        }
+        symbols[j] = (j == offset_vec[i]) ? data_vec[j].index
+                                          : data_vec[j].index - data_vec[j - 1].index;
+        max_symbol = std::max(max_symbol, symbols[j]);
+      }
+    }
+    if (index_enc != kPackedDelta) {
+      max_symbol = 0;
+      for (std::size_t i = 0; i < n; ++i) {
+        symbols[i] = data_vec[i].index;
+        max_symbol = std::max(max_symbol, symbols[i]);
+      }
+    }
+    std::uint64_t n_symbols = static_cast<std::uint64_t>(max_symbol) + 1;
+    if (n_symbols > kMaxSymbols) {
+      index_enc = kRawIndex;  // symbol is too wide for the packed writer
+    }
+
+    bytes += fo->Write(&index_enc, sizeof(index_enc));
+    if (index_enc == kRawIndex) {
+      std::vector<bst_feature_t> indices(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        indices[i] = data_vec[i].index;
+      }
+      bytes += common::WriteVec(fo, indices);
+    } else {
+      bytes += fo->Write(n_symbols);
+      std::vector<common::CompressedByteT> buffer(
+          common::CompressedBufferWriter::CalculateBufferSize(n, n_symbols));
+      common::CompressedBufferWriter cbw{n_symbols};
+      cbw.Write(buffer.data(), symbols.cbegin(), symbols.cend());
+      bytes += common::WriteVec(fo, buffer);
+    }
+
+    std::uint8_t value_enc = quantize_values_ ? kQuantU16 : kF32;
+    bytes += fo->Write(&value_enc, sizeof(value_enc));
+    if (value_enc == kQuantU16) {
+      float lo{std::numeric_limits<float>::max()}, hi{std::numeric_limits<float>::lowest()};
+      for (auto const& e : data_vec) {
+        lo = std::min(lo, e.fvalue);
+        hi = std::max(hi, e.fvalue);
+      }
+      if (n == 0) {
+        lo = hi = 0.0f;
+      }
+      auto constexpr kMaxCode = std::numeric_limits<std::uint16_t>::max();
+      float scale = (hi - lo) / static_cast<float>(kMaxCode);
+      bytes += fo->Write(&lo, sizeof(lo));
+      bytes += fo->Write(&scale, sizeof(scale));
+      std::vector<std::uint16_t> codes(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        codes[i] = scale == 0.0f ? 0
+                                 : static_cast<std::uint16_t>(
+                                       std::lround((data_vec[i].fvalue - lo) / scale));
+      }
+      bytes += common::WriteVec(fo, codes);
+    } else {
+      std::vector<float> values(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        values[i] = data_vec[i].fvalue;
+      }
+      bytes += common::WriteVec(fo, values);
+    }
+
+    bytes += fo->Write(&page.base_rowid, sizeof(page.base_rowid));
+    return bytes;
+  }
+
+ private:
+  bool const quantize_values_;
+};
+
+#define SparsePageFmt SparsePageFormat<SparsePage>
+DMLC_REGISTRY_REGISTER(SparsePageFormatReg<SparsePage>, SparsePageFmt, compressed)
+    .describe("Bit-packed binary data format.")
+    .set_body([]() { return new SparsePageCompressedFormat<SparsePage>(false); });
+DMLC_REGISTRY_REGISTER(SparsePageFormatReg<SparsePage>, SparsePageFmt, compressed_q16)
+    .describe("Bit-packed binary data format with lossy 16-bit value quantization.")
+    .set_body([]() { return new SparsePageCompressedFormat<SparsePage>(true); });
+
+#define CSCPageFmt SparsePageFormat<CSCPage>
+DMLC_REGISTRY_REGISTER(SparsePageFormatReg<CSCPage>, CSCPageFmt, compressed)
+    .describe("Bit-packed binary data format.")
+    .set_body([]() { return new SparsePageCompressedFormat<CSCPage>(false); });
+
+#define SortedCSCPageFmt SparsePageFormat<SortedCSCPage>
+DMLC_REGISTRY_REGISTER(SparsePageFormatReg<SortedCSCPage>, SortedCSCPageFmt, compressed)
+    .describe("Bit-packed binary data format.")
+    .set_body([]() { return new SparsePageCompressedFormat<SortedCSCPage>(false); });
+}  // namespace xgboost::data
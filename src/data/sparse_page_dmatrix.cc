@@ -32,7 +32,9 @@ SparsePageDMatrix::SparsePageDMatrix(DataIterHandle iter_handle, DMatrixHandle p
       missing_{config.missing},
       cache_prefix_{config.cache},
       on_host_{config.on_host},
-      min_cache_page_bytes_{config.min_cache_page_bytes} {
+      min_cache_page_bytes_{config.min_cache_page_bytes},
+      n_prefetch_batches_{config.n_prefetch_batches},
+      shuffle_seed_{config.shuffle_seed} {
   Context ctx;
   ctx.Init(Args{{"nthread", std::to_string(config.n_threads)}});
   cache_prefix_ = MakeCachePrefix(cache_prefix_);
@@ -80,7 +82,8 @@ void SparsePageDMatrix::InitializeSparsePage(Context const *ctx) {
   // release the iterator and data.
   if (cache_info_.at(id)->written) {
     CHECK(this->sparse_page_source_);
-    this->sparse_page_source_->Reset({});
+    this->sparse_page_source_->SetShuffle(shuffle_seed_);
+    this->sparse_page_source_->Reset(detail::ApplyPrefetchDepth({}, n_prefetch_batches_));
     return;
   }
 
@@ -105,6 +108,7 @@ BatchSet<SparsePage> SparsePageDMatrix::GetRowBatches() {
 }
 
 BatchSet<CSCPage> SparsePageDMatrix::GetColumnBatches(Context const *ctx) {
+  CHECK_EQ(shuffle_seed_, 0) << "The page-level shuffle supports only SparsePage batches.";
   auto id = MakeCache(this, ".col.page", on_host_, cache_prefix_, &cache_info_);
   CHECK_NE(this->Info().num_col_, 0);
   this->InitializeSparsePage(ctx);
@@ -113,12 +117,13 @@ BatchSet<CSCPage> SparsePageDMatrix::GetColumnBatches(Context const *ctx) {
                                                      this->Info().num_col_, this->NumBatches(),
                                                      cache_info_.at(id), sparse_page_source_);
   } else {
-    column_source_->Reset({});
+    column_source_->Reset(detail::ApplyPrefetchDepth({}, n_prefetch_batches_));
   }
   return BatchSet{BatchIterator<CSCPage>{this->column_source_}};
 }
 
 BatchSet<SortedCSCPage> SparsePageDMatrix::GetSortedColumnBatches(Context const *ctx) {
+  CHECK_EQ(shuffle_seed_, 0) << "The page-level shuffle supports only SparsePage batches.";
   auto id = MakeCache(this, ".sorted.col.page", on_host_, cache_prefix_, &cache_info_);
   CHECK_NE(this->Info().num_col_, 0);
   this->InitializeSparsePage(ctx);
@@ -127,7 +132,7 @@ BatchSet<SortedCSCPage> SparsePageDMatrix::GetSortedColumnBatches(Context const
         this->missing_, ctx->Threads(), this->Info().num_col_, this->NumBatches(),
         cache_info_.at(id), sparse_page_source_);
   } else {
-    sorted_column_source_->Reset({});
+    sorted_column_source_->Reset(detail::ApplyPrefetchDepth({}, n_prefetch_batches_));
   }
   return BatchSet{BatchIterator<SortedCSCPage>{this->sorted_column_source_}};
 }
@@ -138,6 +143,7 @@ BatchSet<GHistIndexMatrix> SparsePageDMatrix::GetGradientIndex(Context const *ct
     CHECK_GE(param.max_bin, 2);
   }
   detail::CheckEmpty(batch_param_, param);
+  CHECK_EQ(shuffle_seed_, 0) << "The page-level shuffle supports only SparsePage batches.";
   auto id = MakeCache(this, ".gradient_index.page", on_host_, cache_prefix_, &cache_info_);
   if (!cache_info_.at(id)->written || detail::RegenGHist(batch_param_, param)) {
     this->InitializeSparsePage(ctx);
@@ -158,7 +164,7 @@ BatchSet<GHistIndexMatrix> SparsePageDMatrix::GetGradientIndex(Context const *ct
         cache_info_.at(id), param, std::move(cuts), this->IsDense(), ft, sparse_page_source_));
   } else {
     CHECK(ghist_index_source_);
-    ghist_index_source_->Reset(param);
+    ghist_index_source_->Reset(detail::ApplyPrefetchDepth(param, n_prefetch_batches_));
   }
   return BatchSet{BatchIterator<GHistIndexMatrix>{this->ghist_index_source_}};
 }
@@ -22,6 +22,7 @@ BatchSet<EllpackPage> SparsePageDMatrix::GetEllpackBatches(Context const* ctx,
     CHECK_GE(param.max_bin, 2);
   }
   detail::CheckEmpty(batch_param_, param);
+  CHECK_EQ(shuffle_seed_, 0) << "The page-level shuffle supports only SparsePage batches.";
   auto id = MakeCache(this, ".ellpack.page", on_host_, cache_prefix_, &cache_info_);
 
   if (!cache_info_.at(id)->written || detail::RegenGHist(batch_param_, param)) {
@@ -70,7 +71,9 @@ BatchSet<EllpackPage> SparsePageDMatrix::GetEllpackBatches(Context const* ctx,
         ellpack_page_source_);
   } else {
     CHECK(sparse_page_source_);
-    std::visit([&](auto&& ptr) { ptr->Reset(param); }, this->ellpack_page_source_);
+    std::visit(
+        [&](auto&& ptr) { ptr->Reset(detail::ApplyPrefetchDepth(param, n_prefetch_batches_)); },
+        this->ellpack_page_source_);
   }
 
   auto batch_set =
@@ -37,10 +37,11 @@ namespace xgboost::data {
  * be in memory at any given time.
  *
  * Right now the write to the cache is a sequential operation and is blocking. Reading
- * from cache on ther other hand, is async but with a hard coded limit of 3 pages as an
- * heuristic.  So by sparse dmatrix itself there can be only 7 pages in main memory (might
- * be of different types) at the same time: 1 page pending for write, 3 pre-fetched sparse
- * pages, 3 pre-fetched dependent pages.
+ * from cache on ther other hand, is async with a default look-ahead of 3 pages, which the
+ * user can deepen through the `n_prefetch_batches` configuration to keep fast storage
+ * busy.  With the default, by sparse dmatrix itself there can be only 7 pages in main
+ * memory (might be of different types) at the same time: 1 page pending for write, 3
+ * pre-fetched sparse pages, 3 pre-fetched dependent pages.
  *
  * Of course if the caller decides to retain some batches to perform parallel processing,
  * then we might load all pages in memory, which is also considered as a bug in caller's
@@ -75,6 +76,10 @@ class SparsePageDMatrix : public DMatrix {
   std::string cache_prefix_;
   bool const on_host_;
   std::int64_t const min_cache_page_bytes_;
+  // User-configured number of look-ahead pages, 0 for the default.
+  std::int32_t const n_prefetch_batches_;
+  // Seed for the page-level pseudo-shuffle of row pages, 0 disables it.
+  std::uint64_t const shuffle_seed_;
   ExternalDataInfo ext_info_;
 
   // sparse page is the source to other page types, we make a special member function.
@@ -13,6 +13,8 @@
 #include <map>        // for map
 #include <memory>     // for unique_ptr
 #include <mutex>      // for mutex
+#include <numeric>    // for iota
+#include <random>     // for mt19937_64, shuffle
 #include <string>     // for string
 #include <utility>    // for pair, move
 #include <vector>     // for vector
@@ -21,9 +23,10 @@
 #include "../common/common.h"  // for AssertGPUSupport
 #endif                         // !defined(XGBOOST_USE_CUDA)
 
-#include "../common/io.h"           // for PrivateMmapConstStream
-#include "../common/threadpool.h"   // for ThreadPool
-#include "../common/timer.h"        // for Monitor, Timer
+#include "../common/io.h"            // for PrivateMmapConstStream
+#include "../common/memory_stats.h"  // for MemoryUsageReporter
+#include "../common/threadpool.h"    // for ThreadPool
+#include "../common/timer.h"         // for Monitor, Timer
 #include "proxy_dmatrix.h"          // for DMatrixProxy
 #include "sparse_page_writer.h"     // for SparsePageFormat
 #include "xgboost/base.h"           // for bst_feature_t
@@ -214,9 +217,15 @@ class DefaultFormatPolicy {
 
  public:
   auto CreatePageFormat(BatchParam const&) const {
-    std::unique_ptr<FormatT> fmt{::xgboost::data::CreatePageFormat<S>("raw")};
+    std::unique_ptr<FormatT> fmt{::xgboost::data::CreatePageFormat<S>(name_)};
     return fmt;
   }
+  // Select a format from the `SparsePageFormatReg` registry, e.g. `compressed` to trade
+  // CPU decode for less I/O.
+  void SetPageFormat(std::string name) { name_ = std::move(name); }
+
+ private:
+  std::string name_{"raw"};
 };
 
 struct InitNewThread {
@@ -255,6 +264,13 @@ class SparsePageSourceImpl : public BatchIteratorImpl<S>, public FormatStreamPol
   std::uint32_t count_{0};
   // How we pre-fetch the data.
   BatchParam param_;
+  // Page-level pseudo-shuffle, enabled when the seed is non-zero.  Pages are visited in
+  // a random order each epoch with the rows permuted within each page at read time.
+  std::uint64_t shuffle_seed_{0};
+  // Which epoch we are in, used to derive per-epoch shuffle seeds.
+  std::uint32_t epoch_{0};
+  // Per-epoch page visit order, empty when the shuffle is disabled.
+  std::vector<std::uint32_t> page_order_;
 
   std::shared_ptr<Cache> cache_info_;
 
@@ -267,6 +283,8 @@ class SparsePageSourceImpl : public BatchIteratorImpl<S>, public FormatStreamPol
   // OOM error should be rare.
   ExceHandler exce_;
   common::Monitor monitor_;
+  // Footprint of the currently resident page; the prefetch ring is not accounted for.
+  common::MemoryUsageReporter mem_usage_{"SparsePageCache"};
 
   [[nodiscard]] bool ReadCache() {
     if (!cache_info_->written) {
@@ -297,21 +315,35 @@ class SparsePageSourceImpl : public BatchIteratorImpl<S>, public FormatStreamPol
         continue;
       }
       auto const* self = this;  // make sure it's const
-      CHECK_LT(fetch_it, cache_info_->offset.size());
+      // The page read for this ring slot.  The pseudo-shuffle redirects the slot to a
+      // random page while the ring itself stays sequential, so read-ahead still runs
+      // n_prefetch_batches pages in front of the consumer.
+      std::size_t page_idx = page_order_.empty() ? fetch_it : page_order_.at(fetch_it);
+      CHECK_LT(page_idx, cache_info_->offset.size());
       // Make sure the new iteration starts with a copy to avoid spilling configuration.
       if (restart) {
         this->param_.prefetch_copy = true;
       }
-      ring_->at(fetch_it) = this->workers_.Submit([fetch_it, self, this] {
+      // Per-page, per-epoch seed for the intra-page row permutation.
+      std::uint64_t row_seed =
+          shuffle_seed_ + static_cast<std::uint64_t>(epoch_) * n_batches + page_idx;
+      bool shuffle_rows = !page_order_.empty();
+      ring_->at(fetch_it) = this->workers_.Submit([page_idx, row_seed, shuffle_rows, self, this] {
         auto page = std::make_shared<S>();
         this->exce_.Run([&] {
           std::unique_ptr<typename FormatStreamPolicy::FormatT> fmt{
               self->CreatePageFormat(self->param_)};
           auto name = self->cache_info_->ShardName();
-          auto [offset, length] = self->cache_info_->View(fetch_it);
+          auto [offset, length] = self->cache_info_->View(page_idx);
           std::unique_ptr<typename FormatStreamPolicy::ReaderT> fi{
               self->CreateReader(name, offset, length)};
           CHECK(fmt->Read(page.get(), fi.get()));
+          if constexpr (std::is_same_v<S, SparsePage>) {
+            // Permute rows inside the prefetch worker so the cost hides behind I/O.
+            if (shuffle_rows) {
+              page->ShuffleRows(row_seed, 1);
+            }
+          }
         });
         return page;
       });
@@ -325,6 +357,7 @@ class SparsePageSourceImpl : public BatchIteratorImpl<S>, public FormatStreamPol
     monitor_.Start("Wait-" + std::to_string(count_));
     CHECK((*ring_)[count_].valid());
     page_ = (*ring_)[count_].get();
+    mem_usage_.Update(page_->MemCostBytes());
     monitor_.Stop("Wait-" + std::to_string(count_));
 
     exce_.Rethrow();
@@ -411,6 +444,17 @@ class SparsePageSourceImpl : public BatchIteratorImpl<S>, public FormatStreamPol
 
     this->count_ = 0;
 
+    if (shuffle_seed_ != 0 && cache_info_->written) {
+      // Draw a new page visit order for the new epoch.  The slot to page mapping
+      // changed, so the ring must restart from scratch.
+      page_order_.resize(cache_info_->Size());
+      std::iota(page_order_.begin(), page_order_.end(), 0);
+      std::mt19937_64 rng{shuffle_seed_ + epoch_};
+      std::shuffle(page_order_.begin(), page_order_.end(), rng);
+      ++epoch_;
+      changed = true;
+    }
+
     if (!at_end || changed) {
       // The last iteration did not get to the end, clear the ring to start from 0.
       this->ring_ = std::make_unique<Ring>();
@@ -418,6 +462,16 @@ class SparsePageSourceImpl : public BatchIteratorImpl<S>, public FormatStreamPol
     this->Fetch();  // Get the 0^th page, prefetch the next page.
   }
 
+  /**
+   * @brief Enable the page-level pseudo-shuffle with a non-zero seed.
+   *
+   *   Starting from the next @ref Reset, pages are visited in a random order each epoch
+   *   and the rows within each page are permuted when the page is read back from the
+   *   cache.  Consumers must not rely on the storage order of rows; in particular the
+   *   shuffle cannot be combined with page types derived from the row pages.
+   */
+  void SetShuffle(std::uint64_t seed) { shuffle_seed_ = seed; }
+
   [[nodiscard]] auto FetchCount() const { return this->fetch_cnt_; }
 };
 
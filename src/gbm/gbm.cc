@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "xgboost/context.h"
+#include "xgboost/json.h"
 #include "xgboost/learner.h"
 
 namespace dmlc {
@@ -28,6 +29,14 @@ GradientBooster* GradientBooster::Create(const std::string& name, Context const*
   auto p_bst =  (e->body)(learner_model_param, ctx);
   return p_bst;
 }
+
+std::function<void(Json*)> GradientBooster::SaveModelSnapshot() const {
+  // Eager fallback for boosters without copy-on-write model storage, the serialization
+  // cost is paid on the calling thread and the functor only hands out the result.
+  Json model{Object{}};
+  this->SaveModel(&model);
+  return [model](Json* p_out) { *p_out = model; };
+}
 }  // namespace xgboost
 
 namespace xgboost {
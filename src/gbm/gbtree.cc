@@ -11,22 +11,28 @@
 
 #include <algorithm>  // for equal
 #include <cstdint>    // for uint32_t
+#include <future>     // for future
+#include <map>        // for map
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "../collective/communicator-inl.h"  // for IsDistributed
+#include "../common/cancellation.h"  // for TrainingCancellation
 #include "../common/common.h"
 #include "../common/cuda_rt_utils.h"  // for AllVisibleGPUs
 #include "../common/error_msg.h"  // for UnknownDevice, WarnOldSerialization, InplacePredictProxy
 #include "../common/random.h"
 #include "../common/threading_utils.h"
+#include "../common/threadpool.h"  // for ThreadPool
 #include "../common/timer.h"
 #include "../data/proxy_dmatrix.h"  // for DMatrixProxy, HostAdapterDispatch
 #include "gbtree_model.h"
 #include "xgboost/base.h"
 #include "xgboost/data.h"
 #include "xgboost/gbm.h"
+#include "xgboost/global_config.h"  // for GlobalConfigThreadLocalStore
 #include "xgboost/host_device_vector.h"
 #include "xgboost/json.h"
 #include "xgboost/logging.h"
@@ -89,6 +95,7 @@ bool UpdatersMatched(std::vector<std::string> updater_seq,
 }  // namespace
 
 void GBTree::Configure(Args const& cfg) {
+  this->cfg_ = cfg;
   tparam_.UpdateAllowUnknown(cfg);
   tree_param_.UpdateAllowUnknown(cfg);
 
@@ -201,6 +208,12 @@ void GBTree::UpdateTreeLeaf(DMatrix const* p_fmat, HostDeviceVector<float> const
 
 void GBTree::DoBoost(DMatrix* p_fmat, linalg::Matrix<GradientPair>* in_gpair,
                      PredictionCacheEntry* predt, ObjFunction const* obj) {
+  if (common::TrainingCancellation::Instance().Requested()) {
+    // Cooperative preemption: skip the iteration entirely, the committed model is left
+    // untouched and the caller can checkpoint it.
+    LOG(WARNING) << "Training cancellation requested, skipping boosting iteration.";
+    return;
+  }
   if (model_.learner_model_param->IsVectorLeaf()) {
     CHECK(tparam_.tree_method == TreeMethod::kHist || tparam_.tree_method == TreeMethod::kAuto)
         << "Only the hist tree method is supported for building multi-target trees with vector "
@@ -223,7 +236,7 @@ void GBTree::DoBoost(DMatrix* p_fmat, linalg::Matrix<GradientPair>* in_gpair,
 
   if (model_.learner_model_param->IsVectorLeaf()) {
     TreesOneGroup ret;
-    BoostNewTrees(in_gpair, p_fmat, 0, &node_position, &ret);
+    BoostNewTrees(in_gpair, p_fmat, 0, updaters_, &node_position, &ret);
     UpdateTreeLeaf(p_fmat, predt->predictions, obj, 0, node_position, &ret);
     std::size_t num_new_trees = ret.size();
     new_trees.push_back(std::move(ret));
@@ -233,7 +246,7 @@ void GBTree::DoBoost(DMatrix* p_fmat, linalg::Matrix<GradientPair>* in_gpair,
     }
   } else if (model_.learner_model_param->OutputLength() == 1u) {
     TreesOneGroup ret;
-    BoostNewTrees(in_gpair, p_fmat, 0, &node_position, &ret);
+    BoostNewTrees(in_gpair, p_fmat, 0, updaters_, &node_position, &ret);
     UpdateTreeLeaf(p_fmat, predt->predictions, obj, 0, node_position, &ret);
     const size_t num_new_trees = ret.size();
     new_trees.push_back(std::move(ret));
@@ -243,21 +256,25 @@ void GBTree::DoBoost(DMatrix* p_fmat, linalg::Matrix<GradientPair>* in_gpair,
     }
   } else {
     CHECK_EQ(in_gpair->Size() % n_groups, 0U) << "must have exactly ngroup * nrow gpairs";
-    linalg::Matrix<GradientPair> tmp{{in_gpair->Shape(0), static_cast<std::size_t>(1ul)},
-                                     ctx_->Device()};
     bool update_predict = true;
-    for (bst_target_t gid = 0; gid < n_groups; ++gid) {
-      node_position.clear();
-      CopyGradient(ctx_, in_gpair, gid, &tmp);
-      TreesOneGroup ret;
-      BoostNewTrees(&tmp, p_fmat, gid, &node_position, &ret);
-      UpdateTreeLeaf(p_fmat, predt->predictions, obj, gid, node_position, &ret);
-      const size_t num_new_trees = ret.size();
-      new_trees.push_back(std::move(ret));
-      auto v_predt = out.Slice(linalg::All(), linalg::Range(gid, gid + 1));
-      if (!(updaters_.size() > 0 && predt->predictions.Size() > 0 && num_new_trees == 1 &&
-            updaters_.back()->UpdatePredictionCache(p_fmat, v_predt))) {
-        update_predict = false;
+    if (this->ShouldBoostGroupsParallel(obj, n_groups)) {
+      update_predict = this->BoostGroupsParallel(in_gpair, p_fmat, out, predt, &new_trees);
+    } else {
+      linalg::Matrix<GradientPair> tmp{{in_gpair->Shape(0), static_cast<std::size_t>(1ul)},
+                                       ctx_->Device()};
+      for (bst_target_t gid = 0; gid < n_groups; ++gid) {
+        node_position.clear();
+        CopyGradient(ctx_, in_gpair, gid, &tmp);
+        TreesOneGroup ret;
+        BoostNewTrees(&tmp, p_fmat, gid, updaters_, &node_position, &ret);
+        UpdateTreeLeaf(p_fmat, predt->predictions, obj, gid, node_position, &ret);
+        const size_t num_new_trees = ret.size();
+        new_trees.push_back(std::move(ret));
+        auto v_predt = out.Slice(linalg::All(), linalg::Range(gid, gid + 1));
+        if (!(updaters_.size() > 0 && predt->predictions.Size() > 0 && num_new_trees == 1 &&
+              updaters_.back()->UpdatePredictionCache(p_fmat, v_predt))) {
+          update_predict = false;
+        }
       }
     }
     if (update_predict) {
@@ -270,6 +287,7 @@ void GBTree::DoBoost(DMatrix* p_fmat, linalg::Matrix<GradientPair>* in_gpair,
 }
 
 void GBTree::BoostNewTrees(linalg::Matrix<GradientPair>* gpair, DMatrix* p_fmat, int bst_group,
+                           std::vector<std::unique_ptr<TreeUpdater>> const& updaters,
                            std::vector<HostDeviceVector<bst_node_t>>* out_position,
                            TreesOneGroup* ret) {
   std::vector<RegTree*> new_trees;
@@ -277,9 +295,9 @@ void GBTree::BoostNewTrees(linalg::Matrix<GradientPair>* gpair, DMatrix* p_fmat,
   // create the trees
   for (int i = 0; i < model_.param.num_parallel_tree; ++i) {
     if (tparam_.process_type == TreeProcessType::kDefault) {
-      CHECK(!updaters_.empty());
-      CHECK(!updaters_.front()->CanModifyTree())
-          << "Updater: `" << updaters_.front()->Name() << "` "
+      CHECK(!updaters.empty());
+      CHECK(!updaters.front()->CanModifyTree())
+          << "Updater: `" << updaters.front()->Name() << "` "
           << "can not be used to create new trees. "
           << "Set `process_type` to `update` if you want to update existing "
              "trees.";
@@ -289,7 +307,7 @@ void GBTree::BoostNewTrees(linalg::Matrix<GradientPair>* gpair, DMatrix* p_fmat,
       new_trees.push_back(ptr.get());
       ret->push_back(std::move(ptr));
     } else if (tparam_.process_type == TreeProcessType::kUpdate) {
-      for (auto const& up : updaters_) {
+      for (auto const& up : updaters) {
         CHECK(up->CanModifyTree())
             << "Updater: `" << up->Name() << "` "
             << "can not be used to modify existing trees. "
@@ -318,14 +336,102 @@ void GBTree::BoostNewTrees(linalg::Matrix<GradientPair>* gpair, DMatrix* p_fmat,
 
   out_position->resize(new_trees.size());
 
-  // Rescale learning rate according to the size of trees
-  auto lr = tree_param_.learning_rate;
-  tree_param_.learning_rate /= static_cast<float>(new_trees.size());
-  for (auto& up : updaters_) {
-    up->Update(&tree_param_, gpair, p_fmat,
-               common::Span<HostDeviceVector<bst_node_t>>{*out_position}, new_trees);
+  // Rescale learning rate according to the size of trees.  Use a local copy so that
+  // concurrent calls don't race on the member.
+  tree::TrainParam param{tree_param_};
+  param.learning_rate /= static_cast<float>(new_trees.size());
+  for (auto& up : updaters) {
+    up->Update(&param, gpair, p_fmat, common::Span<HostDeviceVector<bst_node_t>>{*out_position},
+               new_trees);
+  }
+}
+
+bool GBTree::ShouldBoostGroupsParallel(ObjFunction const* obj, bst_target_t n_groups) const {
+  if (!tparam_.parallel_class_trees) {
+    return false;
+  }
+  if (n_groups <= 1 || !ctx_->IsCPU() || collective::IsDistributed()) {
+    return false;
+  }
+  if (obj && obj->Task().UpdateTreeLeaf()) {
+    LOG(WARNING) << "`parallel_class_trees` is not supported for objectives that update the tree "
+                    "leaves, falling back to sequential training.";
+    return false;
+  }
+  return true;
+}
+
+bool GBTree::BoostGroupsParallel(linalg::Matrix<GradientPair>* in_gpair, DMatrix* p_fmat,
+                                 linalg::MatrixView<float> out_predt, PredictionCacheEntry* predt,
+                                 TreesOneIter* p_new_trees) {
+  auto const n_groups = model_.learner_model_param->OutputLength();
+  auto const n_total_threads = ctx_->Threads();
+  auto const n_workers = std::min(static_cast<std::int32_t>(n_groups), n_total_threads);
+
+  // Split the thread budget between the groups.  Each worker thread forms its own
+  // OpenMP team, the first group runs alone and gets the full budget.
+  std::vector<Context> worker_ctxs(n_groups);
+  worker_ctxs.front() = *ctx_;
+  for (bst_target_t gid = 1; gid < n_groups; ++gid) {
+    worker_ctxs[gid] = *ctx_;
+    worker_ctxs[gid].UpdateAllowUnknown(
+        Args{{"nthread", std::to_string(std::max(n_total_threads / n_workers, 1))}});
+  }
+
+  // The updaters are stateful, each group needs its own sequence.
+  auto up_names = common::Split(tparam_.updater_seq, ',');
+  std::vector<std::vector<std::unique_ptr<TreeUpdater>>> group_updaters(n_groups);
+  for (bst_target_t gid = 0; gid < n_groups; ++gid) {
+    for (auto const& name : up_names) {
+      std::unique_ptr<TreeUpdater> up{
+          TreeUpdater::Create(name.c_str(), &worker_ctxs[gid], &model_.learner_model_param->task)};
+      up->Configure(this->cfg_);
+      group_updaters[gid].push_back(std::move(up));
+    }
+  }
+
+  // Force the lazy host copies before the workers start reading them concurrently.
+  in_gpair->HostView();
+  predt->predictions.HostVector();
+
+  std::vector<TreesOneGroup> group_trees(n_groups);
+  std::vector<std::uint8_t> cache_updated(n_groups, 0);
+
+  auto boost_group = [&](bst_target_t gid) {
+    auto const& w_ctx = worker_ctxs[gid];
+    linalg::Matrix<GradientPair> tmp{{in_gpair->Shape(0), static_cast<std::size_t>(1ul)},
+                                     w_ctx.Device()};
+    CopyGradient(&w_ctx, in_gpair, gid, &tmp);
+    std::vector<HostDeviceVector<bst_node_t>> node_position;
+    this->BoostNewTrees(&tmp, p_fmat, gid, group_updaters[gid], &node_position, &group_trees[gid]);
+    auto v_predt = out_predt.Slice(linalg::All(), linalg::Range(gid, gid + 1));
+    cache_updated[gid] = predt->predictions.Size() > 0 && group_trees[gid].size() == 1 &&
+                         group_updaters[gid].back()->UpdatePredictionCache(p_fmat, v_predt);
+  };
+
+  // The first group initializes the shared caches inside the DMatrix (e.g. the
+  // histogram index); run it up-front so that the concurrent groups only read them.
+  boost_group(0);
+
+  auto config = *GlobalConfigThreadLocalStore::Get();
+  common::ThreadPool pool{StringView{"boost-cls"}, n_workers,
+                          [config] { *GlobalConfigThreadLocalStore::Get() = config; }};
+  std::vector<std::future<void>> futures;
+  for (bst_target_t gid = 1; gid < n_groups; ++gid) {
+    futures.emplace_back(pool.Submit([&, gid] { boost_group(gid); }));
   }
-  tree_param_.learning_rate = lr;
+  for (auto& fut : futures) {
+    fut.get();
+  }
+
+  bool update_predict = true;
+  for (bst_target_t gid = 0; gid < n_groups; ++gid) {
+    p_new_trees->push_back(std::move(group_trees[gid]));
+    if (!cache_updated[gid]) {
+      update_predict = false;
+    }
+  }
+  return update_predict;
 }
 
 void GBTree::CommitModel(TreesOneIter&& new_trees) {
@@ -421,6 +527,8 @@ void GBTree::SaveConfig(Json* p_out) const {
 void GBTree::LoadModel(Json const& in) {
   CHECK_EQ(get<String>(in["name"]), "gbtree");
   model_.LoadModel(in["model"]);
+  // The loaded model can have the same number of trees as the replaced one.
+  feature_score_cache_ = {};
 }
 
 void GBTree::SaveModel(Json* p_out) const {
@@ -431,6 +539,20 @@ void GBTree::SaveModel(Json* p_out) const {
   model_.SaveModel(&model);
 }
 
+std::function<void(Json*)> GBTree::SaveModelSnapshot() const {
+  // Copying the model only copies the shared tree pointers.  Committed trees are
+  // immutable (the update process detaches a private copy before refitting shared
+  // trees), so the snapshot can be serialized while training appends new trees.
+  model_.EnsureAllTrees();
+  auto snapshot = std::make_shared<GBTreeModel>(model_);
+  return [snapshot](Json* p_out) {
+    auto& out = *p_out;
+    out["name"] = String("gbtree");
+    out["model"] = Object();
+    snapshot->SaveModel(&out["model"]);
+  };
+}
+
 void GBTree::Slice(bst_layer_t begin, bst_layer_t end, bst_layer_t step, GradientBooster* out,
                    bool* out_of_bound) const {
   CHECK(out);
@@ -439,6 +561,8 @@ void GBTree::Slice(bst_layer_t begin, bst_layer_t end, bst_layer_t step, Gradien
   CHECK(p_gbtree);
   GBTreeModel& out_model = p_gbtree->model_;
   CHECK(this->model_.learner_model_param->Initialized());
+  // The sliced model shares the tree pointers, they must all exist first.
+  this->model_.EnsureAllTrees();
 
   end = end == 0 ? model_.BoostedRounds() : end;
   CHECK_GE(step, 1);
@@ -466,8 +590,9 @@ void GBTree::Slice(bst_layer_t begin, bst_layer_t end, bst_layer_t step, Gradien
 
   *out_of_bound =
       detail::SliceTrees(begin, end, step, this->model_, [&](auto in_tree_idx, auto out_l) {
-        auto new_tree = std::make_unique<RegTree>(*this->model_.trees.at(in_tree_idx));
-        out_trees.emplace_back(std::move(new_tree));
+        // Trees are immutable once committed, share them with the sliced model instead
+        // of copying.  The update process detaches shared trees before mutating.
+        out_trees.emplace_back(this->model_.trees.at(in_tree_idx));
 
         bst_group_t group = this->model_.tree_info[in_tree_idx];
         out_trees_info.push_back(group);
@@ -512,6 +637,7 @@ void GBTree::PredictBatchImpl(DMatrix* p_fmat, PredictionCacheEntry* out_preds,
   auto [tree_begin, tree_end] = detail::LayerToTree(model_, layer_begin, layer_end);
   CHECK_LE(tree_end, model_.trees.size()) << "Invalid number of trees.";
   if (tree_end > tree_begin) {
+    model_.EnsureTrees(tree_begin, tree_end);
     predictor->PredictBatch(p_fmat, out_preds, model_, tree_begin, tree_end);
   }
   if (reset) {
@@ -528,11 +654,46 @@ void GBTree::PredictBatch(DMatrix* p_fmat, PredictionCacheEntry* out_preds, bool
   this->PredictBatchImpl(p_fmat, out_preds, is_training, layer_begin, layer_end);
 }
 
+bool GBTree::FusedPredictGradient(DMatrix* p_fmat, PredictionCacheEntry* out_preds,
+                                  ObjFunction const& obj, linalg::Matrix<GradientPair>* out_gpair) {
+  auto op = obj.FusedGradient();
+  if (op.kind == FusedGradientOp::kNone) {
+    return false;
+  }
+  if (this->model_.learner_model_param->OutputLength() != 1) {
+    return false;
+  }
+
+  // Mirror the cache handling in PredictBatchImpl for a full-model training prediction.
+  bst_layer_t layer_begin = out_preds->version;
+  bst_layer_t layer_end = this->BoostedRounds();
+  auto const& predictor = GetPredictor(/*is_training=*/true, &out_preds->predictions, p_fmat);
+  if (out_preds->version == 0) {
+    predictor->InitOutPredictions(p_fmat->Info(), &out_preds->predictions, model_);
+  }
+
+  auto [tree_begin, tree_end] = detail::LayerToTree(model_, layer_begin, layer_end);
+  CHECK_LE(tree_end, model_.trees.size()) << "Invalid number of trees.";
+  if (tree_end <= tree_begin) {
+    // No new trees, a plain gradient pass is just as cheap.
+    return false;
+  }
+  if (!predictor->PredictBatchWithFusedGradient(p_fmat, out_preds, model_, tree_begin, tree_end,
+                                                op, out_gpair)) {
+    // The predictor declined without touching the cache, the caller falls back to the
+    // two-pass route.
+    return false;
+  }
+  out_preds->Update(layer_end - out_preds->version);
+  return true;
+}
+
 void GBTree::InplacePredict(std::shared_ptr<DMatrix> p_m, float missing,
                             PredictionCacheEntry* out_preds, bst_layer_t layer_begin,
                             bst_layer_t layer_end) const {
   auto [tree_begin, tree_end] = detail::LayerToTree(model_, layer_begin, layer_end);
   CHECK_LE(tree_end, model_.trees.size()) << "Invalid number of trees.";
+  model_.EnsureTrees(tree_begin, tree_end);
   if (p_m->Ctx()->Device() != this->ctx_->Device()) {
     error::MismatchedDevices(this->ctx_, p_m->Ctx());
     CHECK_EQ(out_preds->version, 0);
@@ -656,6 +817,20 @@ void GPUDartInplacePredictInc(common::Span<float> /*out_predts*/, common::Span<f
 }
 #endif
 
+/** Element-wise addition of a prediction vector on GPU, covering all groups.
+ *
+ * \param out_predts Accumulated output.
+ * \param predts     Increment.
+ */
+void GPUDartAddPredts(common::Span<float>, common::Span<float>)
+#if defined(XGBOOST_USE_CUDA)
+    ;  // NOLINT
+#else
+{
+  common::AssertGPUSupport();
+}
+#endif
+
 
 class Dart : public GBTree {
  public:
@@ -693,10 +868,30 @@ class Dart : public GBTree {
     }
     out["weight_drop"] = Array(std::move(j_weight_drop));
   }
+
+  [[nodiscard]] std::function<void(Json*)> SaveModelSnapshot() const override {
+    auto save_trees = GBTree::SaveModelSnapshot();
+    auto weight_drop = weight_drop_;
+    return [save_trees, weight_drop](Json* p_out) {
+      auto& out = *p_out;
+      out["name"] = String("dart");
+      out["gbtree"] = Object();
+      save_trees(&out["gbtree"]);
+
+      std::vector<Json> j_weight_drop(weight_drop.size());
+      for (size_t i = 0; i < weight_drop.size(); ++i) {
+        j_weight_drop[i] = Number(weight_drop[i]);
+      }
+      out["weight_drop"] = Array(std::move(j_weight_drop));
+    };
+  }
+
   void LoadModel(Json const& in) override {
     CHECK_EQ(get<String>(in["name"]), "dart");
     auto const& gbtree = in["gbtree"];
     GBTree::LoadModel(gbtree);
+    // Dart walks the trees through its own weighted paths, opt out of lazy loading.
+    model_.EnsureAllTrees();
 
     auto const& j_weight_drop = get<Array>(in["weight_drop"]);
     weight_drop_.resize(j_weight_drop.size());
@@ -793,9 +988,113 @@ class Dart : public GBTree {
   void PredictBatch(DMatrix* p_fmat, PredictionCacheEntry* p_out_preds, bool training,
                     bst_layer_t layer_begin, bst_layer_t layer_end) override {
     DropTrees(training);
+    if (training && layer_begin == 0 && layer_end == 0) {
+      this->PredictBatchIncremental(p_fmat, p_out_preds);
+      return;
+    }
     this->PredictBatchImpl(p_fmat, p_out_preds, training, layer_begin, layer_end);
   }
 
+  /**
+   * Incremental prediction for training.  PredictBatchImpl recomputes the weighted
+   * ensemble sum from scratch each round, making the per-round cost proportional to the
+   * ensemble size.  During training only a handful of trees change between rounds --
+   * the trees committed last round and the trees whose weights were rescaled because
+   * they were dropped -- so the cached full-ensemble sum is patched with per-tree
+   * deltas and the current dropout set is subtracted from the output, which makes the
+   * per-round cost proportional to the dropout set instead.
+   */
+  void PredictBatchIncremental(DMatrix* p_fmat, PredictionCacheEntry* p_out_preds) {
+    CHECK(!this->model_.learner_model_param->IsVectorLeaf()) << "dart" << MTNotImplemented();
+    auto& predictor = this->GetPredictor(true, &p_out_preds->predictions, p_fmat);
+    CHECK(predictor);
+    auto n_rows = p_fmat->Info().num_row_;
+    auto n_groups = model_.learner_model_param->num_output_group;
+    auto n_trees = static_cast<bst_tree_t>(model_.trees.size());
+
+    if (cached_fmat_ != p_fmat || cached_weights_.size() > weight_drop_.size() ||
+        cached_sum_.Size() != n_rows * n_groups) {
+      // (Re-)bind the cache to this matrix.  The first round pays one full pass over
+      // the ensemble, every following round only touches the changed trees.
+      cached_fmat_ = p_fmat;
+      cached_weights_.clear();
+      cached_tree_predts_.clear();
+      if (!ctx_->IsCPU()) {
+        cached_sum_.SetDevice(ctx_->Device());
+      }
+      cached_sum_.Resize(n_rows * n_groups);
+      cached_sum_.Fill(0);
+    }
+
+    PredictionCacheEntry predts;  // temporary storage for a single tree's prediction
+    if (!ctx_->IsCPU()) {
+      predts.predictions.SetDevice(ctx_->Device());
+    }
+    predts.predictions.Resize(n_rows * n_groups, 0);
+    // Fetch the cached per-tree prediction column, computing and caching it on a miss.
+    auto tree_predts = [&](bst_tree_t i) -> HostDeviceVector<bst_float>& {
+      auto it = cached_tree_predts_.find(i);
+      if (it != cached_tree_predts_.cend()) {
+        return it->second;
+      }
+      predts.predictions.Fill(0);
+      predictor->PredictBatch(p_fmat, &predts, model_, i, i + 1);
+      auto& entry = cached_tree_predts_[i];
+      if (!ctx_->IsCPU()) {
+        entry.SetDevice(ctx_->Device());
+      }
+      entry.Resize(predts.predictions.Size());
+      entry.Copy(predts.predictions);
+      return entry;
+    };
+
+    // Patch the weight rescaling of the trees dropped last round.
+    auto n_cached = static_cast<bst_tree_t>(cached_weights_.size());
+    for (bst_tree_t i = 0; i < n_cached; ++i) {
+      if (cached_weights_[i] != weight_drop_[i]) {
+        this->AccumulateTree(tree_predts(i), weight_drop_[i] - cached_weights_[i], i, n_rows,
+                             &cached_sum_);
+      }
+    }
+    // Add the trees committed last round.
+    for (bst_tree_t i = n_cached; i < n_trees; ++i) {
+      this->AccumulateTree(tree_predts(i), weight_drop_[i], i, n_rows, &cached_sum_);
+    }
+    cached_weights_.assign(weight_drop_.cbegin(), weight_drop_.cend());
+
+    // Retain the columns of the most recent trees and of the current dropout set, both
+    // are the likely candidates for reuse: the dropout set is needed again next round
+    // to patch the weight rescaling, recent trees carry the largest weights under
+    // weighted sampling.
+    for (auto it = cached_tree_predts_.begin(); it != cached_tree_predts_.end();) {
+      bool recent = it->first + dparam_.n_cached_trees >= n_trees;
+      bool dropped =
+          std::binary_search(idx_drop_.cbegin(), idx_drop_.cend(), static_cast<size_t>(it->first));
+      if (recent || dropped) {
+        ++it;
+      } else {
+        it = cached_tree_predts_.erase(it);
+      }
+    }
+
+    // Output is the base score plus the cached sum minus the dropped contributions.
+    predictor->InitOutPredictions(p_fmat->Info(), &p_out_preds->predictions, model_);
+    p_out_preds->version = 0;
+    this->AddPredts(cached_sum_, &p_out_preds->predictions);
+    for (auto i : idx_drop_) {
+      auto tree_idx = static_cast<bst_tree_t>(i);
+      this->AccumulateTree(tree_predts(tree_idx), -weight_drop_[i], tree_idx, n_rows,
+                           &p_out_preds->predictions);
+    }
+  }
+
+  // Dart performs drop out during training and weights each tree, which the fused
+  // prediction epilogue does not model.
+  [[nodiscard]] bool FusedPredictGradient(DMatrix*, PredictionCacheEntry*, ObjFunction const&,
+                                          linalg::Matrix<GradientPair>*) override {
+    return false;
+  }
+
   void InplacePredict(std::shared_ptr<DMatrix> p_fmat, float missing,
                       PredictionCacheEntry* p_out_preds, bst_layer_t layer_begin,
                       bst_layer_t layer_end) const override {
@@ -999,6 +1298,39 @@ class Dart : public GBTree {
     return num_drop;
   }
 
+  // Accumulate `w * predts` of a single tree into the running output.
+  void AccumulateTree(HostDeviceVector<bst_float>& predts, float w, bst_tree_t tree_idx,
+                      bst_idx_t n_rows, HostDeviceVector<bst_float>* p_out) const {
+    auto n_groups = model_.learner_model_param->num_output_group;
+    auto group = model_.tree_info.at(tree_idx);
+    CHECK_EQ(p_out->Size(), predts.Size());
+    if (predts.Device().IsCUDA()) {
+      p_out->SetDevice(predts.Device());
+      GPUDartPredictInc(p_out->DeviceSpan(), predts.DeviceSpan(), w, n_rows, n_groups, group);
+    } else {
+      auto& h_out = p_out->HostVector();
+      auto& h_predts = predts.HostVector();
+      common::ParallelFor(n_rows, ctx_->Threads(), [&](auto ridx) {
+        const size_t offset = ridx * n_groups + group;
+        h_out[offset] += h_predts[offset] * w;
+      });
+    }
+  }
+
+  // Element-wise addition of a prediction vector covering all groups.
+  void AddPredts(HostDeviceVector<bst_float>& predts, HostDeviceVector<bst_float>* p_out) const {
+    CHECK_EQ(p_out->Size(), predts.Size());
+    if (predts.Device().IsCUDA()) {
+      p_out->SetDevice(predts.Device());
+      GPUDartAddPredts(p_out->DeviceSpan(), predts.DeviceSpan());
+    } else {
+      auto& h_out = p_out->HostVector();
+      auto& h_predts = predts.HostVector();
+      common::ParallelFor(predts.Size(), ctx_->Threads(),
+                          [&](auto i) { h_out[i] += h_predts[i]; });
+    }
+  }
+
   // init thread buffers
   inline void InitThreadTemp(int nthread) {
     int prev_thread_temp_size = thread_temp_.size();
@@ -1017,6 +1349,14 @@ class Dart : public GBTree {
   std::vector<bst_float> weight_drop_;
   // indexes of dropped trees
   std::vector<size_t> idx_drop_;
+  // Incremental training-prediction state, see PredictBatchIncremental.  The matrix
+  // pointer binds the cached sum to one training matrix, the weight snapshot records
+  // the weights the sum reflects.
+  DMatrix const* cached_fmat_{nullptr};
+  HostDeviceVector<bst_float> cached_sum_;
+  std::vector<bst_float> cached_weights_;
+  // Per-tree prediction columns for the most recent trees and the last dropout set.
+  std::map<bst_tree_t, HostDeviceVector<bst_float>> cached_tree_predts_;
   // temporal storage for per thread
   std::vector<RegTree::FVec> thread_temp_;
 };
@@ -30,6 +30,10 @@ void GPUDartPredictInc(common::Span<float> out_predts,
   });
 }
 
+void GPUDartAddPredts(common::Span<float> out_predts, common::Span<float> predts) {
+  dh::LaunchN(out_predts.size(), [=] XGBOOST_DEVICE(std::size_t i) { out_predts[i] += predts[i]; });
+}
+
 void GPUDartInplacePredictInc(common::Span<float> out_predts, common::Span<float> predts,
                               float tree_w, size_t n_rows,
                               linalg::TensorView<float const, 1> base_score, bst_group_t n_groups,
@@ -12,11 +12,13 @@
 #include <algorithm>
 #include <cstdint>  // std::int32_t
 #include <memory>
+#include <mutex>    // for mutex, lock_guard
 #include <numeric>  // for iota
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "../common/threading_utils.h"  // for ParallelFor
 #include "../common/timer.h"
 #include "../tree/param.h"  // TrainParam
 #include "gbtree_model.h"
@@ -55,6 +57,8 @@ struct GBTreeTrainParam : public XGBoostParameter<GBTreeTrainParam> {
   TreeProcessType process_type;
   // tree construction method
   TreeMethod tree_method;
+  /*! \brief whether to train the trees of different output groups concurrently */
+  bool parallel_class_trees;
   // declare parameters
   DMLC_DECLARE_PARAMETER(GBTreeTrainParam) {
     DMLC_DECLARE_FIELD(updater_seq).describe("Tree updater sequence.").set_default("");
@@ -73,6 +77,10 @@ struct GBTreeTrainParam : public XGBoostParameter<GBTreeTrainParam> {
         .add_enum("hist",      TreeMethod::kHist)
         .add_enum("gpu_hist",  TreeMethod::kGPUHist)
         .describe("Choice of tree construction method.");
+    DMLC_DECLARE_FIELD(parallel_class_trees)
+        .set_default(false)
+        .describe("Run the per-class tree updates of one boosting round concurrently, "
+                  "splitting the thread budget between the classes.");
   }
 };
 
@@ -88,6 +96,8 @@ struct DartTrainParam : public XGBoostParameter<DartTrainParam> {
   bool one_drop;
   /*! \brief probability of skipping the dropout during an iteration */
   float skip_drop;
+  /*! \brief number of most recent trees whose per-row predictions are cached */
+  int n_cached_trees;
   // declare parameters
   DMLC_DECLARE_PARAMETER(DartTrainParam) {
     DMLC_DECLARE_FIELD(sample_type)
@@ -111,6 +121,12 @@ struct DartTrainParam : public XGBoostParameter<DartTrainParam> {
         .set_range(0.0f, 1.0f)
         .set_default(0.0f)
         .describe("Probability of skipping the dropout during a boosting iteration.");
+    DMLC_DECLARE_FIELD(n_cached_trees)
+        .set_lower_bound(0)
+        .set_default(64)
+        .describe(
+            "Number of most recent trees whose per-row predictions are kept around to speed "
+            "up the incremental training prediction.");
   }
 };
 
@@ -177,7 +193,7 @@ class GBTree : public GradientBooster {
   void UpdateTreeLeaf(DMatrix const* p_fmat, HostDeviceVector<float> const& predictions,
                       ObjFunction const* obj, std::int32_t group_idx,
                       std::vector<HostDeviceVector<bst_node_t>> const& node_position,
-                      std::vector<std::unique_ptr<RegTree>>* p_trees);
+                      TreesOneGroup* p_trees);
   /**
    * @brief Carry out one iteration of boosting.
    */
@@ -188,6 +204,8 @@ class GBTree : public GradientBooster {
 
   [[nodiscard]] GBTreeTrainParam const& GetTrainParam() const { return tparam_; }
 
+  [[nodiscard]] GBTreeModel const& GetModel() const { return model_; }
+
   void Load(dmlc::Stream* fi) override { model_.Load(fi); }
   void Save(dmlc::Stream* fo) const override {
     model_.Save(fo);
@@ -199,6 +217,8 @@ class GBTree : public GradientBooster {
   void SaveModel(Json* p_out) const override;
   void LoadModel(Json const& in) override;
 
+  [[nodiscard]] std::function<void(Json*)> SaveModelSnapshot() const override;
+
   // slice the trees, out must be already allocated
   void Slice(bst_layer_t begin, bst_layer_t end, bst_layer_t step, GradientBooster* out,
              bool* out_of_bound) const override;
@@ -214,62 +234,69 @@ class GBTree : public GradientBooster {
   void PredictBatch(DMatrix* p_fmat, PredictionCacheEntry* out_preds, bool training,
                     bst_layer_t layer_begin, bst_layer_t layer_end) override;
 
+  [[nodiscard]] bool FusedPredictGradient(DMatrix* p_fmat, PredictionCacheEntry* out_preds,
+                                          ObjFunction const& obj,
+                                          linalg::Matrix<GradientPair>* out_gpair) override;
+
   void InplacePredict(std::shared_ptr<DMatrix> p_m, float missing, PredictionCacheEntry* out_preds,
                       bst_layer_t layer_begin, bst_layer_t layer_end) const override;
 
   void FeatureScore(std::string const& importance_type, common::Span<int32_t const> trees,
                     std::vector<bst_feature_t>* features,
                     std::vector<float>* scores) const override {
+    if (importance_type != "weight" && importance_type != "gain" &&
+        importance_type != "total_gain" && importance_type != "cover" &&
+        importance_type != "total_cover") {
+      LOG(FATAL)
+          << "Unknown feature importance type, expected one of: "
+          << R"({"weight", "total_gain", "total_cover", "gain", "cover"}, got: )"
+          << importance_type;
+    }
+    model_.EnsureAllTrees();
+    if (importance_type != "weight" && !model_.trees.empty() &&
+        model_.trees.front()->IsMultiTarget()) {
+      LOG(FATAL) << importance_type << " " << MTNotImplemented();
+    }
+
     // Because feature with no importance doesn't appear in the return value so
     // we need to set up another pair of vectors to store the values during
     // computation.
-    std::vector<size_t> split_counts(this->model_.learner_model_param->num_feature, 0);
-    std::vector<float> gain_map(this->model_.learner_model_param->num_feature, 0);
-    std::vector<int32_t> tree_idx;
+    std::vector<size_t> split_counts;
+    std::vector<float> gains;
+    std::vector<float> covers;
     if (trees.empty()) {
-      tree_idx.resize(this->model_.trees.size());
-      std::iota(tree_idx.begin(), tree_idx.end(), 0);
-      trees = common::Span<int32_t const>(tree_idx);
-    }
-
-    auto total_n_trees = model_.trees.size();
-    auto add_score = [&](auto fn) {
-      for (auto idx : trees) {
-        CHECK_LE(idx, total_n_trees) << "Invalid tree index.";
-        auto const& tree = *model_.trees[idx];
-        tree.WalkTree([&](bst_node_t nidx) {
-          if (!tree.IsLeaf(nidx)) {
-            split_counts[tree.SplitIndex(nidx)]++;
-            fn(tree, nidx, tree.SplitIndex(nidx));
-          }
-          return true;
-        });
+      // The common query over the whole model is served from a cumulative cache that is
+      // extended only by the trees committed since the last call, so polling the
+      // importance between boosting rounds walks one round of trees instead of the
+      // entire model.
+      std::lock_guard<std::mutex> guard{feature_score_mu_};
+      auto& cache = feature_score_cache_;
+      if (cache.n_scored > model_.trees.size()) {
+        // The model shrank underneath the cache, start over.
+        cache = {};
+      }
+      if (cache.n_scored < model_.trees.size()) {
+        std::vector<int32_t> delta(model_.trees.size() - cache.n_scored);
+        std::iota(delta.begin(), delta.end(), static_cast<int32_t>(cache.n_scored));
+        this->AccumulateFeatureScores(delta, &cache.split_counts, &cache.gains, &cache.covers);
+        cache.n_scored = model_.trees.size();
       }
-    };
+      split_counts = cache.split_counts;
+      gains = cache.gains;
+      covers = cache.covers;
+    } else {
+      this->AccumulateFeatureScores(trees, &split_counts, &gains, &covers);
+    }
 
+    std::vector<float> gain_map(split_counts.size(), 0);
     if (importance_type == "weight") {
-      add_score([&](auto const&, bst_node_t, bst_feature_t split) {
-        gain_map[split] = split_counts[split];
-      });
-    } else if (importance_type == "gain" || importance_type == "total_gain") {
-      if (!model_.trees.empty() && model_.trees.front()->IsMultiTarget()) {
-        LOG(FATAL) << "gain/total_gain " << MTNotImplemented();
-      }
-      add_score([&](auto const& tree, bst_node_t nidx, bst_feature_t split) {
-        gain_map[split] += tree.Stat(nidx).loss_chg;
-      });
-    } else if (importance_type == "cover" || importance_type == "total_cover") {
-      if (!model_.trees.empty() && model_.trees.front()->IsMultiTarget()) {
-        LOG(FATAL) << "cover/total_cover " << MTNotImplemented();
+      for (size_t i = 0; i < gain_map.size(); ++i) {
+        gain_map[i] = split_counts[i];
       }
-      add_score([&](auto const& tree, bst_node_t nidx, bst_feature_t split) {
-        gain_map[split] += tree.Stat(nidx).sum_hess;
-      });
+    } else if (importance_type == "gain" || importance_type == "total_gain") {
+      gain_map = gains;
     } else {
-      LOG(FATAL)
-          << "Unknown feature importance type, expected one of: "
-          << R"({"weight", "total_gain", "total_cover", "gain", "cover"}, got: )"
-          << importance_type;
+      gain_map = covers;
     }
     if (importance_type == "gain" || importance_type == "cover") {
       for (size_t i = 0; i < gain_map.size(); ++i) {
@@ -291,6 +318,7 @@ class GBTree : public GradientBooster {
                        uint32_t layer_begin, uint32_t layer_end) override {
     std::uint32_t _, tree_end;
     std::tie(_, tree_end) = detail::LayerToTree(model_, layer_begin, layer_end);
+    model_.EnsureTrees(0, tree_end);
     cpu_predictor_->PredictInstance(inst, out_preds, model_, tree_end);
   }
 
@@ -300,6 +328,7 @@ class GBTree : public GradientBooster {
     auto [tree_begin, tree_end] = detail::LayerToTree(model_, layer_begin, layer_end);
     CHECK_EQ(tree_begin, 0) << "Predict leaf supports only iteration end: (0, "
                                "n_iteration), use model slicing instead.";
+    model_.EnsureTrees(0, tree_end);
     this->GetPredictor(false)->PredictLeaf(p_fmat, out_preds, model_, tree_end);
   }
 
@@ -309,6 +338,7 @@ class GBTree : public GradientBooster {
     auto [tree_begin, tree_end] = detail::LayerToTree(model_, layer_begin, layer_end);
     CHECK_EQ(tree_begin, 0) << "Predict contribution supports only iteration end: (0, "
                                "n_iteration), using model slicing instead.";
+    model_.EnsureTrees(0, tree_end);
     this->GetPredictor(false)->PredictContribution(p_fmat, out_contribs, model_, tree_end, nullptr,
                                                    approximate);
   }
@@ -319,6 +349,7 @@ class GBTree : public GradientBooster {
     auto [tree_begin, tree_end] = detail::LayerToTree(model_, layer_begin, layer_end);
     CHECK_EQ(tree_begin, 0) << "Predict interaction contribution supports only iteration end: (0, "
                                "n_iteration), using model slicing instead.";
+    model_.EnsureTrees(0, tree_end);
     this->GetPredictor(false)->PredictInteractionContributions(p_fmat, out_contribs, model_,
                                                                tree_end, nullptr, approximate);
   }
@@ -330,8 +361,21 @@ class GBTree : public GradientBooster {
 
  protected:
   void BoostNewTrees(linalg::Matrix<GradientPair>* gpair, DMatrix* p_fmat, int bst_group,
+                     std::vector<std::unique_ptr<TreeUpdater>> const& updaters,
                      std::vector<HostDeviceVector<bst_node_t>>* out_position,
-                     std::vector<std::unique_ptr<RegTree>>* ret);
+                     TreesOneGroup* ret);
+
+  // Whether the per-class trees of this boosting round can be trained concurrently.
+  [[nodiscard]] bool ShouldBoostGroupsParallel(ObjFunction const* obj,
+                                               bst_target_t n_groups) const;
+  /**
+   * @brief Train the trees of one boosting round for all output groups concurrently.
+   *
+   * @return Whether the prediction cache was updated for every group.
+   */
+  [[nodiscard]] bool BoostGroupsParallel(linalg::Matrix<GradientPair>* in_gpair, DMatrix* p_fmat,
+                                         linalg::MatrixView<float> out_predt,
+                                         PredictionCacheEntry* predt, TreesOneIter* p_new_trees);
 
   [[nodiscard]] std::unique_ptr<Predictor> const& GetPredictor(
       bool is_training, HostDeviceVector<float> const* out_pred = nullptr,
@@ -340,6 +384,50 @@ class GBTree : public GradientBooster {
   // commit new trees all at once
   virtual void CommitModel(TreesOneIter&& new_trees);
 
+  // Walk the given trees in parallel and add their per-feature split count, total gain
+  // and total cover to the output buffers, merging per-thread accumulators once.  The
+  // stats are skipped for multi-target trees, which carry no node statistics.
+  void AccumulateFeatureScores(common::Span<int32_t const> trees, std::vector<size_t>* p_counts,
+                               std::vector<float>* p_gains, std::vector<float>* p_covers) const {
+    auto n_features = model_.learner_model_param->num_feature;
+    auto n_threads = ctx_->Threads();
+    p_counts->resize(n_features, 0);
+    p_gains->resize(n_features, 0);
+    p_covers->resize(n_features, 0);
+
+    std::vector<std::vector<size_t>> tloc_counts(n_threads, std::vector<size_t>(n_features, 0));
+    std::vector<std::vector<double>> tloc_gains(n_threads, std::vector<double>(n_features, 0));
+    std::vector<std::vector<double>> tloc_covers(n_threads, std::vector<double>(n_features, 0));
+    common::ParallelFor(trees.size(), n_threads, [&](std::size_t i) {
+      auto idx = trees[i];
+      CHECK_LE(static_cast<std::size_t>(idx), model_.trees.size()) << "Invalid tree index.";
+      auto tid = omp_get_thread_num();
+      auto& counts = tloc_counts[tid];
+      auto& gains = tloc_gains[tid];
+      auto& covers = tloc_covers[tid];
+      auto const& tree = *model_.trees[idx];
+      bool has_stats = !tree.IsMultiTarget();
+      tree.WalkTree([&](bst_node_t nidx) {
+        if (!tree.IsLeaf(nidx)) {
+          auto split = tree.SplitIndex(nidx);
+          counts[split]++;
+          if (has_stats) {
+            gains[split] += tree.Stat(nidx).loss_chg;
+            covers[split] += tree.Stat(nidx).sum_hess;
+          }
+        }
+        return true;
+      });
+    });
+    for (std::int32_t tid = 0; tid < n_threads; ++tid) {
+      for (bst_feature_t f = 0; f < n_features; ++f) {
+        (*p_counts)[f] += tloc_counts[tid][f];
+        (*p_gains)[f] += static_cast<float>(tloc_gains[tid][f]);
+        (*p_covers)[f] += static_cast<float>(tloc_covers[tid][f]);
+      }
+    }
+  }
+
   // --- data structure ---
   GBTreeModel model_;
   // training parameter
@@ -347,6 +435,8 @@ class GBTree : public GradientBooster {
   // Tree training parameter
   tree::TrainParam tree_param_;
   bool specified_updater_   {false};
+  // the configuration, saved for constructing per-group updaters
+  Args cfg_;
   // the updaters that can be applied to each of tree
   std::vector<std::unique_ptr<TreeUpdater>> updaters_;
   // Predictors
@@ -355,6 +445,16 @@ class GBTree : public GradientBooster {
 #if defined(XGBOOST_USE_SYCL)
   std::unique_ptr<Predictor> sycl_predictor_;
 #endif  // defined(XGBOOST_USE_SYCL)
+  // Cumulative feature importance over the first n_scored trees, extended lazily by
+  // FeatureScore so repeated whole-model queries during training only walk new trees.
+  struct FeatureScoreCache {
+    std::size_t n_scored{0};
+    std::vector<size_t> split_counts;
+    std::vector<float> gains;
+    std::vector<float> covers;
+  };
+  mutable FeatureScoreCache feature_score_cache_;
+  mutable std::mutex feature_score_mu_;
   common::Monitor monitor_;
 };
 
@@ -13,6 +13,7 @@
 #include "dmlc/base.h"                  // for BeginPtr
 #include "dmlc/io.h"                    // for Stream
 #include "xgboost/context.h"            // for Context
+#include "xgboost/global_config.h"      // for GlobalConfigThreadLocalStore
 #include "xgboost/json.h"               // for Json, get, Integer, Array, FromJson, ToJson, Json...
 #include "xgboost/learner.h"            // for LearnerModelParam
 #include "xgboost/logging.h"            // for LogCheck_EQ, CHECK_EQ, CHECK
@@ -51,6 +52,7 @@ void Validate(GBTreeModel const& model) {
 }  // namespace
 
 void GBTreeModel::Save(dmlc::Stream* fo) const {
+  this->EnsureAllTrees();
   CHECK_EQ(param.num_trees, static_cast<int32_t>(trees.size()));
 
   if (DMLC_IO_NO_ENDIAN_SWAP) {
@@ -76,6 +78,14 @@ void GBTreeModel::Save(dmlc::Stream* fo) const {
 }
 
 void GBTreeModel::Load(dmlc::Stream* fi) {
+  if (lazy_) {
+    this->EnsureAllTrees();
+    if (lazy_->worker.joinable()) {
+      lazy_->worker.join();
+    }
+    lazy_.reset();
+  }
+
   CHECK_EQ(fi->Read(&param, sizeof(param)), sizeof(param))
       << "GBTree: invalid model file";
   if (!DMLC_IO_NO_ENDIAN_SWAP) {
@@ -104,9 +114,11 @@ void GBTreeModel::Load(dmlc::Stream* fi) {
 
   MakeIndptr(this);
   Validate(*this);
+  ++version_;
 }
 
 void GBTreeModel::SaveModel(Json* p_out) const {
+  this->EnsureAllTrees();
   auto& out = *p_out;
   CHECK_EQ(param.num_trees, static_cast<int>(trees.size()));
   out["gbtree_model_param"] = ToJson(param);
@@ -135,6 +147,16 @@ void GBTreeModel::SaveModel(Json* p_out) const {
 }
 
 void GBTreeModel::LoadModel(Json const& in) {
+  if (lazy_) {
+    // A previous lazy load may still be completing in the background; finish it and
+    // stop the worker before the tree vector is replaced.
+    this->EnsureAllTrees();
+    if (lazy_->worker.joinable()) {
+      lazy_->worker.join();
+    }
+    lazy_.reset();
+  }
+
   FromJson(in["gbtree_model_param"], &param);
 
   trees.clear();
@@ -150,11 +172,24 @@ void GBTreeModel::LoadModel(Json const& in) {
   CHECK_EQ(tree_info_json.size(), param.num_trees);
   tree_info.resize(param.num_trees);
 
-  common::ParallelFor(param.num_trees, ctx_->Threads(), [&](auto t) {
-    auto tree_id = get<Integer const>(trees_json[t]["id"]);
-    trees.at(tree_id).reset(new RegTree{});
-    trees[tree_id]->LoadModel(trees_json[t]);
-  });
+  if (GlobalConfigThreadLocalStore::Get()->lazy_tree_load && param.num_trees != 0) {
+    // Record the per-tree JSON (shallow copies) and defer the actual deserialization:
+    // callers complete the ranges they touch through EnsureTrees while a background
+    // thread fills in the rest, so the model starts serving before it is fully built.
+    lazy_ = std::make_shared<LazyLoad>();
+    lazy_->sources.resize(param.num_trees);
+    for (bst_tree_t t = 0; t < param.num_trees; ++t) {
+      auto tree_id = get<Integer const>(trees_json[t]["id"]);
+      lazy_->sources.at(tree_id) = trees_json[t];
+    }
+    lazy_->n_pending = param.num_trees;
+  } else {
+    common::ParallelFor(param.num_trees, ctx_->Threads(), [&](auto t) {
+      auto tree_id = get<Integer const>(trees_json[t]["id"]);
+      trees.at(tree_id).reset(new RegTree{});
+      trees[tree_id]->LoadModel(trees_json[t]);
+    });
+  }
 
   for (bst_tree_t i = 0; i < param.num_trees; ++i) {
     tree_info[i] = get<Integer const>(tree_info_json[i]);
@@ -172,6 +207,48 @@ void GBTreeModel::LoadModel(Json const& in) {
   }
 
   Validate(*this);
+  ++version_;
+
+  if (lazy_) {
+    // The worker materializes one tree per lock acquisition, so a prediction that needs
+    // a range right away only ever waits for a single tree.  The lambda deliberately
+    // borrows the state instead of sharing ownership: the model destructor joins the
+    // worker, and the thread must never hold the last reference, otherwise ~LazyLoad
+    // would join the worker from itself.
+    lazy_->worker = std::thread{[this, lazy = lazy_.get()] {
+      for (bst_tree_t t = 0; t < param.num_trees && !lazy->done.load(std::memory_order_acquire);
+           ++t) {
+        this->EnsureTrees(t, t + 1);
+      }
+    }};
+  }
+}
+
+void GBTreeModel::EnsureTrees(bst_tree_t tree_begin, bst_tree_t tree_end) const {
+  auto lazy = lazy_;  // keep the state alive while working on it
+  if (!lazy || lazy->done.load(std::memory_order_acquire)) {
+    return;
+  }
+  // Filling in a deferred tree does not change the observable model.
+  auto* self = const_cast<GBTreeModel*>(this);
+  std::lock_guard<std::mutex> guard{lazy->mu};
+  if (lazy->sources.empty()) {
+    return;
+  }
+  for (bst_tree_t t = tree_begin; t < tree_end; ++t) {
+    if (self->trees[t]) {
+      continue;
+    }
+    auto tree = std::make_shared<RegTree>();
+    tree->LoadModel(lazy->sources[t]);
+    self->trees[t] = std::move(tree);
+    if (--lazy->n_pending == 0) {
+      // Free the JSON once the last tree is in place.
+      lazy->sources.clear();
+      lazy->sources.shrink_to_fit();
+      lazy->done.store(true, std::memory_order_release);
+    }
+  }
 }
 
 bst_tree_t GBTreeModel::CommitModel(TreesOneIter&& new_trees) {
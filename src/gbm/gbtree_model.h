@@ -8,13 +8,18 @@
 #include <dmlc/io.h>
 #include <dmlc/parameter.h>
 #include <xgboost/context.h>
+#include <xgboost/json.h>  // for Json
 #include <xgboost/learner.h>
 #include <xgboost/model.h>
 #include <xgboost/parameter.h>
 #include <xgboost/tree_model.h>
 
+#include <atomic>   // for atomic
+#include <cstdint>  // for uint64_t
 #include <memory>
+#include <mutex>    // for mutex
 #include <string>
+#include <thread>   // for thread
 #include <utility>
 #include <vector>
 
@@ -28,7 +33,7 @@ namespace gbm {
 /**
  * \brief Container for all trees built (not update) for one group.
  */
-using TreesOneGroup = std::vector<std::unique_ptr<RegTree>>;
+using TreesOneGroup = std::vector<std::shared_ptr<RegTree>>;
 /**
  * \brief Container for all trees built (not update) for one iteration.
  */
@@ -85,6 +90,16 @@ struct GBTreeModel : public Model {
  public:
   explicit GBTreeModel(LearnerModelParam const* learner_model, Context const* ctx)
       : learner_model_param{learner_model}, ctx_{ctx} {}
+  ~GBTreeModel() {
+    if (lazy_) {
+      // Stop and join the background materialization before the trees are destroyed;
+      // the worker dereferences this model.
+      lazy_->done.store(true, std::memory_order_release);
+      if (lazy_->worker.joinable()) {
+        lazy_->worker.join();
+      }
+    }
+  }
   void Configure(const Args& cfg) {
     // initialize model parameters if not yet been initialized.
     if (trees.size() == 0) {
@@ -93,9 +108,16 @@ struct GBTreeModel : public Model {
   }
 
   void InitTreesToUpdate() {
+    this->EnsureAllTrees();
     if (trees_to_update.size() == 0u) {
       for (auto & tree : trees) {
-        trees_to_update.push_back(std::move(tree));
+        if (tree.use_count() > 1) {
+          // The tree is shared with a sliced model; updating mutates it in place, so
+          // detach a private copy first.
+          trees_to_update.push_back(std::make_shared<RegTree>(*tree));
+        } else {
+          trees_to_update.push_back(std::move(tree));
+        }
       }
       trees.clear();
       param.num_trees = 0;
@@ -103,6 +125,7 @@ struct GBTreeModel : public Model {
 
       iteration_indptr.clear();
       iteration_indptr.push_back(0);
+      ++version_;
     }
   }
 
@@ -112,8 +135,21 @@ struct GBTreeModel : public Model {
   void SaveModel(Json* p_out) const override;
   void LoadModel(Json const& p_out) override;
 
+  /**
+   * \brief Make sure the trees in `[tree_begin, tree_end)` are deserialized.
+   *
+   * A no-op unless the model was loaded with the `lazy_tree_load` global flag, in which
+   * case `LoadModel` only records the per-tree JSON and a background thread fills in
+   * the trees; callers about to walk a tree range complete that range up front here.
+   * Materialization is logically const, the observable model never changes.
+   */
+  void EnsureTrees(bst_tree_t tree_begin, bst_tree_t tree_end) const;
+  /** \brief Make sure every tree is deserialized, see \ref EnsureTrees. */
+  void EnsureAllTrees() const { this->EnsureTrees(0, param.num_trees); }
+
   [[nodiscard]] std::vector<std::string> DumpModel(const FeatureMap& fmap, bool with_stats,
                                                    int32_t n_threads, std::string format) const {
+    this->EnsureAllTrees();
     std::vector<std::string> dump(trees.size());
     common::ParallelFor(trees.size(), n_threads,
                         [&](size_t i) { dump[i] = trees[i]->DumpModel(fmap, with_stats, format); });
@@ -126,13 +162,22 @@ struct GBTreeModel : public Model {
    */
   bst_tree_t CommitModel(TreesOneIter&& new_trees);
 
-  void CommitModelGroup(std::vector<std::unique_ptr<RegTree>>&& new_trees, bst_target_t group_idx) {
+  void CommitModelGroup(TreesOneGroup&& new_trees, bst_target_t group_idx) {
     for (auto& new_tree : new_trees) {
       trees.push_back(std::move(new_tree));
       tree_info.push_back(group_idx);
     }
     param.num_trees += static_cast<int>(new_trees.size());
+    ++version_;
   }
+  /**
+   * \brief Counter increased whenever the set of trees changes.
+   *
+   * Committed trees are immutable, so derived representations of the model (e.g. the
+   * flattened layout used by the CPU predictor) stay valid as long as the version and
+   * the tree range they were built from are unchanged.
+   */
+  [[nodiscard]] std::uint64_t Version() const { return version_; }
 
   [[nodiscard]] std::int32_t BoostedRounds() const {
     if (trees.empty()) {
@@ -145,10 +190,11 @@ struct GBTreeModel : public Model {
   LearnerModelParam const* learner_model_param;
   // model parameter
   GBTreeModelParam param;
-  /*! \brief vector of trees stored in the model */
-  std::vector<std::unique_ptr<RegTree> > trees;
+  /*! \brief vector of trees stored in the model.  Trees are immutable once committed and
+   *  may be shared with models created by `Slice`. */
+  TreesOneGroup trees;
   /*! \brief for the update process, a place to keep the initial trees */
-  std::vector<std::unique_ptr<RegTree> > trees_to_update;
+  TreesOneGroup trees_to_update;
   /**
    * \brief Group index for trees.
    */
@@ -159,10 +205,39 @@ struct GBTreeModel : public Model {
   std::vector<bst_tree_t> iteration_indptr{0};
 
  private:
+  /**
+   * \brief Deferred deserialization state for lazily loaded models.
+   *
+   * Holds the per-tree JSON until the corresponding entry in `trees` is materialized.
+   * Shared between copies of the model so a sliced or snapshotted copy can still fill
+   * its own null entries; mutation and copy entry points call \ref EnsureAllTrees
+   * first, so only fully materialized models escape this object's lifetime.
+   */
+  struct LazyLoad {
+    // Per-tree JSON source, cleared once every tree is materialized.
+    std::vector<Json> sources;
+    std::mutex mu;
+    std::atomic<bst_tree_t> n_pending{0};
+    std::atomic<bool> done{false};
+    // Background materialization of the trees not requested yet.  The worker borrows
+    // this state, it never owns a reference: ~GBTreeModel stops and joins it, the join
+    // here is a safety net for state that outlives the launching model.
+    std::thread worker;
+    ~LazyLoad() {
+      done.store(true, std::memory_order_release);
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+  };
+
   /**
    * \brief Whether the stack contains multi-target tree.
    */
   Context const* ctx_;
+  std::uint64_t version_{0};
+  // The model destructor stops and joins the worker before `trees` is destroyed.
+  std::shared_ptr<LazyLoad> lazy_;
 };
 }  // namespace gbm
 }  // namespace xgboost
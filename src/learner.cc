@@ -18,9 +18,11 @@
 #include <cstdint>                        // for int32_t, uint32_t, int64_t, uint64_t
 #include <cstdlib>                        // for atoi
 #include <cstring>                        // for memcpy, size_t, memset
+#include <future>                         // for async, future, launch
 #include <iomanip>                        // for operator<<, setiosflags
 #include <iterator>                       // for back_insert_iterator, distance, back_inserter
 #include <limits>                         // for numeric_limits
+#include <map>                            // for map
 #include <memory>                         // for allocator, unique_ptr, shared_ptr, operator==
 #include <mutex>                          // for mutex, lock_guard
 #include <set>                            // for set
@@ -42,8 +44,11 @@
 #include "common/io.h"                    // for PeekableInStream, ReadAll, FixedSizeStream, Mem...
 #include "common/observer.h"              // for TrainingObserver
 #include "common/random.h"                // for GlobalRandom
+#include "common/threading_utils.h"       // for OmpHotTeamGuard, ThreadGovernor
+#include "common/threadpool.h"            // for ThreadPool
 #include "common/timer.h"                 // for Monitor
 #include "common/version.h"               // for Version
+#include "data/simple_dmatrix.h"          // for SimpleDMatrix
 #include "dmlc/endian.h"                  // for ByteSwap, DMLC_IO_NO_ENDIAN_SWAP
 #include "xgboost/base.h"                 // for Args, bst_float, GradientPair, bst_feature_t, ...
 #include "xgboost/context.h"              // for Context
@@ -322,6 +327,12 @@ void LearnerModelParam::Copy(LearnerModelParam const& that) {
 struct LearnerTrainParam : public XGBoostParameter<LearnerTrainParam> {
   // flag to disable default metric
   bool disable_default_eval_metric {false};
+  // Fraction of validation rows used for the staged metric evaluation.  1 disables it.
+  float eval_subsample{1.0f};
+  // Relative band around the best sampled score that escalates to a full evaluation.
+  float eval_escalation_band{0.05f};
+  // Whether metric evaluation runs on a helper thread, one round late.
+  bool async_eval{false};
   // FIXME(trivialfis): The following parameters belong to model itself, but can be
   // specified by users.  Move them to model parameter once we can get rid of binary IO.
   std::string booster;
@@ -334,6 +345,28 @@ struct LearnerTrainParam : public XGBoostParameter<LearnerTrainParam> {
     DMLC_DECLARE_FIELD(disable_default_eval_metric)
         .set_default(false)
         .describe("Flag to disable default metric. Set to >0 to disable");
+    DMLC_DECLARE_FIELD(eval_subsample)
+        .set_default(1.0f)
+        .set_range(0.0f, 1.0f)
+        .describe(
+            "Fraction of validation rows used for the staged metric evaluation.  Each round the "
+            "metrics are first computed on a cached row sample of the validation sets; the full "
+            "set is evaluated only when the sampled score of the last metric comes within "
+            "`eval_escalation_band` of the best sampled score.  Set to 1 to always evaluate the "
+            "full set.  Only in-memory DMatrix can be sampled.");
+    DMLC_DECLARE_FIELD(eval_escalation_band)
+        .set_default(0.05f)
+        .set_lower_bound(0.0f)
+        .describe(
+            "Relative band around the best sampled metric score within which the staged "
+            "evaluation escalates to the full validation set.");
+    DMLC_DECLARE_FIELD(async_eval)
+        .set_default(false)
+        .describe(
+            "Compute the metric scores on a helper thread so the evaluation overlaps with the "
+            "next boosting round.  Predictions are still made synchronously; the scores are "
+            "reported one round late and the first call reports no scores.  Ignored for "
+            "distributed training and when `eval_subsample` is in use.");
     DMLC_DECLARE_FIELD(booster).set_default("gbtree").describe(
         "Gradient booster used for training.");
     DMLC_DECLARE_FIELD(objective)
@@ -359,6 +392,9 @@ using LearnerAPIThreadLocalStore =
 class LearnerConfiguration : public Learner {
  private:
   std::mutex config_lock_;
+  // Register this learner with the process-wide thread governor so concurrent learners
+  // split the CPU budget instead of oversubscribing it.
+  common::ThreadGovernor::Participant governor_participant_;
 
  protected:
   static std::string const kEvalMetric;  // NOLINT
@@ -366,6 +402,10 @@ class LearnerConfiguration : public Learner {
  protected:
   std::atomic<bool> need_configuration_;
   std::map<std::string, std::string> cfg_;
+  // Snapshot of the parameters already applied by Configure.  Used to detect no-op
+  // SetParam calls so repeatedly setting identical parameters (common in serving
+  // setups) does not trigger a full reconfiguration on the predict path.
+  std::map<std::string, std::string> applied_cfg_;
   // Stores information like best-iteration for early stopping.
   std::map<std::string, std::string> attributes_;
   // Name of each feature, usually set from DMatrix.
@@ -497,6 +537,11 @@ class LearnerConfiguration : public Learner {
       this->ValidateParameters();
     }
 
+    // Remember what has been applied, future SetParam calls with identical values are
+    // no-ops and skip the reconfiguration.
+    for (auto const& kv : cfg_) {
+      applied_cfg_[kv.first] = kv.second;
+    }
     cfg_.clear();
     monitor_.Stop("Configure");
   }
@@ -560,6 +605,7 @@ class LearnerConfiguration : public Learner {
     // make sure the GPU ID is valid in new environment before start running configure.
     ctx_.ConfigureGpuId(false);
 
+    this->applied_cfg_.clear();
     this->need_configuration_ = true;
   }
 
@@ -592,15 +638,23 @@ class LearnerConfiguration : public Learner {
   }
 
   void SetParam(const std::string& key, const std::string& value) override {
-    this->need_configuration_ = true;
     if (key == kEvalMetric) {
       if (std::find(metric_names_.cbegin(), metric_names_.cend(),
                     value) == metric_names_.cend()) {
         metric_names_.emplace_back(value);
+        this->need_configuration_ = true;
       }
-    } else {
-      cfg_[key] = value;
+      return;
     }
+    auto applied = applied_cfg_.find(key);
+    if (applied != applied_cfg_.cend() && applied->second == value &&
+        cfg_.find(key) == cfg_.cend()) {
+      // The parameter already has this value and there's no pending change to
+      // override, nothing to reconfigure.
+      return;
+    }
+    this->need_configuration_ = true;
+    cfg_[key] = value;
   }
   // Short hand for setting multiple parameters
   void SetParams(std::vector<std::pair<std::string, std::string>> const& args) override {
@@ -862,8 +916,53 @@ class LearnerIO : public LearnerConfiguration {
 
   void ClearCaches() { this->prediction_container_ = PredictionContainer{}; }
 
+  // Pending background write started by SaveModelAsync.
+  std::future<void> pending_save_;
+
+  // Save everything except the gradient booster.  The booster section is filled in by
+  // the caller, so that SaveModelAsync can serialize a snapshot of it in the background.
+  void SaveModelExceptBooster(Json* p_out) const {
+    CHECK(!this->need_configuration_) << "Call Configure before saving model.";
+    this->CheckModelInitialized();
+
+    Version::Save(p_out);
+    Json& out { *p_out };
+
+    out["learner"] = Object();
+    auto& learner = out["learner"];
+
+    learner["learner_model_param"] = mparam_.ToJson();
+
+    learner["objective"] = Object();
+    auto& objective_fn = learner["objective"];
+    obj_->SaveConfig(&objective_fn);
+
+    learner["attributes"] = Object();
+    for (auto const& kv : attributes_) {
+      learner["attributes"][kv.first] = String(kv.second);
+    }
+
+    learner["feature_names"] = Array();
+    auto& feature_names = get<Array>(learner["feature_names"]);
+    for (auto const& name : feature_names_) {
+      feature_names.emplace_back(name);
+    }
+    learner["feature_types"] = Array();
+    auto& feature_types = get<Array>(learner["feature_types"]);
+    for (auto const& type : feature_types_) {
+      feature_types.emplace_back(type);
+    }
+  }
+
  public:
   explicit LearnerIO(std::vector<std::shared_ptr<DMatrix>> cache) : LearnerConfiguration{cache} {}
+  ~LearnerIO() override {
+    // Let a pending checkpoint finish.  Errors are lost here, call FinishSaveModelAsync
+    // before destruction to observe them.
+    if (pending_save_.valid()) {
+      pending_save_.wait();
+    }
+  }
 
   void LoadModel(Json const& in) override {
     CHECK(IsA<Object>(in));
@@ -913,43 +1012,45 @@ class LearnerIO : public LearnerConfiguration {
                      [](Json const& fn) { return get<String const>(fn); });
     }
 
+    this->applied_cfg_.clear();
     this->need_configuration_ = true;
     this->ClearCaches();
   }
 
   void SaveModel(Json* p_out) const override {
-    CHECK(!this->need_configuration_) << "Call Configure before saving model.";
-    this->CheckModelInitialized();
-
-    Version::Save(p_out);
-    Json& out { *p_out };
-
-    out["learner"] = Object();
-    auto& learner = out["learner"];
-
-    learner["learner_model_param"] = mparam_.ToJson();
+    this->SaveModelExceptBooster(p_out);
+    auto& learner = (*p_out)["learner"];
     learner["gradient_booster"] = Object();
-    auto& gradient_booster = learner["gradient_booster"];
-    gbm_->SaveModel(&gradient_booster);
-
-    learner["objective"] = Object();
-    auto& objective_fn = learner["objective"];
-    obj_->SaveConfig(&objective_fn);
+    gbm_->SaveModel(&learner["gradient_booster"]);
+  }
 
-    learner["attributes"] = Object();
-    for (auto const& kv : attributes_) {
-      learner["attributes"][kv.first] = String(kv.second);
-    }
+  void SaveModelAsync(std::string const& fname) override {
+    // Only one snapshot can be in flight, wait for the previous write and surface its
+    // errors before starting a new one.
+    this->FinishSaveModelAsync();
+
+    Json out{Object{}};
+    this->SaveModelExceptBooster(&out);
+    // Snapshotting the booster only copies shared tree pointers, the expensive
+    // serialization is deferred to the background thread.
+    auto save_booster = gbm_->SaveModelSnapshot();
+
+    auto mode = common::FileExtension(fname) == "json" ? std::ios::out : std::ios::binary;
+    pending_save_ = std::async(std::launch::async, [out, save_booster, fname, mode] {
+      auto& learner = out["learner"];
+      learner["gradient_booster"] = Object();
+      save_booster(&learner["gradient_booster"]);
+
+      std::vector<char> str;
+      Json::Dump(out, &str, mode);
+      std::unique_ptr<dmlc::Stream> fo{dmlc::Stream::Create(fname.c_str(), "w")};
+      fo->Write(str.data(), str.size());
+    });
+  }
 
-    learner["feature_names"] = Array();
-    auto& feature_names = get<Array>(learner["feature_names"]);
-    for (auto const& name : feature_names_) {
-      feature_names.emplace_back(name);
-    }
-    learner["feature_types"] = Array();
-    auto& feature_types = get<Array>(learner["feature_types"]);
-    for (auto const& type : feature_types_) {
-      feature_types.emplace_back(type);
+  void FinishSaveModelAsync() override {
+    if (pending_save_.valid()) {
+      pending_save_.get();
     }
   }
 
@@ -992,6 +1093,10 @@ class LearnerIO : public LearnerConfiguration {
       } else {
         LOG(FATAL) << "Invalid model format";
       }
+      // Release the raw buffer before materializing the model to lower the transient
+      // memory usage.
+      buffer.clear();
+      buffer.shrink_to_fit();
       this->LoadModel(model);
       return;
     }
@@ -1080,6 +1185,7 @@ class LearnerIO : public LearnerConfiguration {
     auto n = tparam_.__DICT__();
     cfg_.insert(n.cbegin(), n.cend());
 
+    this->applied_cfg_.clear();
     this->need_configuration_ = true;
     this->ClearCaches();
   }
@@ -1170,6 +1276,8 @@ class LearnerIO : public LearnerConfiguration {
       } else {
         LOG(FATAL) << "Invalid serialization file.";
       }
+      buffer.clear();
+      buffer.shrink_to_fit();
       if (IsA<Null>(memory_snapshot["Model"])) {
         // R has xgb.load that doesn't distinguish whether configuration is saved.
         // We should migrate to use `xgb.load.raw` instead.
@@ -1212,6 +1320,9 @@ class LearnerImpl : public LearnerIO {
   explicit LearnerImpl(std::vector<std::shared_ptr<DMatrix> > cache)
       : LearnerIO{cache} {}
   ~LearnerImpl() override {
+    if (pending_eval_.valid()) {
+      pending_eval_.wait();
+    }
     auto local_map = LearnerAPIThreadLocalStore::Get();
     if (local_map->find(this) != local_map->cend()) {
       local_map->erase(this);
@@ -1267,6 +1378,11 @@ class LearnerImpl : public LearnerIO {
   void UpdateOneIter(int iter, std::shared_ptr<DMatrix> train) override {
     monitor_.Start("UpdateOneIter");
     TrainingObserver::Instance().Update(iter);
+    if (this->need_configuration_ && pending_eval_.valid()) {
+      // Reconfiguration may replace the metrics while the helper thread reads them,
+      // finish the in-flight evaluation first.
+      pending_eval_.wait();
+    }
     this->Configure();
     this->InitBaseScore(train.get());
 
@@ -1276,22 +1392,56 @@ class LearnerImpl : public LearnerIO {
 
     this->ValidateDMatrix(train.get(), true);
 
-    auto& predt = prediction_container_.Cache(train, ctx_.Device());
+    // Keep the worker team alive for the many small parallel regions in one iteration.
+    common::OmpHotTeamGuard hot_team{ctx_.Threads()};
 
-    monitor_.Start("PredictRaw");
-    this->PredictRaw(train.get(), &predt, true, 0, 0);
-    TrainingObserver::Instance().Observe(predt.predictions, "Predictions");
-    monitor_.Stop("PredictRaw");
+    auto& predt = prediction_container_.Cache(train, ctx_.Device());
 
-    monitor_.Start("GetGradient");
-    GetGradient(predt.predictions, train->Info(), iter, &gpair_);
-    monitor_.Stop("GetGradient");
+    // Fused prediction and gradient saves one pass over the prediction vector on
+    // supported objectives.  The first iteration takes the two-pass route so that the
+    // objective can validate the labels.
+    bool fused = false;
+    if (iter > 0 && !collective::IsDistributed()) {
+      monitor_.Start("FusedPredictGradient");
+      fused = gbm_->FusedPredictGradient(train.get(), &predt, *obj_, &gpair_);
+      monitor_.Stop("FusedPredictGradient");
+    }
+    if (!fused) {
+      monitor_.Start("PredictRaw");
+      this->PredictRaw(train.get(), &predt, true, 0, 0);
+      TrainingObserver::Instance().Observe(predt.predictions, "Predictions");
+      monitor_.Stop("PredictRaw");
+
+      monitor_.Start("GetGradient");
+      GetGradient(predt.predictions, train->Info(), iter, &gpair_);
+      monitor_.Stop("GetGradient");
+    }
     TrainingObserver::Instance().Observe(*gpair_.Data(), "Gradients");
 
     gbm_->DoBoost(train.get(), &gpair_, &predt, obj_.get());
     monitor_.Stop("UpdateOneIter");
   }
 
+  void TransferPredictionCache(DMatrix const* old, std::shared_ptr<DMatrix> p_fmat) override {
+    CHECK(p_fmat);
+    auto entry = prediction_container_.TransferItem(old, p_fmat);
+    if (!entry) {
+      // Nothing cached for the old matrix.
+      return;
+    }
+    // The caller promises row identity, verify what we can.
+    if (entry->predictions.Size() != 0 &&
+        entry->predictions.Size() !=
+            p_fmat->Info().num_row_ * learner_model_param_.OutputLength()) {
+      // Broken promise.  Drop the transferred state so the next prediction on the new
+      // matrix starts from scratch instead of reading out of bounds.
+      entry->predictions.Resize(0);
+      entry->Reset();
+      LOG(FATAL) << "Prediction cache can only be transferred between matrices with identical "
+                    "rows.";
+    }
+  }
+
   void BoostOneIter(int iter, std::shared_ptr<DMatrix> train,
                     linalg::Matrix<GradientPair>* in_gpair) override {
     monitor_.Start("BoostOneIter");
@@ -1330,20 +1480,67 @@ class LearnerImpl : public LearnerIO {
       metrics_.back()->Configure({cfg_.begin(), cfg_.end()});
     }
 
+    // The staged evaluation needs the scores right away to decide on escalation, and in
+    // distributed training the metric allreduce must not interleave with the collective
+    // calls of the next boosting round, so both fall back to the synchronous path.
+    if (tparam_.async_eval && !collective::IsDistributed() && !(tparam_.eval_subsample < 1.0f)) {
+      auto res = this->AsyncEvalOneIter(iter, data_sets, data_names);
+      monitor_.Stop("EvalOneIter");
+      return res;
+    }
+
+    auto eval_set = [&](std::shared_ptr<DMatrix> const &p_fmat) {
+      auto &predt = prediction_container_.Cache(p_fmat, ctx_.Device());
+      this->ValidateDMatrix(p_fmat.get(), false);
+      this->PredictRaw(p_fmat.get(), &predt, false, 0, 0);
+
+      // Metrics consume the transformed prediction.  Metrics that can fuse the
+      // objective's transform into their own reduction get the raw margin instead;
+      // when every metric does, the transformed copy is never materialized.  Otherwise
+      // the transform runs once, and only when it's not an identity.
+      auto const fused = obj_->FusedGradient();
+      std::vector<double> scores(metrics_.size());
+      HostDeviceVector<float> const *transformed = nullptr;
+      for (std::size_t j = 0; j < metrics_.size(); ++j) {
+        if (metrics_[j]->EvaluateMargin(predt.predictions, p_fmat, fused, &scores[j])) {
+          continue;
+        }
+        if (!transformed) {
+          if (obj_->IdentityEvalTransform()) {
+            transformed = &predt.predictions;
+          } else {
+            auto &out = output_predictions_.Cache(p_fmat, ctx_.Device()).predictions;
+            out.Resize(predt.predictions.Size());
+            out.Copy(predt.predictions);
+            obj_->EvalTransform(&out);
+            transformed = &out;
+          }
+        }
+        scores[j] = metrics_[j]->Evaluate(*transformed, p_fmat);
+      }
+      return scores;
+    };
+    auto emit = [&](std::string const &name, std::vector<double> const &scores) {
+      for (std::size_t j = 0; j < metrics_.size(); ++j) {
+        os << '\t' << name << '-' << metrics_[j]->Name() << ':' << scores[j];
+      }
+    };
+
     for (size_t i = 0; i < data_sets.size(); ++i) {
       std::shared_ptr<DMatrix> m = data_sets[i];
-      auto &predt = prediction_container_.Cache(m, ctx_.Device());
-      this->ValidateDMatrix(m.get(), false);
-      this->PredictRaw(m.get(), &predt, false, 0, 0);
-
-      auto &out = output_predictions_.Cache(m, ctx_.Device()).predictions;
-      out.Resize(predt.predictions.Size());
-      out.Copy(predt.predictions);
-
-      obj_->EvalTransform(&out);
-      for (auto& ev : metrics_) {
-        os << '\t' << data_names[i] << '-' << ev->Name() << ':' << ev->Evaluate(out, m);
+      if (tparam_.eval_subsample < 1.0f && !metrics_.empty()) {
+        // Staged evaluation: score a cached row sample first, touch the full set only
+        // when the sampled score is in the band of the best one seen so far.
+        auto sample = this->SampledEvalSet(m);
+        if (sample) {
+          auto scores = eval_set(sample);
+          if (!this->ShouldEscalateEval(data_names[i], scores.back())) {
+            emit(data_names[i], scores);
+            continue;
+          }
+        }
       }
+      emit(data_names[i], eval_set(m));
     }
 
     monitor_.Stop("EvalOneIter");
@@ -1372,7 +1569,15 @@ class LearnerImpl : public LearnerIO {
     } else if (pred_leaf) {
       gbm_->PredictLeaf(data.get(), out_preds, layer_begin, layer_end);
     } else {
-      auto& prediction = prediction_container_.Cache(data, ctx_.Device());
+      // Only full-model predictions may use the incremental training cache.  A ranged
+      // prediction resets the entry's version, which would silently force the next
+      // training-time evaluation on this matrix to re-predict from the first tree.
+      bool full_range = layer_begin == 0 && layer_end == 0;
+      auto& prediction = full_range ? prediction_container_.Cache(data, ctx_.Device())
+                                    : output_predictions_.Cache(data, ctx_.Device());
+      if (!full_range) {
+        prediction.Reset();
+      }
       this->PredictRaw(data.get(), &prediction, training, layer_begin, layer_end);
       // Copy the prediction cache to output prediction. out_preds comes from C API
       out_preds->SetDevice(ctx_.Device());
@@ -1477,6 +1682,125 @@ class LearnerImpl : public LearnerIO {
                                 [&] { obj_->GetGradient(preds, info, iter, out_gpair); });
   }
 
+  // Mirrors the maximize-metric prefixes used by the Python early-stopping callback.
+  [[nodiscard]] static bool IsMaximizeMetric(std::string const& name) {
+    for (auto const* prefix : {"auc", "aucpr", "pre", "map", "ndcg"}) {
+      if (name.rfind(prefix, 0) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Cached row sample of a validation set for the staged evaluation, or nullptr when
+  // sampling doesn't apply (external data, tiny set, too many rows to index).
+  [[nodiscard]] std::shared_ptr<DMatrix> SampledEvalSet(std::shared_ptr<DMatrix> const& m) {
+    auto it = eval_sample_.find(m.get());
+    if (it != eval_sample_.end() && it->second.first.lock() == m) {
+      return it->second.second;
+    }
+    if (dynamic_cast<data::SimpleDMatrix*>(m.get()) == nullptr) {
+      return nullptr;
+    }
+    auto n_samples = m->Info().num_row_;
+    if (n_samples > static_cast<bst_idx_t>(std::numeric_limits<std::int32_t>::max())) {
+      return nullptr;
+    }
+    // Systematic every-k-th row sample: cheap, deterministic, and close to stratified
+    // since class proportions are preserved regardless of the row order.
+    auto stride = static_cast<bst_idx_t>(std::ceil(1.0 / tparam_.eval_subsample));
+    if (n_samples <= stride) {
+      return nullptr;
+    }
+    std::vector<std::int32_t> ridxs;
+    for (bst_idx_t i = 0; i < n_samples; i += stride) {
+      ridxs.push_back(static_cast<std::int32_t>(i));
+    }
+    std::shared_ptr<DMatrix> sample{m->Slice(ridxs)};
+    eval_sample_[m.get()] = {m, sample};
+    return sample;
+  }
+
+  // Off-load the metric computation of this round to a helper thread and return the
+  // result of the previous round, so the evaluation overlaps with the next boosting
+  // round.  Predictions and the objective transform stay on the caller thread since
+  // they touch the model and the prediction cache that the next round mutates; the
+  // helper only reduces the snapshotted predictions and formats the output.
+  std::string AsyncEvalOneIter(int iter, std::vector<std::shared_ptr<DMatrix>> const& data_sets,
+                               std::vector<std::string> const& data_names) {
+    std::string prev;
+    if (pending_eval_.valid()) {
+      prev = pending_eval_.get();
+    } else {
+      // Nothing in flight yet, the first call reports no scores.
+      std::ostringstream os;
+      os << '[' << iter << ']';
+      prev = os.str();
+    }
+
+    if (!eval_pool_) {
+      auto config = *GlobalConfigThreadLocalStore::Get();
+      eval_pool_ = std::make_unique<common::ThreadPool>(
+          StringView{"eval"}, 1, [config] { *GlobalConfigThreadLocalStore::Get() = config; });
+    }
+    // The helper is idle once the previous future is consumed, so a single snapshot
+    // per dataset is sufficient.
+    if (eval_snapshots_.size() < data_sets.size()) {
+      eval_snapshots_.resize(data_sets.size());
+    }
+    for (std::size_t i = 0; i < data_sets.size(); ++i) {
+      auto const& p_fmat = data_sets[i];
+      auto& predt = prediction_container_.Cache(p_fmat, ctx_.Device());
+      this->ValidateDMatrix(p_fmat.get(), false);
+      this->PredictRaw(p_fmat.get(), &predt, false, 0, 0);
+
+      if (!eval_snapshots_[i]) {
+        eval_snapshots_[i] = std::make_unique<HostDeviceVector<float>>();
+      }
+      auto& snapshot = *eval_snapshots_[i];
+      snapshot.SetDevice(ctx_.Device());
+      snapshot.Resize(predt.predictions.Size());
+      snapshot.Copy(predt.predictions);
+      if (!obj_->IdentityEvalTransform()) {
+        obj_->EvalTransform(&snapshot);
+      }
+    }
+
+    pending_eval_ = eval_pool_->Submit([this, iter, data_sets, data_names] {
+      std::ostringstream os;
+      os.precision(std::numeric_limits<double>::max_digits10);
+      os << '[' << iter << ']' << std::setiosflags(std::ios::fixed);
+      for (std::size_t i = 0; i < data_sets.size(); ++i) {
+        for (std::size_t j = 0; j < metrics_.size(); ++j) {
+          os << '\t' << data_names[i] << '-' << metrics_[j]->Name() << ':'
+             << metrics_[j]->Evaluate(*eval_snapshots_[i], data_sets[i]);
+        }
+      }
+      return os.str();
+    });
+    return prev;
+  }
+
+  // Whether the sampled score of the last metric is close enough to the best sampled
+  // score that the full validation set should be evaluated this round.
+  [[nodiscard]] bool ShouldEscalateEval(std::string const& data_name, double sampled) {
+    std::string name = metrics_.back()->Name();
+    auto maximize = IsMaximizeMetric(name);
+    auto key = data_name + '-' + name;
+    auto it = best_sampled_score_.find(key);
+    if (it == best_sampled_score_.end()) {
+      best_sampled_score_.emplace(key, sampled);
+      return true;
+    }
+    auto best = it->second;
+    if (maximize ? sampled > best : sampled < best) {
+      it->second = sampled;
+    }
+    auto band = static_cast<double>(tparam_.eval_escalation_band) *
+                std::max(std::abs(best), static_cast<double>(kRtEps));
+    return maximize ? sampled >= best - band : sampled <= best + band;
+  }
+
   /*! \brief random number transformation seed. */
   static int32_t constexpr kRandSeedMagic = 127;
   // gradient pairs
@@ -1484,6 +1808,17 @@ class LearnerImpl : public LearnerIO {
   /*! \brief Temporary storage to prediction.  Useful for storing data transformed by
    *  objective function */
   PredictionContainer output_predictions_;
+  // Helper thread for the asynchronous evaluation, the result of the in-flight round,
+  // and the prediction snapshots the helper reads.
+  std::unique_ptr<common::ThreadPool> eval_pool_;
+  std::future<std::string> pending_eval_;
+  std::vector<std::unique_ptr<HostDeviceVector<float>>> eval_snapshots_;
+  // Row samples of the validation sets for the staged evaluation, keyed by the source
+  // matrix with its handle kept to guard against address reuse.
+  std::map<DMatrix const*, std::pair<std::weak_ptr<DMatrix>, std::shared_ptr<DMatrix>>>
+      eval_sample_;
+  // Best sampled score seen so far, keyed by `<data_name>-<metric_name>`.
+  std::map<std::string, double> best_sampled_score_;
 };
 
 constexpr int32_t LearnerImpl::kRandSeedMagic;
@@ -3,8 +3,12 @@
  * \author Rory Mitchell
  */
 
+#include <thrust/copy.h>
 #include <thrust/execution_policy.h>
+#include <thrust/fill.h>
 #include <thrust/inner_product.h>
+
+#include <algorithm>  // for min
 #include <xgboost/data.h>
 #include <xgboost/linear_updater.h>
 #include "xgboost/span.h"
@@ -115,14 +119,38 @@ class GPUCoordinateUpdater : public LinearUpdater {  // NOLINT
     selector_->Setup(ctx_, *model, in_gpair->Data()->ConstHostVector(), p_fmat,
                      tparam_.reg_alpha_denorm, tparam_.reg_lambda_denorm, coord_param_.top_k);
     monitor_.Start("UpdateFeature");
+    // The cyclic and shuffle selectors fix the visitation order up front, so blocks of
+    // coordinates can be evaluated per kernel launch instead of paying two launches and
+    // a blocking reduction for every feature.  The greedy selectors need fresh gradients
+    // between picks and keep the one-at-a-time path.
+    bool const can_batch =
+        ctx_->IsCUDA() && (tparam_.feature_selector == kCyclic ||
+                           tparam_.feature_selector == kShuffle);
     for (uint32_t group_idx = 0; group_idx < model->learner_model_param->num_output_group;
          ++group_idx) {
-      for (auto i = 0U; i < model->learner_model_param->num_feature; i++) {
-        auto fidx =
-            selector_->NextFeature(ctx_, i, *model, group_idx, in_gpair->Data()->ConstHostVector(),
-                                   p_fmat, tparam_.reg_alpha_denorm, tparam_.reg_lambda_denorm);
-        if (fidx < 0) break;
-        this->UpdateFeature(fidx, group_idx, model);
+      if (can_batch) {
+        std::vector<int> order;
+        order.reserve(model->learner_model_param->num_feature);
+        for (auto i = 0U; i < model->learner_model_param->num_feature; i++) {
+          auto fidx = selector_->NextFeature(ctx_, i, *model, group_idx,
+                                             in_gpair->Data()->ConstHostVector(), p_fmat,
+                                             tparam_.reg_alpha_denorm, tparam_.reg_lambda_denorm);
+          if (fidx < 0) break;
+          order.push_back(fidx);
+        }
+        for (std::size_t begin = 0; begin < order.size(); begin += kCoordBatchSize) {
+          auto size = std::min(kCoordBatchSize, order.size() - begin);
+          this->UpdateFeatureBatch({order.data() + begin, size}, group_idx,
+                                   model->learner_model_param->num_output_group, model);
+        }
+      } else {
+        for (auto i = 0U; i < model->learner_model_param->num_feature; i++) {
+          auto fidx = selector_->NextFeature(ctx_, i, *model, group_idx,
+                                             in_gpair->Data()->ConstHostVector(), p_fmat,
+                                             tparam_.reg_alpha_denorm, tparam_.reg_lambda_denorm);
+          if (fidx < 0) break;
+          this->UpdateFeature(fidx, group_idx, model);
+        }
       }
     }
     monitor_.Stop("UpdateFeature");
@@ -167,6 +195,81 @@ class GPUCoordinateUpdater : public LinearUpdater {  // NOLINT
     }
   }
 
+  // This needs to be public because of the __device__ lambda.
+  void UpdateFeatureBatch(common::Span<int const> batch, int group_idx, int num_group,
+                          gbm::GBLinearModel *model) {
+    auto n = batch.size();
+    // Concatenated layout of the block: an exclusive scan over the column sizes plus the
+    // offset of each column in the flattened data.
+    std::vector<std::size_t> h_batch_ptr(n + 1, 0);
+    std::vector<std::size_t> h_col_begin(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      auto fidx = batch[i];
+      h_col_begin[i] = row_ptr_[fidx];
+      h_batch_ptr[i + 1] = h_batch_ptr[i] + (row_ptr_[fidx + 1] - row_ptr_[fidx]);
+    }
+    auto n_entries = h_batch_ptr.back();
+    if (n_entries == 0) {
+      return;
+    }
+
+    batch_ptr_.resize(h_batch_ptr.size());
+    col_begin_.resize(h_col_begin.size());
+    batch_sums_.resize(n);
+    thrust::copy(h_batch_ptr.cbegin(), h_batch_ptr.cend(), batch_ptr_.begin());
+    thrust::copy(h_col_begin.cbegin(), h_col_begin.cend(), col_begin_.begin());
+    thrust::fill(batch_sums_.begin(), batch_sums_.end(), GradientPairPrecise{});
+
+    auto d_data = dh::ToSpan(data_);
+    auto d_gpair = dh::ToSpan(gpair_);
+    auto d_batch_ptr = dh::ToSpan(batch_ptr_);
+    auto d_col_begin = dh::ToSpan(col_begin_);
+    auto d_sums = dh::ToSpan(batch_sums_);
+    // Fused gradient/Hessian reduction for the whole block in a single launch.
+    dh::LaunchN(n_entries, [=] __device__(std::size_t idx) {
+      auto seg = dh::SegmentId(d_batch_ptr, idx);
+      auto entry = d_data[d_col_begin[seg] + idx - d_batch_ptr[seg]];
+      auto g = d_gpair[entry.index * num_group + group_idx];
+      dh::AtomicAddGpair(&d_sums[seg], GradientPair{g.GetGrad() * entry.fvalue,
+                                                    g.GetHess() * entry.fvalue * entry.fvalue});
+    });
+
+    std::vector<GradientPairPrecise> h_sums(n);
+    dh::safe_cuda(cudaMemcpy(h_sums.data(), batch_sums_.data().get(),
+                             n * sizeof(GradientPairPrecise), cudaMemcpyDeviceToHost));
+
+    // Weight deltas are computed against the residuals at block entry: Jacobi within the
+    // block, Gauss-Seidel across blocks.
+    std::vector<float> h_dw(n);
+    bool any_update = false;
+    for (std::size_t i = 0; i < n; ++i) {
+      bst_float &w = (*model)[batch[i]][group_idx];
+      h_dw[i] = static_cast<float>(
+          tparam_.learning_rate * CoordinateDelta(h_sums[i].GetGrad(), h_sums[i].GetHess(), w,
+                                                  tparam_.reg_alpha_denorm,
+                                                  tparam_.reg_lambda_denorm));
+      w += h_dw[i];
+      any_update |= h_dw[i] != 0.0f;
+    }
+    if (!any_update) {
+      return;
+    }
+
+    batch_dw_.resize(n);
+    thrust::copy(h_dw.cbegin(), h_dw.cend(), batch_dw_.begin());
+    auto d_dw = dh::ToSpan(batch_dw_);
+    // Apply all residual deltas of the block in a single launch.
+    dh::LaunchN(n_entries, [=] __device__(std::size_t idx) {
+      auto seg = dh::SegmentId(d_batch_ptr, idx);
+      if (d_dw[seg] == 0.0f) {
+        return;
+      }
+      auto entry = d_data[d_col_begin[seg] + idx - d_batch_ptr[seg]];
+      auto &g = d_gpair[entry.index * num_group + group_idx];
+      g += GradientPair(g.GetHess() * d_dw[seg] * entry.fvalue, 0);
+    });
+  }
+
   // This needs to be public because of the __device__ lambda.
   GradientPair GetBiasGradient(int group_idx, int num_group) {
     dh::safe_cuda(cudaSetDevice(ctx_->Ordinal()));
@@ -238,9 +341,17 @@ class GPUCoordinateUpdater : public LinearUpdater {  // NOLINT
   std::unique_ptr<FeatureSelector> selector_;
   common::Monitor monitor_;
 
+  // Number of coordinates evaluated per kernel launch in the batched path.
+  static constexpr std::size_t kCoordBatchSize = 32;
+
   std::vector<size_t> row_ptr_;
   dh::device_vector<xgboost::Entry> data_;
   dh::caching_device_vector<GradientPair> gpair_;
+  // Scratch for the batched coordinate updates.
+  dh::caching_device_vector<std::size_t> batch_ptr_;
+  dh::caching_device_vector<std::size_t> col_begin_;
+  dh::caching_device_vector<GradientPairPrecise> batch_sums_;
+  dh::caching_device_vector<float> batch_dw_;
   size_t num_row_;
 };
 
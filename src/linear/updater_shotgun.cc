@@ -47,39 +47,57 @@ class ShotgunUpdater : public LinearUpdater {
       UpdateBiasResidualParallel(ctx_, gid, ngroup, dbias, &gpair->HostVector(), p_fmat);
     }
 
-    // lock-free parallel updates of weights
-    selector_->Setup(ctx_, *model, gpair->ConstHostVector(), p_fmat, param_.reg_alpha_denorm,
+    // Lock-free parallel updates of weights.  Each feature applies its residual delta to
+    // the shared gradient vector as soon as its weight moves; concurrent updates are
+    // tolerated by the shotgun algorithm.
+    auto const &const_gpair = gpair->ConstHostVector();
+    selector_->Setup(ctx_, *model, const_gpair, p_fmat, param_.reg_alpha_denorm,
                      param_.reg_lambda_denorm, 0);
     auto &h_gpair = gpair->HostVector();
     for (const auto &batch : p_fmat->GetBatches<CSCPage>(ctx_)) {
       auto page = batch.GetView();
       const auto nfeat = static_cast<bst_omp_uint>(batch.Size());
-      common::ParallelFor(nfeat, ctx_->Threads(), [&](auto i) {
-        int ii = selector_->NextFeature(ctx_, i, *model, 0, gpair->ConstHostVector(), p_fmat,
+      // Guided schedule since column lengths are heavily skewed on sparse data,
+      // otherwise threads owning the dense columns become stragglers.
+      common::ParallelFor(nfeat, ctx_->Threads(), common::Sched::Guided(), [&](auto i) {
+        int ii = selector_->NextFeature(ctx_, i, *model, 0, const_gpair, p_fmat,
                                         param_.reg_alpha_denorm, param_.reg_lambda_denorm);
         if (ii < 0) return;
         const bst_uint fid = ii;
         auto col = page[ii];
-        for (int gid = 0; gid < ngroup; ++gid) {
-          double sum_grad = 0.0, sum_hess = 0.0;
-          for (auto &c : col) {
+        // Accumulate all output groups in one traversal: the gradient pairs for one row
+        // are contiguous, so this touches each cache line once instead of ngroup times.
+        common::MemStackAllocator<double, 16> sum_grad(ngroup, 0.0);
+        common::MemStackAllocator<double, 16> sum_hess(ngroup, 0.0);
+        for (auto &c : col) {
+          const bst_float v = c.fvalue;
+          for (int gid = 0; gid < ngroup; ++gid) {
             const GradientPair &p = h_gpair[c.index * ngroup + gid];
             if (p.GetHess() < 0.0f) continue;
-            const bst_float v = c.fvalue;
-            sum_grad += p.GetGrad() * v;
-            sum_hess += p.GetHess() * v * v;
+            sum_grad[gid] += p.GetGrad() * v;
+            sum_hess[gid] += p.GetHess() * v * v;
           }
+        }
+        common::MemStackAllocator<bst_float, 16> dw(ngroup, 0.0f);
+        bool any_update = false;
+        for (int gid = 0; gid < ngroup; ++gid) {
           bst_float &w = (*model)[fid][gid];
-          auto dw = static_cast<bst_float>(
-              param_.learning_rate * CoordinateDelta(sum_grad, sum_hess, w, param_.reg_alpha_denorm,
+          dw[gid] = static_cast<bst_float>(
+              param_.learning_rate * CoordinateDelta(sum_grad[gid], sum_hess[gid], w,
+                                                     param_.reg_alpha_denorm,
                                                      param_.reg_lambda_denorm));
-          if (dw == 0.f) continue;
-          w += dw;
-          // update grad values
-          for (auto &c : col) {
+          if (dw[gid] == 0.f) continue;
+          w += dw[gid];
+          any_update = true;
+        }
+        if (!any_update) return;
+        // update grad values
+        for (auto &c : col) {
+          for (int gid = 0; gid < ngroup; ++gid) {
+            if (dw[gid] == 0.f) continue;
             GradientPair &p = h_gpair[c.index * ngroup + gid];
             if (p.GetHess() < 0.0f) continue;
-            p += GradientPair(p.GetHess() * c.fvalue * dw, 0);
+            p += GradientPair(p.GetHess() * c.fvalue * dw[gid], 0);
           }
         }
       });
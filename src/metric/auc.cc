@@ -10,6 +10,7 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -146,6 +147,65 @@ std::tuple<double, double, double> BinaryROCAUC(Context const *ctx,
   return BinaryAUC(predts, labels, weights, sorted_idx, TrapezoidArea);
 }
 
+/**
+ * \brief Approximate binary ROC-AUC from a fixed-resolution histogram of predictions.
+ *
+ * Buckets the predictions into `n_buckets` equal-width bins and treats each bin as one
+ * tied block, so the result equals the exact AUC of predictions quantized to the bin
+ * width.  Runs in O(n + n_buckets) instead of sorting the predictions, for validation
+ * sets where the argsort would cost more than the boosting step.
+ */
+std::tuple<double, double, double> BinaryROCAUCBucketed(Context const *,
+                                                        common::Span<float const> predts,
+                                                        linalg::VectorView<float const> labels,
+                                                        common::OptionalWeights weights,
+                                                        bst_bin_t n_buckets) {
+  CHECK_GE(n_buckets, 2);
+  CHECK_NE(labels.Size(), 0);
+  CHECK_EQ(labels.Size(), predts.size());
+
+  float lo = std::numeric_limits<float>::max();
+  float hi = std::numeric_limits<float>::lowest();
+  for (auto v : predts) {
+    lo = std::min(lo, v);
+    hi = std::max(hi, v);
+  }
+  double range = static_cast<double>(hi) - static_cast<double>(lo);
+
+  std::vector<double> pos(n_buckets, 0.0), neg(n_buckets, 0.0);
+  for (std::size_t i = 0; i < predts.size(); ++i) {
+    bst_bin_t b = 0;
+    if (range > 0) {
+      b = static_cast<bst_bin_t>((predts[i] - lo) / range * n_buckets);
+      b = std::min(b, n_buckets - 1);
+    }
+    auto label = labels(i);
+    auto w = weights[i];
+    pos[b] += label * w;
+    neg[b] += (1.0 - label) * w;
+  }
+
+  // Walk the buckets from the highest prediction down, each non-empty bucket forms a
+  // tied block like the tied predictions in `BinaryAUC`.
+  double fp{0}, tp{0}, fp_prev{0}, tp_prev{0}, auc{0};
+  for (bst_bin_t b = n_buckets - 1; b >= 0; --b) {
+    if (pos[b] == 0.0 && neg[b] == 0.0) {
+      continue;
+    }
+    tp += pos[b];
+    fp += neg[b];
+    auc += TrapezoidArea(fp_prev, fp, tp_prev, tp);
+    tp_prev = tp;
+    fp_prev = fp;
+  }
+  if (fp <= 0.0 || tp <= 0.0) {
+    auc = 0;
+    fp = 0;
+    tp = 0;
+  }
+  return std::make_tuple(fp, tp, auc);
+}
+
 /**
  * Calculate AUC for 1 ranking group;
  */
@@ -329,8 +389,21 @@ class EvalAUC : public MetricNoCache {
 
 class EvalROCAUC : public EvalAUC<EvalROCAUC> {
   std::shared_ptr<DeviceAUCCache> d_cache_;
+  // Number of histogram buckets for the approximate CPU implementation, 0 for the exact
+  // sort-based one.  The GPU and the per-group ranking implementations stay exact.
+  bst_bin_t n_buckets_{0};
+  std::string name_{"auc"};
 
  public:
+  explicit EvalROCAUC(char const *param) {
+    if (param) {
+      n_buckets_ = std::stoi(param);
+      CHECK_GE(n_buckets_, 2) << "`auc@n` requires at least 2 buckets, got: " << param;
+      name_ += "@";
+      name_ += param;
+    }
+  }
+
   std::pair<double, uint32_t> EvalRanking(HostDeviceVector<float> const &predts,
                                           MetaInfo const &info) {
     double auc{0};
@@ -353,6 +426,14 @@ class EvalROCAUC : public EvalAUC<EvalROCAUC> {
     CHECK_NE(n_classes, 0);
     if (ctx_->IsCUDA()) {
       auc = GPUMultiClassROCAUC(ctx_, predts.ConstDeviceSpan(), info, &this->d_cache_, n_classes);
+    } else if (n_buckets_ > 0) {
+      auto n_buckets = n_buckets_;
+      auc = MultiClassOVR(ctx_, predts.ConstHostVector(), info, n_classes, n_threads,
+                          [n_buckets](Context const *ctx, common::Span<float const> p,
+                                      linalg::VectorView<float const> l,
+                                      common::OptionalWeights w) {
+                            return BinaryROCAUCBucketed(ctx, p, l, w, n_buckets);
+                          });
     } else {
       auc = MultiClassOVR(ctx_, predts.ConstHostVector(), info, n_classes, n_threads, BinaryROCAUC);
     }
@@ -365,6 +446,10 @@ class EvalROCAUC : public EvalAUC<EvalROCAUC> {
     if (ctx_->IsCUDA()) {
       std::tie(fp, tp, auc) =
           GPUBinaryROCAUC(ctx_, predts.ConstDeviceSpan(), info, &this->d_cache_);
+    } else if (n_buckets_ > 0) {
+      std::tie(fp, tp, auc) = BinaryROCAUCBucketed(
+          ctx_, predts.ConstHostVector(), info.labels.HostView().Slice(linalg::All(), 0),
+          common::OptionalWeights{info.weights_.ConstHostSpan()}, n_buckets_);
     } else {
       std::tie(fp, tp, auc) = BinaryROCAUC(ctx_, predts.ConstHostVector(),
                                            info.labels.HostView().Slice(linalg::All(), 0),
@@ -374,14 +459,12 @@ class EvalROCAUC : public EvalAUC<EvalROCAUC> {
   }
 
  public:
-  [[nodiscard]] char const* Name() const override {
-    return "auc";
-  }
+  [[nodiscard]] char const* Name() const override { return name_.c_str(); }
 };
 
 XGBOOST_REGISTER_METRIC(EvalAUC, "auc")
 .describe("Receiver Operating Characteristic Area Under the Curve.")
-.set_body([](const char*) { return new EvalROCAUC(); });
+.set_body([](const char* param) { return new EvalROCAUC(param); });
 
 #if !defined(XGBOOST_USE_CUDA)
 std::tuple<double, double, double> GPUBinaryROCAUC(Context const *, common::Span<float const>,
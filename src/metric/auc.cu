@@ -1,8 +1,9 @@
 /**
  * Copyright 2021-2024, XGBoost Contributors
  */
-#include <thrust/copy.h>     // for copy
-#include <thrust/logical.h>  // for any_of
+#include <thrust/copy.h>        // for copy
+#include <thrust/functional.h>  // for maximum
+#include <thrust/logical.h>     // for any_of
 #include <thrust/scan.h>
 
 #include <cassert>
@@ -14,6 +15,7 @@
 
 #include "../collective/allreduce.h"
 #include "../common/algorithm.cuh"        // SegmentedArgSort, InclusiveScan
+#include "../common/common.h"             // DivRoundUp
 #include "../common/optional_weight.h"    // OptionalWeights
 #include "../common/threading_utils.cuh"  // UnravelTrapeziodIdx,SegmentedTrapezoidThreads
 #include "auc.h"
@@ -480,6 +482,70 @@ struct RankScanItem {
   double w;
   bst_group_t group_id;
 };
+
+// Upper bound on documents per query handled by the warp-per-query kernel.
+constexpr std::uint32_t kMaxDocsPerWarp = 64;
+
+/**
+ * @brief Compute per-query ranking AUC with one warp per query.
+ *
+ *  Each lane keeps up to two documents in registers and pairs are enumerated through
+ *  warp shuffles, avoiding the segmented argsort and the global pairwise scan of the
+ *  general path, both of which are dominated by passes over huge segment arrays when
+ *  there are millions of tiny queries.  The pair orientation normally obtained from the
+ *  stable descending sort over labels is recovered by comparing labels directly: the
+ *  document with the greater label comes first, and ties keep the original order.
+ */
+__global__ void RankingAUCSmallGroupKernel(common::Span<float const> d_predts,
+                                           common::Span<float const> d_labels,
+                                           common::Span<float const> d_weights,
+                                           common::Span<bst_group_t const> d_group_ptr,
+                                           common::Span<double> d_group_auc) {
+  std::uint32_t warp_idx = (blockIdx.x * blockDim.x + threadIdx.x) / 32;
+  std::uint32_t lane = threadIdx.x % 32;
+  if (warp_idx >= d_group_auc.size()) {
+    return;
+  }
+  std::uint32_t begin = d_group_ptr[warp_idx];
+  std::uint32_t n = d_group_ptr[warp_idx + 1] - begin;
+
+  double auc = 0;
+  if (n >= 3) {
+    // Lane t owns documents t and t + 32 within the query.
+    float l0 = 0, p0 = 0, l1 = 0, p1 = 0;
+    if (lane < n) {
+      l0 = d_labels[begin + lane];
+      p0 = d_predts[begin + lane];
+    }
+    if (lane + 32u < n) {
+      l1 = d_labels[begin + lane + 32];
+      p1 = d_predts[begin + lane + 32];
+    }
+    auto score = [](float la, float pa, float lb, float pb) {
+      // Document a precedes b in the stable descending label order.
+      float d = la >= lb ? pa - pb : pb - pa;
+      return d > 0 ? 1.0 : (d == 0 ? 0.5 : 0.0);
+    };
+    for (std::uint32_t b = 1; b < n; ++b) {
+      float lb = __shfl_sync(0xffffffffu, b < 32 ? l0 : l1, b % 32);
+      float pb = __shfl_sync(0xffffffffu, b < 32 ? p0 : p1, b % 32);
+      if (lane < b) {
+        auc += score(l0, p0, lb, pb);
+      }
+      if (lane + 32u < b) {
+        auc += score(l1, p1, lb, pb);
+      }
+    }
+    for (std::uint32_t offset = 16; offset > 0; offset /= 2) {
+      auc += __shfl_down_sync(0xffffffffu, auc, offset);
+    }
+  }
+  if (lane == 0) {
+    float w = d_weights.empty() ? 1.0f : d_weights[warp_idx];
+    double n_pairs = static_cast<double>(n) * (n - 1) / 2.0;
+    d_group_auc[warp_idx] = (n >= 3 && w > 0) ? auc / n_pairs : 0.0;
+  }
+}
 }  // anonymous namespace
 
 std::pair<double, std::uint32_t> GPURankingAUC(Context const *ctx, common::Span<float const> predts,
@@ -507,16 +573,35 @@ std::pair<double, std::uint32_t> GPURankingAUC(Context const *ctx, common::Span<
     return std::make_pair(0.0, 0);
   }
 
+  auto d_labels = info.labels.View(ctx->Device());
+  auto d_weights = info.weights_.ConstDeviceSpan();
+
   /**
-   * Sort the labels
+   * Small queries, one warp per query.
    */
-  auto d_labels = info.labels.View(ctx->Device());
+  std::size_t max_group =
+      thrust::reduce(ctx->CUDACtx()->CTP(), check_it, check_it + group_ptr.size() - 1,
+                     std::size_t{0}, thrust::maximum<std::size_t>{});
+  if (max_group <= kMaxDocsPerWarp) {
+    dh::TemporaryArray<double> d_auc(group_ptr.size() - 1);
+    auto s_d_auc = dh::ToSpan(d_auc);
+    std::uint32_t const kBlockThreads = 256;
+    auto grid = static_cast<std::uint32_t>(
+        common::DivRoundUp(d_auc.size() * 32, static_cast<std::size_t>(kBlockThreads)));
+    dh::LaunchKernel{grid, kBlockThreads, 0, ctx->CUDACtx()->Stream()}(
+        RankingAUCSmallGroupKernel, predts, d_labels.Values(), d_weights,
+        common::Span<bst_group_t const>{d_group_ptr}, s_d_auc);
+    double auc =
+        thrust::reduce(ctx->CUDACtx()->CTP(), dh::tbegin(s_d_auc), dh::tend(s_d_auc), 0.0);
+    return std::make_pair(auc, n_valid);
+  }
 
+  /**
+   * Sort the labels
+   */
   auto d_sorted_idx = dh::ToSpan(cache->sorted_idx);
   common::SegmentedArgSort<false, false>(ctx, d_labels.Values(), d_group_ptr, d_sorted_idx);
 
-  auto d_weights = info.weights_.ConstDeviceSpan();
-
   dh::caching_device_vector<size_t> threads_group_ptr(group_ptr.size(), 0);
   auto d_threads_group_ptr = dh::ToSpan(threads_group_ptr);
   // Use max to represent triangle
@@ -10,16 +10,18 @@
 
 #include <array>
 #include <cmath>
-#include <numeric>  // for accumulate
 
 #include "../common/math.h"
+#include "../common/numeric.h"          // for cpu_impl::Reduce
 #include "../common/optional_weight.h"  // OptionalWeights
 #include "../common/pseudo_huber.h"
 #include "../common/quantile_loss_utils.h"  // QuantileLossParam
 #include "../common/threading_utils.h"
+#include "../common/transform_iterator.h"  // for MakeIndexTransformIter
 #include "metric_common.h"              // MetricNoCache
 #include "xgboost/collective/result.h"  // for SafeColl
 #include "xgboost/metric.h"
+#include "xgboost/objective.h"          // for FusedGradientOp
 
 #if defined(XGBOOST_USE_CUDA)
 #include <thrust/functional.h>        // thrust::plus<>
@@ -65,28 +67,24 @@ PackedReduceResult Reduce(Context const* ctx, MetaInfo const& info, Fn&& loss) {
     common::AssertGPUSupport();
 #endif  //  defined(XGBOOST_USE_CUDA)
   } else {
-    auto n_threads = ctx->Threads();
-    std::vector<double> score_tloc(n_threads, 0.0);
-    std::vector<double> weight_tloc(n_threads, 0.0);
     // We sum over losses over all samples and targets instead of performing this for each
     // target since the first one approach more accurate while the second approach is used
     // for approximation in distributed setting.  For rmse:
     // - sqrt(1/w(sum_t0 + sum_t1 + ... + sum_tm))       // multi-target
     // - sqrt(avg_t0) + sqrt(avg_t1) + ... sqrt(avg_tm)  // distributed
-    common::ParallelFor(info.labels.Size(), ctx->Threads(), [&](size_t i) {
-      auto t_idx = omp_get_thread_num();
+    //
+    // The reduction is deterministic, the result doesn't change with the number of
+    // threads.
+    auto it = common::MakeIndexTransformIter([&](std::size_t i) {
       size_t sample_id;
       size_t target_id;
       std::tie(sample_id, target_id) = linalg::UnravelIndex(i, labels.Shape());
 
       float v, wt;
       std::tie(v, wt) = loss(i, sample_id, target_id);
-      score_tloc[t_idx] += v;
-      weight_tloc[t_idx] += wt;
+      return PackedReduceResult{v, wt};
     });
-    double residue_sum = std::accumulate(score_tloc.cbegin(), score_tloc.cend(), 0.0);
-    double weights_sum = std::accumulate(weight_tloc.cbegin(), weight_tloc.cend(), 0.0);
-    result = PackedReduceResult{residue_sum, weights_sum};
+    result = common::cpu_impl::Reduce(ctx, it, it + info.labels.Size(), PackedReduceResult{});
   }
   return result;
 }
@@ -377,6 +375,48 @@ struct EvalEWiseBase : public MetricNoCache {
   Policy policy_;
 };
 
+/**
+ * \brief Log loss evaluated directly on the raw margin, with the sigmoid fused into the
+ *        reduction.
+ *
+ *  For the common binary:logistic setup this saves materializing the transformed
+ *  prediction vector during evaluation.  The per-element arithmetic matches the
+ *  two-pass route, so the reported score is unchanged.
+ */
+class EvalLogLossMargin : public EvalEWiseBase<EvalRowLogLoss> {
+ public:
+  bool EvaluateMargin(HostDeviceVector<bst_float> const& margin, std::shared_ptr<DMatrix> p_fmat,
+                      FusedGradientOp const& op, double* out) override {
+    if (op.kind != FusedGradientOp::kLogistic) {
+      return false;
+    }
+    auto const& info = p_fmat->Info();
+    CHECK_EQ(margin.Size(), info.labels.Size())
+        << "label and prediction size not match, "
+        << "hint: use merror or mlogloss for multi-class classification";
+    auto labels = info.labels.View(ctx_->Device());
+    info.weights_.SetDevice(ctx_->Device());
+    common::OptionalWeights weights(ctx_->IsCUDA() ? info.weights_.ConstDeviceSpan()
+                                                   : info.weights_.ConstHostSpan());
+    margin.SetDevice(ctx_->Device());
+    auto predts = ctx_->IsCUDA() ? margin.ConstDeviceSpan() : margin.ConstHostSpan();
+
+    auto result =
+        Reduce(ctx_, info, [=] XGBOOST_DEVICE(size_t i, size_t sample_id, size_t target_id) {
+          float wt = weights[sample_id];
+          float residue = LogLoss(labels(sample_id, target_id), common::Sigmoid(predts[i]));
+          residue *= wt;
+          return std::make_tuple(residue, wt);
+        });
+
+    std::array<double, 2> dat{result.Residue(), result.Weights()};
+    auto rc = collective::GlobalSum(ctx_, info, linalg::MakeVec(dat.data(), dat.size()));
+    collective::SafeColl(rc);
+    *out = EvalRowLogLoss::GetFinal(dat[0], dat[1]);
+    return true;
+  }
+};
+
 XGBOOST_REGISTER_METRIC(RMSE, "rmse")
     .describe("Rooted mean square error.")
     .set_body([](const char*) { return new EvalEWiseBase<EvalRowRMSE>(); });
@@ -395,7 +435,7 @@ XGBOOST_REGISTER_METRIC(MAPE, "mape")
 
 XGBOOST_REGISTER_METRIC(LogLoss, "logloss")
     .describe("Negative loglikelihood for logistic regression.")
-    .set_body([](const char*) { return new EvalEWiseBase<EvalRowLogLoss>(); });
+    .set_body([](const char*) { return new EvalLogLossMargin(); });
 
 XGBOOST_REGISTER_METRIC(PseudoErrorLoss, "mphe")
     .describe("Mean Pseudo-huber error.")
@@ -80,7 +80,8 @@ void EncodeTreeLeafHost(Context const* ctx, RegTree const& tree,
 
 void UpdateTreeLeafHost(Context const* ctx, std::vector<bst_node_t> const& position,
                         std::int32_t group_idx, MetaInfo const& info, float learning_rate,
-                        HostDeviceVector<float> const& predt, float alpha, RegTree* p_tree) {
+                        HostDeviceVector<float> const& predt, float alpha, bool approx_leaf,
+                        RegTree* p_tree) {
   auto& tree = *p_tree;
 
   std::vector<bst_node_t> nidx;
@@ -128,8 +129,18 @@ void UpdateTreeLeafHost(Context const* ctx, std::vector<bst_node_t> const& posit
 
           float q{0};
           if (info.weights_.Empty()) {
-            q = common::Quantile(ctx, alpha, iter, iter + h_row_set.size());
+            if (approx_leaf) {
+              // Single pass with constant memory instead of a full sort of the leaf.
+              common::P2Quantile acc{alpha};
+              for (std::size_t i = 0; i < h_row_set.size(); ++i) {
+                acc.Push(*(iter + i));
+              }
+              q = acc.Value();
+            } else {
+              q = common::Quantile(ctx, alpha, iter, iter + h_row_set.size());
+            }
           } else {
+            // The P^2 update has no weighted counterpart, always take the exact path.
             q = common::WeightedQuantile(ctx, alpha, iter, iter + h_row_set.size(), w_it);
           }
           if (std::isnan(q)) {
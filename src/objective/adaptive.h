@@ -92,19 +92,23 @@ void UpdateTreeLeafDevice(Context const* ctx, common::Span<bst_node_t const> pos
 
 void UpdateTreeLeafHost(Context const* ctx, std::vector<bst_node_t> const& position,
                         std::int32_t group_idx, MetaInfo const& info, float learning_rate,
-                        HostDeviceVector<float> const& predt, float alpha, RegTree* p_tree);
+                        HostDeviceVector<float> const& predt, float alpha, bool approx_leaf,
+                        RegTree* p_tree);
 }  // namespace detail
 
 inline void UpdateTreeLeaf(Context const* ctx, HostDeviceVector<bst_node_t> const& position,
                            std::int32_t group_idx, MetaInfo const& info, float learning_rate,
-                           HostDeviceVector<float> const& predt, float alpha, RegTree* p_tree) {
+                           HostDeviceVector<float> const& predt, float alpha, bool approx_leaf,
+                           RegTree* p_tree) {
   if (ctx->IsCUDA()) {
+    // The device implementation uses a segmented quantile over all leaves at once, the
+    // streaming estimator applies to the CPU only.
     position.SetDevice(ctx->Device());
     detail::UpdateTreeLeafDevice(ctx, position.ConstDeviceSpan(), group_idx, info, learning_rate,
                                  predt, alpha, p_tree);
   } else {
     detail::UpdateTreeLeafHost(ctx, position.ConstHostVector(), group_idx, info, learning_rate,
-                               predt, alpha, p_tree);
+                               predt, alpha, approx_leaf, p_tree);
   }
 }
 }  // namespace xgboost::obj
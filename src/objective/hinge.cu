@@ -57,9 +57,7 @@ class HingeObj : public FitIntercept {
 
     auto labels = info.labels.View(ctx_->Device());
 
-    info.weights_.SetDevice(ctx_->Device());
-    common::OptionalWeights weight{ctx_->IsCUDA() ? info.weights_.ConstDeviceSpan()
-                                                  : info.weights_.ConstHostSpan()};
+    auto weight = common::MakeOptionalWeights(ctx_, info);
 
     linalg::ElementWiseKernel(this->ctx_, labels,
                               [=] XGBOOST_DEVICE(std::size_t i, std::size_t j) mutable {
@@ -284,6 +284,7 @@ class LambdaRankObj : public FitIntercept {
   }
 
   [[nodiscard]] ObjInfo Task() const override { return ObjInfo{ObjInfo::kRanking}; }
+  [[nodiscard]] bool IdentityEvalTransform() const override { return true; }
 
   [[nodiscard]] bst_target_t Targets(MetaInfo const& info) const override {
     CHECK_LE(info.labels.Shape(1), 1) << "multi-output for LTR is not yet supported.";
@@ -360,7 +361,6 @@ class LambdaRankNDCG : public LambdaRankObj<LambdaRankNDCG, ltr::NDCGCache> {
       return;
     }
 
-    bst_group_t n_groups = p_cache_->Groups();
     auto gptr = p_cache_->DataGroupPtr(ctx_);
 
     out_gpair->SetDevice(ctx_->Device());
@@ -376,29 +376,32 @@ class LambdaRankNDCG : public LambdaRankObj<LambdaRankNDCG, ltr::NDCGCache> {
     auto rank_idx = p_cache_->SortedIdx(ctx_, h_predt);
     auto inv_IDCG = GetCache()->InvIDCG(ctx_);
 
-    common::ParallelFor(n_groups, ctx_->Threads(), common::Sched::Guided(), [&](auto g) {
-      std::size_t cnt = gptr[g + 1] - gptr[g];
-      auto w = h_weight[g];
-      auto g_predt = h_predt.subspan(gptr[g], cnt);
-      auto g_gpair =
-          h_gpair.Slice(linalg::Range(static_cast<std::size_t>(gptr[g]), gptr[g] + cnt), 0);
-      auto g_label = h_label.Slice(make_range(g), 0);
-      auto g_rank = rank_idx.subspan(gptr[g], cnt);
-
-      auto args =
-          std::make_tuple(this, iter, g_predt, g_label, w, g_rank, g_gpair, inv_IDCG, dct, g);
-
-      if (param_.lambdarank_unbiased) {
-        if (param_.ndcg_exp_gain) {
-          std::apply(&LambdaRankNDCG::CalcLambdaForGroupNDCG<true, true>, args);
-        } else {
-          std::apply(&LambdaRankNDCG::CalcLambdaForGroupNDCG<true, false>, args);
-        }
-      } else {
-        if (param_.ndcg_exp_gain) {
-          std::apply(&LambdaRankNDCG::CalcLambdaForGroupNDCG<false, true>, args);
+    auto blocks = cpu_impl::MakeGroupBlocks(gptr, ctx_->Threads());
+    common::ParallelFor(blocks.size() - 1, ctx_->Threads(), common::Sched::Guided(), [&](auto blk) {
+      for (bst_group_t g = blocks[blk]; g < blocks[blk + 1]; ++g) {
+        std::size_t cnt = gptr[g + 1] - gptr[g];
+        auto w = h_weight[g];
+        auto g_predt = h_predt.subspan(gptr[g], cnt);
+        auto g_gpair =
+            h_gpair.Slice(linalg::Range(static_cast<std::size_t>(gptr[g]), gptr[g] + cnt), 0);
+        auto g_label = h_label.Slice(make_range(g), 0);
+        auto g_rank = rank_idx.subspan(gptr[g], cnt);
+
+        auto args =
+            std::make_tuple(this, iter, g_predt, g_label, w, g_rank, g_gpair, inv_IDCG, dct, g);
+
+        if (param_.lambdarank_unbiased) {
+          if (param_.ndcg_exp_gain) {
+            std::apply(&LambdaRankNDCG::CalcLambdaForGroupNDCG<true, true>, args);
+          } else {
+            std::apply(&LambdaRankNDCG::CalcLambdaForGroupNDCG<true, false>, args);
+          }
         } else {
-          std::apply(&LambdaRankNDCG::CalcLambdaForGroupNDCG<false, false>, args);
+          if (param_.ndcg_exp_gain) {
+            std::apply(&LambdaRankNDCG::CalcLambdaForGroupNDCG<false, true>, args);
+          } else {
+            std::apply(&LambdaRankNDCG::CalcLambdaForGroupNDCG<false, false>, args);
+          }
         }
       }
     });
@@ -468,6 +471,30 @@ void MAPStat(Context const* ctx, linalg::VectorView<float const> label,
     }
   });
 }
+
+std::vector<bst_group_t> MakeGroupBlocks(common::Span<bst_group_t const> gptr,
+                                         std::int32_t n_threads) {
+  auto n_groups = static_cast<bst_group_t>(gptr.size() - 1);
+  std::size_t n_samples = gptr[n_groups];
+  // Aim for a few blocks per thread so that guided scheduling can still balance the
+  // load, the amount of work per document varies with the number of pairs.
+  std::size_t constexpr kMinBlockSize = 256;
+  auto grain = std::max(kMinBlockSize, n_samples / (static_cast<std::size_t>(n_threads) * 8));
+
+  std::vector<bst_group_t> blocks{0};
+  std::size_t size{0};
+  for (bst_group_t g = 0; g < n_groups; ++g) {
+    size += gptr[g + 1] - gptr[g];
+    if (size >= grain) {
+      blocks.push_back(g + 1);
+      size = 0;
+    }
+  }
+  if (blocks.back() != n_groups) {
+    blocks.push_back(n_groups);
+  }
+  return blocks;
+}
 }  // namespace cpu_impl
 
 class LambdaRankMAP : public LambdaRankObj<LambdaRankMAP, ltr::MAPCache> {
@@ -482,7 +509,6 @@ class LambdaRankMAP : public LambdaRankObj<LambdaRankMAP, ltr::MAPCache> {
     }
 
     auto gptr = p_cache_->DataGroupPtr(ctx_).data();
-    bst_group_t n_groups = p_cache_->Groups();
 
     CHECK_EQ(info.labels.Shape(1), 1) << "multi-target for learning to rank is not yet supported.";
     out_gpair->SetDevice(ctx_->Device());
@@ -515,20 +541,23 @@ class LambdaRankMAP : public LambdaRankObj<LambdaRankMAP, ltr::MAPCache> {
     };
     using D = decltype(delta_map);
 
-    common::ParallelFor(n_groups, ctx_->Threads(), [&](auto g) {
-      auto cnt = gptr[g + 1] - gptr[g];
-      auto w = h_weight[g];
-      auto g_predt = h_predt.subspan(gptr[g], cnt);
-      auto g_gpair = h_gpair.Slice(linalg::Range(gptr[g], gptr[g] + cnt), 0);
-      auto g_label = h_label.Slice(make_range(g));
-      auto g_rank = rank_idx.subspan(gptr[g], cnt);
-
-      auto args = std::make_tuple(this, iter, g_predt, g_label, w, g_rank, g, delta_map, g_gpair);
-
-      if (param_.lambdarank_unbiased) {
-        std::apply(&LambdaRankMAP::CalcLambdaForGroup<true, D>, args);
-      } else {
-        std::apply(&LambdaRankMAP::CalcLambdaForGroup<false, D>, args);
+    auto blocks = cpu_impl::MakeGroupBlocks(p_cache_->DataGroupPtr(ctx_), ctx_->Threads());
+    common::ParallelFor(blocks.size() - 1, ctx_->Threads(), common::Sched::Guided(), [&](auto blk) {
+      for (bst_group_t g = blocks[blk]; g < blocks[blk + 1]; ++g) {
+        auto cnt = gptr[g + 1] - gptr[g];
+        auto w = h_weight[g];
+        auto g_predt = h_predt.subspan(gptr[g], cnt);
+        auto g_gpair = h_gpair.Slice(linalg::Range(gptr[g], gptr[g] + cnt), 0);
+        auto g_label = h_label.Slice(make_range(g));
+        auto g_rank = rank_idx.subspan(gptr[g], cnt);
+
+        auto args = std::make_tuple(this, iter, g_predt, g_label, w, g_rank, g, delta_map, g_gpair);
+
+        if (param_.lambdarank_unbiased) {
+          std::apply(&LambdaRankMAP::CalcLambdaForGroup<true, D>, args);
+        } else {
+          std::apply(&LambdaRankMAP::CalcLambdaForGroup<false, D>, args);
+        }
       }
     });
   }
@@ -571,7 +600,6 @@ class LambdaRankPairwise : public LambdaRankObj<LambdaRankPairwise, ltr::Ranking
     }
 
     auto gptr = p_cache_->DataGroupPtr(ctx_);
-    bst_group_t n_groups = p_cache_->Groups();
 
     out_gpair->SetDevice(ctx_->Device());
     out_gpair->Reshape(info.num_row_, this->Targets(info));
@@ -587,19 +615,22 @@ class LambdaRankPairwise : public LambdaRankObj<LambdaRankPairwise, ltr::Ranking
     auto delta = [](auto...) { return 1.0; };
     using D = decltype(delta);
 
-    common::ParallelFor(n_groups, ctx_->Threads(), [&](auto g) {
-      auto cnt = gptr[g + 1] - gptr[g];
-      auto w = h_weight[g];
-      auto g_predt = h_predt.subspan(gptr[g], cnt);
-      auto g_gpair = h_gpair.Slice(linalg::Range(gptr[g], gptr[g] + cnt), 0);
-      auto g_label = h_label.Slice(make_range(g));
-      auto g_rank = rank_idx.subspan(gptr[g], cnt);
-
-      auto args = std::make_tuple(this, iter, g_predt, g_label, w, g_rank, g, delta, g_gpair);
-      if (param_.lambdarank_unbiased) {
-        std::apply(&LambdaRankPairwise::CalcLambdaForGroup<true, D>, args);
-      } else {
-        std::apply(&LambdaRankPairwise::CalcLambdaForGroup<false, D>, args);
+    auto blocks = cpu_impl::MakeGroupBlocks(gptr, ctx_->Threads());
+    common::ParallelFor(blocks.size() - 1, ctx_->Threads(), common::Sched::Guided(), [&](auto blk) {
+      for (bst_group_t g = blocks[blk]; g < blocks[blk + 1]; ++g) {
+        auto cnt = gptr[g + 1] - gptr[g];
+        auto w = h_weight[g];
+        auto g_predt = h_predt.subspan(gptr[g], cnt);
+        auto g_gpair = h_gpair.Slice(linalg::Range(gptr[g], gptr[g] + cnt), 0);
+        auto g_label = h_label.Slice(make_range(g));
+        auto g_rank = rank_idx.subspan(gptr[g], cnt);
+
+        auto args = std::make_tuple(this, iter, g_predt, g_label, w, g_rank, g, delta, g_gpair);
+        if (param_.lambdarank_unbiased) {
+          std::apply(&LambdaRankPairwise::CalcLambdaForGroup<true, D>, args);
+        } else {
+          std::apply(&LambdaRankPairwise::CalcLambdaForGroup<false, D>, args);
+        }
       }
     });
   }
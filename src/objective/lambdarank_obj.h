@@ -17,12 +17,12 @@
 #include <cassert>                         // for assert
 #include <cmath>                           // for log, abs
 #include <cstddef>                         // for size_t
-#include <functional>                      // for greater
+#include <cstdint>                         // for int32_t
 #include <memory>                          // for shared_ptr
+#include <numeric>                         // for iota
 #include <random>                          // for minstd_rand, uniform_int_distribution
 #include <vector>                          // for vector
 
-#include "../common/algorithm.h"           // for ArgSort
 #include "../common/math.h"                // for Sigmoid
 #include "../common/ranking_utils.h"       // for CalcDCGGain
 #include "../common/transform_iterator.h"  // for MakeIndexTransformIter
@@ -196,6 +196,21 @@ namespace cpu_impl {
  */
 void MAPStat(Context const* ctx, linalg::VectorView<float const> label,
              common::Span<std::size_t const> rank_idx, std::shared_ptr<ltr::MAPCache> p_cache);
+
+/**
+ * \brief Partition query groups into blocks of roughly equal numbers of documents.
+ *
+ *   Tiny query groups are common in LTR datasets.  Handling one group per task makes
+ *   the parallel gradient loop scheduling-bound, so consecutive small groups are
+ *   bucketed into one block instead.
+ *
+ * \param gptr      Offsets to the query groups, as in MetaInfo.
+ * \param n_threads Number of threads used by the caller.
+ *
+ * \return Offsets into the list of groups, one past the last group for the last block.
+ */
+std::vector<bst_group_t> MakeGroupBlocks(common::Span<bst_group_t const> gptr,
+                                         std::int32_t n_threads);
 }  // namespace cpu_impl
 
 /**
@@ -230,11 +245,15 @@ void MakePairs(Context const* ctx, std::int32_t iter,
     CHECK_EQ(g_rank.size(), g_label.Size());
     std::minstd_rand rnd(iter);
     rnd.discard(g);  // fixme(jiamingy): honor the global seed
-    // sort label according to the rank list
+    // sort label according to the rank list.  The scratch comes from the cache as this
+    // runs for every query group inside a parallel loop.
     auto it = common::MakeIndexTransformIter(
         [&g_rank, &g_label](std::size_t idx) { return g_label(g_rank[idx]); });
-    std::vector<std::size_t> y_sorted_idx =
-        common::ArgSort<std::size_t>(ctx, it, it + cnt, std::greater<>{});
+    std::vector<std::size_t>& y_sorted_idx = cache->MakePairsBuffer(ctx);
+    y_sorted_idx.resize(cnt);
+    std::iota(y_sorted_idx.begin(), y_sorted_idx.end(), 0);
+    std::stable_sort(y_sorted_idx.begin(), y_sorted_idx.end(),
+                     [&](std::size_t l, std::size_t r) { return it[l] > it[r]; });
     // permutation iterator to get the original label
     auto rev_it = common::MakeIndexTransformIter(
         [&](std::size_t idx) { return g_label(g_rank[y_sorted_idx[idx]]); });
@@ -73,6 +73,7 @@ class SoftmaxMultiClassObj : public ObjFunction {
       CHECK_EQ(info.weights_.Size(), ndata)
           << "Number of weights should be equal to number of data points.";
     }
+    const bool fast_exp = param_.fast_exp;
 
     common::Transform<>::Init(
         [=] XGBOOST_DEVICE(size_t idx,
@@ -87,7 +88,9 @@ class SoftmaxMultiClassObj : public ObjFunction {
           bst_float wmax = std::numeric_limits<bst_float>::min();
           for (auto const i : point) { wmax = fmaxf(i, wmax); }
           double wsum = 0.0f;
-          for (auto const i : point) { wsum += expf(i - wmax); }
+          for (auto const i : point) {
+            wsum += fast_exp ? common::ApproxExp(i - wmax) : expf(i - wmax);
+          }
           auto label = labels[idx];
           if (label < 0 || label >= nclass) {
             _label_correct[0] = 0;
@@ -96,7 +99,8 @@ class SoftmaxMultiClassObj : public ObjFunction {
           bst_float wt = is_null_weight ? 1.0f : weights[idx];
           for (int k = 0; k < nclass; ++k) {
             // Computation duplicated to avoid creating a cache.
-            bst_float p = expf(point[k] - wmax) / static_cast<float>(wsum);
+            bst_float e = fast_exp ? common::ApproxExp(point[k] - wmax) : expf(point[k] - wmax);
+            bst_float p = e / static_cast<float>(wsum);
             const float eps = 1e-16f;
             const bst_float h = fmax(2.0f * p * (1.0f - p) * wt, eps);
             p = label == k ? p - 1.0f : p;
@@ -127,12 +131,17 @@ class SoftmaxMultiClassObj : public ObjFunction {
     const auto ndata = static_cast<int64_t>(io_preds->Size() / nclass);
 
     auto device = io_preds->Device();
+    const bool fast_exp = param_.fast_exp;
     if (prob) {
       common::Transform<>::Init(
           [=] XGBOOST_DEVICE(size_t _idx, common::Span<bst_float> _preds) {
             common::Span<bst_float> point =
                 _preds.subspan(_idx * nclass, nclass);
-            common::Softmax(point.begin(), point.end());
+            if (fast_exp) {
+              common::ApproxSoftmax(point.begin(), point.end());
+            } else {
+              common::Softmax(point.begin(), point.end());
+            }
           },
           common::Range{0, ndata}, this->ctx_->Threads(), device)
           .Eval(io_preds);
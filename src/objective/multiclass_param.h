@@ -13,10 +13,14 @@ namespace obj {
 
 struct SoftmaxMultiClassParam : public XGBoostParameter<SoftmaxMultiClassParam> {
   int num_class;
+  bool fast_exp;
   // declare parameters
   DMLC_DECLARE_PARAMETER(SoftmaxMultiClassParam) {
     DMLC_DECLARE_FIELD(num_class).set_lower_bound(1)
         .describe("Number of output class in the multi-class classification.");
+    DMLC_DECLARE_FIELD(fast_exp).set_default(false).describe(
+        "Use a vectorizable polynomial approximation of exp with bounded relative error "
+        "for the softmax transform.");
   }
 };
 
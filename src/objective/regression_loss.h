@@ -16,7 +16,9 @@
 namespace xgboost::obj {
 // linear regression
 struct LinearSquareLoss {
+  static constexpr bool kIdentityTransform = true;
   XGBOOST_DEVICE static bst_float PredTransform(bst_float x) { return x; }
+  XGBOOST_DEVICE static bst_float ApproxPredTransform(bst_float x) { return x; }
   XGBOOST_DEVICE static bool CheckLabel(bst_float) { return true; }
   XGBOOST_DEVICE static bst_float FirstOrderGradient(bst_float predt, bst_float label) {
     return predt - label;
@@ -31,7 +33,9 @@ struct LinearSquareLoss {
 };
 
 struct SquaredLogError {
+  static constexpr bool kIdentityTransform = true;
   XGBOOST_DEVICE static bst_float PredTransform(bst_float x) { return x; }
+  XGBOOST_DEVICE static bst_float ApproxPredTransform(bst_float x) { return x; }
   XGBOOST_DEVICE static bool CheckLabel(bst_float label) { return label > -1; }
   XGBOOST_DEVICE static bst_float FirstOrderGradient(bst_float predt, bst_float label) {
     predt = fmaxf(predt, -1 + 1e-6);  // ensure correct value for log1p
@@ -56,7 +60,11 @@ struct SquaredLogError {
 
 // logistic loss for probability regression task
 struct LogisticRegression {
+  static constexpr bool kIdentityTransform = false;
   XGBOOST_DEVICE static bst_float PredTransform(bst_float x) { return common::Sigmoid(x); }
+  XGBOOST_DEVICE static bst_float ApproxPredTransform(bst_float x) {
+    return common::ApproxSigmoid(x);
+  }
   XGBOOST_DEVICE static bool CheckLabel(bst_float x) { return x >= 0.0f && x <= 1.0f; }
   XGBOOST_DEVICE static bst_float FirstOrderGradient(bst_float predt, bst_float label) {
     return predt - label;
@@ -87,7 +95,9 @@ struct LogisticClassification : public LogisticRegression {
 
 // logistic loss, but predict un-transformed margin
 struct LogisticRaw : public LogisticRegression {
+  static constexpr bool kIdentityTransform = true;
   XGBOOST_DEVICE static bst_float PredTransform(bst_float x) { return x; }
+  XGBOOST_DEVICE static bst_float ApproxPredTransform(bst_float x) { return x; }
   XGBOOST_DEVICE static bst_float FirstOrderGradient(bst_float predt, bst_float label) {
     predt = common::Sigmoid(predt);
     return predt - label;
@@ -108,7 +118,9 @@ struct LogisticRaw : public LogisticRegression {
 // gamma deviance loss.
 class GammaDeviance {
  public:
+  static constexpr bool kIdentityTransform = false;
   XGBOOST_DEVICE static float PredTransform(float x) { return std::exp(x); }
+  XGBOOST_DEVICE static float ApproxPredTransform(float x) { return common::ApproxExp(x); }
   XGBOOST_DEVICE static float ProbToMargin(float x) { return std::log(x); }
   XGBOOST_DEVICE static float FirstOrderGradient(float p, float y) {
     return 1.0f - y / p;
@@ -10,6 +10,7 @@
 #include <cmath>
 #include <cstdint>  // std::int32_t
 #include <memory>
+#include <type_traits>  // std::is_same_v
 #include <vector>
 
 #include "../common/common.h"
@@ -64,6 +65,9 @@ class RegLossObj : public FitIntercept {
 
  public:
   void ValidateLabel(MetaInfo const& info) {
+    if (info.LabelsValidatedBy(Loss::Name())) {
+      return;
+    }
     auto label = info.labels.View(ctx_->Device());
     auto valid = ctx_->DispatchDevice(
         [&] {
@@ -87,9 +91,10 @@ class RegLossObj : public FitIntercept {
     if (!valid) {
       LOG(FATAL) << Loss::LabelErrorMsg();
     }
+    info.SetLabelsValidatedBy(Loss::Name());
   }
-  // 0 - scale_pos_weight, 1 - is_null_weight
-  RegLossObj(): additional_input_(2) {}
+  // 0 - scale_pos_weight, 1 - is_null_weight, 2 - fast_exp, 3 - uniform_weight
+  RegLossObj(): additional_input_(4) {}
 
   void Configure(const std::vector<std::pair<std::string, std::string> >& args) override {
     param_.UpdateAllowUnknown(args);
@@ -102,21 +107,45 @@ class RegLossObj : public FitIntercept {
     return std::max(static_cast<std::size_t>(1), info.labels.Shape(1));
   }
 
+  [[nodiscard]] FusedGradientOp FusedGradient() const override {
+    FusedGradientOp op;
+    if (std::is_same_v<Loss, LinearSquareLoss>) {
+      op.kind = FusedGradientOp::kSquaredError;
+    } else if (std::is_same_v<Loss, LogisticRegression> ||
+               std::is_same_v<Loss, LogisticClassification>) {
+      op.kind = FusedGradientOp::kLogistic;
+    } else {
+      return op;
+    }
+    op.scale_pos_weight = param_.scale_pos_weight;
+    op.fast_exp = param_.fast_exp;
+    return op;
+  }
+
   void GetGradient(const HostDeviceVector<bst_float>& preds, const MetaInfo& info,
-                   std::int32_t iter, linalg::Matrix<GradientPair>* out_gpair) override {
+                   std::int32_t /*iter*/, linalg::Matrix<GradientPair>* out_gpair) override {
     CheckRegInputs(info, preds);
-    if (iter == 0) {
-      ValidateLabel(info);
-    }
+    // Cheap once the result is cached in the info, and catches labels replaced between
+    // boosting rounds, which the old first-iteration check missed.
+    ValidateLabel(info);
 
     size_t const ndata = preds.Size();
     out_gpair->SetDevice(ctx_->Device());
     auto device = ctx_->Device();
 
     bool is_null_weight = info.weights_.Size() == 0;
+    // Uniform weights collapse into a single multiplier, which removes the per-element
+    // weight gather from the gradient kernel.
+    float uniform_weight{1.0f};
+    if (!is_null_weight && info.IsUniformWeights()) {
+      is_null_weight = true;
+      uniform_weight = info.weights_.ConstHostVector().front();
+    }
     auto scale_pos_weight = param_.scale_pos_weight;
     additional_input_.HostVector().begin()[0] = scale_pos_weight;
     additional_input_.HostVector().begin()[1] = is_null_weight;
+    additional_input_.HostVector().begin()[2] = param_.fast_exp;
+    additional_input_.HostVector().begin()[3] = uniform_weight;
 
     const size_t nthreads = ctx_->Threads();
     bool on_device = device.IsCUDA();
@@ -142,10 +171,13 @@ class RegLossObj : public FitIntercept {
           const size_t end = std::min(ndata, begin + block_size);
           const float _scale_pos_weight = _additional_input[0];
           const bool _is_null_weight = _additional_input[1];
+          const bool _fast_exp = _additional_input[2];
+          const float _uniform_weight = _additional_input[3];
 
           for (size_t idx = begin; idx < end; ++idx) {
-            bst_float p = Loss::PredTransform(preds_ptr[idx]);
-            bst_float w = _is_null_weight ? 1.0f : weights_ptr[idx / n_targets];
+            bst_float p = _fast_exp ? Loss::ApproxPredTransform(preds_ptr[idx])
+                                    : Loss::PredTransform(preds_ptr[idx]);
+            bst_float w = _is_null_weight ? _uniform_weight : weights_ptr[idx / n_targets];
             bst_float label = labels_ptr[idx];
             if (label == 1.0f) {
               w *= _scale_pos_weight;
@@ -174,6 +206,8 @@ class RegLossObj : public FitIntercept {
         .Eval(io_preds);
   }
 
+  [[nodiscard]] bool IdentityEvalTransform() const override { return Loss::kIdentityTransform; }
+
   [[nodiscard]] float ProbToMargin(float base_score) const override {
     return Loss::ProbToMargin(base_score);
   }
@@ -234,6 +268,7 @@ class PseudoHuberRegression : public FitIntercept {
  public:
   void Configure(Args const& args) override { param_.UpdateAllowUnknown(args); }
   [[nodiscard]] ObjInfo Task() const override { return ObjInfo::kRegression; }
+  [[nodiscard]] bool IdentityEvalTransform() const override { return true; }
   [[nodiscard]] bst_target_t Targets(MetaInfo const& info) const override {
     return std::max(static_cast<std::size_t>(1), info.labels.Shape(1));
   }
@@ -252,12 +287,28 @@ class PseudoHuberRegression : public FitIntercept {
     preds.SetDevice(ctx_->Device());
     auto predt = linalg::MakeTensorView(ctx_, &preds, info.num_row_, this->Targets(info));
 
-    info.weights_.SetDevice(ctx_->Device());
-    common::OptionalWeights weight{ctx_->IsCUDA() ? info.weights_.ConstDeviceSpan()
-                                                  : info.weights_.ConstHostSpan()};
+    auto weight = common::MakeOptionalWeights(ctx_, info);
 
-    linalg::ElementWiseKernel(
-        ctx_, labels, [=] XGBOOST_DEVICE(std::size_t i, std::size_t j) mutable {
+    if (ctx_->IsCUDA()) {
+      linalg::ElementWiseKernel(
+          ctx_, labels, [=] XGBOOST_DEVICE(std::size_t i, std::size_t j) mutable {
+            float z = predt(i, j) - labels(i, j);
+            float scale_sqrt = std::sqrt(1 + common::Sqr(z) / common::Sqr(slope));
+            float grad = z / scale_sqrt;
+
+            auto scale = common::Sqr(slope) + common::Sqr(z);
+            float hess = common::Sqr(slope) / (scale * scale_sqrt);
+
+            auto w = weight[i];
+            gpair(i) = {grad * w, hess * w};
+          });
+    } else {
+      // Fused row-major pass: the weight is loaded once per row and the inner loop
+      // streams the contiguous prediction and label rows.
+      auto n_targets = this->Targets(info);
+      common::ParallelFor(info.num_row_, ctx_->Threads(), [&](std::size_t i) {
+        auto w = weight[i];
+        for (std::size_t j = 0; j < n_targets; ++j) {
           float z = predt(i, j) - labels(i, j);
           float scale_sqrt = std::sqrt(1 + common::Sqr(z) / common::Sqr(slope));
           float grad = z / scale_sqrt;
@@ -265,9 +316,10 @@ class PseudoHuberRegression : public FitIntercept {
           auto scale = common::Sqr(slope) + common::Sqr(z);
           float hess = common::Sqr(slope) / (scale * scale_sqrt);
 
-          auto w = weight[i];
-          gpair(i) = {grad * w, hess * w};
-        });
+          gpair(i, j) = {grad * w, hess * w};
+        }
+      });
+    }
   }
 
   [[nodiscard]] const char* DefaultEvalMetric() const override { return "mphe"; }
@@ -616,6 +668,7 @@ class MeanAbsoluteError : public ObjFunction {
  public:
   void Configure(Args const&) override {}
   [[nodiscard]] ObjInfo Task() const override { return {ObjInfo::kRegression, true, true}; }
+  [[nodiscard]] bool IdentityEvalTransform() const override { return true; }
   [[nodiscard]] bst_target_t Targets(MetaInfo const& info) const override {
     return std::max(static_cast<std::size_t>(1), info.labels.Shape(1));
   }
@@ -631,9 +684,7 @@ class MeanAbsoluteError : public ObjFunction {
 
     preds.SetDevice(ctx_->Device());
     auto predt = linalg::MakeTensorView(ctx_, &preds, info.num_row_, this->Targets(info));
-    info.weights_.SetDevice(ctx_->Device());
-    common::OptionalWeights weight{ctx_->IsCUDA() ? info.weights_.ConstDeviceSpan()
-                                                  : info.weights_.ConstHostSpan()};
+    auto weight = common::MakeOptionalWeights(ctx_, info);
 
     linalg::ElementWiseKernel(
         ctx_, labels, [=] XGBOOST_DEVICE(std::size_t i, std::size_t j) mutable {
@@ -693,7 +744,7 @@ class MeanAbsoluteError : public ObjFunction {
                       float learning_rate, HostDeviceVector<float> const& prediction,
                       std::int32_t group_idx, RegTree* p_tree) const override {
     ::xgboost::obj::UpdateTreeLeaf(ctx_, position, group_idx, info, learning_rate, prediction, 0.5,
-                                   p_tree);
+                                   /*approx_leaf=*/false, p_tree);
   }
 
   [[nodiscard]] const char* DefaultEvalMetric() const override { return "mae"; }
@@ -13,10 +13,14 @@ namespace obj {
 
 struct RegLossParam : public XGBoostParameter<RegLossParam> {
   float scale_pos_weight;
+  bool fast_exp;
   // declare parameters
   DMLC_DECLARE_PARAMETER(RegLossParam) {
     DMLC_DECLARE_FIELD(scale_pos_weight).set_default(1.0f).set_lower_bound(0.0f)
       .describe("Scale the weight of positive examples by this factor");
+    DMLC_DECLARE_FIELD(fast_exp).set_default(false).describe(
+        "Use a vectorizable polynomial approximation of exp with bounded relative error "
+        "for the prediction transform in the gradient computation.");
   }
 };
 
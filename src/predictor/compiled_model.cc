@@ -0,0 +1,106 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include "compiled_model.h"
+
+#include <deque>  // for deque
+
+#include "../gbm/gbtree_model.h"  // for GBTreeModel
+#include "xgboost/logging.h"      // for CHECK
+#include "xgboost/tree_model.h"   // for RegTree
+
+namespace xgboost::predictor {
+bool CompiledModel::CanCompile(gbm::GBTreeModel const& model, bst_tree_t tree_begin,
+                               bst_tree_t tree_end) {
+  for (bst_tree_t tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+    auto const& tree = *model.trees.at(tree_id);
+    if (tree.IsMultiTarget() || tree.HasCategoricalSplit()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+namespace {
+// Append a single tree in breadth-first order, placing the two children of each split
+// in adjacent slots.  Returns the number of nodes written.
+std::size_t FlattenTree(RegTree const& tree, std::vector<CompiledModel::Node>* p_nodes) {
+  auto& nodes = *p_nodes;
+  auto const begin = nodes.size();
+  // Original node index of each compiled slot, in the order slots were assigned.
+  std::deque<bst_node_t> queue{RegTree::kRoot};
+  nodes.emplace_back();
+  std::size_t out{begin};
+
+  while (!queue.empty()) {
+    bst_node_t const nidx = queue.front();
+    queue.pop_front();
+    auto const& node = tree[nidx];
+    if (node.IsLeaf()) {
+      nodes[out++] = Node{0, node.LeafValue(), 0};
+      continue;
+    }
+    // Reserve adjacent slots for the children; right is implicitly left + 1.
+    auto const left = static_cast<bst_node_t>(nodes.size() - begin);
+    nodes.emplace_back();
+    nodes.emplace_back();
+    queue.push_back(node.LeftChild());
+    queue.push_back(node.RightChild());
+    auto sindex = static_cast<std::uint32_t>(node.SplitIndex());
+    if (node.DefaultLeft()) {
+      sindex |= 1U << 31;
+    }
+    nodes[out++] = Node{sindex, node.SplitCond(), left};
+  }
+  return nodes.size() - begin;
+}
+
+// Depth of a flattened tree when it is a perfect binary tree, -1 otherwise.  In the
+// breadth-first layout a perfect tree of depth d stores its 2^d - 1 splits before its
+// 2^d leaves, so a linear scan suffices.
+bst_node_t PerfectDepth(common::Span<CompiledModel::Node const> nodes) {
+  std::size_t const n = nodes.size();
+  bst_node_t depth{0};
+  while ((std::size_t{1} << (depth + 1)) - 1 < n) {
+    ++depth;
+  }
+  if ((std::size_t{1} << (depth + 1)) - 1 != n) {
+    return -1;
+  }
+  std::size_t const first_leaf = (std::size_t{1} << depth) - 1;
+  for (std::size_t i = 0; i < n; ++i) {
+    if (nodes[i].IsLeaf() != (i >= first_leaf)) {
+      return -1;
+    }
+  }
+  return depth;
+}
+}  // namespace
+
+CompiledModel::CompiledModel(gbm::GBTreeModel const& model, bst_tree_t tree_begin,
+                             bst_tree_t tree_end) {
+  CHECK(CanCompile(model, tree_begin, tree_end));
+  std::size_t n_nodes{0};
+  for (bst_tree_t tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+    n_nodes += model.trees.at(tree_id)->GetNodes().size();
+  }
+  nodes_.reserve(n_nodes);
+  tree_ptr_.reserve(tree_end - tree_begin + 1);
+  tree_ptr_.push_back(0);
+  tree_info_.reserve(tree_end - tree_begin);
+
+  for (bst_tree_t tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+    auto const n = FlattenTree(*model.trees.at(tree_id), &nodes_);
+    tree_ptr_.push_back(tree_ptr_.back() + n);
+    tree_info_.push_back(model.tree_info.at(tree_id));
+    single_group_ &= tree_info_.back() == 0;
+
+    auto const depth = PerfectDepth(this->Nodes(tree_id - tree_begin));
+    if (tree_id == tree_begin) {
+      uniform_depth_ = depth;
+    } else if (depth != uniform_depth_) {
+      uniform_depth_ = -1;
+    }
+  }
+}
+}  // namespace xgboost::predictor
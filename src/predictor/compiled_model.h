@@ -0,0 +1,86 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ * \file compiled_model.h
+ * \brief Flattened breadth-first tree layout for batch inference on the CPU.
+ */
+#ifndef XGBOOST_PREDICTOR_COMPILED_MODEL_H_
+#define XGBOOST_PREDICTOR_COMPILED_MODEL_H_
+
+#include <cstdint>  // for uint32_t
+#include <vector>   // for vector
+
+#include "xgboost/base.h"  // for bst_feature_t, bst_node_t, bst_tree_t
+#include "xgboost/span.h"  // for Span
+
+namespace xgboost::gbm {
+struct GBTreeModel;
+}  // namespace xgboost::gbm
+
+namespace xgboost::predictor {
+/**
+ * \brief A read-only copy of the scalar trees in a model, re-ordered for traversal.
+ *
+ * `RegTree` keeps 32-byte nodes in allocation order, which scatters the hot top levels
+ * of a tree across memory and leaves the traversal loop at the mercy of the allocator.
+ * This class flattens each tree into breadth-first order with a 12-byte node where the
+ * two children of a split are adjacent, so a level fits in a handful of cache lines and
+ * the next node index is plain arithmetic on the comparison result instead of a
+ * data-dependent branch.
+ *
+ * Only models where every tree in the requested range is single-target and free of
+ * categorical splits can be compiled; callers must consult \ref CanCompile and fall
+ * back to the `RegTree` walk otherwise.  The conversion is a one-time linear pass over
+ * the model, intended to be amortized over large batches.
+ */
+class CompiledModel {
+ public:
+  struct Node {
+    /** Split feature index, with the default-left flag packed into the high bit. */
+    std::uint32_t sindex;
+    /** Split condition, or the leaf value when this is a leaf. */
+    float value;
+    /** Index of the left child inside the tree, 0 when this is a leaf. */
+    bst_node_t left;
+
+    [[nodiscard]] bst_feature_t SplitIndex() const { return sindex & ((1U << 31) - 1U); }
+    [[nodiscard]] bool DefaultLeft() const { return (sindex >> 31) != 0; }
+    [[nodiscard]] bool IsLeaf() const { return left == 0; }
+  };
+  static_assert(sizeof(Node) == 12);
+
+  /** \brief Whether every tree in `[tree_begin, tree_end)` fits the compiled layout. */
+  static bool CanCompile(gbm::GBTreeModel const& model, bst_tree_t tree_begin,
+                         bst_tree_t tree_end);
+
+  CompiledModel(gbm::GBTreeModel const& model, bst_tree_t tree_begin, bst_tree_t tree_end);
+
+  [[nodiscard]] bst_tree_t NumTrees() const {
+    return static_cast<bst_tree_t>(tree_ptr_.size() - 1);
+  }
+  /** \brief Nodes of the t^th compiled tree, breadth-first with the root at 0. */
+  [[nodiscard]] common::Span<Node const> Nodes(bst_tree_t t) const {
+    return common::Span<Node const>{nodes_}.subspan(tree_ptr_[t], tree_ptr_[t + 1] - tree_ptr_[t]);
+  }
+  /** \brief Output group of the t^th compiled tree. */
+  [[nodiscard]] std::int32_t Group(bst_tree_t t) const { return tree_info_[t]; }
+  /** \brief Whether every compiled tree contributes to output group 0. */
+  [[nodiscard]] bool SingleGroup() const { return single_group_; }
+  /**
+   * \brief Depth shared by every compiled tree when all of them are perfect binary
+   *        trees (every leaf on the last level), -1 otherwise.
+   *
+   * Depth-wise growth with `max_depth` set and no pruning produces such trees, and a
+   * known uniform depth lets the traversal fix its trip count at compile time.
+   */
+  [[nodiscard]] bst_node_t UniformDepth() const { return uniform_depth_; }
+
+ private:
+  std::vector<Node> nodes_;
+  // CSR-style offsets of each tree into nodes_.
+  std::vector<std::size_t> tree_ptr_;
+  std::vector<std::int32_t> tree_info_;
+  bool single_group_{true};
+  bst_node_t uniform_depth_{-1};
+};
+}  // namespace xgboost::predictor
+#endif  // XGBOOST_PREDICTOR_COMPILED_MODEL_H_
@@ -1,12 +1,13 @@
 /**
  * Copyright 2017-2024, XGBoost Contributors
  */
-#include <algorithm>  // for max, fill, min
+#include <algorithm>  // for max, fill, fill_n, min
 #include <any>        // for any, any_cast
 #include <cassert>    // for assert
 #include <cstddef>    // for size_t
 #include <cstdint>    // for uint32_t, int32_t, uint64_t
 #include <memory>     // for unique_ptr, shared_ptr
+#include <mutex>      // for mutex, lock_guard
 #include <ostream>    // for char_traits, operator<<, basic_ostream
 #include <typeinfo>   // for type_info
 #include <vector>     // for vector
@@ -18,11 +19,13 @@
 #include "../common/common.h"                 // for DivRoundUp
 #include "../common/error_msg.h"              // for InplacePredictProxy
 #include "../common/math.h"                   // for CheckNAN
+#include "../common/prefetch.h"               // for PrefetchReadT0
 #include "../common/threading_utils.h"        // for ParallelFor
 #include "../data/adapter.h"                  // for ArrayAdapter, CSRAdapter, CSRArrayAdapter
 #include "../data/gradient_index.h"           // for GHistIndexMatrix
 #include "../data/proxy_dmatrix.h"            // for DMatrixProxy
 #include "../gbm/gbtree_model.h"              // for GBTreeModel, GBTreeModelParam
+#include "compiled_model.h"                   // for CompiledModel
 #include "cpu_treeshap.h"                     // for CalculateContributions
 #include "dmlc/registry.h"                    // for DMLC_REGISTRY_FILE_TAG
 #include "predict_fn.h"                       // for GetNextNode, GetNextNodeMulti
@@ -57,7 +60,7 @@ bst_node_t GetLeafIndex(RegTree const &tree, const RegTree::FVec &feat,
 }
 
 bst_float PredValue(const SparsePage::Inst &inst,
-                    const std::vector<std::unique_ptr<RegTree>> &trees,
+                    const std::vector<std::shared_ptr<RegTree>> &trees,
                     const std::vector<int> &tree_info, std::int32_t bst_group,
                     RegTree::FVec *p_feats, std::uint32_t tree_begin, std::uint32_t tree_end) {
   bst_float psum = 0.0f;
@@ -80,13 +83,47 @@ bst_float PredValue(const SparsePage::Inst &inst,
   return psum;
 }
 
+/**
+ * \brief Number of trees walked simultaneously per row.  Interleaving keeps the top
+ *        levels of every tree in the group cached while hiding the latency of the
+ *        dependent node loads behind the other trees' comparisons.
+ */
+constexpr std::size_t kTreeInterleave = 4;
+
+template <bool has_missing, bool has_categorical>
+void GetLeafIndexByTreeGroup(std::size_t n_trees, RegTree const *const *trees,
+                             RegTree::FVec const &feat,
+                             RegTree::CategoricalSplitMatrix const *cats, bst_node_t *nidx) {
+  std::fill_n(nidx, n_trees, 0);
+  bool all_leaves{false};
+  while (!all_leaves) {
+    all_leaves = true;
+    for (std::size_t t = 0; t < n_trees; ++t) {
+      auto const &tree = *trees[t];
+      auto const &node = tree[nidx[t]];
+      if (node.IsLeaf()) {
+        continue;
+      }
+      bst_feature_t split_index = node.SplitIndex();
+      auto fvalue = feat.GetFvalue(split_index);
+      nidx[t] = GetNextNode<has_missing, has_categorical>(
+          node, nidx[t], fvalue, has_missing && feat.IsMissing(split_index), cats[t]);
+      // Fetched while the remaining trees in the group take their steps.
+      common::PrefetchReadT0(&tree[nidx[t]]);
+      all_leaves = false;
+    }
+  }
+}
+
 template <bool has_categorical>
-bst_float PredValueByOneTree(const RegTree::FVec &p_feats, RegTree const &tree,
-                             RegTree::CategoricalSplitMatrix const &cats) {
-  const bst_node_t leaf = p_feats.HasMissing()
-                              ? GetLeafIndex<true, has_categorical>(tree, p_feats, cats)
-                              : GetLeafIndex<false, has_categorical>(tree, p_feats, cats);
-  return tree[leaf].LeafValue();
+void PredLeafByTreeGroup(RegTree::FVec const &feat, std::size_t n_trees,
+                         RegTree const *const *trees, RegTree::CategoricalSplitMatrix const *cats,
+                         bst_node_t *nidx) {
+  if (feat.HasMissing()) {
+    GetLeafIndexByTreeGroup<true, has_categorical>(n_trees, trees, feat, cats, nidx);
+  } else {
+    GetLeafIndexByTreeGroup<false, has_categorical>(n_trees, trees, feat, cats, nidx);
+  }
 }
 }  // namespace scalar
 
@@ -113,23 +150,68 @@ void PredValueByOneTree(RegTree::FVec const &p_feats, MultiTargetTree const &tre
                               : GetLeafIndex<false, has_categorical>(tree, p_feats, cats);
   auto leaf_value = tree.LeafValue(leaf);
   assert(out_predt.Shape(0) == leaf_value.Shape(0) && "shape mismatch.");
-  for (size_t i = 0; i < leaf_value.Size(); ++i) {
-    out_predt(i) += leaf_value(i);
+  if (out_predt.CContiguous() && leaf_value.CContiguous()) {
+    auto *out = out_predt.Values().data();
+    auto const *in = leaf_value.Values().data();
+    auto const n = leaf_value.Size();
+#pragma omp simd
+    for (std::size_t i = 0; i < n; ++i) {
+      out[i] += in[i];
+    }
+  } else {
+    for (size_t i = 0; i < leaf_value.Size(); ++i) {
+      out_predt(i) += leaf_value(i);
+    }
+  }
+}
+
+// Target-sharded variant: walk to the leaf as usual, but accumulate only the caller's
+// target range.  Concurrent shards of the same row write disjoint slices of the output,
+// and the leaf values are stored contiguously per node, so a shard streams through a
+// narrow slice of each leaf vector.
+template <bool has_categorical>
+void PredValueByOneTreeShard(RegTree::FVec const &p_feats, MultiTargetTree const &tree,
+                             RegTree::CategoricalSplitMatrix const &cats, bst_target_t t_begin,
+                             bst_target_t t_end, linalg::VectorView<float> out_predt) {
+  bst_node_t const leaf = p_feats.HasMissing()
+                              ? GetLeafIndex<true, has_categorical>(tree, p_feats, cats)
+                              : GetLeafIndex<false, has_categorical>(tree, p_feats, cats);
+  auto leaf_value = tree.LeafValue(leaf);
+  assert(out_predt.Shape(0) == leaf_value.Shape(0) && "shape mismatch.");
+  if (out_predt.CContiguous() && leaf_value.CContiguous()) {
+    auto *out = out_predt.Values().data();
+    auto const *in = leaf_value.Values().data();
+#pragma omp simd
+    for (bst_target_t i = t_begin; i < t_end; ++i) {
+      out[i] += in[i];
+    }
+  } else {
+    for (bst_target_t i = t_begin; i < t_end; ++i) {
+      out_predt(i) += leaf_value(i);
+    }
   }
 }
 }  // namespace multi
 
 namespace {
+template <std::size_t block_of_rows_size>
 void PredictByAllTrees(gbm::GBTreeModel const &model, std::uint32_t const tree_begin,
                        std::uint32_t const tree_end, std::size_t const predict_offset,
                        std::vector<RegTree::FVec> const &thread_temp, std::size_t const offset,
                        std::size_t const block_size, linalg::MatrixView<float> out_predt) {
-  for (std::uint32_t tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+  // For single-output models every leaf lands in column 0, so the per-tree outputs can
+  // be staged in a dense per-block accumulator and flushed to out_predt once.
+  bool const single_group =
+      model.learner_model_param->num_output_group == 1 && !model.learner_model_param->IsVectorLeaf();
+  float acc[block_of_rows_size];
+  std::fill_n(acc, block_size, 0.0f);
+
+  for (std::uint32_t tree_id = tree_begin; tree_id < tree_end;) {
     auto const &tree = *model.trees.at(tree_id);
-    auto const &cats = tree.GetCategoriesMatrix();
     bool has_categorical = tree.HasCategoricalSplit();
 
     if (tree.IsMultiTarget()) {
+      auto const &cats = tree.GetCategoriesMatrix();
       if (has_categorical) {
         for (std::size_t i = 0; i < block_size; ++i) {
           auto t_predts = out_predt.Slice(predict_offset + i, linalg::All());
@@ -143,41 +225,279 @@ void PredictByAllTrees(gbm::GBTreeModel const &model, std::uint32_t const tree_b
                                            cats, t_predts);
         }
       }
-    } else {
-      auto const gid = model.tree_info[tree_id];
+      ++tree_id;
+      continue;
+    }
+
+    // Gather a run of trees sharing the categorical dispatch so each row walks all of
+    // them interleaved instead of revisiting cold nodes tree by tree.
+    RegTree const *trees[scalar::kTreeInterleave];
+    RegTree::CategoricalSplitMatrix cats[scalar::kTreeInterleave];
+    int gid[scalar::kTreeInterleave];
+    std::size_t n_group{0};
+    while (n_group < scalar::kTreeInterleave && tree_id + n_group < tree_end) {
+      auto const &candidate = *model.trees.at(tree_id + n_group);
+      if (candidate.IsMultiTarget() || candidate.HasCategoricalSplit() != has_categorical) {
+        break;
+      }
+      trees[n_group] = &candidate;
+      cats[n_group] = candidate.GetCategoriesMatrix();
+      gid[n_group] = model.tree_info[tree_id + n_group];
+      ++n_group;
+    }
+
+    for (std::size_t i = 0; i < block_size; ++i) {
+      auto const &feat = thread_temp[offset + i];
+      bst_node_t nidx[scalar::kTreeInterleave];
       if (has_categorical) {
-        for (std::size_t i = 0; i < block_size; ++i) {
-          out_predt(predict_offset + i, gid) +=
-              scalar::PredValueByOneTree<true>(thread_temp[offset + i], tree, cats);
+        scalar::PredLeafByTreeGroup<true>(feat, n_group, trees, cats, nidx);
+      } else {
+        scalar::PredLeafByTreeGroup<false>(feat, n_group, trees, cats, nidx);
+      }
+      if (single_group) {
+        float psum{0.0f};
+        for (std::size_t t = 0; t < n_group; ++t) {
+          psum += (*trees[t])[nidx[t]].LeafValue();
         }
+        acc[i] += psum;
       } else {
-        for (std::size_t i = 0; i < block_size; ++i) {
-          out_predt(predict_offset + i, gid) +=
-              scalar::PredValueByOneTree<false>(thread_temp[offset + i], tree, cats);
+        for (std::size_t t = 0; t < n_group; ++t) {
+          out_predt(predict_offset + i, gid[t]) += (*trees[t])[nidx[t]].LeafValue();
+        }
+      }
+    }
+    tree_id += n_group;
+  }
+
+  if (single_group) {
+#pragma omp simd
+    for (std::size_t i = 0; i < block_size; ++i) {
+      out_predt(predict_offset + i, 0) += acc[i];
+    }
+  }
+}
+
+// Same as PredictByAllTrees, but over the flattened breadth-first layout.  The next
+// node index is computed arithmetically from the comparison, so the only branch left in
+// the walk is the loop itself.
+template <std::size_t block_of_rows_size>
+void PredictByCompiledTrees(CompiledModel const &compiled, std::size_t const predict_offset,
+                            std::vector<RegTree::FVec> const &thread_temp,
+                            std::size_t const offset, std::size_t const block_size,
+                            linalg::MatrixView<float> out_predt) {
+  bool const single_group = compiled.SingleGroup();
+  float acc[block_of_rows_size];
+  std::fill_n(acc, block_size, 0.0f);
+
+  for (bst_tree_t t = 0; t < compiled.NumTrees(); t += scalar::kTreeInterleave) {
+    auto const n_group = std::min(static_cast<std::size_t>(compiled.NumTrees() - t),
+                                  scalar::kTreeInterleave);
+    common::Span<CompiledModel::Node const> nodes[scalar::kTreeInterleave];
+    for (std::size_t g = 0; g < n_group; ++g) {
+      nodes[g] = compiled.Nodes(t + g);
+    }
+
+    for (std::size_t i = 0; i < block_size; ++i) {
+      auto const &feat = thread_temp[offset + i];
+      bst_node_t nidx[scalar::kTreeInterleave];
+      std::fill_n(nidx, n_group, 0);
+      bool all_leaves{false};
+      while (!all_leaves) {
+        all_leaves = true;
+        for (std::size_t g = 0; g < n_group; ++g) {
+          auto const &node = nodes[g][nidx[g]];
+          if (node.IsLeaf()) {
+            continue;
+          }
+          auto const split_index = node.SplitIndex();
+          auto const fvalue = feat.GetFvalue(split_index);
+          bool const go_left =
+              feat.IsMissing(split_index) ? node.DefaultLeft() : fvalue < node.value;
+          nidx[g] = node.left + !go_left;
+          common::PrefetchReadT0(&nodes[g][nidx[g]]);
+          all_leaves = false;
+        }
+      }
+      if (single_group) {
+        float psum{0.0f};
+        for (std::size_t g = 0; g < n_group; ++g) {
+          psum += nodes[g][nidx[g]].value;
+        }
+        acc[i] += psum;
+      } else {
+        for (std::size_t g = 0; g < n_group; ++g) {
+          out_predt(predict_offset + i, compiled.Group(t + g)) += nodes[g][nidx[g]].value;
+        }
+      }
+    }
+  }
+
+  if (single_group) {
+#pragma omp simd
+    for (std::size_t i = 0; i < block_size; ++i) {
+      out_predt(predict_offset + i, 0) += acc[i];
+    }
+  }
+}
+
+// Fixed-depth group walk for perfect binary trees: the trip count is a compile-time
+// constant, so the loop unrolls and neither a leaf check nor (when the row is dense) a
+// missing-value check survives in the body.
+template <bool has_missing, bst_node_t kDepth>
+void DenseTreeGroupLeaf(RegTree::FVec const &feat, std::size_t n_group,
+                        common::Span<CompiledModel::Node const> const *nodes, bst_node_t *nidx) {
+  std::fill_n(nidx, n_group, 0);
+  for (bst_node_t depth = 0; depth < kDepth; ++depth) {
+    for (std::size_t g = 0; g < n_group; ++g) {
+      auto const &node = nodes[g][nidx[g]];
+      auto const split_index = node.SplitIndex();
+      auto const fvalue = feat.GetFvalue(split_index);
+      bool const go_left =
+          has_missing && feat.IsMissing(split_index) ? node.DefaultLeft() : fvalue < node.value;
+      nidx[g] = node.left + !go_left;
+      common::PrefetchReadT0(&nodes[g][nidx[g]]);
+    }
+  }
+}
+
+// Depth-specialized PredictByCompiledTrees for models where every compiled tree is a
+// perfect binary tree of depth kDepth.
+template <std::size_t block_of_rows_size, bst_node_t kDepth>
+void PredictByDenseCompiledTrees(CompiledModel const &compiled, std::size_t const predict_offset,
+                                 std::vector<RegTree::FVec> const &thread_temp,
+                                 std::size_t const offset, std::size_t const block_size,
+                                 linalg::MatrixView<float> out_predt) {
+  bool const single_group = compiled.SingleGroup();
+  float acc[block_of_rows_size];
+  std::fill_n(acc, block_size, 0.0f);
+
+  for (bst_tree_t t = 0; t < compiled.NumTrees(); t += scalar::kTreeInterleave) {
+    auto const n_group = std::min(static_cast<std::size_t>(compiled.NumTrees() - t),
+                                  scalar::kTreeInterleave);
+    common::Span<CompiledModel::Node const> nodes[scalar::kTreeInterleave];
+    for (std::size_t g = 0; g < n_group; ++g) {
+      nodes[g] = compiled.Nodes(t + g);
+    }
+
+    for (std::size_t i = 0; i < block_size; ++i) {
+      auto const &feat = thread_temp[offset + i];
+      bst_node_t nidx[scalar::kTreeInterleave];
+      if (feat.HasMissing()) {
+        DenseTreeGroupLeaf<true, kDepth>(feat, n_group, nodes, nidx);
+      } else {
+        DenseTreeGroupLeaf<false, kDepth>(feat, n_group, nodes, nidx);
+      }
+      if (single_group) {
+        float psum{0.0f};
+        for (std::size_t g = 0; g < n_group; ++g) {
+          psum += nodes[g][nidx[g]].value;
+        }
+        acc[i] += psum;
+      } else {
+        for (std::size_t g = 0; g < n_group; ++g) {
+          out_predt(predict_offset + i, compiled.Group(t + g)) += nodes[g][nidx[g]].value;
         }
       }
     }
   }
+
+  if (single_group) {
+#pragma omp simd
+    for (std::size_t i = 0; i < block_size; ++i) {
+      out_predt(predict_offset + i, 0) += acc[i];
+    }
+  }
 }
 
+// Deepest tree for which a fixed-depth specialization is instantiated below; deeper or
+// irregular trees take the generic compiled walk.
+template <std::size_t block_of_rows_size>
+void DispatchCompiledTrees(CompiledModel const &compiled, std::size_t const predict_offset,
+                           std::vector<RegTree::FVec> const &thread_temp,
+                           std::size_t const offset, std::size_t const block_size,
+                           linalg::MatrixView<float> out_predt) {
+  switch (compiled.UniformDepth()) {
+#define XGB_DENSE_DEPTH_CASE(d)                                                              \
+  case (d):                                                                                  \
+    PredictByDenseCompiledTrees<block_of_rows_size, (d)>(compiled, predict_offset,           \
+                                                         thread_temp, offset, block_size,    \
+                                                         out_predt);                         \
+    break
+    XGB_DENSE_DEPTH_CASE(1);
+    XGB_DENSE_DEPTH_CASE(2);
+    XGB_DENSE_DEPTH_CASE(3);
+    XGB_DENSE_DEPTH_CASE(4);
+    XGB_DENSE_DEPTH_CASE(5);
+    XGB_DENSE_DEPTH_CASE(6);
+    XGB_DENSE_DEPTH_CASE(7);
+    XGB_DENSE_DEPTH_CASE(8);
+#undef XGB_DENSE_DEPTH_CASE
+    default:
+      PredictByCompiledTrees<block_of_rows_size>(compiled, predict_offset, thread_temp, offset,
+                                                 block_size, out_predt);
+  }
+}
+
+// The set of features referenced by the splits of a model.  Deployed models often use
+// only a fraction of the ingested columns, in which case restricting the FVec fill and
+// drop stages to this set keeps the per-row workspace maintenance proportional to the
+// used features instead of the full feature count.
+struct UsedFeatures {
+  std::vector<std::uint8_t> mask;   // byte mask over all features
+  std::vector<bst_feature_t> fids;  // the used features, sorted
+
+  static UsedFeatures Make(gbm::GBTreeModel const &model, std::uint32_t tree_begin,
+                           std::uint32_t tree_end) {
+    UsedFeatures used;
+    used.mask.resize(model.learner_model_param->num_feature, 0);
+    for (auto tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+      auto const &tree = *model.trees.at(tree_id);
+      tree.WalkTree([&](bst_node_t nidx) {
+        if (!tree.IsLeaf(nidx)) {
+          used.mask.at(tree.SplitIndex(nidx)) = 1;
+        }
+        return true;
+      });
+    }
+    for (std::size_t fidx = 0; fidx < used.mask.size(); ++fidx) {
+      if (used.mask[fidx]) {
+        used.fids.push_back(static_cast<bst_feature_t>(fidx));
+      }
+    }
+    return used;
+  }
+  // Whether the subset is small enough for the masked fill and the per-feature drop to
+  // beat the branch-free full-width clear.
+  [[nodiscard]] bool Beneficial() const { return fids.size() * 2 <= mask.size(); }
+};
+
 template <typename DataView>
 void FVecFill(const size_t block_size, const size_t batch_offset, const int num_feature,
-              DataView *batch, const size_t fvec_offset, std::vector<RegTree::FVec> *p_feats) {
+              DataView *batch, const size_t fvec_offset, std::vector<RegTree::FVec> *p_feats,
+              UsedFeatures const *used = nullptr) {
   for (size_t i = 0; i < block_size; ++i) {
     RegTree::FVec &feats = (*p_feats)[fvec_offset + i];
     if (feats.Size() == 0) {
       feats.Init(num_feature);
     }
     const SparsePage::Inst inst = (*batch)[batch_offset + i];
-    feats.Fill(inst);
+    if (used) {
+      feats.Fill(inst, used->mask, used->fids.size());
+    } else {
+      feats.Fill(inst);
+    }
   }
 }
 
 void FVecDrop(std::size_t const block_size, std::size_t const fvec_offset,
-              std::vector<RegTree::FVec> *p_feats) {
+              std::vector<RegTree::FVec> *p_feats, UsedFeatures const *used = nullptr) {
   for (size_t i = 0; i < block_size; ++i) {
     RegTree::FVec &feats = (*p_feats)[fvec_offset + i];
-    feats.Drop();
+    if (used) {
+      feats.Drop(used->fids);
+    } else {
+      feats.Drop();
+    }
   }
 }
 
@@ -297,11 +617,66 @@ class AdapterView {
   bst_idx_t const static base_rowid = 0;  // NOLINT
 };
 
+// Width of a target shard for wide vector-leaf models, chosen so a shard of a leaf
+// vector and the matching output slice stay resident in L1.
+constexpr bst_target_t kTargetShardSize = 128;
+
+// Target-sharded prediction for wide vector-leaf models.  A task owns a (row block,
+// target range) pair and writes a disjoint slice of the output, so every thread streams
+// through narrow slices of the leaf vectors instead of thrashing the cache with the full
+// target width.  The FVec fill and the tree walk are repeated once per shard, which is
+// cheap next to the accumulation when the target count is large.
+template <typename DataView, size_t block_of_rows_size>
+void PredictBatchMultiTargetSharded(DataView batch, gbm::GBTreeModel const &model,
+                                    std::uint32_t tree_begin, std::uint32_t tree_end,
+                                    std::vector<RegTree::FVec> *p_thread_temp,
+                                    std::int32_t n_threads, bst_target_t n_targets,
+                                    linalg::TensorView<float, 2> out_predt,
+                                    UsedFeatures const *used) {
+  auto &thread_temp = *p_thread_temp;
+  auto const nsize = static_cast<bst_omp_uint>(batch.Size());
+  const int num_feature = model.learner_model_param->num_feature;
+  omp_ulong const n_blocks = common::DivRoundUp(nsize, block_of_rows_size);
+  omp_ulong const n_shards = common::DivRoundUp(n_targets, kTargetShardSize);
+
+  common::ParallelFor(n_blocks * n_shards, n_threads, [&](omp_ulong task_id) {
+    auto const block_id = task_id / n_shards;
+    auto const t_begin = static_cast<bst_target_t>((task_id % n_shards) * kTargetShardSize);
+    auto const t_end = std::min(n_targets, static_cast<bst_target_t>(t_begin + kTargetShardSize));
+
+    const size_t batch_offset = block_id * block_of_rows_size;
+    const size_t block_size = std::min(nsize - batch_offset, block_of_rows_size);
+    const size_t fvec_offset = omp_get_thread_num() * block_of_rows_size;
+
+    FVecFill(block_size, batch_offset, num_feature, &batch, fvec_offset, p_thread_temp, used);
+    for (std::uint32_t tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+      auto const &tree = *model.trees.at(tree_id);
+      CHECK(tree.IsMultiTarget());
+      auto const &mt = *tree.GetMultiTargetTree();
+      auto const &cats = tree.GetCategoriesMatrix();
+      bool const has_categorical = tree.HasCategoricalSplit();
+      for (std::size_t i = 0; i < block_size; ++i) {
+        auto t_predts = out_predt.Slice(batch_offset + batch.base_rowid + i, linalg::All());
+        if (has_categorical) {
+          multi::PredValueByOneTreeShard<true>(thread_temp[fvec_offset + i], mt, cats, t_begin,
+                                               t_end, t_predts);
+        } else {
+          multi::PredValueByOneTreeShard<false>(thread_temp[fvec_offset + i], mt, cats, t_begin,
+                                                t_end, t_predts);
+        }
+      }
+    }
+    FVecDrop(block_size, fvec_offset, p_thread_temp, used);
+  });
+}
+
 template <typename DataView, size_t block_of_rows_size>
 void PredictBatchByBlockOfRowsKernel(DataView batch, gbm::GBTreeModel const &model,
                                      std::uint32_t tree_begin, std::uint32_t tree_end,
                                      std::vector<RegTree::FVec> *p_thread_temp, int32_t n_threads,
-                                     linalg::TensorView<float, 2> out_predt) {
+                                     linalg::TensorView<float, 2> out_predt,
+                                     CompiledModel const *compiled = nullptr,
+                                     UsedFeatures const *used = nullptr) {
   auto &thread_temp = *p_thread_temp;
 
   // parallel over local batch
@@ -309,16 +684,116 @@ void PredictBatchByBlockOfRowsKernel(DataView batch, gbm::GBTreeModel const &mod
   const int num_feature = model.learner_model_param->num_feature;
   omp_ulong n_blocks = common::DivRoundUp(nsize, block_of_rows_size);
 
+  // Wide vector-leaf models are sharded over targets as well as rows.
+  auto const n_targets = model.learner_model_param->OutputLength();
+  if (model.learner_model_param->IsVectorLeaf() && !compiled &&
+      n_targets >= 2 * kTargetShardSize) {
+    PredictBatchMultiTargetSharded<DataView, block_of_rows_size>(
+        batch, model, tree_begin, tree_end, p_thread_temp, n_threads, n_targets, out_predt, used);
+    return;
+  }
+
   common::ParallelFor(n_blocks, n_threads, [&](bst_omp_uint block_id) {
     const size_t batch_offset = block_id * block_of_rows_size;
     const size_t block_size = std::min(nsize - batch_offset, block_of_rows_size);
     const size_t fvec_offset = omp_get_thread_num() * block_of_rows_size;
 
-    FVecFill(block_size, batch_offset, num_feature, &batch, fvec_offset, p_thread_temp);
+    FVecFill(block_size, batch_offset, num_feature, &batch, fvec_offset, p_thread_temp, used);
     // process block of rows through all trees to keep cache locality
-    PredictByAllTrees(model, tree_begin, tree_end, batch_offset + batch.base_rowid, thread_temp,
-                      fvec_offset, block_size, out_predt);
-    FVecDrop(block_size, fvec_offset, p_thread_temp);
+    if (compiled) {
+      DispatchCompiledTrees<block_of_rows_size>(*compiled, batch_offset + batch.base_rowid,
+                                                thread_temp, fvec_offset, block_size, out_predt);
+    } else {
+      PredictByAllTrees<block_of_rows_size>(model, tree_begin, tree_end,
+                                            batch_offset + batch.base_rowid, thread_temp,
+                                            fvec_offset, block_size, out_predt);
+    }
+    FVecDrop(block_size, fvec_offset, p_thread_temp, used);
+  });
+}
+
+// Leaf-index counterpart of PredictByAllTrees: the same interleaved group walk, but
+// recording the leaf index reached in every tree instead of accumulating leaf values.
+// Indices are written straight into the caller's [n_samples, n_trees] matrix.
+void PredictLeafByAllTrees(gbm::GBTreeModel const &model, std::uint32_t const tree_end,
+                           std::size_t const predict_offset,
+                           std::vector<RegTree::FVec> const &thread_temp, std::size_t const offset,
+                           std::size_t const block_size, linalg::MatrixView<float> out_predt) {
+  for (std::uint32_t tree_id = 0; tree_id < tree_end;) {
+    auto const &tree = *model.trees.at(tree_id);
+    bool has_categorical = tree.HasCategoricalSplit();
+
+    if (tree.IsMultiTarget()) {
+      auto const &mt = *tree.GetMultiTargetTree();
+      auto const &cats = tree.GetCategoriesMatrix();
+      for (std::size_t i = 0; i < block_size; ++i) {
+        auto const &feat = thread_temp[offset + i];
+        bst_node_t nidx;
+        if (has_categorical) {
+          nidx = feat.HasMissing() ? multi::GetLeafIndex<true, true>(mt, feat, cats)
+                                   : multi::GetLeafIndex<false, true>(mt, feat, cats);
+        } else {
+          nidx = feat.HasMissing() ? multi::GetLeafIndex<true, false>(mt, feat, cats)
+                                   : multi::GetLeafIndex<false, false>(mt, feat, cats);
+        }
+        out_predt(predict_offset + i, tree_id) = static_cast<float>(nidx);
+      }
+      ++tree_id;
+      continue;
+    }
+
+    RegTree const *trees[scalar::kTreeInterleave];
+    RegTree::CategoricalSplitMatrix cats[scalar::kTreeInterleave];
+    std::size_t n_group{0};
+    while (n_group < scalar::kTreeInterleave && tree_id + n_group < tree_end) {
+      auto const &candidate = *model.trees.at(tree_id + n_group);
+      if (candidate.IsMultiTarget() || candidate.HasCategoricalSplit() != has_categorical) {
+        break;
+      }
+      trees[n_group] = &candidate;
+      cats[n_group] = candidate.GetCategoriesMatrix();
+      ++n_group;
+    }
+
+    for (std::size_t i = 0; i < block_size; ++i) {
+      auto const &feat = thread_temp[offset + i];
+      bst_node_t nidx[scalar::kTreeInterleave];
+      if (has_categorical) {
+        scalar::PredLeafByTreeGroup<true>(feat, n_group, trees, cats, nidx);
+      } else {
+        scalar::PredLeafByTreeGroup<false>(feat, n_group, trees, cats, nidx);
+      }
+      for (std::size_t t = 0; t < n_group; ++t) {
+        out_predt(predict_offset + i, tree_id + t) = static_cast<float>(nidx[t]);
+      }
+    }
+    tree_id += n_group;
+  }
+}
+
+template <typename DataView, size_t block_of_rows_size>
+void PredictLeafBatchByBlockOfRowsKernel(DataView batch, gbm::GBTreeModel const &model,
+                                         std::uint32_t tree_end,
+                                         std::vector<RegTree::FVec> *p_thread_temp,
+                                         int32_t n_threads,
+                                         linalg::TensorView<float, 2> out_predt,
+                                         UsedFeatures const *used = nullptr) {
+  auto &thread_temp = *p_thread_temp;
+
+  // parallel over local batch
+  const auto nsize = static_cast<bst_omp_uint>(batch.Size());
+  const int num_feature = model.learner_model_param->num_feature;
+  omp_ulong n_blocks = common::DivRoundUp(nsize, block_of_rows_size);
+
+  common::ParallelFor(n_blocks, n_threads, [&](bst_omp_uint block_id) {
+    const size_t batch_offset = block_id * block_of_rows_size;
+    const size_t block_size = std::min(nsize - batch_offset, block_of_rows_size);
+    const size_t fvec_offset = omp_get_thread_num() * block_of_rows_size;
+
+    FVecFill(block_size, batch_offset, num_feature, &batch, fvec_offset, p_thread_temp, used);
+    PredictLeafByAllTrees(model, tree_end, batch_offset + batch.base_rowid, thread_temp,
+                          fvec_offset, block_size, out_predt);
+    FVecDrop(block_size, fvec_offset, p_thread_temp, used);
   });
 }
 
@@ -676,6 +1151,17 @@ class CPUPredictor : public Predictor {
     CHECK_EQ(out_preds->size(), n_samples * n_groups);
     auto out_predt = linalg::MakeTensorView(ctx_, *out_preds, n_samples, n_groups);
 
+    // Flatten of the model into the compiled layout, cached across calls since committed
+    // trees are immutable.
+    std::shared_ptr<CompiledModel const> compiled;
+    if (blocked && CompiledModel::CanCompile(model, tree_begin, tree_end)) {
+      compiled = this->GetCompiled(model, tree_begin, tree_end);
+    }
+
+    // Restrict the workspace fill to the features the model actually splits on.
+    auto used = UsedFeatures::Make(model, tree_begin, tree_end);
+    auto const *p_used = used.Beneficial() ? &used : nullptr;
+
     if (!p_fmat->PageExists<SparsePage>()) {
       std::vector<Entry> workspace(p_fmat->Info().num_col_ * kUnroll * n_threads);
       auto ft = p_fmat->Info().feature_types.ConstHostVector();
@@ -683,11 +1169,11 @@ class CPUPredictor : public Predictor {
         if (blocked) {
           PredictBatchByBlockOfRowsKernel<GHistIndexMatrixView, kBlockOfRowsSize>(
               GHistIndexMatrixView{batch, p_fmat->Info().num_col_, ft, workspace, n_threads}, model,
-              tree_begin, tree_end, &feat_vecs, n_threads, out_predt);
+              tree_begin, tree_end, &feat_vecs, n_threads, out_predt, compiled.get(), p_used);
         } else {
           PredictBatchByBlockOfRowsKernel<GHistIndexMatrixView, 1>(
               GHistIndexMatrixView{batch, p_fmat->Info().num_col_, ft, workspace, n_threads}, model,
-              tree_begin, tree_end, &feat_vecs, n_threads, out_predt);
+              tree_begin, tree_end, &feat_vecs, n_threads, out_predt, nullptr, p_used);
         }
       }
     } else {
@@ -695,12 +1181,12 @@ class CPUPredictor : public Predictor {
         if (blocked) {
           PredictBatchByBlockOfRowsKernel<SparsePageView, kBlockOfRowsSize>(
               SparsePageView{&batch}, model, tree_begin, tree_end, &feat_vecs, n_threads,
-              out_predt);
+              out_predt, compiled.get(), p_used);
 
         } else {
           PredictBatchByBlockOfRowsKernel<SparsePageView, 1>(SparsePageView{&batch}, model,
                                                              tree_begin, tree_end, &feat_vecs,
-                                                             n_threads, out_predt);
+                                                             n_threads, out_predt, nullptr, p_used);
         }
       }
     }
@@ -722,48 +1208,59 @@ class CPUPredictor : public Predictor {
     CHECK_NE(ncolumns, 0);
     auto base_margin = info.base_margin_.View(ctx_->Device());
     auto base_score = model.learner_model_param->BaseScore(ctx_->Device())(0);
+    auto const n_threads = this->ctx_->Threads();
+    std::vector<TreeShapWorkspace> shap_workspaces(n_threads);
 
-    // parallel over local batch
-    common::ParallelFor(batch.Size(), this->ctx_->Threads(), [&](auto i) {
-      auto row_idx = batch.base_rowid + i;
-      RegTree::FVec &feats = (*feat_vecs)[omp_get_thread_num()];
-      if (feats.Size() == 0) {
-        feats.Init(num_feature);
-      }
+    // parallel over blocks of rows; each filled FVec runs every tree before being
+    // dropped, and the path arena is reused across rows and trees within a thread.
+    auto const nsize = batch.Size();
+    auto const n_blocks = common::DivRoundUp(nsize, kBlockOfRowsSize);
+    common::ParallelFor(n_blocks, n_threads, [&](auto block_id) {
+      auto const batch_offset = block_id * kBlockOfRowsSize;
+      auto const block_size = std::min(static_cast<std::size_t>(nsize - batch_offset),
+                                       static_cast<std::size_t>(kBlockOfRowsSize));
+      auto const fvec_offset = omp_get_thread_num() * kBlockOfRowsSize;
+      auto &shap_workspace = shap_workspaces[omp_get_thread_num()];
       std::vector<bst_float> this_tree_contribs(ncolumns);
-      // loop over all classes
-      for (int gid = 0; gid < ngroup; ++gid) {
-        bst_float* p_contribs = &(*contribs)[(row_idx * ngroup + gid) * ncolumns];
-        feats.Fill(batch[i]);
-        // calculate contributions
-        for (unsigned j = 0; j < ntree_limit; ++j) {
-          auto *tree_mean_values = &mean_values->at(j);
-          std::fill(this_tree_contribs.begin(), this_tree_contribs.end(), 0);
-          if (model.tree_info[j] != gid) {
-            continue;
+
+      FVecFill(block_size, batch_offset, num_feature, &batch, fvec_offset, feat_vecs);
+      for (std::size_t i = 0; i < block_size; ++i) {
+        auto row_idx = batch.base_rowid + batch_offset + i;
+        auto const &feats = (*feat_vecs)[fvec_offset + i];
+        // loop over all classes
+        for (int gid = 0; gid < ngroup; ++gid) {
+          bst_float *p_contribs = &(*contribs)[(row_idx * ngroup + gid) * ncolumns];
+          // calculate contributions
+          for (unsigned j = 0; j < ntree_limit; ++j) {
+            if (model.tree_info[j] != gid) {
+              continue;
+            }
+            auto *tree_mean_values = &mean_values->at(j);
+            std::fill(this_tree_contribs.begin(), this_tree_contribs.end(), 0);
+            if (!approximate) {
+              CalculateContributions(*model.trees[j], feats, tree_mean_values,
+                                     &this_tree_contribs[0], condition, condition_feature,
+                                     &shap_workspace);
+            } else {
+              model.trees[j]->CalculateContributionsApprox(
+                  feats, tree_mean_values, &this_tree_contribs[0]);
+            }
+            for (size_t ci = 0; ci < ncolumns; ++ci) {
+              p_contribs[ci] +=
+                  this_tree_contribs[ci] *
+                  (tree_weights == nullptr ? 1 : (*tree_weights)[j]);
+            }
           }
-          if (!approximate) {
-            CalculateContributions(*model.trees[j], feats, tree_mean_values,
-                                   &this_tree_contribs[0], condition, condition_feature);
+          // add base margin to BIAS
+          if (base_margin.Size() != 0) {
+            CHECK_EQ(base_margin.Shape(1), ngroup);
+            p_contribs[ncolumns - 1] += base_margin(row_idx, gid);
           } else {
-            model.trees[j]->CalculateContributionsApprox(
-                feats, tree_mean_values, &this_tree_contribs[0]);
+            p_contribs[ncolumns - 1] += base_score;
           }
-          for (size_t ci = 0; ci < ncolumns; ++ci) {
-            p_contribs[ci] +=
-                this_tree_contribs[ci] *
-                (tree_weights == nullptr ? 1 : (*tree_weights)[j]);
-          }
-        }
-        feats.Drop();
-        // add base margin to BIAS
-        if (base_margin.Size() != 0) {
-          CHECK_EQ(base_margin.Shape(1), ngroup);
-          p_contribs[ncolumns - 1] += base_margin(row_idx, gid);
-        } else {
-          p_contribs[ncolumns - 1] += base_score;
         }
       }
+      FVecDrop(block_size, fvec_offset, feat_vecs);
     });
   }
 
@@ -805,9 +1302,17 @@ class CPUPredictor : public Predictor {
     InitThreadTemp(n_threads * kBlockSize, &thread_temp);
     std::size_t n_groups = model.learner_model_param->OutputLength();
     auto out_predt = linalg::MakeTensorView(ctx_, predictions, m->NumRows(), n_groups);
+    // With the compiled layout cached on the predictor, the flatten cost is no longer
+    // paid per call and the fast walk applies to inplace prediction as well.
+    std::shared_ptr<CompiledModel const> compiled;
+    if (kBlockSize > 1 && CompiledModel::CanCompile(model, tree_begin, tree_end)) {
+      compiled = this->GetCompiled(model, tree_begin, tree_end);
+    }
+    auto used = UsedFeatures::Make(model, tree_begin, tree_end);
+    auto const *p_used = used.Beneficial() ? &used : nullptr;
     PredictBatchByBlockOfRowsKernel<AdapterView<Adapter>, kBlockSize>(
         AdapterView<Adapter>(m.get(), missing, common::Span<Entry>{workspace}, n_threads), model,
-        tree_begin, tree_end, &thread_temp, n_threads, out_predt);
+        tree_begin, tree_end, &thread_temp, n_threads, out_predt, compiled.get(), p_used);
   }
 
   bool InplacePredict(std::shared_ptr<DMatrix> p_m, const gbm::GBTreeModel &model, float missing,
@@ -891,33 +1396,16 @@ class CPUPredictor : public Predictor {
     }
 
     std::vector<RegTree::FVec> feat_vecs;
-    const int num_feature = model.learner_model_param->num_feature;
-    InitThreadTemp(n_threads, &feat_vecs);
-    // start collecting the prediction
+    InitThreadTemp(n_threads * kBlockOfRowsSize, &feat_vecs);
+    // The indices are written straight into the output matrix, which the C API hands out
+    // as a contiguous [n_samples, n_trees] view without further copies.
+    auto out_predt = linalg::MakeTensorView(ctx_, preds, info.num_row_,
+                                            static_cast<std::size_t>(ntree_limit));
+    auto used = UsedFeatures::Make(model, 0, ntree_limit);
+    auto const *p_used = used.Beneficial() ? &used : nullptr;
     for (const auto &batch : p_fmat->GetBatches<SparsePage>()) {
-      // parallel over local batch
-      auto page = batch.GetView();
-      common::ParallelFor(page.Size(), n_threads, [&](auto i) {
-        const int tid = omp_get_thread_num();
-        auto ridx = static_cast<size_t>(batch.base_rowid + i);
-        RegTree::FVec &feats = feat_vecs[tid];
-        if (feats.Size() == 0) {
-          feats.Init(num_feature);
-        }
-        feats.Fill(page[i]);
-        for (std::uint32_t j = 0; j < ntree_limit; ++j) {
-          auto const &tree = *model.trees[j];
-          auto const &cats = tree.GetCategoriesMatrix();
-          bst_node_t nidx;
-          if (tree.IsMultiTarget()) {
-            nidx = multi::GetLeafIndex<true, true>(*tree.GetMultiTargetTree(), feats, cats);
-          } else {
-            nidx = scalar::GetLeafIndex<true, true>(tree, feats, cats);
-          }
-          preds[ridx * ntree_limit + j] = static_cast<bst_float>(nidx);
-        }
-        feats.Drop();
-      });
+      PredictLeafBatchByBlockOfRowsKernel<SparsePageView, kBlockOfRowsSize>(
+          SparsePageView{&batch}, model, ntree_limit, &feat_vecs, n_threads, out_predt, p_used);
     }
   }
 
@@ -931,7 +1419,7 @@ class CPUPredictor : public Predictor {
         << "Predict contribution support for column-wise data split is not yet implemented.";
     auto const n_threads = this->ctx_->Threads();
     std::vector<RegTree::FVec> feat_vecs;
-    InitThreadTemp(n_threads, &feat_vecs);
+    InitThreadTemp(n_threads * kBlockOfRowsSize, &feat_vecs);
     const MetaInfo& info = p_fmat->Info();
     // number of valid trees
     if (ntree_limit == 0 || ntree_limit > model.trees.size()) {
@@ -1025,6 +1513,35 @@ class CPUPredictor : public Predictor {
 
  private:
   static size_t constexpr kBlockOfRowsSize = 64;
+
+  /**
+   * \brief Compiled layout of the last model/tree range predicted with, rebuilt when the
+   *        model version changes.
+   *
+   * Guarded by a mutex since inplace prediction may be issued from several threads.
+   */
+  struct CompiledModelCache {
+    gbm::GBTreeModel const *model{nullptr};
+    std::uint64_t version{0};
+    std::uint32_t tree_begin{0};
+    std::uint32_t tree_end{0};
+    std::shared_ptr<CompiledModel const> compiled;
+  };
+  mutable CompiledModelCache compiled_cache_;
+  mutable std::mutex compiled_cache_mu_;
+
+  [[nodiscard]] std::shared_ptr<CompiledModel const> GetCompiled(gbm::GBTreeModel const &model,
+                                                                 std::uint32_t tree_begin,
+                                                                 std::uint32_t tree_end) const {
+    std::lock_guard guard{compiled_cache_mu_};
+    auto &cache = compiled_cache_;
+    if (cache.model != &model || cache.version != model.Version() ||
+        cache.tree_begin != tree_begin || cache.tree_end != tree_end) {
+      cache = {&model, model.Version(), tree_begin, tree_end,
+               std::make_shared<CompiledModel const>(model, tree_begin, tree_end)};
+    }
+    return cache.compiled;
+  }
 };
 
 XGBOOST_REGISTER_PREDICTOR(CPUPredictor, "cpu_predictor")
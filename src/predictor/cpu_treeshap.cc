@@ -1,5 +1,5 @@
 /**
- * Copyright by XGBoost Contributors 2017-2022
+ * Copyright by XGBoost Contributors 2017-2025
  */
 #include "cpu_treeshap.h"
 
@@ -12,20 +12,6 @@
 #include "xgboost/tree_model.h"  // RegTree
 
 namespace xgboost {
-// Used by TreeShap
-// data we keep about our decision path
-// note that pweight is included for convenience and is not tied with the other attributes
-// the pweight of the i'th path element is the permutation weight of paths with i-1 ones in them
-struct PathElement {
-  int feature_index;
-  float zero_fraction;
-  float one_fraction;
-  float pweight;
-  PathElement() = default;
-  PathElement(int i, float z, float o, float w)
-      : feature_index(i), zero_fraction(z), one_fraction(o), pweight(w) {}
-};
-
 // extend our decision path with a fraction of one and zero extensions
 void ExtendPath(PathElement* unique_path, std::uint32_t unique_depth, float zero_fraction,
                 float one_fraction, int feature_index) {
@@ -94,56 +80,73 @@ float UnwoundPathSum(const PathElement* unique_path, std::uint32_t unique_depth,
 }
 
 /**
- * \brief Recursive function that computes the feature attributions for a single tree.
+ * \brief Iterative function that computes the feature attributions for a single tree.
+ *
+ * The depth-first walk of the recursive formulation is driven by an explicit frame stack
+ * instead; the hot child is pushed last so it is expanded first, which reproduces the
+ * recursion's arena discipline exactly: both children of a node copy the node's path from
+ * the same region, one after the other, so the triangular arena bound
+ * maxd * (maxd + 1) / 2 carries over unchanged.
+ *
  * \param feat dense feature vector, if the feature is missing the field is set to NaN
  * \param phi dense output vector of feature attributions
- * \param node_index the index of the current node in the tree
- * \param unique_depth how many unique features are above the current node in the tree
- * \param parent_unique_path a vector of statistics about our current path through the tree
- * \param parent_zero_fraction what fraction of the parent path weight is coming as 0 (integrated)
- * \param parent_one_fraction what fraction of the parent path weight is coming as 1 (fixed)
- * \param parent_feature_index what feature the parent node used to split
  * \param condition fix one feature to either off (-1) on (1) or not fixed (0 default)
  * \param condition_feature the index of the feature to fix
- * \param condition_fraction what fraction of the current weight matches our conditioning feature
+ * \param p_workspace per-thread path arena and frame stack, reused across calls
  */
-void TreeShap(RegTree const& tree, const RegTree::FVec& feat, float* phi, bst_node_t node_index,
-              std::uint32_t unique_depth, PathElement* parent_unique_path,
-              float parent_zero_fraction, float parent_one_fraction, int parent_feature_index,
-              int condition, std::uint32_t condition_feature, float condition_fraction) {
-  const auto node = tree[node_index];
-
-  // stop if we have no weight coming down to us
-  if (condition_fraction == 0) return;
-
-  // extend the unique path
-  PathElement* unique_path = parent_unique_path + unique_depth + 1;
-  std::copy(parent_unique_path, parent_unique_path + unique_depth + 1, unique_path);
-
-  if (condition == 0 || condition_feature != static_cast<std::uint32_t>(parent_feature_index)) {
-    ExtendPath(unique_path, unique_depth, parent_zero_fraction, parent_one_fraction,
-               parent_feature_index);
+void TreeShap(RegTree const& tree, const RegTree::FVec& feat, float* phi, int condition,
+              std::uint32_t condition_feature, TreeShapWorkspace* p_workspace) {
+  auto& ws = *p_workspace;
+  const int maxd = tree.MaxDepth(0) + 2;
+  if (ws.unique_paths.size() < static_cast<std::size_t>((maxd * (maxd + 1)) / 2)) {
+    ws.unique_paths.resize((maxd * (maxd + 1)) / 2);
   }
-  const std::uint32_t split_index = node.SplitIndex();
-
-  // leaf node
-  if (node.IsLeaf()) {
-    for (std::uint32_t i = 1; i <= unique_depth; ++i) {
-      const float w = UnwoundPathSum(unique_path, unique_depth, i);
-      const PathElement& el = unique_path[i];
-      phi[el.feature_index] +=
-          w * (el.one_fraction - el.zero_fraction) * node.LeafValue() * condition_fraction;
+  ws.stack.clear();
+  ws.stack.push_back(TreeShapWorkspace::Frame{0, 0, 0, 1.0f, 1.0f, -1, 1.0f});
+
+  while (!ws.stack.empty()) {
+    auto const fr = ws.stack.back();
+    ws.stack.pop_back();
+
+    // stop if we have no weight coming down to us
+    if (fr.condition_fraction == 0) {
+      continue;
+    }
+
+    auto unique_depth = fr.unique_depth;
+    // extend the unique path
+    PathElement const* parent_unique_path = ws.unique_paths.data() + fr.parent_offset;
+    std::uint32_t const own_offset = fr.parent_offset + unique_depth + 1;
+    PathElement* unique_path = ws.unique_paths.data() + own_offset;
+    std::copy(parent_unique_path, parent_unique_path + unique_depth + 1, unique_path);
+
+    if (condition == 0 ||
+        condition_feature != static_cast<std::uint32_t>(fr.parent_feature_index)) {
+      ExtendPath(unique_path, unique_depth, fr.zero_fraction, fr.one_fraction,
+                 fr.parent_feature_index);
     }
 
-    // internal node
-  } else {
-    // find which branch is "hot" (meaning x would follow it)
+    const auto node = tree[fr.nidx];
+    const std::uint32_t split_index = node.SplitIndex();
+
+    // leaf node
+    if (node.IsLeaf()) {
+      for (std::uint32_t i = 1; i <= unique_depth; ++i) {
+        const float w = UnwoundPathSum(unique_path, unique_depth, i);
+        const PathElement& el = unique_path[i];
+        phi[el.feature_index] +=
+            w * (el.one_fraction - el.zero_fraction) * node.LeafValue() * fr.condition_fraction;
+      }
+      continue;
+    }
+
+    // internal node: find which branch is "hot" (meaning x would follow it)
     auto const& cats = tree.GetCategoriesMatrix();
     bst_node_t hot_index = predictor::GetNextNode<true, true>(
-        node, node_index, feat.GetFvalue(split_index), feat.IsMissing(split_index), cats);
+        node, fr.nidx, feat.GetFvalue(split_index), feat.IsMissing(split_index), cats);
 
     const auto cold_index = (hot_index == node.LeftChild() ? node.RightChild() : node.LeftChild());
-    const float w = tree.Stat(node_index).sum_hess;
+    const float w = tree.Stat(fr.nidx).sum_hess;
     const float hot_zero_fraction = tree.Stat(hot_index).sum_hess / w;
     const float cold_zero_fraction = tree.Stat(cold_index).sum_hess / w;
     float incoming_zero_fraction = 1;
@@ -162,9 +165,9 @@ void TreeShap(RegTree const& tree, const RegTree::FVec& feat, float* phi, bst_no
       unique_depth -= 1;
     }
 
-    // divide up the condition_fraction among the recursive calls
-    float hot_condition_fraction = condition_fraction;
-    float cold_condition_fraction = condition_fraction;
+    // divide up the condition_fraction among the children
+    float hot_condition_fraction = fr.condition_fraction;
+    float cold_condition_fraction = fr.condition_fraction;
     if (condition > 0 && split_index == condition_feature) {
       cold_condition_fraction = 0;
       unique_depth -= 1;
@@ -174,30 +177,25 @@ void TreeShap(RegTree const& tree, const RegTree::FVec& feat, float* phi, bst_no
       unique_depth -= 1;
     }
 
-    TreeShap(tree, feat, phi, hot_index, unique_depth + 1, unique_path,
-             hot_zero_fraction * incoming_zero_fraction, incoming_one_fraction, split_index,
-             condition, condition_feature, hot_condition_fraction);
-
-    TreeShap(tree, feat, phi, cold_index, unique_depth + 1, unique_path,
-             cold_zero_fraction * incoming_zero_fraction, 0, split_index, condition,
-             condition_feature, cold_condition_fraction);
+    // cold first so the hot subtree is fully expanded before the cold copy is taken
+    ws.stack.push_back(TreeShapWorkspace::Frame{
+        cold_index, unique_depth + 1, own_offset, cold_zero_fraction * incoming_zero_fraction,
+        0.0f, static_cast<int>(split_index), cold_condition_fraction});
+    ws.stack.push_back(TreeShapWorkspace::Frame{
+        hot_index, unique_depth + 1, own_offset, hot_zero_fraction * incoming_zero_fraction,
+        incoming_one_fraction, static_cast<int>(split_index), hot_condition_fraction});
   }
 }
 
 void CalculateContributions(RegTree const& tree, const RegTree::FVec& feat,
                             std::vector<float>* mean_values, float* out_contribs, int condition,
-                            std::uint32_t condition_feature) {
+                            std::uint32_t condition_feature, TreeShapWorkspace* workspace) {
   // find the expected value of the tree's predictions
   if (condition == 0) {
     float node_value = (*mean_values)[0];
     out_contribs[feat.Size()] += node_value;
   }
 
-  // Preallocate space for the unique path data
-  const int maxd = tree.MaxDepth(0) + 2;
-  std::vector<PathElement> unique_path_data((maxd * (maxd + 1)) / 2);
-
-  TreeShap(tree, feat, out_contribs, 0, 0, unique_path_data.data(), 1, 1, -1, condition,
-           condition_feature, 1);
+  TreeShap(tree, feat, out_contribs, condition, condition_feature, workspace);
 }
 }  // namespace xgboost
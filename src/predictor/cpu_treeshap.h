@@ -1,22 +1,58 @@
 #ifndef XGBOOST_PREDICTOR_CPU_TREESHAP_H_
 #define XGBOOST_PREDICTOR_CPU_TREESHAP_H_
 /**
- * Copyright by XGBoost Contributors 2017-2022
+ * Copyright by XGBoost Contributors 2017-2025
  */
+#include <cstdint>               // uint32_t
 #include <vector>                // vector
 
 #include "xgboost/tree_model.h"  // RegTree
 
 namespace xgboost {
+// data we keep about our decision path
+// note that pweight is included for convenience and is not tied with the other attributes
+// the pweight of the i'th path element is the permutation weight of paths with i-1 ones in them
+struct PathElement {
+  int feature_index;
+  float zero_fraction;
+  float one_fraction;
+  float pweight;
+  PathElement() = default;
+  PathElement(int i, float z, float o, float w)
+      : feature_index(i), zero_fraction(z), one_fraction(o), pweight(w) {}
+};
+
+/**
+ * \brief Reusable scratch space for the iterative TreeSHAP walk.  One instance per thread,
+ *   reused across rows and trees, so the path arena and the traversal stack are allocated
+ *   once instead of per tree.
+ */
+struct TreeShapWorkspace {
+  // One pending subtree of the depth-first walk, carrying the state the recursive
+  // formulation passed as arguments.
+  struct Frame {
+    bst_node_t nidx;
+    std::uint32_t unique_depth;
+    std::uint32_t parent_offset;  // offset of the parent's path copy in unique_paths
+    float zero_fraction;
+    float one_fraction;
+    int parent_feature_index;
+    float condition_fraction;
+  };
+  std::vector<PathElement> unique_paths;
+  std::vector<Frame> stack;
+};
+
 /**
  * \brief calculate the feature contributions (https://arxiv.org/abs/1706.06060) for the tree
  * \param feat dense feature vector, if the feature is missing the field is set to NaN
  * \param out_contribs output vector to hold the contributions
  * \param condition fix one feature to either off (-1) on (1) or not fixed (0 default)
  * \param condition_feature the index of the feature to fix
+ * \param workspace per-thread scratch reused across calls
  */
 void CalculateContributions(RegTree const &tree, const RegTree::FVec &feat,
                             std::vector<float> *mean_values, bst_float *out_contribs, int condition,
-                            unsigned condition_feature);
+                            unsigned condition_feature, TreeShapWorkspace *workspace);
 }  // namespace xgboost
 #endif  // XGBOOST_PREDICTOR_CPU_TREESHAP_H_
@@ -6,8 +6,10 @@
 #include <thrust/device_vector.h>
 #include <thrust/fill.h>
 
-#include <any>  // for any, any_cast
+#include <any>    // for any, any_cast
 #include <memory>
+#include <mutex>   // for lock_guard, mutex
+#include <vector>  // for vector
 
 #include "../collective/allreduce.h"
 #include "../common/bitfield.h"
@@ -17,14 +19,17 @@
 #include "../common/cuda_rt_utils.h"   // for AllVisibleGPUs, SetDevice
 #include "../common/device_helpers.cuh"
 #include "../common/error_msg.h"  // for InplacePredictProxy
-#include "../data/batch_utils.h"  // for StaticBatch
+#include "../common/optional_weight.h"  // for MakeOptionalWeights
+#include "../data/batch_utils.h"        // for StaticBatch
 #include "../data/device_adapter.cuh"
 #include "../data/ellpack_page.cuh"
 #include "../data/proxy_dmatrix.h"
 #include "../gbm/gbtree_model.h"
+#include "../objective/regression_loss.h"  // for LinearSquareLoss, LogisticRegression
 #include "predict_fn.h"
 #include "xgboost/data.h"
 #include "xgboost/host_device_vector.h"
+#include "xgboost/objective.h"  // for FusedGradientOp
 #include "xgboost/predictor.h"
 #include "xgboost/tree_model.h"
 #include "xgboost/tree_updater.h"
@@ -37,6 +42,9 @@ using cuda_impl::StaticBatch;
 struct TreeView {
   RegTree::CategoricalSplitMatrix cats;
   common::Span<RegTree::Node const> d_tree;
+  // Optional copy of the first nodes of the tree staged in shared memory, empty unless
+  // the launching kernel cooperatively filled it.
+  common::Span<RegTree::Node const> s_cached;
 
   XGBOOST_DEVICE
   TreeView(size_t tree_begin, size_t tree_idx, common::Span<const RegTree::Node> d_nodes,
@@ -65,6 +73,14 @@ struct TreeView {
   }
 
   [[nodiscard]] __device__ bool HasCategoricalSplit() const { return !cats.categories.empty(); }
+
+  /** \brief Fetch a node, preferring the shared memory copy of the top levels. */
+  [[nodiscard]] __device__ RegTree::Node GetNode(bst_node_t nidx) const {
+    if (static_cast<std::size_t>(nidx) < s_cached.size()) {
+      return s_cached.data()[nidx];
+    }
+    return d_tree[nidx];
+  }
 };
 
 struct SparsePageView {
@@ -219,12 +235,12 @@ struct DeviceAdapterLoader {
 template <bool has_missing, bool has_categorical, typename Loader>
 __device__ bst_node_t GetLeafIndex(bst_idx_t ridx, TreeView const& tree, Loader* loader) {
   bst_node_t nidx = 0;
-  RegTree::Node n = tree.d_tree[nidx];
+  RegTree::Node n = tree.GetNode(nidx);
   while (!n.IsLeaf()) {
     float fvalue = loader->GetElement(ridx, n.SplitIndex());
     bool is_missing = common::CheckNAN(fvalue);
     nidx = GetNextNode<has_missing, has_categorical>(n, nidx, fvalue, is_missing, tree.cats);
-    n = tree.d_tree[nidx];
+    n = tree.GetNode(nidx);
   }
   return nidx;
 }
@@ -238,7 +254,7 @@ __device__ float GetLeafWeight(bst_idx_t ridx, TreeView const &tree,
   } else {
     nidx = GetLeafIndex<has_missing, false>(ridx, tree, loader);
   }
-  return tree.d_tree[nidx].LeafValue();
+  return tree.GetNode(nidx).LeafValue();
 }
 
 template <typename Loader, typename Data>
@@ -276,7 +292,55 @@ PredictLeafKernel(Data data, common::Span<const RegTree::Node> d_nodes,
   }
 }
 
-template <typename Loader, typename Data, bool has_missing = true>
+// Number of nodes staged in shared memory per tree when the feature cache is not in
+// use, covering the top eight levels of a complete tree.
+constexpr std::size_t kCachedNodes = 255;
+
+// Cooperatively copy the top levels of the current tree into shared memory.  Must be
+// reached by every thread in the block.
+__device__ void StageTopLevels(TreeView* tree, RegTree::Node* s_nodes) {
+  auto const n_cached = tree->d_tree.size() < kCachedNodes ? tree->d_tree.size() : kCachedNodes;
+  __syncthreads();
+  for (auto i = static_cast<std::size_t>(threadIdx.x); i < n_cached; i += blockDim.x) {
+    s_nodes[i] = tree->d_tree.data()[i];
+  }
+  __syncthreads();
+  tree->s_cached = common::Span<RegTree::Node const>{s_nodes, n_cached};
+}
+
+// Epilogue for PredictKernel when no gradient is fused with the prediction.
+struct NoGradient {
+  __device__ void operator()(bst_idx_t, float) const {}
+};
+
+/**
+ * @brief Prediction epilogue that evaluates the objective gradient while the accumulated
+ *        margin is still in registers, saving the gradient kernel a full read of the
+ *        prediction vector.  Mirrors the arithmetic in RegLossObj<Loss>::GetGradient.
+ */
+template <typename Loss>
+struct FusedGradientFn {
+  linalg::MatrixView<GradientPair> d_gpair;
+  linalg::MatrixView<float const> d_labels;
+  common::OptionalWeights d_weights;
+  float scale_pos_weight;
+  bool fast_exp;
+  bst_idx_t base_rowid;  // row offset of the current batch
+
+  __device__ void operator()(bst_idx_t ridx, float margin) const {
+    auto idx = ridx + base_rowid;
+    float p = fast_exp ? Loss::ApproxPredTransform(margin) : Loss::PredTransform(margin);
+    float label = d_labels(idx, 0);
+    float w = d_weights[idx];
+    if (label == 1.0f) {
+      w *= scale_pos_weight;
+    }
+    d_gpair(idx, 0) = GradientPair{Loss::FirstOrderGradient(p, label) * w,
+                                   Loss::SecondOrderGradient(p, label) * w};
+  }
+};
+
+template <typename Loader, typename Data, bool has_missing = true, typename GradFn = NoGradient>
 __global__ void
 PredictKernel(Data data, common::Span<const RegTree::Node> d_nodes,
               common::Span<float> d_out_predictions,
@@ -287,10 +351,18 @@ PredictKernel(Data data, common::Span<const RegTree::Node> d_nodes,
               common::Span<RegTree::CategoricalSplitMatrix::Segment const> d_cat_node_segments,
               common::Span<uint32_t const> d_categories, size_t tree_begin,
               size_t tree_end, size_t num_features, size_t num_rows,
-              bool use_shared, int num_group, float missing) {
+              bool use_shared, bool cache_nodes, int num_group, float missing,
+              GradFn grad_fn) {
   bst_uint global_idx = blockDim.x * blockIdx.x + threadIdx.x;
   Loader loader(data, use_shared, num_features, num_rows, missing);
-  if (global_idx >= num_rows) return;
+  // When nodes are staged cooperatively, inactive threads must stay for the block-wide
+  // synchronization in StageTopLevels.
+  bool const active = global_idx < num_rows;
+  if (!cache_nodes && !active) {
+    return;
+  }
+  extern __shared__ float _smem[];
+  auto* s_nodes = reinterpret_cast<RegTree::Node*>(_smem);
 
   if (num_group == 1) {
     float sum = 0;
@@ -299,10 +371,18 @@ PredictKernel(Data data, common::Span<const RegTree::Node> d_nodes,
           tree_begin,          tree_idx,           d_nodes,
           d_tree_segments,     d_tree_split_types, d_cat_tree_segments,
           d_cat_node_segments, d_categories};
-      float leaf = GetLeafWeight<has_missing>(global_idx, d_tree, &loader);
-      sum += leaf;
+      if (cache_nodes) {
+        StageTopLevels(&d_tree, s_nodes);
+      }
+      if (active) {
+        sum += GetLeafWeight<has_missing>(global_idx, d_tree, &loader);
+      }
+    }
+    if (active) {
+      float margin = d_out_predictions[global_idx] + sum;
+      d_out_predictions[global_idx] = margin;
+      grad_fn(global_idx, margin);
     }
-    d_out_predictions[global_idx] += sum;
   } else {
     for (size_t tree_idx = tree_begin; tree_idx < tree_end; tree_idx++) {
       int tree_group = d_tree_group[tree_idx];
@@ -310,9 +390,14 @@ PredictKernel(Data data, common::Span<const RegTree::Node> d_nodes,
           tree_begin,          tree_idx,           d_nodes,
           d_tree_segments,     d_tree_split_types, d_cat_tree_segments,
           d_cat_node_segments, d_categories};
-      bst_uint out_prediction_idx = global_idx * num_group + tree_group;
-      d_out_predictions[out_prediction_idx] +=
-          GetLeafWeight<has_missing>(global_idx, d_tree, &loader);
+      if (cache_nodes) {
+        StageTopLevels(&d_tree, s_nodes);
+      }
+      if (active) {
+        bst_uint out_prediction_idx = global_idx * num_group + tree_group;
+        d_out_predictions[out_prediction_idx] +=
+            GetLeafWeight<has_missing>(global_idx, d_tree, &loader);
+      }
     }
   }
 }
@@ -846,9 +931,82 @@ class ColumnSplitHelper {
 
 class GPUPredictor : public xgboost::Predictor {
  private:
+  /**
+   * \brief Keep the device copy of the model resident across predict calls.
+   *
+   * Uploading through DeviceModel::Init is linear in the model size and dominates the
+   * cost of scoring small batches.  The copy is rebuilt only when the stamp taken from
+   * the model changes: the model object, its number of trees, the address of the last
+   * committed tree, the requested tree range, or the device.  A shared pointer is
+   * handed out so a rebuild never pulls the buffers from under an in-flight call.
+   */
+  struct DeviceModelCache {
+    std::shared_ptr<DeviceModel> model;
+    gbm::GBTreeModel const* src{nullptr};
+    void const* last_tree{nullptr};
+    std::size_t n_trees{0};
+    std::size_t tree_begin{0};
+    std::size_t tree_end{0};
+    DeviceOrd device;
+  };
+  mutable std::mutex model_lock_;
+  mutable DeviceModelCache model_cache_;
+
+  std::shared_ptr<DeviceModel> GetDeviceModel(gbm::GBTreeModel const& model,
+                                              std::size_t tree_begin, std::size_t tree_end,
+                                              DeviceOrd device) const {
+    std::lock_guard<std::mutex> guard{model_lock_};
+    auto& cache = model_cache_;
+    void const* last_tree = model.trees.empty() ? nullptr : model.trees.back().get();
+    bool const fresh = cache.model && cache.src == &model && cache.last_tree == last_tree &&
+                       cache.n_trees == model.trees.size() && cache.tree_begin == tree_begin &&
+                       cache.tree_end == tree_end && cache.device == device;
+    if (!fresh) {
+      cache.model = std::make_shared<DeviceModel>();
+      cache.model->Init(model, tree_begin, tree_end, device);
+      cache.src = &model;
+      cache.last_tree = last_tree;
+      cache.n_trees = model.trees.size();
+      cache.tree_begin = tree_begin;
+      cache.tree_end = tree_end;
+      cache.device = device;
+    }
+    return cache.model;
+  }
+
+  /**
+   * \brief Pool of per-call CUDA streams for inplace prediction.
+   *
+   * Concurrent InplacePredict calls all launch on the context stream, so small-batch
+   * requests from an inference server queue on the device even though the device copy of
+   * the model is shared read-only.  Each call checks a session out of the pool, launches
+   * on the session's stream and synchronizes only that stream before handing the session
+   * back, so predictions issued by different host threads overlap on the device.
+   */
+  struct PredictionSession {
+    dh::CUDAStream stream;
+  };
+  mutable std::mutex session_lock_;
+  mutable std::vector<std::unique_ptr<PredictionSession>> sessions_;
+
+  std::unique_ptr<PredictionSession> AcquireSession() const {
+    std::lock_guard<std::mutex> guard{session_lock_};
+    if (sessions_.empty()) {
+      return std::make_unique<PredictionSession>();
+    }
+    auto session = std::move(sessions_.back());
+    sessions_.pop_back();
+    return session;
+  }
+  void ReturnSession(std::unique_ptr<PredictionSession> session) const {
+    std::lock_guard<std::mutex> guard{session_lock_};
+    sessions_.push_back(std::move(session));
+  }
+
+  template <typename GradFn = NoGradient>
   void PredictInternal(const SparsePage& batch, DeviceModel const& model, size_t num_features,
                        HostDeviceVector<bst_float>* predictions, size_t batch_offset,
-                       bool is_dense) const {
+                       bool is_dense, GradFn grad_fn = NoGradient{}) const {
     batch.offset.SetDevice(ctx_->Device());
     batch.data.SetDevice(ctx_->Device());
     const uint32_t BLOCK_THREADS = 128;
@@ -858,6 +1016,12 @@ class GPUPredictor : public xgboost::Predictor {
     size_t shared_memory_bytes =
         SharedMemoryBytes<BLOCK_THREADS>(num_features, max_shared_memory_bytes);
     bool use_shared = shared_memory_bytes != 0;
+    // When the feature cache does not fit, use the shared memory for the top tree
+    // levels instead.
+    bool const cache_nodes = !use_shared;
+    if (cache_nodes) {
+      shared_memory_bytes = sizeof(RegTree::Node) * kCachedNodes;
+    }
 
     SparsePageView data(batch.data.DeviceSpan(), batch.offset.DeviceSpan(),
                         num_features);
@@ -868,32 +1032,35 @@ class GPUPredictor : public xgboost::Predictor {
           model.tree_group.ConstDeviceSpan(), model.split_types.ConstDeviceSpan(),
           model.categories_tree_segments.ConstDeviceSpan(),
           model.categories_node_segments.ConstDeviceSpan(), model.categories.ConstDeviceSpan(),
-          model.tree_beg_, model.tree_end_, num_features, num_rows, use_shared, model.num_group,
-          std::numeric_limits<float>::quiet_NaN());
+          model.tree_beg_, model.tree_end_, num_features, num_rows, use_shared, cache_nodes,
+          model.num_group, std::numeric_limits<float>::quiet_NaN(), grad_fn);
     };
     if (is_dense) {
-      kernel(PredictKernel<SparsePageLoader, SparsePageView, false>);
+      kernel(PredictKernel<SparsePageLoader, SparsePageView, false, GradFn>);
     } else {
-      kernel(PredictKernel<SparsePageLoader, SparsePageView, true>);
+      kernel(PredictKernel<SparsePageLoader, SparsePageView, true, GradFn>);
     }
   }
 
+  template <typename GradFn = NoGradient>
   void PredictInternal(EllpackDeviceAccessor const& batch, DeviceModel const& model,
-                       HostDeviceVector<bst_float>* out_preds, bst_idx_t batch_offset) const {
+                       HostDeviceVector<bst_float>* out_preds, bst_idx_t batch_offset,
+                       GradFn grad_fn = NoGradient{}) const {
     const uint32_t BLOCK_THREADS = 256;
     size_t num_rows = batch.n_rows;
     auto GRID_SIZE = static_cast<uint32_t>(common::DivRoundUp(num_rows, BLOCK_THREADS));
-    DeviceModel d_model;
 
     bool use_shared = false;
-    dh::LaunchKernel {GRID_SIZE, BLOCK_THREADS, 0, ctx_->CUDACtx()->Stream()}(
-        PredictKernel<EllpackLoader, EllpackDeviceAccessor>, batch, model.nodes.ConstDeviceSpan(),
-        out_preds->DeviceSpan().subspan(batch_offset), model.tree_segments.ConstDeviceSpan(),
-        model.tree_group.ConstDeviceSpan(), model.split_types.ConstDeviceSpan(),
-        model.categories_tree_segments.ConstDeviceSpan(),
+    bool const cache_nodes = true;
+    std::size_t const shared_memory_bytes = sizeof(RegTree::Node) * kCachedNodes;
+    dh::LaunchKernel {GRID_SIZE, BLOCK_THREADS, shared_memory_bytes, ctx_->CUDACtx()->Stream()}(
+        PredictKernel<EllpackLoader, EllpackDeviceAccessor, true, GradFn>, batch,
+        model.nodes.ConstDeviceSpan(), out_preds->DeviceSpan().subspan(batch_offset),
+        model.tree_segments.ConstDeviceSpan(), model.tree_group.ConstDeviceSpan(),
+        model.split_types.ConstDeviceSpan(), model.categories_tree_segments.ConstDeviceSpan(),
         model.categories_node_segments.ConstDeviceSpan(), model.categories.ConstDeviceSpan(),
-        model.tree_beg_, model.tree_end_, batch.NumFeatures(), num_rows, use_shared,
-        model.num_group, std::numeric_limits<float>::quiet_NaN());
+        model.tree_beg_, model.tree_end_, batch.NumFeatures(), num_rows, use_shared, cache_nodes,
+        model.num_group, std::numeric_limits<float>::quiet_NaN(), grad_fn);
   }
 
   void DevicePredictInternal(DMatrix* dmat, HostDeviceVector<float>* out_preds,
@@ -904,8 +1071,8 @@ class GPUPredictor : public xgboost::Predictor {
     }
     out_preds->SetDevice(ctx_->Device());
     auto const& info = dmat->Info();
-    DeviceModel d_model;
-    d_model.Init(model, tree_begin, tree_end, ctx_->Device());
+    auto p_model = this->GetDeviceModel(model, tree_begin, tree_end, ctx_->Device());
+    auto& d_model = *p_model;
 
     if (info.IsColumnSplit()) {
       column_split_helper_.PredictBatch(dmat, out_preds, model, d_model);
@@ -932,6 +1099,41 @@ class GPUPredictor : public xgboost::Predictor {
     }
   }
 
+  template <typename Loss>
+  void FusedPredictDMatrix(DMatrix* dmat, HostDeviceVector<float>* out_preds,
+                           gbm::GBTreeModel const& model, size_t tree_begin, size_t tree_end,
+                           FusedGradientOp const& op,
+                           linalg::MatrixView<GradientPair> d_gpair) const {
+    auto const& info = dmat->Info();
+    auto d_labels = info.labels.View(ctx_->Device());
+    auto d_weights = common::MakeOptionalWeights(ctx_, info);
+    auto p_model = this->GetDeviceModel(model, tree_begin, tree_end, ctx_->Device());
+    auto& d_model = *p_model;
+
+    CHECK_LE(info.num_col_, model.learner_model_param->num_feature);
+    if (dmat->PageExists<SparsePage>()) {
+      bst_idx_t batch_offset = 0;
+      for (auto& batch : dmat->GetBatches<SparsePage>()) {
+        FusedGradientFn<Loss> grad_fn{d_gpair, d_labels, d_weights, op.scale_pos_weight,
+                                      op.fast_exp, batch_offset};
+        this->PredictInternal(batch, d_model, model.learner_model_param->num_feature, out_preds,
+                              batch_offset, dmat->IsDense(), grad_fn);
+        batch_offset += batch.Size();
+      }
+    } else {
+      bst_idx_t batch_offset = 0;
+      for (auto const& page : dmat->GetBatches<EllpackPage>(ctx_, StaticBatch(true))) {
+        info.feature_types.SetDevice(ctx_->Device());
+        auto feature_types = info.feature_types.ConstDeviceSpan();
+        FusedGradientFn<Loss> grad_fn{d_gpair, d_labels, d_weights, op.scale_pos_weight,
+                                      op.fast_exp, batch_offset};
+        this->PredictInternal(page.Impl()->GetDeviceAccessor(ctx_, feature_types), d_model,
+                              out_preds, batch_offset, grad_fn);
+        batch_offset += page.Size();
+      }
+    }
+  }
+
  public:
   explicit GPUPredictor(Context const* ctx)
       : Predictor::Predictor{ctx}, column_split_helper_{ctx} {}
@@ -953,6 +1155,38 @@ class GPUPredictor : public xgboost::Predictor {
     this->DevicePredictInternal(dmat, out_preds, model, tree_begin, tree_end);
   }
 
+  [[nodiscard]] bool PredictBatchWithFusedGradient(
+      DMatrix* dmat, PredictionCacheEntry* predts, gbm::GBTreeModel const& model,
+      std::uint32_t tree_begin, std::uint32_t tree_end, FusedGradientOp const& op,
+      linalg::Matrix<GradientPair>* out_gpair) const override {
+    CHECK(ctx_->Device().IsCUDA()) << "Set `device' to `cuda` for processing GPU data.";
+    auto const& info = dmat->Info();
+    if (model.learner_model_param->OutputLength() != 1 || info.IsColumnSplit() ||
+        info.labels.Size() != info.num_row_ || tree_end <= tree_begin) {
+      return false;
+    }
+
+    auto* out_preds = &predts->predictions;
+    out_preds->SetDevice(ctx_->Device());
+    out_gpair->SetDevice(ctx_->Device());
+    out_gpair->Reshape(info.num_row_, 1);
+    auto d_gpair = out_gpair->View(ctx_->Device());
+
+    switch (op.kind) {
+      case FusedGradientOp::kSquaredError:
+        this->FusedPredictDMatrix<obj::LinearSquareLoss>(dmat, out_preds, model, tree_begin,
+                                                         tree_end, op, d_gpair);
+        break;
+      case FusedGradientOp::kLogistic:
+        this->FusedPredictDMatrix<obj::LogisticRegression>(dmat, out_preds, model, tree_begin,
+                                                           tree_end, op, d_gpair);
+        break;
+      default:
+        return false;
+    }
+    return true;
+  }
+
   template <typename Adapter, typename Loader>
   void DispatchedInplacePredict(std::any const& x, std::shared_ptr<DMatrix> p_m,
                                 const gbm::GBTreeModel& model, float missing,
@@ -982,18 +1216,32 @@ class GPUPredictor : public xgboost::Predictor {
     auto max_shared_memory_bytes = dh::MaxSharedMemory(m->Device().ordinal);
     size_t shared_memory_bytes =
         SharedMemoryBytes<BLOCK_THREADS>(m->NumColumns(), max_shared_memory_bytes);
-    DeviceModel d_model;
-    d_model.Init(model, tree_begin, tree_end, m->Device());
+    auto p_model = this->GetDeviceModel(model, tree_begin, tree_end, m->Device());
+    auto& d_model = *p_model;
 
     bool use_shared = shared_memory_bytes != 0;
+    bool const cache_nodes = !use_shared;
+    if (cache_nodes) {
+      shared_memory_bytes = sizeof(RegTree::Node) * kCachedNodes;
+    }
 
-    dh::LaunchKernel {GRID_SIZE, BLOCK_THREADS, shared_memory_bytes, ctx_->CUDACtx()->Stream()}(
+    auto session = this->AcquireSession();
+    // Order the output initialization issued on the context stream before the kernel.
+    dh::CUDAEvent init_done;
+    init_done.Record(ctx_->CUDACtx()->Stream());
+    session->stream.Wait(init_done);
+
+    dh::LaunchKernel {GRID_SIZE, BLOCK_THREADS, shared_memory_bytes, session->stream.View()}(
         PredictKernel<Loader, typename Loader::BatchT>, m->Value(), d_model.nodes.ConstDeviceSpan(),
         out_preds->predictions.DeviceSpan(), d_model.tree_segments.ConstDeviceSpan(),
         d_model.tree_group.ConstDeviceSpan(), d_model.split_types.ConstDeviceSpan(),
         d_model.categories_tree_segments.ConstDeviceSpan(),
         d_model.categories_node_segments.ConstDeviceSpan(), d_model.categories.ConstDeviceSpan(),
-        tree_begin, tree_end, m->NumColumns(), m->NumRows(), use_shared, output_groups, missing);
+        tree_begin, tree_end, m->NumColumns(), m->NumRows(), use_shared, cache_nodes,
+        output_groups, missing, NoGradient{});
+
+    session->stream.Sync();
+    this->ReturnSession(std::move(session));
   }
 
   bool InplacePredict(std::shared_ptr<DMatrix> p_m, const gbm::GBTreeModel& model, float missing,
@@ -1050,8 +1298,8 @@ class GPUPredictor : public xgboost::Predictor {
 
     dh::device_vector<gpu_treeshap::PathElement<ShapSplitCondition>>
         device_paths;
-    DeviceModel d_model;
-    d_model.Init(model, 0, tree_end, ctx_->Device());
+    auto p_model = this->GetDeviceModel(model, 0, tree_end, ctx_->Device());
+    auto& d_model = *p_model;
     dh::device_vector<uint32_t> categories;
     ExtractPaths(ctx_, &device_paths, &d_model, &categories, ctx_->Device());
     if (p_fmat->PageExists<SparsePage>()) {
@@ -1120,8 +1368,8 @@ class GPUPredictor : public xgboost::Predictor {
 
     dh::device_vector<gpu_treeshap::PathElement<ShapSplitCondition>>
         device_paths;
-    DeviceModel d_model;
-    d_model.Init(model, 0, tree_end, ctx_->Device());
+    auto p_model = this->GetDeviceModel(model, 0, tree_end, ctx_->Device());
+    auto& d_model = *p_model;
     dh::device_vector<uint32_t> categories;
     ExtractPaths(ctx_, &device_paths, &d_model, &categories, ctx_->Device());
     if (p_fmat->PageExists<SparsePage>()) {
@@ -1182,8 +1430,8 @@ class GPUPredictor : public xgboost::Predictor {
     }
     predictions->SetDevice(ctx_->Device());
     predictions->Resize(num_rows * tree_end);
-    DeviceModel d_model;
-    d_model.Init(model, 0, tree_end, this->ctx_->Device());
+    auto p_model = this->GetDeviceModel(model, 0, tree_end, this->ctx_->Device());
+    auto& d_model = *p_model;
 
     if (info.IsColumnSplit()) {
       column_split_helper_.PredictLeaf(p_fmat, predictions, model, d_model);
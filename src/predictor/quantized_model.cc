@@ -0,0 +1,125 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include "quantized_model.h"
+
+#include <algorithm>  // for lower_bound
+#include <deque>      // for deque
+#include <limits>     // for numeric_limits
+
+#include "../common/math.h"       // for ToHalf, FromHalf
+#include "../gbm/gbtree_model.h"  // for GBTreeModel
+#include "xgboost/logging.h"      // for CHECK
+#include "xgboost/tree_model.h"   // for RegTree
+
+namespace xgboost::predictor {
+namespace {
+// Local bin index of a split condition within the cuts of its feature, or -1 when the
+// condition does not sit on the cut grid.
+bst_bin_t SearchCut(common::HistogramCuts const& cuts, bst_feature_t fidx, float cond) {
+  auto const& ptrs = cuts.Ptrs();
+  auto const& values = cuts.Values();
+  auto const beg = values.cbegin() + ptrs[fidx];
+  auto const end = values.cbegin() + ptrs[fidx + 1];
+  auto it = std::lower_bound(beg, end, cond);
+  if (it == end || *it != cond) {
+    return -1;
+  }
+  return static_cast<bst_bin_t>(it - beg);
+}
+}  // namespace
+
+bool QuantizedModel::CanQuantize(gbm::GBTreeModel const& model, common::HistogramCuts const& cuts,
+                                 bst_tree_t tree_begin, bst_tree_t tree_end) {
+  auto constexpr kMax = std::numeric_limits<std::uint16_t>::max();
+  for (bst_tree_t tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+    auto const& tree = *model.trees.at(tree_id);
+    if (tree.IsMultiTarget() || tree.HasCategoricalSplit()) {
+      return false;
+    }
+    if (tree.GetNodes().size() > kMax) {
+      return false;
+    }
+    bool ok{true};
+    tree.WalkTree([&](bst_node_t nidx) {
+      auto const& node = tree[nidx];
+      if (node.IsLeaf()) {
+        return true;
+      }
+      auto const bin = SearchCut(cuts, node.SplitIndex(), node.SplitCond());
+      if (bin < 0 || bin > static_cast<bst_bin_t>(kMax)) {
+        ok = false;
+        return false;
+      }
+      return true;
+    });
+    if (!ok) {
+      return false;
+    }
+  }
+  return true;
+}
+
+QuantizedModel::QuantizedModel(gbm::GBTreeModel const& model, common::HistogramCuts const& cuts,
+                               bst_tree_t tree_begin, bst_tree_t tree_end)
+    : cut_values_{cuts.Values()}, cut_ptrs_{cuts.Ptrs()} {
+  CHECK(CanQuantize(model, cuts, tree_begin, tree_end));
+  std::size_t n_nodes{0};
+  for (bst_tree_t tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+    n_nodes += model.trees.at(tree_id)->GetNodes().size();
+  }
+  nodes_.reserve(n_nodes);
+  tree_ptr_.reserve(tree_end - tree_begin + 1);
+  tree_ptr_.push_back(0);
+  tree_info_.reserve(tree_end - tree_begin);
+
+  for (bst_tree_t tree_id = tree_begin; tree_id < tree_end; ++tree_id) {
+    auto const& tree = *model.trees.at(tree_id);
+    auto const begin = nodes_.size();
+    // The same breadth-first flatten as the compiled layout, with the two children of a
+    // split adjacent so the right child is implicitly left + 1.
+    std::deque<bst_node_t> queue{RegTree::kRoot};
+    nodes_.emplace_back();
+    std::size_t out{begin};
+    while (!queue.empty()) {
+      bst_node_t const nidx = queue.front();
+      queue.pop_front();
+      auto const& node = tree[nidx];
+      if (node.IsLeaf()) {
+        nodes_[out++] = Node{0, 0, common::ToHalf(node.LeafValue())};
+        continue;
+      }
+      auto const left = static_cast<std::uint16_t>(nodes_.size() - begin);
+      nodes_.emplace_back();
+      nodes_.emplace_back();
+      queue.push_back(node.LeftChild());
+      queue.push_back(node.RightChild());
+      auto sindex = static_cast<std::uint32_t>(node.SplitIndex());
+      if (node.DefaultLeft()) {
+        sindex |= 1U << 31;
+      }
+      auto const bin = SearchCut(cuts, node.SplitIndex(), node.SplitCond());
+      nodes_[out++] = Node{sindex, left, static_cast<std::uint16_t>(bin)};
+    }
+    tree_ptr_.push_back(nodes_.size());
+    tree_info_.push_back(model.tree_info.at(tree_id));
+  }
+}
+
+float QuantizedModel::PredictTree(bst_tree_t t, RegTree::FVec const& feat) const {
+  auto nodes = this->Nodes(t);
+  Node const* node = &nodes[0];
+  while (!node->IsLeaf()) {
+    auto const fidx = node->SplitIndex();
+    bst_node_t next;
+    if (feat.IsMissing(fidx)) {
+      next = node->left + !node->DefaultLeft();
+    } else {
+      auto const cond = cut_values_[cut_ptrs_[fidx] + node->data];
+      next = node->left + !(feat.GetFvalue(fidx) < cond);
+    }
+    node = &nodes[next];
+  }
+  return common::FromHalf(node->data);
+}
+}  // namespace xgboost::predictor
@@ -0,0 +1,86 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ * \file quantized_model.h
+ * \brief Bin-domain tree layout with half precision leaves for compact inference.
+ */
+#ifndef XGBOOST_PREDICTOR_QUANTIZED_MODEL_H_
+#define XGBOOST_PREDICTOR_QUANTIZED_MODEL_H_
+
+#include <cstdint>  // for uint16_t, uint32_t
+#include <vector>   // for vector
+
+#include "../common/hist_util.h"  // for HistogramCuts
+#include "xgboost/base.h"         // for bst_feature_t, bst_node_t, bst_tree_t
+#include "xgboost/span.h"         // for Span
+#include "xgboost/tree_model.h"   // for RegTree
+
+namespace xgboost::gbm {
+struct GBTreeModel;
+}  // namespace xgboost::gbm
+
+namespace xgboost::predictor {
+/**
+ * \brief A compact, mildly lossy copy of the scalar trees in a model.
+ *
+ * Trees trained on quantized data only ever split at histogram cut values, so the split
+ * condition can be stored as a bin index against the \ref common::HistogramCuts without
+ * changing a single traversal decision; the cut values are kept alongside the nodes and
+ * decoded during the walk.  Leaf values are narrowed to IEEE half floats, which is the
+ * deliberate accuracy trade.  The resulting 8-byte node is a quarter of the `RegTree`
+ * footprint, letting models with thousands of trees stay cache resident on a serving
+ * tier.
+ *
+ * Like \ref CompiledModel, trees are flattened breadth-first with the two children of a
+ * split adjacent.  Callers must consult \ref CanQuantize and keep the regular walk when
+ * the model does not fit the layout.
+ */
+class QuantizedModel {
+ public:
+  struct Node {
+    /** Split feature index, with the default-left flag packed into the high bit. */
+    std::uint32_t sindex;
+    /** Index of the left child inside the tree, 0 when this is a leaf. */
+    std::uint16_t left;
+    /** Threshold bin index local to the feature, or the half float leaf value. */
+    std::uint16_t data;
+
+    [[nodiscard]] bst_feature_t SplitIndex() const { return sindex & ((1U << 31) - 1U); }
+    [[nodiscard]] bool DefaultLeft() const { return (sindex >> 31) != 0; }
+    [[nodiscard]] bool IsLeaf() const { return left == 0; }
+  };
+  static_assert(sizeof(Node) == 8);
+
+  /**
+   * \brief Whether every tree in `[tree_begin, tree_end)` fits the quantized layout:
+   *        single-target, numerical splits only, every split condition present among the
+   *        cuts of its feature, and node and bin counts within the 16-bit fields.
+   */
+  static bool CanQuantize(gbm::GBTreeModel const& model, common::HistogramCuts const& cuts,
+                          bst_tree_t tree_begin, bst_tree_t tree_end);
+
+  QuantizedModel(gbm::GBTreeModel const& model, common::HistogramCuts const& cuts,
+                 bst_tree_t tree_begin, bst_tree_t tree_end);
+
+  [[nodiscard]] bst_tree_t NumTrees() const {
+    return static_cast<bst_tree_t>(tree_ptr_.size() - 1);
+  }
+  /** \brief Nodes of the t^th quantized tree, breadth-first with the root at 0. */
+  [[nodiscard]] common::Span<Node const> Nodes(bst_tree_t t) const {
+    return common::Span<Node const>{nodes_}.subspan(tree_ptr_[t], tree_ptr_[t + 1] - tree_ptr_[t]);
+  }
+  /** \brief Output group of the t^th quantized tree. */
+  [[nodiscard]] std::int32_t Group(bst_tree_t t) const { return tree_info_[t]; }
+  /** \brief Leaf value reached by a row in the t^th tree. */
+  [[nodiscard]] float PredictTree(bst_tree_t t, RegTree::FVec const& feat) const;
+
+ private:
+  std::vector<Node> nodes_;
+  // CSR-style offsets of each tree into nodes_.
+  std::vector<std::size_t> tree_ptr_;
+  std::vector<std::int32_t> tree_info_;
+  // Cut values and per-feature offsets, copied so the model is self contained.
+  std::vector<float> cut_values_;
+  std::vector<std::uint32_t> cut_ptrs_;
+};
+}  // namespace xgboost::predictor
+#endif  // XGBOOST_PREDICTOR_QUANTIZED_MODEL_H_
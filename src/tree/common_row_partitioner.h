@@ -6,9 +6,10 @@
 #ifndef XGBOOST_TREE_COMMON_ROW_PARTITIONER_H_
 #define XGBOOST_TREE_COMMON_ROW_PARTITIONER_H_
 
-#include <algorithm>  // for all_of, fill
+#include <algorithm>  // for all_of, copy_n, equal, fill, max, transform
 #include <cstdint>    // for uint32_t, int32_t
 #include <limits>     // for numeric_limits
+#include <numeric>    // for partial_sum
 #include <vector>     // for vector
 
 #include "../collective/allreduce.h"      // for Allreduce
@@ -89,13 +90,22 @@ class ColumnSplitHelper {
     std::copy_n(decision.Data(), decision_storage_.size(), decision_storage_.data());
     std::copy_n(missing.Data(), missing_storage_.size(), missing_storage_.data());
 
-    // Then aggregate the bit vectors across all the workers.
-    auto rc = collective::Success() << [&] {
-      return collective::Allreduce(ctx, &decision_storage_, collective::Op::kBitwiseOR);
-    } << [&] {
-      return collective::Allreduce(ctx, &missing_storage_, collective::Op::kBitwiseAND);
-    };
+    // Then aggregate the bit vectors across all the workers.  Both reductions are packed
+    // into a single allreduce since round-trip latency dominates this exchange: OR over
+    // the complement is AND over the original, so the missing bits ride along with the
+    // decision bits.
+    auto n = decision_storage_.size();
+    exchange_storage_.resize(2 * n);
+    std::copy_n(decision_storage_.data(), n, exchange_storage_.data());
+    std::transform(missing_storage_.cbegin(), missing_storage_.cend(),
+                   exchange_storage_.begin() + n,
+                   [](auto v) { return static_cast<BitVector::value_type>(~v); });
+    auto rc = collective::Allreduce(ctx, &exchange_storage_, collective::Op::kBitwiseOR);
     collective::SafeColl(rc);
+    std::copy_n(exchange_storage_.data(), n, decision_storage_.data());
+    std::transform(exchange_storage_.cbegin() + n, exchange_storage_.cend(),
+                   missing_storage_.begin(),
+                   [](auto v) { return static_cast<BitVector::value_type>(~v); });
 
     // Finally use the bit vectors to partition the rows.
     common::ParallelFor2d(space, n_threads, [&](size_t node_in_set, common::Range1d r) {
@@ -118,6 +128,8 @@ class ColumnSplitHelper {
 
   std::vector<BitVector::value_type> tloc_decision_;
   std::vector<BitVector::value_type> tloc_missing_;
+  // Scratch for packing both bit vectors into one allreduce message.
+  std::vector<BitVector::value_type> exchange_storage_;
 
   common::PartitionBuilder<kPartitionBlockSize>* partition_builder_;
   common::RowSetCollection* row_set_collection_;
@@ -131,12 +143,70 @@ class CommonRowPartitioner {
   CommonRowPartitioner(Context const* ctx, bst_idx_t num_row, bst_idx_t _base_rowid,
                        bool is_col_split)
       : base_rowid{_base_rowid}, is_col_split_{is_col_split} {
+    // Row indices are stored in 32-bit, like the GPU partitioner.
+    CHECK_LE(_base_rowid + num_row,
+             static_cast<bst_idx_t>(std::numeric_limits<common::RowIndexT>::max()));
+    row_set_collection_.Clear();
+    std::vector<common::RowIndexT>& row_indices = *row_set_collection_.Data();
+    row_indices.resize(num_row);
+
+    common::RowIndexT* p_row_indices = row_indices.data();
+    common::Iota(ctx, p_row_indices, p_row_indices + row_indices.size(),
+                 static_cast<common::RowIndexT>(base_rowid));
+    row_set_collection_.Init();
+
+    if (is_col_split_) {
+      column_split_helper_ = ColumnSplitHelper{num_row, &partition_builder_, &row_set_collection_};
+    }
+  }
+
+  /**
+   * @brief Initialize the root row set with the sampled rows only.
+   *
+   *   Rows with zero gradient (sampled out by subsample) are dropped in a single
+   *   parallel pass, so the histogram build and the position update scale with the
+   *   number of sampled rows instead of the total.  @p gpair holds the gradients for
+   *   the rows of this partition, indexed from 0.
+   */
+  CommonRowPartitioner(Context const* ctx, common::Span<GradientPair const> gpair,
+                       bst_idx_t num_row, bst_idx_t _base_rowid, bool is_col_split)
+      : base_rowid{_base_rowid}, is_col_split_{is_col_split} {
+    CHECK_LE(_base_rowid + num_row,
+             static_cast<bst_idx_t>(std::numeric_limits<common::RowIndexT>::max()));
+    CHECK_EQ(gpair.size(), num_row);
     row_set_collection_.Clear();
-    std::vector<bst_idx_t>& row_indices = *row_set_collection_.Data();
+    std::vector<common::RowIndexT>& row_indices = *row_set_collection_.Data();
     row_indices.resize(num_row);
 
-    bst_idx_t* p_row_indices = row_indices.data();
-    common::Iota(ctx, p_row_indices, p_row_indices + row_indices.size(), base_rowid);
+    auto is_sampled = [&](bst_idx_t i) {
+      return gpair[i].GetGrad() != 0.0f || gpair[i].GetHess() != 0.0f;
+    };
+    auto n_threads = static_cast<bst_idx_t>(ctx->Threads());
+    bst_idx_t block_size = num_row / n_threads + !!(num_row % n_threads);
+    // Count the sampled rows per block, then scatter with the scanned offsets.  The
+    // compacted set keeps the original row order whatever the block size.
+    std::vector<std::size_t> offsets(n_threads + 1, 0);
+    common::ParallelFor(n_threads, n_threads, [&](auto tid) {
+      bst_idx_t begin = tid * block_size;
+      bst_idx_t end = std::min(num_row, begin + block_size);
+      std::size_t cnt{0};
+      for (bst_idx_t i = begin; i < end; ++i) {
+        cnt += is_sampled(i);
+      }
+      offsets[tid + 1] = cnt;
+    });
+    std::partial_sum(offsets.cbegin(), offsets.cend(), offsets.begin());
+    common::ParallelFor(n_threads, n_threads, [&](auto tid) {
+      bst_idx_t begin = tid * block_size;
+      bst_idx_t end = std::min(num_row, begin + block_size);
+      auto* out = row_indices.data() + offsets[tid];
+      for (bst_idx_t i = begin; i < end; ++i) {
+        if (is_sampled(i)) {
+          *out++ = static_cast<common::RowIndexT>(base_rowid + i);
+        }
+      }
+    });
+    row_indices.resize(offsets.back());
     row_set_collection_.Init();
 
     if (is_col_split_) {
@@ -185,9 +255,106 @@ class CommonRowPartitioner {
     }
   }
 
+  /**
+   * @brief Seed this partitioner from the tree it partitioned in the previous update.
+   *
+   *   Subsequent calls to @ref UpdatePosition compare each applied split against the
+   *   same node of @p prev_tree.  Children split their parent's contiguous row range
+   *   in place, so as long as the splits above a node match the previous tree exactly,
+   *   the row array permutation is unchanged and the child ranges recorded for the
+   *   previous tree are still exact.  Matching splits skip the row scan; consecutive
+   *   trees in a multi-class round frequently share their upper levels.  Reuse is
+   *   exact-match only, the resulting partition is identical to one built from
+   *   scratch.  Not supported with column-wise data splits.
+   */
+  void ReuseForTree(RegTree const* prev_tree) {
+    CHECK(!is_col_split_);
+    CHECK(prev_tree);
+    prev_tree_ = prev_tree;
+    reused_.clear();
+    // The root range always covers the same rows.
+    reused_.resize(1, true);
+    // Retire every node recorded for the previous tree; reused splits re-activate
+    // their children one level at a time, so entries below a diverging split cannot
+    // leak into the new tree's leaf partition.  The ranges themselves stay valid,
+    // @ref AddSplit keeps them when a node is split.
+    for (bst_node_t nidx = 0; nidx < static_cast<bst_node_t>(row_set_collection_.Size()); ++nidx) {
+      row_set_collection_[nidx].node_id = -1;
+    }
+    // Reconstitute the root as the active covering range for the histogram build, and
+    // in case the new tree keeps it as a leaf.
+    auto& row_indices = *row_set_collection_.Data();
+    row_set_collection_[RegTree::kRoot] = common::RowSetCollection::Elem{
+        row_indices.data(), row_indices.data() + row_indices.size(), RegTree::kRoot};
+  }
+
+  /**
+   * @brief Keep the recorded child row ranges for @p nidx if it carries the same split
+   *        as the previous tree, instead of scanning the rows.
+   */
+  [[nodiscard]] bool TryReuseSplit(bst_node_t nidx, RegTree const& tree) {
+    if (nidx >= static_cast<bst_node_t>(reused_.size()) || !reused_[nidx]) {
+      return false;
+    }
+    auto const& prev = *prev_tree_;
+    if (nidx >= prev.NumNodes() || prev.IsLeaf(nidx)) {
+      return false;
+    }
+    bst_node_t left = tree.LeftChild(nidx);
+    bst_node_t right = tree.RightChild(nidx);
+    if (prev.LeftChild(nidx) != left || prev.RightChild(nidx) != right ||
+        prev.SplitIndex(nidx) != tree.SplitIndex(nidx) ||
+        prev.SplitCond(nidx) != tree.SplitCond(nidx) ||
+        prev.DefaultLeft(nidx) != tree.DefaultLeft(nidx) ||
+        prev.NodeSplitType(nidx) != tree.NodeSplitType(nidx)) {
+      return false;
+    }
+    if (tree.NodeSplitType(nidx) == FeatureType::kCategorical) {
+      auto prev_cats = prev.NodeCats(nidx);
+      auto cats = tree.NodeCats(nidx);
+      if (prev_cats.size() != cats.size() ||
+          !std::equal(cats.cbegin(), cats.cend(), prev_cats.cbegin())) {
+        return false;
+      }
+    }
+    // The children keep their ranges and become candidates for further reuse.  Mirror
+    // the bookkeeping of AddSplit without the row scan: the node is retired, its
+    // children become the active nodes.
+    row_set_collection_[nidx].node_id = -1;
+    row_set_collection_[left].node_id = left;
+    row_set_collection_[right].node_id = right;
+    if (static_cast<bst_node_t>(reused_.size()) <= std::max(left, right)) {
+      reused_.resize(std::max(left, right) + 1, false);
+    }
+    reused_[left] = true;
+    reused_[right] = true;
+    return true;
+  }
+
   template <typename ExpandEntry>
   void UpdatePosition(Context const* ctx, GHistIndexMatrix const& gmat,
                       std::vector<ExpandEntry> const& nodes, RegTree const* p_tree) {
+    if (prev_tree_ != nullptr) {
+      // Splits matching the previous tree keep their child ranges, only the rest need
+      // a row scan.
+      std::vector<ExpandEntry> pending;
+      pending.reserve(nodes.size());
+      for (auto const& node : nodes) {
+        if (!this->TryReuseSplit(node.nid, *p_tree)) {
+          pending.push_back(node);
+        }
+      }
+      if (!pending.empty()) {
+        this->DispatchUpdatePosition(ctx, gmat, pending, p_tree);
+      }
+      return;
+    }
+    this->DispatchUpdatePosition(ctx, gmat, nodes, p_tree);
+  }
+
+  template <typename ExpandEntry>
+  void DispatchUpdatePosition(Context const* ctx, GHistIndexMatrix const& gmat,
+                              std::vector<ExpandEntry> const& nodes, RegTree const* p_tree) {
     auto const& column_matrix = gmat.Transpose();
     if (column_matrix.IsInitialized()) {
       if (gmat.cut.HasCategorical()) {
@@ -340,6 +507,10 @@ class CommonRowPartitioner {
   common::RowSetCollection row_set_collection_;
   bool is_col_split_;
   ColumnSplitHelper column_split_helper_;
+  // Tree from the previous update when reuse is enabled, together with per-node flags
+  // for whether the node's row range is known to match it.
+  RegTree const* prev_tree_{nullptr};
+  std::vector<bool> reused_;
 };
 
 }  // namespace xgboost::tree
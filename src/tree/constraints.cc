@@ -2,7 +2,8 @@
  * Copyright 2018-2019 by Contributors
  */
 #include <algorithm>
-#include <unordered_set>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "xgboost/span.h"
@@ -28,8 +29,6 @@ void FeatureInteractionConstraintHost::Reset() {
   if (!enabled_) {
     return;
   }
-  // Read std::vector<std::vector<bst_feature_t>> first and then
-  //   convert to std::vector<std::unordered_set<bst_feature_t>>
   std::vector<std::vector<bst_feature_t>> tmp;
   try {
     ParseInteractionConstraint(this->interaction_constraint_str_, &tmp);
@@ -38,66 +37,72 @@ void FeatureInteractionConstraintHost::Reset() {
                << this->interaction_constraint_str_ << "\n"
                << "With error:\n" << e.what();
   }
+  // Size the masks to cover both the features and the groups; feature IDs in the
+  // constraint string are not validated against the matrix shape.
+  bst_feature_t max_fid = n_features_;
   for (const auto& e : tmp) {
-    interaction_constraints_.emplace_back(e.begin(), e.end());
+    for (auto fid : e) {
+      max_fid = std::max(max_fid, static_cast<bst_feature_t>(fid + 1));
+    }
+  }
+  n_words_ = (max_fid + 63) / 64;
+
+  // Convert each group into a feature bit mask.
+  group_masks_.clear();
+  for (const auto& e : tmp) {
+    FeatureMask mask(n_words_, 0);
+    for (auto fid : e) {
+      mask[fid / 64] |= std::uint64_t{1} << (fid % 64);
+    }
+    group_masks_.emplace_back(std::move(mask));
   }
 
   // Initialise interaction constraints record with all variables permitted for the first node
-  node_constraints_.clear();
-  node_constraints_.resize(1, std::unordered_set<bst_feature_t>());
-  node_constraints_[0].reserve(n_features_);
+  allowed_masks_.clear();
+  allowed_masks_.resize(1, FeatureMask(n_words_, 0));
   for (bst_feature_t i = 0; i < n_features_; ++i) {
-    node_constraints_[0].insert(i);
+    allowed_masks_[0][i / 64] |= std::uint64_t{1} << (i % 64);
   }
 
   // Initialise splits record
-  splits_.clear();
-  splits_.resize(1, std::unordered_set<bst_feature_t>());
+  path_masks_.clear();
+  path_masks_.resize(1, FeatureMask(n_words_, 0));
 }
 
 void FeatureInteractionConstraintHost::SplitImpl(
     bst_node_t node_id, bst_feature_t feature_id, bst_node_t left_id, bst_node_t right_id) {
   bst_node_t newsize = std::max(left_id, right_id) + 1;
-
-  // Record previous splits for child nodes
-  auto feature_splits = splits_[node_id];  // fid history of current node
-  feature_splits.insert(feature_id);  // add feature of current node
-  splits_.resize(newsize);
-  splits_[left_id] = feature_splits;
-  splits_[right_id] = feature_splits;
-
-  // Resize constraints record, initialise all features to be not permitted for new nodes
   CHECK_NE(newsize, 0);
-  node_constraints_.resize(newsize, std::unordered_set<bst_feature_t>());
-
-  // Permit features used in previous splits
-  for (bst_feature_t fid : feature_splits) {
-    node_constraints_[left_id].insert(fid);
-    node_constraints_[right_id].insert(fid);
-  }
+  auto n_words = n_words_;
 
-  // Loop across specified interactions in constraints
-  for (const auto &constraint : interaction_constraints_) {
-    // flags whether the specified interaction is still relevant
-    bst_uint flag = 1;
+  // fid history of the child nodes: the current node's history plus its split feature.
+  FeatureMask path = path_masks_[node_id];
+  path[feature_id / 64] |= std::uint64_t{1} << (feature_id % 64);
 
-    // Test relevance of specified interaction by checking all previous
-    // features are included
-    for (bst_uint checkvar : feature_splits) {
-      if (constraint.count(checkvar) == 0) {
-        flag = 0;
-        break;   // interaction is not relevant due to unmet constraint
+  // Features used in previous splits are always permitted; a constraint group extends
+  // the permitted set iff every feature on the path belongs to it.
+  FeatureMask allowed = path;
+  for (auto const& group : group_masks_) {
+    bool relevant = true;
+    for (std::size_t i = 0; i < n_words; ++i) {
+      if (path[i] & ~group[i]) {
+        relevant = false;
+        break;
       }
     }
-
-    // If interaction is still relevant, permit all other features in the
-    // interaction
-    if (flag == 1) {
-      for (bst_uint k : constraint) {
-        node_constraints_[left_id].insert(k);
-        node_constraints_[right_id].insert(k);
+    if (relevant) {
+      for (std::size_t i = 0; i < n_words; ++i) {
+        allowed[i] |= group[i];
       }
     }
   }
+
+  path_masks_.resize(newsize, FeatureMask(n_words, 0));
+  path_masks_[left_id] = path;
+  path_masks_[right_id] = std::move(path);
+
+  allowed_masks_.resize(newsize, FeatureMask(n_words, 0));
+  allowed_masks_[left_id] = allowed;
+  allowed_masks_[right_id] = std::move(allowed);
 }
 }  // namespace xgboost
@@ -4,8 +4,9 @@
 #ifndef XGBOOST_TREE_CONSTRAINTS_H_
 #define XGBOOST_TREE_CONSTRAINTS_H_
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
-#include <unordered_set>
 #include <vector>
 
 #include "param.h"
@@ -15,24 +16,29 @@ namespace xgboost {
 /*!
  * \brief Feature interaction constraint implementation for CPU tree updaters.
  *
- * The interface is similar to the one for GPU Hist.
+ * The interface is similar to the one for GPU Hist.  Allowed features are kept as
+ * per-node bit masks updated incrementally on split, so the per-feature query inside the
+ * split evaluation loop is a single bit test.
  */
 class FeatureInteractionConstraintHost {
  protected:
-  // interaction_constraints_[constraint_id] contains a single interaction
-  //   constraint, which specifies a group of feature IDs that can interact
-  //   with each other
-  std::vector< std::unordered_set<bst_feature_t> > interaction_constraints_;
-  // int_cont_[nid] contains the set of all feature IDs that are allowed to
+  // a bit mask over features, one word per 64 features.
+  using FeatureMask = std::vector<std::uint64_t>;
+  // group_masks_[constraint_id] contains a single interaction constraint, which
+  //   specifies a group of feature IDs that can interact with each other
+  std::vector<FeatureMask> group_masks_;
+  // allowed_masks_[nid] contains the set of all feature IDs that are allowed to
   //   be used for a split at node nid
-  std::vector< std::unordered_set<bst_feature_t> > node_constraints_;
-  // splits_[nid] contains the set of all feature IDs that have been used for
+  std::vector<FeatureMask> allowed_masks_;
+  // path_masks_[nid] contains the set of all feature IDs that have been used for
   //   splits in node nid and its parents
-  std::vector< std::unordered_set<bst_feature_t> > splits_;
+  std::vector<FeatureMask> path_masks_;
   // string passed by user.
   std::string interaction_constraint_str_;
   // number of features in DMatrix/Booster
   bst_feature_t n_features_;
+  // number of words in each mask, covers both n_features_ and the constraint groups.
+  std::size_t n_words_{0};
   bool enabled_{false};
 
   void SplitImpl(int32_t node_id, bst_feature_t feature_id, bst_node_t left_id,
@@ -51,7 +57,12 @@ class FeatureInteractionConstraintHost {
 
   bool Query(bst_node_t nid, bst_feature_t fid) const {
     if (!enabled_) { return true; }
-    return node_constraints_.at(nid).find(fid) != node_constraints_.at(nid).cend();
+    auto const& mask = allowed_masks_.at(nid);
+    std::size_t w = fid / 64;
+    if (w >= mask.size()) {
+      return false;
+    }
+    return (mask[w] >> (fid % 64)) & 1;
   }
 
   void Reset();
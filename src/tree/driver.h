@@ -69,17 +69,35 @@ class Driver {
   // parallel or asynchronously
   std::vector<ExpandEntryT> Pop() {
     if (queue_.empty()) return {};
-    // Return a single entry for loss guided mode
     if (param_.grow_policy == TrainParam::kLossGuide) {
-      ExpandEntryT e = queue_.top();
-      queue_.pop();
+      // When the number of leaves is bounded, the pop order decides which candidates
+      // make it into the tree, so they must be expanded strictly one at a time.
+      if (param_.max_leaves > 0) {
+        ExpandEntryT e = queue_.top();
+        queue_.pop();
 
-      if (e.IsValid(param_, num_leaves_)) {
+        if (e.IsValid(param_, num_leaves_)) {
+          num_leaves_++;
+          return {e};
+        } else {
+          return {};
+        }
+      }
+      // Without the bound every valid candidate is expanded eventually regardless of
+      // the order, so candidates can be batched to expose parallelism in the histogram
+      // build.  Stop at the first invalid entry to keep the one-at-a-time stopping
+      // rule.
+      std::vector<ExpandEntryT> result;
+      while (!queue_.empty() && result.size() < max_node_batch_size_) {
+        ExpandEntryT e = queue_.top();
+        if (!e.IsValid(param_, num_leaves_)) {
+          break;
+        }
+        queue_.pop();
         num_leaves_++;
-        return {e};
-      } else {
-        return {};
+        result.emplace_back(e);
       }
+      return result;
     }
     // Return nodes on same level for depth wise
     std::vector<ExpandEntryT> result;
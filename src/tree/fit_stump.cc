@@ -5,7 +5,7 @@
  */
 #include "fit_stump.h"
 
-#include <cinttypes>  // std::int32_t
+#include <algorithm>  // std::max, std::min
 #include <cstddef>    // std::size_t
 
 #include "../collective/aggregator.h"
@@ -26,21 +26,30 @@ void FitStump(Context const* ctx, MetaInfo const& info,
               linalg::VectorView<float> out) {
   auto n_targets = out.Size();
   CHECK_EQ(n_targets, gpair.Shape(1));
-  linalg::Tensor<GradientPairPrecise, 2> sum_tloc =
-      linalg::Constant(ctx, GradientPairPrecise{}, ctx->Threads(), n_targets);
-  auto h_sum_tloc = sum_tloc.HostView();
   // first dim for gpair is samples, second dim is target.
-  // Reduce by column, parallel by samples
-  common::ParallelFor(gpair.Shape(0), ctx->Threads(), [&](auto i) {
-    for (bst_target_t t = 0; t < n_targets; ++t) {
-      h_sum_tloc(omp_get_thread_num(), t) += GradientPairPrecise{gpair(i, t)};
+  // Reduce by column, parallel over fixed-size sample blocks.  The block boundaries don't
+  // depend on the number of threads, so the base score is reproducible across nthread.
+  std::size_t constexpr kBlockSize = 1024;
+  auto n_samples = gpair.Shape(0);
+  std::size_t n_blocks = std::max(n_samples / kBlockSize + !!(n_samples % kBlockSize),
+                                  static_cast<std::size_t>(1));
+  linalg::Tensor<GradientPairPrecise, 2> sum_bloc =
+      linalg::Constant(ctx, GradientPairPrecise{}, n_blocks, n_targets);
+  auto h_sum_bloc = sum_bloc.HostView();
+  common::ParallelFor(n_blocks, ctx->Threads(), [&](auto b) {
+    std::size_t begin = b * kBlockSize;
+    std::size_t end = std::min(n_samples, begin + kBlockSize);
+    for (std::size_t i = begin; i < end; ++i) {
+      for (bst_target_t t = 0; t < n_targets; ++t) {
+        h_sum_bloc(b, t) += GradientPairPrecise{gpair(i, t)};
+      }
     }
   });
   // Aggregate to the first row.
-  auto h_sum = h_sum_tloc.Slice(0, linalg::All());
-  for (std::int32_t i = 1; i < ctx->Threads(); ++i) {
+  auto h_sum = h_sum_bloc.Slice(0, linalg::All());
+  for (std::size_t b = 1; b < n_blocks; ++b) {
     for (bst_target_t j = 0; j < n_targets; ++j) {
-      h_sum(j) += h_sum_tloc(i, j);
+      h_sum(j) += h_sum_bloc(b, j);
     }
   }
   CHECK(h_sum.CContiguous());
@@ -68,9 +68,10 @@ class GPUHistEvaluator {
   dh::CUDAStream copy_stream_;
   // storage for sorted index of feature histogram, used for sort based splits.
   dh::device_vector<bst_feature_t> cat_sorted_idx_;
-  // cached input for sorting the histogram, used for sort based splits.
-  using SortPair = thrust::tuple<uint32_t, float>;
-  dh::device_vector<SortPair> sort_input_;
+  // cached sort keys (categorical bin weights), used for sort based splits.
+  dh::device_vector<float> sort_input_;
+  // segment boundaries of each (node, feature) histogram for the batched argsort.
+  dh::device_vector<std::uint32_t> sort_seg_ptr_;
   // cache for feature index
   dh::device_vector<bst_feature_t> feature_idx_;
   // Training param used for evaluation
@@ -126,7 +127,7 @@ class GPUHistEvaluator {
   }
 
   auto SortInput(int num_nodes, bst_feature_t total_bins) {
-    if(!need_sort_histogram_) return common::Span<SortPair>();
+    if(!need_sort_histogram_) return common::Span<float>();
     sort_input_.resize(num_nodes * total_bins);
     return dh::ToSpan(sort_input_);
   }
@@ -178,13 +179,14 @@ class GPUHistEvaluator {
   /**
    * \brief Sort the histogram based on output to obtain contiguous partitions.
    */
-  common::Span<bst_feature_t const> SortHistogram(common::Span<const EvaluateSplitInputs> d_inputs,
+  common::Span<bst_feature_t const> SortHistogram(
+      Context const *ctx, common::Span<const EvaluateSplitInputs> d_inputs,
       EvaluateSplitSharedInputs shared_inputs,
       TreeEvaluator::SplitEvaluator<GPUTrainingParam> evaluator);
 
   // impl of evaluate splits, contains CUDA kernels so it's public
   void LaunchEvaluateSplits(
-      bst_feature_t max_active_features,
+      Context const *ctx, bst_feature_t max_active_features,
       common::Span<const EvaluateSplitInputs> d_inputs,
       EvaluateSplitSharedInputs shared_inputs,
       TreeEvaluator::SplitEvaluator<GPUTrainingParam> evaluator,
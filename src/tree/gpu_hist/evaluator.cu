@@ -4,9 +4,10 @@
  * \brief Some components of GPU Hist evaluator, this file only exist to reduce nvcc
  *        compilation time.
  */
-#include <thrust/logical.h>  // thrust::any_of
-#include <thrust/sort.h>     // thrust::stable_sort
+#include <thrust/logical.h>    // thrust::any_of
+#include <thrust/transform.h>  // thrust::transform
 
+#include "../../common/algorithm.cuh"     // for SegmentedArgSort
 #include "../../common/cuda_context.cuh"  // for CUDAContext
 #include "../../common/device_helpers.cuh"
 #include "../../common/hist_util.h"  // common::HistogramCuts
@@ -66,16 +67,18 @@ void GPUHistEvaluator::Reset(Context const *ctx, common::HistogramCuts const &cu
 }
 
 common::Span<bst_feature_t const> GPUHistEvaluator::SortHistogram(
-    common::Span<const EvaluateSplitInputs> d_inputs, EvaluateSplitSharedInputs shared_inputs,
+    Context const *ctx, common::Span<const EvaluateSplitInputs> d_inputs,
+    EvaluateSplitSharedInputs shared_inputs,
     TreeEvaluator::SplitEvaluator<GPUTrainingParam> evaluator) {
-  dh::XGBCachingDeviceAllocator<char> alloc;
+  auto const *cuctx = ctx->CUDACtx();
   auto sorted_idx = this->SortedIdx(d_inputs.size(), shared_inputs.feature_values.size());
-  dh::Iota(sorted_idx, dh::DefaultStream());
   auto data = this->SortInput(d_inputs.size(), shared_inputs.feature_values.size());
   auto it = thrust::make_counting_iterator(0u);
   auto d_feature_idx = dh::ToSpan(feature_idx_);
   auto total_bins = shared_inputs.feature_values.size();
-  thrust::transform(thrust::cuda::par(alloc), it, it + data.size(), dh::tbegin(data),
+  // Sort keys, the weight of each categorical bin.  Numerical bins share a constant key
+  // and keep their original order as the radix sort is stable.
+  thrust::transform(cuctx->CTP(), it, it + data.size(), dh::tbegin(data),
                     [=] XGBOOST_DEVICE(uint32_t i) {
                       auto const &input = d_inputs[i / total_bins];
                       auto j = i % total_bins;
@@ -83,45 +86,25 @@ common::Span<bst_feature_t const> GPUHistEvaluator::SortHistogram(
                       if (common::IsCat(shared_inputs.feature_types, fidx)) {
                         auto grad =
                             shared_inputs.rounding.ToFloatingPoint(input.gradient_histogram[j]);
-                        auto lw = evaluator.CalcWeightCat(shared_inputs.param, grad);
-                        return thrust::make_tuple(i, lw);
+                        return evaluator.CalcWeightCat(shared_inputs.param, grad);
                       }
-                      return thrust::make_tuple(i, 0.0f);
+                      return 0.0f;
                     });
-  // Sort an array segmented according to
-  // - nodes
-  // - features within each node
-  // - gradients within each feature
-  thrust::stable_sort_by_key(thrust::cuda::par(alloc), dh::tbegin(data), dh::tend(data),
-                             dh::tbegin(sorted_idx),
-                             [=] XGBOOST_DEVICE(SortPair const &l, SortPair const &r) {
-                               auto li = thrust::get<0>(l);
-                               auto ri = thrust::get<0>(r);
-
-                               auto l_node = li / total_bins;
-                               auto r_node = ri / total_bins;
-
-                               if (l_node != r_node) {
-                                 return l_node < r_node;  // not the same node
-                               }
-
-                               li = li % total_bins;
-                               ri = ri % total_bins;
-
-                               auto lfidx = d_feature_idx[li];
-                               auto rfidx = d_feature_idx[ri];
-
-                               if (lfidx != rfidx) {
-                                 return lfidx < rfidx;  // not the same feature
-                               }
-
-                               if (common::IsCat(shared_inputs.feature_types, lfidx)) {
-                                 auto lw = thrust::get<1>(l);
-                                 auto rw = thrust::get<1>(r);
-                                 return lw < rw;
-                               }
-                               return li < ri;
-                             });
+  // One segment per (node, feature) histogram.  All segments are sorted by a single
+  // batched radix sort instead of one comparison sort over the combined array, which
+  // serializes on high-cardinality categorical features.
+  auto n_features = shared_inputs.Features();
+  std::size_t n_segments = d_inputs.size() * n_features;
+  sort_seg_ptr_.resize(n_segments + 1);
+  auto d_seg_ptr = dh::ToSpan(sort_seg_ptr_);
+  auto d_feature_segments = shared_inputs.feature_segments;
+  dh::LaunchN(d_seg_ptr.size(), cuctx->Stream(), [=] __device__(std::size_t i) {
+    auto node = i / n_features;
+    auto fidx = i % n_features;
+    // The first cut pointer is 0, so the closing boundary comes out as the total size.
+    d_seg_ptr[i] = static_cast<std::uint32_t>(node * total_bins + d_feature_segments[fidx]);
+  });
+  common::SegmentedArgSort<true, false>(ctx, data, d_seg_ptr, sorted_idx);
   return dh::ToSpan(cat_sorted_idx_);
 }
 }  // namespace xgboost::tree
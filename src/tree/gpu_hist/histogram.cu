@@ -33,11 +33,11 @@ XGBOOST_DEV_INLINE bst_feature_t FeatIdx(FeatureGroup const& group, bst_idx_t id
 XGBOOST_DEV_INLINE bst_idx_t IterIdx(EllpackDeviceAccessor const& matrix,
                                      RowPartitioner::RowIndexT ridx, bst_feature_t fidx) {
   // ridx_local = ridx - base_rowid  <== Row index local to each batch
-  // entry_idx = ridx_local * row_stride <== Starting entry index for this row in the matrix
-  // entry_idx += start_feature  <== Inside a row, first column inside this feature group
-  // idx % feature_stride <== The feaature index local to the current feature group
-  // entry_idx += idx % feature_stride <== Final index.
-  return (ridx - matrix.base_rowid) * matrix.row_stride + fidx;
+  // The accessor maps (ridx_local, fidx) to the physical element index: row-major by
+  // default, feature-major within row tiles when the tiled layout is in use.  With the
+  // tiled layout, threads scanning a feature over consecutive rows read consecutive
+  // symbols.
+  return matrix.EntryIdx(ridx - matrix.base_rowid, fidx);
 }
 }  // anonymous namespace
 
@@ -138,7 +138,28 @@ XGBOOST_DEV_INLINE void AtomicAddGpairGlobal(xgboost::GradientPairInt64* dest,
             *reinterpret_cast<uint64_t*>(&h));
 }
 
-template <bool kCompressed, int kBlockThreads, int kItemsPerThread>
+// Groups the lanes of a warp by an equal key, returning the mask of lanes that hold the
+// same value as the caller.  All 32 lanes must be converged.
+XGBOOST_DEV_INLINE std::uint32_t MatchAny(bst_bin_t value) {
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 700
+  return __match_any_sync(0xffffffffu, value);
+#else
+  // Pre-Volta has no match instruction, reconstruct the groups with one ballot per lane.
+  std::uint32_t const lane = threadIdx.x % 32;
+  std::uint32_t peers = 0;
+  for (std::int32_t src = 0; src < 32; ++src) {
+    auto const other = __shfl_sync(0xffffffffu, value, src);
+    auto const vote = __ballot_sync(0xffffffffu, other == value);
+    if (src == static_cast<std::int32_t>(lane)) {
+      peers = vote;
+    }
+  }
+  return peers;
+#endif  // defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 700
+}
+
+template <bool kCompressed, bool kNarrow, int kBlockThreads, int kItemsPerThread,
+          bool kAgg = false>
 class HistogramAgent {
   int constexpr static kItemsPerTile = kBlockThreads * kItemsPerThread;
 
@@ -169,6 +190,60 @@ class HistogramAgent {
         rounding_{rounding},
         d_gpair_{d_gpair} {}
 
+  /**
+   * Shared memory add for the reduced-precision mode.  Each bin holds one 32-bit counter
+   * per component at 1/2^32 of the fixed-point scale.  Truncating towards zero bounds the
+   * absolute sum of the narrowed values by 2^30 (the quantiser budgets 2^62 for the full
+   * reduction), so a block-local partial sum cannot wrap; the wrap check guards the
+   * invariant nonetheless.
+   */
+  __device__ void AtomicAddGpairNarrow(bst_bin_t local_bin, GradientPairInt64 const& gpair) {
+    auto* bin = reinterpret_cast<std::int32_t*>(smem_arr_) + static_cast<std::size_t>(local_bin) * 2;
+    auto add = [](std::int32_t* dst, std::int64_t v) {
+      auto narrow = static_cast<std::int32_t>(v / (std::int64_t{1} << 32));
+      std::int32_t const old = atomicAdd(dst, narrow);
+      std::int32_t const res = old + narrow;
+      KERNEL_CHECK(((old ^ res) & (narrow ^ res)) >= 0);
+    };
+    add(bin, gpair.GetQuantisedGrad());
+    add(bin + 1, gpair.GetQuantisedHess());
+  }
+
+  __device__ void AtomicAddToBin(bst_bin_t local_bin, GradientPairInt64 const& gpair) {
+    if (kNarrow) {
+      this->AtomicAddGpairNarrow(local_bin, gpair);
+    } else {
+      AtomicAddGpairShared(smem_arr_ + local_bin, gpair);
+    }
+  }
+
+  /**
+   * Warp-aggregated shared memory add.  Lanes whose items fall into the same bin are
+   * grouped with a match vote; each group reduces its quantised gradients through
+   * shuffles and its leader issues a single atomic, so a bin shared by the whole warp
+   * costs one atomic instead of 32 serialized ones.  Fixed-point addition is
+   * associative, so the result is bit-identical to the plain kernel.  All 32 lanes must
+   * call in; items without a bin pass -1 and join a discarded group.
+   */
+  __device__ void AtomicAddToBinAggregated(bst_bin_t local_bin, GradientPairInt64 const& gpair) {
+    std::uint32_t const lane = threadIdx.x % 32;
+    std::uint32_t const peers = MatchAny(local_bin);
+    auto const g = gpair.GetQuantisedGrad();
+    auto const h = gpair.GetQuantisedHess();
+    std::int64_t sum_g = 0;
+    std::int64_t sum_h = 0;
+    // Every member walks the same lane set, so the shuffles stay converged within the
+    // group and each member ends up with the group total.
+    for (std::uint32_t rest = peers; rest != 0; rest &= rest - 1) {
+      std::int32_t const src = __ffs(rest) - 1;
+      sum_g += __shfl_sync(peers, g, src);
+      sum_h += __shfl_sync(peers, h, src);
+    }
+    if (local_bin >= 0 && lane == static_cast<std::uint32_t>(__ffs(peers) - 1)) {
+      this->AtomicAddToBin(local_bin, GradientPairInt64{sum_g, sum_h});
+    }
+  }
+
   __device__ void ProcessPartialTileShared(std::size_t offset) {
     for (std::size_t idx = offset + threadIdx.x,
                      n = std::min(offset + kBlockThreads * kItemsPerTile, n_elements_);
@@ -185,7 +260,7 @@ class HistogramAgent {
         auto adjusted = rounding_.ToFixedPoint(d_gpair_[ridx]);
         // Subtract start_bin to write to group-local histogram. If this is not a dense
         // matrix, then start_bin is 0 since featuregrouping doesn't support sparse data.
-        AtomicAddGpairShared(smem_arr_ + compressed_bin - group_.start_bin, adjusted);
+        this->AtomicAddToBin(compressed_bin - group_.start_bin, adjusted);
       }
     }
   }
@@ -221,15 +296,24 @@ class HistogramAgent {
     }
 #pragma unroll
     for (int i = 0; i < kItemsPerThread; i++) {
-      // Avoid atomic add if it's a null value.
-      if (gidx[i] != -1) {
+      if (kAgg) {
+        // Keep the warp converged for the match vote, missing items join the discarded
+        // group.
+        this->AtomicAddToBinAggregated(gidx[i] == -1 ? -1 : gidx[i] - group_.start_bin,
+                                       rounding_.ToFixedPoint(gpair[i]));
+      } else if (gidx[i] != -1) {
+        // Avoid atomic add if it's a null value.
         auto adjusted = rounding_.ToFixedPoint(gpair[i]);
-        AtomicAddGpairShared(smem_arr_ + gidx[i] - group_.start_bin, adjusted);
+        this->AtomicAddToBin(gidx[i] - group_.start_bin, adjusted);
       }
     }
   }
   __device__ void BuildHistogramWithShared() {
-    dh::BlockFill(smem_arr_, group_.num_bins, GradientPairInt64{});
+    if (kNarrow) {
+      dh::BlockFill(reinterpret_cast<std::int32_t*>(smem_arr_), group_.num_bins * 2, 0);
+    } else {
+      dh::BlockFill(smem_arr_, group_.num_bins, GradientPairInt64{});
+    }
     __syncthreads();
 
     std::size_t offset = blockIdx.x * kItemsPerTile;
@@ -241,8 +325,19 @@ class HistogramAgent {
 
     // Write shared memory back to global memory
     __syncthreads();
-    for (auto i : dh::BlockStrideRange(0, group_.num_bins)) {
-      AtomicAddGpairGlobal(d_node_hist_ + group_.start_bin + i, smem_arr_[i]);
+    if (kNarrow) {
+      // Widen the block totals back to the fixed-point scale of the global histogram.
+      auto const* narrow = reinterpret_cast<std::int32_t const*>(smem_arr_);
+      for (auto i : dh::BlockStrideRange(0, group_.num_bins)) {
+        auto widened =
+            GradientPairInt64{static_cast<std::int64_t>(narrow[i * 2]) * (std::int64_t{1} << 32),
+                              static_cast<std::int64_t>(narrow[i * 2 + 1]) * (std::int64_t{1} << 32)};
+        AtomicAddGpairGlobal(d_node_hist_ + group_.start_bin + i, widened);
+      }
+    } else {
+      for (auto i : dh::BlockStrideRange(0, group_.num_bins)) {
+        AtomicAddGpairGlobal(d_node_hist_ + group_.start_bin + i, smem_arr_[i]);
+      }
     }
   }
 
@@ -262,7 +357,8 @@ class HistogramAgent {
   }
 };
 
-template <bool kIsDense, bool use_shared_memory_histograms, int kBlockThreads, int kItemsPerThread>
+template <bool kIsDense, bool use_shared_memory_histograms, int kBlockThreads, int kItemsPerThread,
+          bool kNarrow = false, bool kAgg = false>
 __global__ void __launch_bounds__(kBlockThreads)
     SharedMemHistKernel(const EllpackDeviceAccessor matrix,
                         const FeatureGroupsAccessor feature_groups,
@@ -273,7 +369,7 @@ __global__ void __launch_bounds__(kBlockThreads)
   extern __shared__ char smem[];
   const FeatureGroup group = feature_groups[blockIdx.y];
   auto smem_arr = reinterpret_cast<GradientPairInt64*>(smem);
-  auto agent = HistogramAgent<kIsDense, kBlockThreads, kItemsPerThread>(
+  auto agent = HistogramAgent<kIsDense, kNarrow, kBlockThreads, kItemsPerThread, kAgg>(
       smem_arr, d_node_hist, group, matrix, d_ridx, rounding, d_gpair);
   if (use_shared_memory_histograms) {
     agent.BuildHistogramWithShared();
@@ -286,6 +382,82 @@ namespace {
 constexpr std::int32_t kBlockThreads = 1024;
 constexpr std::int32_t kItemsPerThread = 8;
 constexpr std::int32_t ItemsPerTile() { return kBlockThreads * kItemsPerThread; }
+
+// Number of sampled matrix elements per feature group when measuring the bin-collision
+// rate.
+constexpr bst_idx_t kCollisionSample = static_cast<bst_idx_t>(1) << 14;
+
+// Measures the warp-level bin-collision rate on a sample of the matrix.  Each lane loads
+// one compressed bin with the same indexing as the histogram agent and the leaders of
+// the match groups are counted: counts[0] / counts[1] is the mean number of lanes
+// sharing a bin within a warp.
+template <bool kCompressed>
+__global__ void BinCollisionKernel(EllpackDeviceAccessor matrix,
+                                   FeatureGroupsAccessor feature_groups,
+                                   common::Span<const RowPartitioner::RowIndexT> d_ridx,
+                                   std::uint32_t* counts) {
+  FeatureGroup const group = feature_groups[blockIdx.y];
+  int const feature_stride = kCompressed ? group.num_features : matrix.row_stride;
+  bst_idx_t const n =
+      std::min(static_cast<bst_idx_t>(feature_stride) * d_ridx.size(), kCollisionSample);
+  std::uint32_t const lane = threadIdx.x % 32;
+  std::uint32_t valid = 0;
+  std::uint32_t distinct = 0;
+  // The loop bound is uniform across the block so that every warp stays converged for
+  // the match vote; out-of-range and missing lanes join the discarded -1 group.
+  for (bst_idx_t base = 0; base < n; base += blockDim.x) {
+    bst_idx_t const idx = base + threadIdx.x;
+    bst_bin_t bin = -1;
+    if (idx < n) {
+      auto ridx = d_ridx[idx / feature_stride];
+      auto fidx = FeatIdx(group, idx, feature_stride);
+      bin = matrix.gidx_iter[IterIdx(matrix, ridx, fidx)];
+      if (bin != matrix.NullValue()) {
+        if (kCompressed) {
+          bin += matrix.feature_segments[fidx];
+        }
+      } else {
+        bin = -1;
+      }
+    }
+    auto const peers = MatchAny(bin);
+    if (bin >= 0) {
+      valid += 1;
+      distinct += lane == static_cast<std::uint32_t>(__ffs(peers) - 1);
+    }
+  }
+  if (valid != 0) {
+    atomicAdd(counts, valid);
+  }
+  if (distinct != 0) {
+    atomicAdd(counts + 1, distinct);
+  }
+}
+
+// Samples the warp-level bin-collision rate of the current partition.  Warp aggregation
+// pays for its shuffle overhead once two or more lanes of a warp hit the same bin on
+// average, as happens with heavy-hitter categories or few, highly populated bins.
+bool ShouldAggregate(EllpackDeviceAccessor const& matrix,
+                     FeatureGroupsAccessor const& feature_groups,
+                     common::Span<const RowPartitioner::RowIndexT> d_ridx,
+                     dh::CUDAStreamView stream) {
+  dh::TemporaryArray<std::uint32_t> counts(2);
+  auto* d_counts = counts.data().get();
+  dh::safe_cuda(cudaMemsetAsync(d_counts, 0, counts.size() * sizeof(std::uint32_t), stream));
+  auto grid = dim3(1, feature_groups.NumGroups());
+  if (matrix.IsDenseCompressed()) {
+    dh::LaunchKernel{grid, static_cast<std::uint32_t>(kBlockThreads), 0, stream}(
+        BinCollisionKernel<true>, matrix, feature_groups, d_ridx, d_counts);
+  } else {
+    dh::LaunchKernel{grid, static_cast<std::uint32_t>(kBlockThreads), 0, stream}(
+        BinCollisionKernel<false>, matrix, feature_groups, d_ridx, d_counts);
+  }
+  std::uint32_t h_counts[2];
+  dh::safe_cuda(
+      cudaMemcpyAsync(h_counts, d_counts, sizeof(h_counts), cudaMemcpyDeviceToHost, stream));
+  stream.Sync();
+  return h_counts[1] != 0 && h_counts[0] >= 2 * h_counts[1];
+}
 }  // namespace
 
 // Use auto deduction guide to workaround compiler error.
@@ -304,14 +476,31 @@ struct HistogramKernel {
       SharedMemHistKernel<true, true, kBlockThreads, kItemsPerThread>};
   // Kernel for working with sparse Ellpack using the shared memory.
   decltype(Shared) shared_kernel{SharedMemHistKernel<false, true, kBlockThreads, kItemsPerThread>};
+  // Reduced-precision variants with one 32-bit integer per gradient component in the
+  // shared memory bins.
+  decltype(Shared) narrow_dense_kernel{
+      SharedMemHistKernel<true, true, kBlockThreads, kItemsPerThread, true>};
+  decltype(Shared) narrow_kernel{
+      SharedMemHistKernel<false, true, kBlockThreads, kItemsPerThread, true>};
+  // Warp-aggregated variants for data where many lanes of a warp share a bin.
+  decltype(Shared) agg_dense_kernel{
+      SharedMemHistKernel<true, true, kBlockThreads, kItemsPerThread, false, true>};
+  decltype(Shared) agg_kernel{
+      SharedMemHistKernel<false, true, kBlockThreads, kItemsPerThread, false, true>};
 
   bool shared{false};
+  bool narrow{false};
+  // Whether to use the warp-aggregated shared memory kernels.  -1 until the
+  // bin-collision rate of the first build has been sampled.
+  std::int8_t aggregate{-1};
   std::uint32_t grid_size{0};
+  std::uint32_t narrow_grid_size{0};
   std::size_t smem_size{0};
+  std::size_t narrow_smem_size{0};
   bool const force_global;
 
   HistogramKernel(Context const* ctx, FeatureGroupsAccessor const& feature_groups,
-                  bool force_global_memory)
+                  bool force_global_memory, bool narrow_hist)
       : force_global{force_global_memory} {
     // Decide whether to use shared memory
     // Opt into maximum shared memory for the kernel if necessary
@@ -321,28 +510,40 @@ struct HistogramKernel {
     this->shared = !force_global_memory && this->smem_size <= max_shared_memory;
     this->smem_size = this->shared ? this->smem_size : 0;
 
-    auto init = [&](auto& kernel) {
-      if (this->shared) {
+    // Half-width bins need half the shared memory, so the narrow kernels may fit where
+    // the full-width ones do not, and more blocks fit per SM where both do.
+    this->narrow_smem_size = sizeof(GradientPairInt64) / 2 * feature_groups.max_group_bins;
+    this->narrow =
+        narrow_hist && !force_global_memory && this->narrow_smem_size <= max_shared_memory;
+    this->narrow_smem_size = this->narrow ? this->narrow_smem_size : 0;
+
+    auto init = [&](auto& kernel, std::size_t smem_size, std::uint32_t* grid_size) {
+      if (smem_size != 0) {
         dh::safe_cuda(cudaFuncSetAttribute(kernel, cudaFuncAttributeMaxDynamicSharedMemorySize,
                                            max_shared_memory));
       }
 
       // determine the launch configuration
-      std::int32_t num_groups = feature_groups.NumGroups();
       std::int32_t n_mps = 0;
       dh::safe_cuda(cudaDeviceGetAttribute(&n_mps, cudaDevAttrMultiProcessorCount, ctx->Ordinal()));
 
       std::int32_t n_blocks_per_mp = 0;
       dh::safe_cuda(cudaOccupancyMaxActiveBlocksPerMultiprocessor(&n_blocks_per_mp, kernel,
-                                                                  kBlockThreads, this->smem_size));
+                                                                  kBlockThreads, smem_size));
 
       // This gives the number of blocks to keep the device occupied Use this as the
       // maximum number of blocks
-      this->grid_size = n_blocks_per_mp * n_mps;
+      *grid_size = n_blocks_per_mp * n_mps;
     };
     // Initialize all kernel instantiations
-    for (auto& kernel : {global_dense_kernel, global_kernel, shared_dense_kernel, shared_kernel}) {
-      init(kernel);
+    for (auto& kernel : {global_dense_kernel, global_kernel, shared_dense_kernel, shared_kernel,
+                         agg_dense_kernel, agg_kernel}) {
+      init(kernel, this->smem_size, &this->grid_size);
+    }
+    if (this->narrow) {
+      for (auto& kernel : {narrow_dense_kernel, narrow_kernel}) {
+        init(kernel, this->narrow_smem_size, &this->narrow_grid_size);
+      }
     }
   }
 };
@@ -352,18 +553,21 @@ class DeviceHistogramBuilderImpl {
 
  public:
   void Reset(Context const* ctx, FeatureGroupsAccessor const& feature_groups,
-             bool force_global_memory) {
-    this->kernel_ = std::make_unique<HistogramKernel<>>(ctx, feature_groups, force_global_memory);
+             bool force_global_memory, bool narrow_hist) {
+    this->kernel_ =
+        std::make_unique<HistogramKernel<>>(ctx, feature_groups, force_global_memory, narrow_hist);
     if (force_global_memory) {
       CHECK(!this->kernel_->shared);
+      CHECK(!this->kernel_->narrow);
     }
   }
 
-  void BuildHistogram(CUDAContext const* ctx, EllpackDeviceAccessor const& matrix,
+  void BuildHistogram(CUDAContext const* /*ctx*/, EllpackDeviceAccessor const& matrix,
                       FeatureGroupsAccessor const& feature_groups,
                       common::Span<GradientPair const> gpair,
                       common::Span<const cuda_impl::RowIndexT> d_ridx,
-                      common::Span<GradientPairInt64> histogram, GradientQuantiser rounding) const {
+                      common::Span<GradientPairInt64> histogram, GradientQuantiser rounding,
+                      dh::CUDAStreamView stream) const {
     CHECK(kernel_);
     // Otherwise launch blocks such that each block has a minimum amount of work to do
     // There are fixed costs to launching each block, e.g. zeroing shared memory
@@ -375,29 +579,47 @@ class DeviceHistogramBuilderImpl {
     // Allocate number of blocks such that each block has about kMinItemsPerBlock work
     // Up to a maximum where the device is saturated
     auto constexpr kMinItemsPerBlock = ItemsPerTile();
-    auto grid_size = std::min(kernel_->grid_size, static_cast<std::uint32_t>(common::DivRoundUp(
-                                                      items_per_group, kMinItemsPerBlock)));
-    auto launcher = [&](auto kernel) {
+    auto launcher = [&](auto kernel, std::uint32_t max_grid_size, std::size_t smem_size) {
+      auto grid_size = std::min(max_grid_size, static_cast<std::uint32_t>(common::DivRoundUp(
+                                                   items_per_group, kMinItemsPerBlock)));
       dh::LaunchKernel{dim3(grid_size, feature_groups.NumGroups()),  // NOLINT
-                       static_cast<uint32_t>(kBlockThreads), kernel_->smem_size, ctx->Stream()}(
+                       static_cast<uint32_t>(kBlockThreads), smem_size, stream}(
           kernel, matrix, feature_groups, d_ridx, histogram.data(), gpair.data(), rounding);
     };
 
-    if (!this->kernel_->shared) {  // Use global memory
+    if (this->kernel_->narrow) {  // Reduced-precision shared memory accumulation.
+      CHECK_NE(this->kernel_->narrow_smem_size, 0);
+      if (matrix.IsDenseCompressed()) {
+        launcher(this->kernel_->narrow_dense_kernel, this->kernel_->narrow_grid_size,
+                 this->kernel_->narrow_smem_size);
+      } else {
+        launcher(this->kernel_->narrow_kernel, this->kernel_->narrow_grid_size,
+                 this->kernel_->narrow_smem_size);
+      }
+    } else if (!this->kernel_->shared) {  // Use global memory
       CHECK_EQ(this->kernel_->smem_size, 0);
       if (matrix.IsDenseCompressed()) {
         // Dense must use shared memory except for testing.
         CHECK(this->kernel_->force_global);
-        launcher(this->kernel_->global_dense_kernel);
+        launcher(this->kernel_->global_dense_kernel, this->kernel_->grid_size,
+                 this->kernel_->smem_size);
       } else {
-        launcher(this->kernel_->global_kernel);
+        launcher(this->kernel_->global_kernel, this->kernel_->grid_size, this->kernel_->smem_size);
       }
     } else {  // Use shared memory
       CHECK_NE(this->kernel_->smem_size, 0);
+      if (this->kernel_->aggregate < 0) {
+        // First build, sample the bin-collision rate to pick the accumulation scheme.
+        // Both schemes produce bit-identical histograms.
+        this->kernel_->aggregate = ShouldAggregate(matrix, feature_groups, d_ridx, stream) ? 1 : 0;
+      }
+      bool const agg = this->kernel_->aggregate == 1;
       if (matrix.IsDenseCompressed()) {
-        launcher(this->kernel_->shared_dense_kernel);
+        launcher(agg ? this->kernel_->agg_dense_kernel : this->kernel_->shared_dense_kernel,
+                 this->kernel_->grid_size, this->kernel_->smem_size);
       } else {
-        launcher(this->kernel_->shared_kernel);
+        launcher(agg ? this->kernel_->agg_kernel : this->kernel_->shared_kernel,
+                 this->kernel_->grid_size, this->kernel_->smem_size);
       }
     }
   }
@@ -412,9 +634,10 @@ DeviceHistogramBuilder::~DeviceHistogramBuilder() = default;
 
 void DeviceHistogramBuilder::Reset(Context const* ctx, std::size_t max_cached_hist_nodes,
                                    FeatureGroupsAccessor const& feature_groups,
-                                   bst_bin_t n_total_bins, bool force_global_memory) {
+                                   bst_bin_t n_total_bins, bool force_global_memory,
+                                   bool narrow_hist) {
   this->monitor_.Start(__func__);
-  this->p_impl_->Reset(ctx, feature_groups, force_global_memory);
+  this->p_impl_->Reset(ctx, feature_groups, force_global_memory, narrow_hist);
   this->hist_.Reset(ctx, n_total_bins, max_cached_hist_nodes);
   this->monitor_.Stop(__func__);
 }
@@ -425,9 +648,11 @@ void DeviceHistogramBuilder::BuildHistogram(CUDAContext const* ctx,
                                             common::Span<GradientPair const> gpair,
                                             common::Span<const cuda_impl::RowIndexT> ridx,
                                             common::Span<GradientPairInt64> histogram,
-                                            GradientQuantiser rounding) {
+                                            GradientQuantiser rounding,
+                                            dh::CUDAStreamView stream) {
   this->monitor_.Start(__func__);
-  this->p_impl_->BuildHistogram(ctx, matrix, feature_groups, gpair, ridx, histogram, rounding);
+  this->p_impl_->BuildHistogram(ctx, matrix, feature_groups, gpair, ridx, histogram, rounding,
+                                stream);
   this->monitor_.Stop(__func__);
 }
 
@@ -39,6 +39,13 @@ XGBOOST_DEV_INLINE void AtomicAdd64As32(int64_t* dst, int64_t src) {
 namespace cuda_impl {
 // Start with about 16mb
 std::size_t constexpr DftReserveSize() { return 1 << 22; }
+
+// Pointer triple for deriving a sibling histogram from its parent and built sibling.
+struct HistSubtractionArgs {
+  GradientPairInt64 const* parent;
+  GradientPairInt64 const* built;
+  GradientPairInt64* sibling;
+};
 }  // namespace cuda_impl
 
 /**
@@ -155,14 +162,20 @@ class DeviceHistogramBuilder {
   explicit DeviceHistogramBuilder();
   ~DeviceHistogramBuilder();
 
+  /**
+   * @param narrow_hist Accumulate shared memory bins with one 32-bit integer per gradient
+   *                    component instead of 64.  Halves the shared memory footprint at the
+   *                    cost of roughly 30 effective bits of fixed-point precision.
+   */
   void Reset(Context const* ctx, std::size_t max_cached_hist_nodes,
              FeatureGroupsAccessor const& feature_groups, bst_bin_t n_total_bins,
-             bool force_global_memory);
+             bool force_global_memory, bool narrow_hist = false);
   void BuildHistogram(CUDAContext const* ctx, EllpackDeviceAccessor const& matrix,
                       FeatureGroupsAccessor const& feature_groups,
                       common::Span<GradientPair const> gpair,
                       common::Span<const std::uint32_t> ridx,
-                      common::Span<GradientPairInt64> histogram, GradientQuantiser rounding);
+                      common::Span<GradientPairInt64> histogram, GradientQuantiser rounding,
+                      dh::CUDAStreamView stream = dh::DefaultStream());
 
   [[nodiscard]] auto GetNodeHistogram(bst_node_t nidx) { return hist_.GetNodeHistogram(nidx); }
 
@@ -192,14 +205,36 @@ class DeviceHistogramBuilder {
                                   std::vector<bst_node_t> const& subtraction_nidx) {
     this->monitor_.Start(__func__);
     std::vector<bst_node_t> need_build;
+    // Pointer triples for the nodes whose sibling can be derived.  The whole batch is
+    // subtracted in a single launch, the per-node kernels are too small to fill the
+    // device deep in the tree.
+    std::vector<cuda_impl::HistSubtractionArgs> h_args;
     for (std::size_t i = 0; i < subtraction_nidx.size(); i++) {
       auto build_hist_nidx = build_nidx.at(i);
       auto subtraction_trick_nidx = subtraction_nidx.at(i);
       auto parent_nidx = candidates.at(i).nid;
 
-      if (!this->SubtractionTrick(ctx, parent_nidx, build_hist_nidx, subtraction_trick_nidx)) {
+      if (!hist_.HistogramExists(build_hist_nidx) || !hist_.HistogramExists(parent_nidx)) {
         need_build.push_back(subtraction_trick_nidx);
+        continue;
       }
+      h_args.push_back({hist_.GetNodeHistogram(parent_nidx).data(),
+                        hist_.GetNodeHistogram(build_hist_nidx).data(),
+                        hist_.GetNodeHistogram(subtraction_trick_nidx).data()});
+    }
+    if (!h_args.empty()) {
+      auto stream = ctx->CUDACtx()->Stream();
+      std::size_t n_bins = hist_.Bins();
+      dh::TemporaryArray<cuda_impl::HistSubtractionArgs> args(h_args.size());
+      dh::safe_cuda(cudaMemcpyAsync(args.data().get(), h_args.data(),
+                                    h_args.size() * sizeof(cuda_impl::HistSubtractionArgs),
+                                    cudaMemcpyDefault, stream));
+      auto d_args = args.data().get();
+      dh::LaunchN(h_args.size() * n_bins, stream, [=] __device__(std::size_t idx) {
+        auto const& node = d_args[idx / n_bins];
+        auto bin = idx % n_bins;
+        node.sibling[bin] = node.parent[bin] - node.built[bin];
+      });
     }
     this->monitor_.Stop(__func__);
     return need_build;
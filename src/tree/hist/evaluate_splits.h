@@ -4,19 +4,24 @@
 #ifndef XGBOOST_TREE_HIST_EVALUATE_SPLITS_H_
 #define XGBOOST_TREE_HIST_EVALUATE_SPLITS_H_
 
-#include <algorithm>  // for copy
-#include <cstddef>    // for size_t
-#include <limits>     // for numeric_limits
-#include <memory>     // for shared_ptr
-#include <numeric>    // for accumulate
-#include <utility>    // for move
-#include <vector>     // for vector
+#include <algorithm>      // for copy, partition_point
+#include <atomic>         // for atomic
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint8_t, uint64_t
+#include <limits>         // for numeric_limits
+#include <memory>         // for shared_ptr
+#include <numeric>        // for accumulate
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector
 
 #include "../../collective/allgather.h"
 #include "../../common/categorical.h"  // for CatBitField
 #include "../../common/hist_util.h"    // for GHistRow, HistogramCuts
 #include "../../common/linalg_op.h"    // for cbegin, cend, begin
+#include "../../common/math.h"         // for Sqr
 #include "../../common/random.h"       // for ColumnSampler
+#include "../../common/scratch_pool.h"  // for ScratchPool
 #include "../constraints.h"            // for FeatureInteractionConstraintHost
 #include "../param.h"                  // for TrainParam
 #include "../split_evaluator.h"        // for TreeEvaluator
@@ -39,31 +44,35 @@ std::enable_if_t<std::is_same_v<ExpandEntry, CPUExpandEntry> ||
 AllgatherColumnSplit(Context const *ctx, std::vector<ExpandEntry> const &entries) {
   auto const n_entries = entries.size();
 
-  // First, gather all the primitive fields.
-  std::vector<ExpandEntry> local_entries(n_entries);
-
-  // Collect and serialize all entries
-  std::vector<std::vector<char>> serialized_entries;
+  // Serialize all the entries of the level into a single message.  Round-trip latency
+  // rather than bandwidth dominates this exchange, so the per-worker payload is one
+  // array instead of a size-prefixed message per node.
+  Json jentries{Array{}};
+  auto &jarray = get<Array>(jentries);
+  jarray.resize(n_entries);
   for (std::size_t i = 0; i < n_entries; ++i) {
     Json jentry{Object{}};
     entries[i].Save(&jentry);
-
-    std::vector<char> out;
-    Json::Dump(jentry, &out, std::ios::binary);
-
-    serialized_entries.emplace_back(std::move(out));
+    jarray[i] = std::move(jentry);
+  }
+  std::vector<char> out;
+  Json::Dump(jentries, &out, std::ios::binary);
+
+  auto all_serialized = collective::VectorAllgatherV(ctx, {std::move(out)});
+  auto world = static_cast<std::size_t>(collective::GetWorldSize());
+  CHECK_EQ(all_serialized.size(), world);
+
+  // Every worker evaluates the same set of nodes, decode by position.
+  std::vector<ExpandEntry> all_entries(world * n_entries);
+  for (std::size_t w = 0; w < world; ++w) {
+    auto const &msg = all_serialized[w];
+    auto jworker = Json::Load(StringView{msg.data(), msg.size()}, std::ios::binary);
+    auto const &worker_entries = get<Array const>(jworker);
+    CHECK_EQ(worker_entries.size(), n_entries);
+    for (std::size_t i = 0; i < n_entries; ++i) {
+      all_entries[w * n_entries + i].Load(worker_entries[i]);
+    }
   }
-  auto all_serialized = collective::VectorAllgatherV(ctx, serialized_entries);
-  CHECK_GE(all_serialized.size(), local_entries.size());
-
-  std::vector<ExpandEntry> all_entries(all_serialized.size());
-  std::transform(all_serialized.cbegin(), all_serialized.cend(), all_entries.begin(),
-                 [](std::vector<char> const &e) {
-                   ExpandEntry entry;
-                   auto je = Json::Load(StringView{e.data(), e.size()}, std::ios::binary);
-                   entry.Load(je);
-                   return entry;
-                 });
 
   return all_entries;
 }
@@ -85,6 +94,18 @@ class HistEvaluator {
   bool is_col_split_{false};
   FeatureInteractionConstraintHost interaction_constraints_;
   std::vector<NodeEntry> snode_;
+  /**
+   * Per-node scan cache marking features that had no non-missing values when the node
+   * was enumerated.  A child partition can never regain values its parent lacked, so
+   * these features are skipped when evaluating the children.  Keyed by node id and
+   * cleared at the start of each tree.
+   */
+  std::unordered_map<bst_node_t, std::vector<std::uint8_t>> empty_feature_cache_;
+
+  // Diagnostics for the hessian-bound scan pruning: bins actually evaluated and bins
+  // proven unable to satisfy min_child_weight.  Updated once per feature scan.
+  mutable std::atomic<std::uint64_t> n_bins_scanned_{0};
+  mutable std::atomic<std::uint64_t> n_bins_pruned_{0};
 
   // if sum of statistics for non-missing values in the node
   // is equal to sum of statistics for all values:
@@ -291,11 +312,27 @@ class HistEvaluator {
       iend = static_cast<bst_bin_t>(cut_ptr[fidx]) - 1;
     }
 
+    bst_bin_t n_pruned{0};
+    bool exhausted{false};
     for (bst_bin_t i = ibegin; i != iend; i += d_step) {
       // start working
       // try to find a split
       left_sum.Add(hist[i].GetGrad(), hist[i].GetHess());
+      if (exhausted) {
+        // Keep accumulating for the missing-value check, but skip the evaluation.
+        ++n_pruned;
+        continue;
+      }
       right_sum.SetSubstract(parent.stats, left_sum);
+      if (left_sum.GetHess() >= param_->min_child_weight &&
+          right_sum.GetHess() < param_->min_child_weight) {
+        // The left side is already heavy enough, so validity now hinges on the right
+        // side.  With non-negative hessians, which min_child_weight assumes anyway, the
+        // right sum only shrinks from here on and no later split can become valid.
+        exhausted = true;
+        ++n_pruned;
+        continue;
+      }
       if (IsValid(left_sum, right_sum)) {
         bst_float loss_chg;
         bst_float split_pt;
@@ -322,22 +359,239 @@ class HistEvaluator {
         }
       }
     }
+    auto n_bins = (iend - ibegin) * d_step;
+    n_bins_scanned_.fetch_add(n_bins - n_pruned, std::memory_order_relaxed);
+    n_bins_pruned_.fetch_add(n_pruned, std::memory_order_relaxed);
 
     p_best->Update(best);
     return left_sum;
   }
 
+  /**
+   * \brief Batched numeric scan.
+   *
+   * Computes the cumulative sums and the per-bin gains for the whole feature histogram
+   * row as separate array passes before selecting the best split, instead of
+   * interleaving the branchy gain computation with the scan.  The arithmetic matches
+   * the scalar EnumerateSplit bit for bit.  With monotone constraints, the per-node
+   * weight clamps and the per-feature constraint sign are read once up front instead of
+   * per bin, and violating candidates are rejected on the cheap weight comparison
+   * before any gain arithmetic; only max_delta_step still needs the scalar version.
+   * Handles both scan directions, the backward scan is skipped when the feature has no
+   * missing values.
+   */
+  GradStats EnumerateSplitBatched(common::HistogramCuts const &cut, common::ConstGHistRow hist,
+                                  bst_feature_t fidx, bst_node_t nidx,
+                                  TreeEvaluator::SplitEvaluator<TrainParam> const &evaluator,
+                                  common::Span<double> grad_buf, common::Span<double> hess_buf,
+                                  common::Span<float> gain_buf, SplitEntry *p_best) const {
+    const std::vector<uint32_t> &cut_ptr = cut.Ptrs();
+    const std::vector<bst_float> &cut_val = cut.Values();
+    auto const &parent = snode_[nidx];
+
+    CHECK_LE(cut_ptr[fidx], static_cast<uint32_t>(std::numeric_limits<bst_bin_t>::max()));
+    CHECK_LE(cut_ptr[fidx + 1], static_cast<uint32_t>(std::numeric_limits<bst_bin_t>::max()));
+    auto const ibegin = static_cast<bst_bin_t>(cut_ptr[fidx]);
+    auto const iend = static_cast<bst_bin_t>(cut_ptr.at(fidx + 1));
+    auto const n_bins = iend - ibegin;
+    if (n_bins == 0) {
+      return GradStats{};
+    }
+
+    auto grad_sum = grad_buf.subspan(0, n_bins);
+    auto hess_sum = hess_buf.subspan(0, n_bins);
+    auto gain = gain_buf.subspan(0, n_bins);
+
+    double const parent_grad = parent.stats.GetGrad();
+    double const parent_hess = parent.stats.GetHess();
+    float const alpha = param_->reg_alpha;
+    float const lambda = param_->reg_lambda;
+
+    // Mirrors SplitEvaluator::CalcGainGivenWeight without the constraint branches, the
+    // loop body is branch-free up to the hessian guard and vectorizes.
+    auto fill_gain = [&](bst_bin_t lo, bst_bin_t hi) {
+      for (bst_bin_t j = lo; j < hi; ++j) {
+        double gl = grad_sum[j];
+        double hl = hess_sum[j];
+        double gr = parent_grad - gl;
+        double hr = parent_hess - hl;
+        float gain_l = hl <= 0 ? .0f
+                               : static_cast<float>(common::Sqr(ThresholdL1(gl, alpha))) /
+                                     static_cast<float>(hl + lambda);
+        float gain_r = hr <= 0 ? .0f
+                               : static_cast<float>(common::Sqr(ThresholdL1(gr, alpha))) /
+                                     static_cast<float>(hr + lambda);
+        gain[j] = gain_l + gain_r;
+      }
+    };
+
+    double const mcw = param_->min_child_weight;
+    // Bins able to satisfy min_child_weight form a contiguous range: with non-negative
+    // hessians the left cumulative hessian is non-decreasing along the scan and the
+    // right one non-increasing, so the gain pass is restricted to that range.  The
+    // validity of each candidate is still checked exactly.
+    auto valid_range = [&](bool forward) {
+      auto left_heavy = [&](double v) { return v >= mcw; };
+      auto right_heavy = [&](double v) { return parent_hess - v >= mcw; };
+      bst_bin_t lo, hi;
+      if (forward) {
+        lo = std::partition_point(hess_sum.cbegin(), hess_sum.cbegin() + n_bins,
+                                  [&](double v) { return !left_heavy(v); }) -
+             hess_sum.cbegin();
+        hi = std::partition_point(hess_sum.cbegin(), hess_sum.cbegin() + n_bins, right_heavy) -
+             hess_sum.cbegin();
+      } else {
+        // Suffix sums, the cumulative hessian decreases along the array.
+        lo = std::partition_point(hess_sum.cbegin(), hess_sum.cbegin() + n_bins,
+                                  [&](double v) { return !right_heavy(v); }) -
+             hess_sum.cbegin();
+        hi = std::partition_point(hess_sum.cbegin(), hess_sum.cbegin() + n_bins, left_heavy) -
+             hess_sum.cbegin();
+      }
+      hi = std::max(hi, lo);
+      n_bins_scanned_.fetch_add(hi - lo, std::memory_order_relaxed);
+      n_bins_pruned_.fetch_add(n_bins - (hi - lo), std::memory_order_relaxed);
+      return std::make_pair(lo, hi);
+    };
+
+    // Monotone constraint state, hoisted out of the bin loops: the weight clamps depend
+    // only on the node, the constraint sign only on the feature.
+    std::int32_t const sign = evaluator.has_constraint ? evaluator.constraints[fidx] : 0;
+    float const w_lo = evaluator.has_constraint ? evaluator.lower[nidx]
+                                                : -std::numeric_limits<float>::max();
+    float const w_up = evaluator.has_constraint ? evaluator.upper[nidx]
+                                                : std::numeric_limits<float>::max();
+    // Mirrors SplitEvaluator::CalcWeight with the node lookups cached.
+    auto clamp_weight = [&](double gs, double hs) {
+      float w = (hs < mcw || hs <= 0.0)
+                    ? 0.0f
+                    : static_cast<float>(-ThresholdL1(gs, alpha) / (hs + lambda));
+      if (w < w_lo) {
+        return w_lo;
+      }
+      if (w > w_up) {
+        return w_up;
+      }
+      return w;
+    };
+    // Mirrors SplitEvaluator::CalcGainGivenWeight on the constrained path.
+    auto gain_given_weight = [&](double gs, double hs, float w) {
+      if (hs <= 0) {
+        return 0.0f;
+      }
+      return tree::CalcGainGivenWeight<TrainParam, float>(*param_, static_cast<float>(gs),
+                                                          static_cast<float>(hs), w);
+    };
+
+    SplitEntry best;
+    // forward enumeration: split at right bound of each bin
+    double g{0.0}, h{0.0};
+    for (bst_bin_t j = 0; j < n_bins; ++j) {
+      g += hist[ibegin + j].GetGrad();
+      h += hist[ibegin + j].GetHess();
+      grad_sum[j] = g;
+      hess_sum[j] = h;
+    }
+    auto [fwd_lo, fwd_hi] = valid_range(/*forward=*/true);
+    if (!evaluator.has_constraint) {
+      fill_gain(fwd_lo, fwd_hi);
+      for (bst_bin_t j = fwd_lo; j < fwd_hi; ++j) {
+        GradStats left_sum{grad_sum[j], hess_sum[j]};
+        GradStats right_sum;
+        right_sum.SetSubstract(parent.stats, left_sum);
+        if (IsValid(left_sum, right_sum)) {
+          best.Update(gain[j] - parent.root_gain, fidx, cut_val[ibegin + j], false, false, left_sum,
+                      right_sum);
+        }
+      }
+    } else {
+      for (bst_bin_t j = fwd_lo; j < fwd_hi; ++j) {
+        GradStats left_sum{grad_sum[j], hess_sum[j]};
+        GradStats right_sum;
+        right_sum.SetSubstract(parent.stats, left_sum);
+        if (!IsValid(left_sum, right_sum)) {
+          continue;
+        }
+        float wl = clamp_weight(left_sum.GetGrad(), left_sum.GetHess());
+        float wr = clamp_weight(right_sum.GetGrad(), right_sum.GetHess());
+        if ((sign > 0 && wl > wr) || (sign < 0 && wl < wr)) {
+          // Provably violating, rejected before the gain arithmetic.
+          continue;
+        }
+        auto gain_c = gain_given_weight(left_sum.GetGrad(), left_sum.GetHess(), wl) +
+                      gain_given_weight(right_sum.GetGrad(), right_sum.GetHess(), wr);
+        best.Update(gain_c - parent.root_gain, fidx, cut_val[ibegin + j], false, false, left_sum,
+                    right_sum);
+      }
+    }
+
+    GradStats const feature_sum{grad_sum[n_bins - 1], hess_sum[n_bins - 1]};
+    if (SplitContainsMissingValues(feature_sum, parent)) {
+      // backward enumeration: split at left bound of each bin
+      g = 0.0;
+      h = 0.0;
+      for (bst_bin_t j = n_bins - 1; j >= 0; --j) {
+        g += hist[ibegin + j].GetGrad();
+        h += hist[ibegin + j].GetHess();
+        grad_sum[j] = g;
+        hess_sum[j] = h;
+      }
+      auto [bwd_lo, bwd_hi] = valid_range(/*forward=*/false);
+      if (!evaluator.has_constraint) {
+        fill_gain(bwd_lo, bwd_hi);
+        for (bst_bin_t j = bwd_hi - 1; j >= bwd_lo; --j) {
+          GradStats left_sum{grad_sum[j], hess_sum[j]};
+          GradStats right_sum;
+          right_sum.SetSubstract(parent.stats, left_sum);
+          if (IsValid(left_sum, right_sum)) {
+            auto split_pt = j == 0 ? cut.MinValues()[fidx] : cut_val[ibegin + j - 1];
+            best.Update(gain[j] - parent.root_gain, fidx, split_pt, true, false, right_sum,
+                        left_sum);
+          }
+        }
+      } else {
+        for (bst_bin_t j = bwd_hi - 1; j >= bwd_lo; --j) {
+          // The suffix sums are the physical right side, missing values go left.
+          GradStats phys_right{grad_sum[j], hess_sum[j]};
+          GradStats phys_left;
+          phys_left.SetSubstract(parent.stats, phys_right);
+          if (!IsValid(phys_left, phys_right)) {
+            continue;
+          }
+          float wl = clamp_weight(phys_left.GetGrad(), phys_left.GetHess());
+          float wr = clamp_weight(phys_right.GetGrad(), phys_right.GetHess());
+          if ((sign > 0 && wl > wr) || (sign < 0 && wl < wr)) {
+            continue;
+          }
+          auto gain_c = gain_given_weight(phys_left.GetGrad(), phys_left.GetHess(), wl) +
+                        gain_given_weight(phys_right.GetGrad(), phys_right.GetHess(), wr);
+          auto split_pt = j == 0 ? cut.MinValues()[fidx] : cut_val[ibegin + j - 1];
+          best.Update(gain_c - parent.root_gain, fidx, split_pt, true, false, phys_left,
+                      phys_right);
+        }
+      }
+    }
+
+    p_best->Update(best);
+    return feature_sum;
+  }
+
  public:
   void EvaluateSplits(const BoundedHistCollection &hist, common::HistogramCuts const &cut,
                       common::Span<FeatureType const> feature_types, const RegTree &tree,
                       std::vector<CPUExpandEntry> *p_entries) {
     auto n_threads = ctx_->Threads();
     auto &entries = *p_entries;
-    // All nodes are on the same level, so we can store the shared ptr.
+    // All nodes are on the same level, so we can store the shared ptr.  When the
+    // hash-based predicate handles bynode sampling, the per-node shuffle is skipped and
+    // the predicate is evaluated inline in the feature loop instead.
+    auto sample_node = column_sampler_->NodePredicate();
     std::vector<std::shared_ptr<HostDeviceVector<bst_feature_t>>> features(entries.size());
     for (size_t nidx_in_set = 0; nidx_in_set < entries.size(); ++nidx_in_set) {
       auto nidx = entries[nidx_in_set].nid;
-      features[nidx_in_set] = column_sampler_->GetFeatureSet(tree.GetDepth(nidx));
+      features[nidx_in_set] = sample_node
+                                  ? column_sampler_->GetFeatureSetByPredicate(tree.GetDepth(nidx))
+                                  : column_sampler_->GetFeatureSet(tree.GetDepth(nidx));
     }
     CHECK(!features.empty());
     const size_t grain_size = std::max<size_t>(1, features.front()->Size() / n_threads);
@@ -353,6 +607,32 @@ class HistEvaluator {
     }
     auto evaluator = tree_evaluator_.GetEvaluator();
     auto const &cut_ptrs = cut.Ptrs();
+    // The batched scan handles monotone constraints with per-node precomputed weight
+    // clamps; only max_delta_step still needs the scalar per-bin weight computation.
+    bool const use_batched_gain = param_->max_delta_step == 0.0f;
+    // Widest feature in bins, bounds the per-task scratch for the batched scan.
+    bst_bin_t max_n_bins{0};
+    if (use_batched_gain) {
+      for (std::size_t i = 1; i < cut_ptrs.size(); ++i) {
+        max_n_bins = std::max(max_n_bins, static_cast<bst_bin_t>(cut_ptrs[i] - cut_ptrs[i - 1]));
+      }
+    }
+
+    // Prepare the scan cache for this batch and look up the parents' entries.  The map
+    // is only read inside the parallel region, entries for the current nodes are
+    // created here up-front.
+    auto n_features = cut_ptrs.size() - 1;
+    std::vector<std::vector<std::uint8_t> const *> parent_scan(entries.size(), nullptr);
+    for (std::size_t nidx_in_set = 0; nidx_in_set < entries.size(); ++nidx_in_set) {
+      auto nidx = entries[nidx_in_set].nid;
+      empty_feature_cache_[nidx].assign(n_features, 0);
+      if (nidx != RegTree::kRoot) {
+        auto it = empty_feature_cache_.find(tree.Parent(nidx));
+        if (it != empty_feature_cache_.cend()) {
+          parent_scan[nidx_in_set] = &it->second;
+        }
+      }
+    }
 
     common::ParallelFor2d(space, n_threads, [&](size_t nidx_in_set, common::Range1d r) {
       auto tidx = omp_get_thread_num();
@@ -361,8 +641,18 @@ class HistEvaluator {
       auto nidx = entry->nid;
       auto histogram = hist[nidx];
       auto features_set = features[nidx_in_set]->ConstHostSpan();
+      auto &node_scan = empty_feature_cache_.at(nidx);
+      auto const *p_scan = parent_scan[nidx_in_set];
+      // Scratch buffers for the batched scan, checked out of the context pool once per
+      // task and shared by all the features the task evaluates.
+      auto grad_scratch = ctx_->Scratch()->Checkout<double>(max_n_bins);
+      auto hess_scratch = ctx_->Scratch()->Checkout<double>(max_n_bins);
+      auto gain_scratch = ctx_->Scratch()->Checkout<float>(max_n_bins);
       for (auto fidx_in_set = r.begin(); fidx_in_set < r.end(); fidx_in_set++) {
         auto fidx = features_set[fidx_in_set];
+        if (sample_node && !sample_node(fidx, fidx_in_set, features_set.size(), nidx)) {
+          continue;
+        }
         bool is_cat = common::IsCat(feature_types, fidx);
         if (!interaction_constraints_.Query(nidx, fidx)) {
           continue;
@@ -372,7 +662,7 @@ class HistEvaluator {
           if (common::UseOneHot(n_bins, param_->max_cat_to_onehot)) {
             EnumerateOneHot(cut, histogram, fidx, nidx, evaluator, best);
           } else {
-            std::vector<size_t> sorted_idx(n_bins);
+            auto sorted_idx = ctx_->Scratch()->Checkout<size_t>(n_bins);
             std::iota(sorted_idx.begin(), sorted_idx.end(), 0);
             auto feat_hist = histogram.subspan(cut_ptrs[fidx], n_bins);
             // Sort the histogram to get contiguous partitions.
@@ -381,13 +671,32 @@ class HistEvaluator {
                          evaluator.CalcWeightCat(*param_, feat_hist[r]);
               return ret;
             });
-            EnumeratePart<+1>(cut, sorted_idx, histogram, fidx, nidx, evaluator, best);
-            EnumeratePart<-1>(cut, sorted_idx, histogram, fidx, nidx, evaluator, best);
+            EnumeratePart<+1>(cut, {sorted_idx.data(), sorted_idx.size()}, histogram, fidx, nidx,
+                              evaluator, best);
+            EnumeratePart<-1>(cut, {sorted_idx.data(), sorted_idx.size()}, histogram, fidx, nidx,
+                              evaluator, best);
           }
         } else {
-          auto grad_stats = EnumerateSplit<+1>(cut, histogram, fidx, nidx, evaluator, best);
-          if (SplitContainsMissingValues(grad_stats, snode_[nidx])) {
-            EnumerateSplit<-1>(cut, histogram, fidx, nidx, evaluator, best);
+          if (p_scan && (*p_scan)[fidx]) {
+            // The feature had no non-missing values in the parent, nothing to scan.
+            node_scan[fidx] = 1;
+            continue;
+          }
+          if (use_batched_gain) {
+            auto grad_stats = EnumerateSplitBatched(
+                cut, histogram, fidx, nidx, evaluator, {grad_scratch.data(), grad_scratch.size()},
+                {hess_scratch.data(), hess_scratch.size()},
+                {gain_scratch.data(), gain_scratch.size()}, best);
+            if (grad_stats.GetGrad() == 0.0 && grad_stats.GetHess() == 0.0) {
+              node_scan[fidx] = 1;
+            }
+          } else {
+            auto grad_stats = EnumerateSplit<+1>(cut, histogram, fidx, nidx, evaluator, best);
+            if (grad_stats.GetGrad() == 0.0 && grad_stats.GetHess() == 0.0) {
+              node_scan[fidx] = 1;
+            } else if (SplitContainsMissingValues(grad_stats, snode_[nidx])) {
+              EnumerateSplit<-1>(cut, histogram, fidx, nidx, evaluator, best);
+            }
           }
         }
       }
@@ -456,6 +765,7 @@ class HistEvaluator {
 
     interaction_constraints_.Split(candidate.nid, tree[candidate.nid].SplitIndex(), left_child,
                                    right_child);
+    column_sampler_->RecordSplitGain(candidate.split.SplitIndex(), candidate.split.loss_chg);
   }
 
   [[nodiscard]] auto Evaluator() const { return tree_evaluator_.GetEvaluator(); }
@@ -463,6 +773,7 @@ class HistEvaluator {
 
   float InitRoot(GradStats const &root_sum) {
     snode_.resize(1);
+    empty_feature_cache_.clear();
     auto root_evaluator = tree_evaluator_.GetEvaluator();
 
     snode_[0].stats = GradStats{root_sum.GetGrad(), root_sum.GetHess()};
@@ -487,6 +798,18 @@ class HistEvaluator {
                           param_->colsample_bynode, param_->colsample_bylevel,
                           param_->colsample_bytree);
   }
+
+  ~HistEvaluator() {
+    if (n_bins_pruned_ > 0) {
+      LOG(DEBUG) << "Split evaluation scanned " << n_bins_scanned_ << " histogram bins, pruned "
+                 << n_bins_pruned_ << " by the min_child_weight bound.";
+    }
+  }
+
+  /** @brief Number of histogram bins evaluated by the numeric scans, for diagnostics. */
+  [[nodiscard]] std::uint64_t BinsScanned() const { return n_bins_scanned_; }
+  /** @brief Number of bins proven unable to satisfy min_child_weight and skipped. */
+  [[nodiscard]] std::uint64_t BinsPruned() const { return n_bins_pruned_; }
 };
 
 class HistMultiEvaluator {
@@ -579,11 +902,15 @@ class HistMultiEvaluator {
   void EvaluateSplits(RegTree const &tree, common::Span<const BoundedHistCollection *> hist,
                       common::HistogramCuts const &cut, std::vector<MultiExpandEntry> *p_entries) {
     auto &entries = *p_entries;
+    // See HistEvaluator::EvaluateSplits for the predicate-based bynode sampling.
+    auto sample_node = column_sampler_->NodePredicate();
     std::vector<std::shared_ptr<HostDeviceVector<bst_feature_t>>> features(entries.size());
 
     for (std::size_t nidx_in_set = 0; nidx_in_set < entries.size(); ++nidx_in_set) {
       auto nidx = entries[nidx_in_set].nid;
-      features[nidx_in_set] = column_sampler_->GetFeatureSet(tree.GetDepth(nidx));
+      features[nidx_in_set] = sample_node
+                                  ? column_sampler_->GetFeatureSetByPredicate(tree.GetDepth(nidx))
+                                  : column_sampler_->GetFeatureSet(tree.GetDepth(nidx));
     }
     CHECK(!features.empty());
 
@@ -612,6 +939,9 @@ class HistMultiEvaluator {
 
       for (auto fidx_in_set = r.begin(); fidx_in_set < r.end(); fidx_in_set++) {
         auto fidx = features_set[fidx_in_set];
+        if (sample_node && !sample_node(fidx, fidx_in_set, features_set.size(), entry->nid)) {
+          continue;
+        }
         if (!interaction_constraints_.Query(entry->nid, fidx)) {
           continue;
         }
@@ -703,6 +1033,8 @@ class HistMultiEvaluator {
     auto right_sum_stat = stats_.Slice(right_child, linalg::All());
     std::copy(candidate.split.right_sum.cbegin(), candidate.split.right_sum.cend(),
               linalg::begin(right_sum_stat));
+
+    column_sampler_->RecordSplitGain(candidate.split.SplitIndex(), candidate.split.loss_chg);
   }
 
   explicit HistMultiEvaluator(Context const *ctx, MetaInfo const &info, TrainParam const *param,
@@ -774,7 +1106,7 @@ void UpdatePredictionCacheImpl(Context const *ctx, RegTree const *p_last_tree,
       if (tree.IsLeaf(nidx)) {
         auto const &rowset = part[nidx];
         auto leaf_value = mttree->LeafValue(nidx);
-        for (bst_idx_t const *it = rowset.begin() + r.begin(); it < rowset.begin() + r.end();
+        for (auto const *it = rowset.begin() + r.begin(); it < rowset.begin() + r.end();
              ++it) {
           for (std::size_t i = 0; i < n_targets; ++i) {
             out_preds(*it, i) += leaf_value(i);
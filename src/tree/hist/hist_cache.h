@@ -9,6 +9,7 @@
 #include <vector>   // for vector
 
 #include "../../common/hist_util.h"          // for GHistRow, ConstGHistRow
+#include "../../common/memory_stats.h"       // for MemoryUsageReporter
 #include "../../common/ref_resource_view.h"  // for ReallocVector
 #include "xgboost/base.h"                    // for bst_node_t, bst_bin_t
 #include "xgboost/logging.h"                 // for CHECK_EQ
@@ -43,6 +44,7 @@ class BoundedHistCollection {
   std::size_t max_cached_nodes_{0};
   // whether the tree has grown beyond the cache limit
   bool has_exceeded_{false};
+  common::MemoryUsageReporter mem_usage_{"Histogram"};
 
  public:
   BoundedHistCollection() = default;
@@ -89,6 +91,7 @@ class BoundedHistCollection {
     auto new_size = alloc_size + current_size_;
     if (new_size > data_->size()) {
       data_->Resize(new_size);
+      mem_usage_.Update(data_->size() * sizeof(GradientPairPrecise));
     }
     for (auto nidx : nodes_to_build) {
       node_map_[nidx] = current_size_;
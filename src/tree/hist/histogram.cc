@@ -3,11 +3,15 @@
  */
 #include "histogram.h"
 
-#include <cstddef>  // for size_t
-#include <numeric>  // for accumulate
-#include <utility>  // for swap
-#include <vector>   // for vector
+#include <algorithm>  // for fill_n
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint64_t
+#include <cstring>    // for memcpy
+#include <numeric>    // for accumulate
+#include <utility>    // for swap
+#include <vector>     // for vector
 
+#include "../../collective/allgather.h"       // for VectorAllgatherV
 #include "../../common/transform_iterator.h"  // for MakeIndexTransformIter
 #include "expand_entry.h"                     // for MultiExpandEntry, CPUExpandEntry
 #include "xgboost/logging.h"                  // for CHECK_NE
@@ -60,4 +64,65 @@ void AssignNodes(RegTree const *p_tree, std::vector<CPUExpandEntry> const &candi
     ++n_idx;
   }
 }
+
+collective::Result SparseSyncHist(Context const *ctx, collective::CommGroup const &comm,
+                                  common::Span<double> hist) {
+  // A run of consecutive non-zero values: the header followed by `n` doubles.
+  struct RunHeader {
+    std::uint64_t begin;
+    std::uint64_t n;
+  };
+
+  auto n = hist.size();
+  std::vector<char> payload;
+  std::size_t i = 0;
+  while (i < n) {
+    if (hist[i] == .0) {
+      ++i;
+      continue;
+    }
+    auto begin = i;
+    while (i < n && hist[i] != .0) {
+      ++i;
+    }
+    RunHeader header{begin, i - begin};
+    auto prev = payload.size();
+    payload.resize(prev + sizeof(header) + header.n * sizeof(double));
+    std::memcpy(payload.data() + prev, &header, sizeof(header));
+    std::memcpy(payload.data() + prev + sizeof(header), hist.data() + begin,
+                header.n * sizeof(double));
+  }
+
+  // Gathering sends the combined payloads to every worker, while the ring allreduce
+  // moves about two dense copies, so go dense unless the runs are clearly smaller.  The
+  // decision uses the globally reduced size, all workers take the same branch.
+  std::uint64_t total = payload.size();
+  auto rc = collective::Allreduce(ctx, comm, linalg::MakeVec(&total, 1), collective::Op::kSum);
+  if (!rc.OK()) {
+    return rc;
+  }
+  if (total >= n * sizeof(double)) {
+    return collective::Allreduce(ctx, comm, linalg::MakeVec(hist.data(), n),
+                                 collective::Op::kSum);
+  }
+
+  auto gathered = collective::VectorAllgatherV(ctx, comm, {payload});
+  std::fill_n(hist.data(), n, .0);
+  for (auto const &runs : gathered) {
+    std::size_t offset = 0;
+    while (offset < runs.size()) {
+      RunHeader header;
+      std::memcpy(&header, runs.data() + offset, sizeof(header));
+      offset += sizeof(header);
+      CHECK_LE(header.begin + header.n, n);
+      for (std::uint64_t k = 0; k < header.n; ++k) {
+        double v;
+        std::memcpy(&v, runs.data() + offset + k * sizeof(double), sizeof(double));
+        hist[header.begin + k] += v;
+      }
+      offset += header.n * sizeof(double);
+    }
+  }
+  return collective::Success();
+}
 }  // namespace xgboost::tree
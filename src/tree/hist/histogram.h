@@ -4,14 +4,19 @@
 #ifndef XGBOOST_TREE_HIST_HISTOGRAM_H_
 #define XGBOOST_TREE_HIST_HISTOGRAM_H_
 
-#include <algorithm>   // for max
+#include <algorithm>   // for fill, max
+#include <array>       // for array
 #include <cstddef>     // for size_t
 #include <cstdint>     // for int32_t
+#include <future>      // for async, launch
+#include <numeric>     // for accumulate
 #include <utility>     // for move
 #include <vector>      // for vector
 
 #include "../../collective/allreduce.h"    // for Allreduce
+#include "../../common/common.h"           // for DivRoundUp
 #include "../../common/hist_util.h"        // for GHistRow, ParallelGHi...
+#include "../../common/timer.h"            // for Timer
 #include "../../common/row_set.h"          // for RowSetCollection
 #include "../../common/threading_utils.h"  // for ParallelFor2d, Range1d, BlockedSpace2d
 #include "../../data/gradient_index.h"     // for GHistIndexMatrix
@@ -39,6 +44,27 @@ void AssignNodes(RegTree const *p_tree, std::vector<MultiExpandEntry> const &val
 void AssignNodes(RegTree const *p_tree, std::vector<CPUExpandEntry> const &candidates,
                  common::Span<bst_node_t> nodes_to_build, common::Span<bst_node_t> nodes_to_sub);
 
+/**
+ * @brief Sum histograms across workers, run-length encoding the non-zero spans when
+ *        that's cheaper than reducing the dense buffer.
+ *
+ * Deep nodes touch only a small row subset and leave most bins at zero.  Each worker
+ * encodes its maximal non-zero runs, the runs are gathered to every worker, and each
+ * worker accumulates them locally.  When the combined payloads are not smaller than the
+ * dense buffer this falls back to the regular allreduce; the decision is made
+ * collectively so all workers take the same path.
+ *
+ * The communicator group is passed in explicitly so the sync can run on a background
+ * thread, the global group being thread-local.
+ */
+[[nodiscard]] collective::Result SparseSyncHist(Context const *ctx,
+                                                collective::CommGroup const &comm,
+                                                common::Span<double> hist);
+
+inline collective::Result SparseSyncHist(Context const *ctx, common::Span<double> hist) {
+  return SparseSyncHist(ctx, *collective::GlobalCommGroup(), hist);
+}
+
 class HistogramBuilder {
   /*! \brief culmulative histogram of gradients. */
   BoundedHistCollection hist_;
@@ -48,6 +74,28 @@ class HistogramBuilder {
   // Whether XGBoost is running in distributed environment.
   bool is_distributed_{false};
   bool is_col_split_{false};
+  // Optional structure-of-arrays gradient buffers, see HistMakerTrainParam::use_soa_gpair.
+  bool use_soa_gpair_{false};
+  // Single precision per-thread partial histograms, see HistMakerTrainParam::float_hist.
+  bool float_hist_{false};
+  // Encode sparse histograms for the distributed sync, see
+  // HistMakerTrainParam::sparse_hist_sync.
+  bool sparse_sync_{false};
+  // Log per-level sync wait times and their cross-worker skew, see
+  // HistMakerTrainParam::hist_sync_stats.
+  bool sync_stats_{false};
+  // Whether the current build partitions the work by feature groups instead of row
+  // blocks, decided per build from the shape of the row space.
+  bool feature_parallel_{false};
+  std::vector<float> grad_soa_;
+  std::vector<float> hess_soa_;
+
+  [[nodiscard]] static bst_node_t SubtractionSibling(RegTree const *p_tree,
+                                                     bst_node_t subtraction_nidx) {
+    auto parent_id = p_tree->Parent(subtraction_nidx);
+    return p_tree->IsLeftChild(subtraction_nidx) ? p_tree->RightChild(parent_id)
+                                                 : p_tree->LeftChild(parent_id);
+  }
 
  public:
   /**
@@ -65,6 +113,13 @@ class HistogramBuilder {
     buffer_.Init(total_bins);
     is_distributed_ = is_distributed;
     is_col_split_ = is_col_split;
+    float_hist_ = param->float_hist;
+    // The kernel selections are exclusive, the single precision build takes precedence
+    // as it also shrinks the histogram rows.
+    use_soa_gpair_ = param->use_soa_gpair && !float_hist_;
+    sparse_sync_ = param->sparse_hist_sync;
+    sync_stats_ = param->hist_sync_stats;
+    feature_parallel_ = false;
   }
 
   template <bool any_missing>
@@ -73,17 +128,86 @@ class HistogramBuilder {
                             common::RowSetCollection const &row_set_collection,
                             common::Span<GradientPair const> gpair_h, bool force_read_by_column) {
     // Parallel processing by nodes and data in each node
-    common::ParallelFor2d(space, this->n_threads_, [&](size_t nid_in_set, common::Range1d r) {
+    common::ParallelFor2d("BuildHist", space, this->n_threads_,
+                          [&](size_t nid_in_set, common::Range1d r) {
       const auto tid = static_cast<unsigned>(omp_get_thread_num());
       bst_node_t const nidx = nodes_to_build[nid_in_set];
       auto const& elem = row_set_collection[nidx];
       auto start_of_row_set = std::min(r.begin(), elem.Size());
       auto end_of_row_set = std::min(r.end(), elem.Size());
-      auto rid_set = common::Span<bst_idx_t const>{elem.begin() + start_of_row_set,
+      auto rid_set = common::Span<common::RowIndexT const>{elem.begin() + start_of_row_set,
                                                    elem.begin() + end_of_row_set};
+      if (float_hist_) {
+        auto hist = buffer_.GetInitializedHistF32(tid, nid_in_set);
+        if (rid_set.size() != 0) {
+          common::BuildHistF32<any_missing>(gpair_h, rid_set, gidx, hist);
+        }
+        return;
+      }
       auto hist = buffer_.GetInitializedHist(tid, nid_in_set);
       if (rid_set.size() != 0) {
-        common::BuildHist<any_missing>(gpair_h, rid_set, gidx, hist, force_read_by_column);
+        if (use_soa_gpair_) {
+          common::BuildHistSoA<any_missing>(grad_soa_, hess_soa_, rid_set, gidx, hist);
+        } else {
+          common::BuildHist<any_missing>(gpair_h, rid_set, gidx, hist, force_read_by_column);
+        }
+      }
+    });
+  }
+
+  /**
+   * @brief Whether to partition the build by feature groups instead of row blocks.
+   *
+   * Short-wide data produces fewer row blocks than threads, leaving most of them idle.
+   * Only the default double precision kernel has a feature-parallel variant, and the
+   * transposed page must be available.
+   */
+  [[nodiscard]] bool UseFeatureParallelBuild(common::BlockedSpace2d const &space,
+                                             GHistIndexMatrix const &gidx,
+                                             std::size_t n_nodes) const {
+    if (float_hist_ || use_soa_gpair_) {
+      return false;
+    }
+    if (gidx.Transpose().GetNumFeature() != gidx.Features()) {
+      return false;  // transpose not built for this page
+    }
+    if (space.Size() >= static_cast<std::size_t>(this->n_threads_)) {
+      return false;  // the row blocks can feed all the threads
+    }
+    // Worthwhile only if slicing the features yields more parallelism than the rows do.
+    return static_cast<std::size_t>(gidx.Features()) * n_nodes > space.Size();
+  }
+
+  /**
+   * @brief Feature-parallel counterpart of @ref BuildLocalHistograms.
+   *
+   * Threads own disjoint feature groups and write into the shared node histograms
+   * directly; the bins of a feature form a contiguous histogram slice, so the writes
+   * never overlap and no per-thread partials or reduction are involved.
+   */
+  void BuildFeatureParallelHistograms(std::size_t page_idx, GHistIndexMatrix const &gidx,
+                                      std::vector<bst_node_t> const &nodes_to_build,
+                                      common::RowSetCollection const &row_set_collection,
+                                      common::Span<GradientPair const> gpair_h) {
+    auto n_features = static_cast<std::size_t>(gidx.Features());
+    auto grain = common::GrainSize(n_features * nodes_to_build.size(), this->n_threads_, 1);
+    common::BlockedSpace2d space{nodes_to_build.size(), [&](std::size_t) { return n_features; },
+                                 grain};
+    auto const &cut_ptrs = gidx.cut.Ptrs();
+    common::ParallelFor2d("BuildHistByFeature", space, this->n_threads_,
+                          [&](size_t nid_in_set, common::Range1d r) {
+      bst_node_t const nidx = nodes_to_build[nid_in_set];
+      auto hist = hist_[nidx];
+      auto fbeg = static_cast<bst_feature_t>(r.begin());
+      auto fend = static_cast<bst_feature_t>(r.end());
+      if (page_idx == 0) {
+        // The histogram cache is recycled across iterations without zeroing.
+        std::fill(hist.data() + cut_ptrs[fbeg], hist.data() + cut_ptrs[fend],
+                  GradientPairPrecise{});
+      }
+      auto const &elem = row_set_collection[nidx];
+      if (elem.Size() != 0) {
+        common::BuildHistByFeature(gpair_h, {elem.begin(), elem.end()}, gidx, hist, fbeg, fend);
       }
     });
   }
@@ -142,6 +266,21 @@ class HistogramBuilder {
     this->hist_.AllocateHistograms(nodes_to_build, nodes_to_sub);
   }
 
+  /**
+   * @brief Add the local histogram cache to the parallel buffer, called once per build
+   *        before processing the first page.
+   */
+  void ResetBuffer(common::BlockedSpace2d const &space,
+                   std::vector<bst_node_t> const &nodes_to_build) {
+    auto n_nodes = nodes_to_build.size();
+    std::vector<common::GHistRow> target_hists(n_nodes);
+    for (size_t i = 0; i < n_nodes; ++i) {
+      auto const nidx = nodes_to_build[i];
+      target_hists[i] = hist_[nidx];
+    }
+    buffer_.Reset(this->n_threads_, n_nodes, space, target_hists, float_hist_);
+  }
+
   /** Main entry point of this class, build histogram for tree nodes. */
   void BuildHist(std::size_t page_idx, common::BlockedSpace2d const &space,
                  GHistIndexMatrix const &gidx, common::RowSetCollection const &row_set_collection,
@@ -150,14 +289,28 @@ class HistogramBuilder {
     CHECK(gpair.Contiguous());
 
     if (page_idx == 0) {
-      // Add the local histogram cache to the parallel buffer before processing the first page.
-      auto n_nodes = nodes_to_build.size();
-      std::vector<common::GHistRow> target_hists(n_nodes);
-      for (size_t i = 0; i < n_nodes; ++i) {
-        auto const nidx = nodes_to_build[i];
-        target_hists[i] = hist_[nidx];
+      this->feature_parallel_ =
+          !force_read_by_column && this->UseFeatureParallelBuild(space, gidx, nodes_to_build.size());
+      if (!feature_parallel_) {
+        this->ResetBuffer(space, nodes_to_build);
       }
-      buffer_.Reset(this->n_threads_, n_nodes, space, target_hists);
+    }
+
+    if (feature_parallel_) {
+      this->BuildFeatureParallelHistograms(page_idx, gidx, nodes_to_build, row_set_collection,
+                                           gpair.Values());
+      return;
+    }
+
+    if (use_soa_gpair_ && page_idx == 0) {
+      // De-interleave the gradients once per build, all nodes share the buffers.
+      auto values = gpair.Values();
+      grad_soa_.resize(values.size());
+      hess_soa_.resize(values.size());
+      common::ParallelFor(values.size(), this->n_threads_, [&](std::size_t i) {
+        grad_soa_[i] = values[i].GetGrad();
+        hess_soa_[i] = values[i].GetHess();
+      });
     }
 
     if (gidx.IsDense()) {
@@ -169,57 +322,167 @@ class HistogramBuilder {
     }
   }
 
-  void SyncHistogram(Context const *ctx, RegTree const *p_tree,
-                     std::vector<bst_node_t> const &nodes_to_build,
-                     std::vector<bst_node_t> const &nodes_to_trick) {
+  /**
+   * @name Phases of the distributed row-split sync.
+   *
+   * Split out so that multi-target builders can overlap the allreduce of one target
+   * with the local phases of another, see @ref PendingCollective.
+   */
+  /**@{*/
+  [[nodiscard]] bool CanPipelineSync() const { return is_distributed_ && !is_col_split_; }
+
+  /** @brief Merge the per-thread histograms into the cache. */
+  void ReduceThreadHist(std::vector<bst_node_t> const &nodes_to_build) {
+    if (feature_parallel_) {
+      // Threads wrote into the shared histograms directly, there is nothing to merge.
+      return;
+    }
     auto n_total_bins = buffer_.TotalBins();
+    auto grain = common::GrainSize(n_total_bins * nodes_to_build.size(), this->n_threads_, 512);
     common::BlockedSpace2d space(
-        nodes_to_build.size(), [&](std::size_t) { return n_total_bins; }, 1024);
-    common::ParallelFor2d(space, this->n_threads_, [&](size_t node, common::Range1d r) {
-      // Merging histograms from each thread.
-      this->buffer_.ReduceHist(node, r.begin(), r.end());
-    });
-    if (is_distributed_ && !is_col_split_) {
-      // The cache is contiguous, we can perform allreduce for all nodes in one go.
-      CHECK(!nodes_to_build.empty());
-      auto first_nidx = nodes_to_build.front();
-      std::size_t n = n_total_bins * nodes_to_build.size() * 2;
-      auto rc = collective::Allreduce(
-          ctx, linalg::MakeVec(reinterpret_cast<double *>(this->hist_[first_nidx].data()), n),
-          collective::Op::kSum);
-      SafeColl(rc);
+        nodes_to_build.size(), [&](std::size_t) { return n_total_bins; }, grain);
+    common::ParallelFor2d("ReduceHist", space, this->n_threads_,
+                          [&](size_t node, common::Range1d r) {
+                            this->buffer_.ReduceHist(node, r.begin(), r.end());
+                          });
+  }
+
+  /** @brief Launch the allreduce over the built nodes on a background thread. */
+  [[nodiscard]] collective::PendingCollective StartSync(
+      Context const *ctx, std::vector<bst_node_t> const &nodes_to_build) {
+    // The cache is contiguous, we can perform allreduce for all nodes in one go.
+    CHECK(!nodes_to_build.empty());
+    auto n_total_bins = buffer_.TotalBins();
+    auto first_nidx = nodes_to_build.front();
+    std::size_t n = n_total_bins * nodes_to_build.size() * 2;
+    auto values = common::Span{reinterpret_cast<double *>(this->hist_[first_nidx].data()), n};
+    if (sparse_sync_) {
+      collective::CommGroup const *pcomm = collective::GlobalCommGroup().get();
+      return collective::PendingCollective{std::async(
+          std::launch::async, [ctx, pcomm, values] { return SparseSyncHist(ctx, *pcomm, values); })};
     }
+    return collective::AllreduceAsync(ctx, linalg::MakeVec(values.data(), values.size()),
+                                      collective::Op::kSum);
+  }
 
-    common::BlockedSpace2d const &subspace =
-        nodes_to_trick.size() == nodes_to_build.size()
-            ? space
-            : common::BlockedSpace2d{nodes_to_trick.size(),
-                                     [&](std::size_t) { return n_total_bins; }, 1024};
+  /** @brief Fill the trick nodes by subtraction, requires the globally reduced values. */
+  void FinishSync(RegTree const *p_tree, std::vector<bst_node_t> const &nodes_to_trick) {
+    auto n_total_bins = buffer_.TotalBins();
+    auto grain = common::GrainSize(n_total_bins * nodes_to_trick.size(), this->n_threads_, 512);
+    common::BlockedSpace2d subspace{nodes_to_trick.size(),
+                                    [&](std::size_t) { return n_total_bins; }, grain};
     common::ParallelFor2d(
         subspace, this->n_threads_, [&](std::size_t nidx_in_set, common::Range1d r) {
           auto subtraction_nidx = nodes_to_trick[nidx_in_set];
-          auto parent_id = p_tree->Parent(subtraction_nidx);
-          auto sibling_nidx = p_tree->IsLeftChild(subtraction_nidx) ? p_tree->RightChild(parent_id)
-                                                                    : p_tree->LeftChild(parent_id);
+          auto sibling_nidx = SubtractionSibling(p_tree, subtraction_nidx);
           auto sibling_hist = this->hist_[sibling_nidx];
-          auto parent_hist = this->hist_[parent_id];
+          auto parent_hist = this->hist_[p_tree->Parent(subtraction_nidx)];
           auto subtract_hist = this->hist_[subtraction_nidx];
           common::SubtractionHist(subtract_hist, parent_hist, sibling_hist, r.begin(), r.end());
         });
   }
+  /**@}*/
+
+  void SyncHistogram(Context const *ctx, RegTree const *p_tree,
+                     std::vector<bst_node_t> const &nodes_to_build,
+                     std::vector<bst_node_t> const &nodes_to_trick) {
+    auto n_total_bins = buffer_.TotalBins();
+    auto subtraction_sibling = [&](bst_node_t subtraction_nidx) {
+      return SubtractionSibling(p_tree, subtraction_nidx);
+    };
+
+    if (this->CanPipelineSync()) {
+      // Two-phase sync: all nodes must be reduced before the allreduce, and all
+      // subtractions depend on the globally aggregated histograms.
+      this->ReduceThreadHist(nodes_to_build);
+      if (!sync_stats_) {
+        SafeColl(this->StartSync(ctx, nodes_to_build).Get());
+      } else {
+        // Time the blocking wait.  The straggler of a level barely waits while everyone
+        // else waits for it, so the cross-worker skew of the wait time is the stall the
+        // straggler is causing.
+        common::Timer timer;
+        timer.Start();
+        SafeColl(this->StartSync(ctx, nodes_to_build).Get());
+        timer.Stop();
+        auto wait = timer.ElapsedSeconds();
+        // Negation turns the min into a max, one allreduce gets both ends.
+        std::array<double, 2> w{wait, -wait};
+        SafeColl(collective::Allreduce(ctx, linalg::MakeVec(w.data(), w.size()),
+                                       collective::Op::kMax));
+        LOG(INFO) << "Histogram sync: " << nodes_to_build.size() << " nodes, waited " << wait
+                  << "s, straggler skew " << (w[0] + w[1]) << "s.";
+      }
+      this->FinishSync(p_tree, nodes_to_trick);
+      return;
+    }
+
+    // Local training.  The subtraction for a node only depends on its sibling's
+    // reduction over the same bin range, so the reduction and the subtraction are fused
+    // into a single dynamically scheduled pass instead of synchronizing all threads
+    // between the two phases.  Dynamic scheduling matters here: chunks that carry a
+    // subtraction do twice the work, and deep unbalanced trees otherwise serialize on
+    // the slowest node of each level.
+    std::vector<bst_node_t> sub_nidx_for_build(nodes_to_build.size(), RegTree::kInvalidNodeId);
+    std::vector<bst_node_t> orphaned_subs;  // trick nodes whose sibling isn't built here
+    for (auto subtraction_nidx : nodes_to_trick) {
+      auto sibling_nidx = subtraction_sibling(subtraction_nidx);
+      auto it = std::find(nodes_to_build.cbegin(), nodes_to_build.cend(), sibling_nidx);
+      if (it != nodes_to_build.cend()) {
+        sub_nidx_for_build[it - nodes_to_build.cbegin()] = subtraction_nidx;
+      } else {
+        orphaned_subs.push_back(subtraction_nidx);
+      }
+    }
+
+    constexpr std::size_t kChunkBins = 1024;
+    auto n_chunks_per_node = common::DivRoundUp(static_cast<std::size_t>(n_total_bins), kChunkBins);
+    auto n_chunks = nodes_to_build.size() * n_chunks_per_node;
+    common::ParallelFor(n_chunks, this->n_threads_, common::Sched::Guided(), [&](std::size_t i) {
+      auto nidx_in_set = i / n_chunks_per_node;
+      auto begin = (i % n_chunks_per_node) * kChunkBins;
+      auto end = std::min(begin + kChunkBins, static_cast<std::size_t>(n_total_bins));
+      this->buffer_.ReduceHist(nidx_in_set, begin, end);
+
+      auto subtraction_nidx = sub_nidx_for_build[nidx_in_set];
+      if (subtraction_nidx != RegTree::kInvalidNodeId) {
+        auto sibling_hist = this->hist_[nodes_to_build[nidx_in_set]];
+        auto parent_hist = this->hist_[p_tree->Parent(subtraction_nidx)];
+        auto subtract_hist = this->hist_[subtraction_nidx];
+        common::SubtractionHist(subtract_hist, parent_hist, sibling_hist, begin, end);
+      }
+    });
+
+    if (!orphaned_subs.empty()) {
+      common::BlockedSpace2d subspace{orphaned_subs.size(),
+                                      [&](std::size_t) { return n_total_bins; }, kChunkBins};
+      common::ParallelFor2d(
+          subspace, this->n_threads_, [&](std::size_t nidx_in_set, common::Range1d r) {
+            auto subtraction_nidx = orphaned_subs[nidx_in_set];
+            auto sibling_hist = this->hist_[subtraction_sibling(subtraction_nidx)];
+            auto parent_hist = this->hist_[p_tree->Parent(subtraction_nidx)];
+            auto subtract_hist = this->hist_[subtraction_nidx];
+            common::SubtractionHist(subtract_hist, parent_hist, sibling_hist, r.begin(), r.end());
+          });
+    }
+  }
 
  public:
   /* Getters for tests. */
   [[nodiscard]] BoundedHistCollection const &Histogram() const { return hist_; }
   [[nodiscard]] BoundedHistCollection &Histogram() { return hist_; }
   auto &Buffer() { return buffer_; }
+  // Whether the per-thread partials are single precision; the fused multi-target kernel
+  // only scatters into double precision rows.
+  [[nodiscard]] bool FloatHist() const { return float_hist_; }
 };
 
 // Construct a work space for building histogram.  Eventually we should move this
 // function into histogram builder once hist tree method supports external memory.
 template <typename Partitioner>
 common::BlockedSpace2d ConstructHistSpace(Partitioner const &partitioners,
-                                          std::vector<bst_node_t> const &nodes_to_build) {
+                                          std::vector<bst_node_t> const &nodes_to_build,
+                                          std::int32_t n_threads) {
   // FIXME(jiamingy): Handle different size of space.  Right now we use the maximum
   // partition size for the buffer, which might not be efficient if partition sizes
   // has significant variance.
@@ -232,8 +495,12 @@ common::BlockedSpace2d ConstructHistSpace(Partitioner const &partitioners,
       k++;
     }
   }
+  auto total = std::accumulate(partition_size.cbegin(), partition_size.cend(),
+                               static_cast<std::size_t>(0));
+  auto grain = common::GrainSize(total, n_threads, 256);
   common::BlockedSpace2d space{
-      nodes_to_build.size(), [&](size_t nidx_in_set) { return partition_size[nidx_in_set]; }, 256};
+      nodes_to_build.size(), [&](size_t nidx_in_set) { return partition_size[nidx_in_set]; },
+      grain};
   return space;
 }
 
@@ -244,6 +511,85 @@ class MultiHistogramBuilder {
   std::vector<HistogramBuilder> target_builders_;
   Context const *ctx_;
 
+  template <bool any_missing>
+  void BuildLocalHistFused(common::BlockedSpace2d const &space, GHistIndexMatrix const &gidx,
+                           std::vector<bst_node_t> const &nodes_to_build,
+                           common::RowSetCollection const &row_set_collection,
+                           linalg::MatrixView<GradientPair const> gpair) {
+    auto n_targets = static_cast<bst_target_t>(target_builders_.size());
+    common::ParallelFor2d("BuildHistFused", space, ctx_->Threads(),
+                          [&](size_t nid_in_set, common::Range1d r) {
+      const auto tid = static_cast<unsigned>(omp_get_thread_num());
+      bst_node_t const nidx = nodes_to_build[nid_in_set];
+      auto const &elem = row_set_collection[nidx];
+      auto start_of_row_set = std::min(r.begin(), elem.Size());
+      auto end_of_row_set = std::min(r.end(), elem.Size());
+      auto rid_set = common::Span<common::RowIndexT const>{elem.begin() + start_of_row_set,
+                                                           elem.begin() + end_of_row_set};
+      std::vector<common::GHistRow> hists(n_targets);
+      for (bst_target_t t{0}; t < n_targets; ++t) {
+        hists[t] = target_builders_[t].Buffer().GetInitializedHist(tid, nid_in_set);
+      }
+      if (rid_set.size() != 0) {
+        common::BuildHistMulti<any_missing>(gpair, rid_set, gidx,
+                                            common::Span<common::GHistRow const>{hists});
+      }
+    });
+  }
+
+  /**
+   * @brief Fused build over all targets.  The bin indices are computed once per row and
+   *        every target's gradient pair is scattered into its own histogram, instead of
+   *        sweeping the gradient index once per target.
+   */
+  void BuildHistFused(std::size_t page_idx, common::BlockedSpace2d const &space,
+                      GHistIndexMatrix const &gidx,
+                      common::RowSetCollection const &row_set_collection,
+                      std::vector<bst_node_t> const &nodes_to_build,
+                      linalg::MatrixView<GradientPair const> gpair) {
+    CHECK(gpair.CContiguous());
+    if (page_idx == 0) {
+      for (auto &builder : target_builders_) {
+        builder.ResetBuffer(space, nodes_to_build);
+      }
+    }
+    if (gidx.IsDense()) {
+      this->BuildLocalHistFused<false>(space, gidx, nodes_to_build, row_set_collection, gpair);
+    } else {
+      this->BuildLocalHistFused<true>(space, gidx, nodes_to_build, row_set_collection, gpair);
+    }
+  }
+
+  /**
+   * @brief Sync all targets, overlapping each target's allreduce with the local phases
+   *        of its neighbours when running distributed with row split.
+   */
+  void SyncHistograms(Context const *ctx, RegTree const *p_tree,
+                      std::vector<bst_node_t> const &nodes_to_build,
+                      std::vector<bst_node_t> const &nodes_to_trick) {
+    auto n_targets = static_cast<bst_target_t>(target_builders_.size());
+    if (n_targets == 1 || !target_builders_.front().CanPipelineSync()) {
+      for (bst_target_t t{0}; t < n_targets; ++t) {
+        target_builders_[t].SyncHistogram(ctx, p_tree, nodes_to_build, nodes_to_trick);
+      }
+      return;
+    }
+
+    // Only one collective can be in flight at a time, so the pipeline runs target t's
+    // allreduce while merging the thread histograms of target t+1 and filling the trick
+    // nodes of target t-1.
+    target_builders_.front().ReduceThreadHist(nodes_to_build);
+    auto pending = target_builders_.front().StartSync(ctx, nodes_to_build);
+    for (bst_target_t t{1}; t < n_targets; ++t) {
+      target_builders_[t].ReduceThreadHist(nodes_to_build);
+      SafeColl(pending.Get());
+      pending = target_builders_[t].StartSync(ctx, nodes_to_build);
+      target_builders_[t - 1].FinishSync(p_tree, nodes_to_trick);
+    }
+    SafeColl(pending.Get());
+    target_builders_.back().FinishSync(p_tree, nodes_to_trick);
+  }
+
  public:
   /**
    * @brief Build the histogram for root node.
@@ -260,7 +606,7 @@ class MultiHistogramBuilder {
     std::vector<bst_node_t> nodes{best.nid};
     std::vector<bst_node_t> dummy_sub;
 
-    auto space = ConstructHistSpace(partitioners, nodes);
+    auto space = ConstructHistSpace(partitioners, nodes, ctx_->Threads());
     for (bst_target_t t{0}; t < n_targets; ++t) {
       this->target_builders_[t].AddHistRows(p_tree, &nodes, &dummy_sub, false);
     }
@@ -268,18 +614,21 @@ class MultiHistogramBuilder {
 
     std::size_t page_idx{0};
     for (auto const &gidx : p_fmat->GetBatches<GHistIndexMatrix>(ctx_, param)) {
-      for (bst_target_t t{0}; t < n_targets; ++t) {
-        auto t_gpair = gpair.Slice(linalg::All(), t);
-        this->target_builders_[t].BuildHist(page_idx, space, gidx,
-                                            partitioners[page_idx].Partitions(), nodes, t_gpair,
-                                            force_read_by_column);
+      if (n_targets > 1 && !force_read_by_column && !target_builders_.front().FloatHist()) {
+        this->BuildHistFused(page_idx, space, gidx, partitioners[page_idx].Partitions(), nodes,
+                             gpair);
+      } else {
+        for (bst_target_t t{0}; t < n_targets; ++t) {
+          auto t_gpair = gpair.Slice(linalg::All(), t);
+          this->target_builders_[t].BuildHist(page_idx, space, gidx,
+                                              partitioners[page_idx].Partitions(), nodes, t_gpair,
+                                              force_read_by_column);
+        }
       }
       ++page_idx;
     }
 
-    for (bst_target_t t = 0; t < p_tree->NumTargets(); ++t) {
-      this->target_builders_[t].SyncHistogram(ctx_, p_tree, nodes, dummy_sub);
-    }
+    this->SyncHistograms(ctx_, p_tree, nodes, dummy_sub);
   }
   /**
    * @brief Build histogram for left and right child of valid candidates
@@ -304,23 +653,27 @@ class MultiHistogramBuilder {
       target_builders_[t].AddHistRows(p_tree, &nodes_to_build, &nodes_to_sub, false);
     }
 
-    auto space = ConstructHistSpace(partitioners, nodes_to_build);
+    auto space = ConstructHistSpace(partitioners, nodes_to_build, ctx->Threads());
     std::size_t page_idx{0};
     for (auto const &page : p_fmat->GetBatches<GHistIndexMatrix>(ctx_, param)) {
       CHECK_EQ(gpair.Shape(1), p_tree->NumTargets());
-      for (bst_target_t t = 0; t < p_tree->NumTargets(); ++t) {
-        auto t_gpair = gpair.Slice(linalg::All(), t);
-        CHECK_EQ(t_gpair.Shape(0), p_fmat->Info().num_row_);
-        this->target_builders_[t].BuildHist(page_idx, space, page,
-                                            partitioners[page_idx].Partitions(), nodes_to_build,
-                                            t_gpair, force_read_by_column);
+      CHECK_EQ(gpair.Shape(0), p_fmat->Info().num_row_);
+      if (p_tree->NumTargets() > 1 && !force_read_by_column &&
+          !target_builders_.front().FloatHist()) {
+        this->BuildHistFused(page_idx, space, page, partitioners[page_idx].Partitions(),
+                             nodes_to_build, gpair);
+      } else {
+        for (bst_target_t t = 0; t < p_tree->NumTargets(); ++t) {
+          auto t_gpair = gpair.Slice(linalg::All(), t);
+          this->target_builders_[t].BuildHist(page_idx, space, page,
+                                              partitioners[page_idx].Partitions(), nodes_to_build,
+                                              t_gpair, force_read_by_column);
+        }
       }
       page_idx++;
     }
 
-    for (bst_target_t t = 0; t < p_tree->NumTargets(); ++t) {
-      this->target_builders_[t].SyncHistogram(ctx, p_tree, nodes_to_build, nodes_to_sub);
-    }
+    this->SyncHistograms(ctx, p_tree, nodes_to_build, nodes_to_sub);
   }
 
   [[nodiscard]] auto const &Histogram(bst_target_t t) const {
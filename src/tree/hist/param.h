@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>  // for size_t
+#include <cstdint>  // for int32_t
 #include <limits>   // for numeric_limits
 
 #include "xgboost/parameter.h"   // for XGBoostParameter
@@ -24,6 +25,48 @@ struct HistMakerTrainParam : public XGBoostParameter<HistMakerTrainParam> {
 
   bool debug_synchronize{false};
   bool extmem_single_page{false};
+  // Stream gradients as two contiguous grad/hess arrays in the histogram build.
+  bool use_soa_gpair{false};
+  // Accumulate GPU shared memory histograms with one 32-bit integer per gradient
+  // component instead of 64, trading precision for occupancy.
+  bool use_narrow_hist{false};
+  // Accumulate the per-thread CPU partial histograms in single precision.  The per-node
+  // results stay double precision, the merge widens each float term.
+  bool float_hist{false};
+  // Run-length encode near-empty histograms before the distributed histogram sync
+  // instead of reducing the dense buffers.
+  bool sparse_hist_sync{false};
+  // Report per-level histogram sync wait times and the cross-worker skew, for
+  // diagnosing stragglers.
+  bool hist_sync_stats{false};
+  // Capture the per-level GPU histogram kernel batch into a CUDA graph and replay it as
+  // a single graph launch.
+  bool use_cuda_graph{false};
+  // Rebuild the histogram cuts from hessian-weighted sketches every k-th tree.  0
+  // disables the refresh.
+  std::int32_t rebin_interval{0};
+  // Partition only the sampled rows when subsample < 1, skipping zero-gradient rows in
+  // the histogram build and the position update.
+  bool compact_subsample{false};
+  // Reuse row partitions from the previous tree for splits that match it exactly.
+  // Exact-match reuse does not change the resulting trees.
+  bool reuse_partition{true};
+  // GOSS rates, used when sampling_method is gradient_based.  Rows in the top
+  // goss_top_rate fraction by gradient magnitude are always kept, goss_other_rate of
+  // the rest is sampled uniformly and amplified to stay unbiased.
+  float goss_top_rate{0.2f};
+  float goss_other_rate{0.1f};
+  // Approximate split evaluation: restrict deep nodes to the top-k features ranked by
+  // accumulated split gain.  0 keeps the evaluation exact.
+  bst_feature_t top_k_features{0};
+  // Every n-th tree evaluates the full feature set when top_k_features is active.
+  std::int32_t top_k_sweep{10};
+  // Reuse the hessian-weighted sketch of the approx tree method across iterations while
+  // the share of rows whose hessian drifted beyond this relative tolerance stays below
+  // it.  0 rebuilds the sketch every iteration.
+  float sketch_hess_tol{0.0f};
+  // Force a full sketch rebuild after this many iterations of reuse.
+  std::int32_t sketch_max_stale_rounds{8};
 
   void CheckTreesSynchronized(Context const* ctx, RegTree const* local_tree) const;
 
@@ -44,6 +87,97 @@ struct HistMakerTrainParam : public XGBoostParameter<HistMakerTrainParam> {
         .set_lower_bound(1)
         .describe("Maximum number of nodes in histogram cache.");
     DMLC_DECLARE_FIELD(extmem_single_page).set_default(false);
+    DMLC_DECLARE_FIELD(use_soa_gpair)
+        .set_default(false)
+        .describe("Use structure-of-arrays gradient layout for the histogram build.");
+    DMLC_DECLARE_FIELD(use_narrow_hist)
+        .set_default(false)
+        .describe(
+            "Accumulate GPU shared memory histograms in 32-bit fixed point instead of "
+            "64-bit, halving the shared memory footprint at reduced precision.");
+    DMLC_DECLARE_FIELD(float_hist)
+        .set_default(false)
+        .describe(
+            "Accumulate the per-thread partial histograms in single precision, halving "
+            "their footprint so they stay cache resident at large max_bin.  The merged "
+            "per-node histograms remain double precision.  Takes precedence over "
+            "use_soa_gpair.  Only used by the CPU hist tree method.");
+    DMLC_DECLARE_FIELD(sparse_hist_sync)
+        .set_default(false)
+        .describe(
+            "Run-length encode near-empty histograms for the distributed sync, reducing "
+            "network traffic for deep nodes.  Only used by row-split CPU training.");
+    DMLC_DECLARE_FIELD(hist_sync_stats)
+        .set_default(false)
+        .describe(
+            "Log the time each worker spends blocked in the distributed histogram sync "
+            "and the cross-worker skew per tree level.  A large skew points at a "
+            "straggler.  Adds one small allreduce per level.  Only used by row-split "
+            "CPU training.");
+    DMLC_DECLARE_FIELD(use_cuda_graph)
+        .set_default(false)
+        .describe(
+            "Capture the per-level histogram build kernels into a CUDA graph and replay "
+            "them as a single graph launch.  Helps launch-bound training on small "
+            "datasets.  Only used by the GPU hist tree method.");
+    DMLC_DECLARE_FIELD(rebin_interval)
+        .set_default(0)
+        .set_lower_bound(0)
+        .describe(
+            "Refresh the histogram cuts from hessian-weighted sketches every k-th tree, "
+            "concentrating the bin budget on regions with remaining gradient mass.  0 "
+            "disables the refresh.  Requires access to the original data, so it is "
+            "ignored for QuantileDMatrix.");
+    DMLC_DECLARE_FIELD(compact_subsample)
+        .set_default(false)
+        .describe(
+            "Partition only the sampled rows when subsample < 1, so the per-iteration "
+            "cost scales with the number of sampled rows.  The prediction cache fast "
+            "path is disabled while active.");
+    DMLC_DECLARE_FIELD(reuse_partition)
+        .set_default(true)
+        .describe(
+            "Reuse row partitions from the previous tree for splits that match it "
+            "exactly, skipping the row scan for shared upper levels.  Trees in a "
+            "multi-class round often share their first levels.  Results are "
+            "unchanged.");
+    DMLC_DECLARE_FIELD(goss_top_rate)
+        .set_default(0.2f)
+        .set_range(0.0f, 1.0f)
+        .describe(
+            "Fraction of rows with the largest gradient magnitude kept deterministically "
+            "when sampling_method is gradient_based with the CPU hist tree method.");
+    DMLC_DECLARE_FIELD(goss_other_rate)
+        .set_default(0.1f)
+        .set_range(0.0f, 1.0f)
+        .describe(
+            "Fraction of the remaining rows sampled uniformly and amplified when "
+            "sampling_method is gradient_based with the CPU hist tree method.");
+    DMLC_DECLARE_FIELD(top_k_features)
+        .set_default(0)
+        .describe(
+            "Evaluate only the top-k features ranked by accumulated split gain at deep "
+            "nodes.  0 disables the filter.");
+    DMLC_DECLARE_FIELD(top_k_sweep)
+        .set_default(10)
+        .set_lower_bound(0)
+        .describe(
+            "Evaluate the full feature set every n-th tree when top_k_features is "
+            "active.  0 disables the periodic sweeps.");
+    DMLC_DECLARE_FIELD(sketch_hess_tol)
+        .set_default(0.0f)
+        .set_range(0.0f, 1.0f)
+        .describe(
+            "Reuse the hessian-weighted sketch across iterations while the share of "
+            "rows whose hessian changed by more than this relative tolerance stays "
+            "below it.  0 rebuilds the sketch every iteration.  Only used by the approx "
+            "tree method.");
+    DMLC_DECLARE_FIELD(sketch_max_stale_rounds)
+        .set_default(8)
+        .set_lower_bound(1)
+        .describe(
+            "Force a full sketch rebuild after this many iterations of reuse when "
+            "sketch_hess_tol is active.");
   }
 };
 }  // namespace xgboost::tree
@@ -4,11 +4,17 @@
 #ifndef XGBOOST_TREE_HIST_SAMPLER_H_
 #define XGBOOST_TREE_HIST_SAMPLER_H_
 
+#include <cmath>    // std::abs
 #include <cstddef>  // std::size-t
 #include <cstdint>  // std::uint64_t
+#include <functional>  // std::greater
+#include <limits>   // std::numeric_limits
 #include <random>   // bernoulli_distribution, linear_congruential_engine
+#include <vector>   // std::vector
 
-#include "../../common/random.h"  // GlobalRandom
+#include "../../common/algorithm.h"        // Sort
+#include "../../common/random.h"           // GlobalRandom
+#include "../../common/threading_utils.h"  // ParallelFor
 #include "../param.h"             // TrainParam
 #include "xgboost/base.h"         // GradientPair
 #include "xgboost/context.h"      // Context
@@ -44,7 +50,77 @@ struct RandomReplace {
   }
 };
 
-// Only uniform sampling, no gradient-based yet.
+// Only uniform sampling, no gradient-based yet.  Fused copy + sample: reads the gradient
+// from `in` and writes the sampled result into `out` in a single pass, instead of a copy
+// sweep followed by a sampling sweep over the same array.  Draws the same coin flips as
+// the in-place overload below.
+inline void SampleGradient(Context const* ctx, TrainParam param,
+                           linalg::MatrixView<GradientPair const> in,
+                           linalg::MatrixView<GradientPair> out) {
+  CHECK(out.Contiguous());
+  CHECK_EQ(in.Shape(0), out.Shape(0));
+  CHECK_EQ(in.Shape(1), out.Shape(1));
+  CHECK_EQ(param.sampling_method, TrainParam::kUniform)
+      << "Only uniform sampling is supported, gradient-based sampling is only support by GPU Hist.";
+
+  bst_idx_t n_samples = out.Shape(0);
+  std::size_t n_targets = out.Shape(1);
+  auto n_threads = static_cast<std::size_t>(ctx->Threads());
+
+  if (param.subsample >= 1.0) {
+    common::ParallelFor(n_samples, n_threads, [&](std::size_t i) {
+      for (std::size_t j = 0; j < n_targets; ++j) {
+        out(i, j) = in(i, j);
+      }
+    });
+    return;
+  }
+  auto& rnd = common::GlobalRandom();
+
+#if XGBOOST_CUSTOMIZE_GLOBAL_PRNG
+  std::bernoulli_distribution coin_flip(param.subsample);
+  CHECK_EQ(n_targets, 1) << "Multi-target with sampling for R is not yet supported.";
+  for (std::size_t i = 0; i < n_samples; ++i) {
+    if (!(in(i, 0).GetHess() >= 0.0f && coin_flip(rnd)) || in(i, 0).GetGrad() == 0.0f) {
+      out(i, 0) = GradientPair(0);
+    } else {
+      out(i, 0) = in(i, 0);
+    }
+  }
+#else
+  std::uint64_t initial_seed = rnd();
+
+  std::size_t const discard_size = n_samples / n_threads;
+  std::bernoulli_distribution coin_flip(param.subsample);
+
+  dmlc::OMPException exc;
+#pragma omp parallel num_threads(n_threads)
+  {
+    exc.Run([&]() {
+      const size_t tid = omp_get_thread_num();
+      const size_t ibegin = tid * discard_size;
+      const size_t iend = (tid == (n_threads - 1)) ? n_samples : ibegin + discard_size;
+
+      const uint64_t displaced_seed = RandomReplace::SimpleSkip(
+          ibegin, initial_seed, RandomReplace::kBase, RandomReplace::kMod);
+      RandomReplace::EngineT eng(displaced_seed);
+      for (std::size_t i = ibegin; i < iend; ++i) {
+        if (coin_flip(eng)) {
+          for (std::size_t j = 0; j < n_targets; ++j) {
+            out(i, j) = in(i, j);
+          }
+        } else {
+          for (std::size_t j = 0; j < n_targets; ++j) {
+            out(i, j) = GradientPair{};
+          }
+        }
+      }
+    });
+  }
+  exc.Rethrow();
+#endif  // XGBOOST_CUSTOMIZE_GLOBAL_PRNG
+}
+
 inline void SampleGradient(Context const* ctx, TrainParam param,
                            linalg::MatrixView<GradientPair> out) {
   CHECK(out.Contiguous());
@@ -104,6 +180,81 @@ inline void SampleGradient(Context const* ctx, TrainParam param,
   exc.Rethrow();
 #endif  // XGBOOST_CUSTOMIZE_GLOBAL_PRNG
 }
+/**
+ * \brief Gradient-based one-side sampling (GOSS).
+ *
+ *   Rows in the top @p top_rate fraction by gradient magnitude keep their gradient
+ *   unchanged; a @p other_rate fraction of the remaining rows is sampled uniformly and
+ *   scaled by (1 - top_rate) / other_rate so the total gradient distribution stays
+ *   unbiased.  Everything else is zeroed out.  Reads from `in` and writes into `out`,
+ *   which may alias.
+ */
+inline void GossSampleGradient(Context const* ctx, float top_rate, float other_rate,
+                               linalg::MatrixView<GradientPair const> in,
+                               linalg::MatrixView<GradientPair> out) {
+  CHECK(out.Contiguous());
+  CHECK_EQ(in.Shape(0), out.Shape(0));
+  CHECK_EQ(out.Shape(1), 1) << "GOSS is not supported for multi-target trees.";
+  bst_idx_t n_samples = out.Shape(0);
+  auto n_threads = static_cast<std::size_t>(ctx->Threads());
+
+  auto k = static_cast<std::size_t>(top_rate * n_samples);
+  if (k >= n_samples) {
+    common::ParallelFor(n_samples, n_threads, [&](std::size_t i) { out(i, 0) = in(i, 0); });
+    return;
+  }
+
+  // Threshold for the top-k selection.  A parallel sort over the magnitudes is cheaper
+  // than it looks: the array is flat floats and the selection runs once per tree.
+  std::vector<float> mag(n_samples);
+  common::ParallelFor(n_samples, n_threads,
+                      [&](std::size_t i) { mag[i] = std::abs(in(i, 0).GetGrad()); });
+  common::Sort(ctx, mag.begin(), mag.end(), std::greater<float>{});
+  // k == 0 keeps only the randomly sampled rest, matching top_rate = 0.
+  float threshold = k == 0 ? std::numeric_limits<float>::infinity() : mag[k - 1];
+
+  float keep_prob = other_rate / (1.0f - top_rate);
+  float amplify = (1.0f - top_rate) / other_rate;
+
+  auto& rnd = common::GlobalRandom();
+  std::uint64_t initial_seed = rnd();
+
+  std::size_t const discard_size = n_samples / n_threads;
+  std::bernoulli_distribution coin_flip(keep_prob);
+
+  dmlc::OMPException exc;
+#pragma omp parallel num_threads(n_threads)
+  {
+    exc.Run([&]() {
+      const size_t tid = omp_get_thread_num();
+      const size_t ibegin = tid * discard_size;
+      const size_t iend = (tid == (n_threads - 1)) ? n_samples : ibegin + discard_size;
+
+      const uint64_t displaced_seed = RandomReplace::SimpleSkip(
+          ibegin, initial_seed, RandomReplace::kBase, RandomReplace::kMod);
+      RandomReplace::EngineT eng(displaced_seed);
+      for (std::size_t i = ibegin; i < iend; ++i) {
+        // One flip per row whatever the branch, the drawn sequence stays aligned with
+        // the row index.
+        bool keep = coin_flip(eng);
+        auto g = in(i, 0);
+        if (std::abs(g.GetGrad()) >= threshold) {
+          out(i, 0) = g;
+        } else if (keep) {
+          out(i, 0) = GradientPair{g.GetGrad() * amplify, g.GetHess() * amplify};
+        } else {
+          out(i, 0) = GradientPair{};
+        }
+      }
+    });
+  }
+  exc.Rethrow();
+}
+
+inline void GossSampleGradient(Context const* ctx, float top_rate, float other_rate,
+                               linalg::MatrixView<GradientPair> out) {
+  GossSampleGradient(ctx, top_rate, other_rate, linalg::MatrixView<GradientPair const>{out}, out);
+}
 }  // namespace tree
 }  // namespace xgboost
 #endif  // XGBOOST_TREE_HIST_SAMPLER_H_
@@ -4,6 +4,8 @@
  * \brief Implementation for the approx tree method.
  */
 #include <algorithm>  // for max, transform, fill_n
+#include <array>      // for array
+#include <cmath>      // for abs
 #include <cstddef>    // for size_t
 #include <map>        // for map
 #include <memory>     // for allocator, unique_ptr, make_shared, make_unique
@@ -42,9 +44,10 @@ namespace xgboost::tree {
 DMLC_REGISTRY_FILE_TAG(updater_approx);
 
 namespace {
-// Return the BatchParam used by DMatrix.
-auto BatchSpec(TrainParam const &p, common::Span<float> hess, ObjInfo const task) {
-  return BatchParam{p.max_bin, hess, !task.const_hess};
+// Return the BatchParam used by DMatrix.  `regen` requests a fresh hessian-weighted
+// sketch, it is ignored when the objective has a constant hessian.
+auto BatchSpec(TrainParam const &p, common::Span<float> hess, ObjInfo const task, bool regen) {
+  return BatchParam{p.max_bin, hess, !task.const_hess && regen};
 }
 
 auto BatchSpec(TrainParam const &p, common::Span<float> hess) {
@@ -61,6 +64,8 @@ class GlobalApproxBuilder {
   MultiHistogramBuilder histogram_builder_;
   Context const *ctx_;
   ObjInfo const *const task_;
+  // Whether InitData must regenerate the gradient index from a fresh sketch.
+  bool regen_sketch_{true};
 
   std::vector<CommonRowPartitioner> partitioner_;
   // Pointer to last updated tree, used for update prediction cache.
@@ -79,7 +84,7 @@ class GlobalApproxBuilder {
     partitioner_.clear();
     // Generating the GHistIndexMatrix is quite slow, is there a way to speed it up?
     for (auto const &page :
-         p_fmat->GetBatches<GHistIndexMatrix>(ctx_, BatchSpec(*param_, hess, *task_))) {
+         p_fmat->GetBatches<GHistIndexMatrix>(ctx_, BatchSpec(*param_, hess, *task_, regen_sketch_))) {
       if (n_total_bins == 0) {
         n_total_bins = page.cut.TotalBins();
         feature_values_ = page.cut;
@@ -166,13 +171,14 @@ class GlobalApproxBuilder {
   explicit GlobalApproxBuilder(TrainParam const *param, HistMakerTrainParam const *hist_param,
                                MetaInfo const &info, Context const *ctx,
                                std::shared_ptr<common::ColumnSampler> column_sampler,
-                               ObjInfo const *task, common::Monitor *monitor)
+                               ObjInfo const *task, bool regen_sketch, common::Monitor *monitor)
       : param_{param},
         hist_param_{hist_param},
         col_sampler_{std::move(column_sampler)},
         evaluator_{ctx, param_, info, col_sampler_},
         ctx_{ctx},
         task_{task},
+        regen_sketch_{regen_sketch},
         monitor_{monitor} {}
 
   void UpdateTree(DMatrix *p_fmat, std::vector<GradientPair> const &gpair, common::Span<float> hess,
@@ -256,6 +262,50 @@ class GlobalApproxUpdater : public TreeUpdater {
   std::shared_ptr<common::ColumnSampler> column_sampler_;
   ObjInfo const *task_;
   HistMakerTrainParam hist_param_;
+  // Hessian values used for the last sketch rebuild, the matrix they belong to, and the
+  // number of iterations the sketch has been reused since.
+  DMatrix *sketch_fmat_{nullptr};
+  std::vector<float> sketch_hess_;
+  std::int32_t sketch_rounds_{0};
+
+  // Decide whether the hessian-weighted sketch needs a rebuild this iteration.  The
+  // previous sketch is reused while the share of rows whose hessian drifted beyond the
+  // tolerance stays below it, with a forced rebuild every sketch_max_stale_rounds
+  // iterations.  Workers vote through a global sum over the drift counters so the
+  // collective calls inside the sketch stay in sync.
+  bool NeedSketchRegen(DMatrix *m, std::vector<float> const &hess) {
+    if (task_->const_hess || hist_param_.sketch_hess_tol <= 0.0f) {
+      sketch_fmat_ = nullptr;
+      return true;
+    }
+    auto tol = static_cast<double>(hist_param_.sketch_hess_tol);
+    // {drifted rows, total rows, forced-rebuild votes}
+    std::array<double, 3> drift{0.0, 0.0, 0.0};
+    if (m == sketch_fmat_ && sketch_hess_.size() == hess.size() &&
+        sketch_rounds_ < hist_param_.sketch_max_stale_rounds) {
+      for (std::size_t i = 0; i < hess.size(); ++i) {
+        auto prev = static_cast<double>(sketch_hess_[i]);
+        auto chg = std::abs(static_cast<double>(hess[i]) - prev);
+        drift[0] += chg > tol * std::max(std::abs(prev), static_cast<double>(kRtEps));
+      }
+    } else {
+      drift[2] = 1.0;
+    }
+    drift[1] = static_cast<double>(hess.size());
+    if (collective::IsDistributed()) {
+      auto rc = collective::GlobalSum(ctx_, m->Info(), linalg::MakeVec(drift.data(), drift.size()));
+      collective::SafeColl(rc);
+    }
+    bool regen = drift[2] != 0.0 || drift[1] == 0.0 || drift[0] > tol * drift[1];
+    if (regen) {
+      sketch_fmat_ = m;
+      sketch_hess_ = hess;
+      sketch_rounds_ = 0;
+    } else {
+      ++sketch_rounds_;
+    }
+    return regen;
+  }
 
  public:
   explicit GlobalApproxUpdater(Context const *ctx, ObjInfo const *task)
@@ -276,10 +326,10 @@ class GlobalApproxUpdater : public TreeUpdater {
   void InitData(TrainParam const &param, linalg::Matrix<GradientPair> const *gpair,
                 linalg::Matrix<GradientPair> *sampled) {
     *sampled = linalg::Empty<GradientPair>(ctx_, gpair->Size(), 1);
-    auto in = gpair->HostView().Values();
-    std::copy(in.data(), in.data() + in.size(), sampled->HostView().Values().data());
     error::NoPageConcat(this->hist_param_.extmem_single_page);
-    SampleGradient(ctx_, param, sampled->HostView());
+    // Sample while copying into the buffer, one pass over the gradient instead of a copy
+    // sweep followed by a sampling sweep.
+    SampleGradient(ctx_, param, gpair->HostView(), sampled->HostView());
   }
 
   [[nodiscard]] char const *Name() const override { return "grow_histmaker"; }
@@ -291,8 +341,7 @@ class GlobalApproxUpdater : public TreeUpdater {
     if (!column_sampler_) {
       column_sampler_ = common::MakeColumnSampler(ctx_);
     }
-    pimpl_ = std::make_unique<GlobalApproxBuilder>(param, &hist_param_, m->Info(), ctx_,
-                                                   column_sampler_, task_, &monitor_);
+    column_sampler_->ConfigureTopK(hist_param_.top_k_features, hist_param_.top_k_sweep);
 
     linalg::Matrix<GradientPair> h_gpair;
     // Obtain the hessian values for weighted sketching
@@ -302,6 +351,10 @@ class GlobalApproxUpdater : public TreeUpdater {
     std::transform(s_gpair.begin(), s_gpair.end(), hess.begin(),
                    [](auto g) { return g.GetHess(); });
 
+    bool regen_sketch = this->NeedSketchRegen(m, hess);
+    pimpl_ = std::make_unique<GlobalApproxBuilder>(param, &hist_param_, m->Info(), ctx_,
+                                                   column_sampler_, task_, regen_sketch, &monitor_);
+
     cached_ = m;
 
     std::size_t t_idx = 0;
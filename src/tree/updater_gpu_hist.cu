@@ -105,6 +105,8 @@ struct GPUHistMakerDevice {
   HistMakerTrainParam const* hist_param_;
   std::shared_ptr<common::HistogramCuts const> const cuts_;
   std::unique_ptr<FeatureGroups> feature_groups_;
+  // Cached executable graph for the per-level histogram build batch.
+  dh::CUDAGraphExec hist_graph_;
 
   auto CreatePartitionNodes(RegTree const* p_tree, std::vector<GPUExpandEntry> const& candidates) {
     std::vector<bst_node_t> nidx(candidates.size());
@@ -235,7 +237,7 @@ struct GPUHistMakerDevice {
 
     this->histogram_.Reset(ctx_, this->hist_param_->MaxCachedHistNodes(ctx_->Device()),
                            feature_groups_->DeviceAccessor(ctx_->Device()), cuts_->TotalBins(),
-                           false);
+                           false, this->hist_param_->use_narrow_hist);
     this->monitor.Stop(__func__);
     return p_fmat;
   }
@@ -317,7 +319,8 @@ struct GPUHistMakerDevice {
     this->monitor.Stop(__func__);
   }
 
-  void BuildHist(EllpackPage const& page, std::int32_t k, bst_bin_t nidx) {
+  void BuildHist(EllpackPage const& page, std::int32_t k, bst_bin_t nidx,
+                 dh::CUDAStreamView stream) {
     monitor.Start(__func__);
     auto d_node_hist = histogram_.GetNodeHistogram(nidx);
     auto batch = page.Impl();
@@ -326,10 +329,47 @@ struct GPUHistMakerDevice {
     auto d_ridx = partitioners_.at(k)->GetRows(nidx);
     this->histogram_.BuildHistogram(ctx_->CUDACtx(), acc,
                                     feature_groups_->DeviceAccessor(ctx_->Device()), this->gpair,
-                                    d_ridx, d_node_hist, *quantiser);
+                                    d_ridx, d_node_hist, *quantiser, stream);
     monitor.Stop(__func__);
   }
 
+  /**
+   * @brief Build the histograms for a batch of independent nodes, alternating between
+   *        the default and the auxiliary stream.
+   *
+   *   Deep in the tree the per-node builds are too small to fill the device; running
+   *   every other node on the second stream lets them overlap.  The auxiliary stream is
+   *   fenced with events so that the builds order after the partition update and the
+   *   default stream observes all of them afterwards.
+   */
+  void BuildHistBatch(EllpackPage const& page, std::int32_t k,
+                      std::vector<bst_node_t> const& nidx) {
+    if (nidx.empty()) {
+      return;
+    }
+    auto cuctx = ctx_->CUDACtx();
+    auto launch = [&] {
+      dh::CUDAEvent ready;
+      ready.Record(cuctx->Stream());
+      cuctx->AuxStream().Wait(ready);
+      for (std::size_t i = 0; i < nidx.size(); ++i) {
+        auto stream = (i % 2 == 0) ? cuctx->Stream() : cuctx->AuxStream();
+        this->BuildHist(page, k, nidx[i], stream);
+      }
+      dh::CUDAEvent done;
+      done.Record(cuctx->AuxStream());
+      cuctx->Stream().Wait(done);
+    };
+    if (this->hist_param_->use_cuda_graph) {
+      // Replay the batch as one graph launch.  Levels with the same number of nodes
+      // keep the graph topology, so the cached executable is only patched with the new
+      // kernel parameters instead of re-instantiated.
+      this->hist_graph_.CaptureAndLaunch(cuctx->Stream(), launch);
+    } else {
+      launch();
+    }
+  }
+
   void ReduceHist(DMatrix* p_fmat, std::vector<GPUExpandEntry> const& candidates,
                   std::vector<bst_node_t> const& build_nidx,
                   std::vector<bst_node_t> const& subtraction_nidx) {
@@ -351,9 +391,7 @@ struct GPUHistMakerDevice {
     // Build the nodes that can not obtain the histogram using subtraction. This is the slow path.
     std::int32_t k = 0;
     for (auto const& page : p_fmat->GetBatches<EllpackPage>(ctx_, StaticBatch(true))) {
-      for (auto nidx : need_build) {
-        this->BuildHist(page, k, nidx);
-      }
+      this->BuildHistBatch(page, k, need_build);
       ++k;
     }
     for (auto nidx : need_build) {
@@ -498,9 +536,7 @@ struct GPUHistMakerDevice {
 
       monitor.Stop("UpdatePositionBatch");
 
-      for (auto nidx : build_nidx) {
-        this->BuildHist(page, k, nidx);
-      }
+      this->BuildHistBatch(page, k, build_nidx);
 
       ++k;
     }
@@ -690,7 +726,7 @@ struct GPUHistMakerDevice {
     std::int32_t k = 0;
     CHECK_EQ(p_fmat->NumBatches(), this->partitioners_.size());
     for (auto const& page : p_fmat->GetBatches<EllpackPage>(ctx_, StaticBatch(true))) {
-      this->BuildHist(page, k, kRootNIdx);
+      this->BuildHist(page, k, kRootNIdx, ctx_->CUDACtx()->Stream());
       ++k;
     }
     this->histogram_.AllReduceHist(ctx_, p_fmat->Info(), kRootNIdx, 1);
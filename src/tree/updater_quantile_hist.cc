@@ -14,6 +14,7 @@
 
 #include "../collective/aggregator.h"        // for GlobalSum
 #include "../collective/communicator-inl.h"  // for IsDistributed
+#include "../common/cancellation.h"          // for TrainingCancellation
 #include "../common/hist_util.h"             // for HistogramCuts, GHistRow
 #include "../common/linalg_op.h"             // for begin, cbegin, cend
 #include "../common/random.h"                // for ColumnSampler
@@ -54,7 +55,7 @@ void UpdateTree(common::Monitor *monitor_, linalg::MatrixView<GradientPair const
                 Updater *updater, DMatrix *p_fmat, TrainParam const *param,
                 HostDeviceVector<bst_node_t> *p_out_position, RegTree *p_tree) {
   monitor_->Start(__func__);
-  updater->InitData(p_fmat, p_tree);
+  updater->InitData(p_fmat, gpair, p_tree);
 
   Driver<ExpandEntry> driver{*param};
   auto const &tree = *p_tree;
@@ -146,7 +147,8 @@ class MultiTargetHistBuilder {
     this->evaluator_->ApplyTreeSplit(candidate, p_tree);
   }
 
-  void InitData(DMatrix *p_fmat, RegTree const *p_tree) {
+  void InitData(DMatrix *p_fmat, linalg::MatrixView<GradientPair const> /*gpair*/,
+                RegTree const *p_tree) {
     monitor_->Start(__func__);
 
     p_last_fmat_ = p_fmat;
@@ -311,6 +313,13 @@ class HistUpdater {
   ObjInfo const *task_{nullptr};
   // Context for number of threads
   Context const *ctx_{nullptr};
+  // Number of trees built by this updater, drives the periodic bin refresh.
+  std::int32_t n_trees_built_{0};
+  // Hessian values for weighted sketching, must be kept alive while the gradient index
+  // is being regenerated.
+  std::vector<float> hess_;
+  // Whether the partitioners hold only the sampled rows for the last tree.
+  bool compacted_{false};
 
  public:
   explicit HistUpdater(Context const *ctx, std::shared_ptr<common::ColumnSampler> column_sampler,
@@ -334,6 +343,10 @@ class HistUpdater {
     if (!p_last_fmat_ || !p_last_tree_ || data != p_last_fmat_) {
       return false;
     }
+    if (compacted_) {
+      // The partitioners cover only the sampled rows.
+      return false;
+    }
     monitor_->Start(__func__);
     CHECK_EQ(out_preds.Size(), data->Info().num_row_);
     UpdatePredictionCacheImpl(ctx_, p_last_tree_, partitioner_, out_preds);
@@ -342,19 +355,83 @@ class HistUpdater {
   }
 
  public:
+  /**
+   * @brief Whether the histogram cuts should be refreshed from hessian-weighted sketches
+   *        before building this tree.
+   *
+   *   Re-sketching needs the original values, so matrices without a sparse page
+   *   (QuantileDMatrix) keep the cuts from construction.
+   */
+  [[nodiscard]] bool NeedRebin(DMatrix const *fmat) const {
+    auto k = hist_param_->rebin_interval;
+    return k > 0 && n_trees_built_ > 0 && n_trees_built_ % k == 0 &&
+           fmat->PageExists<SparsePage>();
+  }
+
   // initialize temp data structure
-  void InitData(DMatrix *fmat, RegTree const *p_tree) {
+  void InitData(DMatrix *fmat, linalg::MatrixView<GradientPair const> gpair,
+                RegTree const *p_tree) {
     monitor_->Start(__func__);
+    auto batch = HistBatch(param_);
+    bool const rebin = this->NeedRebin(fmat);
+    if (rebin) {
+      // Refresh the cuts with hessian-weighted sketches.  Late rounds concentrate the
+      // remaining gradient mass in a few regions of the input space, re-binning spends
+      // the bin budget there instead of on ranges that no longer affect the splits.
+      auto h_gpair = gpair.Slice(linalg::All(), 0).Values();
+      hess_.resize(h_gpair.size());
+      std::transform(h_gpair.begin(), h_gpair.end(), hess_.begin(),
+                     [](auto const &g) { return g.GetHess(); });
+      batch = BatchParam{param_->max_bin, common::Span<float const>{hess_}, true};
+      batch.sparse_thresh = param_->sparse_threshold;
+    }
+    n_trees_built_++;
+    // An iteration-scoped compacted row set: with row sampling most rows carry zero
+    // gradient, dropping them from the partitioner makes the histogram build and the
+    // position update scale with the sampled rows.  The partitioner then no longer
+    // covers every row, so the prediction cache and adaptive leaf updates (which need
+    // a position for each row) fall back to the full predictor.
+    bool const prev_compacted = compacted_;
+    compacted_ = hist_param_->compact_subsample &&
+                 (param_->subsample < 1.0 ||
+                  param_->sampling_method == TrainParam::kGradientBased) &&
+                 !task_->UpdateTreeLeaf();
+    // Consecutive trees in a multi-class round revisit the same rows and often share
+    // their upper splits.  Keep the partitioners and let them reuse child ranges for
+    // splits that match the previous tree exactly, instead of rebuilding from the
+    // root.  Compacted partitioners cover different rows each iteration and cannot be
+    // carried over.
+    bool const reuse_partition = hist_param_->reuse_partition && !compacted_ &&
+                                 !prev_compacted && !partitioner_.empty() &&
+                                 p_last_tree_ != nullptr && fmat == p_last_fmat_ && !rebin &&
+                                 !fmat->Info().IsColumnSplit();
+    auto h_gpair = gpair.Slice(linalg::All(), 0).Values();
     bst_bin_t n_total_bins{0};
-    partitioner_.clear();
-    for (auto const &page : fmat->GetBatches<GHistIndexMatrix>(ctx_, HistBatch(param_))) {
+    if (!reuse_partition) {
+      partitioner_.clear();
+    }
+    std::size_t page_id{0};
+    for (auto const &page : fmat->GetBatches<GHistIndexMatrix>(ctx_, batch)) {
       if (n_total_bins == 0) {
         n_total_bins = page.cut.TotalBins();
       } else {
         CHECK_EQ(n_total_bins, page.cut.TotalBins());
       }
-      partitioner_.emplace_back(this->ctx_, page.Size(), page.base_rowid,
-                                fmat->Info().IsColumnSplit());
+      if (reuse_partition) {
+        CHECK_LT(page_id, partitioner_.size());
+        CHECK_EQ(partitioner_[page_id].base_rowid, page.base_rowid);
+        partitioner_[page_id].ReuseForTree(p_last_tree_);
+      } else if (compacted_) {
+        partitioner_.emplace_back(this->ctx_, h_gpair.subspan(page.base_rowid, page.Size()),
+                                  page.Size(), page.base_rowid, fmat->Info().IsColumnSplit());
+      } else {
+        partitioner_.emplace_back(this->ctx_, page.Size(), page.base_rowid,
+                                  fmat->Info().IsColumnSplit());
+      }
+      ++page_id;
+    }
+    if (reuse_partition) {
+      CHECK_EQ(page_id, partitioner_.size());
     }
     histogram_builder_->Reset(ctx_, n_total_bins, 1, HistBatch(param_), collective::IsDistributed(),
                               fmat->Info().IsColumnSplit(), hist_param_);
@@ -407,8 +484,12 @@ class HistUpdater {
         }
       } else {
         auto gpair_h = gpair.Slice(linalg::All(), 0).Values();
-        for (auto const &grad : gpair_h) {
-          grad_stat.Add(grad.GetGrad(), grad.GetHess());
+        std::vector<GradientPairPrecise> tloc(ctx_->Threads());
+        common::ParallelFor(gpair_h.size(), ctx_->Threads(), [&](auto i) {
+          tloc[omp_get_thread_num()] += GradientPairPrecise{gpair_h[i]};
+        });
+        for (auto const &partial : tloc) {
+          grad_stat.Add(partial.GetGrad(), partial.GetHess());
         }
         auto rc = collective::GlobalSum(ctx_, p_fmat->Info(),
                                         linalg::MakeVec(reinterpret_cast<double *>(&grad_stat), 2));
@@ -504,6 +585,7 @@ class QuantileHistMaker : public TreeUpdater {
     if (!column_sampler_) {
       column_sampler_ = common::MakeColumnSampler(ctx_);
     }
+    column_sampler_->ConfigureTopK(hist_param_.top_k_features, hist_param_.top_k_sweep);
 
     if (trees.front()->IsMultiTarget()) {
       CHECK(hist_param_.GetInitialised());
@@ -535,12 +617,30 @@ class QuantileHistMaker : public TreeUpdater {
     }
 
     for (auto tree_it = trees.begin(); tree_it != trees.end(); ++tree_it) {
-      if (need_copy()) {
-        // Copy gradient into buffer for sampling. This converts C-order to F-order.
-        std::copy(linalg::cbegin(h_gpair), linalg::cend(h_gpair), linalg::begin(h_sample_out));
+      if (tree_it != trees.begin() && common::TrainingCancellation::Instance().Requested()) {
+        // Exit after the tree that was in flight when cancellation was requested.  The
+        // remaining trees of the forest stay single leaves with zero weight, which
+        // contribute nothing to the committed model.
+        break;
       }
       error::NoPageConcat(this->hist_param_.extmem_single_page);
-      SampleGradient(ctx_, *param, h_sample_out);
+      if (param->sampling_method == TrainParam::kGradientBased) {
+        CHECK(!trees.front()->IsMultiTarget()) << "GOSS" << MTNotImplemented();
+        if (need_copy()) {
+          GossSampleGradient(ctx_, hist_param_.goss_top_rate, hist_param_.goss_other_rate,
+                             linalg::MatrixView<GradientPair const>{h_gpair}, h_sample_out);
+        } else {
+          GossSampleGradient(ctx_, hist_param_.goss_top_rate, hist_param_.goss_other_rate,
+                             h_sample_out);
+        }
+      } else if (need_copy()) {
+        // Sample while copying into the buffer, one pass over the gradient instead of a
+        // copy sweep followed by a sampling sweep.  This converts C-order to F-order.
+        SampleGradient(ctx_, *param, linalg::MatrixView<GradientPair const>{h_gpair},
+                       h_sample_out);
+      } else {
+        SampleGradient(ctx_, *param, h_sample_out);
+      }
       auto *h_out_position = &out_position[tree_it - trees.begin()];
       if ((*tree_it)->IsMultiTarget()) {
         UpdateTree<MultiExpandEntry>(&monitor_, h_sample_out, p_mtimpl_.get(), p_fmat, param,
@@ -7,9 +7,11 @@
 #include <xgboost/tree_updater.h>
 
 #include <limits>
+#include <utility>  // for move
 #include <vector>
 
 #include "../collective/allreduce.h"
+#include "../common/common.h"  // for AssertGPUSupport
 #include "../common/threading_utils.h"
 #include "../predictor/predict_fn.h"
 #include "./param.h"
@@ -19,6 +21,20 @@ namespace xgboost::tree {
 
 DMLC_REGISTRY_FILE_TAG(updater_refresh);
 
+namespace cuda_impl {
+void AccumulateStatistics(Context const *ctx, std::vector<RegTree *> const &trees,
+                          linalg::Matrix<GradientPair> *gpair, DMatrix *p_fmat,
+                          std::vector<GradStats> *p_out);
+
+#if !defined(XGBOOST_USE_CUDA)
+inline void AccumulateStatistics(Context const *, std::vector<RegTree *> const &,
+                                 linalg::Matrix<GradientPair> *, DMatrix *,
+                                 std::vector<GradStats> *) {
+  common::AssertGPUSupport();
+}
+#endif  // !defined(XGBOOST_USE_CUDA)
+}  // namespace cuda_impl
+
 /*! \brief pruner that prunes a tree after growing finishes */
 class TreeRefresher : public TreeUpdater {
  public:
@@ -37,6 +53,28 @@ class TreeRefresher : public TreeUpdater {
       return;
     }
     CHECK_EQ(gpair->Shape(1), 1) << MTNotImplemented();
+    std::vector<GradStats> sum_grad;
+    if (ctx_->IsCUDA()) {
+      cuda_impl::AccumulateStatistics(ctx_, trees, gpair, p_fmat, &sum_grad);
+    } else {
+      this->AccumulateStatistics(gpair, p_fmat, trees, &sum_grad);
+    }
+    // Synchronize the aggregated result.
+    // x2 for gradient and hessian.
+    auto rc = collective::Allreduce(
+        ctx_, linalg::MakeVec(&sum_grad.data()->sum_grad, sum_grad.size() * 2),
+        collective::Op::kMax);
+    collective::SafeColl(rc);
+    bst_node_t offset = 0;
+    for (auto tree : trees) {
+      this->Refresh(param, dmlc::BeginPtr(sum_grad) + offset, 0, tree);
+      offset += tree->NumNodes();
+    }
+  }
+
+ private:
+  void AccumulateStatistics(linalg::Matrix<GradientPair> *gpair, DMatrix *p_fmat,
+                            std::vector<RegTree *> const &trees, std::vector<GradStats> *p_out) {
     const std::vector<GradientPair> &gpair_h = gpair->Data()->ConstHostVector();
     // Thread local variables.
     std::vector<std::vector<GradStats> > stemp;
@@ -92,21 +130,9 @@ class TreeRefresher : public TreeUpdater {
       });
     };
     get_stats();
-    // Synchronize the aggregated result.
-    auto &sum_grad = stemp[0];
-    // x2 for gradient and hessian.
-    auto rc = collective::Allreduce(
-        ctx_, linalg::MakeVec(&sum_grad.data()->sum_grad, sum_grad.size() * 2),
-        collective::Op::kMax);
-    collective::SafeColl(rc);
-    bst_node_t offset = 0;
-    for (auto tree : trees) {
-      this->Refresh(param, dmlc::BeginPtr(sum_grad) + offset, 0, tree);
-      offset += tree->NumNodes();
-    }
+    *p_out = std::move(stemp[0]);
   }
 
- private:
   inline static void AddStats(const RegTree &tree,
                               const RegTree::FVec &feat,
                               const std::vector<GradientPair> &gpair,
@@ -0,0 +1,129 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ * \file updater_refresh.cu
+ * \brief GPU accumulation of the per-node statistics used by the refresh updater.
+ */
+#include <thrust/copy.h>  // for copy
+#include <thrust/fill.h>  // for fill
+
+#include <cstddef>  // for size_t
+#include <limits>   // for numeric_limits
+#include <vector>   // for vector
+
+#include "../common/device_helpers.cuh"  // for LaunchN, device_vector, CopyDeviceSpanToVector
+#include "../predictor/predict_fn.h"     // for GetNextNode
+#include "./param.h"                     // for GradStats
+#include "xgboost/base.h"                // for GradientPair
+#include "xgboost/context.h"             // for Context
+#include "xgboost/data.h"                // for DMatrix, SparsePage, Entry
+#include "xgboost/linalg.h"              // for Matrix
+#include "xgboost/span.h"                // for Span
+#include "xgboost/tree_model.h"          // for RegTree
+
+namespace xgboost::tree::cuda_impl {
+namespace {
+/** \brief Device copy of one tree, including the categorical split matrix. */
+struct DeviceTree {
+  dh::device_vector<RegTree::Node> nodes;
+  dh::device_vector<FeatureType> split_types;
+  dh::device_vector<std::uint32_t> categories;
+  dh::device_vector<RegTree::CategoricalSplitMatrix::Segment> cat_ptr;
+
+  explicit DeviceTree(RegTree const &tree) {
+    auto const &h_nodes = tree.GetNodes();
+    nodes.resize(h_nodes.size());
+    thrust::copy(h_nodes.cbegin(), h_nodes.cend(), nodes.begin());
+    auto cats = tree.GetCategoriesMatrix();
+    split_types.resize(cats.split_type.size());
+    thrust::copy(cats.split_type.cbegin(), cats.split_type.cend(), split_types.begin());
+    categories.resize(cats.categories.size());
+    thrust::copy(cats.categories.cbegin(), cats.categories.cend(), categories.begin());
+    cat_ptr.resize(cats.node_ptr.size());
+    thrust::copy(cats.node_ptr.cbegin(), cats.node_ptr.cend(), cat_ptr.begin());
+  }
+
+  [[nodiscard]] RegTree::CategoricalSplitMatrix View() const {
+    return {dh::ToSpan(split_types), dh::ToSpan(categories), dh::ToSpan(cat_ptr)};
+  }
+};
+
+/** \brief Look up one feature in a CSR row, entries are sorted by feature index. */
+__device__ float GetFvalue(common::Span<Entry const> row, bst_feature_t fidx, bool *is_missing) {
+  std::size_t lo = 0, hi = row.size();
+  while (lo < hi) {
+    auto mid = lo + (hi - lo) / 2;
+    if (row[mid].index < fidx) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo < row.size() && row[lo].index == fidx) {
+    *is_missing = false;
+    return row[lo].fvalue;
+  }
+  *is_missing = true;
+  return std::numeric_limits<float>::quiet_NaN();
+}
+}  // anonymous namespace
+
+void AccumulateStatistics(Context const *ctx, std::vector<RegTree *> const &trees,
+                          linalg::Matrix<GradientPair> *gpair, DMatrix *p_fmat,
+                          std::vector<GradStats> *p_out) {
+  dh::safe_cuda(cudaSetDevice(ctx->Ordinal()));
+  std::size_t num_nodes = 0;
+  for (auto tree : trees) {
+    num_nodes += tree->NumNodes();
+  }
+
+  dh::device_vector<GradStats> stats(num_nodes);
+  thrust::fill(stats.begin(), stats.end(), GradStats{});
+
+  auto *p_gpair = gpair->Data();
+  p_gpair->SetDevice(ctx->Device());
+  auto d_gpair = p_gpair->ConstDeviceSpan();
+
+  // Stage every tree on the device once, they are shared between batches.
+  std::vector<DeviceTree> d_trees;
+  d_trees.reserve(trees.size());
+  for (auto tree : trees) {
+    d_trees.emplace_back(*tree);
+  }
+
+  for (auto const &batch : p_fmat->GetBatches<SparsePage>()) {
+    batch.data.SetDevice(ctx->Device());
+    batch.offset.SetDevice(ctx->Device());
+    auto d_data = batch.data.ConstDeviceSpan();
+    auto d_offset = batch.offset.ConstDeviceSpan();
+    auto base_rowid = batch.base_rowid;
+
+    std::size_t offset = 0;
+    for (auto const &d_tree : d_trees) {
+      auto d_nodes = dh::ToSpan(d_tree.nodes);
+      auto cats = d_tree.View();
+      auto d_stats = dh::ToSpan(stats).subspan(offset, d_tree.nodes.size());
+      dh::LaunchN(batch.Size(), [=] __device__(std::size_t i) {
+        auto row = d_data.subspan(d_offset[i], d_offset[i + 1] - d_offset[i]);
+        auto g = d_gpair[base_rowid + i];
+        auto grad = static_cast<double>(g.GetGrad());
+        auto hess = static_cast<double>(g.GetHess());
+        bst_node_t nidx = 0;
+        atomicAdd(&d_stats[nidx].sum_grad, grad);
+        atomicAdd(&d_stats[nidx].sum_hess, hess);
+        while (!d_nodes[nidx].IsLeaf()) {
+          auto fidx = d_nodes[nidx].SplitIndex();
+          bool is_missing = true;
+          float fvalue = GetFvalue(row, fidx, &is_missing);
+          nidx = predictor::GetNextNode<true, true>(d_nodes[nidx], nidx, fvalue, is_missing, cats);
+          atomicAdd(&d_stats[nidx].sum_grad, grad);
+          atomicAdd(&d_stats[nidx].sum_hess, hess);
+        }
+      });
+      offset += d_tree.nodes.size();
+    }
+  }
+
+  p_out->resize(num_nodes);
+  dh::CopyDeviceSpanToVector(p_out, dh::ToSpan(stats));
+}
+}  // namespace xgboost::tree::cuda_impl
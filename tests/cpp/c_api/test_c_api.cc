@@ -164,6 +164,90 @@ TEST(CAPI, ConfigIO) {
   ASSERT_EQ(config_0, config_1);
 }
 
+TEST(CAPI, SetParams) {
+  size_t constexpr kRows = 10;
+  auto p_dmat = RandomDataGenerator(kRows, 10, 0).GenerateDMatrix();
+  std::vector<std::shared_ptr<DMatrix>> mat{p_dmat};
+  std::shared_ptr<Learner> learner{Learner::Create(mat)};
+  BoosterHandle handle = learner.get();
+
+  ASSERT_EQ(XGBoosterSetParams(
+                handle, R"({"max_depth": 3, "eta": 0.5, "objective": "reg:squarederror"})"),
+            0);
+  learner->Configure();
+
+  Json config{Object{}};
+  learner->SaveConfig(&config);
+  auto const &tree_param = config["learner"]["gradient_booster"]["tree_train_param"];
+  ASSERT_EQ(get<String const>(tree_param["max_depth"]), "3");
+  ASSERT_EQ(get<String const>(tree_param["eta"]), "0.5");
+  ASSERT_EQ(get<String const>(config["learner"]["objective"]["name"]), "reg:squarederror");
+
+  // Null values are skipped, a non-object document is rejected.
+  ASSERT_EQ(XGBoosterSetParams(handle, R"({"max_depth": null})"), 0);
+  ASSERT_NE(XGBoosterSetParams(handle, R"(["max_depth"])"), 0);
+}
+
+TEST(CAPI, MemoryUsage) {
+  bst_idx_t constexpr kRows = 64;
+  Context ctx;
+  auto p_dmat = RandomDataGenerator(kRows, 16, 0).GenerateDMatrix();
+  GHistIndexMatrix gmat{&ctx, p_dmat.get(), 17, 0.5, false};
+
+  char const* out;
+  ASSERT_EQ(XGBGetMemoryUsage(&out), 0);
+  auto breakdown = Json::Load(StringView{out});
+  ASSERT_TRUE(IsA<Object>(breakdown));
+  // The gradient index constructed above must be accounted for while it's alive.
+  ASSERT_GE(get<Integer const>(breakdown["GHistIndexMatrix"]),
+            static_cast<std::int64_t>(gmat.MemCostBytes()));
+  ASSERT_GT(get<Integer const>(breakdown["GHistIndexMatrix"]), 0);
+  // The device entry is always present, 0 without CUDA or tracking.
+  ASSERT_GE(get<Integer const>(breakdown["device"]), 0);
+}
+
+TEST(CAPI, TransferStats) {
+  char const* out;
+  ASSERT_EQ(XGBGetTransferStats(&out), 0);
+  auto stats = Json::Load(StringView{out});
+  ASSERT_TRUE(IsA<Object>(stats));
+  // All entries are present, 0 without CUDA.
+  for (auto key : {"h2d_count", "h2d_bytes", "d2h_count", "d2h_bytes", "round_trips"}) {
+    ASSERT_GE(get<Integer const>(stats[key]), 0);
+  }
+}
+
+TEST(CAPI, PerfStats) {
+  size_t constexpr kRows = 16;
+  auto p_dmat = RandomDataGenerator(kRows, 10, 0).GenerateDMatrix(true);
+  std::vector<std::shared_ptr<DMatrix>> mat{p_dmat};
+  std::shared_ptr<Learner> learner{Learner::Create(mat)};
+  learner->Configure();
+
+  BoosterHandle handle = learner.get();
+
+  std::array<char const*, 1> out;
+  bst_ulong len{0};
+  // enable collection, then train an iteration so the monitors publish something.
+  ASSERT_EQ(XGBoosterGetPerfStats(handle, R"({"enable": true, "reset": true})", &len, out.data()),
+            0);
+  learner->UpdateOneIter(0, p_dmat);
+
+  ASSERT_EQ(XGBoosterGetPerfStats(handle, "{}", &len, out.data()), 0);
+  auto stats = Json::Load(StringView{out[0], len});
+  ASSERT_FALSE(get<Object const>(stats).empty());
+  for (auto const& [label, phases] : get<Object const>(stats)) {
+    for (auto const& [name, entry] : get<Object const>(phases)) {
+      ASSERT_GE(get<Integer const>(entry["count"]), 1);
+      ASSERT_GE(get<Integer const>(entry["elapsed_us"]), 0);
+    }
+  }
+
+  // disable and reset so later tests are unaffected.
+  ASSERT_EQ(XGBoosterGetPerfStats(handle, R"({"enable": false, "reset": true})", &len, out.data()),
+            0);
+}
+
 TEST(CAPI, JsonModelIO) {
   size_t constexpr kRows = 10;
   size_t constexpr kCols = 10;
@@ -501,7 +585,9 @@ auto MakeExtMemForTest(bst_idx_t n_samples, bst_feature_t n_features, Json dconf
                              cuda_impl::MatchingPageBytes(),
                              std::numeric_limits<float>::quiet_NaN(),
                              cuda_impl::MaxNumDevicePages(),
-                             0};
+                             0,
+                             /*n_prefetch_batches=*/0,
+                             /*persist_cache=*/false};
   auto Xy = std::make_shared<data::SparsePageDMatrix>(&iter_1, iter_1.Proxy(), Reset, Next, config);
   MakeLabelForTest(Xy, p_fmat);
   return std::pair{p_fmat, Xy};
@@ -627,4 +713,255 @@ TEST(CAPI, GPUXGDMatrixGetQuantileCut) {
   TestXGDMatrixGetQuantileCut(&ctx);
 }
 #endif  // defined(XGBOOST_USE_CUDA)
+
+TEST(CAPI, BoosterBroadcastModel) {
+  bst_idx_t constexpr kRows = 16;
+  bst_feature_t constexpr kCols = 4;
+  Json dconfig{Object{}};
+  dconfig["missing"] = Number{std::numeric_limits<float>::quiet_NaN()};
+  auto [p_fmat, Xy] = MakeSimpleDMatrixForTest(kRows, kCols, dconfig);
+
+  std::array<DMatrixHandle, 1> mats{p_fmat};
+  BoosterHandle booster;
+  ASSERT_EQ(XGBoosterCreate(mats.data(), 1, &booster), 0);
+  ASSERT_EQ(XGBoosterUpdateOneIter(booster, 0, p_fmat), 0);
+  // A no-op outside of a distributed environment.
+  ASSERT_EQ(XGBoosterBroadcastModel(booster, 0), 0);
+
+  XGBoosterFree(booster);
+  XGDMatrixFree(p_fmat);
+}
+
+TEST(CAPI, BoosterPredictSession) {
+  bst_idx_t constexpr kRows = 64;
+  bst_feature_t constexpr kCols = 4;
+  Json dconfig{Object{}};
+  dconfig["missing"] = Number{std::numeric_limits<float>::quiet_NaN()};
+  auto [p_fmat, Xy] = MakeSimpleDMatrixForTest(kRows, kCols, dconfig);
+
+  std::array<DMatrixHandle, 1> mats{p_fmat};
+  BoosterHandle booster;
+  ASSERT_EQ(XGBoosterCreate(mats.data(), 1, &booster), 0);
+  for (std::int32_t i = 0; i < 4; ++i) {
+    ASSERT_EQ(XGBoosterUpdateOneIter(booster, i, p_fmat), 0);
+  }
+
+  Json pconfig{Object{}};
+  pconfig["type"] = Integer{0};
+  pconfig["training"] = Boolean{false};
+  pconfig["iteration_begin"] = Integer{0};
+  pconfig["iteration_end"] = Integer{0};
+  pconfig["strict_shape"] = Boolean{false};
+  pconfig["missing"] = Number{std::numeric_limits<float>::quiet_NaN()};
+  std::string s_pconfig;
+  Json::Dump(pconfig, &s_pconfig);
+
+  HostDeviceVector<float> storage;
+  auto arr_int = RandomDataGenerator{kRows, kCols, 0.0}.GenerateArrayInterface(&storage);
+
+  bst_ulong const *ref_shape{nullptr};
+  bst_ulong ref_dim{0};
+  float const *ref_result{nullptr};
+  ASSERT_EQ(XGBoosterPredictFromDense(booster, arr_int.c_str(), s_pconfig.c_str(), nullptr,
+                                      &ref_shape, &ref_dim, &ref_result),
+            0);
+
+  PredictSessionHandle session;
+  ASSERT_EQ(XGBoosterPredictSessionCreate(booster, s_pconfig.c_str(), &session), 0);
+
+  float const *prev_result{nullptr};
+  for (std::int32_t iter = 0; iter < 4; ++iter) {
+    bst_ulong const *out_shape{nullptr};
+    bst_ulong out_dim{0};
+    float const *out_result{nullptr};
+    ASSERT_EQ(XGBoosterPredictSessionFromDense(session, arr_int.c_str(), &out_shape, &out_dim,
+                                               &out_result),
+              0);
+    ASSERT_EQ(out_dim, ref_dim);
+    for (bst_ulong i = 0; i < out_dim; ++i) {
+      ASSERT_EQ(out_shape[i], ref_shape[i]);
+    }
+    for (bst_idx_t i = 0; i < kRows; ++i) {
+      ASSERT_EQ(out_result[i], ref_result[i]);
+    }
+    // The output buffer is owned by the session and reused across calls.
+    if (prev_result) {
+      ASSERT_EQ(out_result, prev_result);
+    }
+    prev_result = out_result;
+  }
+
+  ASSERT_EQ(XGBoosterPredictSessionFree(session), 0);
+  XGBoosterFree(booster);
+  XGDMatrixFree(p_fmat);
+}
+
+namespace {
+struct StreamedPredictState {
+  std::vector<float> result;
+  bst_ulong n_calls{0};
+  bst_ulong stop_after{0};  // 0 means never stop
+};
+
+int CollectStreamedPredt(bst_ulong offset, bst_ulong, float const *predt, bst_ulong len,
+                         void *user_data) {
+  auto *state = static_cast<StreamedPredictState *>(user_data);
+  EXPECT_EQ(offset, state->result.size());
+  state->result.insert(state->result.end(), predt, predt + len);
+  state->n_calls++;
+  return state->stop_after != 0 && state->n_calls >= state->stop_after;
+}
+}  // anonymous namespace
+
+TEST(CAPI, BoosterPredictFromDMatrixStreamed) {
+  bst_idx_t constexpr kRows = 256;
+  bst_feature_t constexpr kCols = 8;
+  std::size_t constexpr kBatches = 4;
+  auto p_fmat =
+      RandomDataGenerator{kRows, kCols, 0.0}.Batches(kBatches).GenerateSparsePageDMatrix("temp",
+                                                                                         true);
+  std::unique_ptr<Learner> learner{Learner::Create({p_fmat})};
+  for (std::int32_t i = 0; i < 4; ++i) {
+    learner->UpdateOneIter(i, p_fmat);
+  }
+  HostDeviceVector<float> ref;
+  learner->Predict(p_fmat, false, &ref, 0, 0);
+  auto const &h_ref = ref.ConstHostVector();
+
+  Json pconfig{Object{}};
+  pconfig["type"] = Integer{0};
+  pconfig["training"] = Boolean{false};
+  pconfig["iteration_begin"] = Integer{0};
+  pconfig["iteration_end"] = Integer{0};
+  pconfig["strict_shape"] = Boolean{false};
+  std::string s_pconfig;
+  Json::Dump(pconfig, &s_pconfig);
+
+  // The page-by-page stream must reassemble into the regular prediction.
+  StreamedPredictState state;
+  ASSERT_EQ(XGBoosterPredictFromDMatrixStreamed(learner.get(), &p_fmat, s_pconfig.c_str(),
+                                                CollectStreamedPredt, &state),
+            0);
+  ASSERT_EQ(state.n_calls, kBatches);
+  ASSERT_EQ(state.result.size(), h_ref.size());
+  for (std::size_t i = 0; i < h_ref.size(); ++i) {
+    ASSERT_EQ(state.result[i], h_ref[i]);
+  }
+
+  // A non-zero callback return stops the iteration early.
+  StreamedPredictState stopped;
+  stopped.stop_after = 1;
+  ASSERT_EQ(XGBoosterPredictFromDMatrixStreamed(learner.get(), &p_fmat, s_pconfig.c_str(),
+                                                CollectStreamedPredt, &stopped),
+            0);
+  ASSERT_EQ(stopped.n_calls, 1);
+  ASSERT_LT(stopped.result.size(), h_ref.size());
+}
+
+TEST(CAPI, PredictFromDenseMany) {
+  bst_idx_t constexpr kRows = 64;
+  bst_feature_t constexpr kCols = 4;
+  bst_ulong constexpr kBoosters = 3;
+  Json dconfig{Object{}};
+  dconfig["missing"] = Number{std::numeric_limits<float>::quiet_NaN()};
+  auto [p_fmat, Xy] = MakeSimpleDMatrixForTest(kRows, kCols, dconfig);
+
+  // Boosters with a different number of rounds produce different predictions of the
+  // same shape.
+  std::array<DMatrixHandle, 1> mats{p_fmat};
+  std::array<BoosterHandle, kBoosters> boosters;
+  for (bst_ulong b = 0; b < kBoosters; ++b) {
+    ASSERT_EQ(XGBoosterCreate(mats.data(), 1, &boosters[b]), 0);
+    for (std::int32_t i = 0; i < static_cast<std::int32_t>(b) + 1; ++i) {
+      ASSERT_EQ(XGBoosterUpdateOneIter(boosters[b], i, p_fmat), 0);
+    }
+  }
+
+  Json pconfig{Object{}};
+  pconfig["type"] = Integer{0};
+  pconfig["training"] = Boolean{false};
+  pconfig["iteration_begin"] = Integer{0};
+  pconfig["iteration_end"] = Integer{0};
+  pconfig["strict_shape"] = Boolean{false};
+  pconfig["missing"] = Number{std::numeric_limits<float>::quiet_NaN()};
+  std::string s_pconfig;
+  Json::Dump(pconfig, &s_pconfig);
+
+  HostDeviceVector<float> storage;
+  auto arr_int = RandomDataGenerator{kRows, kCols, 0.0}.GenerateArrayInterface(&storage);
+
+  bst_ulong const *out_shape{nullptr};
+  bst_ulong out_dim{0};
+  std::array<float const *, kBoosters> out_result;
+  out_result.fill(nullptr);
+  ASSERT_EQ(XGBoosterPredictFromDenseMany(boosters.data(), kBoosters, arr_int.c_str(),
+                                          s_pconfig.c_str(), &out_shape, &out_dim,
+                                          out_result.data()),
+            0);
+  ASSERT_EQ(out_dim, 1);
+  ASSERT_EQ(out_shape[0], kRows);
+
+  for (bst_ulong b = 0; b < kBoosters; ++b) {
+    bst_ulong const *ref_shape{nullptr};
+    bst_ulong ref_dim{0};
+    float const *ref_result{nullptr};
+    ASSERT_EQ(XGBoosterPredictFromDense(boosters[b], arr_int.c_str(), s_pconfig.c_str(), nullptr,
+                                        &ref_shape, &ref_dim, &ref_result),
+              0);
+    ASSERT_EQ(ref_dim, out_dim);
+    for (bst_idx_t i = 0; i < kRows; ++i) {
+      ASSERT_EQ(out_result[b][i], ref_result[i]);
+    }
+  }
+
+  for (auto booster : boosters) {
+    XGBoosterFree(booster);
+  }
+  XGDMatrixFree(p_fmat);
+}
+
+TEST(CAPI, DMatrixBuilder) {
+  std::size_t constexpr kRowsPerBatch = 64, kBatches = 4;
+  std::vector<std::vector<float>> col0(kBatches);
+  std::vector<std::vector<double>> col1(kBatches);
+  for (std::size_t b = 0; b < kBatches; ++b) {
+    for (std::size_t i = 0; i < kRowsPerBatch; ++i) {
+      col0[b].push_back(static_cast<float>(b * kRowsPerBatch + i));
+      col1[b].push_back(static_cast<double>(i) * 0.5);
+    }
+  }
+
+  Json config{Object{}};
+  config["missing"] = Number{std::numeric_limits<float>::quiet_NaN()};
+  config["max_bin"] = Integer{16};
+  std::string sconfig;
+  Json::Dump(config, &sconfig);
+
+  DMatrixBuilderHandle builder;
+  ASSERT_EQ(XGDMatrixBuilderCreate(sconfig.c_str(), &builder), 0);
+  for (std::size_t b = 0; b < kBatches; ++b) {
+    ASSERT_EQ(XGDMatrixBuilderPushColumn(builder, /*float32=*/1, col0[b].data(), kRowsPerBatch),
+              0);
+    ASSERT_EQ(XGDMatrixBuilderPushColumn(builder, /*float64=*/2, col1[b].data(), kRowsPerBatch),
+              0);
+    ASSERT_EQ(XGDMatrixBuilderCommitBatch(builder), 0);
+  }
+  DMatrixHandle p_fmat;
+  ASSERT_EQ(XGDMatrixBuilderFinalize(builder, nullptr, &p_fmat), 0);
+
+  bst_ulong n_rows, n_cols;
+  ASSERT_EQ(XGDMatrixNumRow(p_fmat, &n_rows), 0);
+  ASSERT_EQ(XGDMatrixNumCol(p_fmat, &n_cols), 0);
+  ASSERT_EQ(n_rows, kRowsPerBatch * kBatches);
+  ASSERT_EQ(n_cols, 2);
+  ASSERT_EQ(XGDMatrixFree(p_fmat), 0);
+
+  // Batches with a mismatched schema are rejected.
+  ASSERT_EQ(XGDMatrixBuilderCreate(sconfig.c_str(), &builder), 0);
+  ASSERT_EQ(XGDMatrixBuilderPushColumn(builder, 1, col0[0].data(), kRowsPerBatch), 0);
+  ASSERT_EQ(XGDMatrixBuilderCommitBatch(builder), 0);
+  ASSERT_EQ(XGDMatrixBuilderPushColumn(builder, 2, col1[0].data(), kRowsPerBatch), 0);
+  ASSERT_NE(XGDMatrixBuilderCommitBatch(builder), 0);
+  ASSERT_EQ(XGDMatrixBuilderFree(builder), 0);
+}
 }  // namespace xgboost
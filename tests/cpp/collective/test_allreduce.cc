@@ -69,6 +69,49 @@ class AllreduceWorker : public WorkerForTest {
     }
   }
 
+  void Hierarchical(std::int32_t group_size) {
+    std::vector<double> data(314, 1.5);
+    auto pcoll = std::shared_ptr<Coll>{new Coll{group_size}};
+    auto rc = pcoll->Allreduce(comm_, common::EraseType(common::Span{data.data(), data.size()}),
+                               ArrayInterfaceHandler::kF8, Op::kSum);
+    SafeColl(rc);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      ASSERT_EQ(data[i], 1.5 * static_cast<double>(comm_.World())) << i;
+    }
+  }
+
+  void Compressed(ReduceCodec codec) {
+    // 1.5 and its small multiples are exactly representable in both 16-bit formats, the
+    // compressed reduction is exact for them.
+    std::vector<double> data(314, 1.5);
+    auto pcoll = std::shared_ptr<Coll>{new Coll{0, codec}};
+    auto rc = pcoll->Allreduce(comm_, common::EraseType(common::Span{data.data(), data.size()}),
+                               ArrayInterfaceHandler::kF8, Op::kSum);
+    SafeColl(rc);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      ASSERT_EQ(data[i], 1.5 * static_cast<double>(comm_.World())) << i;
+    }
+  }
+
+  void ErrorFeedback() {
+    // 0.1 is not representable in bfloat16.  Without the error feedback the rounding
+    // error would accumulate linearly across rounds.
+    auto pcoll = std::shared_ptr<Coll>{new Coll{0, ReduceCodec::kBf16}};
+    std::int32_t constexpr kRounds = 32;
+    double total = 0.0;
+    for (std::int32_t r = 0; r < kRounds; ++r) {
+      std::vector<double> data(64, 0.1);
+      auto rc = pcoll->Allreduce(comm_, common::EraseType(common::Span{data.data(), data.size()}),
+                                 ArrayInterfaceHandler::kF8, Op::kSum);
+      SafeColl(rc);
+      total += data[0];
+    }
+    auto expected = 0.1 * static_cast<double>(comm_.World()) * kRounds;
+    // The carried residual bounds the accumulated error to about one ulp of a single
+    // round, far below the ~6e-3 drift of feedback-free quantization.
+    ASSERT_NEAR(total, expected, 1e-3);
+  }
+
   void BitOr() {
     std::vector<std::uint32_t> data(comm_.World(), 0);
     data[comm_.Rank()] = ~std::uint32_t{0};
@@ -103,6 +146,39 @@ TEST_F(AllreduceTest, Sum) {
   });
 }
 
+TEST_F(AllreduceTest, Hierarchical) {
+  std::int32_t n_workers = 4;
+  TestDistributed(n_workers, [=](std::string host, std::int32_t port, std::chrono::seconds timeout,
+                                 std::int32_t r) {
+    AllreduceWorker worker{host, port, timeout, n_workers, r};
+    // Two groups of two workers.
+    worker.Hierarchical(2);
+    // Doesn't partition the world, must fall back to the flat ring.
+    worker.Hierarchical(3);
+  });
+}
+
+TEST_F(AllreduceTest, Compressed) {
+  std::int32_t n_workers = std::min(7u, std::thread::hardware_concurrency());
+  TestDistributed(n_workers, [=](std::string host, std::int32_t port, std::chrono::seconds timeout,
+                                 std::int32_t r) {
+    AllreduceWorker worker{host, port, timeout, n_workers, r};
+    worker.Compressed(ReduceCodec::kFp16);
+    worker.Compressed(ReduceCodec::kBf16);
+  });
+}
+
+TEST_F(AllreduceTest, ErrorFeedback) {
+  // Two workers keep the wire-side partial sums exactly representable, isolating the
+  // local quantization error that the feedback is supposed to absorb.
+  std::int32_t n_workers = 2;
+  TestDistributed(n_workers, [=](std::string host, std::int32_t port, std::chrono::seconds timeout,
+                                 std::int32_t r) {
+    AllreduceWorker worker{host, port, timeout, n_workers, r};
+    worker.ErrorFeedback();
+  });
+}
+
 TEST_F(AllreduceTest, BitOr) {
   std::int32_t n_workers = std::min(7u, std::thread::hardware_concurrency());
   TestDistributed(n_workers, [=](std::string host, std::int32_t port, std::chrono::seconds timeout,
@@ -141,6 +217,23 @@ TEST(AllreduceGlobal, Basic) {
   });
 }
 
+TEST(AllreduceGlobal, Async) {
+  auto n_workers = 3;
+  TestDistributedGlobal(n_workers, [&]() {
+    std::vector<double> values(512, 1.0);
+    Context ctx;
+    auto pending = AllreduceAsync(&ctx, linalg::MakeVec(values.data(), values.size()),
+                                  collective::Op::kSum);
+    ASSERT_TRUE(pending.Valid());
+    // Local compute can run here while the reduction is in flight, as long as it doesn't
+    // touch the buffer or issue another collective.
+    SafeColl(pending.Get());
+    for (auto v : values) {
+      ASSERT_EQ(v, static_cast<double>(n_workers));
+    }
+  });
+}
+
 TEST(AllreduceGlobal, Small) {
   // Test when the data is not large enougth to be divided by the number of workers
   auto n_workers = 8;
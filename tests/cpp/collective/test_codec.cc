@@ -0,0 +1,50 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>   // for isnan, isinf
+#include <vector>  // for vector
+
+#include "../../../src/collective/codec.h"
+
+namespace xgboost::collective {
+TEST(ReduceCodec, Fp16RoundTrip) {
+  // Values representable in binary16 round trip exactly.
+  std::vector<float> exact{0.0f,  -0.0f,     1.0f,    -1.0f,   1.5f,
+                           0.25f, 65504.0f,  -2048.0f, 0.0009765625f};
+  for (auto v : exact) {
+    ASSERT_EQ(DecodeFp16(EncodeFp16(v)), v) << v;
+  }
+  // Subnormal binary16.
+  float denorm = std::ldexp(1.0f, -24);
+  ASSERT_EQ(DecodeFp16(EncodeFp16(denorm)), denorm);
+  // Values beyond the range saturate to infinity.
+  ASSERT_TRUE(std::isinf(DecodeFp16(EncodeFp16(1e9f))));
+  ASSERT_TRUE(std::isnan(DecodeFp16(EncodeFp16(std::nanf("")))));
+  // Round-to-nearest keeps the relative error within half an ulp.
+  float v = 0.1f;
+  ASSERT_NEAR(DecodeFp16(EncodeFp16(v)), v, v * std::ldexp(1.0f, -11));
+}
+
+TEST(ReduceCodec, Bf16RoundTrip) {
+  // bfloat16 keeps the binary32 exponent range; values with at most 8 significant bits
+  // round trip exactly.
+  std::vector<float> exact{0.0f, -0.0f, 1.0f, 1.5f, -3.0f, std::ldexp(1.0f, 20),
+                           std::ldexp(1.0f, -60)};
+  for (auto v : exact) {
+    ASSERT_EQ(DecodeBf16(EncodeBf16(v)), v) << v;
+  }
+  ASSERT_TRUE(std::isnan(DecodeBf16(EncodeBf16(std::nanf("")))));
+  float v = 0.1f;
+  ASSERT_NEAR(DecodeBf16(EncodeBf16(v)), v, v * std::ldexp(1.0f, -8));
+}
+
+TEST(ReduceCodec, Parse) {
+  ASSERT_EQ(ParseReduceCodec(""), ReduceCodec::kNone);
+  ASSERT_EQ(ParseReduceCodec("none"), ReduceCodec::kNone);
+  ASSERT_EQ(ParseReduceCodec("fp16"), ReduceCodec::kFp16);
+  ASSERT_EQ(ParseReduceCodec("bf16"), ReduceCodec::kBf16);
+  ASSERT_EQ(ParseReduceCodec("bfloat16"), ReduceCodec::kBf16);
+}
+}  // namespace xgboost::collective
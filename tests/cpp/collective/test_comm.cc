@@ -4,14 +4,26 @@
 #include <gtest/gtest.h>
 
 #include "../../../src/collective/comm.h"
-#include "../../../src/common/type.h"  // for EraseType
-#include "test_worker.h"               // for TrackerTest
+#include "../../../src/collective/transport.h"  // for MakeTransportChannel
+#include "../../../src/common/type.h"           // for EraseType
+#include "test_worker.h"                        // for TrackerTest
 
 namespace xgboost::collective {
 namespace {
 class CommTest : public TrackerTest {};
 }  // namespace
 
+TEST(Transport, Factory) {
+  RabitComm comm;
+  std::shared_ptr<Channel> ch;
+  auto sock = std::make_shared<TCPSocket>();
+  ASSERT_TRUE(MakeTransportChannel(comm, sock, "tcp", &ch).OK());
+  ASSERT_TRUE(ch);
+  auto rc = MakeTransportChannel(comm, sock, "carrier-pigeon", &ch);
+  ASSERT_FALSE(rc.OK());
+  ASSERT_NE(rc.Report().find("carrier-pigeon"), std::string::npos);
+}
+
 TEST_F(CommTest, Channel) {
   auto n_workers = 4;
   RabitTracker tracker{MakeTrackerConfig(host, n_workers, timeout)};
@@ -49,4 +61,51 @@ TEST_F(CommTest, Channel) {
 
   SafeColl(fut.get());
 }
+
+TEST_F(CommTest, Coalesce) {
+  auto n_workers = 2;
+  RabitTracker tracker{MakeTrackerConfig(host, n_workers, timeout)};
+  auto fut = tracker.Run();
+
+  std::vector<std::thread> workers;
+  std::int32_t port = tracker.Port();
+  // Enough small messages to wrap the coalescing window several times over.
+  std::size_t n_msgs = Channel::kCoalesceBytes;
+
+  for (std::int32_t i = 0; i < n_workers; ++i) {
+    workers.emplace_back([=] {
+      WorkerForTest worker{host, port, timeout, n_workers, i};
+      if (i == 0) {
+        auto p_chan = worker.Comm().Chan(1);
+        auto rc = Success();
+        for (std::size_t k = 0; k < n_msgs && rc.OK(); ++k) {
+          auto v = static_cast<std::int32_t>(k);
+          rc = p_chan->SendAll(
+              EraseType(common::Span<std::int32_t const>{&v, static_cast<std::size_t>(1)}));
+        }
+        rc = std::move(rc) << [&] { return p_chan->Block(); };
+        SafeColl(rc);
+      } else {
+        auto p_chan = worker.Comm().Chan(0);
+        std::vector<std::int32_t> values(n_msgs, -1);
+        auto rc = Success();
+        for (std::size_t k = 0; k < n_msgs && rc.OK(); ++k) {
+          rc = p_chan->RecvAll(
+              EraseType(common::Span<std::int32_t>{&values[k], static_cast<std::size_t>(1)}));
+        }
+        rc = std::move(rc) << [&] { return p_chan->Block(); };
+        SafeColl(rc);
+        for (std::size_t k = 0; k < n_msgs; ++k) {
+          ASSERT_EQ(values[k], static_cast<std::int32_t>(k));
+        }
+      }
+    });
+  }
+
+  for (auto &w : workers) {
+    w.join();
+  }
+
+  SafeColl(fut.get());
+}
 }  // namespace xgboost::collective
@@ -0,0 +1,53 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#if defined(XGBOOST_USE_NCCL)
+#include <gtest/gtest.h>
+#include <thrust/host_vector.h>  // for host_vector
+
+#include <cstdint>  // for int32_t, int64_t
+#include <numeric>  // for iota
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "../../../src/collective/comm.h"           // for DefaultNcclName
+#include "../../../src/collective/device_comm.cuh"  // for DeviceCommGroup
+#include "../../../src/common/cuda_rt_utils.h"      // for AllVisibleGPUs, SetDevice
+#include "../../../src/common/device_helpers.cuh"   // for device_vector, ToSpan
+
+namespace xgboost::collective {
+TEST(DeviceCommGroup, AllreduceSum) {
+  auto n_gpus = curt::AllVisibleGPUs();
+  std::vector<std::int32_t> ordinals(n_gpus);
+  std::iota(ordinals.begin(), ordinals.end(), 0);
+  DeviceCommGroup comm{std::string{DefaultNcclName()}, ordinals};
+  ASSERT_EQ(comm.World(), n_gpus);
+
+  std::size_t constexpr kElems = 256;
+  std::vector<dh::device_vector<std::int64_t>> bufs(n_gpus);
+  std::vector<common::Span<std::int64_t>> data;
+  std::vector<cudaStream_t> streams;
+  for (std::int32_t r = 0; r < n_gpus; ++r) {
+    curt::SetDevice(comm.Ordinal(r));
+    bufs[r].resize(kElems, r + 1);
+    data.push_back(dh::ToSpan(bufs[r]));
+    streams.push_back(dh::DefaultStream());
+  }
+
+  SafeColl(comm.AllreduceSum(data, streams));
+
+  // 1 + 2 + ... + n
+  std::int64_t expected = static_cast<std::int64_t>(n_gpus) * (n_gpus + 1) / 2;
+  for (std::int32_t r = 0; r < n_gpus; ++r) {
+    curt::SetDevice(comm.Ordinal(r));
+    dh::DefaultStream().Sync();
+    thrust::host_vector<std::int64_t> h_buf = bufs[r];
+    for (auto v : h_buf) {
+      ASSERT_EQ(v, expected);
+    }
+    bufs[r].clear();
+    bufs[r].shrink_to_fit();
+  }
+}
+}  // namespace xgboost::collective
+#endif  // defined(XGBOOST_USE_NCCL)
@@ -84,6 +84,28 @@ TEST_F(LoopTest, Op) {
   ASSERT_EQ(rbuf[0], wbuf[0]);
 }
 
+TEST_F(LoopTest, Stats) {
+  TCPSocket& send = pair_.first;
+  TCPSocket& recv = pair_.second;
+
+  std::vector<std::int8_t> wbuf(4, 1);
+  std::vector<std::int8_t> rbuf(4, 0);
+
+  loop_->Submit(Loop::Op{Loop::Op::kWrite, 0, wbuf.data(), wbuf.size(), &send, 0});
+  loop_->Submit(Loop::Op{Loop::Op::kRead, 0, rbuf.data(), rbuf.size(), &recv, 0});
+  SafeColl(loop_->Block());
+
+  auto stats = loop_->Stats();
+  for (auto name : {"read", "write"}) {
+    auto const& summary = stats[name];
+    ASSERT_EQ(get<Integer const>(summary["count"]), 1);
+    ASSERT_EQ(get<Integer const>(summary["bytes"]), 4);
+    ASSERT_GE(get<Number const>(summary["wire_us"]["p99"]),
+              get<Number const>(summary["wire_us"]["p50"]));
+    ASSERT_GE(get<Number const>(summary["queue_us"]["p50"]), 0.0f);
+  }
+}
+
 TEST_F(LoopTest, Block) {
   // We need to ensure that a blocking call doesn't go unanswered.
   auto op = Loop::Op::Sleep(2);
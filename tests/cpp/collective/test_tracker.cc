@@ -77,6 +77,34 @@ TEST_F(TrackerTest, Print) {
   SafeColl(fut.get());
 }
 
+TEST_F(TrackerTest, ZoneAwareRanks) {
+  std::int32_t n = 4;
+  RabitTracker tracker{MakeTrackerConfig(host, n, timeout)};
+  auto fut = tracker.Run();
+  SafeColl(tracker.WaitUntilReady());
+  std::int32_t port = tracker.Port();
+
+  // The zone hint is the primary sort key for rank assignment, so the az-a workers take
+  // the first two ranks and each zone stays contiguous on the ring regardless of the
+  // connection order.
+  std::vector<std::string> zones{"az-b", "az-a", "az-b", "az-a"};
+  std::vector<std::int32_t> expected{2, 0, 3, 1};
+
+  std::vector<std::thread> workers;
+  for (std::int32_t i = 0; i < n; ++i) {
+    workers.emplace_back([&, i] {
+      RabitComm comm{host,  port, timeout, 1, "t:" + std::to_string(i), DefaultNcclName(),
+                     "tcp", false, zones[i]};
+      ASSERT_EQ(comm.Rank(), expected[i]);
+      SafeColl(comm.Shutdown());
+    });
+  }
+  for (auto &w : workers) {
+    w.join();
+  }
+  SafeColl(fut.get());
+}
+
 TEST_F(TrackerTest, GetHostAddress) { ASSERT_TRUE(host.find("127.") == std::string::npos); }
 
 /**
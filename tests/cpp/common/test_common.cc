@@ -16,4 +16,12 @@ TEST(Common, HumanMemUnit) {
   name = HumanMemUnit(1);
   ASSERT_EQ(name, "1B");
 }
+
+TEST(Common, L2CacheBytes) {
+  auto n_bytes = L2CacheBytes();
+  // Detected size or the 1MB fallback, never 0.
+  ASSERT_GE(n_bytes, 64ul * 1024);
+  // Stable across calls.
+  ASSERT_EQ(n_bytes, L2CacheBytes());
+}
 }  // namespace xgboost::common
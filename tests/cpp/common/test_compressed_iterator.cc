@@ -20,6 +20,33 @@ TEST(CompressedIterator, Size) {
   }
 }
 
+TEST(CompressedIterator, DecodeBlock) {
+  std::vector<int> test_cases = {3, 64, 256, 100000, INT32_MAX};
+  size_t num_elements = 1000;
+  srand(7);
+
+  for (auto alphabet_size : test_cases) {
+    std::vector<int> input(num_elements);
+    std::generate(input.begin(), input.end(), [=]() { return rand() % alphabet_size; });
+    CompressedBufferWriter cbw(alphabet_size);
+    std::vector<unsigned char> buffer(
+        CompressedBufferWriter::CalculateBufferSize(num_elements, alphabet_size));
+    cbw.Write(buffer.data(), input.begin(), input.end());
+    CompressedIterator<int> ci(buffer.data(), alphabet_size);
+
+    // Blocks of various sizes at unaligned offsets must match per-element decoding.
+    for (size_t begin : {0ul, 1ul, 7ul, 129ul}) {
+      for (size_t n : {1ul, 64ul, 256ul, num_elements - begin}) {
+        std::vector<int> output(n);
+        ci.DecodeBlock(begin, n, output.data());
+        for (size_t i = 0; i < n; ++i) {
+          ASSERT_EQ(output[i], input[begin + i]);
+        }
+      }
+    }
+  }
+}
+
 TEST(CompressedIterator, Test) {
   ASSERT_TRUE(detail::SymbolBits(256) == 8);
   ASSERT_TRUE(detail::SymbolBits(150) == 8);
@@ -26,6 +26,27 @@ TEST(DeviceUVector, Basic) {
   std::swap(verbosity, xgboost::GlobalConfigThreadLocalStore::Get()->verbosity);
 }
 
+#if !defined(XGBOOST_USE_RMM)
+TEST(DeviceUVector, Pooled) {
+  auto &flag = xgboost::GlobalConfigThreadLocalStore::Get()->use_device_pool;
+  auto saved = flag;
+  flag = true;
+  void *first{nullptr};
+  {
+    DeviceUVector<float> uvec;
+    uvec.resize(1024);
+    first = uvec.data();
+  }
+  {
+    // Back-to-back cycles of the same size reuse the cached block.
+    DeviceUVector<float> uvec;
+    uvec.resize(1024);
+    ASSERT_EQ(uvec.data(), first);
+  }
+  flag = saved;
+}
+#endif  // !defined(XGBOOST_USE_RMM)
+
 #if defined(__linux__)
 namespace {
 class TestVirtualMem : public ::testing::TestWithParam<CUmemLocationType> {
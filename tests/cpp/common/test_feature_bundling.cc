@@ -0,0 +1,86 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include <gtest/gtest.h>
+#include <xgboost/data.h>  // for SparsePage, Entry
+
+#include <cstdint>  // for uint32_t
+#include <vector>   // for vector
+
+#include "../../../src/common/feature_bundling.h"
+
+namespace xgboost::common {
+namespace {
+// 4 columns over 6 rows.  Column 0 is dense, columns 1-3 are one-hot encoded and
+// mutually exclusive.
+SparsePage MakeOneHotPage() {
+  SparsePage page;
+  auto& offset = page.offset.HostVector();
+  auto& data = page.data.HostVector();
+  bst_idx_t constexpr kRows = 6;
+  for (bst_idx_t i = 0; i < kRows; ++i) {
+    data.emplace_back(0, static_cast<float>(i));
+    data.emplace_back(1 + (i % 3), 1.0f);
+    offset.push_back(data.size());
+  }
+  return page;
+}
+}  // anonymous namespace
+
+TEST(FeatureBundling, MakeBundles) {
+  auto page = MakeOneHotPage();
+  auto plan = MakeFeatureBundles(page, 4, 0.0, 1);
+
+  ASSERT_EQ(plan.NumBundles(), 2);
+  ASSERT_FALSE(plan.Trivial());
+  // The dense column gets its own bundle, the one-hot columns share one.
+  ASSERT_EQ(plan.bundles[plan.feature_to_bundle[0]].size(), 1);
+  auto one_hot = plan.feature_to_bundle[1];
+  ASSERT_EQ(plan.feature_to_bundle[2], one_hot);
+  ASSERT_EQ(plan.feature_to_bundle[3], one_hot);
+  ASSERT_EQ(plan.bundles[one_hot].size(), 3);
+
+  // With a conflict budget, the dense column absorbs everything.
+  plan = MakeFeatureBundles(page, 4, 1.0, 1);
+  ASSERT_EQ(plan.NumBundles(), 1);
+  ASSERT_EQ(plan.bundles.front().size(), 4);
+}
+
+TEST(FeatureBundling, MakeBundledCuts) {
+  auto page = MakeOneHotPage();
+  auto plan = MakeFeatureBundles(page, 4, 0.0, 1);
+
+  HistogramCuts cuts;
+  // 3 bins for the dense feature, 1 bin for each one-hot feature.
+  cuts.cut_ptrs_.HostVector() = {0, 3, 4, 5, 6};
+  cuts.cut_values_.HostVector() = {2.0f, 4.0f, 6.0f, 1.0f, 1.0f, 1.0f};
+  cuts.min_vals_.HostVector() = {0.0f, 0.5f, 0.5f, 0.5f};
+
+  std::vector<std::uint32_t> bin_mapping;
+  auto bundled = MakeBundledCuts(cuts, plan, &bin_mapping);
+
+  ASSERT_EQ(bundled.NumFeatures(), plan.NumBundles());
+  // One extra "all zero" bin for the merged bundle.
+  ASSERT_EQ(bundled.TotalBins(), cuts.TotalBins() + 1);
+  ASSERT_EQ(bin_mapping.size(), static_cast<std::size_t>(cuts.TotalBins()));
+
+  // Every original bin keeps its cut value at the mapped position.
+  for (bst_feature_t fidx = 0; fidx < cuts.NumFeatures(); ++fidx) {
+    auto bundle = plan.feature_to_bundle[fidx];
+    for (auto i = cuts.Ptrs()[fidx]; i < cuts.Ptrs()[fidx + 1]; ++i) {
+      auto mapped = bin_mapping[i];
+      ASSERT_EQ(bundled.Values()[mapped], cuts.Values()[i]);
+      ASSERT_GE(mapped, bundled.Ptrs()[bundle]);
+      ASSERT_LT(mapped, bundled.Ptrs()[bundle + 1]);
+    }
+  }
+  // Members of the same bundle occupy disjoint bin ranges after the shared zero bin.
+  auto one_hot = plan.feature_to_bundle[1];
+  std::vector<bool> seen(bundled.TotalBins(), false);
+  for (auto mapped : bin_mapping) {
+    ASSERT_FALSE(seen[mapped]);
+    seen[mapped] = true;
+  }
+  ASSERT_FALSE(seen[bundled.Ptrs()[one_hot]]);  // the zero bin is reserved
+}
+}  // namespace xgboost::common
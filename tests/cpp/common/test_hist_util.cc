@@ -2,6 +2,7 @@
  * Copyright 2019-2024, XGBoost Contributors
  */
 #include <gtest/gtest.h>
+#include <numeric>
 #include <vector>
 #include <string>
 
@@ -9,6 +10,7 @@
 #include "../../../src/data/gradient_index.h"
 #include "../helpers.h"
 #include "test_hist_util.h"
+#include "xgboost/json.h"  // for Json
 
 namespace xgboost {
 namespace common {
@@ -117,10 +119,314 @@ void ParallelGHistBuilderReduceHist(){
   }
 }
 
+void ParallelGHistBuilderReduceHistF32() {
+  constexpr size_t kBins = 10;
+  constexpr size_t kNodes = 5;
+  constexpr size_t kTasksPerNode = 10;
+  constexpr float kValue = 1.0f;
+  const size_t nthreads = AllThreadsForTest();
+
+  HistCollection collection;
+  collection.Init(kBins);
+
+  for (size_t inode = 0; inode < kNodes; inode++) {
+    collection.AddHistRow(inode);
+    collection.AllocateData(inode);
+  }
+  ParallelGHistBuilder hist_builder;
+  hist_builder.Init(kBins);
+  std::vector<GHistRow> target_hist(kNodes);
+  for (size_t i = 0; i < target_hist.size(); ++i) {
+    target_hist[i] = collection[i];
+  }
+
+  common::BlockedSpace2d space(
+      kNodes, [&](size_t /*node*/) { return kTasksPerNode; }, 1);
+  hist_builder.Reset(nthreads, kNodes, space, target_hist, /*float_partials=*/true);
+
+  common::ParallelFor2d(space, nthreads, [&](size_t inode, common::Range1d) {
+    const size_t tid = omp_get_thread_num();
+
+    GHistRowF32 hist = hist_builder.GetInitializedHistF32(tid, inode);
+    for (size_t i = 0; i < kBins; ++i) {
+      hist[i].Add(kValue, kValue);
+    }
+  });
+
+  for (size_t inode = 0; inode < kNodes; inode++) {
+    hist_builder.ReduceHist(inode, 0, kBins);
+
+    // Small integral values are exact in single precision, the merged double
+    // precision result must match the regular build bit for bit.
+    for (size_t i = 0; i < kBins; ++i) {
+      ASSERT_EQ(kValue * kTasksPerNode, collection[inode][i].GetGrad());
+      ASSERT_EQ(kValue * kTasksPerNode, collection[inode][i].GetHess());
+    }
+  }
+}
+
+TEST(HistCollection, LazyAllocate) {
+  constexpr size_t kBins = 10;
+  HistCollection collection;
+  collection.Init(kBins);
+
+  collection.AddHistRow(0);
+  collection.AddHistRow(1);
+  ASSERT_TRUE(collection.RowExists(0));
+  ASSERT_FALSE(collection.RowAllocated(0));
+
+  // Rows are zero-initialized on first allocation only.
+  collection.AllocateData(0);
+  ASSERT_TRUE(collection.RowAllocated(0));
+  ASSERT_FALSE(collection.RowAllocated(1));
+  auto hist = collection[0];
+  for (size_t i = 0; i < kBins; ++i) {
+    ASSERT_EQ(hist[i].GetGrad(), 0.0);
+    ASSERT_EQ(hist[i].GetHess(), 0.0);
+  }
+  hist[0].Add(1.0, 1.0);
+  collection.AllocateData(0);
+  ASSERT_EQ(collection[0][0].GetGrad(), 1.0);
+}
+
 TEST(ParallelGHistBuilder, Reset) { ParallelGHistBuilderReset(); }
 
 TEST(ParallelGHistBuilder, ReduceHist) { ParallelGHistBuilderReduceHist(); }
 
+TEST(ParallelGHistBuilder, ReduceHistF32) { ParallelGHistBuilderReduceHistF32(); }
+
+namespace {
+template <bool any_missing>
+void TestSimdBuildHist(float sparsity) {
+  Context ctx;
+  bst_idx_t constexpr kRows = 128;
+  bst_feature_t constexpr kCols = 16;
+  bst_bin_t constexpr kMaxBins = 64;
+
+  auto dmat = RandomDataGenerator(kRows, kCols, sparsity).Seed(3).GenerateDMatrix();
+  GHistIndexMatrix gmat{&ctx, dmat.get(), kMaxBins, 0.5, false};
+
+  SimpleLCG gen;
+  SimpleRealUniformDistribution<float> dist(-1.0f, 1.0f);
+  std::vector<GradientPair> gpair(kRows);
+  for (auto& g : gpair) {
+    g = GradientPair{dist(&gen), dist(&gen)};
+  }
+
+  std::vector<RowIndexT> row_indices(kRows);
+  std::iota(row_indices.begin(), row_indices.end(), 0);
+
+  auto n_bins = gmat.cut.TotalBins();
+  std::vector<GradientPairPrecise> scalar(n_bins);
+  std::vector<GradientPairPrecise> simd(n_bins);
+  BuildHist<any_missing>(gpair, row_indices, gmat, GHistRow{scalar}, false,
+                         HistBackend::kDefault);
+  BuildHist<any_missing>(gpair, row_indices, gmat, GHistRow{simd}, false, HistBackend::kSimd);
+
+  // Both kernels accumulate rows in the same order, the results are bit-identical.
+  for (bst_bin_t i = 0; i < n_bins; ++i) {
+    ASSERT_EQ(scalar[i].GetGrad(), simd[i].GetGrad());
+    ASSERT_EQ(scalar[i].GetHess(), simd[i].GetHess());
+  }
+}
+}  // anonymous namespace
+
+TEST(HistUtil, DenseIndexView) {
+  Context ctx;
+  bst_idx_t constexpr kRows = 64;
+  bst_feature_t constexpr kCols = 8;
+  auto dmat = RandomDataGenerator(kRows, kCols, 0.0).Seed(3).GenerateDMatrix();
+  GHistIndexMatrix gmat{&ctx, dmat.get(), 16, 0.5, false};
+  ASSERT_TRUE(gmat.IsDense());
+
+  auto const& index = gmat.index;
+  common::DispatchDenseIndexView(index, index.OffsetSize(), [&](auto view) {
+    for (std::size_t i = 0; i < index.Size(); ++i) {
+      ASSERT_EQ(view[i], index[i]);
+      ASSERT_EQ(view.Value(i, i % index.OffsetSize()), index[i]);
+    }
+  });
+}
+
+namespace {
+template <bool any_missing>
+void TestSoABuildHist(float sparsity) {
+  Context ctx;
+  bst_idx_t constexpr kRows = 128;
+  bst_feature_t constexpr kCols = 16;
+  bst_bin_t constexpr kMaxBins = 64;
+
+  auto dmat = RandomDataGenerator(kRows, kCols, sparsity).Seed(3).GenerateDMatrix();
+  GHistIndexMatrix gmat{&ctx, dmat.get(), kMaxBins, 0.5, false};
+
+  SimpleLCG gen;
+  SimpleRealUniformDistribution<float> dist(-1.0f, 1.0f);
+  std::vector<GradientPair> gpair(kRows);
+  std::vector<float> grad(kRows);
+  std::vector<float> hess(kRows);
+  for (bst_idx_t i = 0; i < kRows; ++i) {
+    grad[i] = dist(&gen);
+    hess[i] = dist(&gen);
+    gpair[i] = GradientPair{grad[i], hess[i]};
+  }
+
+  std::vector<RowIndexT> row_indices(kRows);
+  std::iota(row_indices.begin(), row_indices.end(), 0);
+
+  auto n_bins = gmat.cut.TotalBins();
+  std::vector<GradientPairPrecise> interleaved(n_bins);
+  std::vector<GradientPairPrecise> soa(n_bins);
+  BuildHist<any_missing>(gpair, row_indices, gmat, GHistRow{interleaved});
+  BuildHistSoA<any_missing>(grad, hess, row_indices, gmat, GHistRow{soa});
+
+  for (bst_bin_t i = 0; i < n_bins; ++i) {
+    ASSERT_EQ(interleaved[i].GetGrad(), soa[i].GetGrad());
+    ASSERT_EQ(interleaved[i].GetHess(), soa[i].GetHess());
+  }
+}
+
+template <bool any_missing>
+void TestF32BuildHist(float sparsity) {
+  Context ctx;
+  bst_idx_t constexpr kRows = 128;
+  bst_feature_t constexpr kCols = 16;
+  bst_bin_t constexpr kMaxBins = 64;
+
+  auto dmat = RandomDataGenerator(kRows, kCols, sparsity).Seed(3).GenerateDMatrix();
+  GHistIndexMatrix gmat{&ctx, dmat.get(), kMaxBins, 0.5, false};
+
+  SimpleLCG gen;
+  SimpleRealUniformDistribution<float> dist(-1.0f, 1.0f);
+  std::vector<GradientPair> gpair(kRows);
+  for (auto& g : gpair) {
+    g = GradientPair{dist(&gen), dist(&gen)};
+  }
+
+  std::vector<RowIndexT> row_indices(kRows);
+  std::iota(row_indices.begin(), row_indices.end(), 0);
+
+  auto n_bins = gmat.cut.TotalBins();
+  std::vector<GradientPairPrecise> ref(n_bins);
+  std::vector<GradientPair> f32(n_bins);
+  BuildHist<any_missing>(gpair, row_indices, gmat, GHistRow{ref});
+  BuildHistF32<any_missing>(gpair, row_indices, gmat, GHistRowF32{f32});
+
+  // The single precision accumulation rounds each partial sum, compare with a tolerance.
+  for (bst_bin_t i = 0; i < n_bins; ++i) {
+    ASSERT_NEAR(ref[i].GetGrad(), f32[i].GetGrad(), 1e-4);
+    ASSERT_NEAR(ref[i].GetHess(), f32[i].GetHess(), 1e-4);
+  }
+}
+
+template <bool any_missing>
+void TestByFeatureBuildHist(float sparsity) {
+  Context ctx;
+  bst_idx_t constexpr kRows = 128;
+  bst_feature_t constexpr kCols = 16;
+  bst_bin_t constexpr kMaxBins = 64;
+
+  auto dmat = RandomDataGenerator(kRows, kCols, sparsity).Seed(3).GenerateDMatrix();
+  GHistIndexMatrix gmat{&ctx, dmat.get(), kMaxBins, 0.5, false};
+
+  SimpleLCG gen;
+  SimpleRealUniformDistribution<float> dist(-1.0f, 1.0f);
+  std::vector<GradientPair> gpair(kRows);
+  for (auto& g : gpair) {
+    g = GradientPair{dist(&gen), dist(&gen)};
+  }
+
+  // A sorted but non-contiguous row set, as produced by the partitioner for an
+  // interior node.
+  std::vector<RowIndexT> row_indices;
+  for (bst_idx_t i = 0; i < kRows; i += 2) {
+    row_indices.push_back(i);
+  }
+
+  auto n_bins = gmat.cut.TotalBins();
+  std::vector<GradientPairPrecise> ref(n_bins);
+  BuildHist<any_missing>(gpair, row_indices, gmat, GHistRow{ref});
+
+  // Assemble the histogram from disjoint feature groups, as the feature-parallel build
+  // does with one group per thread.
+  std::vector<GradientPairPrecise> by_feature(n_bins);
+  for (bst_feature_t fbeg = 0; fbeg < kCols; fbeg += 3) {
+    auto fend = std::min(static_cast<bst_feature_t>(fbeg + 3), kCols);
+    BuildHistByFeature(gpair, row_indices, gmat, GHistRow{by_feature}, fbeg, fend);
+  }
+
+  // The column-wise walk accumulates in a different order, compare with a tolerance.
+  for (bst_bin_t i = 0; i < n_bins; ++i) {
+    ASSERT_NEAR(ref[i].GetGrad(), by_feature[i].GetGrad(), 1e-6);
+    ASSERT_NEAR(ref[i].GetHess(), by_feature[i].GetHess(), 1e-6);
+  }
+}
+}  // anonymous namespace
+
+TEST(HistUtil, SparseColsWiseBuildHist) {
+  Context ctx;
+  bst_idx_t constexpr kRows = 128;
+  bst_feature_t constexpr kCols = 16;
+  bst_bin_t constexpr kMaxBins = 64;
+  // Sparse enough that the CSC-driven kernel is selected by the density heuristic.
+  auto dmat = RandomDataGenerator(kRows, kCols, 0.95f).Seed(3).GenerateDMatrix();
+  GHistIndexMatrix gmat{&ctx, dmat.get(), kMaxBins, 0.5, false};
+  ASSERT_FALSE(gmat.IsDense());
+
+  SimpleLCG gen;
+  SimpleRealUniformDistribution<float> dist(-1.0f, 1.0f);
+  std::vector<GradientPair> gpair(kRows);
+  for (auto& g : gpair) {
+    g = GradientPair{dist(&gen), dist(&gen)};
+  }
+
+  std::vector<RowIndexT> row_indices(kRows);
+  std::iota(row_indices.begin(), row_indices.end(), 0);
+
+  auto n_bins = gmat.cut.TotalBins();
+  std::vector<GradientPairPrecise> hist(n_bins);
+  BuildHist<true>(gpair, row_indices, gmat, GHistRow{hist});
+
+  // Reference accumulation through the row-major CSR walk.
+  std::vector<GradientPairPrecise> expected(n_bins);
+  for (bst_idx_t ridx = 0; ridx < kRows; ++ridx) {
+    for (std::size_t j = gmat.row_ptr[ridx]; j < gmat.row_ptr[ridx + 1]; ++j) {
+      expected[gmat.index[j]] +=
+          GradientPairPrecise{gpair[ridx].GetGrad(), gpair[ridx].GetHess()};
+    }
+  }
+  // The column-wise walk accumulates in a different order, compare with a tolerance.
+  for (bst_bin_t i = 0; i < n_bins; ++i) {
+    ASSERT_NEAR(hist[i].GetGrad(), expected[i].GetGrad(), 1e-6);
+    ASSERT_NEAR(hist[i].GetHess(), expected[i].GetHess(), 1e-6);
+  }
+}
+
+TEST(HistUtil, SoABuildHistDense) { TestSoABuildHist<false>(0.0f); }
+
+TEST(HistUtil, SoABuildHistSparse) { TestSoABuildHist<true>(0.5f); }
+
+TEST(HistUtil, F32BuildHistDense) { TestF32BuildHist<false>(0.0f); }
+
+TEST(HistUtil, F32BuildHistSparse) { TestF32BuildHist<true>(0.5f); }
+
+TEST(HistUtil, ByFeatureBuildHistDense) { TestByFeatureBuildHist<false>(0.0f); }
+
+TEST(HistUtil, ByFeatureBuildHistSparse) { TestByFeatureBuildHist<true>(0.5f); }
+
+TEST(HistUtil, SimdBuildHistDense) {
+  if (!SimdHistSupported()) {
+    GTEST_SKIP() << "SIMD histogram kernel is not supported on this CPU.";
+  }
+  TestSimdBuildHist<false>(0.0f);
+}
+
+TEST(HistUtil, SimdBuildHistSparse) {
+  if (!SimdHistSupported()) {
+    GTEST_SKIP() << "SIMD histogram kernel is not supported on this CPU.";
+  }
+  TestSimdBuildHist<true>(0.5f);
+}
+
 TEST(CutsBuilder, SearchGroupInd) {
   size_t constexpr kNumGroups = 4;
   size_t constexpr kRows = 17;
@@ -175,6 +481,68 @@ TEST(HistUtil, DenseCutsCategorical) {
   }
 }
 
+TEST(HistUtil, PreBinnedCuts) {
+  Context ctx;
+  std::size_t constexpr kRows = 100;
+  bst_bin_t constexpr kBins = 16;
+  // A pre-binned hour-of-day style column next to a plain numerical one.
+  std::vector<float> x(kRows * 2);
+  for (std::size_t i = 0; i < kRows; ++i) {
+    x[i * 2] = static_cast<float>(i % 24);
+    x[i * 2 + 1] = static_cast<float>(i) / 7.0f;
+  }
+  auto dmat = GetDMatrixFromData(x, kRows, 2);
+  dmat->Info().feature_types.HostVector() = {FeatureType::kPreBinned, FeatureType::kNumerical};
+
+  for (bool use_sorted : {false, true}) {
+    HistogramCuts cuts = SketchOnDMatrix(&ctx, dmat.get(), kBins, use_sorted);
+    auto const& ptrs = cuts.Ptrs();
+    auto const& vals = cuts.Values();
+    // Identity cuts: one bin per integer value, 0..23, regardless of max_bin.
+    ASSERT_EQ(ptrs[1] - ptrs[0], 24);
+    for (bst_bin_t i = 0; i < 24; ++i) {
+      ASSERT_EQ(vals[ptrs[0] + i], static_cast<float>(i + 1));
+      ASSERT_EQ(cuts.SearchBin(static_cast<float>(i), 0), i);
+    }
+    // The numerical feature is still sketched.
+    ASSERT_LE(ptrs[2] - ptrs[1], static_cast<std::uint32_t>(kBins) + 1);
+    ASSERT_GT(ptrs[2] - ptrs[1], 1);
+    ASSERT_FALSE(cuts.HasCategorical());
+  }
+}
+
+TEST(HistUtil, CutsJsonRoundTrip) {
+  Context ctx;
+  int num_bins = 256;
+  auto m = RandomDataGenerator{1000, 8, 0.3}.GenerateDMatrix();
+  HistogramCuts cuts = SketchOnDMatrix(&ctx, m.get(), num_bins);
+  cuts.SetCategorical(true, 13.0f);
+
+  Json out{Object{}};
+  cuts.SaveJson(&out);
+
+  // In-memory round trip keeps the typed arrays.
+  HistogramCuts loaded;
+  loaded.LoadJson(out);
+  ASSERT_EQ(loaded.Values(), cuts.Values());
+  ASSERT_EQ(loaded.Ptrs(), cuts.Ptrs());
+  ASSERT_EQ(loaded.MinValues(), cuts.MinValues());
+  ASSERT_EQ(loaded.HasCategorical(), cuts.HasCategorical());
+  ASSERT_EQ(loaded.MaxCategory(), cuts.MaxCategory());
+
+  // A round trip through text JSON degrades the typed arrays to plain arrays of numbers,
+  // the values must still be bit-exact.
+  std::string str;
+  Json::Dump(out, &str);
+  HistogramCuts from_text;
+  from_text.LoadJson(Json::Load(StringView{str}));
+  ASSERT_EQ(from_text.Values(), cuts.Values());
+  ASSERT_EQ(from_text.Ptrs(), cuts.Ptrs());
+  ASSERT_EQ(from_text.MinValues(), cuts.MinValues());
+  ASSERT_EQ(from_text.HasCategorical(), cuts.HasCategorical());
+  ASSERT_EQ(from_text.MaxCategory(), cuts.MaxCategory());
+}
+
 TEST(HistUtil, DenseCutsAccuracyTest) {
   Context ctx;
   int bin_sizes[] = {2, 16, 256, 512};
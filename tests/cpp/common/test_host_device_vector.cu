@@ -6,8 +6,13 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <xgboost/host_device_vector.h>
 
+#include <cstdint>  // for uint32_t
+#include <numeric>  // for iota
+
 #include "../../../src/common/cuda_rt_utils.h"  // for SetDevice
+#include "../../../src/common/cuda_staging.cuh"  // for StagingBufferPool
 #include "../../../src/common/device_helpers.cuh"
+#include "../../../src/common/transfer_stats.h"  // for TransferStats
 
 namespace xgboost::common {
 namespace {
@@ -219,4 +224,46 @@ TEST(HostDeviceVector, Resize) {
     check(vec);
   }
 }
+
+TEST(HostDeviceVector, StagedSync) {
+  // Large enough for the pinned staging path, not a multiple of the chunk size.
+  std::size_t n = cuda_impl::StagingBufferPool::kChunkBytes / sizeof(std::uint32_t) * 3 + 37;
+  HostDeviceVector<std::uint32_t> vec;
+  vec.SetDevice(DeviceOrd::CUDA(0));
+  auto& h_vec = vec.HostVector();
+  h_vec.resize(n);
+  std::iota(h_vec.begin(), h_vec.end(), 0u);
+
+  auto d_vec = vec.ConstDeviceSpan();
+  ASSERT_TRUE(thrust::equal(thrust::device, dh::tcbegin(d_vec), dh::tcend(d_vec),
+                            thrust::make_counting_iterator(0u)));
+
+  // Force a device write, then sync back through the staged D2H path.
+  vec.DeviceSpan();
+  auto const& h_res = vec.ConstHostVector();
+  for (std::size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(h_res[i], i);
+  }
+}
+
+TEST(HostDeviceVector, TransferStats) {
+  auto base = TransferStats::Instance().Snapshot();
+
+  std::size_t n = 128;
+  HostDeviceVector<float> vec(n, 1.0f, DeviceOrd::CPU());
+  vec.SetDevice(DeviceOrd::CUDA(0));
+  vec.ConstDeviceSpan();   // H2D
+  vec.HostVector();        // write on host, drops the device copy
+  vec.ConstDeviceSpan();   // H2D again
+  vec.DeviceSpan();        // device write
+  vec.ConstHostVector();   // D2H
+
+  auto cur = TransferStats::Instance().Snapshot();
+  ASSERT_EQ(cur.h2d_count, base.h2d_count + 2);
+  ASSERT_GE(cur.h2d_bytes, base.h2d_bytes + 2 * n * sizeof(float));
+  ASSERT_EQ(cur.d2h_count, base.d2h_count + 1);
+  ASSERT_GE(cur.d2h_bytes, base.d2h_bytes + n * sizeof(float));
+  // The final D2H reverses the direction of the preceding H2D.
+  ASSERT_EQ(cur.round_trips, base.round_trips + 1);
+}
 }  // namespace xgboost::common
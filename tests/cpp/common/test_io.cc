@@ -8,6 +8,7 @@
 #include <numeric>  // for iota
 
 #include "../../../src/common/io.h"
+#include "xgboost/global_config.h"  // for GlobalConfigThreadLocalStore
 #include "../filesystem.h"  // dmlc::TemporaryDirectory
 #include "../helpers.h"
 
@@ -153,6 +154,27 @@ TEST(IO, Resource) {
   }
 }
 
+TEST(IO, HugePageResource) {
+  // The huge page advice is best-effort; the allocation must behave identically with the
+  // flag toggled on.
+  auto *config = GlobalConfigThreadLocalStore::Get();
+  auto restore = config->use_hugepage;
+  config->use_hugepage = true;
+
+  auto n = detail::HugePageThresholdBytes();
+  auto resource = std::make_shared<MallocResource>(n);
+  ASSERT_EQ(resource->Size(), n);
+  auto ptr = resource->DataAs<std::uint8_t>();
+  std::iota(ptr, ptr + 256, 0);
+  resource->Resize(n * 2);
+  for (std::size_t i = 0; i < 256; ++i) {
+    ASSERT_EQ(resource->DataAs<std::uint8_t>()[i], i);
+  }
+  ASSERT_EQ(resource->DataAs<std::uint8_t>()[n], 0);
+
+  config->use_hugepage = restore;
+}
+
 TEST(IO, PrivateMmapStream) {
   dmlc::TemporaryDirectory tempdir;
   auto path = tempdir.path + "/testfile";
@@ -7,6 +7,7 @@
 #include <limits>  // for numeric_limits
 #include <map>
 #include <numeric>  // for iota
+#include <thread>   // for thread
 
 #include "../../../src/common/io.h"
 #include "../../../src/common/json_utils.h"
@@ -728,6 +729,51 @@ TEST(UBJson, Basic) {
   }
 }
 
+TEST(UBJson, LargeArray) {
+  // Exercise the parallel serialization path for large arrays.
+  std::vector<Json> elements(512);
+  for (std::size_t i = 0; i < elements.size(); ++i) {
+    Json obj{Object{}};
+    obj["idx"] = Integer{static_cast<Integer::Int>(i)};
+    F32Array values(8);
+    for (std::size_t j = 0; j < 8; ++j) {
+      values.Set(j, static_cast<float>(i + j));
+    }
+    obj["values"] = std::move(values);
+    elements[i] = std::move(obj);
+  }
+  Json doc{Object{}};
+  doc["trees"] = Array{std::move(elements)};
+
+  std::vector<char> out;
+  Json::Dump(doc, &out, std::ios::binary);
+  auto loaded = Json::Load(StringView{out.data(), out.size()}, std::ios::binary);
+  ASSERT_EQ(doc, loaded);
+}
+
+
+TEST(UBJson, LargeTypedArray) {
+  // Exercise the chunked parallel byte-swap for typed array payloads.
+  std::size_t constexpr kElems = (1ul << 17) + 3;
+  F32Array f32(kElems);
+  I64Array i64(kElems);
+  for (std::size_t i = 0; i < kElems; ++i) {
+    f32.Set(i, static_cast<float>(i) * 0.5f);
+    i64.Set(i, static_cast<std::int64_t>(i) << 32);
+  }
+  Json doc{Object{}};
+  doc["split_conditions"] = std::move(f32);
+  doc["offsets"] = std::move(i64);
+
+  std::vector<char> out;
+  Json::Dump(doc, &out, std::ios::binary);
+  auto loaded = Json::Load(StringView{out.data(), out.size()}, std::ios::binary);
+  ASSERT_EQ(doc, loaded);
+  ASSERT_EQ(get<F32Array const>(loaded["split_conditions"]).back(),
+            static_cast<float>(kElems - 1) * 0.5f);
+  ASSERT_EQ(get<I64Array const>(loaded["offsets"]).back(),
+            static_cast<std::int64_t>(kElems - 1) << 32);
+}
 
 TEST(Json, TypeCheck) {
   Json config{Object{}};
@@ -744,6 +790,48 @@ TEST(Json, TypeCheck) {
   }
 }
 
+TEST(Json, EscapedString) {
+  // Strings without escapes take the bulk-copy fast path, escaped ones fall back to
+  // the per-character scan; keys go through the same routine as values.
+  auto doc = Json::Load(StringView{R"({"a\tb": 1, "plain": "x\ny"})"});
+  ASSERT_EQ(get<Integer>(doc["a\tb"]), 1);
+  ASSERT_EQ(get<String>(doc["plain"]), "x\ny");
+
+  auto round_trip = Json::Load(StringView{Json::Dump(doc)});
+  ASSERT_EQ(round_trip, doc);
+}
+
+TEST(Json, PooledValueAllocation) {
+  // Value nodes come out of thread-local slabs.  Nodes built on worker threads must
+  // outlive those threads and be safely destroyed or replaced on the main thread.
+  std::vector<Json> docs(8);
+  std::vector<std::thread> workers;
+  for (std::size_t i = 0; i < docs.size(); ++i) {
+    workers.emplace_back([&docs, i] {
+      Json doc{Object{}};
+      doc["values"] = Array{};
+      auto& arr = get<Array>(doc["values"]);
+      for (std::int64_t j = 0; j < 1024; ++j) {
+        arr.emplace_back(Integer{j});
+      }
+      doc["name"] = String{"doc-" + std::to_string(i)};
+      docs[i] = doc;
+    });
+  }
+  for (auto& w : workers) {
+    w.join();
+  }
+  for (std::size_t i = 0; i < docs.size(); ++i) {
+    ASSERT_EQ(get<Integer const>(docs[i]["values"][1023]), 1023);
+    ASSERT_EQ(get<String const>(docs[i]["name"]), "doc-" + std::to_string(i));
+    auto round_trip = Json::Load(StringView{Json::Dump(docs[i])});
+    ASSERT_EQ(round_trip, docs[i]);
+  }
+  for (auto& doc : docs) {
+    doc["values"] = Null{};
+  }
+}
+
 TEST(Json, Dump) {
   auto str = GetModelStr();
   auto jobj = Json::Load(str);
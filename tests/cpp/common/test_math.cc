@@ -0,0 +1,59 @@
+/**
+ * Copyright 2024, XGBoost Contributors
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>   // for exp, abs
+#include <limits>  // for numeric_limits
+#include <vector>  // for vector
+
+#include "../../../src/common/math.h"
+
+namespace xgboost::common {
+TEST(Math, ApproxExp) {
+  // Sweep the clamped input range, the relative error should stay within a few ulps.
+  for (float x = -87.0f; x <= 88.0f; x += 1e-2f) {
+    auto expected = std::exp(static_cast<double>(x));
+    auto got = static_cast<double>(ApproxExp(x));
+    ASSERT_LE(std::abs(got - expected) / expected, 1e-6) << x;
+  }
+  // Out-of-range inputs are clamped instead of overflowing.
+  ASSERT_TRUE(std::isfinite(ApproxExp(1000.0f)));
+  ASSERT_GE(ApproxExp(-1000.0f), 0.0f);
+}
+
+TEST(Math, HalfRoundTrip) {
+  // Values representable in half precision survive the round trip exactly.
+  for (auto v : {0.0f, -0.0f, 1.0f, -2.5f, 0.375f, 65504.0f, 6.103515625e-05f}) {
+    ASSERT_EQ(FromHalf(ToHalf(v)), v) << v;
+  }
+  // Others round to the nearest half, within the 2^-11 relative spacing.
+  for (auto v : {0.1f, -3.3f, 1234.5f}) {
+    auto got = FromHalf(ToHalf(v));
+    ASSERT_NE(got, v);
+    ASSERT_NEAR(got, v, std::abs(v) / 1024.0f) << v;
+  }
+  // Specials: overflow to infinity, nan stays nan, subnormals keep their value.
+  ASSERT_TRUE(std::isinf(FromHalf(ToHalf(1e6f))));
+  ASSERT_TRUE(std::isnan(FromHalf(ToHalf(std::numeric_limits<float>::quiet_NaN()))));
+  ASSERT_EQ(FromHalf(ToHalf(5.960464477539063e-08f)), 5.960464477539063e-08f);
+}
+
+TEST(Math, ApproxSigmoid) {
+  for (float x = -30.0f; x <= 30.0f; x += 1e-2f) {
+    auto expected = Sigmoid(x);
+    auto got = ApproxSigmoid(x);
+    ASSERT_NEAR(got, expected, 1e-6f * std::max(expected, 1e-3f)) << x;
+  }
+}
+
+TEST(Math, ApproxSoftmax) {
+  std::vector<float> exact{-1.0f, 0.5f, 2.0f, 4.0f};
+  auto approx = exact;
+  Softmax(exact.begin(), exact.end());
+  ApproxSoftmax(approx.begin(), approx.end());
+  for (std::size_t i = 0; i < exact.size(); ++i) {
+    ASSERT_NEAR(approx[i], exact[i], 1e-6f) << i;
+  }
+}
+}  // namespace xgboost::common
@@ -0,0 +1,36 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include <gtest/gtest.h>
+
+#include <utility>  // for move
+
+#include "../../../src/common/memory_stats.h"
+
+namespace xgboost::common {
+TEST(MemoryStats, Reporter) {
+  auto usage = [] {
+    auto snapshot = MemoryUsageRegistry::Instance().Snapshot();
+    auto it = snapshot.find("test-component");
+    return it == snapshot.cend() ? std::size_t{0} : it->second;
+  };
+  auto base = usage();
+  {
+    MemoryUsageReporter reporter{"test-component"};
+    reporter.Update(128);
+    ASSERT_EQ(usage(), base + 128);
+    // Shrinking adjusts by the delta.
+    reporter.Update(32);
+    ASSERT_EQ(usage(), base + 32);
+
+    // The moved-to reporter takes over the reported bytes.
+    MemoryUsageReporter other{std::move(reporter)};
+    ASSERT_EQ(usage(), base + 32);
+    // A copy starts with nothing reported.
+    MemoryUsageReporter copy{other};  // NOLINT
+    ASSERT_EQ(usage(), base + 32);
+  }
+  // Destruction withdraws the footprint.
+  ASSERT_EQ(usage(), base);
+}
+}  // namespace xgboost::common
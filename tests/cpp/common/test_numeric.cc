@@ -6,6 +6,7 @@
 #include <numeric>
 
 #include "../../../src/common/numeric.h"
+#include "../helpers.h"
 
 namespace xgboost {
 namespace common {
@@ -39,5 +40,24 @@ TEST(Numeric, Reduce) {
   auto sum = Reduce(&ctx, values);
   ASSERT_EQ(sum, (values.Size() - 1) * values.Size() / 2);
 }
+
+TEST(Numeric, ReduceDeterministic) {
+  // The reduction tree is independent of the number of threads, results must be bitwise
+  // reproducible across nthread.
+  std::size_t n = (1ul << 16) + 3;
+  std::vector<float> values(n);
+  SimpleLCG gen;
+  SimpleRealUniformDistribution<float> dist{-1.0f, 1.0f};
+  for (auto& v : values) {
+    v = dist(&gen);
+  }
+  Context ctx;
+  auto sol = cpu_impl::Reduce(&ctx, values.cbegin(), values.cend(), 0.0);
+  for (std::int32_t n_threads : {1, 2, 3, 7}) {
+    ctx.UpdateAllowUnknown(Args{{"nthread", std::to_string(n_threads)}});
+    auto sum = cpu_impl::Reduce(&ctx, values.cbegin(), values.cend(), 0.0);
+    ASSERT_EQ(sum, sol);
+  }
+}
 }  // namespace common
 }  // namespace xgboost
@@ -30,6 +30,31 @@ TEST(Quantile, LoadBalance) {
   CHECK_EQ(n_cols, kCols);
 }
 
+TEST(Quantile, BoundedSketch) {
+  using WQSketch = HostSketchContainer::WQSketch;
+  std::size_t constexpr kRows = 1 << 16, kMaxEntries = 512;
+  WQSketch sketch;
+  sketch.InitBounded(kRows, 1.0 / (64 * WQSketch::kFactor), kMaxEntries);
+
+  SimpleLCG lcg;
+  SimpleRealUniformDistribution<float> dist{0.0f, 1.0f};
+  for (std::size_t i = 0; i < kRows; ++i) {
+    sketch.Push(dist(&lcg));
+  }
+  // The merge structure must stay within the budget regardless of the number of rows.
+  ASSERT_LE(sketch.data.size(), kMaxEntries);
+  ASSERT_LE(sketch.inqueue.queue.size(), kMaxEntries);
+
+  WQSketch::SummaryContainer out;
+  sketch.GetSummary(&out);
+  ASSERT_GT(out.size, 0);
+  for (std::size_t i = 0; i < out.size; ++i) {
+    auto const& e = out.data[i];
+    // For the uniform distribution the value approximates the normalized rank.
+    ASSERT_NEAR(e.value, (e.rmin + e.rmax) / 2.0 / kRows, 0.05);
+  }
+}
+
 namespace {
 template <bool use_column>
 using ContainerType = std::conditional_t<use_column, SortedSketchContainer, HostSketchContainer>;
@@ -3,6 +3,8 @@
  */
 #include <gtest/gtest.h>
 
+#include <memory>  // for make_unique
+
 #include "../../../src/collective/allreduce.h"
 #include "../../../src/common/hist_util.cuh"
 #include "../../../src/common/quantile.cuh"
@@ -243,6 +245,54 @@ TEST(GPUQuantile, MergeBasic) {
   });
 }
 
+TEST(GPUQuantile, HostSpillMerge) {
+  constexpr size_t kRows = 1000, kCols = 100;
+  constexpr bst_bin_t kBins = 64;
+  auto ctx = MakeCUDACtx(0);
+  MetaInfo info;
+  HostDeviceVector<FeatureType> ft;
+
+  auto make_sketch = [&](std::int32_t seed) {
+    auto sketch = std::make_unique<SketchContainer>(ft, kBins, kCols, kRows, ctx.Device());
+    HostDeviceVector<float> storage;
+    std::string interface_str = RandomDataGenerator{kRows, kCols, 0}
+                                    .Device(ctx.Device())
+                                    .Seed(seed)
+                                    .GenerateArrayInterface(&storage);
+    data::CupyAdapter adapter(interface_str);
+    AdapterDeviceSketch(&ctx, adapter.Value(), kBins, info,
+                        std::numeric_limits<float>::quiet_NaN(), sketch.get());
+    return sketch;
+  };
+
+  // Reference: merge directly on device.
+  auto direct = make_sketch(0);
+  auto that = make_sketch(1);
+  direct->Merge(&ctx, that->ColumnsPtr(), that->Data());
+  direct->FixError();
+
+  // Round trip through the host spill, releasing the device buffers in between.
+  HostSketchSummary spilled{&ctx, *that};
+  ASSERT_GT(spilled.MemCostBytes(), 0);
+  that.reset();
+
+  auto streamed = make_sketch(0);
+  spilled.MergeInto(&ctx, streamed.get());
+  streamed->FixError();
+
+  ASSERT_EQ(streamed->Data().size(), direct->Data().size());
+  std::vector<SketchEntry> h_direct(direct->Data().size());
+  std::vector<SketchEntry> h_streamed(streamed->Data().size());
+  dh::CopyDeviceSpanToVector(&h_direct, direct->Data());
+  dh::CopyDeviceSpanToVector(&h_streamed, streamed->Data());
+  for (size_t i = 0; i < h_direct.size(); ++i) {
+    ASSERT_EQ(h_direct[i].value, h_streamed[i].value);
+    ASSERT_EQ(h_direct[i].rmin, h_streamed[i].rmin);
+    ASSERT_EQ(h_direct[i].rmax, h_streamed[i].rmax);
+    ASSERT_EQ(h_direct[i].wmin, h_streamed[i].wmin);
+  }
+}
+
 void TestMergeDuplicated(int32_t n_bins, size_t cols, size_t rows, float frac) {
   auto ctx = MakeCUDACtx(0);
   MetaInfo info;
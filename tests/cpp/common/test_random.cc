@@ -192,4 +192,89 @@ TEST(ColumnSampler, GPUWeightedMultiSampling) {
   TestWeightedMultiSampling(&ctx);
 }
 #endif  // defined(XGBOOST_USE_CUDA)
+
+TEST(ColumnSampler, TopKFilter) {
+  Context ctx;
+  bst_feature_t constexpr kCols = 8;
+  std::vector<float> feature_weights;
+  ColumnSampler cs{1u};
+  cs.ConfigureTopK(2, 0);  // no periodic sweeps
+
+  cs.Init(&ctx, kCols, feature_weights, 1.0f, 1.0f, 1.0f);
+  // No gain history, the set stays exact at any depth.
+  ASSERT_EQ(cs.GetFeatureSet(ColumnSampler::TopKMinDepth())->Size(), kCols);
+
+  cs.RecordSplitGain(3, 2.0);
+  cs.RecordSplitGain(5, 1.0);
+  cs.RecordSplitGain(6, 0.5);
+
+  // The ranking is computed per tree, at Init.
+  cs.Init(&ctx, kCols, feature_weights, 1.0f, 1.0f, 1.0f);
+  // Shallow nodes stay exact.
+  ASSERT_EQ(cs.GetFeatureSet(0)->Size(), kCols);
+  auto filtered = cs.GetFeatureSet(ColumnSampler::TopKMinDepth());
+  ASSERT_EQ(filtered->HostVector(), std::vector<bst_feature_t>({3, 5}));
+
+  // Every tree is a full sweep with interval 1.
+  cs.ConfigureTopK(2, 1);
+  cs.Init(&ctx, kCols, feature_weights, 1.0f, 1.0f, 1.0f);
+  ASSERT_EQ(cs.GetFeatureSet(ColumnSampler::TopKMinDepth())->Size(), kCols);
+}
+
+TEST(ColumnSampler, NodePredicate) {
+  Context ctx;
+  bst_feature_t constexpr kCols = 256;
+  bst_node_t constexpr kNodes = 64;
+  std::vector<float> feature_weights;
+
+  ColumnSampler cs{3u};
+  cs.Init(&ctx, kCols, feature_weights, 0.5f, 1.0f, 1.0f);
+  auto pred = cs.NodePredicate();
+  ASSERT_TRUE(static_cast<bool>(pred));
+
+  // Same seed, same predicate across samplers, as required for distributed training.
+  ColumnSampler cs1{3u};
+  cs1.Init(&ctx, kCols, feature_weights, 0.5f, 1.0f, 1.0f);
+  auto pred1 = cs1.NodePredicate();
+
+  auto p_features = cs.GetFeatureSetByPredicate(0);
+  // The per-node shuffle is skipped, bynode sampling happens through the predicate.
+  ASSERT_EQ(p_features->Size(), kCols);
+  auto const& h_features = p_features->ConstHostVector();
+
+  std::size_t n_kept{0};
+  for (bst_node_t nidx = 0; nidx < kNodes; ++nidx) {
+    std::size_t n_node{0};
+    for (std::size_t i = 0; i < h_features.size(); ++i) {
+      bool kept = pred(h_features[i], i, h_features.size(), nidx);
+      ASSERT_EQ(kept, pred1(h_features[i], i, h_features.size(), nidx));
+      n_node += kept;
+    }
+    ASSERT_GE(n_node, 1);
+    n_kept += n_node;
+  }
+  // The number of kept features is binomial, close to the sampling rate on average.
+  auto frac = static_cast<double>(n_kept) / (static_cast<double>(kNodes) * kCols);
+  ASSERT_NEAR(frac, 0.5, 0.05);
+
+  // Even a vanishing rate keeps one feature per node.
+  cs.Init(&ctx, kCols, feature_weights, 1e-16f, 1.0f, 1.0f);
+  auto tiny = cs.NodePredicate();
+  for (bst_node_t nidx = 0; nidx < kNodes; ++nidx) {
+    std::size_t n_node{0};
+    for (std::size_t i = 0; i < h_features.size(); ++i) {
+      n_node += tiny(h_features[i], i, h_features.size(), nidx);
+    }
+    ASSERT_EQ(n_node, 1);
+  }
+
+  // Weighted sampling needs materialized per-node sets, the predicate is disabled.
+  std::vector<float> weights(kCols, 1.0f);
+  cs.Init(&ctx, kCols, weights, 0.5f, 1.0f, 1.0f);
+  ASSERT_FALSE(static_cast<bool>(cs.NodePredicate()));
+
+  // So is sampling without colsample_bynode.
+  cs.Init(&ctx, kCols, feature_weights, 1.0f, 0.5f, 1.0f);
+  ASSERT_FALSE(static_cast<bool>(cs.NodePredicate()));
+}
 }  // namespace xgboost::common
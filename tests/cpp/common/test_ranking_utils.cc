@@ -103,6 +103,19 @@ void TestRankingCache(Context const* ctx) {
   for (std::size_t i = 0; i < rank_idx.size(); ++i) {
     ASSERT_EQ(rank_idx[i], rank_idx.size() - i - 1);
   }
+
+  // Perturb the predictions.  The cached order from the previous iteration is repaired
+  // incrementally and must still be sorted.
+  for (std::size_t i = 0; i < h_predt.size(); ++i) {
+    if (i % 4 == 0) {
+      h_predt[i] += 8.0f;
+    }
+  }
+  predt.SetDevice(ctx->Device());
+  rank_idx = cache.SortedIdx(ctx, ctx->IsCPU() ? predt.ConstHostSpan() : predt.ConstDeviceSpan());
+  for (std::size_t i = 1; i < rank_idx.size(); ++i) {
+    ASSERT_GE(h_predt[rank_idx[i - 1]], h_predt[rank_idx[i]]);
+  }
 }
 
 TEST(RankingCache, InitFromCPU) {
@@ -4,6 +4,7 @@
 #include <gtest/gtest.h>
 
 #include <cstddef>  // for size_t
+#include <cstdint>  // for int32_t
 #include <memory>   // for make_shared, make_unique
 #include <numeric>  // for iota
 #include <vector>   // for vector
@@ -41,6 +42,18 @@ TEST(RefResourceView, Basic) {
   ASSERT_EQ(mem.use_count(), 1);
 }
 
+TEST(RefResourceView, ParallelFill) {
+  for (std::int32_t n_threads : {1, 3, 8}) {
+    auto data = MakeFixedVecWithMalloc(4097, std::size_t{7}, n_threads);
+    ASSERT_EQ(data.size(), 4097);
+    for (auto v : data) {
+      ASSERT_EQ(v, 7);
+    }
+  }
+  auto empty = MakeFixedVecWithMalloc(0, std::size_t{0}, 4);
+  ASSERT_TRUE(empty.empty());
+}
+
 TEST(RefResourceView, IO) {
   dmlc::TemporaryDirectory tmpdir;
   auto path = tmpdir.path + "/testfile";
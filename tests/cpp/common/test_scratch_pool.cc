@@ -0,0 +1,56 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include <gtest/gtest.h>
+#include <xgboost/context.h>  // for Context
+
+#include <cstddef>  // for size_t
+#include <numeric>  // for iota
+#include <vector>   // for vector
+
+#include "../../../src/common/scratch_pool.h"
+#include "../../../src/common/threading_utils.h"  // for ParallelFor
+
+namespace xgboost::common {
+TEST(ScratchPool, Reuse) {
+  ScratchPool pool;
+  double* first{nullptr};
+  {
+    auto buf = pool.Checkout<double>(128);
+    ASSERT_EQ(buf.size(), 128);
+    std::iota(buf.begin(), buf.end(), 0.0);
+    ASSERT_EQ(buf[127], 127.0);
+    first = buf.data();
+  }
+  {
+    // The block went back to the pool, an equal or smaller checkout gets it again.
+    auto buf = pool.Checkout<double>(64);
+    ASSERT_EQ(buf.data(), first);
+  }
+  {
+    auto buf = pool.Checkout<float>(32, 1.5f);
+    for (auto v : buf) {
+      ASSERT_EQ(v, 1.5f);
+    }
+  }
+}
+
+TEST(ScratchPool, Concurrent) {
+  Context ctx;
+  auto* pool = ctx.Scratch();
+  ASSERT_EQ(pool, ctx.Scratch());
+
+  // Buffers checked out concurrently must not alias each other.
+  auto n_threads = ctx.Threads();
+  std::vector<std::size_t> sums(n_threads * 16, 0);
+  ParallelFor(sums.size(), n_threads, [&](std::size_t i) {
+    auto buf = pool->Checkout<std::size_t>(256, i);
+    for (auto v : buf) {
+      sums[i] += v;
+    }
+  });
+  for (std::size_t i = 0; i < sums.size(); ++i) {
+    ASSERT_EQ(sums[i], i * 256);
+  }
+}
+}  // namespace xgboost::common
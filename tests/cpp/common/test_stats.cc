@@ -37,6 +37,36 @@ TEST(Stats, Quantile) {
   }
 }
 
+TEST(Stats, P2Quantile) {
+  Context ctx;
+  {
+    // Exact while fewer than five observations have been pushed.
+    std::vector<float> vec{3., 1., 4., 2.};
+    P2Quantile acc{0.5};
+    for (auto v : vec) {
+      acc.Push(v);
+    }
+    auto beg = MakeIndexTransformIter([&](size_t i) { return vec[i]; });
+    ASSERT_EQ(acc.Value(), Quantile(&ctx, 0.5, beg, beg + vec.size()));
+  }
+  {
+    ASSERT_TRUE(std::isnan(P2Quantile{0.5}.Value()));
+  }
+  {
+    // Approximation over a large stream stays close to the exact quantile.
+    SimpleLCG rng;
+    SimpleRealUniformDistribution<float> dist{0.0f, 1.0f};
+    for (auto alpha : {0.1, 0.5, 0.9}) {
+      P2Quantile acc{alpha};
+      std::size_t constexpr kN = 1 << 16;
+      for (std::size_t i = 0; i < kN; ++i) {
+        acc.Push(dist(&rng));
+      }
+      ASSERT_NEAR(acc.Value(), alpha, 0.05);
+    }
+  }
+}
+
 TEST(Stats, WeightedQuantile) {
   Context ctx;
   linalg::Tensor<float, 1> arr({1.f, 2.f, 3.f, 4.f, 5.f}, {5}, DeviceOrd::CPU());
@@ -3,11 +3,13 @@
  */
 #include <gtest/gtest.h>
 
+#include <atomic>   // std::atomic
 #include <cstddef>  // std::size_t
 
 #include "../../../src/common/threading_utils.h"  // BlockedSpace2d,ParallelFor2d,ParallelFor
 #include "dmlc/omp.h"                             // omp_in_parallel
 #include "xgboost/context.h"                      // Context
+#include "xgboost/json.h"                         // for Json, Object, Integer
 
 namespace xgboost::common {
 TEST(ParallelFor2d, CreateBlockedSpace2d) {
@@ -87,6 +89,57 @@ TEST(ParallelFor2d, NonUniform) {
   }
 }
 
+TEST(ParallelFor2d, GrainSize) {
+  // small inputs stay at the floor so the per-block cost is bounded.
+  ASSERT_EQ(GrainSize(1000, 8, 256), 256);
+  // large inputs on few threads produce bigger blocks instead of over-splitting.
+  ASSERT_EQ(GrainSize(1 << 20, 8, 256), (1 << 20) / (8 * 4));
+  // many threads each get several blocks.
+  auto grain = GrainSize(1 << 20, 128, 256);
+  ASSERT_GE((1 << 20) / grain, 128 * 2);
+  // degenerate thread counts are clamped.
+  ASSERT_EQ(GrainSize(100, 0, 1), 25);
+}
+
+TEST(ParallelFor2d, ThreadImbalance) {
+  constexpr size_t kDim1 = 4;
+  constexpr size_t kDim2 = 64;
+  BlockedSpace2d space(
+      kDim1, [&](size_t) { return kDim2; }, 8);
+
+  auto& registry = PerfStats::Instance();
+  registry.Enable(true);
+  registry.Reset();
+
+  std::atomic<int> n_blocks{0};
+  ParallelFor2d("TestRegion", space, 4, [&](size_t, Range1d) { n_blocks++; });
+  ASSERT_EQ(n_blocks, space.Size());
+
+  auto jstats = registry.ToJson();
+  auto const& region = get<Object const>(jstats["ParallelFor2d"]);
+  for (auto const* name :
+       {"TestRegion.busy_min", "TestRegion.busy_max", "TestRegion.busy_mean",
+        "TestRegion.busy_stddev"}) {
+    auto it = region.find(name);
+    ASSERT_NE(it, region.cend()) << name;
+    ASSERT_EQ(get<Integer const>(get<Object const>(it->second).at("count")), 1);
+  }
+  // max is an upper bound for min and mean by construction.
+  auto us = [&](char const* name) {
+    return get<Integer const>(get<Object const>(region.at(name)).at("elapsed_us"));
+  };
+  ASSERT_LE(us("TestRegion.busy_min"), us("TestRegion.busy_max"));
+
+  registry.Enable(false);
+  registry.Reset();
+
+  // Disabled counters fall through to the plain loop.
+  n_blocks = 0;
+  ParallelFor2d("TestRegion", space, 4, [&](size_t, Range1d) { n_blocks++; });
+  ASSERT_EQ(n_blocks, space.Size());
+  ASSERT_TRUE(IsA<Null>(registry.ToJson()["ParallelFor2d"]));
+}
+
 TEST(ParallelFor, Basic) {
   Context ctx;
   std::size_t n{16};
@@ -101,6 +154,44 @@ TEST(ParallelFor, Basic) {
   ASSERT_FALSE(omp_in_parallel());
 }
 
+TEST(OmpHotTeamGuard, RestoresDynamic) {
+#if defined(_OPENMP)
+  auto dynamic = omp_get_dynamic();
+  {
+    OmpHotTeamGuard guard{4};
+    ASSERT_EQ(omp_get_dynamic(), 0);
+    std::atomic<std::int32_t> cnt{0};
+    ParallelFor(8, 4, [&](auto) { cnt.fetch_add(1, std::memory_order_relaxed); });
+    ASSERT_EQ(cnt.load(), 8);
+  }
+  ASSERT_EQ(omp_get_dynamic(), dynamic);
+#endif
+}
+
+TEST(ThreadGovernor, Share) {
+  auto& governor = ThreadGovernor::Instance();
+  auto n0 = governor.Participants();
+  auto base = governor.Share();
+  ASSERT_GE(base, 1);
+  {
+    ThreadGovernor::Participant p0, p1;
+    ASSERT_EQ(governor.Participants(), n0 + 2);
+    auto share = governor.Share();
+    ASSERT_GE(share, 1);
+    ASSERT_LE(share, base);
+
+    // An unspecified `nthread` is capped to the fair share.
+    Context ctx;
+    ASSERT_LE(ctx.Threads(), share);
+    // An explicit `nthread` is honored unchanged.
+    Context configured;
+    configured.Init(Args{{"nthread", std::to_string(base)}});
+    ASSERT_GE(configured.Threads(), ctx.Threads());
+  }
+  ASSERT_EQ(governor.Participants(), n0);
+  ASSERT_EQ(governor.Share(), base);
+}
+
 TEST(OmpGetNumThreads, Max) {
 #if defined(_OPENMP)
   auto n_threads = OmpGetNumThreads(1 << 18);
@@ -0,0 +1,52 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ */
+#include <gtest/gtest.h>
+#include <xgboost/data.h>  // for MetaInfo
+
+#include <cstdint>  // for int64_t
+#include <memory>   // for make_shared
+#include <vector>   // for vector
+
+#include "../../../src/data/cat_dict.h"
+#include "xgboost/context.h"  // for Context
+
+namespace xgboost::data {
+TEST(CatDictionary, BuildAndEncode) {
+  Context ctx;
+  CatDictionary dict;
+
+  std::vector<std::int64_t> keys{42, 7, 42, 1024, 7, 7};
+  dict.BuildFeature(&ctx, 0, keys);
+  ASSERT_EQ(dict.NumFeatures(), 1);
+  ASSERT_EQ(dict.NumCategories(0), 3);
+
+  // Codes are the rank of the key in the sorted distinct keys, unseen keys map to -1.
+  std::vector<std::int64_t> queries{7, 42, 1024, 3};
+  std::vector<bst_cat_t> codes(queries.size());
+  dict.Encode(&ctx, 0, queries, codes);
+  ASSERT_EQ(codes, (std::vector<bst_cat_t>{0, 1, 2, -1}));
+
+  // Rebuilding a feature replaces its dictionary.
+  dict.BuildFeature(&ctx, 0, std::vector<std::int64_t>{7});
+  ASSERT_EQ(dict.NumCategories(0), 1);
+}
+
+TEST(CatDictionary, SharedWithMetaInfo) {
+  Context ctx;
+  MetaInfo info;
+  info.num_row_ = 4;
+  info.cat_dict = std::make_shared<CatDictionary>();
+  info.cat_dict->BuildFeature(&ctx, 0, std::vector<std::int64_t>{3, 1, 2});
+
+  // A slice encodes with the same mapping as the full matrix.
+  std::vector<bst_idx_t> ridxs{1, 2};
+  auto sliced = info.Slice(&ctx, ridxs, 0);
+  ASSERT_EQ(sliced.cat_dict, info.cat_dict);
+
+  // Extending an empty accumulator adopts the batch's dictionary.
+  MetaInfo accumulated;
+  accumulated.Extend(info, true, true);
+  ASSERT_EQ(accumulated.cat_dict, info.cat_dict);
+}
+}  // namespace xgboost::data
@@ -0,0 +1,96 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#include <gtest/gtest.h>
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <fstream>  // for ofstream
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "../../../src/data/csv_parser.h"
+#include "../filesystem.h"  // dmlc::TemporaryDirectory
+
+namespace xgboost::data {
+namespace {
+std::string WriteCSV(std::string const& dir, std::size_t n_rows) {
+  auto path = dir + "/data.csv";
+  std::ofstream fout{path};
+  for (std::size_t i = 0; i < n_rows; ++i) {
+    // label, 3 features, the second feature of every third row is missing
+    fout << i % 4 << "," << i << ",";
+    if (i % 3 != 0) {
+      fout << i * 2;
+    }
+    fout << "," << i * 0.5 << "\n";
+  }
+  return path;
+}
+}  // namespace
+
+TEST(CSVParser, Parse) {
+  dmlc::TemporaryDirectory tmpdir;
+  std::size_t constexpr kRows = 1024;
+  auto path = WriteCSV(tmpdir.path, kRows);
+
+  // Small chunks to exercise batching across line boundaries.
+  for (auto chunk_bytes : {std::size_t{64}, CSVParser::DefaultChunkBytes()}) {
+    CSVParser parser{path, /*label_column=*/0, 0, 1, chunk_bytes};
+    std::size_t row{0};
+    while (parser.Next()) {
+      auto const& block = parser.Value();
+      for (std::size_t i = 0; i < block.size; ++i, ++row) {
+        ASSERT_EQ(block.label[i], static_cast<float>(row % 4));
+        auto beg = block.offset[i];
+        auto end = block.offset[i + 1];
+        if (row % 3 != 0) {
+          ASSERT_EQ(end - beg, 3);
+          ASSERT_EQ(block.index[beg + 1], 1);
+          ASSERT_EQ(block.value[beg + 1], static_cast<float>(row * 2));
+        } else {
+          // The missing field is dropped from the row.
+          ASSERT_EQ(end - beg, 2);
+        }
+        ASSERT_EQ(block.index[beg], 0);
+        ASSERT_EQ(block.value[beg], static_cast<float>(row));
+        ASSERT_EQ(block.index[end - 1], 2);
+        ASSERT_EQ(block.value[end - 1], static_cast<float>(row) * 0.5f);
+      }
+    }
+    ASSERT_EQ(row, kRows);
+
+    parser.BeforeFirst();
+    std::size_t n_again{0};
+    while (parser.Next()) {
+      n_again += parser.Value().size;
+    }
+    ASSERT_EQ(n_again, kRows);
+  }
+}
+
+TEST(CSVParser, Partition) {
+  dmlc::TemporaryDirectory tmpdir;
+  std::size_t constexpr kRows = 1000;
+  auto path = WriteCSV(tmpdir.path, kRows);
+
+  std::uint32_t constexpr kParts = 3;
+  std::size_t n_total{0};
+  std::vector<bool> seen(kRows, false);
+  for (std::uint32_t part = 0; part < kParts; ++part) {
+    CSVParser parser{path, /*label_column=*/0, part, kParts};
+    while (parser.Next()) {
+      auto const& block = parser.Value();
+      for (std::size_t i = 0; i < block.size; ++i) {
+        // The first feature encodes the row index.
+        auto row = static_cast<std::size_t>(block.value[block.offset[i]]);
+        ASSERT_FALSE(seen[row]);
+        seen[row] = true;
+      }
+      n_total += block.size;
+    }
+  }
+  // Each line belongs to exactly one partition.
+  ASSERT_EQ(n_total, kRows);
+}
+}  // namespace xgboost::data
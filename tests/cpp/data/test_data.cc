@@ -88,6 +88,35 @@ TEST(SparsePage, PushCSCAfterTranspose) {
   }
 }
 
+TEST(SparsePage, GetTranspose) {
+  bst_idx_t constexpr kRows = 256, kCols = 31;
+  auto p_fmat = RandomDataGenerator{kRows, kCols, 0.6}.GenerateDMatrix();
+  for (auto const& page : p_fmat->GetBatches<SparsePage>()) {
+    auto transpose = page.GetTranspose(kCols, AllThreadsForTest());
+    ASSERT_EQ(transpose.data.Size(), page.data.Size());
+
+    // Gather the entries of each column from the row-major view.
+    std::vector<std::vector<Entry>> columns(kCols);
+    auto view = page.GetView();
+    for (size_t ridx = 0; ridx < view.Size(); ++ridx) {
+      for (auto const& entry : view[ridx]) {
+        columns[entry.index].emplace_back(static_cast<bst_uint>(ridx), entry.fvalue);
+      }
+    }
+
+    // The counting sort must keep the rows of each column in ascending order.
+    auto t_view = transpose.GetView();
+    for (bst_idx_t cidx = 0; cidx < kCols; ++cidx) {
+      auto column = t_view[cidx];
+      ASSERT_EQ(column.size(), columns[cidx].size());
+      for (size_t j = 0; j < column.size(); ++j) {
+        ASSERT_EQ(column[j].index, columns[cidx][j].index);
+        ASSERT_EQ(column[j].fvalue, columns[cidx][j].fvalue);
+      }
+    }
+  }
+}
+
 TEST(SparsePage, SortIndices) {
   auto p_fmat = RandomDataGenerator{100, 10, 0.6}.GenerateDMatrix();
   auto n_threads = AllThreadsForTest();
@@ -112,6 +141,55 @@ TEST(SparsePage, SortIndices) {
   ASSERT_TRUE(copy.IsIndicesSorted(n_threads));
 }
 
+TEST(SparsePage, ShuffleRows) {
+  auto p_fmat = RandomDataGenerator{100, 10, 0.6}.GenerateDMatrix();
+  auto n_threads = AllThreadsForTest();
+  SparsePage page;
+  for (auto const& batch : p_fmat->GetBatches<SparsePage>()) {
+    page.Push(batch);
+  }
+  auto row = [](SparsePage const& p, std::size_t ridx) {
+    auto const& h_offset = p.offset.HostVector();
+    auto const& h_data = p.data.HostVector();
+    return std::vector<Entry>(h_data.cbegin() + h_offset[ridx],
+                              h_data.cbegin() + h_offset[ridx + 1]);
+  };
+
+  SparsePage shuffled;
+  shuffled.Push(page);
+  shuffled.ShuffleRows(/*seed=*/3, n_threads);
+  ASSERT_EQ(shuffled.Size(), page.Size());
+  ASSERT_EQ(shuffled.data.Size(), page.data.Size());
+
+  // Every original row must appear exactly once, intact.
+  std::vector<bool> found(page.Size(), false);
+  std::size_t n_moved{0};
+  for (std::size_t i = 0; i < shuffled.Size(); ++i) {
+    auto r = row(shuffled, i);
+    bool matched{false};
+    for (std::size_t j = 0; j < page.Size(); ++j) {
+      if (!found[j] && r == row(page, j)) {
+        found[j] = true;
+        matched = true;
+        n_moved += i != j;
+        break;
+      }
+    }
+    ASSERT_TRUE(matched);
+  }
+  ASSERT_GT(n_moved, 0);
+
+  // The permutation is determined by the seed.
+  SparsePage replay;
+  replay.Push(page);
+  replay.ShuffleRows(/*seed=*/3, n_threads);
+  ASSERT_EQ(replay.offset.HostVector(), shuffled.offset.HostVector());
+  for (std::size_t i = 0; i < replay.data.Size(); ++i) {
+    ASSERT_EQ(replay.data.HostVector()[i].index, shuffled.data.HostVector()[i].index);
+    ASSERT_EQ(replay.data.HostVector()[i].fvalue, shuffled.data.HostVector()[i].fvalue);
+  }
+}
+
 TEST(DMatrix, Uri) {
   auto constexpr kRows {16};
   auto constexpr kCols {8};
@@ -2,6 +2,7 @@
  * Copyright 2019-2024, XGBoost contributors
  */
 #include <xgboost/base.h>
+#include <xgboost/global_config.h>  // for GlobalConfigThreadLocalStore
 
 #include <utility>
 
@@ -89,6 +90,40 @@ TEST(EllpackPage, BuildGidxSparse) {
   }
 }
 
+TEST(EllpackPage, TiledLayout) {
+  bst_idx_t constexpr kRows = 1000, kCols = 8;
+  bst_bin_t constexpr kMaxBin = 64;
+  auto ctx = MakeCUDACtx(0);
+  auto batch = BatchParam{kMaxBin, tree::TrainParam::DftSparseThreshold()};
+
+  auto p_ref = RandomDataGenerator{kRows, kCols, 0.0}.Seed(3).GenerateDMatrix();
+  auto& ref_page = *p_ref->GetBatches<EllpackPage>(&ctx, batch).begin();
+  ASSERT_EQ(ref_page.Impl()->info.tile_rows, 0);
+
+  auto* config = GlobalConfigThreadLocalStore::Get();
+  config->use_ellpack_tiles = true;
+  auto p_tiled = RandomDataGenerator{kRows, kCols, 0.0}.Seed(3).GenerateDMatrix();
+  auto& tiled_page = *p_tiled->GetBatches<EllpackPage>(&ctx, batch).begin();
+  config->use_ellpack_tiles = false;
+
+  auto* tiled = tiled_page.Impl();
+  ASSERT_EQ(tiled->info.tile_rows, EllpackDeviceAccessor::kTileRows);
+  // The trailing tile is padded.
+  ASSERT_EQ(tiled->info.PaddedElems(kRows),
+            common::DivRoundUp(kRows, EllpackDeviceAccessor::kTileRows) *
+                EllpackDeviceAccessor::kTileRows * kCols);
+
+  std::vector<common::CompressedByteT> h_ref_buf, h_tiled_buf;
+  auto ref_acc = ref_page.Impl()->GetHostAccessor(&ctx, &h_ref_buf);
+  auto tiled_acc = tiled->GetHostAccessor(&ctx, &h_tiled_buf);
+  ASSERT_EQ(tiled_acc.tile_rows, EllpackDeviceAccessor::kTileRows);
+  for (bst_idx_t r = 0; r < kRows; ++r) {
+    for (bst_idx_t f = 0; f < kCols; ++f) {
+      ASSERT_EQ(ref_acc.gidx_iter[r * kCols + f], tiled_acc.gidx_iter[tiled_acc.EntryIdx(r, f)]);
+    }
+  }
+}
+
 TEST(EllpackPage, FromCategoricalBasic) {
   using common::AsCat;
   size_t constexpr kRows = 1000, kCats = 13, kCols = 1;
@@ -220,6 +255,55 @@ TEST(EllpackPage, Copy) {
   }
 }
 
+TEST(EllpackPage, PushAdapterBatch) {
+  auto ctx = MakeCUDACtx(0);
+  bst_idx_t n_samples = 64, n_features = 4;
+
+  HostDeviceVector<float> data(n_samples * n_features, 0.0f, ctx.Device());
+  auto& h_data = data.HostVector();
+  std::iota(h_data.begin(), h_data.end(), 0.0f);
+  data.ConstDeviceSpan();  // Pull to device
+  auto arri = GetArrayInterface(&data, n_samples, n_features);
+  auto sarri = Json::Dump(arri);
+  data::CupyAdapter adapter{StringView{sarri}};
+
+  auto p_fmat = GetDMatrixFromData(h_data, n_samples, n_features);
+  Context cpu_ctx;
+  auto batch = BatchParam{17, 0.8};
+  std::shared_ptr<common::HistogramCuts> cuts;
+  for (auto const& page : p_fmat->GetBatches<GHistIndexMatrix>(&cpu_ctx, batch)) {
+    cuts = std::make_shared<common::HistogramCuts>(page.Cuts());
+  }
+
+  dh::device_vector<bst_idx_t> row_counts(n_samples, n_features);
+  auto d_row_counts = dh::ToSpan(row_counts);
+  auto missing = std::numeric_limits<float>::quiet_NaN();
+  auto ref = EllpackPageImpl{&ctx,       adapter.Value(), missing,   true, d_row_counts, {},
+                             n_features, n_samples,       cuts};
+
+  // Writing the batch in two halves at their final offsets must produce the same page as
+  // the whole-batch constructor.
+  EllpackPageImpl result{&ctx, cuts, true, n_features, n_samples};
+  auto push_part = [&](bst_idx_t begin, bst_idx_t n) {
+    HostDeviceVector<float> part(n * n_features, 0.0f, ctx.Device());
+    auto& h_part = part.HostVector();
+    std::copy_n(h_data.begin() + begin * n_features, n * n_features, h_part.begin());
+    part.ConstDeviceSpan();
+    auto part_arri = GetArrayInterface(&part, n, n_features);
+    auto s_part = Json::Dump(part_arri);
+    data::CupyAdapter part_adapter{StringView{s_part}};
+    result.PushAdapterBatch(&ctx, part_adapter.Value(), missing, d_row_counts.subspan(0, n), {},
+                            begin);
+  };
+  push_part(0, n_samples / 2);
+  push_part(n_samples / 2, n_samples / 2);
+
+  std::vector<common::CompressedByteT> h_ref, h_res;
+  ref.GetHostAccessor(&ctx, &h_ref);
+  result.GetHostAccessor(&ctx, &h_res);
+  ASSERT_EQ(h_ref, h_res);
+}
+
 TEST(EllpackPage, Compact) {
   constexpr size_t kRows = 16;
   constexpr size_t kCols = 2;
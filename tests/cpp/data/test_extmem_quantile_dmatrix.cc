@@ -7,10 +7,15 @@
 #include <xgboost/data.h>  // for BatchParam
 
 #include <algorithm>  // for equal
+#include <limits>     // for numeric_limits
 
-#include "../../../src/common/column_matrix.h"  // for ColumnMatrix
-#include "../../../src/data/gradient_index.h"   // for GHistIndexMatrix
-#include "../../../src/tree/param.h"            // for TrainParam
+#include "../../../src/common/column_matrix.h"           // for ColumnMatrix
+#include "../../../src/data/batch_utils.h"               // for MatchingPageBytes
+#include "../../../src/data/cache_manifest.h"            // for ManifestPath
+#include "../../../src/data/extmem_quantile_dmatrix.h"   // for ExtMemQuantileDMatrix
+#include "../../../src/data/gradient_index.h"            // for GHistIndexMatrix
+#include "../../../src/tree/param.h"                     // for TrainParam
+#include "../filesystem.h"                               // for TemporaryDirectory
 
 namespace xgboost::data {
 namespace {
@@ -58,4 +63,98 @@ INSTANTIATE_TEST_SUITE_P(ExtMemQuantileDMatrix, ExtMemQuantileDMatrixCpu, ::test
                                0.0f, tree::TrainParam::DftSparseThreshold(), 0.4f, 0.8f};
                            return sparsities;
                          }()));
+
+TEST(ExtMemQuantileDMatrix, WarmRestart) {
+  bst_idx_t n_samples = 256, n_features = 16, n_batches = 4;
+  bst_bin_t max_bin = 64;
+  Context ctx;
+  BatchParam p{max_bin, tree::TrainParam::DftSparseThreshold()};
+
+  dmlc::TemporaryDirectory tmpdir;
+  auto config = ExtMemConfig{tmpdir.path + "/cache",
+                             false,
+                             cuda_impl::MatchingPageBytes(),
+                             std::numeric_limits<float>::quiet_NaN(),
+                             cuda_impl::MaxNumDevicePages(),
+                             ctx.Threads(),
+                             /*n_prefetch_batches=*/0,
+                             /*persist_cache=*/true};
+
+  std::vector<std::vector<std::uint8_t>> pages;
+  std::vector<bst_idx_t> base_rowids;
+  std::vector<float> cut_values;
+  {
+    NumpyArrayIterForTest iter{0.0f, n_samples, n_features, n_batches};
+    ExtMemQuantileDMatrix m{&iter,   iter.Proxy(), nullptr, Reset, Next,
+                            max_bin, std::numeric_limits<std::int64_t>::max(), config};
+    for (auto const& page : m.GetBatches<GHistIndexMatrix>(&ctx, p)) {
+      pages.emplace_back(page.data.cbegin(), page.data.cend());
+      base_rowids.push_back(page.base_rowid);
+      cut_values = page.Cuts().Values();
+    }
+  }
+  // The manifest and the shard must survive the destructor.
+  ASSERT_TRUE(FileExists(ManifestPath(config.cache)));
+
+  {
+    NumpyArrayIterForTest iter{0.0f, n_samples, n_features, n_batches};
+    ExtMemQuantileDMatrix m{&iter,   iter.Proxy(), nullptr, Reset, Next,
+                            max_bin, std::numeric_limits<std::int64_t>::max(), config};
+    // Restored from the manifest, the iterator is never consumed.
+    ASSERT_EQ(iter.Iter(), 0);
+    ASSERT_EQ(m.Info().num_row_, n_samples);
+    ASSERT_EQ(m.Info().num_col_, n_features);
+
+    bst_idx_t k = 0;
+    for (auto const& page : m.GetBatches<GHistIndexMatrix>(&ctx, p)) {
+      ASSERT_EQ(page.base_rowid, base_rowids.at(k));
+      ASSERT_EQ(page.Cuts().Values(), cut_values);
+      auto const& orig = pages.at(k);
+      ASSERT_TRUE(std::equal(page.data.cbegin(), page.data.cend(), orig.cbegin(), orig.cend()));
+      ++k;
+    }
+    ASSERT_EQ(k, n_batches);
+  }
+}
+
+TEST(ExtMemQuantileDMatrix, SharedCache) {
+  bst_idx_t n_samples = 256, n_features = 16, n_batches = 4;
+  bst_bin_t max_bin = 64;
+  Context ctx;
+  BatchParam p{max_bin, tree::TrainParam::DftSparseThreshold()};
+
+  dmlc::TemporaryDirectory tmpdir;
+  auto config = ExtMemConfig{tmpdir.path + "/cache",
+                             false,
+                             cuda_impl::MatchingPageBytes(),
+                             std::numeric_limits<float>::quiet_NaN(),
+                             cuda_impl::MaxNumDevicePages(),
+                             ctx.Threads(),
+                             /*n_prefetch_batches=*/0,
+                             /*persist_cache=*/true};
+
+  NumpyArrayIterForTest iter{0.0f, n_samples, n_features, n_batches};
+  ExtMemQuantileDMatrix builder{&iter,   iter.Proxy(), nullptr, Reset, Next,
+                                max_bin, std::numeric_limits<std::int64_t>::max(), config};
+  ASSERT_TRUE(FileExists(config.cache + ".lock"));
+
+  // A second trainer attaches to the committed cache while the first one is still
+  // running; both map the same shard read-only.
+  NumpyArrayIterForTest unused{0.0f, n_samples, n_features, n_batches};
+  ExtMemQuantileDMatrix reader{&unused, unused.Proxy(), nullptr, Reset, Next,
+                               max_bin, std::numeric_limits<std::int64_t>::max(), config};
+  ASSERT_EQ(unused.Iter(), 0);
+
+  auto it = reader.GetBatches<GHistIndexMatrix>(&ctx, p).begin();
+  for (auto const& page : builder.GetBatches<GHistIndexMatrix>(&ctx, p)) {
+    auto const& restored = *it;
+    ASSERT_EQ(restored.base_rowid, page.base_rowid);
+    ASSERT_TRUE(std::equal(restored.data.cbegin(), restored.data.cend(), page.data.cbegin(),
+                           page.data.cend()));
+    ++it;
+  }
+
+  // The lock is free once construction finishes; it can be re-acquired immediately.
+  CacheLockGuard lock{config.cache};
+}
 }  // namespace xgboost::data
@@ -177,4 +177,36 @@ TEST_P(EllpackDeviceCacheTest, Basic) { this->Run(); }
 
 INSTANTIATE_TEST_SUITE_P(ExtMemQuantileDMatrix, EllpackDeviceCacheTest,
                          ::testing::Values(0.0f, 0.8f));
+
+// Pages start in pinned host memory without a reference DMatrix; repeated epochs promote
+// them into the device page budget.  The promoted pages must read back unchanged.
+TEST(ExtMemQuantileDMatrix, DevicePagePromotion) {
+  auto ctx = MakeCUDACtx(0);
+  bst_idx_t n_samples = 2048, n_features = 16;
+  bst_bin_t n_bins = 32;
+  auto p = BatchParam{n_bins, tree::TrainParam::DftSparseThreshold()};
+  auto p_fmat = RandomDataGenerator{n_samples, n_features, 0.0f}
+                    .Batches(4)
+                    .Device(ctx.Device())
+                    .Bins(p.max_bin)
+                    .OnHost(true)
+                    .MinPageCacheBytes(0)
+                    .MaxNumDevicePages(2)
+                    .GenerateExtMemQuantileDMatrix("temp", true);
+  auto p_fmat_h = RandomDataGenerator{n_samples, n_features, 0.0f}
+                      .Batches(4)
+                      .Device(ctx.Device())
+                      .Bins(p.max_bin)
+                      .OnHost(true)
+                      .MinPageCacheBytes(0)
+                      .MaxNumDevicePages(0)
+                      .GenerateExtMemQuantileDMatrix("temp", true);
+  for (std::int32_t epoch = 0; epoch < 3; ++epoch) {
+    auto it = p_fmat->GetBatches<EllpackPage>(&ctx, p).begin();
+    auto h_it = p_fmat_h->GetBatches<EllpackPage>(&ctx, p).begin();
+    for (; !it.AtEnd(); ++it, ++h_it) {
+      AssertEllpackEq(&ctx, it.Page()->Impl(), h_it.Page()->Impl());
+    }
+  }
+}
 }  // namespace xgboost::data
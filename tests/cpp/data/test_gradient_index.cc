@@ -57,6 +57,28 @@ TEST(GradientIndex, ExternalMemoryBaseRowID) {
   }
 }
 
+TEST(GradientIndex, SparseCompressedIndex) {
+  size_t constexpr kRows = 256, kCols = 16;
+  Context ctx;
+
+  // Sparse input, the global bin index fits into a byte when the total bin count is
+  // small.
+  auto p_fmat = RandomDataGenerator{kRows, kCols, 0.5}.GenerateDMatrix();
+  GHistIndexMatrix gidx{&ctx, p_fmat.get(), 8, 0.2, false};
+  ASSERT_FALSE(gidx.IsDense());
+  ASSERT_LE(gidx.cut.TotalBins(), 256);
+  ASSERT_EQ(gidx.index.GetBinTypeSize(), common::kUint8BinsTypeSize);
+
+  // The stored values are still the global bin indices.
+  for (size_t i = 0; i < gidx.index.Size(); ++i) {
+    ASSERT_LT(gidx.index[i], static_cast<size_t>(gidx.cut.TotalBins()));
+  }
+
+  GHistIndexMatrix gidx16{&ctx, p_fmat.get(), 64, 0.2, false};
+  ASSERT_GT(gidx16.cut.TotalBins(), 256);
+  ASSERT_EQ(gidx16.index.GetBinTypeSize(), common::kUint16BinsTypeSize);
+}
+
 TEST(GradientIndex, FromCategoricalBasic) {
   size_t constexpr kRows = 1000, kCats = 13, kCols = 1;
   size_t max_bins = 8;
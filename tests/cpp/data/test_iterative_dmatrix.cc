@@ -5,13 +5,19 @@
 
 #include <gtest/gtest.h>
 
-#include <limits>  // for numeric_limits
+#include <algorithm>  // for equal
+#include <cmath>      // for isnan
+#include <limits>     // for numeric_limits
 #include <memory>
 
+#include "../../../src/common/column_matrix.h"  // for ColumnMatrix
 #include "../../../src/data/gradient_index.h"
 #include "../../../src/data/iterative_dmatrix.h"
+#include "../../../src/data/simple_dmatrix.h"  // for SimpleDMatrix
+#include "../../../src/tree/param.h"  // for TrainParam
 #include "../helpers.h"
 #include "xgboost/data.h"  // DMatrix
+#include "xgboost/json.h"  // for Json
 
 namespace xgboost::data {
 TEST(IterativeDMatrix, Ref) {
@@ -20,6 +26,37 @@ TEST(IterativeDMatrix, Ref) {
       &ctx, [&](GHistIndexMatrix const& page) { return page.cut; });
 }
 
+TEST(IterativeDMatrix, CutsOnlyRef) {
+  Context ctx;
+  bst_bin_t n_bins = 256;
+  auto p = BatchParam{n_bins, tree::TrainParam::DftSparseThreshold()};
+  auto dm = RandomDataGenerator(2048, NumpyArrayIterForTest::Cols(), 0.5).GenerateDMatrix(true);
+
+  // Export the cuts through JSON, as the C API does.
+  std::string str;
+  for (auto const& page : dm->GetBatches<GHistIndexMatrix>(&ctx, p)) {
+    Json jcuts{Object{}};
+    page.cut.SaveJson(&jcuts);
+    Json::Dump(jcuts, &str);
+  }
+  common::HistogramCuts cuts;
+  cuts.LoadJson(Json::Load(StringView{str}));
+
+  // A cuts-only DMatrix must work as the reference, skipping the sketch.
+  std::shared_ptr<DMatrix> ref{SimpleDMatrix::FromQuantileCut(std::move(cuts), n_bins, {})};
+  NumpyArrayIterForTest iter(0.8, 32, NumpyArrayIterForTest::Cols(), 13);
+  auto dqm = std::make_shared<IterativeDMatrix>(&iter, iter.Proxy(), ref, Reset, Next,
+                                                std::numeric_limits<float>::quiet_NaN(), 0, n_bins,
+                                                std::numeric_limits<std::int64_t>::max());
+  for (auto const& page_0 : dm->GetBatches<GHistIndexMatrix>(&ctx, p)) {
+    for (auto const& page_1 : dqm->GetBatches<GHistIndexMatrix>(&ctx, {})) {
+      ASSERT_EQ(page_0.cut.Values(), page_1.cut.Values());
+      ASSERT_EQ(page_0.cut.Ptrs(), page_1.cut.Ptrs());
+      ASSERT_EQ(page_0.cut.MinValues(), page_1.cut.MinValues());
+    }
+  }
+}
+
 TEST(IterativeDMatrix, IsDense) {
   bst_bin_t n_bins = 16;
   auto test = [n_bins](float sparsity) {
@@ -39,4 +76,71 @@ TEST(IterativeDMatrix, IsDense) {
   test(0.1);
   test(1.0);
 }
+
+// The column matrix is filled from the gradient index instead of a second sweep over the
+// iterator; make sure the transposed values agree with the row-major index.
+TEST(IterativeDMatrix, ColumnMatrix) {
+  bst_bin_t n_bins = 16;
+  Context ctx;
+  auto test = [&](float sparsity) {
+    NumpyArrayIterForTest iter(sparsity);
+    IterativeDMatrix m(&iter, iter.Proxy(), nullptr, Reset, Next,
+                       std::numeric_limits<float>::quiet_NaN(), 0, n_bins,
+                       std::numeric_limits<std::int64_t>::max());
+    auto p = BatchParam{n_bins, tree::TrainParam::DftSparseThreshold()};
+    for (auto const& page : m.GetBatches<GHistIndexMatrix>(&ctx, p)) {
+      auto const& columns = page.Transpose();
+      ASSERT_TRUE(columns.IsInitialized());
+      ASSERT_EQ(columns.AnyMissing(), sparsity != 0.0f);
+      auto const& ptrs = page.cut.Ptrs();
+      auto const& vals = page.cut.Values();
+      auto const& mins = page.cut.MinValues();
+      for (bst_idx_t ridx = 0; ridx < page.Size(); ++ridx) {
+        for (bst_feature_t fidx = 0; fidx < page.Features(); ++fidx) {
+          auto gidx = page.GetGindex(ridx, fidx);
+          auto fvalue = page.GetFvalue(ridx, fidx, false);  // reads the column store
+          if (gidx == -1) {
+            ASSERT_TRUE(std::isnan(fvalue));
+          } else {
+            ASSERT_EQ(fvalue, common::HistogramCuts::NumericBinValue(ptrs, vals, mins, fidx, gidx));
+          }
+        }
+      }
+    }
+  };
+  test(0.0);
+  test(0.5);
+}
+
+// The gradient index is built on a background worker overlapping the iterator; the
+// result must not depend on how the input is batched.
+TEST(IterativeDMatrix, PipelinedPush) {
+  bst_bin_t n_bins = 16;
+  Context ctx;
+  auto p = BatchParam{n_bins, tree::TrainParam::DftSparseThreshold()};
+  // Few enough rows that the sketch is exact and the cuts are batch-independent.
+  auto build = [&](std::size_t n_batches) {
+    NumpyArrayIterForTest iter{0.5f, 256, 8, n_batches};
+    return std::make_shared<IterativeDMatrix>(&iter, iter.Proxy(), nullptr, Reset, Next,
+                                              std::numeric_limits<float>::quiet_NaN(), 0, n_bins,
+                                              std::numeric_limits<std::int64_t>::max());
+  };
+  auto m_single = build(1);
+  auto m_multi = build(4);
+  for (auto const& single : m_single->GetBatches<GHistIndexMatrix>(&ctx, p)) {
+    for (auto const& multi : m_multi->GetBatches<GHistIndexMatrix>(&ctx, p)) {
+      ASSERT_EQ(single.Size(), multi.Size());
+      ASSERT_EQ(single.cut.Values(), multi.cut.Values());
+      ASSERT_TRUE(std::equal(single.row_ptr.cbegin(), single.row_ptr.cend(),
+                             multi.row_ptr.cbegin()));
+      ASSERT_TRUE(std::equal(single.hit_count.cbegin(), single.hit_count.cend(),
+                             multi.hit_count.cbegin()));
+      for (bst_idx_t ridx = 0; ridx < single.Size(); ++ridx) {
+        for (bst_feature_t fidx = 0; fidx < single.Features(); ++fidx) {
+          ASSERT_EQ(single.GetGindex(ridx, fidx), multi.GetGindex(ridx, fidx));
+        }
+      }
+    }
+  }
+}
 }  // namespace xgboost::data
@@ -10,12 +10,38 @@
 #include <memory>
 #include <string>
 
-#include "../collective/test_worker.h"  // for TestDistributedGlobal
-#include "../filesystem.h"              // dmlc::TemporaryDirectory
-#include "../helpers.h"                 // for GMockTHrow
+#include "../../../src/common/optional_weight.h"  // for MakeOptionalWeights
+#include "../collective/test_worker.h"            // for TestDistributedGlobal
+#include "../filesystem.h"                        // dmlc::TemporaryDirectory
+#include "../helpers.h"                           // for GMockTHrow
 #include "xgboost/base.h"
 
 namespace xgboost {
+TEST(MetaInfo, UniformWeights) {
+  Context ctx;
+  MetaInfo info;
+  // Empty weights count as uniform.
+  ASSERT_TRUE(info.IsUniformWeights());
+
+  float uniform[4] = {0.5f, 0.5f, 0.5f, 0.5f};
+  info.SetInfo(ctx, "weight", Make1dInterfaceTest(uniform, 4));
+  ASSERT_TRUE(info.IsUniformWeights());
+
+  // The cache is dropped when the weights are replaced.
+  float varying[4] = {0.5f, 0.5f, 1.0f, 0.5f};
+  info.SetInfo(ctx, "weight", Make1dInterfaceTest(varying, 4));
+  ASSERT_FALSE(info.IsUniformWeights());
+
+  auto weight = common::MakeOptionalWeights(&ctx, info);
+  ASSERT_FALSE(weight.Empty());
+
+  info.SetInfo(ctx, "weight", Make1dInterfaceTest(uniform, 4));
+  weight = common::MakeOptionalWeights(&ctx, info);
+  // Collapsed to the scalar path, no per-element gather.
+  ASSERT_TRUE(weight.Empty());
+  ASSERT_EQ(weight[3], 0.5f);
+}
+
 TEST(MetaInfo, GetSet) {
   xgboost::Context ctx;
   xgboost::MetaInfo info;
@@ -321,6 +347,26 @@ TEST(MetaInfo, Validate) {
 #endif  // defined(XGBOOST_USE_CUDA)
 }
 
+TEST(MetaInfo, LabelValidationCache) {
+  xgboost::Context ctx;
+  xgboost::MetaInfo info;
+
+  float labels[4] = {0.0f, 1.0f, 0.0f, 1.0f};
+  info.SetInfo(ctx, "label", Make1dInterfaceTest(labels, 4));
+  ASSERT_FALSE(info.LabelsValidatedBy("binary:logistic"));
+  info.SetLabelsValidatedBy("binary:logistic");
+  ASSERT_TRUE(info.LabelsValidatedBy("binary:logistic"));
+  ASSERT_FALSE(info.LabelsValidatedBy("reg:gamma"));
+
+  // Overwriting the labels drops the flags.
+  info.SetInfo(ctx, "label", Make1dInterfaceTest(labels, 4));
+  ASSERT_FALSE(info.LabelsValidatedBy("binary:logistic"));
+
+  info.SetLabelsValidatedBy("binary:logistic");
+  info.Clear();
+  ASSERT_FALSE(info.LabelsValidatedBy("binary:logistic"));
+}
+
 TEST(MetaInfo, HostExtend) {
   xgboost::MetaInfo lhs, rhs;
   xgboost::Context ctx;
@@ -9,6 +9,7 @@
 
 #include "../../../src/data/adapter.h"         // ArrayAdapter
 #include "../../../src/data/simple_dmatrix.h"  // SimpleDMatrix
+#include "../../../src/tree/param.h"           // TrainParam
 #include "../collective/test_worker.h"         // for TestDistributedGlobal
 #include "../filesystem.h"                     // dmlc::TemporaryDirectory
 #include "../helpers.h"                        // RandomDataGenerator,CreateSimpleTestData
@@ -81,6 +82,35 @@ TEST(SimpleDMatrix, ColAccessWithoutBatches) {
   delete dmat;
 }
 
+TEST(SimpleDMatrix, ColAccessSubset) {
+  Context ctx;
+  auto dmat = RandomDataGenerator{8, 4, 0.2}.GenerateDMatrix();
+
+  std::vector<bst_feature_t> selected{1, 3};
+  for (auto const& batch : dmat->GetBatches<SortedCSCPage>(&ctx, selected)) {
+    auto page = batch.GetView();
+    ASSERT_EQ(batch.Size(), dmat->Info().num_col_) << "Subset pages span all columns.";
+    // unselected columns are empty, selected ones match the full transpose.
+    ASSERT_EQ(page[0].size(), 0);
+    ASSERT_EQ(page[2].size(), 0);
+    for (auto const& full : dmat->GetBatches<SortedCSCPage>(&ctx)) {
+      auto full_page = full.GetView();
+      for (auto fidx : selected) {
+        ASSERT_EQ(page[fidx].size(), full_page[fidx].size());
+        for (std::size_t i = 0; i < page[fidx].size(); ++i) {
+          ASSERT_EQ(page[fidx][i].index, full_page[fidx][i].index);
+          ASSERT_EQ(page[fidx][i].fvalue, full_page[fidx][i].fvalue);
+        }
+      }
+    }
+  }
+  // once the full transpose exists it serves subset requests as well.
+  for (auto const& batch : dmat->GetBatches<SortedCSCPage>(&ctx, selected)) {
+    auto page = batch.GetView();
+    ASSERT_GT(page[0].size(), 0);
+  }
+}
+
 TEST(SimpleDMatrix, Empty) {
   std::vector<float> data{};
   std::vector<unsigned> feature_idx = {};
@@ -177,6 +207,64 @@ TEST(SimpleDMatrix, FromDense) {
   }
 }
 
+TEST(SimpleDMatrix, FromCSR) {
+  std::vector<std::size_t> indptr{0, 2, 2, 5};
+  std::vector<bst_feature_t> indices{0, 3, 1, 2, 4};
+  std::vector<float> values{1, 2, 3, -1, 5};
+  auto indptr_arr = linalg::ArrayInterfaceStr(linalg::MakeVec(indptr.data(), indptr.size()));
+  auto indices_arr = linalg::ArrayInterfaceStr(linalg::MakeVec(indices.data(), indices.size()));
+  auto values_arr = linalg::ArrayInterfaceStr(linalg::MakeVec(values.data(), values.size()));
+  data::CSRArrayAdapter adapter{StringView{indptr_arr}, StringView{indices_arr},
+                                StringView{values_arr}, 5};
+  // -1 is treated as missing and the second row is empty.
+  data::SimpleDMatrix dmat{&adapter, /*missing=*/-1.0f, 1};
+  EXPECT_EQ(dmat.Info().num_col_, 5);
+  EXPECT_EQ(dmat.Info().num_row_, 3);
+  EXPECT_EQ(dmat.Info().num_nonzero_, 4);
+
+  for (auto& batch : dmat.GetBatches<SparsePage>()) {
+    auto page = batch.GetView();
+    ASSERT_EQ(page[0].size(), 2);
+    EXPECT_EQ(page[0][0].index, 0);
+    EXPECT_EQ(page[0][0].fvalue, 1);
+    EXPECT_EQ(page[0][1].index, 3);
+    EXPECT_EQ(page[0][1].fvalue, 2);
+    ASSERT_EQ(page[1].size(), 0);
+    ASSERT_EQ(page[2].size(), 2);
+    EXPECT_EQ(page[2][0].index, 1);
+    EXPECT_EQ(page[2][0].fvalue, 3);
+    EXPECT_EQ(page[2][1].index, 4);
+    EXPECT_EQ(page[2][1].fvalue, 5);
+  }
+}
+
+TEST(SimpleDMatrix, FromDenseArray) {
+  // double input exercises the typed conversion in SparsePage::Push.
+  std::vector<double> values{1, -1, 2, -1, -1, -1, 3, 4, 5};
+  auto arr_str = linalg::ArrayInterfaceStr(linalg::TensorView<double const, 2>{
+      common::Span<double const>{values.data(), values.size()}, {3, 3}, DeviceOrd::CPU()});
+  data::ArrayAdapter adapter{StringView{arr_str}};
+  // -1 is treated as missing and the second row is empty.
+  data::SimpleDMatrix dmat{&adapter, /*missing=*/-1.0f, 1};
+  EXPECT_EQ(dmat.Info().num_col_, 3);
+  EXPECT_EQ(dmat.Info().num_row_, 3);
+  EXPECT_EQ(dmat.Info().num_nonzero_, 5);
+
+  for (auto& batch : dmat.GetBatches<SparsePage>()) {
+    auto page = batch.GetView();
+    ASSERT_EQ(page[0].size(), 2);
+    EXPECT_EQ(page[0][0].index, 0);
+    EXPECT_EQ(page[0][0].fvalue, 1);
+    EXPECT_EQ(page[0][1].index, 2);
+    EXPECT_EQ(page[0][1].fvalue, 2);
+    ASSERT_EQ(page[1].size(), 0);
+    ASSERT_EQ(page[2].size(), 3);
+    EXPECT_EQ(page[2][0].fvalue, 3);
+    EXPECT_EQ(page[2][1].fvalue, 4);
+    EXPECT_EQ(page[2][2].fvalue, 5);
+  }
+}
+
 TEST(SimpleDMatrix, FromCSC) {
   std::vector<float> data = {1, 3, 2, 4, 5};
   std::vector<unsigned> row_idx = {0, 1, 0, 1, 2};
@@ -430,6 +518,108 @@ TEST(SimpleDMatrix, Threads) {
   ASSERT_EQ(p_fmat->Ctx()->Threads(), AllThreadsForTest());
 }
 
+TEST(SimpleDMatrix, Extend) {
+  std::size_t constexpr kRows = 64, kAppend = 16, kCols = 8;
+  bst_bin_t constexpr kBins = 16;
+  Context ctx;
+  auto param = BatchParam{kBins, tree::TrainParam::DftSparseThreshold()};
+
+  HostDeviceVector<float> data;
+  auto arr_str = RandomDataGenerator{kRows, kCols, 0.0}.GenerateArrayInterface(&data);
+  auto adapter = data::ArrayAdapter{StringView{arr_str}};
+  data::SimpleDMatrix dmat{&adapter, std::numeric_limits<float>::quiet_NaN(), 0};
+
+  // Materialize the gradient index before appending.
+  for ([[maybe_unused]] auto const& page : dmat.GetBatches<GHistIndexMatrix>(&ctx, param)) {
+  }
+
+  HostDeviceVector<float> delta;
+  auto delta_str = RandomDataGenerator{kAppend, kCols, 0.0}.Seed(7).GenerateArrayInterface(&delta);
+  auto delta_adapter = data::ArrayAdapter{StringView{delta_str}};
+  dmat.Extend(&delta_adapter, std::numeric_limits<float>::quiet_NaN(), 0);
+
+  ASSERT_EQ(dmat.Info().num_row_, kRows + kAppend);
+  ASSERT_EQ(dmat.Info().num_col_, kCols);
+  ASSERT_EQ(dmat.Info().num_nonzero_, (kRows + kAppend) * kCols);
+
+  // The appended rows are readable through the row batches.
+  auto const& h_delta = delta.ConstHostVector();
+  for (auto const& batch : dmat.GetBatches<SparsePage>()) {
+    auto page = batch.GetView();
+    ASSERT_EQ(page.Size(), kRows + kAppend);
+    for (std::size_t i = 0; i < kAppend; ++i) {
+      auto inst = page[kRows + i];
+      ASSERT_EQ(inst.size(), kCols);
+      for (std::size_t j = 0; j < kCols; ++j) {
+        ASSERT_EQ(inst[j].fvalue, h_delta[i * kCols + j]);
+      }
+    }
+  }
+
+  // The gradient index was grown in place with the original cuts, no new sketch.
+  for (auto const& page : dmat.GetBatches<GHistIndexMatrix>(&ctx, param)) {
+    ASSERT_EQ(page.Size(), kRows + kAppend);
+    for (std::size_t i = 0; i < kAppend; ++i) {
+      for (bst_feature_t f = 0; f < kCols; ++f) {
+        auto expected = page.cut.SearchBin(h_delta[i * kCols + f], f);
+        ASSERT_EQ(page.GetGindex(kRows + i, f), expected);
+      }
+    }
+  }
+
+  // Appending sparse rows under a dense gradient index falls back to a lazy rebuild.
+  HostDeviceVector<float> sparse_storage;
+  auto sparse_str =
+      RandomDataGenerator{kAppend, kCols, 0.5}.Seed(13).GenerateArrayInterface(&sparse_storage);
+  auto sparse_adapter = data::ArrayAdapter{StringView{sparse_str}};
+  dmat.Extend(&sparse_adapter, std::numeric_limits<float>::quiet_NaN(), 0);
+  ASSERT_EQ(dmat.Info().num_row_, kRows + 2 * kAppend);
+  for (auto const& page : dmat.GetBatches<GHistIndexMatrix>(&ctx, param)) {
+    ASSERT_EQ(page.Size(), kRows + 2 * kAppend);
+  }
+}
+
+TEST(SimpleDMatrix, ReuseQuantileCuts) {
+  std::size_t constexpr kRows = 64, kCols = 8;
+  bst_bin_t constexpr kBins = 16;
+  Context ctx;
+  auto param = BatchParam{kBins, tree::TrainParam::DftSparseThreshold()};
+
+  HostDeviceVector<float> data;
+  auto arr_str = RandomDataGenerator{kRows, kCols, 0.0}.GenerateArrayInterface(&data);
+  auto adapter = data::ArrayAdapter{StringView{arr_str}};
+  data::SimpleDMatrix prev{&adapter, std::numeric_limits<float>::quiet_NaN(), 0};
+
+  common::HistogramCuts cuts;
+  for (auto const& page : prev.GetBatches<GHistIndexMatrix>(&ctx, param)) {
+    cuts = page.Cuts();
+  }
+
+  HostDeviceVector<float> next_data;
+  auto next_str = RandomDataGenerator{kRows, kCols, 0.0}.Seed(7).GenerateArrayInterface(&next_data);
+  auto next_adapter = data::ArrayAdapter{StringView{next_str}};
+  data::SimpleDMatrix next{&next_adapter, std::numeric_limits<float>::quiet_NaN(), 0};
+
+  // The next stage is quantized with the cuts of the previous one, no new sketch.
+  next.ReuseQuantileCuts(cuts, kBins);
+  ASSERT_TRUE(next.PageExists<GHistIndexMatrix>());
+  auto const& h_next = next_data.ConstHostVector();
+  for (auto const& page : next.GetBatches<GHistIndexMatrix>(&ctx, param)) {
+    ASSERT_TRUE(page.Cuts() == cuts);
+    for (std::size_t i = 0; i < kRows; ++i) {
+      for (bst_feature_t f = 0; f < kCols; ++f) {
+        auto expected = cuts.SearchBin(h_next[i * kCols + f], f);
+        ASSERT_EQ(page.GetGindex(i, f), expected);
+      }
+    }
+  }
+
+  // Equal cuts leave the cached index untouched.
+  auto const* cached = &*next.GetBatches<GHistIndexMatrix>(&ctx, param).begin();
+  next.ReuseQuantileCuts(cuts, kBins);
+  ASSERT_EQ(&*next.GetBatches<GHistIndexMatrix>(&ctx, param).begin(), cached);
+}
+
 namespace {
 void VerifyColumnSplit() {
   size_t constexpr kRows {16};
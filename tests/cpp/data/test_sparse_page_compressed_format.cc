@@ -0,0 +1,83 @@
+/**
+ * Copyright 2026, XGBoost contributors
+ */
+#include <gtest/gtest.h>
+#include <xgboost/data.h>  // for CSCPage, SortedCSCPage, SparsePage
+
+#include <algorithm>  // for max, min
+#include <limits>     // for numeric_limits
+#include <memory>     // for unique_ptr
+#include <string>     // for string
+#include <utility>    // for move, pair
+
+#include "../../../src/common/io.h"  // for PrivateMmapConstStream, AlignedFileWriteStream
+#include "../../../src/data/sparse_page_writer.h"  // for CreatePageFormat
+#include "../helpers.h"                            // for RandomDataGenerator
+#include "dmlc/filesystem.h"                       // for TemporaryDirectory
+#include "xgboost/context.h"                       // for Context
+
+namespace xgboost::data {
+namespace {
+template <typename S>
+std::pair<S, S> RoundTrip(std::string const &name) {
+  std::unique_ptr<SparsePageFormat<S>> format{CreatePageFormat<S>(name)};
+  Context ctx;
+
+  auto m = RandomDataGenerator{100, 14, 0.5}.GenerateDMatrix();
+  dmlc::TemporaryDirectory tmpdir;
+  std::string path = tmpdir.path + "/sparse.page";
+  S orig;
+  std::size_t n_bytes{0};
+  {
+    // block code to flush the stream
+    auto fo = std::make_unique<common::AlignedFileWriteStream>(StringView{path}, "wb");
+    for (auto const &page : m->GetBatches<S>(&ctx)) {
+      orig.Push(page);
+      n_bytes = format->Write(page, fo.get());
+    }
+  }
+
+  S page;
+  std::unique_ptr<common::AlignedResourceReadStream> fi{
+      std::make_unique<common::PrivateMmapConstStream>(path.c_str(), 0, n_bytes)};
+  CHECK(format->Read(&page, fi.get()));
+  return std::pair{std::move(orig), std::move(page)};
+}
+
+template <typename S>
+void TestSparsePageCompressedFormat() {
+  auto [orig, page] = RoundTrip<S>("compressed");
+  ASSERT_EQ(page.base_rowid, orig.base_rowid);
+  ASSERT_EQ(page.offset.HostVector(), orig.offset.HostVector());
+  for (std::size_t i = 0; i < orig.data.Size(); ++i) {
+    ASSERT_EQ(page.data.HostVector()[i].fvalue, orig.data.HostVector()[i].fvalue);
+    ASSERT_EQ(page.data.HostVector()[i].index, orig.data.HostVector()[i].index);
+  }
+}
+}  // namespace
+
+TEST(SparsePageCompressedFormat, SparsePage) { TestSparsePageCompressedFormat<SparsePage>(); }
+
+TEST(SparsePageCompressedFormat, CSCPage) { TestSparsePageCompressedFormat<CSCPage>(); }
+
+TEST(SparsePageCompressedFormat, SortedCSCPage) {
+  TestSparsePageCompressedFormat<SortedCSCPage>();
+}
+
+TEST(SparsePageCompressedFormat, QuantizedValues) {
+  auto [orig, page] = RoundTrip<SparsePage>("compressed_q16");
+  ASSERT_EQ(page.base_rowid, orig.base_rowid);
+  ASSERT_EQ(page.offset.HostVector(), orig.offset.HostVector());
+  float lo{std::numeric_limits<float>::max()}, hi{std::numeric_limits<float>::lowest()};
+  for (auto const &e : orig.data.HostVector()) {
+    lo = std::min(lo, e.fvalue);
+    hi = std::max(hi, e.fvalue);
+  }
+  // The quantization error is bounded by half a step of the 16-bit grid.
+  auto eps = (hi - lo) / 65535.0f;
+  for (std::size_t i = 0; i < orig.data.Size(); ++i) {
+    ASSERT_EQ(page.data.HostVector()[i].index, orig.data.HostVector()[i].index);
+    ASSERT_NEAR(page.data.HostVector()[i].fvalue, orig.data.HostVector()[i].fvalue, eps);
+  }
+}
+}  // namespace xgboost::data
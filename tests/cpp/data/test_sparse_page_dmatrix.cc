@@ -4,8 +4,10 @@
 #include <gtest/gtest.h>
 #include <xgboost/data.h>
 
+#include <algorithm>  // for sort
 #include <future>
 #include <thread>
+#include <utility>  // for pair
 
 #include "../../../src/common/io.h"
 #include "../../../src/data/adapter.h"
@@ -35,7 +37,8 @@ void TestSparseDMatrixLoadFile(Context const* ctx) {
   auto config =
       ExtMemConfig{tmpdir.path + "cache",          false,
                    cuda_impl::MatchingPageBytes(), std::numeric_limits<float>::quiet_NaN(),
-                   cuda_impl::MaxNumDevicePages(), n_threads};
+                   cuda_impl::MaxNumDevicePages(), n_threads,
+                   /*n_prefetch_batches=*/0,          /*persist_cache=*/false};
   data::SparsePageDMatrix m{&iter, iter.Proxy(), data::fileiter::Reset, data::fileiter::Next,
                             config};
   ASSERT_EQ(AllThreadsForTest(), m.Ctx()->Threads());
@@ -74,6 +77,84 @@ TEST(SparsePageDMatrix, LoadFile) {
   TestSparseDMatrixLoadFile<SortedCSCPage>(&ctx);
 }
 
+TEST(SparsePageDMatrix, PrefetchDepth) {
+  dmlc::TemporaryDirectory tmpdir;
+  auto opath = tmpdir.path + "/depth.svm";
+  CreateBigTestData(opath, 3 * 64, false);
+  opath += "?format=libsvm";
+  data::FileIterator iter{opath, 0, 1};
+  auto config = ExtMemConfig{tmpdir.path + "cache",
+                             false,
+                             cuda_impl::MatchingPageBytes(),
+                             std::numeric_limits<float>::quiet_NaN(),
+                             cuda_impl::MaxNumDevicePages(),
+                             0,
+                             /*n_prefetch_batches=*/4,
+                             /*persist_cache=*/false};
+  data::SparsePageDMatrix m{&iter, iter.Proxy(), data::fileiter::Reset, data::fileiter::Next,
+                            config};
+  Context ctx;
+  // The deeper look-ahead must not change what the iterator yields.
+  for (std::int32_t i = 0; i < 2; ++i) {
+    bst_idx_t n_rows{0};
+    for (auto const& page : m.GetBatches<SparsePage>(&ctx)) {
+      n_rows += page.Size();
+    }
+    ASSERT_EQ(n_rows, m.Info().num_row_);
+  }
+}
+
+TEST(SparsePageDMatrix, ShuffledRowAccess) {
+  bst_idx_t constexpr kRows = 256;
+  bst_feature_t constexpr kCols = 16;
+  std::size_t constexpr kBatches = 4;
+  auto p_plain =
+      RandomDataGenerator{kRows, kCols, 0.4f}.Batches(kBatches).GenerateSparsePageDMatrix(
+          "temp", false);
+  auto p_shuffled = RandomDataGenerator{kRows, kCols, 0.4f}
+                        .Batches(kBatches)
+                        .ShuffleSeed(7)
+                        .GenerateSparsePageDMatrix("temp-shuffle", false);
+
+  using Row = std::vector<std::pair<bst_feature_t, float>>;
+  auto collect = [](DMatrix* p_fmat) {
+    std::vector<Row> rows;
+    for (auto const& page : p_fmat->GetBatches<SparsePage>()) {
+      auto const& h_offset = page.offset.HostVector();
+      auto const& h_data = page.data.HostVector();
+      for (std::size_t i = 0; i < page.Size(); ++i) {
+        Row r;
+        for (auto j = h_offset[i]; j < h_offset[i + 1]; ++j) {
+          r.emplace_back(h_data[j].index, h_data[j].fvalue);
+        }
+        rows.emplace_back(std::move(r));
+      }
+    }
+    return rows;
+  };
+  auto sorted = [](std::vector<Row> rows) {
+    std::sort(rows.begin(), rows.end());
+    return rows;
+  };
+
+  auto ref = collect(p_plain.get());
+  ASSERT_EQ(ref.size(), kRows);
+
+  // Each epoch yields exactly the original rows, in a different order.
+  auto first = collect(p_shuffled.get());
+  ASSERT_EQ(sorted(first), sorted(ref));
+  ASSERT_NE(first, ref);
+
+  // A new permutation is drawn for every epoch.
+  auto second = collect(p_shuffled.get());
+  ASSERT_EQ(sorted(second), sorted(ref));
+  ASSERT_NE(second, first);
+
+  // Derived page types cannot be combined with the shuffle.
+  Context ctx;
+  ASSERT_THROW(p_shuffled->GetBatches<CSCPage>(&ctx), dmlc::Error);
+}
+
 // allow caller to retain pages so they can process multiple pages at the same time.
 template <typename Page>
 void TestRetainPage() {
@@ -369,7 +450,8 @@ auto TestSparsePageDMatrixDeterminism(int32_t threads) {
                              cuda_impl::MatchingPageBytes(),
                              std::numeric_limits<float>::quiet_NaN(),
                              cuda_impl::MaxNumDevicePages(),
-                             threads};
+                             threads,
+                             /*n_prefetch_batches=*/0,          /*persist_cache=*/false};
   std::unique_ptr<DMatrix> sparse{new data::SparsePageDMatrix{
       &iter, iter.Proxy(), data::fileiter::Reset, data::fileiter::Next, config}};
   CHECK(sparse->Ctx()->Threads() == threads || sparse->Ctx()->Threads() == AllThreadsForTest());
@@ -3,16 +3,20 @@
  */
 #include <gtest/gtest.h>
 #include <xgboost/context.h>
+#include <xgboost/global_config.h>       // for GlobalConfigThreadLocalStore
 #include <xgboost/host_device_vector.h>  // for HostDeviceVector
 #include <xgboost/json.h>                // for Json, Object
 #include <xgboost/learner.h>             // for Learner
 
+#include <cmath>     // for abs
 #include <limits>    // for numeric_limits
 #include <memory>    // for shared_ptr
+#include <numeric>   // for iota
 #include <optional>  // for optional
 #include <string>    // for string
 
-#include "../../../src/data/proxy_dmatrix.h"  // for DMatrixProxy
+#include "../../../src/common/cancellation.h"  // for TrainingCancellation
+#include "../../../src/data/proxy_dmatrix.h"   // for DMatrixProxy
 #include "../../../src/gbm/gbtree.h"
 #include "../filesystem.h"  // dmlc::TemporaryDirectory
 #include "../helpers.h"
@@ -54,6 +58,26 @@ TEST(GBTree, SelectTreeMethod) {
 #endif  // XGBOOST_USE_CUDA
 }
 
+TEST(GBTreeModel, Version) {
+  Context ctx;
+  LearnerModelParam mparam{MakeMP(2, .5, 1)};
+  gbm::GBTreeModel model{&mparam, &ctx};
+
+  auto v0 = model.Version();
+  gbm::TreesOneGroup trees;
+  trees.push_back(std::make_unique<RegTree>());
+  model.CommitModelGroup(std::move(trees), 0);
+  // Committing trees invalidates derived representations of the model.
+  ASSERT_NE(model.Version(), v0);
+
+  auto v1 = model.Version();
+  Json j_model{Object{}};
+  model.SaveModel(&j_model);
+  ASSERT_EQ(model.Version(), v1);
+  model.LoadModel(j_model);
+  ASSERT_NE(model.Version(), v1);
+}
+
 TEST(GBTree, PredictionCache) {
   size_t constexpr kRows = 100, kCols = 10;
   Context ctx;
@@ -117,6 +141,27 @@ TEST(GBTree, WrongUpdater) {
   ASSERT_THROW(learner->UpdateOneIter(0, p_dmat), dmlc::Error);
 }
 
+TEST(GBTree, TrainingCancel) {
+  std::size_t constexpr kRows = 64, kCols = 8;
+  auto p_dmat = RandomDataGenerator{kRows, kCols, 0}.GenerateDMatrix(true);
+
+  auto learner = std::unique_ptr<Learner>(Learner::Create({p_dmat}));
+  learner->SetParams(Args{{"tree_method", "hist"}});
+  learner->UpdateOneIter(0, p_dmat);
+  learner->UpdateOneIter(1, p_dmat);
+  ASSERT_EQ(learner->BoostedRounds(), 2);
+
+  // A pending cancellation skips the iteration, the model is left untouched.
+  common::TrainingCancellation::Instance().Request(true);
+  learner->UpdateOneIter(2, p_dmat);
+  ASSERT_EQ(learner->BoostedRounds(), 2);
+
+  // Clearing the flag resumes training.
+  common::TrainingCancellation::Instance().Request(false);
+  learner->UpdateOneIter(2, p_dmat);
+  ASSERT_EQ(learner->BoostedRounds(), 3);
+}
+
 #ifdef XGBOOST_USE_CUDA
 TEST(GBTree, ChoosePredictor) {
   // The test ensures data don't get pulled into device.
@@ -454,6 +499,56 @@ class Dart : public testing::TestWithParam<char const*> {
 
 TEST_P(Dart, Prediction) { this->Run(GetParam()); }
 
+TEST(Dart, IncrementalTrainingPrediction) {
+  bst_idx_t constexpr kRows = 64;
+  bst_feature_t constexpr kCols = 8;
+  std::shared_ptr<DMatrix> p_mat{RandomDataGenerator{kRows, kCols, 0}.GenerateDMatrix(true)};
+
+  {
+    // Without dropout the incrementally maintained training prediction must match the
+    // full inference ensemble.
+    auto learner = std::unique_ptr<Learner>(Learner::Create({p_mat}));
+    learner->SetParam("booster", "dart");
+    learner->SetParam("rate_drop", "0.0");
+    learner->Configure();
+    for (std::int32_t i = 0; i < 8; ++i) {
+      learner->UpdateOneIter(i, p_mat);
+    }
+    HostDeviceVector<float> training, inference;
+    learner->Predict(p_mat, false, &training, 0, 0, true);
+    learner->Predict(p_mat, false, &inference, 0, 0, false);
+    auto const& h_training = training.ConstHostVector();
+    auto const& h_inference = inference.ConstHostVector();
+    ASSERT_EQ(h_training.size(), h_inference.size());
+    for (std::size_t i = 0; i < h_training.size(); ++i) {
+      ASSERT_NEAR(h_training[i], h_inference[i], 1e-5);
+    }
+  }
+  {
+    // Dropping every tree exercises both the weight-rescaling patch and the dropout
+    // subtraction, the cached sum must cancel out and leave only the base score.
+    auto learner = std::unique_ptr<Learner>(Learner::Create({p_mat}));
+    learner->SetParam("booster", "dart");
+    learner->SetParam("rate_drop", "1.0");
+    learner->Configure();
+    for (std::int32_t i = 0; i < 8; ++i) {
+      learner->UpdateOneIter(i, p_mat);
+    }
+    HostDeviceVector<float> training, inference;
+    learner->Predict(p_mat, false, &training, 0, 0, true);
+    learner->Predict(p_mat, false, &inference, 0, 0, false);
+    auto const& h_training = training.ConstHostVector();
+    auto const& h_inference = inference.ConstHostVector();
+    double diff{0.0};
+    for (std::size_t i = 0; i < h_training.size(); ++i) {
+      // All contributions are dropped, the prediction reduces to the base score.
+      ASSERT_NEAR(h_training[i], h_training[0], 1e-4);
+      diff += std::abs(h_training[i] - h_inference[i]);
+    }
+    ASSERT_GT(diff, kRtEps);
+  }
+}
+
 #if defined(XGBOOST_USE_CUDA)
 INSTANTIATE_TEST_SUITE_P(PredictorTypes, Dart, testing::Values("CPU", "GPU"));
 #else
@@ -582,6 +677,71 @@ TEST(GBTree, Slice) {
   TestModelSlice("gbtree");
 }
 
+// Full-range batch predictions must stay incremental across boosting rounds: only the
+// new trees are walked, and a ranged prediction must not be given the same cache entry
+// since it resets the version.
+TEST(GBTree, IncrementalPredictionCache) {
+  size_t constexpr kRows = 64, kCols = 8;
+  Context ctx;
+  LearnerModelParam mparam{MakeMP(kCols, .5, 1)};
+
+  std::unique_ptr<GradientBooster> p_gbm{GradientBooster::Create("gbtree", &ctx, &mparam)};
+  auto& gbtree = dynamic_cast<gbm::GBTree&>(*p_gbm);
+  gbtree.Configure({{"tree_method", "hist"}});
+
+  auto p_m = RandomDataGenerator{kRows, kCols, 0}.GenerateDMatrix();
+  linalg::Matrix<GradientPair> gpair({kRows}, ctx.Device());
+  gpair.Data()->Copy(GenerateRandomGradients(kRows));
+
+  PredictionCacheEntry boost_entry;
+  // Simulates the cache entry held for an evaluation matrix.
+  PredictionCacheEntry evals;
+  gbtree.DoBoost(p_m.get(), &gpair, &boost_entry, nullptr);
+  gbtree.PredictBatch(p_m.get(), &evals, false, 0, 0);
+  ASSERT_EQ(evals.version, 1);
+  gbtree.DoBoost(p_m.get(), &gpair, &boost_entry, nullptr);
+  gbtree.PredictBatch(p_m.get(), &evals, false, 0, 0);
+  // The version advances instead of resetting, only the new layer was predicted.
+  ASSERT_EQ(evals.version, 2);
+
+  // A ranged prediction resets the version, which is why the learner routes it to a
+  // scratch entry instead of the incremental one.
+  PredictionCacheEntry ranged;
+  gbtree.PredictBatch(p_m.get(), &ranged, false, 0, 1);
+  ASSERT_EQ(ranged.version, 0);
+}
+
+// Slicing must not copy trees, the sliced model shares them with its parent.
+TEST(GBTree, SliceSharesTrees) {
+  size_t constexpr kRows = 100, kCols = 10;
+  Context ctx;
+  LearnerModelParam mparam{MakeMP(kCols, .5, 1)};
+
+  std::unique_ptr<GradientBooster> p_gbm{GradientBooster::Create("gbtree", &ctx, &mparam)};
+  auto& gbtree = dynamic_cast<gbm::GBTree&>(*p_gbm);
+  gbtree.Configure({{"tree_method", "hist"}});
+
+  auto p_m = RandomDataGenerator{kRows, kCols, 0}.GenerateDMatrix();
+  linalg::Matrix<GradientPair> gpair({kRows}, ctx.Device());
+  gpair.Data()->Copy(GenerateRandomGradients(kRows));
+  PredictionCacheEntry predts;
+  for (std::int32_t i = 0; i < 4; ++i) {
+    gbtree.DoBoost(p_m.get(), &gpair, &predts, nullptr);
+  }
+
+  std::unique_ptr<GradientBooster> p_sliced{GradientBooster::Create("gbtree", &ctx, &mparam)};
+  bool out_of_bound{false};
+  gbtree.Slice(1, 3, 1, p_sliced.get(), &out_of_bound);
+  ASSERT_FALSE(out_of_bound);
+
+  auto const& trees = gbtree.GetModel().trees;
+  auto const& sliced_trees = dynamic_cast<gbm::GBTree&>(*p_sliced).GetModel().trees;
+  ASSERT_EQ(sliced_trees.size(), 2);
+  for (std::size_t i = 0; i < sliced_trees.size(); ++i) {
+    ASSERT_EQ(sliced_trees[i].get(), trees[i + 1].get());
+  }
+}
+
 TEST(Dart, Slice) {
   Json model, sliced_model;
   std::tie(model, sliced_model) = TestModelSlice("dart");
@@ -627,6 +787,101 @@ TEST(GBTree, FeatureScore) {
   test_eq("cover");
 }
 
+TEST(GBTree, FeatureScoreIncremental) {
+  size_t n_samples = 1000, n_features = 10, n_classes = 4;
+  auto m = RandomDataGenerator{n_samples, n_features, 0.5}.Classes(n_classes).GenerateDMatrix(true);
+
+  std::unique_ptr<Learner> learner{Learner::Create({m})};
+  learner->SetParam("num_class", std::to_string(n_classes));
+  learner->Configure();
+
+  // Query the whole-model importance between boosting rounds so the cumulative cache is
+  // extended incrementally, then check it agrees with an explicit list of all trees.
+  for (size_t i = 0; i < 4; ++i) {
+    learner->UpdateOneIter(i, m);
+    std::vector<bst_feature_t> features;
+    std::vector<float> scores;
+    learner->CalcFeatureScore("total_gain", {}, &features, &scores);
+
+    std::vector<int32_t> all_trees((i + 1) * n_classes);
+    std::iota(all_trees.begin(), all_trees.end(), 0);
+    std::vector<bst_feature_t> features_explicit;
+    std::vector<float> scores_explicit;
+    learner->CalcFeatureScore("total_gain", all_trees, &features_explicit, &scores_explicit);
+
+    ASSERT_EQ(features, features_explicit);
+    ASSERT_EQ(scores.size(), scores_explicit.size());
+    for (size_t j = 0; j < scores.size(); ++j) {
+      ASSERT_LE(RelError(scores[j], scores_explicit[j]), kRtEps);
+    }
+  }
+}
+
+TEST(GBTree, LazyTreeLoad) {
+  size_t n_samples = 256, n_features = 8;
+  auto m = RandomDataGenerator{n_samples, n_features, 0.5}.GenerateDMatrix(true);
+  std::unique_ptr<Learner> learner{Learner::Create({m})};
+  learner->Configure();
+  for (size_t i = 0; i < 4; ++i) {
+    learner->UpdateOneIter(i, m);
+  }
+  Json model{Object{}};
+  learner->SaveModel(&model);
+  HostDeviceVector<float> expected;
+  learner->Predict(m, false, &expected, 0, 0);
+
+  auto* cfg = GlobalConfigThreadLocalStore::Get();
+  cfg->lazy_tree_load = true;
+  std::unique_ptr<Learner> lazy{Learner::Create({})};
+  lazy->LoadModel(model);
+  cfg->lazy_tree_load = false;
+
+  // Prediction materializes the trees it needs, the result is identical to the eager
+  // load.
+  HostDeviceVector<float> got;
+  lazy->Predict(m, false, &got, 0, 0);
+  ASSERT_EQ(got.HostVector(), expected.HostVector());
+
+  // Saving completes the materialization, the round trip is unchanged.
+  Json saved{Object{}};
+  lazy->SaveModel(&saved);
+  Json eager_saved{Object{}};
+  learner->SaveModel(&eager_saved);
+  ASSERT_EQ(saved["learner"]["gradient_booster"], eager_saved["learner"]["gradient_booster"]);
+
+  // Destroying the booster while the background materialization may still be running
+  // must stop and join the worker instead of leaving it with a dangling model.
+  cfg->lazy_tree_load = true;
+  std::unique_ptr<Learner> dropped{Learner::Create({})};
+  dropped->LoadModel(model);
+  cfg->lazy_tree_load = false;
+  dropped.reset();
+}
+
+TEST(GBTree, ParallelClassTrees) {
+  size_t n_samples = 512, n_features = 8, n_classes = 4;
+  auto m = RandomDataGenerator{n_samples, n_features, 0.5}.Classes(n_classes).GenerateDMatrix(true);
+
+  auto train_and_predict = [&](std::string parallel) {
+    std::unique_ptr<Learner> learner{Learner::Create({m})};
+    learner->SetParam("num_class", std::to_string(n_classes));
+    learner->SetParam("parallel_class_trees", parallel);
+    learner->Configure();
+    for (size_t i = 0; i < 4; ++i) {
+      learner->UpdateOneIter(i, m);
+    }
+    HostDeviceVector<float> out_predt;
+    learner->Predict(m, false, &out_predt, 0, 0);
+    return out_predt.HostVector();
+  };
+
+  // The concurrent per-class updates must produce the same model as the sequential
+  // loop.
+  auto sequential = train_and_predict("0");
+  auto parallel = train_and_predict("1");
+  ASSERT_EQ(sequential, parallel);
+}
+
 TEST(GBTree, PredictRange) {
   size_t n_samples = 1000, n_features = 10, n_classes = 4;
   auto m = RandomDataGenerator{n_samples, n_features, 0.5}.Classes(n_classes).GenerateDMatrix(true);
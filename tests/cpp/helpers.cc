@@ -455,6 +455,9 @@ void MakeLabels(DeviceOrd device, bst_idx_t n_samples, bst_target_t n_classes,
       std::numeric_limits<float>::quiet_NaN(),
       this->max_num_device_pages_,
       Context{}.Threads(),
+      /*n_prefetch_batches=*/0,
+      /*persist_cache=*/false,
+      this->shuffle_seed_,
   };
   std::shared_ptr<DMatrix> p_fmat{
       DMatrix::Create(static_cast<DataIterHandle>(iter.get()), iter->Proxy(), Reset, Next, config)};
@@ -505,6 +508,8 @@ void MakeLabels(DeviceOrd device, bst_idx_t n_samples, bst_target_t n_classes,
       std::numeric_limits<float>::quiet_NaN(),
       this->max_num_device_pages_,
       Context{}.Threads(),
+      /*n_prefetch_batches=*/0,
+      /*persist_cache=*/false,
   };
   std::shared_ptr<DMatrix> p_fmat{
       DMatrix::Create(static_cast<DataIterHandle>(iter.get()), iter->Proxy(), this->ref_, Reset,
@@ -242,6 +242,7 @@ class RandomDataGenerator {
   std::shared_ptr<DMatrix> ref_{nullptr};
   std::int64_t min_cache_page_bytes_{0};
   std::int64_t max_num_device_pages_{1};
+  std::uint64_t shuffle_seed_{0};
 
   Json ArrayInterfaceImpl(HostDeviceVector<float>* storage, size_t rows, size_t cols) const;
 
@@ -283,6 +284,10 @@ class RandomDataGenerator {
     this->max_num_device_pages_ = max_num_device_pages;
     return *this;
   }
+  RandomDataGenerator& ShuffleSeed(std::uint64_t shuffle_seed) {
+    this->shuffle_seed_ = shuffle_seed;
+    return *this;
+  }
   RandomDataGenerator& Seed(uint64_t s) {
     seed_ = s;
     lcg_.Seed(seed_);
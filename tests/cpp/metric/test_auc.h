@@ -5,6 +5,8 @@
 
 #include <xgboost/metric.h>
 
+#include <algorithm>  // for copy_n
+
 #include "../helpers.h"
 
 namespace xgboost::metric {
@@ -51,6 +53,35 @@ inline void VerifyBinaryAUC(DataSplitMode data_split_mode, DeviceOrd device) {
               0.5, 1e-10);
 }
 
+inline void VerifyBinaryAUCBucketed(DataSplitMode data_split_mode, DeviceOrd device) {
+  if (device.IsCUDA()) {
+    // The bucketed approximation is CPU only, the GPU implementation stays exact.
+    return;
+  }
+  auto ctx = MakeCUDACtx(device.ordinal);
+  std::unique_ptr<Metric> uni_ptr{Metric::Create("auc@1024", &ctx)};
+  Metric* metric = uni_ptr.get();
+  ASSERT_STREQ(metric->Name(), "auc@1024");
+
+  // With enough buckets the small cases below have no collisions, so the approximation
+  // matches the exact metric.
+  EXPECT_NEAR(GetMetricEval(metric, {0, 1}, {0, 1}, {}, {}, data_split_mode), 1.0f, 1e-10);
+  EXPECT_NEAR(GetMetricEval(metric, {0, 1}, {1, 0}, {}, {}, data_split_mode), 0.0f, 1e-10);
+  EXPECT_NEAR(GetMetricEval(metric, {0, 0}, {0, 1}, {}, {}, data_split_mode), 0.5f, 1e-10);
+  EXPECT_NEAR(GetMetricEval(metric, {1, 1}, {0, 1}, {}, {}, data_split_mode), 0.5f, 1e-10);
+  EXPECT_NEAR(GetMetricEval(metric, {1, 0, 0}, {0, 0, 1}, {}, {}, data_split_mode), 0.25f, 1e-10);
+
+  // AUC with instance weights
+  EXPECT_NEAR(GetMetricEval(metric, {0.9f, 0.1f, 0.4f, 0.3f}, {0, 0, 1, 1},
+                            {1.0f, 3.0f, 2.0f, 4.0f}, {}, data_split_mode),
+              0.75f, 0.001f);
+
+  // All the predictions tied, a single bucket.
+  EXPECT_NEAR(GetMetricEval(metric, {0.5f, 0.5f, 0.5f, 0.5f}, {0, 1, 0, 1}, {}, {},
+                            data_split_mode),
+              0.5f, 1e-10);
+}
+
 inline void VerifyMultiClassAUC(DataSplitMode data_split_mode, DeviceOrd device) {
   auto ctx = MakeCUDACtx(device.ordinal);
   std::unique_ptr<Metric> uni_ptr{Metric::Create("auc", &ctx)};
@@ -144,6 +175,24 @@ inline void VerifyRankingAUC(DataSplitMode data_split_mode, DeviceOrd device) {
   EXPECT_NEAR(GetMetricEval(metric.get(), std::move(predt), labels,
                             /*weights=*/{}, groups, data_split_mode),
               0.769841f, 1e-6);
+
+  // A group larger than 64 documents, taking the general path on the GPU instead of the
+  // warp-per-query kernel.
+  bst_group_t constexpr kLargeGroup = 80;
+  std::vector<float> large_predt(kLargeGroup + 4);
+  std::vector<float> large_labels(kLargeGroup + 4);
+  for (bst_group_t i = 0; i < kLargeGroup; ++i) {
+    // perfectly ordered, auc == 1
+    large_predt[i] = large_labels[i] = static_cast<float>(i);
+  }
+  // the 4 document group from the single group case, auc == 0.5
+  std::vector<float> small_predt{0.7f, 0.2f, 0.3f, 0.6f};
+  std::vector<float> small_labels{1.0f, 0.8f, 0.4f, 0.2f};
+  std::copy_n(small_predt.begin(), 4, large_predt.begin() + kLargeGroup);
+  std::copy_n(small_labels.begin(), 4, large_labels.begin() + kLargeGroup);
+  EXPECT_NEAR(GetMetricEval(metric.get(), HostDeviceVector<float>{large_predt}, large_labels,
+                            /*weights=*/{}, {0, kLargeGroup, kLargeGroup + 4}, data_split_mode),
+              0.75f, 1e-6);
 }
 
 inline void VerifyPRAUC(DataSplitMode data_split_mode, DeviceOrd device) {
@@ -134,6 +134,7 @@ auto MakeParamsForTest() {
 #define REFLECT_NAME(name) push(#name, Verify##name)
   // AUC
   REFLECT_NAME(BinaryAUC);
+  REFLECT_NAME(BinaryAUCBucketed);
   REFLECT_NAME(MultiClassAUC);
   REFLECT_NAME(RankingAUC);
   REFLECT_NAME(PRAUC);
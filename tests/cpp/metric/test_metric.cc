@@ -1,6 +1,10 @@
 // Copyright by Contributors
 #include <xgboost/metric.h>
+#include <xgboost/objective.h>  // for FusedGradientOp
 
+#include <memory>  // for unique_ptr
+
+#include "../../../src/common/math.h"  // for Sigmoid
 #include "../helpers.h"
 namespace xgboost {
 TEST(Metric, UnknownMetric) {
@@ -14,4 +18,42 @@ TEST(Metric, UnknownMetric) {
   EXPECT_NO_THROW(metric = xgboost::Metric::Create("error@0.5f", &ctx));
   delete metric;
 }
+
+TEST(Metric, LogLossMargin) {
+  auto ctx = MakeCUDACtx(GPUIDX);
+  std::unique_ptr<Metric> metric{Metric::Create("logloss", &ctx)};
+  metric->Configure({});
+
+  bst_idx_t n_samples = 128;
+  auto p_fmat = EmptyDMatrix();
+  MetaInfo& info = p_fmat->Info();
+  info.num_row_ = n_samples;
+  info.labels.Reshape(n_samples, 1);
+  auto& h_labels = info.labels.Data()->HostVector();
+
+  HostDeviceVector<float> margin;
+  HostDeviceVector<float> prob;
+  auto& h_margin = margin.HostVector();
+  auto& h_prob = prob.HostVector();
+  h_margin.resize(n_samples);
+  h_prob.resize(n_samples);
+
+  SimpleLCG lcg;
+  SimpleRealUniformDistribution<float> dist{-4.0f, 4.0f};
+  for (bst_idx_t i = 0; i < n_samples; ++i) {
+    h_margin[i] = dist(&lcg);
+    h_prob[i] = common::Sigmoid(h_margin[i]);
+    h_labels[i] = i % 2;
+  }
+
+  FusedGradientOp op;
+  op.kind = FusedGradientOp::kLogistic;
+  double fused{0.0};
+  ASSERT_TRUE(metric->EvaluateMargin(margin, p_fmat, op, &fused));
+  ASSERT_EQ(fused, metric->Evaluate(prob, p_fmat));
+
+  // Unknown transforms fall back to the two-pass route.
+  op.kind = FusedGradientOp::kSquaredError;
+  ASSERT_FALSE(metric->EvaluateMargin(margin, p_fmat, op, &fused));
+}
 }  // namespace xgboost
@@ -26,4 +26,22 @@ TEST(Metric, AMS) {
   ASSERT_STREQ(metric->Name(), "ams@0");
   EXPECT_NEAR(GetMetricEval(metric.get(), {0, 1}, {0, 1}), 0.311f, 0.001f);
 }
+
+TEST(Metric, NDCGApprox) {
+  Context ctx;
+  std::unique_ptr<Metric> metric{Metric::Create("ndcg-approx", &ctx)};
+  ASSERT_STREQ(metric->Name(), "ndcg-approx");
+  EXPECT_NEAR(GetMetricEval(metric.get(), {0, 1}, {0, 1}), 1, 1e-10);
+
+  // Well separated scores fall into distinct buckets and match the exact metric.
+  std::unique_ptr<Metric> exact{Metric::Create("ndcg", &ctx)};
+  EXPECT_NEAR(GetMetricEval(metric.get(), {0.1f, 0.9f, 0.2f, 0.8f}, {0, 0, 1, 1}),
+              GetMetricEval(exact.get(), {0.1f, 0.9f, 0.2f, 0.8f}, {0, 0, 1, 1}), 1e-6);
+
+  metric.reset(Metric::Create("ndcg-approx@2", &ctx));
+  ASSERT_STREQ(metric->Name(), "ndcg-approx@2");
+  exact.reset(Metric::Create("ndcg@2", &ctx));
+  EXPECT_NEAR(GetMetricEval(metric.get(), {0.1f, 0.9f, 0.2f, 0.8f}, {0, 0, 1, 1}),
+              GetMetricEval(exact.get(), {0.1f, 0.9f, 0.2f, 0.8f}, {0, 0, 1, 1}), 1e-6);
+}
 }  // namespace xgboost::metric
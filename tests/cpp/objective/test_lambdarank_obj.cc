@@ -225,6 +225,31 @@ TEST(LambdaRank, MakePair) {
   }
 }
 
+TEST(LambdaRank, MakeGroupBlocks) {
+  // 512 single-document groups followed by one large group.
+  bst_group_t n_groups = 513;
+  std::vector<bst_group_t> gptr(n_groups + 1);
+  for (bst_group_t g = 0; g < n_groups; ++g) {
+    gptr[g] = g;
+  }
+  gptr[n_groups] = 512 + 4096;
+
+  auto blocks =
+      cpu_impl::MakeGroupBlocks(common::Span<bst_group_t const>{gptr.data(), gptr.size()}, 4);
+  ASSERT_GE(blocks.size(), 2);
+  ASSERT_EQ(blocks.front(), 0);
+  ASSERT_EQ(blocks.back(), n_groups);
+  for (std::size_t i = 1; i < blocks.size(); ++i) {
+    ASSERT_GT(blocks[i], blocks[i - 1]);
+    if (i + 1 < blocks.size()) {
+      // every block except the last covers at least the minimum number of documents
+      ASSERT_GE(gptr[blocks[i]] - gptr[blocks[i - 1]], 256);
+    }
+  }
+  // the large group gets a block of its own
+  ASSERT_EQ(blocks[blocks.size() - 2], 512);
+}
+
 void TestMAPStat(Context const* ctx) {
   auto p_fmat = EmptyDMatrix();
   MetaInfo& info = p_fmat->Info();
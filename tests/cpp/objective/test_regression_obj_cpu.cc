@@ -23,6 +23,40 @@ TEST(Objective, DeclareUnifiedTest(SquaredLog)) {
   TestSquaredLog(&ctx);
 }
 
+TEST(Objective, FastExpLogisticGPair) {
+  // The approximate transform must reproduce the exact gradients within the check
+  // tolerance.
+  Context ctx;
+  std::unique_ptr<ObjFunction> obj{ObjFunction::Create("reg:logistic", &ctx)};
+  obj->Configure(Args{{"fast_exp", "true"}});
+  CheckConfigReload(obj, "reg:logistic");
+
+  CheckObjFunction(obj,
+                   {   0,  0.1f,  0.9f,    1,    0,   0.1f,  0.9f,      1},      // preds
+                   {   0,    0,    0,    0,    1,     1,     1,     1},          // labels
+                   {   1,    1,    1,    1,    1,     1,     1,     1},          // weights
+                   { 0.5f, 0.52f, 0.71f, 0.73f, -0.5f, -0.47f, -0.28f, -0.26f},  // out_grad
+                   {0.25f, 0.24f, 0.20f, 0.19f, 0.25f,  0.24f,  0.20f,  0.19f});  // out_hess
+}
+
+TEST(Objective, IdentityEvalTransform) {
+  // Objectives whose eval transform is an identity must advertise it so that the
+  // learner can skip the transform copy during evaluation.
+  Context ctx;
+  auto is_identity = [&](char const* name) {
+    std::unique_ptr<ObjFunction> obj{ObjFunction::Create(name, &ctx)};
+    obj->Configure(Args{});
+    return obj->IdentityEvalTransform();
+  };
+  ASSERT_TRUE(is_identity("reg:squarederror"));
+  ASSERT_TRUE(is_identity("reg:absoluteerror"));
+  ASSERT_TRUE(is_identity("binary:logitraw"));
+  ASSERT_TRUE(is_identity("rank:ndcg"));
+  ASSERT_FALSE(is_identity("binary:logistic"));
+  ASSERT_FALSE(is_identity("reg:gamma"));
+  ASSERT_FALSE(is_identity("count:poisson"));
+}
+
 TEST(Objective, DeclareUnifiedTest(PseudoHuber)) {
   Context ctx = MakeCUDACtx(GPUIDX);
   Args args;
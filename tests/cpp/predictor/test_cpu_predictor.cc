@@ -4,11 +4,18 @@
 #include <gtest/gtest.h>
 #include <xgboost/predictor.h>
 
+#include <cmath>    // for isnan
+#include <limits>   // for numeric_limits
+#include <memory>   // for unique_ptr
+#include <numeric>  // for iota
+
 #include "../../../src/collective/communicator-inl.h"
 #include "../../../src/data/adapter.h"
 #include "../../../src/data/proxy_dmatrix.h"
 #include "../../../src/gbm/gbtree.h"
 #include "../../../src/gbm/gbtree_model.h"
+#include "../../../src/predictor/compiled_model.h"
+#include "../../../src/predictor/quantized_model.h"
 #include "../collective/test_worker.h"  // for TestDistributedGlobal
 #include "../helpers.h"
 #include "test_predictor.h"
@@ -208,5 +215,363 @@ TEST(CpuPredictor, Multi) {
   TestVectorLeafPrediction(&ctx);
 }
 
+TEST(CpuPredictor, WideMultiTarget) {
+  Context ctx;
+  std::unique_ptr<Predictor> cpu_predictor{Predictor::Create("cpu_predictor", &ctx)};
+
+  std::size_t constexpr kRows = 512, kCols = 5;
+  bst_target_t constexpr kTargets = 300;  // wide enough for the target-sharded path
+
+  LearnerModelParam mparam{static_cast<bst_feature_t>(kCols),
+                           linalg::Vector<float>{{0.5}, {1}, DeviceOrd::CPU()}, 1, kTargets,
+                           MultiStrategy::kMultiOutputTree};
+  gbm::TreesOneGroup trees;
+  trees.emplace_back(new RegTree{mparam.LeafLength(), mparam.num_feature});
+
+  // Distinct per-target leaf values so a shard writing the wrong target range is caught.
+  std::vector<float> p_w(mparam.LeafLength(), 0.0f);
+  std::vector<float> l_w(mparam.LeafLength());
+  std::vector<float> r_w(mparam.LeafLength());
+  std::iota(l_w.begin(), l_w.end(), 0.0f);
+  for (std::size_t t = 0; t < r_w.size(); ++t) {
+    r_w[t] = -static_cast<float>(t);
+  }
+
+  auto &tree = trees.front();
+  tree->ExpandNode(0, static_cast<bst_feature_t>(1), 2.0, true,
+                   linalg::MakeVec(p_w.data(), p_w.size()), linalg::MakeVec(l_w.data(), l_w.size()),
+                   linalg::MakeVec(r_w.data(), r_w.size()));
+  gbm::GBTreeModel model{&mparam, &ctx};
+  model.CommitModelGroup(std::move(trees), 0);
+
+  // Even rows go left, odd rows go right.
+  std::vector<float> x(kRows * kCols);
+  for (std::size_t i = 0; i < kRows; ++i) {
+    std::fill_n(x.begin() + i * kCols, kCols, i % 2 == 0 ? 1.0f : 3.0f);
+  }
+  auto p_fmat = GetDMatrixFromData(x, kRows, kCols);
+
+  PredictionCacheEntry predt_cache;
+  cpu_predictor->InitOutPredictions(p_fmat->Info(), &predt_cache.predictions, model);
+  cpu_predictor->PredictBatch(p_fmat.get(), &predt_cache, model, 0, 1);
+  auto const &h_predt = predt_cache.predictions.HostVector();
+  ASSERT_EQ(h_predt.size(), kRows * kTargets);
+  for (std::size_t i = 0; i < kRows; ++i) {
+    for (bst_target_t t = 0; t < kTargets; ++t) {
+      auto expected = 0.5f + (i % 2 == 0 ? l_w[t] : r_w[t]);
+      ASSERT_EQ(h_predt[i * kTargets + t], expected) << "row:" << i << " target:" << t;
+    }
+  }
+}
+
 TEST(CpuPredictor, Access) { TestPredictionDeviceAccess(); }
+
+TEST(CpuPredictor, CompiledModel) {
+  Context ctx;
+  LearnerModelParam mparam{MakeMP(2, .5, 1)};
+  gbm::GBTreeModel model(&mparam, &ctx);
+
+  gbm::TreesOneGroup trees;
+  trees.push_back(std::make_unique<RegTree>());
+  auto &tree = *trees.front();
+  // Expand the right child before the left one so that allocation order differs from
+  // breadth-first order.
+  tree.ExpandNode(0, /*split_index=*/1, /*split_value=*/0.5f, /*default_left=*/true, 0.0f, 0.0f,
+                  0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+  tree.ExpandNode(tree[0].RightChild(), 0, 2.5f, false, 0.0f, 3.0f, 4.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+  tree.ExpandNode(tree[0].LeftChild(), 0, 1.5f, true, 0.0f, 1.0f, 2.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+  model.CommitModelGroup(std::move(trees), 0);
+
+  ASSERT_TRUE(predictor::CompiledModel::CanCompile(model, 0, 1));
+  predictor::CompiledModel compiled{model, 0, 1};
+  ASSERT_EQ(compiled.NumTrees(), 1);
+  auto nodes = compiled.Nodes(0);
+  ASSERT_EQ(nodes.size(), 7);
+
+  // Root, then the two internal nodes, then the leaves level by level.
+  ASSERT_EQ(nodes[0].SplitIndex(), 1);
+  ASSERT_TRUE(nodes[0].DefaultLeft());
+  ASSERT_EQ(nodes[0].value, 0.5f);
+  ASSERT_EQ(nodes[0].left, 1);
+
+  ASSERT_EQ(nodes[1].value, 1.5f);
+  ASSERT_EQ(nodes[1].left, 3);
+  ASSERT_EQ(nodes[2].value, 2.5f);
+  ASSERT_FALSE(nodes[2].DefaultLeft());
+  ASSERT_EQ(nodes[2].left, 5);
+
+  for (bst_node_t nidx = 3; nidx < 7; ++nidx) {
+    ASSERT_TRUE(nodes[nidx].IsLeaf());
+  }
+  ASSERT_EQ(nodes[3].value, 1.0f);
+  ASSERT_EQ(nodes[4].value, 2.0f);
+  ASSERT_EQ(nodes[5].value, 3.0f);
+  ASSERT_EQ(nodes[6].value, 4.0f);
+}
+
+TEST(CpuPredictor, CompiledModelUniformDepth) {
+  Context ctx;
+  bst_feature_t constexpr kCols = 2;
+  LearnerModelParam mparam{MakeMP(kCols, .5, 1)};
+  gbm::GBTreeModel model(&mparam, &ctx);
+
+  // A perfect depth-2 tree: every leaf sits on the last level.
+  gbm::TreesOneGroup trees;
+  trees.push_back(std::make_unique<RegTree>());
+  auto &tree = *trees.front();
+  tree.ExpandNode(0, /*split_index=*/1, /*split_value=*/0.5f, /*default_left=*/true, 0.0f, 0.0f,
+                  0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+  tree.ExpandNode(tree[0].LeftChild(), 0, 1.5f, true, 0.0f, 1.0f, 2.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+  tree.ExpandNode(tree[0].RightChild(), 0, 2.5f, false, 0.0f, 3.0f, 4.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+  model.CommitModelGroup(std::move(trees), 0);
+
+  {
+    predictor::CompiledModel compiled{model, 0, 1};
+    ASSERT_EQ(compiled.UniformDepth(), 2);
+  }
+
+  // The fixed-depth walk must agree with a reference traversal of the source tree.
+  bst_idx_t constexpr kRows = 64;
+  std::vector<float> x(kRows * kCols);
+  for (bst_idx_t i = 0; i < kRows; ++i) {
+    x[i * kCols] = static_cast<float>(i % 8) * 0.5f;     // both sides of 1.5 and 2.5
+    x[i * kCols + 1] = static_cast<float>(i % 2);        // both sides of 0.5
+  }
+  auto p_fmat = GetDMatrixFromData(x, kRows, kCols);
+
+  std::unique_ptr<Predictor> predictor{Predictor::Create("cpu_predictor", &ctx)};
+  PredictionCacheEntry out_predictions;
+  predictor->InitOutPredictions(p_fmat->Info(), &out_predictions.predictions, model);
+  predictor->PredictBatch(p_fmat.get(), &out_predictions, model, 0);
+
+  auto const &walked = *model.trees.front();
+  auto const &h_predt = out_predictions.predictions.HostVector();
+  for (bst_idx_t i = 0; i < kRows; ++i) {
+    bst_node_t nidx{0};
+    while (!walked[nidx].IsLeaf()) {
+      auto fvalue = x[i * kCols + walked[nidx].SplitIndex()];
+      nidx = fvalue < walked[nidx].SplitCond() ? walked[nidx].LeftChild()
+                                               : walked[nidx].RightChild();
+    }
+    ASSERT_EQ(h_predt[i], 0.5f + walked[nidx].LeafValue());
+  }
+
+  // A depth-1 tree alongside the depth-2 one makes the model irregular.
+  gbm::TreesOneGroup more;
+  more.push_back(std::make_unique<RegTree>());
+  auto &stump = *more.front();
+  stump.ExpandNode(0, 0, 2.0f, true, 0.0f, -1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+  model.CommitModelGroup(std::move(more), 0);
+
+  ASSERT_EQ(predictor::CompiledModel(model, 0, 2).UniformDepth(), -1);
+  ASSERT_EQ(predictor::CompiledModel(model, 1, 2).UniformDepth(), 1);
+}
+
+TEST(CpuPredictor, ShapEfficiency) {
+  // The contributions of a row must sum to its margin prediction; trained trees with
+  // repeated features along a path exercise the unwind/redo branch of the SHAP walk.
+  std::size_t constexpr kRows = 128, kCols = 8;
+  Context ctx;
+  auto p_fmat = RandomDataGenerator(kRows, kCols, 0.25).GenerateDMatrix(true);
+  std::unique_ptr<Learner> learner{Learner::Create({p_fmat})};
+  learner->SetParam("max_depth", "8");
+  for (std::int32_t i = 0; i < 4; ++i) {
+    learner->UpdateOneIter(i, p_fmat);
+  }
+
+  HostDeviceVector<float> contribs;
+  learner->Predict(p_fmat, false, &contribs, 0, 0, false, false, true, false, false);
+  HostDeviceVector<float> margin;
+  learner->Predict(p_fmat, true, &margin, 0, 0);
+
+  auto const& h_contribs = contribs.ConstHostVector();
+  auto const& h_margin = margin.ConstHostVector();
+  ASSERT_EQ(h_contribs.size(), kRows * (kCols + 1));
+  for (std::size_t i = 0; i < kRows; ++i) {
+    double sum = 0;
+    for (std::size_t c = 0; c <= kCols; ++c) {
+      sum += h_contribs[i * (kCols + 1) + c];
+    }
+    ASSERT_NEAR(sum, h_margin[i], 1e-3);
+  }
+}
+
+namespace {
+bst_node_t WalkTreeForTest(RegTree const& tree, std::vector<float> const& row) {
+  bst_node_t nidx = 0;
+  while (!tree[nidx].IsLeaf()) {
+    auto fvalue = row[tree[nidx].SplitIndex()];
+    if (std::isnan(fvalue)) {
+      nidx = tree[nidx].DefaultChild();
+    } else {
+      nidx = fvalue < tree[nidx].SplitCond() ? tree[nidx].LeftChild() : tree[nidx].RightChild();
+    }
+  }
+  return nidx;
+}
+}  // namespace
+
+TEST(CpuPredictor, PredictLeafBlocked) {
+  std::size_t constexpr kRows = 256, kCols = 8, kTrees = 11;
+  Context ctx;
+  auto dmat = RandomDataGenerator(kRows, kCols, 0.5).GenerateDMatrix();
+
+  LearnerModelParam mparam{MakeMP(kCols, .0, 1)};
+  gbm::GBTreeModel model(&mparam, &ctx);
+  // Trees split on rotating features so rows land in different leaves per tree.
+  for (std::size_t t = 0; t < kTrees; ++t) {
+    gbm::TreesOneGroup trees;
+    trees.push_back(std::make_unique<RegTree>());
+    auto& tree = *trees.front();
+    tree.ExpandNode(0, t % kCols, 0.5f, t % 2 == 0, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+    tree.ExpandNode(tree[0].LeftChild(), (t + 1) % kCols, 0.25f, true, 0.0f, 1.0f, 2.0f, 0.0f,
+                    0.0f, 0.0f, 0.0f);
+    model.CommitModelGroup(std::move(trees), 0);
+  }
+
+  auto predictor = std::unique_ptr<Predictor>(CreatePredictorForTest(&ctx));
+  predictor->Configure({});
+  HostDeviceVector<float> leaf_predictions;
+  predictor->PredictLeaf(dmat.get(), &leaf_predictions, model);
+  auto const& h_leaf = leaf_predictions.ConstHostVector();
+  ASSERT_EQ(h_leaf.size(), kRows * kTrees);
+
+  for (auto const& batch : dmat->GetBatches<SparsePage>()) {
+    auto page = batch.GetView();
+    for (std::size_t i = 0; i < page.Size(); ++i) {
+      std::vector<float> row(kCols, std::numeric_limits<float>::quiet_NaN());
+      for (auto const& e : page[i]) {
+        row[e.index] = e.fvalue;
+      }
+      auto ridx = batch.base_rowid + i;
+      for (std::size_t t = 0; t < kTrees; ++t) {
+        auto expected = WalkTreeForTest(*model.trees[t], row);
+        ASSERT_EQ(h_leaf[ridx * kTrees + t], static_cast<float>(expected));
+      }
+    }
+  }
+}
+
+TEST(CpuPredictor, UsedFeatureSubset) {
+  // A model that splits on a small fraction of the columns must agree with a reference
+  // traversal when the predictor fills only the used features into its workspace.
+  std::size_t constexpr kRows = 128, kCols = 64, kTrees = 4;
+  Context ctx;
+
+  LearnerModelParam mparam{MakeMP(kCols, .5, 1)};
+  gbm::GBTreeModel model(&mparam, &ctx);
+  bst_feature_t constexpr kUsed[] = {3, 37};
+  for (std::size_t t = 0; t < kTrees; ++t) {
+    gbm::TreesOneGroup trees;
+    trees.push_back(std::make_unique<RegTree>());
+    auto& tree = *trees.front();
+    tree.ExpandNode(0, kUsed[t % 2], 0.5f, t % 2 == 0, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+    tree.ExpandNode(tree[0].LeftChild(), kUsed[(t + 1) % 2], 0.25f, true, 0.0f, 1.0f, 2.0f, 0.0f,
+                    0.0f, 0.0f, 0.0f);
+    model.CommitModelGroup(std::move(trees), 0);
+  }
+
+  auto predictor = std::unique_ptr<Predictor>(CreatePredictorForTest(&ctx));
+  predictor->Configure({});
+
+  // Dense data takes the blocked kernel, sparse data the row-at-a-time one.
+  for (auto sparsity : {0.0f, 0.8f}) {
+    auto dmat = RandomDataGenerator(kRows, kCols, sparsity).GenerateDMatrix();
+    PredictionCacheEntry out_predictions;
+    predictor->InitOutPredictions(dmat->Info(), &out_predictions.predictions, model);
+    predictor->PredictBatch(dmat.get(), &out_predictions, model, 0);
+    auto const& h_predt = out_predictions.predictions.ConstHostVector();
+
+    for (auto const& batch : dmat->GetBatches<SparsePage>()) {
+      auto page = batch.GetView();
+      for (std::size_t i = 0; i < page.Size(); ++i) {
+        std::vector<float> row(kCols, std::numeric_limits<float>::quiet_NaN());
+        for (auto const& e : page[i]) {
+          row[e.index] = e.fvalue;
+        }
+        float expected = .5f;
+        for (std::size_t t = 0; t < kTrees; ++t) {
+          auto const& tree = *model.trees[t];
+          expected += tree[WalkTreeForTest(tree, row)].LeafValue();
+        }
+        ASSERT_EQ(h_predt[batch.base_rowid + i], expected);
+      }
+    }
+  }
+}
+
+TEST(CpuPredictor, QuantizedModel) {
+  Context ctx;
+  bst_feature_t constexpr kCols = 2;
+  LearnerModelParam mparam{MakeMP(kCols, .5, 1)};
+  gbm::GBTreeModel model(&mparam, &ctx);
+
+  common::HistogramCuts cuts;
+  cuts.cut_ptrs_.HostVector() = {0, 3, 6};
+  cuts.cut_values_.HostVector() = {0.5f, 1.5f, 2.5f, 0.25f, 0.75f, 1.25f};
+  cuts.min_vals_.HostVector() = {0.0f, 0.0f};
+
+  {
+    gbm::TreesOneGroup trees;
+    trees.push_back(std::make_unique<RegTree>());
+    auto& tree = *trees.front();
+    // Split conditions sit on the cut grid, leaf values fit half precision exactly.
+    tree.ExpandNode(0, 0, 1.5f, true, 0.0f, 0.0f, -0.375f, 0.0f, 0.0f, 0.0f, 0.0f);
+    tree.ExpandNode(tree[0].LeftChild(), 1, 0.75f, false, 0.0f, 1.25f, -2.5f, 0.0f, 0.0f, 0.0f,
+                    0.0f);
+    model.CommitModelGroup(std::move(trees), 0);
+  }
+
+  ASSERT_TRUE(predictor::QuantizedModel::CanQuantize(model, cuts, 0, 1));
+  predictor::QuantizedModel quantized{model, cuts, 0, 1};
+  ASSERT_EQ(quantized.NumTrees(), 1);
+  ASSERT_EQ(quantized.Nodes(0).size(), 5);
+  ASSERT_EQ(quantized.Group(0), 0);
+
+  // The quantized walk must agree with the source tree, including the default branch.
+  auto const& tree = *model.trees.front();
+  float constexpr kNaN = std::numeric_limits<float>::quiet_NaN();
+  std::vector<std::vector<float>> rows{
+      {1.0f, 0.5f}, {1.0f, 1.0f}, {2.0f, 0.5f}, {kNaN, 0.5f}, {1.0f, kNaN}, {kNaN, kNaN}};
+  RegTree::FVec feat;
+  feat.Init(kCols);
+  for (auto const& row : rows) {
+    std::vector<Entry> entries;
+    for (bst_feature_t f = 0; f < kCols; ++f) {
+      if (!std::isnan(row[f])) {
+        entries.emplace_back(f, row[f]);
+      }
+    }
+    feat.Fill({entries.data(), entries.size()});
+    auto expected = tree[WalkTreeForTest(tree, row)].LeafValue();
+    ASSERT_EQ(quantized.PredictTree(0, feat), expected);
+    feat.Drop();
+  }
+
+  {
+    // Leaves that need more than half precision are rounded.
+    gbm::TreesOneGroup trees;
+    trees.push_back(std::make_unique<RegTree>());
+    auto& tree_1 = *trees.front();
+    tree_1.ExpandNode(0, 0, 0.5f, true, 0.0f, 0.1f, 0.2f, 0.0f, 0.0f, 0.0f, 0.0f);
+    model.CommitModelGroup(std::move(trees), 0);
+
+    predictor::QuantizedModel rounded{model, cuts, 1, 2};
+    std::vector<Entry> entries{{0, 0.0f}};
+    feat.Fill({entries.data(), entries.size()});
+    auto got = rounded.PredictTree(0, feat);
+    ASSERT_NE(got, 0.1f);
+    ASSERT_NEAR(got, 0.1f, 1e-4);
+    feat.Drop();
+  }
+
+  {
+    // A split off the cut grid cannot be represented in the bin domain.
+    gbm::TreesOneGroup trees;
+    trees.push_back(std::make_unique<RegTree>());
+    trees.front()->ExpandNode(0, 0, 0.6f, true, 0.0f, 1.0f, 2.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+    model.CommitModelGroup(std::move(trees), 0);
+    ASSERT_FALSE(predictor::QuantizedModel::CanQuantize(model, cuts, 2, 3));
+  }
+}
 }  // namespace xgboost
@@ -5,6 +5,7 @@
 #include <xgboost/c_api.h>
 #include <xgboost/learner.h>
 #include <xgboost/logging.h>
+#include <xgboost/objective.h>  // for ObjFunction, FusedGradientOp
 #include <xgboost/predictor.h>
 
 #include <string>
@@ -55,6 +56,48 @@ TEST(GPUPredictor, Basic) {
   }
 }
 
+TEST(GPUPredictor, FusedGradient) {
+  auto ctx = MakeCUDACtx(0);
+  std::size_t constexpr kRows{256}, kCols{8};
+  auto dmat = RandomDataGenerator(kRows, kCols, 0.5).GenerateDMatrix(true);
+  auto& h_weights = dmat->Info().weights_.HostVector();
+  h_weights.resize(kRows);
+  for (std::size_t i = 0; i < kRows; ++i) {
+    h_weights[i] = 1.0f + static_cast<float>(i % 3);
+  }
+
+  LearnerModelParam mparam{MakeMP(kCols, .5, 1, ctx.Device())};
+  gbm::GBTreeModel model = CreateTestModel(&mparam, &ctx);
+  std::unique_ptr<Predictor> predictor{Predictor::Create("gpu_predictor", &ctx)};
+  predictor->Configure({});
+
+  for (auto name : {"reg:squarederror", "binary:logistic"}) {
+    std::unique_ptr<ObjFunction> obj{ObjFunction::Create(name, &ctx)};
+    obj->Configure({});
+    auto op = obj->FusedGradient();
+    ASSERT_NE(op.kind, FusedGradientOp::kNone);
+
+    PredictionCacheEntry predts;
+    predictor->InitOutPredictions(dmat->Info(), &predts.predictions, model);
+    linalg::Matrix<GradientPair> fused;
+    ASSERT_TRUE(predictor->PredictBatchWithFusedGradient(
+        dmat.get(), &predts, model, 0, model.trees.size(), op, &fused));
+
+    // The fused epilogue must produce the same gradient as the objective reading the
+    // predictions it just wrote.
+    linalg::Matrix<GradientPair> expected;
+    obj->GetGradient(predts.predictions, dmat->Info(), /*iter=*/1, &expected);
+
+    auto h_fused = fused.HostView();
+    auto h_expected = expected.HostView();
+    ASSERT_EQ(h_fused.Size(), kRows);
+    for (std::size_t i = 0; i < kRows; ++i) {
+      ASSERT_EQ(h_fused(i, 0).GetGrad(), h_expected(i, 0).GetGrad());
+      ASSERT_EQ(h_fused(i, 0).GetHess(), h_expected(i, 0).GetHess());
+    }
+  }
+}
+
 namespace {
 void VerifyBasicColumnSplit(std::array<std::vector<float>, 32> const& expected_result) {
   auto const world_size = collective::GetWorldSize();
@@ -237,7 +280,7 @@ TEST(GPUPredictor, ShapStump) {
   LearnerModelParam mparam{MakeMP(1, .5, 1, ctx.Device())};
   gbm::GBTreeModel model(&mparam, &ctx);
 
-  std::vector<std::unique_ptr<RegTree>> trees;
+  gbm::TreesOneGroup trees;
   trees.push_back(std::make_unique<RegTree>());
   model.CommitModelGroup(std::move(trees), 0);
 
@@ -263,7 +306,7 @@ TEST(GPUPredictor, Shap) {
   LearnerModelParam mparam{MakeMP(1, .5, 1, ctx.Device())};
   gbm::GBTreeModel model(&mparam, &ctx);
 
-  std::vector<std::unique_ptr<RegTree>> trees;
+  gbm::TreesOneGroup trees;
   trees.push_back(std::make_unique<RegTree>());
   trees[0]->ExpandNode(0, 0, 0.5, true, 1.0, -1.0, 1.0, 0.0, 5.0, 2.0, 3.0);
   model.CommitModelGroup(std::move(trees), 0);
@@ -337,7 +337,7 @@ void GBTreeModelForTest(gbm::GBTreeModel *model, uint32_t split_ind,
                         float right_weight) {
   PredictionCacheEntry out_predictions;
 
-  std::vector<std::unique_ptr<RegTree>> trees;
+  gbm::TreesOneGroup trees;
   trees.push_back(std::unique_ptr<RegTree>(new RegTree));
   auto& p_tree = trees.front();
 
@@ -748,7 +748,7 @@ void TestVectorLeafPrediction(Context const *ctx) {
                            linalg::Vector<float>{{0.5}, {1}, DeviceOrd::CPU()}, 1, 3,
                            MultiStrategy::kMultiOutputTree};
 
-  std::vector<std::unique_ptr<RegTree>> trees;
+  gbm::TreesOneGroup trees;
   trees.emplace_back(new RegTree{mparam.LeafLength(), mparam.num_feature});
 
   std::vector<float> p_w(mparam.LeafLength(), 0.0f);
@@ -19,7 +19,7 @@ inline gbm::GBTreeModel CreateTestModel(LearnerModelParam const* param, Context
   gbm::GBTreeModel model(param, ctx);
 
   for (size_t i = 0; i < n_classes; ++i) {
-    std::vector<std::unique_ptr<RegTree>> trees;
+    gbm::TreesOneGroup trees;
     trees.push_back(std::unique_ptr<RegTree>(new RegTree));
     if (i == 0) {
       (*trees.back())[0].SetLeaf(1.5f);
@@ -55,6 +55,50 @@ TEST(DMatrixCache, Basic) {
   }
 }
 
+TEST(DMatrixCache, TransferItem) {
+  std::size_t constexpr kRows = 2, kCols = 1, kCacheSize = 4;
+  DMatrixCache<CacheForTest> cache{kCacheSize};
+
+  auto p_old = RandomDataGenerator(kRows, kCols, 0).GenerateDMatrix();
+  auto p_new = RandomDataGenerator(kRows, kCols, 0).GenerateDMatrix();
+  // Nothing cached for the old matrix yet.
+  ASSERT_FALSE(cache.TransferItem(p_old.get(), p_new));
+
+  auto item = cache.CacheItem(p_old, 3);
+  auto transferred = cache.TransferItem(p_old.get(), p_new);
+  ASSERT_EQ(item, transferred);
+  ASSERT_EQ(cache.Entry(p_new.get())->i, 3);
+  // The old matrix keeps a shared reference until it expires.
+  ASSERT_EQ(cache.Entry(p_old.get())->i, 3);
+
+  p_old.reset();
+  cache.SweepExpired();
+  ASSERT_EQ(cache.Container().size(), 1);
+  ASSERT_EQ(cache.Entry(p_new.get())->i, 3);
+}
+
+TEST(DMatrixCache, SweepExpired) {
+  std::size_t constexpr kRows = 2, kCols = 1, kCacheSize = 32;
+  DMatrixCache<CacheForTest> cache{kCacheSize};
+
+  auto p_fmat = RandomDataGenerator(kRows, kCols, 0).GenerateDMatrix();
+  cache.CacheItem(p_fmat, 0);
+
+  // Churn through short-lived DMatrix handles.  Expired entries are reclaimed lazily,
+  // the cache must keep serving the long-lived entry and an allocator that recycles
+  // addresses must not resurrect a stale item.
+  for (std::size_t i = 1; i < kCacheSize * 4; ++i) {
+    auto ephemeral = RandomDataGenerator(kRows, kCols, 0).GenerateDMatrix();
+    auto item = cache.CacheItem(ephemeral, i);
+    ASSERT_EQ(item->i, i);
+    ASSERT_EQ(cache.Entry(p_fmat.get())->i, 0);
+  }
+
+  cache.SweepExpired();
+  ASSERT_EQ(cache.Container().size(), 1);
+  ASSERT_EQ(cache.Entry(p_fmat.get())->i, 0);
+}
+
 TEST(DMatrixCache, MultiThread) {
   std::size_t constexpr kRows = 2, kCols = 1, kCacheSize = 3;
   auto p_fmat = RandomDataGenerator(kRows, kCols, 0).GenerateDMatrix();
@@ -115,6 +159,21 @@ TEST(DMatrixCache, MultiThread) {
     for (std::uint32_t tidx = 0; tidx < n; ++tidx) {
       ASSERT_EQ(results[tidx]->i, tidx);
     }
+
+    // Repeated lookups of an existing entry take the shared fast path and must keep
+    // returning the same item.
+    tasks.clear();
+    for (std::uint32_t tidx = 0; tidx < n; ++tidx) {
+      tasks.emplace_back([&, tidx]() {
+        for (std::int32_t k = 0; k < 128; ++k) {
+          auto item = cache.CacheItem(p_fmat, tidx + 1);
+          ASSERT_EQ(item->i, tidx);
+        }
+      });
+    }
+    for (auto& t : tasks) {
+      t.join();
+    }
   }
 }
 }  // namespace xgboost
@@ -128,6 +128,45 @@ TEST(Learner, CheckMultiBatch) {
   learner->UpdateOneIter(0, p_fmat);
 }
 
+TEST(Learner, TransferPredictionCache) {
+  std::size_t constexpr kRows = 128, kCols = 8;
+  std::int32_t constexpr kIters = 4;
+  auto p_fmat = RandomDataGenerator{kRows, kCols, 0.2}.GenerateDMatrix(true);
+  // A rebuilt matrix holding identical rows.
+  auto p_rebuilt = RandomDataGenerator{kRows, kCols, 0.2}.GenerateDMatrix(true);
+
+  // Reference, train without rebuilding the matrix.
+  auto ref = std::unique_ptr<Learner>(Learner::Create({p_fmat}));
+  for (std::int32_t i = 0; i < kIters; ++i) {
+    ref->UpdateOneIter(i, p_fmat);
+  }
+  HostDeviceVector<float> ref_predt;
+  ref->Predict(p_fmat, false, &ref_predt, 0, 0);
+
+  // Rebuild the matrix mid-training and transfer the cache to the new handle.
+  auto learner = std::unique_ptr<Learner>(Learner::Create({p_fmat}));
+  for (std::int32_t i = 0; i < kIters / 2; ++i) {
+    learner->UpdateOneIter(i, p_fmat);
+  }
+  learner->TransferPredictionCache(p_fmat.get(), p_rebuilt);
+  for (std::int32_t i = kIters / 2; i < kIters; ++i) {
+    learner->UpdateOneIter(i, p_rebuilt);
+  }
+  HostDeviceVector<float> predt;
+  learner->Predict(p_fmat, false, &predt, 0, 0);
+
+  auto const& h_ref = ref_predt.HostVector();
+  auto const& h_predt = predt.HostVector();
+  ASSERT_EQ(h_ref.size(), h_predt.size());
+  for (std::size_t i = 0; i < h_ref.size(); ++i) {
+    ASSERT_NEAR(h_ref[i], h_predt[i], kRtEps);
+  }
+
+  // A matrix with a different number of rows must be rejected.
+  auto p_invalid = RandomDataGenerator{kRows / 2, kCols, 0.2}.GenerateDMatrix(true);
+  ASSERT_THROW(learner->TransferPredictionCache(p_rebuilt.get(), p_invalid), dmlc::Error);
+}
+
 TEST(Learner, Configuration) {
   std::string const emetric = "eval_metric";
   {
@@ -152,6 +191,33 @@ TEST(Learner, Configuration) {
   }
 }
 
+TEST(Learner, NoOpSetParam) {
+  std::size_t constexpr kRows = 10;
+  auto p_mat = RandomDataGenerator{kRows, 10, 0}.GenerateDMatrix(true);
+  std::unique_ptr<Learner> learner{Learner::Create({p_mat})};
+  learner->SetParam("objective", "reg:squarederror");
+  learner->SetParam("max_depth", "2");
+  learner->Configure();
+  learner->UpdateOneIter(0, p_mat);
+
+  // Setting the same values again must not mark the learner for reconfiguration;
+  // SaveConfig checks that no configuration is pending.
+  learner->SetParam("objective", "reg:squarederror");
+  learner->SetParam("max_depth", "2");
+  Json config{Object{}};
+  learner->SaveConfig(&config);
+
+  // A real change still triggers a reconfiguration.
+  learner->SetParam("max_depth", "3");
+  ASSERT_THROW({ learner->SaveConfig(&config); }, dmlc::Error);
+  learner->Configure();
+  learner->SaveConfig(&config);
+
+  // Setting the parameter back to the applied value is again a no-op.
+  learner->SetParam("max_depth", "3");
+  learner->SaveConfig(&config);
+}
+
 TEST(Learner, JsonModelIO) {
   // Test of comparing JSON object directly.
   size_t constexpr kRows = 8;
@@ -205,6 +271,35 @@ TEST(Learner, JsonModelIO) {
   }
 }
 
+TEST(Learner, AsyncModelIO) {
+  std::size_t constexpr kRows = 64;
+  std::int32_t constexpr kIters = 4;
+  std::shared_ptr<DMatrix> p_dmat{RandomDataGenerator{kRows, 10, 0}.GenerateDMatrix(true)};
+
+  std::unique_ptr<Learner> learner{Learner::Create({p_dmat})};
+  learner->Configure();
+  for (std::int32_t iter = 0; iter < kIters; ++iter) {
+    learner->UpdateOneIter(iter, p_dmat);
+  }
+
+  Json expected{Object{}};
+  learner->SaveModel(&expected);
+
+  dmlc::TemporaryDirectory tmpdir;
+  auto fname = tmpdir.path + "/model.ubj";
+  learner->SaveModelAsync(fname);
+  // Training continues while the snapshot is being written, the file must reflect the
+  // model at the time of the call.
+  for (std::int32_t iter = kIters; iter < 2 * kIters; ++iter) {
+    learner->UpdateOneIter(iter, p_dmat);
+  }
+  learner->FinishSaveModelAsync();
+
+  auto buffer = common::LoadSequentialFile(fname);
+  Json loaded = Json::Load(StringView{buffer.data(), buffer.size()}, std::ios::binary);
+  ASSERT_EQ(loaded, expected);
+}
+
 TEST(Learner, ConfigIO) {
   bst_idx_t n_samples = 128;
   bst_feature_t n_features = 12;
@@ -233,6 +328,59 @@ TEST(Learner, ConfigIO) {
   ASSERT_EQ(eval_res_0, eval_res_1);
 }
 
+TEST(Learner, StagedEval) {
+  bst_idx_t n_samples = 256;
+  bst_feature_t n_features = 8;
+  std::shared_ptr<DMatrix> p_fmat{
+      RandomDataGenerator{n_samples, n_features, 0}.GenerateDMatrix(true)};
+
+  std::unique_ptr<Learner> full{Learner::Create({p_fmat})};
+  full->Configure();
+  std::unique_ptr<Learner> staged{Learner::Create({p_fmat})};
+  staged->SetParams(Args{{"eval_subsample", "0.25"}, {"eval_escalation_band", "0.0"}});
+  staged->Configure();
+
+  for (std::int32_t iter = 0; iter < 4; ++iter) {
+    full->UpdateOneIter(iter, p_fmat);
+    staged->UpdateOneIter(iter, p_fmat);
+  }
+  // The first evaluation always escalates to the full set, so both learners report the
+  // exact full-set score.
+  auto res_full = full->EvalOneIter(0, {p_fmat}, {"Train"});
+  auto res_staged = staged->EvalOneIter(0, {p_fmat}, {"Train"});
+  ASSERT_EQ(res_full, res_staged);
+  // Following rounds stay well-formed whether or not they escalate.
+  res_staged = staged->EvalOneIter(1, {p_fmat}, {"Train"});
+  ASSERT_NE(res_staged.find("Train-rmse"), std::string::npos);
+}
+
+TEST(Learner, AsyncEval) {
+  bst_idx_t n_samples = 256;
+  bst_feature_t n_features = 8;
+  std::shared_ptr<DMatrix> p_fmat{
+      RandomDataGenerator{n_samples, n_features, 0}.GenerateDMatrix(true)};
+
+  std::unique_ptr<Learner> sync{Learner::Create({p_fmat})};
+  sync->Configure();
+  std::unique_ptr<Learner> async{Learner::Create({p_fmat})};
+  async->SetParams(Args{{"async_eval", "true"}});
+  async->Configure();
+
+  sync->UpdateOneIter(0, p_fmat);
+  async->UpdateOneIter(0, p_fmat);
+  // The first asynchronous call only submits work and reports no scores.
+  auto res_async = async->EvalOneIter(0, {p_fmat}, {"Train"});
+  ASSERT_EQ(res_async, "[0]");
+  auto res_sync = sync->EvalOneIter(0, {p_fmat}, {"Train"});
+
+  sync->UpdateOneIter(1, p_fmat);
+  async->UpdateOneIter(1, p_fmat);
+  // The scores arrive one round late and match the synchronous evaluation of the same
+  // model state.
+  res_async = async->EvalOneIter(1, {p_fmat}, {"Train"});
+  ASSERT_EQ(res_async, res_sync);
+}
+
 // Crashes the test runner if there are race condiditions.
 //
 // Build with additional cmake flags to enable thread sanitizer
@@ -56,23 +56,47 @@ TEST(GpuHist, DriverLossGuided) {
   GPUExpandEntry root(0, 0, high_gain, 2.0f, 1.0f, 1.0f );
   driver.Push({root});
   EXPECT_EQ(driver.Pop().front().nid, 0);
-  // Select high gain first
+  // With unbounded leaves the candidates are batched, high gain first.
   driver.Push({GPUExpandEntry{1, 1, low_gain, 2.0f, 1.0f, 1.0f}});
   driver.Push({GPUExpandEntry{2, 2, high_gain, 2.0f, 1.0f, 1.0f}});
   auto res = driver.Pop();
-  EXPECT_EQ(res.size(), 1);
+  ASSERT_EQ(res.size(), 2);
   EXPECT_EQ(res[0].nid, 2);
-  res = driver.Pop();
-  EXPECT_EQ(res.size(), 1);
-  EXPECT_EQ(res[0].nid, 1);
+  EXPECT_EQ(res[1].nid, 1);
 
   // If equal gain, use nid
   driver.Push({GPUExpandEntry{2, 1, low_gain, 2.0f, 1.0f, 1.0f}});
   driver.Push({GPUExpandEntry{1, 1, low_gain, 2.0f, 1.0f, 1.0f}});
   res = driver.Pop();
+  ASSERT_EQ(res.size(), 2);
   EXPECT_EQ(res[0].nid, 1);
-  res = driver.Pop();
+  EXPECT_EQ(res[1].nid, 2);
+}
+
+TEST(GpuHist, DriverLossGuidedBounded) {
+  DeviceSplitCandidate high_gain;
+  high_gain.left_sum = {0, 1};
+  high_gain.right_sum = {0, 1};
+  high_gain.loss_chg = 5.0f;
+  DeviceSplitCandidate low_gain = high_gain;
+  low_gain.loss_chg = 1.0f;
+
+  TrainParam p;
+  p.UpdateAllowUnknown(Args{{"grow_policy", "lossguide"}, {"max_leaves", "8"}});
+
+  // A leaf bound makes the pop order decide the final tree, so candidates are
+  // expanded one at a time.
+  Driver<GPUExpandEntry> driver(p);
+  driver.Push({GPUExpandEntry{0, 0, high_gain, 2.0f, 1.0f, 1.0f}});
+  EXPECT_EQ(driver.Pop().front().nid, 0);
+  driver.Push({GPUExpandEntry{1, 1, low_gain, 2.0f, 1.0f, 1.0f}});
+  driver.Push({GPUExpandEntry{2, 2, high_gain, 2.0f, 1.0f, 1.0f}});
+  auto res = driver.Pop();
+  ASSERT_EQ(res.size(), 1);
   EXPECT_EQ(res[0].nid, 2);
+  res = driver.Pop();
+  ASSERT_EQ(res.size(), 1);
+  EXPECT_EQ(res[0].nid, 1);
 }
 }  // namespace tree
 }  // namespace xgboost
@@ -99,7 +99,7 @@ std::vector<GradientPairPrecise> GetHostHistGpair() {
   return hist_gpair;
 }
 
-void TestBuildHist(bool use_shared_memory_histograms) {
+void TestBuildHist(bool use_shared_memory_histograms, bool narrow_hist = false) {
   int const kNRows = 16, kNCols = 8;
   auto ctx = MakeCUDACtx(0);
 
@@ -125,7 +125,7 @@ void TestBuildHist(bool use_shared_memory_histograms) {
   DeviceHistogramBuilder builder;
   builder.Reset(&ctx, HistMakerTrainParam::CudaDefaultNodes(),
                 feature_groups.DeviceAccessor(ctx.Device()), page->Cuts().TotalBins(),
-                !use_shared_memory_histograms);
+                !use_shared_memory_histograms, narrow_hist);
   builder.AllocateHistograms(&ctx, {0});
   builder.BuildHistogram(ctx.CUDACtx(), page->GetDeviceAccessor(&ctx),
                          feature_groups.DeviceAccessor(ctx.Device()), gpair.DeviceSpan(),
@@ -152,6 +152,12 @@ TEST(Histogram, BuildHistSharedMem) {
   TestBuildHist(true);
 }
 
+TEST(Histogram, BuildHistNarrow) {
+  // Reduced-precision shared memory accumulation, truncation error is well below the
+  // comparison tolerance.
+  TestBuildHist(true, true);
+}
+
 namespace {
 void TestDeterministicHistogram(bool is_dense, std::size_t shm_size, bool force_global) {
   Context ctx = MakeCUDACtx(0);
@@ -257,6 +263,57 @@ INSTANTIATE_TEST_SUITE_P(Histogram, TestGPUDeterministic,
                                             ::testing::Values(48 * 1024, 64 * 1024, 160 * 1024),
                                             ::testing::Bool()));
 
+namespace {
+void TestWarpAggregatedHistogram() {
+  auto ctx = MakeCUDACtx(0);
+  // Few bins per feature so that many lanes of a warp share a bin and the collision
+  // heuristic switches to the warp-aggregated kernels.
+  std::size_t constexpr kBins = 4, kCols = 16, kRows = 8192;
+  auto matrix = RandomDataGenerator(kRows, kCols, 0.0f).GenerateDMatrix();
+  auto batch_param = BatchParam{kBins, tree::TrainParam::DftSparseThreshold()};
+
+  for (auto const& batch : matrix->GetBatches<EllpackPage>(&ctx, batch_param)) {
+    auto* page = batch.Impl();
+
+    RowPartitioner row_partitioner;
+    row_partitioner.Reset(&ctx, kRows, page->base_rowid);
+    auto ridx = row_partitioner.GetRows(0);
+
+    bst_bin_t num_bins = page->Cuts().TotalBins();
+    auto gpair = GenerateRandomGradients(kRows, -1.0f, 1.0f);
+    gpair.SetDevice(ctx.Device());
+    auto quantiser = GradientQuantiser(&ctx, gpair.DeviceSpan(), MetaInfo());
+
+    auto build = [&](bool force_global, common::Span<GradientPairInt64> out) {
+      auto shm_size = force_global ? 0 : dh::MaxSharedMemoryOptin(ctx.Ordinal());
+      FeatureGroups feature_groups{page->Cuts(), page->IsDenseCompressed(), shm_size};
+      DeviceHistogramBuilder builder;
+      builder.Reset(&ctx, HistMakerTrainParam::CudaDefaultNodes(),
+                    feature_groups.DeviceAccessor(ctx.Device()), num_bins, force_global);
+      builder.BuildHistogram(ctx.CUDACtx(), page->GetDeviceAccessor(&ctx),
+                             feature_groups.DeviceAccessor(ctx.Device()), gpair.DeviceSpan(), ridx,
+                             out, quantiser);
+    };
+
+    dh::device_vector<GradientPairInt64> shared_hist(num_bins), global_hist(num_bins);
+    build(false, dh::ToSpan(shared_hist));
+    build(true, dh::ToSpan(global_hist));
+
+    std::vector<GradientPairInt64> shared_h(num_bins), global_h(num_bins);
+    dh::CopyDeviceSpanToVector(&shared_h, dh::ToSpan(shared_hist));
+    dh::CopyDeviceSpanToVector(&global_h, dh::ToSpan(global_hist));
+    for (bst_bin_t i = 0; i < num_bins; ++i) {
+      // Fixed-point accumulation is order independent, so the aggregated result matches
+      // the global memory kernel exactly.
+      ASSERT_EQ(shared_h[i].GetQuantisedGrad(), global_h[i].GetQuantisedGrad());
+      ASSERT_EQ(shared_h[i].GetQuantisedHess(), global_h[i].GetQuantisedHess());
+    }
+  }
+}
+}  // anonymous namespace
+
+TEST(Histogram, BuildHistWarpAggregated) { TestWarpAggregatedHistogram(); }
+
 void ValidateCategoricalHistogram(size_t n_categories, common::Span<GradientPairInt64> onehot,
                                   common::Span<GradientPairInt64> cat) {
   auto cat_sum = std::accumulate(cat.cbegin(), cat.cend(), GradientPairInt64{});
@@ -107,7 +107,7 @@ void TestSyncHist(bool is_distributed) {
   common::RowSetCollection row_set_collection;
   {
     row_set_collection.Clear();
-    std::vector<bst_idx_t> &row_indices = *row_set_collection.Data();
+    auto &row_indices = *row_set_collection.Data();
     row_indices.resize(kNRows);
     std::iota(row_indices.begin(), row_indices.end(), 0);
     row_set_collection.Init();
@@ -249,7 +249,7 @@ void TestBuildHistogram(Context const* ctx, bool is_distributed, bool force_read
 
   common::RowSetCollection row_set_collection;
   row_set_collection.Clear();
-  std::vector<bst_idx_t> &row_indices = *row_set_collection.Data();
+  auto &row_indices = *row_set_collection.Data();
   row_indices.resize(kNRows);
   std::iota(row_indices.begin(), row_indices.end(), 0);
   row_set_collection.Init();
@@ -298,6 +298,81 @@ TEST(CPUHistogram, BuildHist) {
   TestBuildHistogram(&ctx, false, true, false);
 }
 
+// The fused multi-target build must match a per-target accumulation.
+TEST(CPUHistogram, BuildHistMultiTarget) {
+  Context ctx;
+  bst_idx_t constexpr kRows = 128;
+  bst_feature_t constexpr kCols = 16;
+  bst_target_t constexpr kTargets = 3;
+  bst_bin_t constexpr kMaxBins = 4;
+  static double constexpr kEps = 1e-6;
+
+  auto p_fmat = RandomDataGenerator(kRows, kCols, 0.8).Seed(3).GenerateDMatrix();
+  auto batch = BatchParam{kMaxBins, 0.5};
+  auto const &gmat = *(p_fmat->GetBatches<GHistIndexMatrix>(&ctx, batch).begin());
+  bst_bin_t total_bins = gmat.cut.Ptrs().back();
+
+  auto gpair = GenerateRandomGradients(&ctx, kRows, kTargets);
+  auto h_gpair = gpair.HostView();
+
+  RegTree tree{kTargets, kCols};
+  HistMakerTrainParam hist_param;
+  MultiHistogramBuilder histogram;
+  histogram.Reset(&ctx, total_bins, kTargets, batch, false, false, &hist_param);
+
+  std::vector<CommonRowPartitioner> partitioners;
+  partitioners.emplace_back(&ctx, kRows, /*base_rowid=*/0, /*is_col_split=*/false);
+
+  MultiExpandEntry best{RegTree::kRoot, 0};
+  histogram.BuildRootHist(p_fmat.get(), &tree, partitioners, h_gpair, best, batch);
+
+  for (bst_target_t t{0}; t < kTargets; ++t) {
+    std::vector<GradientPairPrecise> expected(total_bins);
+    for (std::size_t rid = 0; rid < kRows; ++rid) {
+      for (std::size_t i = gmat.row_ptr[rid]; i < gmat.row_ptr[rid + 1]; ++i) {
+        expected[gmat.index[i]] += GradientPairPrecise{h_gpair(rid, t)};
+      }
+    }
+    auto hist = histogram.Histogram(t)[RegTree::kRoot];
+    ASSERT_EQ(hist.size(), expected.size());
+    for (bst_bin_t i = 0; i < total_bins; ++i) {
+      ASSERT_NEAR(expected[i].GetGrad(), hist[i].GetGrad(), kEps);
+      ASSERT_NEAR(expected[i].GetHess(), hist[i].GetHess(), kEps);
+    }
+  }
+}
+
+TEST(CPUHistogram, SparseSyncHist) {
+  auto constexpr kWorkers = 4;
+  collective::TestDistributedGlobal(kWorkers, [&] {
+    Context ctx;
+    auto rank = collective::GetRank();
+    {
+      // Mostly empty, taken by the run-length encoded path.
+      std::vector<double> hist(8192, 0.0);
+      hist[rank * 16] = static_cast<double>(rank + 1);
+      hist[rank * 16 + 1] = 1.0;
+      auto rc = SparseSyncHist(&ctx, common::Span{hist.data(), hist.size()});
+      SafeColl(rc);
+      for (std::int32_t r = 0; r < kWorkers; ++r) {
+        ASSERT_EQ(hist[r * 16], static_cast<double>(r + 1));
+        ASSERT_EQ(hist[r * 16 + 1], 1.0);
+      }
+      auto total = std::accumulate(hist.cbegin(), hist.cend(), 0.0);
+      ASSERT_EQ(total, kWorkers * (kWorkers + 1) / 2.0 + kWorkers);
+    }
+    {
+      // Dense input, must fall back to the plain allreduce.
+      std::vector<double> hist(128, 1.0);
+      auto rc = SparseSyncHist(&ctx, common::Span{hist.data(), hist.size()});
+      SafeColl(rc);
+      for (auto v : hist) {
+        ASSERT_EQ(v, static_cast<double>(kWorkers));
+      }
+    }
+  });
+}
+
 TEST(CPUHistogram, BuildHistColumnSplit) {
   auto constexpr kWorkers = 4;
   Context ctx;
@@ -348,7 +423,7 @@ void TestHistogramCategorical(size_t n_categories, bool force_read_by_column) {
 
   common::RowSetCollection row_set_collection;
   row_set_collection.Clear();
-  std::vector<bst_idx_t> &row_indices = *row_set_collection.Data();
+  auto &row_indices = *row_set_collection.Data();
   row_indices.resize(kRows);
   std::iota(row_indices.begin(), row_indices.end(), 0);
   row_set_collection.Init();
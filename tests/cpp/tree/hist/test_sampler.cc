@@ -5,6 +5,7 @@
 
 #include <cstddef>  // std::size_t
 #include <string>   // std::to_string
+#include <utility>  // std::as_const
 
 #include "../../../../src/tree/hist/sampler.h"  // SampleGradient
 #include "../../../../src/tree/param.h"         // TrainParam
@@ -53,5 +54,73 @@ TEST(Sampler, Basic) {
   run(1);
   run(3);
 }
+
+TEST(Sampler, FusedCopy) {
+  std::size_t constexpr kRows = 1024;
+  double constexpr kSubsample = .5;
+  TrainParam param;
+  param.UpdateAllowUnknown(Args{{"subsample", std::to_string(kSubsample)}});
+  Context ctx;
+
+  // The fused copy + sample overload must draw the same coin flips as the in-place one.
+  auto run = [&](bst_target_t n_targets) {
+    auto init = GradientPair{1.0f, 1.0f};
+    linalg::Matrix<GradientPair> in = linalg::Constant(&ctx, init, kRows, n_targets);
+    linalg::Matrix<GradientPair> out = linalg::Empty<GradientPair>(&ctx, kRows, n_targets);
+    linalg::Matrix<GradientPair> inplace = linalg::Constant(&ctx, init, kRows, n_targets);
+
+    common::GlobalRandom().seed(2024);
+    SampleGradient(&ctx, param, std::as_const(in).HostView(), out.HostView());
+    common::GlobalRandom().seed(2024);
+    SampleGradient(&ctx, param, inplace.HostView());
+
+    auto h_out = out.HostView();
+    auto h_inplace = inplace.HostView();
+    for (std::size_t i = 0; i < kRows; ++i) {
+      for (bst_target_t t = 0; t < n_targets; ++t) {
+        ASSERT_EQ(h_out(i, t).GetGrad(), h_inplace(i, t).GetGrad());
+        ASSERT_EQ(h_out(i, t).GetHess(), h_inplace(i, t).GetHess());
+      }
+    }
+  };
+
+  run(1);
+  run(3);
+}
+
+TEST(Sampler, Goss) {
+  std::size_t constexpr kRows = 4096;
+  float constexpr kTopRate = 0.2f, kOtherRate = 0.1f;
+  Context ctx;
+  linalg::Matrix<GradientPair> gpair = linalg::Empty<GradientPair>(&ctx, kRows, 1);
+  auto h_gpair = gpair.HostView();
+  for (std::size_t i = 0; i < kRows; ++i) {
+    // Distinct magnitudes, the first kRows * kTopRate rows have the largest gradients.
+    h_gpair(i, 0) = GradientPair{static_cast<float>(kRows - i), 1.0f};
+  }
+  common::GlobalRandom().seed(2024);
+  GossSampleGradient(&ctx, kTopRate, kOtherRate, h_gpair);
+
+  auto k = static_cast<std::size_t>(kTopRate * kRows);
+  float amplify = (1.0f - kTopRate) / kOtherRate;
+  std::size_t n_rest{0};
+  for (std::size_t i = 0; i < kRows; ++i) {
+    auto expected = static_cast<float>(kRows - i);
+    if (i < k) {
+      // Top rows keep their gradient untouched.
+      ASSERT_EQ(h_gpair(i, 0).GetGrad(), expected);
+      ASSERT_EQ(h_gpair(i, 0).GetHess(), 1.0f);
+    } else if (h_gpair(i, 0).GetHess() != .0f) {
+      // Sampled rest is amplified to keep the distribution unbiased.
+      ASSERT_EQ(h_gpair(i, 0).GetGrad(), expected * amplify);
+      ASSERT_EQ(h_gpair(i, 0).GetHess(), amplify);
+      n_rest++;
+    }
+  }
+  auto ratio = static_cast<double>(n_rest) / static_cast<double>(kRows - k);
+  double keep_prob = kOtherRate / (1.0 - kTopRate);
+  ASSERT_LT(ratio, keep_prob * 1.5);
+  ASSERT_GT(ratio, keep_prob * 0.5);
+}
 }  // namespace tree
 }  // namespace xgboost
@@ -130,6 +130,41 @@ TEST(Approx, InteractionConstraint) {
   }
 }
 
+TEST(Approx, SketchReuse) {
+  auto constexpr kRows = 256;
+  auto constexpr kCols = 16;
+  Context ctx;
+  auto p_dmat = RandomDataGenerator{kRows, kCols, 0}.GenerateDMatrix(true);
+
+  linalg::Matrix<GradientPair> gpair({kRows}, ctx.Device());
+  gpair.Data()->Copy(GenerateRandomGradients(kRows));
+
+  ObjInfo task{ObjInfo::kRegression};
+  TrainParam param;
+  param.Init(Args{});
+
+  auto run = [&](Args const& cfg) {
+    std::unique_ptr<TreeUpdater> updater{TreeUpdater::Create("grow_histmaker", &ctx, &task)};
+    updater->Configure(cfg);
+    std::vector<std::unique_ptr<RegTree>> trees;
+    for (std::int32_t i = 0; i < 4; ++i) {
+      trees.emplace_back(std::make_unique<RegTree>(1u, kCols));
+      std::vector<HostDeviceVector<bst_node_t>> position(1);
+      updater->Update(&param, &gpair, p_dmat.get(), position, {trees.back().get()});
+    }
+    return trees;
+  };
+
+  // The hessian does not change between iterations, so reusing the sketch must produce
+  // the same trees as rebuilding it every round.
+  auto baseline = run(Args{});
+  auto reused = run(Args{{"sketch_hess_tol", "0.5"}});
+  ASSERT_EQ(baseline.size(), reused.size());
+  for (std::size_t i = 0; i < baseline.size(); ++i) {
+    ASSERT_TRUE(*baseline[i] == *reused[i]);
+  }
+}
+
 namespace {
 void TestColumnSplitPartitioner(size_t n_samples, size_t base_rowid, std::shared_ptr<DMatrix> Xy,
                                 std::vector<float>* hess, float min_value, float mid_value,
@@ -130,6 +130,56 @@ void TestExternalMemory() {
   auto end_it = std::unique(position.begin(), position.end());
   ASSERT_EQ(std::distance(position.begin(), end_it), 2);
 }
+void TestPartitionReuse() {
+  std::size_t const n_samples = 256, n_features = 4, base_rowid = 0;
+  Context ctx;
+  auto Xy = RandomDataGenerator{n_samples, n_features, 0}.GenerateDMatrix(true);
+
+  auto extract = [](CommonRowPartitioner const& part, bst_node_t nidx) {
+    auto const& elem = part.Partitions()[nidx];
+    return std::vector<common::RowIndexT>(elem.begin(), elem.end());
+  };
+
+  for (auto const& page : Xy->GetBatches<GHistIndexMatrix>(&ctx, BatchParam{64, 0.2})) {
+    auto ptr = page.cut.Ptrs()[1];
+    float split_value = page.cut.Values().at(ptr / 2);
+
+    RegTree tree;
+    std::vector<CPUExpandEntry> candidates{{0, 0}};
+    GetSplit(&tree, split_value, &candidates);
+
+    CommonRowPartitioner partitioner{&ctx, n_samples, base_rowid, false};
+    partitioner.UpdatePosition(&ctx, page, candidates, &tree);
+
+    auto left = extract(partitioner, tree.LeftChild(RegTree::kRoot));
+    auto right = extract(partitioner, tree.RightChild(RegTree::kRoot));
+
+    // A second tree with an identical root split keeps the recorded child ranges.
+    RegTree next;
+    std::vector<CPUExpandEntry> next_candidates{{0, 0}};
+    GetSplit(&next, split_value, &next_candidates);
+    partitioner.ReuseForTree(&tree);
+    partitioner.UpdatePosition(&ctx, page, next_candidates, &next);
+    ASSERT_EQ(extract(partitioner, next.LeftChild(RegTree::kRoot)), left);
+    ASSERT_EQ(extract(partitioner, next.RightChild(RegTree::kRoot)), right);
+
+    // A differing split falls back to the row scan and matches a fresh partitioner.
+    float other_value = page.cut.Values().at(ptr / 4);
+    ASSERT_NE(other_value, split_value);
+    RegTree other;
+    std::vector<CPUExpandEntry> other_candidates{{0, 0}};
+    GetSplit(&other, other_value, &other_candidates);
+    partitioner.ReuseForTree(&next);
+    partitioner.UpdatePosition(&ctx, page, other_candidates, &other);
+
+    CommonRowPartitioner fresh{&ctx, n_samples, base_rowid, false};
+    fresh.UpdatePosition(&ctx, page, other_candidates, &other);
+    auto left_nidx = other.LeftChild(RegTree::kRoot);
+    auto right_nidx = other.RightChild(RegTree::kRoot);
+    ASSERT_EQ(extract(partitioner, left_nidx), extract(fresh, left_nidx));
+    ASSERT_EQ(extract(partitioner, right_nidx), extract(fresh, right_nidx));
+  }
+}
 }  // anonymous namespace
 
 TEST(CommonRowPartitioner, LeafPartition) {
@@ -139,4 +189,6 @@ TEST(CommonRowPartitioner, LeafPartition) {
 }
 
 TEST(CommonRowPartitioner, LeafPartitionExternalMemory) { TestExternalMemory(); }
+
+TEST(CommonRowPartitioner, ReuseForTree) { TestPartitionReuse(); }
 }  // namespace xgboost::tree
@@ -59,6 +59,31 @@ TEST(CPUFeatureInteractionConstraint, Basic) {
   ASSERT_FALSE(constraints.Query(1, 5));
 }
 
+TEST(CPUFeatureInteractionConstraint, Incremental) {
+  std::string const constraints_str = R"constraint([[1, 2], [2, 3, 4]])constraint";
+  TrainParam param;
+  param.interaction_constraints = constraints_str;
+  bst_feature_t constexpr kFeatures = 6;
+
+  FeatureInteractionConstraintHost constraints;
+  constraints.Configure(param, kFeatures);
+  // The allowed mask narrows as the path grows: after splitting on {2, 3} only the
+  // second group is still a superset of the path.
+  constraints.Split(/*node_id=*/0, /*feature_id=*/2, /*left_id=*/1, /*right_id=*/2);
+  constraints.Split(/*node_id=*/1, /*feature_id=*/3, /*left_id=*/3, /*right_id=*/4);
+
+  ASSERT_TRUE(constraints.Query(3, 2));
+  ASSERT_TRUE(constraints.Query(3, 3));
+  ASSERT_TRUE(constraints.Query(3, 4));
+  ASSERT_FALSE(constraints.Query(3, 1));
+  ASSERT_FALSE(constraints.Query(3, 0));
+  // out of range features are never permitted.
+  ASSERT_FALSE(constraints.Query(3, 100));
+  // the sibling's mask matches.
+  ASSERT_TRUE(constraints.Query(4, 4));
+  ASSERT_FALSE(constraints.Query(4, 1));
+}
+
 TEST(CPUMonoConstraint, Basic) {
   std::size_t kRows{64}, kCols{16};
   Context ctx;
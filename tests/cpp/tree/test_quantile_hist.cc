@@ -3,9 +3,12 @@
  */
 #include <gtest/gtest.h>
 #include <xgboost/host_device_vector.h>
+#include <xgboost/json.h>     // for Json, Object
+#include <xgboost/learner.h>  // for Learner
 #include <xgboost/tree_updater.h>
 
 #include <cstddef>  // for size_t
+#include <memory>   // for unique_ptr
 #include <string>
 #include <vector>
 
@@ -95,6 +98,74 @@ TEST(QuantileHist, Partitioner) { TestPartitioner<CPUExpandEntry>(1); }
 
 TEST(QuantileHist, MultiPartitioner) { TestPartitioner<MultiExpandEntry>(3); }
 
+TEST(QuantileHist, CompactPartitioner) {
+  Context ctx;
+  std::size_t n_samples = 128, base_rowid = 8;
+  std::vector<GradientPair> gpair(n_samples);
+  std::size_t n_sampled = 0;
+  for (std::size_t i = 0; i < n_samples; ++i) {
+    if (i % 3 == 0) {
+      gpair[i] = GradientPair{1.0f, 1.0f};
+      n_sampled++;
+    }
+  }
+  CommonRowPartitioner partitioner{&ctx, common::Span<GradientPair const>{gpair}, n_samples,
+                                   base_rowid, false};
+  ASSERT_EQ(partitioner[0].Size(), n_sampled);
+  std::size_t k = 0;
+  for (auto ridx : partitioner[0]) {
+    ASSERT_EQ(ridx, k * 3 + base_rowid);
+    ++k;
+  }
+}
+
+TEST(QuantileHist, CompactSubsample) {
+  auto Xy = RandomDataGenerator{512, 8, 0.0}.GenerateDMatrix(true);
+  auto train = [&](std::string compact) {
+    auto learner = std::unique_ptr<Learner>{Learner::Create({Xy})};
+    learner->SetParam("tree_method", "hist");
+    learner->SetParam("subsample", "0.5");
+    learner->SetParam("seed", "2026");
+    learner->SetParam("compact_subsample", compact);
+    learner->Configure();
+    for (std::int32_t i = 0; i < 4; ++i) {
+      learner->UpdateOneIter(i, Xy);
+    }
+    Json model{Object{}};
+    learner->SaveModel(&model);
+    std::string str;
+    Json::Dump(model, &str);
+    return str;
+  };
+  // Rows with zero gradient contribute nothing to the histograms, dropping them from
+  // the partitioner must not change the model.
+  ASSERT_EQ(train("true"), train("false"));
+}
+
+TEST(QuantileHist, ReusePartition) {
+  bst_target_t n_classes = 4;
+  auto Xy = RandomDataGenerator{512, 8, 0.0}.Classes(n_classes).GenerateDMatrix(true);
+  auto train = [&](std::string reuse) {
+    auto learner = std::unique_ptr<Learner>{Learner::Create({Xy})};
+    learner->SetParam("tree_method", "hist");
+    learner->SetParam("objective", "multi:softprob");
+    learner->SetParam("num_class", std::to_string(n_classes));
+    learner->SetParam("reuse_partition", reuse);
+    learner->Configure();
+    for (std::int32_t i = 0; i < 4; ++i) {
+      learner->UpdateOneIter(i, Xy);
+    }
+    Json model{Object{}};
+    learner->SaveModel(&model);
+    std::string str;
+    Json::Dump(model, &str);
+    return str;
+  };
+  // Reuse is exact-match only: carrying the partitions across the trees of a round and
+  // across boosting rounds must not change the model.
+  ASSERT_EQ(train("true"), train("false"));
+}
+
 namespace {
 
 template <typename ExpandEntry>
@@ -63,11 +63,14 @@ class RegenTest : public ::testing::Test {
 
   template <typename Page>
   size_t TestTreeMethod(Context const* ctx, std::string tree_method, std::string obj,
-                        bool reset = true) const {
+                        bool reset = true, Args const& extra = {}) const {
     auto learner = std::unique_ptr<Learner>{Learner::Create({p_fmat_})};
     learner->SetParam("device", ctx->DeviceName());
     learner->SetParam("tree_method", tree_method);
     learner->SetParam("objective", obj);
+    for (auto const& [key, value] : extra) {
+      learner->SetParam(key, value);
+    }
     learner->Configure();
 
     for (auto i = 0; i < Iter(); ++i) {
@@ -104,6 +107,17 @@ TEST_F(RegenTest, Hist) {
   ASSERT_EQ(n, 1);
 }
 
+TEST_F(RegenTest, HistRebin) {
+  Context ctx;
+  // Initial build, then a hessian-weighted refresh every second tree.
+  auto n = this->TestTreeMethod<GHistIndexMatrix>(&ctx, "hist", "reg:logistic", true,
+                                                  {{"rebin_interval", "2"}});
+  ASSERT_EQ(n, 1 + (this->Iter() - 1) / 2);
+  // Disabled by default.
+  n = this->TestTreeMethod<GHistIndexMatrix>(&ctx, "hist", "reg:logistic");
+  ASSERT_EQ(n, 1);
+}
+
 TEST_F(RegenTest, Mixed) {
   Context ctx;
   auto n = this->TestTreeMethod<GHistIndexMatrix>(&ctx, "hist", "reg:squarederror", false);
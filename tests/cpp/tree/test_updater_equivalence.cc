@@ -0,0 +1,150 @@
+/**
+ * Copyright 2026, XGBoost Contributors
+ *
+ * Regression-detection harness running two tree updaters on identical inputs and
+ * diffing the resulting trees structurally.  Canary pipelines can compare an upgraded
+ * `hist` against a reference implementation (or against itself across configurations)
+ * and get both a node-level difference count and wall-clock timings.
+ */
+#include <gtest/gtest.h>
+#include <xgboost/context.h>             // for Context
+#include <xgboost/data.h>                // for DMatrix
+#include <xgboost/host_device_vector.h>  // for HostDeviceVector
+#include <xgboost/linalg.h>              // for Matrix
+#include <xgboost/task.h>                // for ObjInfo
+#include <xgboost/tree_model.h>          // for RegTree
+#include <xgboost/tree_updater.h>        // for TreeUpdater
+
+#include <memory>   // for unique_ptr
+#include <string>   // for string
+#include <utility>  // for pair
+#include <vector>   // for vector
+
+#include "../../../src/common/timer.h"  // for Timer
+#include "../../../src/tree/param.h"    // for TrainParam
+#include "../helpers.h"
+
+namespace xgboost::tree {
+namespace {
+struct UpdaterRun {
+  RegTree tree;
+  double elapsed_sec{0.0};
+};
+
+// Build one tree with the named updater, reusing the caller's data and gradients so
+// both sides of a comparison see byte-identical inputs.
+UpdaterRun RunUpdater(Context const* ctx, std::string const& name, Args const& args,
+                      std::shared_ptr<DMatrix> Xy, linalg::Matrix<GradientPair>* gpair) {
+  ObjInfo task{ObjInfo::kRegression};
+  std::unique_ptr<TreeUpdater> updater{TreeUpdater::Create(name, ctx, &task)};
+  updater->Configure({});
+  TrainParam param;
+  param.UpdateAllowUnknown(args);
+
+  UpdaterRun run{RegTree{1u, static_cast<bst_feature_t>(Xy->Info().num_col_)}, 0.0};
+  std::vector<RegTree*> trees{&run.tree};
+  std::vector<HostDeviceVector<bst_node_t>> position(1);
+  common::Timer timer;
+  timer.Start();
+  updater->Update(&param, gpair, Xy.get(), position, trees);
+  timer.Stop();
+  run.elapsed_sec = timer.ElapsedSeconds();
+  return run;
+}
+
+// Walk both trees in lockstep and count the nodes that disagree on structure: split
+// feature, split condition, default direction, or leaf value.  A mismatch stops the
+// descent below it, the subtrees are already incomparable.
+std::size_t CountTreeDiffs(RegTree const& lhs, RegTree const& rhs) {
+  std::size_t n_diffs{0};
+  std::vector<std::pair<bst_node_t, bst_node_t>> stack{{RegTree::kRoot, RegTree::kRoot}};
+  while (!stack.empty()) {
+    auto [lidx, ridx] = stack.back();
+    stack.pop_back();
+    auto const& lnode = lhs[lidx];
+    auto const& rnode = rhs[ridx];
+    if (lnode.IsLeaf() != rnode.IsLeaf()) {
+      ++n_diffs;
+      continue;
+    }
+    if (lnode.IsLeaf()) {
+      if (lnode.LeafValue() != rnode.LeafValue()) {
+        ++n_diffs;
+      }
+      continue;
+    }
+    if (lnode.SplitIndex() != rnode.SplitIndex() || lnode.SplitCond() != rnode.SplitCond() ||
+        lnode.DefaultLeft() != rnode.DefaultLeft()) {
+      ++n_diffs;
+      continue;
+    }
+    stack.emplace_back(lnode.LeftChild(), rnode.LeftChild());
+    stack.emplace_back(lnode.RightChild(), rnode.RightChild());
+  }
+  return n_diffs;
+}
+}  // namespace
+
+TEST(UpdaterEquivalence, DiffDetection) {
+  Context ctx;
+  auto Xy = RandomDataGenerator{512, 8, 0.0}.GenerateDMatrix(true);
+  auto gpair = GenerateRandomGradients(512);
+  linalg::Matrix<GradientPair> mgpair({512ul, 1ul}, ctx.Device());
+  mgpair.Data()->Copy(gpair);
+
+  Args args{{"max_depth", "4"}};
+  auto base = RunUpdater(&ctx, "grow_quantile_histmaker", args, Xy, &mgpair);
+  ASSERT_GT(base.tree.NumExtraNodes(), 0);
+  // A tree compared against itself has no differences.
+  ASSERT_EQ(CountTreeDiffs(base.tree, base.tree), 0);
+
+  // Perturbing a single leaf must be reported.
+  auto perturbed = base.tree;
+  perturbed.WalkTree([&](bst_node_t nidx) {
+    if (perturbed[nidx].IsLeaf()) {
+      perturbed[nidx].SetLeaf(perturbed[nidx].LeafValue() + 1.0f);
+      return false;
+    }
+    return true;
+  });
+  ASSERT_GT(CountTreeDiffs(base.tree, perturbed), 0);
+}
+
+TEST(UpdaterEquivalence, HistAcrossThreads) {
+  // `hist` must grow the exact same tree regardless of the thread count, anything else
+  // is a determinism regression.
+  auto Xy = RandomDataGenerator{1024, 16, 0.3}.GenerateDMatrix(true);
+  auto gpair = GenerateRandomGradients(1024);
+
+  Args args{{"max_depth", "6"}};
+  std::vector<UpdaterRun> runs;
+  for (auto n_threads : {1, 4}) {
+    Context ctx;
+    ctx.UpdateAllowUnknown(Args{{"nthread", std::to_string(n_threads)}});
+    linalg::Matrix<GradientPair> mgpair({1024ul, 1ul}, ctx.Device());
+    mgpair.Data()->Copy(gpair);
+    runs.emplace_back(RunUpdater(&ctx, "grow_quantile_histmaker", args, Xy, &mgpair));
+  }
+  ASSERT_EQ(CountTreeDiffs(runs.front().tree, runs.back().tree), 0);
+}
+
+TEST(UpdaterEquivalence, HistVsApprox) {
+  Context ctx;
+  auto Xy = RandomDataGenerator{1024, 16, 0.3}.GenerateDMatrix(true);
+  auto gpair = GenerateRandomGradients(1024);
+  linalg::Matrix<GradientPair> mgpair({1024ul, 1ul}, ctx.Device());
+  mgpair.Data()->Copy(gpair);
+
+  Args args{{"max_depth", "6"}};
+  auto hist = RunUpdater(&ctx, "grow_quantile_histmaker", args, Xy, &mgpair);
+  auto approx = RunUpdater(&ctx, "grow_histmaker", args, Xy, &mgpair);
+  ASSERT_GT(hist.tree.NumExtraNodes(), 0);
+  ASSERT_GT(approx.tree.NumExtraNodes(), 0);
+
+  // The sketching strategies differ, so structural divergence is reported rather than
+  // asserted away; the canary consumes the diff count and the timings.
+  auto n_diffs = CountTreeDiffs(hist.tree, approx.tree);
+  LOG(INFO) << "hist vs approx: " << n_diffs << " differing nodes, hist " << hist.elapsed_sec
+            << "s, approx " << approx.elapsed_sec << "s";
+}
+}  // namespace xgboost::tree